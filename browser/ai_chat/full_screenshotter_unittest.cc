@@ -9,7 +9,9 @@
 
 #include "base/memory/scoped_refptr.h"
 #include "base/notreached.h"
+#include "base/test/scoped_feature_list.h"
 #include "base/test/test_future.h"
+#include "brave/components/ai_chat/core/common/features.h"
 #include "chrome/test/base/chrome_render_view_host_test_harness.h"
 #include "components/paint_preview/common/mock_paint_preview_recorder.h"
 #include "components/paint_preview/common/mojom/paint_preview_recorder.mojom.h"
@@ -22,6 +24,7 @@
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/abseil-cpp/absl/strings/str_format.h"
 #include "third_party/blink/public/common/associated_interfaces/associated_interface_provider.h"
+#include "ui/gfx/codec/jpeg_codec.h"
 #include "ui/gfx/geometry/rect.h"
 #include "ui/gfx/image/image_unittest_util.h"
 
@@ -440,6 +443,47 @@ TEST_F(FullScreenshotterTest, CompositionSucceeded) {
   }
 }
 
+TEST_F(FullScreenshotterTest, CompositionSucceeded_ScreenshotEncoding) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeatureWithParameters(
+      features::kAIChatScreenshotEncoding, {{"format", "jpeg"}});
+  SetSize(gfx::Size(2560, 1440));
+  auto compositor_service = CreateCompositorService();
+  full_screenshotter()->InitCompositorServiceForTest(
+      std::move(compositor_service));
+
+  auto* client =
+      AsMockClient(full_screenshotter()->GetCompositorClientForTest());
+  base::flat_map<base::UnguessableToken,
+                 mojo::StructPtr<paint_preview::mojom::FrameData>>
+      frames;
+  auto root_frame = paint_preview::mojom::FrameData::New();
+  root_frame->scroll_extents = gfx::Size(2560, 7200);
+  auto token = base::UnguessableToken::Create();
+  frames.insert({token, std::move(root_frame)});
+  client->SetCompositeResponse(std::move(frames), token);
+
+  LaxMockPaintPreviewRecorder recorder;
+  auto response = paint_preview::mojom::PaintPreviewCaptureResponse::New();
+  response->geometry_metadata =
+      paint_preview::mojom::GeometryMetadataResponse::New();
+  response->skp.emplace(mojo_base::BigBuffer(true));
+  recorder.SetResponse(std::move(response));
+  OverrideInterface(&recorder);
+
+  auto result = CaptureScreenshots(web_contents());
+  ASSERT_TRUE(result.has_value());
+  ASSERT_EQ(result.value().size(), 5u);
+  for (const auto& image : result.value()) {
+    // Tiles are rasterized at the target width and keep their aspect ratio
+    // instead of being letterboxed.
+    SkBitmap decoded = gfx::JPEGCodec::Decode(image);
+    ASSERT_FALSE(decoded.isNull());
+    EXPECT_EQ(decoded.width(), 1024);
+    EXPECT_EQ(decoded.height(), 576);
+  }
+}
+
 TEST_F(FullScreenshotterTest, BitmapForMainFrameFailed) {
   SetSize(gfx::Size(1024, 768));
   auto compositor_service = CreateCompositorService();
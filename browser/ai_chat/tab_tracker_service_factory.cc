@@ -37,10 +37,6 @@ TabTrackerServiceFactory::TabTrackerServiceFactory()
 
 TabTrackerServiceFactory::~TabTrackerServiceFactory() = default;
 
-bool TabTrackerServiceFactory::ServiceIsCreatedWithBrowserContext() const {
-  return true;
-}
-
 content::BrowserContext* TabTrackerServiceFactory::GetBrowserContextToUse(
     content::BrowserContext* context) const {
   // If AIChat isn't allowed for this context, we don't need a
@@ -26,7 +26,6 @@ class TabTrackerServiceFactory : public BrowserContextKeyedServiceFactory {
       content::BrowserContext* context);
 
  protected:
-  bool ServiceIsCreatedWithBrowserContext() const override;
   content::BrowserContext* GetBrowserContextToUse(
       content::BrowserContext* context) const override;
 
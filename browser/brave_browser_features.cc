@@ -53,6 +53,16 @@ BASE_FEATURE(kBraveWebAssemblyJitless,
              base::FEATURE_DISABLED_BY_DEFAULT);
 #endif  // BUILDFLAG(BRAVE_V8_ENABLE_DRUMBRAKE)
 
+// Records per-helper wall time and async hop counts in BraveRequestHandler as
+// local histograms, for finding slow network delegate helpers.
+BASE_FEATURE(kBraveRequestHandlerHelperTiming,
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
+// Skips the OnBeforeURLRequest helpers for WebSocket handshakes to an endpoint
+// that the same frame was allowed to connect to within the last few seconds.
+BASE_FEATURE(kBraveWebSocketHandshakeDecisionCache,
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
 // Controls V8 jitless mode. When enabled, V8 runs in jitless
 // mode, which reduces performance but improves security.
 BASE_FEATURE(kBraveV8JitlessMode,
@@ -82,6 +92,12 @@ const base::FeatureParam<std::string> kBraveDayZeroExperimentVariant{
     /*name=*/"variant",
     /*default_value=*/""};
 
+const base::FeatureParam<base::TimeDelta>
+    kBraveWebSocketHandshakeDecisionCacheTtl{
+        &kBraveWebSocketHandshakeDecisionCache,
+        /*name=*/"ttl",
+        /*default_value=*/base::Seconds(10)};
+
 #if BUILDFLAG(IS_ANDROID)
 // The variant of the fresh NTP experiment. i.e. A, B, C, etc.
 const base::FeatureParam<std::string> kBraveFreshNtpAfterIdleExperimentVariant{
@@ -10,6 +10,7 @@
 
 #include "base/feature_list.h"
 #include "base/metrics/field_trial_params.h"
+#include "base/time/time.h"
 #include "brave/components/v8/buildflags/buildflags.h"
 
 namespace features {
@@ -21,6 +22,8 @@ BASE_DECLARE_FEATURE(kBraveCopyCleanLinkFromJs);
 BASE_DECLARE_FEATURE(kBraveOverrideDownloadDangerLevel);
 BASE_DECLARE_FEATURE(kBraveRoundedCornersByDefault);
 BASE_DECLARE_FEATURE(kBraveDayZeroExperiment);
+BASE_DECLARE_FEATURE(kBraveRequestHandlerHelperTiming);
+BASE_DECLARE_FEATURE(kBraveWebSocketHandshakeDecisionCache);
 #if BUILDFLAG(BRAVE_V8_ENABLE_DRUMBRAKE)
 BASE_DECLARE_FEATURE(kBraveWebAssemblyJitless);
 #endif  // BUILDFLAG(BRAVE_V8_ENABLE_DRUMBRAKE)
@@ -32,6 +35,8 @@ BASE_DECLARE_FEATURE(kBraveFreshNtpAfterIdleExperiment);
 #endif  // BUILDFLAG(IS_ANDROID)
 
 extern const base::FeatureParam<std::string> kBraveDayZeroExperimentVariant;
+extern const base::FeatureParam<base::TimeDelta>
+    kBraveWebSocketHandshakeDecisionCacheTtl;
 
 #if BUILDFLAG(IS_ANDROID)
 extern const base::FeatureParam<std::string>
@@ -6,6 +6,7 @@
 #include "brave/browser/brave_browser_main_extra_parts.h"
 
 #include "base/metrics/histogram_macros.h"
+#include "base/trace_event/trace_event.h"
 #include "brave/browser/brave_browser_process_impl.h"
 #include "brave/browser/misc_metrics/process_misc_metrics.h"
 #include "brave/browser/misc_metrics/uptime_monitor_impl.h"
@@ -72,6 +73,7 @@ void BraveBrowserMainExtraParts::PostBrowserStart() {
 }
 
 void BraveBrowserMainExtraParts::PreMainMessageLoopRun() {
+  TRACE_EVENT0("startup", "BraveBrowserMainExtraParts::PreMainMessageLoopRun");
   // Disabled on mobile platforms, see for instance issues/6176
   if (g_brave_browser_process->p3a_service() != nullptr) {
     // TODO(iefremov): Maybe find a better place for this initialization.
@@ -12,8 +12,10 @@
 #include "base/check.h"
 #include "base/functional/bind.h"
 #include "base/memory/scoped_refptr.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/path_service.h"
 #include "base/task/thread_pool.h"
+#include "base/trace_event/trace_event.h"
 #include "brave/browser/brave_ads/analytics/p3a/brave_stats_helper.h"
 #include "brave/browser/brave_referrals/referrals_service_delegate.h"
 #include "brave/browser/brave_shields/ad_block_subscription_download_manager_getter.h"
@@ -134,6 +136,7 @@ BraveBrowserProcessImpl::~BraveBrowserProcessImpl() = default;
 
 BraveBrowserProcessImpl::BraveBrowserProcessImpl(StartupData* startup_data)
     : BrowserProcessImpl(startup_data) {
+  TRACE_EVENT0("startup", "BraveBrowserProcessImpl::BraveBrowserProcessImpl");
   g_browser_process = this;
   g_brave_browser_process = this;
 
@@ -158,6 +161,7 @@ BraveBrowserProcessImpl::BraveBrowserProcessImpl(StartupData* startup_data)
 
 void BraveBrowserProcessImpl::Init() {
   BrowserProcessImpl::Init();
+  TRACE_EVENT0("startup", "BraveBrowserProcessImpl::Init");
 
 #if BUILDFLAG(ENABLE_TOR)
   pref_change_registrar_.Add(
@@ -257,6 +261,8 @@ ProfileManager* BraveBrowserProcessImpl::profile_manager() {
 
 void BraveBrowserProcessImpl::StartBraveServices() {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  TRACE_EVENT0("startup", "BraveBrowserProcessImpl::StartBraveServices");
+  SCOPED_UMA_HISTOGRAM_TIMER_MICROS("Brave.Startup.StartBraveServicesTime");
 
   resource_component();
 
@@ -288,6 +294,7 @@ void BraveBrowserProcessImpl::StartBraveServices() {
 
 brave_shields::AdBlockService* BraveBrowserProcessImpl::ad_block_service() {
   if (!ad_block_service_) {
+    TRACE_EVENT0("startup", "BraveBrowserProcessImpl::ad_block_service");
     scoped_refptr<base::SequencedTaskRunner> task_runner(
         base::ThreadPool::CreateSequencedTaskRunner(
             {base::MayBlock(), base::TaskPriority::USER_BLOCKING,
@@ -304,6 +311,8 @@ brave_shields::AdBlockService* BraveBrowserProcessImpl::ad_block_service() {
 NTPBackgroundImagesService*
 BraveBrowserProcessImpl::ntp_background_images_service() {
   if (!ntp_background_images_service_) {
+    TRACE_EVENT0("startup",
+                 "BraveBrowserProcessImpl::ntp_background_images_service");
     ntp_background_images_service_ =
         std::make_unique<NTPBackgroundImagesService>(
             variations_service(), component_updater(), local_state());
@@ -316,6 +325,8 @@ BraveBrowserProcessImpl::ntp_background_images_service() {
 https_upgrade_exceptions::HttpsUpgradeExceptionsService*
 BraveBrowserProcessImpl::https_upgrade_exceptions_service() {
   if (!https_upgrade_exceptions_service_) {
+    TRACE_EVENT0("startup",
+                 "BraveBrowserProcessImpl::https_upgrade_exceptions_service");
     https_upgrade_exceptions_service_ =
         https_upgrade_exceptions::HttpsUpgradeExceptionsServiceFactory(
             local_data_files_service());
@@ -421,6 +432,7 @@ p3a::P3AService* BraveBrowserProcessImpl::p3a_service() {
   if (p3a_service_) {
     return p3a_service_.get();
   }
+  TRACE_EVENT0("startup", "BraveBrowserProcessImpl::p3a_service");
   p3a_service_ = base::MakeRefCounted<p3a::P3AService>(
       *local_state(), brave::GetChannelName(),
       brave_stats::GetFirstRunTime(local_state()),
@@ -432,6 +444,7 @@ p3a::P3AService* BraveBrowserProcessImpl::p3a_service() {
 brave::BraveReferralsService*
 BraveBrowserProcessImpl::brave_referrals_service() {
   if (!brave_referrals_service_) {
+    TRACE_EVENT0("startup", "BraveBrowserProcessImpl::brave_referrals_service");
     brave_referrals_service_ = std::make_unique<brave::BraveReferralsService>(
         local_state(), brave_stats::GetAPIKey(),
         brave_stats::GetPlatformIdentifier());
@@ -444,6 +457,7 @@ BraveBrowserProcessImpl::brave_referrals_service() {
 
 brave_stats::BraveStatsUpdater* BraveBrowserProcessImpl::brave_stats_updater() {
   if (!brave_stats_updater_) {
+    TRACE_EVENT0("startup", "BraveBrowserProcessImpl::brave_stats_updater");
     brave_stats_updater_ = std::make_unique<brave_stats::BraveStatsUpdater>(
         local_state(), profile_manager());
   }
@@ -452,6 +466,7 @@ brave_stats::BraveStatsUpdater* BraveBrowserProcessImpl::brave_stats_updater() {
 
 brave_ads::BraveStatsHelper* BraveBrowserProcessImpl::ads_brave_stats_helper() {
   if (!brave_stats_helper_) {
+    TRACE_EVENT0("startup", "BraveBrowserProcessImpl::ads_brave_stats_helper");
     brave_stats_helper_ = std::make_unique<brave_ads::BraveStatsHelper>(
         local_state(), profile_manager());
   }
@@ -460,6 +475,7 @@ brave_ads::BraveStatsHelper* BraveBrowserProcessImpl::ads_brave_stats_helper() {
 
 brave_ads::ResourceComponent* BraveBrowserProcessImpl::resource_component() {
   if (!resource_component_) {
+    TRACE_EVENT0("startup", "BraveBrowserProcessImpl::resource_component");
     resource_component_ = std::make_unique<brave_ads::ResourceComponent>(
         brave_component_updater_delegate());
   }
@@ -38,6 +38,7 @@
 #include "brave/components/p3a/metric_log_store.h"
 #include "brave/components/p3a/p3a_service.h"
 #include "brave/components/p3a/rotation_scheduler.h"
+#include "brave/components/performance_profile/performance_profile_utils.h"
 #include "brave/components/skus/browser/skus_utils.h"
 #include "brave/components/speedreader/common/buildflags/buildflags.h"
 #include "brave/components/tor/buildflags/buildflags.h"
@@ -136,6 +137,7 @@ void RegisterLocalStatePrefs(PrefRegistrySimple* registry) {
   brave_stats::RegisterLocalStatePrefs(registry);
   brave_origin::RegisterLocalStatePrefs(registry);
   ntp_background_images::RegisterLocalStatePrefs(registry);
+  performance_profile::RegisterLocalStatePrefs(registry);
   RegisterPrefsForBraveReferralsService(registry);
   brave_l10n::RegisterLocalStatePrefsForMigration(registry);
 #if BUILDFLAG(IS_MAC)
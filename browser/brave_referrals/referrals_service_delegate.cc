@@ -7,7 +7,12 @@
 
 #include "base/check.h"
 #include "base/check_op.h"
+#include "base/functional/bind.h"
 #include "base/path_service.h"
+#include "base/task/single_thread_task_runner.h"
+#include "brave/browser/brave_stats/features.h"
+#include "brave/components/performance_profile/performance_profile_utils.h"
+#include "chrome/browser/after_startup_task_utils.h"
 #include "chrome/browser/browser_process.h"
 #include "chrome/browser/net/system_network_context_manager.h"
 #include "chrome/common/chrome_paths.h"
@@ -53,6 +58,23 @@ void ReferralsServiceDelegate::OnProfileAdded(Profile* profile) {
   if (profile != ProfileManager::GetLastUsedProfileIfLoaded())
     return;
 
+  if ((base::FeatureList::IsEnabled(
+           brave_stats::features::kDeferStartupPing) ||
+       performance_profile::IsPerformanceProfileEnabled(
+           g_browser_process->local_state())) &&
+      !AfterStartupTaskUtils::IsBrowserStartupComplete()) {
+    profile_manager_observation_.Reset();
+    AfterStartupTaskUtils::PostTask(
+        FROM_HERE, base::SingleThreadTaskRunner::GetCurrentDefault(),
+        base::BindOnce(&ReferralsServiceDelegate::StartService,
+                       weak_factory_.GetWeakPtr()));
+    return;
+  }
+
+  StartService();
+}
+
+void ReferralsServiceDelegate::StartService() {
   service_->Start();
   DCHECK(!profile_manager_observation_.IsObserving())
       << "Should be cleared by OnInitialized";
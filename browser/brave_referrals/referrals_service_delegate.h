@@ -6,6 +6,7 @@
 #ifndef BRAVE_BROWSER_BRAVE_REFERRALS_REFERRALS_SERVICE_DELEGATE_H_
 #define BRAVE_BROWSER_BRAVE_REFERRALS_REFERRALS_SERVICE_DELEGATE_H_
 
+#include "base/memory/weak_ptr.h"
 #include "brave/components/brave_referrals/browser/brave_referrals_service.h"
 #include "chrome/browser/profiles/profile_manager.h"
 #include "chrome/browser/profiles/profile_manager_observer.h"
@@ -29,10 +30,14 @@ class ReferralsServiceDelegate : public brave::BraveReferralsService::Delegate,
   void OnProfileAdded(Profile* profile) override;
 
  private:
+  void StartService();
+
   raw_ptr<brave::BraveReferralsService> service_;  // owner
 
   base::ScopedObservation<ProfileManager, ProfileManagerObserver>
       profile_manager_observation_{this};
+
+  base::WeakPtrFactory<ReferralsServiceDelegate> weak_factory_{this};
 };
 
 #endif  // BRAVE_BROWSER_BRAVE_REFERRALS_REFERRALS_SERVICE_DELEGATE_H_
@@ -16,6 +16,8 @@
 #include "base/metrics/histogram_macros.h"
 #include "base/strings/string_util.h"
 #include "base/system/sys_info.h"
+#include "base/task/single_thread_task_runner.h"
+#include "base/trace_event/trace_event.h"
 #include "brave/browser/brave_browser_features.h"
 #include "brave/browser/brave_stats/brave_stats_updater_params.h"
 #include "brave/browser/brave_stats/buildflags.h"
@@ -30,8 +32,10 @@
 #include "brave/components/constants/network_constants.h"
 #include "brave/components/constants/pref_names.h"
 #include "brave/components/misc_metrics/general_browser_usage.h"
+#include "brave/components/performance_profile/performance_profile_utils.h"
 #include "brave/components/rpill/common/rpill.h"
 #include "brave/components/version_info/version_info.h"
+#include "chrome/browser/after_startup_task_utils.h"
 #include "chrome/browser/browser_process.h"
 #include "chrome/browser/first_run/first_run.h"
 #include "chrome/browser/net/system_network_context_manager.h"
@@ -317,6 +321,21 @@ void BraveStatsUpdater::OnDetectUncertainFuture(
 
 void BraveStatsUpdater::StartServerPingStartupTimer() {
   stats_preconditions_barrier_.Reset();
+  if ((base::FeatureList::IsEnabled(features::kDeferStartupPing) ||
+       performance_profile::IsPerformanceProfileEnabled(pref_service_)) &&
+      !AfterStartupTaskUtils::IsBrowserStartupComplete()) {
+    // Keep the first ping (and the pref reads that build it) off the
+    // startup path; the periodic timer is unaffected.
+    AfterStartupTaskUtils::PostTask(
+        FROM_HERE, base::SingleThreadTaskRunner::GetCurrentDefault(),
+        base::BindOnce(&BraveStatsUpdater::StartServerPingStartupTimer,
+                       weak_ptr_factory_.GetWeakPtr()));
+    return;
+  }
+  if (!server_ping_startup_timer_) {
+    // Stop() ran while the startup ping was deferred.
+    return;
+  }
   stats_startup_complete_ = true;
   server_ping_startup_timer_->Start(
       FROM_HERE, base::Seconds(kUpdateServerStartupPingDelaySeconds), this,
@@ -325,6 +344,7 @@ void BraveStatsUpdater::StartServerPingStartupTimer() {
 
 void BraveStatsUpdater::SendServerPing() {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  TRACE_EVENT0("browser", "BraveStatsUpdater::SendServerPing");
   auto traffic_annotation = AnonymousStatsAnnotation();
   auto resource_request = std::make_unique<network::ResourceRequest>();
 
@@ -15,6 +15,10 @@ BASE_FEATURE(kHeadlessRefcode,
              "BraveStatsHeadlessRefcode",
              base::FEATURE_ENABLED_BY_DEFAULT);
 
+BASE_FEATURE(kDeferStartupPing,
+             "BraveStatsDeferStartupPing",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
 bool IsHeadlessClientRefcodeEnabled() {
   return base::FeatureList::IsEnabled(features::kHeadlessRefcode);
 }
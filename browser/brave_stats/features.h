@@ -16,6 +16,10 @@ BASE_DECLARE_FEATURE(kHeadlessRefcode);
 
 bool IsHeadlessClientRefcodeEnabled();
 
+// Holds the startup usage ping and referral initialization until browser
+// startup has completed, so they do not compete with first paint.
+BASE_DECLARE_FEATURE(kDeferStartupPing);
+
 }  // namespace features
 }  // namespace brave_stats
 
@@ -139,6 +139,7 @@ class TestEventsListener : public brave_wallet::mojom::EventsListener {
   void MessageEvent(const std::string& subscription_id,
                     base::Value result) override {
     message_event_fired_ = true;
+    messages_.emplace_back(subscription_id, result.Clone());
     last_message_ = std::move(result);
   }
 
@@ -178,6 +179,7 @@ class TestEventsListener : public brave_wallet::mojom::EventsListener {
   bool message_event_fired_ = false;
   std::vector<std::string> lowercase_accounts_;
   base::Value last_message_;
+  std::vector<std::pair<std::string, base::Value>> messages_;
 
  private:
   mojo::Receiver<brave_wallet::mojom::EventsListener> observer_receiver_{this};
@@ -2286,6 +2288,72 @@ TEST_F(EthereumProviderImplUnitTest, EthSubscribeLogsFiltered) {
   EXPECT_FALSE(provider_->eth_logs_tracker_.IsRunning());
 }
 
+TEST_F(EthereumProviderImplUnitTest, EthSubscribeLogsMerged) {
+  CreateWallet();
+  size_t get_logs_count = 0;
+  url_loader_factory_.SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        url_loader_factory_.ClearResponses();
+
+        auto header_value = request.headers.GetHeader("X-Eth-Method");
+        ASSERT_TRUE(header_value);
+        if (*header_value == "eth_getLogs") {
+          get_logs_count++;
+          const auto payload =
+              ParseJsonDict(request.request_body->elements()
+                                ->at(0)
+                                .As<network::DataElementBytes>()
+                                .AsStringPiece());
+          EXPECT_EQ(payload, ParseJsonDict(
+                                 R"({"id":1,"jsonrpc":"2.0",
+              "method":"eth_getLogs","params":[{"address":["0x91","0x92"],
+              "topics":["0x4b"]}]})"));
+        }
+        url_loader_factory_.AddResponse(
+            request.url.spec(),
+            R"({"id":1,"jsonrpc":"2.0","result":[{"address":"0x91",
+                "blockHash":"0xe8","blockNumber":"0x10","data":"0x0067",
+                "logIndex":"0x0","removed":false,"topics":["0x4b"],
+                "transactionHash":"0x22f7","transactionIndex":"0x0"},
+                {"address":"0x92","blockHash":"0xe8","blockNumber":"0x10",
+                "data":"0x0068","logIndex":"0x1","removed":false,
+                "topics":["0x4b"],"transactionHash":"0x22f8",
+                "transactionIndex":"0x1"}]})");
+      }));
+
+  std::vector<std::string> subscriptions;
+  for (const char* address : {"0x91", "0x92"}) {
+    auto response = CommonRequestOrSendAsync(ParseJson(absl::StrFormat(
+        R"({"id":1,"jsonrpc:": "2.0","method":"eth_subscribe",
+            "params": ["logs", {"address": "%s", "topics": ["0x4b"]}]})",
+        address)));
+    EXPECT_FALSE(response.first);
+    ASSERT_TRUE(response.second.is_string());
+    subscriptions.push_back(response.second.GetString());
+  }
+
+  // Both subscriptions are served by a single request and each one only gets
+  // the logs of its contract.
+  browser_task_environment_.FastForwardBy(
+      base::Seconds(kLogTrackerDefaultTimeInSeconds));
+  EXPECT_TRUE(observer_->MessageEventFired());
+  EXPECT_EQ(get_logs_count, 1u);
+  ASSERT_EQ(observer_->messages_.size(), 2u);
+  for (const auto& [subscription, message] : observer_->messages_) {
+    const size_t index = subscription == subscriptions[0] ? 0 : 1;
+    EXPECT_EQ(subscription, subscriptions[index]);
+    EXPECT_EQ(*message.GetDict().FindString("address"),
+              index == 0 ? "0x91" : "0x92");
+  }
+
+  // Logs which were already delivered are not sent again.
+  browser_task_environment_.FastForwardBy(
+      base::Seconds(kLogTrackerDefaultTimeInSeconds));
+  EXPECT_TRUE(observer_->MessageEventFired());
+  EXPECT_EQ(get_logs_count, 2u);
+  EXPECT_EQ(observer_->messages_.size(), 2u);
+}
+
 TEST_F(EthereumProviderImplUnitTest, Web3ClientVersion) {
   std::string expected_version = absl::StrFormat(
       "BraveWallet/v%s", version_info::GetBraveChromiumVersionNumber());
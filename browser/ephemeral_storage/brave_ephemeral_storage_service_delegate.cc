@@ -5,11 +5,15 @@
 
 #include "brave/browser/ephemeral_storage/brave_ephemeral_storage_service_delegate.h"
 
+#include <map>
+#include <memory>
 #include <utility>
 
 #include "base/check.h"
+#include "base/containers/span.h"
 #include "base/logging.h"
 #include "base/memory/scoped_refptr.h"
+#include "base/strings/strcat.h"
 #include "brave/components/brave_shields/core/browser/brave_shields_utils.h"
 #include "chrome/browser/browsing_data/chrome_browsing_data_remover_constants.h"
 #include "chrome/browser/profiles/profile.h"
@@ -49,25 +53,53 @@ BraveEphemeralStorageServiceDelegate::~BraveEphemeralStorageServiceDelegate() {
 
 void BraveEphemeralStorageServiceDelegate::CleanupTLDEphemeralArea(
     const TLDEphemeralAreaKey& key) {
-  DVLOG(1) << __func__ << " " << key.first << " " << key.second;
-  auto* storage_partition = context_->GetStoragePartition(key.second);
-  if (!storage_partition) {
-    return;
-  }
-  auto filter = network::mojom::CookieDeletionFilter::New();
-  filter->ephemeral_storage_domain = key.first;
-  storage_partition->GetCookieManagerForBrowserProcess()->DeleteCookies(
-      std::move(filter), base::NullCallback());
-
-  const GURL https_url(base::StrCat({"https://", key.first}));
-  if (brave_shields::GetCookieControlType(host_content_settings_map_,
-                                          cookie_settings_.get(), https_url) ==
-      brave_shields::ControlType::ALLOW) {
-    // All cookies are allowed, Ephemeral Storage is effectively disabled.
-    return;
-  }
+  CleanupTLDEphemeralAreas(base::span_from_ref(key));
+}
+
+void BraveEphemeralStorageServiceDelegate::CleanupFirstPartyStorageArea(
+    const TLDEphemeralAreaKey& key) {
+  CleanupFirstPartyStorageAreas(base::span_from_ref(key));
+}
 
-  const GURL http_url(base::StrCat({"http://", key.first}));
+void BraveEphemeralStorageServiceDelegate::CleanupTLDEphemeralAreas(
+    base::span<const TLDEphemeralAreaKey> keys) {
+  // One filter per storage partition, so that all areas of a partition are
+  // removed in a single BrowsingDataRemover pass.
+  std::map<content::StoragePartitionConfig,
+           std::unique_ptr<content::BrowsingDataFilterBuilder>>
+      filter_builders;
+  for (const auto& key : keys) {
+    DVLOG(1) << __func__ << " " << key.first << " " << key.second;
+    auto* storage_partition = context_->GetStoragePartition(key.second);
+    if (!storage_partition) {
+      continue;
+    }
+    // Cookie deletion filters match a single ephemeral storage domain.
+    auto filter = network::mojom::CookieDeletionFilter::New();
+    filter->ephemeral_storage_domain = key.first;
+    storage_partition->GetCookieManagerForBrowserProcess()->DeleteCookies(
+        std::move(filter), base::NullCallback());
+
+    const GURL https_url(base::StrCat({"https://", key.first}));
+    if (brave_shields::GetCookieControlType(
+            host_content_settings_map_, cookie_settings_.get(), https_url) ==
+        brave_shields::ControlType::ALLOW) {
+      // All cookies are allowed, Ephemeral Storage is effectively disabled.
+      continue;
+    }
+
+    const GURL http_url(base::StrCat({"http://", key.first}));
+    auto& filter_builder = filter_builders[key.second];
+    if (!filter_builder) {
+      filter_builder = content::BrowsingDataFilterBuilder::Create(
+          content::BrowsingDataFilterBuilder::Mode::kDelete,
+          content::BrowsingDataFilterBuilder::OriginMatchingMode::
+              kThirdPartiesOnly);
+      filter_builder->SetStoragePartitionConfig(key.second);
+    }
+    filter_builder->AddOrigin(url::Origin::Create(https_url));
+    filter_builder->AddOrigin(url::Origin::Create(http_url));
+  }
 
   // Only cleanup StorageKey-aware areas.
   content::BrowsingDataRemover::DataType data_to_remove =
@@ -80,27 +112,34 @@ void BraveEphemeralStorageServiceDelegate::CleanupTLDEphemeralArea(
   // Cookies are partitioned and cleaned separately.
   data_to_remove &= ~content::BrowsingDataRemover::DATA_TYPE_COOKIES;
 
-  auto filter_builder = content::BrowsingDataFilterBuilder::Create(
-      content::BrowsingDataFilterBuilder::Mode::kDelete,
-      content::BrowsingDataFilterBuilder::OriginMatchingMode::
-          kThirdPartiesOnly);
-  filter_builder->AddOrigin(url::Origin::Create(https_url));
-  filter_builder->AddOrigin(url::Origin::Create(http_url));
-  filter_builder->SetStoragePartitionConfig(key.second);
-
   content::BrowsingDataRemover* remover = context_->GetBrowsingDataRemover();
-  remover->RemoveWithFilter(base::Time(), base::Time::Max(), data_to_remove,
-                            origin_type, std::move(filter_builder));
+  for (auto& [storage_partition_config, filter_builder] : filter_builders) {
+    remover->RemoveWithFilter(base::Time(), base::Time::Max(), data_to_remove,
+                              origin_type, std::move(filter_builder));
+  }
 }
 
-void BraveEphemeralStorageServiceDelegate::CleanupFirstPartyStorageArea(
-    const TLDEphemeralAreaKey& key) {
-  DVLOG(1) << __func__ << " " << key.first << " " << key.second;
+void BraveEphemeralStorageServiceDelegate::CleanupFirstPartyStorageAreas(
+    base::span<const TLDEphemeralAreaKey> keys) {
   DCHECK(base::FeatureList::IsEnabled(
              net::features::kBraveForgetFirstPartyStorage) ||
          base::FeatureList::IsEnabled(
              net::features::kThirdPartyStoragePartitioning));
 
+  std::map<content::StoragePartitionConfig,
+           std::unique_ptr<content::BrowsingDataFilterBuilder>>
+      filter_builders;
+  for (const auto& key : keys) {
+    DVLOG(1) << __func__ << " " << key.first << " " << key.second;
+    auto& filter_builder = filter_builders[key.second];
+    if (!filter_builder) {
+      filter_builder = content::BrowsingDataFilterBuilder::Create(
+          content::BrowsingDataFilterBuilder::Mode::kDelete);
+      filter_builder->SetStoragePartitionConfig(key.second);
+    }
+    filter_builder->AddRegisterableDomain(key.first);
+  }
+
   content::BrowsingDataRemover::DataType data_to_remove =
       (content::BrowsingDataRemover::DATA_TYPE_ON_STORAGE_PARTITION &
        chrome_browsing_data_remover::FILTERABLE_DATA_TYPES);
@@ -109,14 +148,11 @@ void BraveEphemeralStorageServiceDelegate::CleanupFirstPartyStorageArea(
       content::BrowsingDataRemover::ORIGIN_TYPE_UNPROTECTED_WEB |
       content::BrowsingDataRemover::ORIGIN_TYPE_PROTECTED_WEB;
 
-  auto filter_builder = content::BrowsingDataFilterBuilder::Create(
-      content::BrowsingDataFilterBuilder::Mode::kDelete);
-  filter_builder->AddRegisterableDomain(key.first);
-  filter_builder->SetStoragePartitionConfig(key.second);
-
   content::BrowsingDataRemover* remover = context_->GetBrowsingDataRemover();
-  remover->RemoveWithFilter(base::Time(), base::Time::Max(), data_to_remove,
-                            origin_type, std::move(filter_builder));
+  for (auto& [storage_partition_config, filter_builder] : filter_builders) {
+    remover->RemoveWithFilter(base::Time(), base::Time::Max(), data_to_remove,
+                              origin_type, std::move(filter_builder));
+  }
 }
 
 void BraveEphemeralStorageServiceDelegate::RegisterFirstWindowOpenedCallback(
@@ -43,6 +43,10 @@ class BraveEphemeralStorageServiceDelegate :
   // EphemeralStorageServiceDelegate:
   void CleanupTLDEphemeralArea(const TLDEphemeralAreaKey& key) override;
   void CleanupFirstPartyStorageArea(const TLDEphemeralAreaKey& key) override;
+  void CleanupTLDEphemeralAreas(
+      base::span<const TLDEphemeralAreaKey> keys) override;
+  void CleanupFirstPartyStorageAreas(
+      base::span<const TLDEphemeralAreaKey> keys) override;
   void RegisterFirstWindowOpenedCallback(base::OnceClosure callback) override;
 
  private:
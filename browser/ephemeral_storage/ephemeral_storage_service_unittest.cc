@@ -231,6 +231,48 @@ TEST_F(EphemeralStorageServiceTest,
   }
 }
 
+TEST_F(EphemeralStorageServiceTest, EphemeralCleanupIsBatched) {
+  const auto storage_partition_config =
+      content::StoragePartitionConfig::CreateDefault(&profile_);
+  const TLDEphemeralAreaKey key_a("a.com", storage_partition_config);
+  const TLDEphemeralAreaKey key_b("b.com", storage_partition_config);
+  const TLDEphemeralAreaKey key_c("c.com", storage_partition_config);
+  for (const auto& key : {key_a, key_b, key_c}) {
+    service_->TLDEphemeralLifetimeCreated(key.first, key.second);
+  }
+
+  {
+    ScopedVerifyAndClearExpectations verify(mock_delegate_);
+    ScopedVerifyAndClearExpectations verify_observer(&mock_observer_);
+    service_->TLDEphemeralLifetimeDestroyed(key_a.first, key_a.second, false);
+    task_environment_.FastForwardBy(base::Milliseconds(500));
+    service_->TLDEphemeralLifetimeDestroyed(key_b.first, key_b.second, false);
+    task_environment_.FastForwardBy(base::Seconds(10));
+    service_->TLDEphemeralLifetimeDestroyed(key_c.first, key_c.second, false);
+    task_environment_.FastForwardBy(base::Seconds(19));
+  }
+
+  // a.com and b.com expire within the batch window and are cleaned up
+  // together once the keepalive of a.com is over.
+  {
+    ScopedVerifyAndClearExpectations verify(mock_delegate_);
+    ScopedVerifyAndClearExpectations verify_observer(&mock_observer_);
+    EXPECT_CALL(mock_observer_, OnCleanupTLDEphemeralArea(key_a));
+    EXPECT_CALL(mock_observer_, OnCleanupTLDEphemeralArea(key_b));
+    EXPECT_CALL(*mock_delegate_, CleanupTLDEphemeralArea(key_a));
+    EXPECT_CALL(*mock_delegate_, CleanupTLDEphemeralArea(key_b));
+    task_environment_.FastForwardBy(base::Milliseconds(500));
+  }
+
+  {
+    ScopedVerifyAndClearExpectations verify(mock_delegate_);
+    ScopedVerifyAndClearExpectations verify_observer(&mock_observer_);
+    EXPECT_CALL(mock_observer_, OnCleanupTLDEphemeralArea(key_c));
+    EXPECT_CALL(*mock_delegate_, CleanupTLDEphemeralArea(key_c));
+    task_environment_.FastForwardBy(base::Seconds(11));
+  }
+}
+
 class EphemeralStorageServiceNoKeepAliveTest
     : public EphemeralStorageServiceTest {
  public:
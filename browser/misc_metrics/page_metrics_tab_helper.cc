@@ -52,7 +52,8 @@ void PageMetricsTabHelper::DidFinishNavigation(
     }
     is_reload = true;
   }
-  page_metrics_->IncrementPagesLoadedCount(is_reload);
+  page_metrics_->IncrementPagesLoadedCount(navigation_handle->GetURL(),
+                                           is_reload);
   if (navigation_handle->GetURL().host() == kBraveSearchHost &&
       navigation_handle->GetURL().path() == kBraveSearchPath) {
     page_metrics_->OnBraveQuery();
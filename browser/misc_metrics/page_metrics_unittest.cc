@@ -6,11 +6,15 @@
 #include "brave/components/misc_metrics/page_metrics.h"
 
 #include <memory>
+#include <string>
 
 #include "base/strings/string_number_conversions.h"
 #include "base/test/bind.h"
 #include "base/test/metrics/histogram_tester.h"
+#include "base/test/scoped_feature_list.h"
 #include "brave/components/brave_rewards/core/pref_names.h"
+#include "brave/components/misc_metrics/features.h"
+#include "brave/components/misc_metrics/pref_names.h"
 #include "chrome/browser/bookmarks/bookmark_model_factory.h"
 #include "chrome/browser/content_settings/host_content_settings_map_factory.h"
 #include "chrome/browser/history/history_service_factory.h"
@@ -119,7 +123,7 @@ TEST_F(PageMetricsUnitTest, PagesLoadedCount) {
   histogram_tester_.ExpectUniqueSample(kPagesReloadedHistogramName, 0, 1);
 
   for (size_t i = 0; i < 6; i++) {
-    page_metrics_service_->IncrementPagesLoadedCount(false);
+    page_metrics_service_->IncrementPagesLoadedCount(GURL(), false);
   }
 
   task_environment_.FastForwardBy(base::Minutes(30));
@@ -128,10 +132,10 @@ TEST_F(PageMetricsUnitTest, PagesLoadedCount) {
   histogram_tester_.ExpectUniqueSample(kPagesReloadedHistogramName, 0, 2);
 
   for (size_t i = 0; i < 30; i++) {
-    page_metrics_service_->IncrementPagesLoadedCount(false);
+    page_metrics_service_->IncrementPagesLoadedCount(GURL(), false);
   }
   for (size_t i = 0; i < 9; i++) {
-    page_metrics_service_->IncrementPagesLoadedCount(true);
+    page_metrics_service_->IncrementPagesLoadedCount(GURL(), true);
   }
 
   task_environment_.FastForwardBy(base::Minutes(30));
@@ -155,7 +159,7 @@ TEST_F(PageMetricsUnitTest, PagesLoadedCount) {
                                   "uphold");
 
   for (size_t i = 0; i < 30; i++) {
-    page_metrics_service_->IncrementPagesLoadedCount(false);
+    page_metrics_service_->IncrementPagesLoadedCount(GURL(), false);
   }
 
   task_environment_.FastForwardBy(base::Minutes(30));
@@ -199,12 +203,12 @@ TEST_F(PageMetricsUnitTest, FirstPageLoadTimeImmediate) {
   task_environment_.FastForwardBy(base::Minutes(1));
   histogram_tester_.ExpectTotalCount(kFirstPageLoadTimeHistogramName, 0);
 
-  page_metrics_service_->IncrementPagesLoadedCount(false);
+  page_metrics_service_->IncrementPagesLoadedCount(GURL(), false);
   histogram_tester_.ExpectUniqueSample(kFirstPageLoadTimeHistogramName, 0, 1);
 
   task_environment_.FastForwardBy(base::Hours(2));
 
-  page_metrics_service_->IncrementPagesLoadedCount(false);
+  page_metrics_service_->IncrementPagesLoadedCount(GURL(), false);
   histogram_tester_.ExpectUniqueSample(kFirstPageLoadTimeHistogramName, 0, 1);
 }
 
@@ -212,16 +216,16 @@ TEST_F(PageMetricsUnitTest, FirstPageLoadTimeLater) {
   task_environment_.FastForwardBy(base::Minutes(30));
   histogram_tester_.ExpectTotalCount(kFirstPageLoadTimeHistogramName, 0);
 
-  page_metrics_service_->IncrementPagesLoadedCount(false);
+  page_metrics_service_->IncrementPagesLoadedCount(GURL(), false);
   histogram_tester_.ExpectUniqueSample(kFirstPageLoadTimeHistogramName, 2, 1);
 
   task_environment_.FastForwardBy(base::Days(2));
 
-  page_metrics_service_->IncrementPagesLoadedCount(false);
+  page_metrics_service_->IncrementPagesLoadedCount(GURL(), false);
   histogram_tester_.ExpectUniqueSample(kFirstPageLoadTimeHistogramName, 2, 1);
 
   task_environment_.FastForwardBy(base::Days(8));
-  page_metrics_service_->IncrementPagesLoadedCount(false);
+  page_metrics_service_->IncrementPagesLoadedCount(GURL(), false);
   histogram_tester_.ExpectUniqueSample(kFirstPageLoadTimeHistogramName, 2, 1);
 }
 
@@ -229,8 +233,61 @@ TEST_F(PageMetricsUnitTest, FirstPageLoadTimeTooLate) {
   task_environment_.FastForwardBy(base::Days(7));
   histogram_tester_.ExpectTotalCount(kFirstPageLoadTimeHistogramName, 0);
 
-  page_metrics_service_->IncrementPagesLoadedCount(false);
+  page_metrics_service_->IncrementPagesLoadedCount(GURL(), false);
   histogram_tester_.ExpectTotalCount(kFirstPageLoadTimeHistogramName, 0);
 }
 
+class PageMetricsDomainsSketchUnitTest : public PageMetricsUnitTest {
+ public:
+  PageMetricsDomainsSketchUnitTest() {
+    scoped_feature_list_.InitAndEnableFeature(features::kDomainsLoadedSketch);
+  }
+
+ protected:
+  void LoadPages(const std::string& prefix, int count) {
+    for (int i = 0; i < count; i++) {
+      page_metrics_service_->IncrementPagesLoadedCount(
+          GURL("https://" + prefix + base::NumberToString(i) + ".com/page"),
+          false);
+    }
+  }
+
+  base::test::ScopedFeatureList scoped_feature_list_;
+};
+
+TEST_F(PageMetricsDomainsSketchUnitTest, DomainsLoadedCount) {
+  task_environment_.FastForwardBy(base::Seconds(30));
+  histogram_tester_.ExpectUniqueSample(kDomainsLoadedHistogramName, 0, 1);
+
+  // Repeated loads and subdomains of the same eTLD+1 count once.
+  LoadPages("abc", 4);
+  LoadPages("abc", 4);
+  page_metrics_service_->IncrementPagesLoadedCount(
+      GURL("https://sub.abc0.com/"), false);
+  // Reloads are not counted.
+  page_metrics_service_->IncrementPagesLoadedCount(GURL("https://xyz.com/"),
+                                                   true);
+
+  task_environment_.FastForwardBy(base::Minutes(30));
+  histogram_tester_.ExpectBucketCount(kDomainsLoadedHistogramName, 1, 1);
+
+  // Domains from previous days within the week are merged in.
+  task_environment_.FastForwardBy(base::Days(1));
+  LoadPages("def", 40);
+  histogram_tester_.ExpectBucketCount(kDomainsLoadedHistogramName, 4, 0);
+  task_environment_.FastForwardBy(base::Minutes(30));
+  EXPECT_GE(histogram_tester_.GetBucketCount(kDomainsLoadedHistogramName, 4),
+            1);
+
+  // Sketches age out after a week and are pruned on the next write.
+  int init_zero_count =
+      histogram_tester_.GetBucketCount(kDomainsLoadedHistogramName, 0);
+  task_environment_.FastForwardBy(base::Days(7));
+  EXPECT_GT(histogram_tester_.GetBucketCount(kDomainsLoadedHistogramName, 0),
+            init_zero_count);
+  page_metrics_service_->IncrementPagesLoadedCount(GURL("https://new.com/"),
+                                                   false);
+  EXPECT_EQ(local_state_.GetList(kMiscMetricsDomainsLoadedSketch).size(), 1u);
+}
+
 }  // namespace misc_metrics
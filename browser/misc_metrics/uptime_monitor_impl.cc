@@ -5,9 +5,13 @@
 
 #include "brave/browser/misc_metrics/uptime_monitor_impl.h"
 
+#include "base/feature_list.h"
+#include "base/functional/bind.h"
 #include "base/time/time.h"
+#include "brave/components/misc_metrics/features.h"
 #include "brave/components/misc_metrics/pref_names.h"
 #include "brave/components/p3a_utils/bucket.h"
+#include "brave/components/performance_profile/performance_profile_utils.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
 
@@ -45,6 +49,13 @@ void UptimeMonitorImpl::Init() {
   RecordP3A();
 #if !BUILDFLAG(IS_ANDROID)
   usage_clock_ = std::make_unique<UsageClock>();
+  if (base::FeatureList::IsEnabled(features::kUsageDrivenUptimeSampling) ||
+      performance_profile::IsPerformanceProfileEnabled(local_state_)) {
+    usage_clock_->SetSessionStateChangedCallback(base::BindRepeating(
+        &UptimeMonitorImpl::OnUsageStateChanged, base::Unretained(this)));
+    OnUsageStateChanged();
+    return;
+  }
   timer_.Start(FROM_HERE, kUsageTimeQueryInterval,
                base::BindRepeating(&UptimeMonitorImpl::RecordUsage,
                                    base::Unretained(this)));
@@ -73,6 +84,35 @@ void UptimeMonitorImpl::RecordUsage() {
   }
   RecordP3A();
 }
+
+void UptimeMonitorImpl::OnUsageStateChanged() {
+  if (usage_clock_->IsInUse()) {
+    idle_report_timer_.Stop();
+    if (!timer_.IsRunning()) {
+      timer_.Start(FROM_HERE, kUsageTimeQueryInterval,
+                   base::BindRepeating(&UptimeMonitorImpl::RecordUsage,
+                                       base::Unretained(this)));
+    }
+    return;
+  }
+  // The usage clock does not advance while idle, so flush the delta of the
+  // session that just ended and stop polling.
+  timer_.Stop();
+  RecordUsage();
+  StartIdleReportTimer();
+}
+
+void UptimeMonitorImpl::OnIdleReportTimerFired() {
+  RecordP3A();
+  StartIdleReportTimer();
+}
+
+void UptimeMonitorImpl::StartIdleReportTimer() {
+  idle_report_timer_.Start(
+      FROM_HERE, report_frame_start_time_ + kUsageTimeReportInterval,
+      base::BindOnce(&UptimeMonitorImpl::OnIdleReportTimerFired,
+                     base::Unretained(this)));
+}
 #endif
 
 void UptimeMonitorImpl::RecordP3A() {
@@ -11,6 +11,7 @@
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/timer/timer.h"
+#include "base/timer/wall_clock_timer.h"
 #include "brave/components/misc_metrics/uptime_monitor.h"
 #include "brave/components/time_period_storage/weekly_storage.h"
 
@@ -53,6 +54,9 @@ class UptimeMonitorImpl : public UptimeMonitor {
 #if !BUILDFLAG(IS_ANDROID)
   // Used on Desktop only.
   void RecordUsage();
+  void OnUsageStateChanged();
+  void OnIdleReportTimerFired();
+  void StartIdleReportTimer();
 #endif
 
   void ResetReportFrame();
@@ -64,6 +68,9 @@ class UptimeMonitorImpl : public UptimeMonitor {
 
   base::TimeDelta current_total_usage_;
   base::RepeatingTimer timer_;
+  // Only runs while the browser is not in use, so the daily report is still
+  // sent without polling the usage clock.
+  base::WallClockTimer idle_report_timer_;
 #endif
 
   base::Time report_frame_start_time_;
@@ -8,10 +8,17 @@
 #include <memory>
 
 #include "base/test/metrics/histogram_tester.h"
+#include "base/test/scoped_feature_list.h"
+#include "brave/components/misc_metrics/features.h"
+#include "brave/components/misc_metrics/pref_names.h"
 #include "components/prefs/testing_pref_service.h"
 #include "content/public/test/browser_task_environment.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
+#if !BUILDFLAG(IS_ANDROID)
+#include "chrome/browser/metrics/desktop_session_duration/desktop_session_duration_tracker.h"
+#endif
+
 namespace misc_metrics {
 
 class UptimeMonitorImplUnitTest : public testing::Test {
@@ -75,6 +82,42 @@ TEST_F(UptimeMonitorImplUnitTest, ReportUsageDuration) {
   histogram_tester_.ExpectBucketCount(kBrowserOpenTimeHistogramName, 3, 1);
   histogram_tester_.ExpectTotalCount(kBrowserOpenTimeHistogramName, 3);
 }
+#else
+TEST_F(UptimeMonitorImplUnitTest, UsageDrivenSampling) {
+  base::test::ScopedFeatureList feature_list(
+      features::kUsageDrivenUptimeSampling);
+  metrics::DesktopSessionDurationTracker::Initialize();
+  auto* tracker = metrics::DesktopSessionDurationTracker::Get();
+  tracker->OnVisibilityChanged(true, base::TimeDelta());
+  tracker->OnUserEvent();
+  ResetMonitor();
+
+  task_environment_.FastForwardBy(base::Seconds(150));
+  tracker->OnVisibilityChanged(false, base::TimeDelta());
+  EXPECT_FALSE(usage_monitor_->IsInUse());
+  // The partial minute is flushed when usage ends.
+  EXPECT_EQ(local_state_.GetTimeDelta(kDailyUptimeSumPrefName),
+            base::Seconds(150));
+
+  task_environment_.FastForwardBy(base::Hours(12));
+  EXPECT_EQ(local_state_.GetTimeDelta(kDailyUptimeSumPrefName),
+            base::Seconds(150));
+  histogram_tester_.ExpectTotalCount(kBrowserOpenTimeHistogramName, 0);
+
+  // The daily report is still sent while idle.
+  task_environment_.FastForwardBy(base::Hours(12));
+  histogram_tester_.ExpectUniqueSample(kBrowserOpenTimeHistogramName, 0, 1);
+
+  tracker->OnVisibilityChanged(true, base::TimeDelta());
+  tracker->OnUserEvent();
+  task_environment_.FastForwardBy(base::Minutes(3));
+  EXPECT_EQ(local_state_.GetTimeDelta(kDailyUptimeSumPrefName),
+            base::Minutes(3));
+  EXPECT_EQ(usage_monitor_->GetUsedTimeInWeek(), base::Seconds(330));
+
+  usage_monitor_.reset();
+  metrics::DesktopSessionDurationTracker::CleanupForTesting();
+}
 #endif
 
 }  // namespace misc_metrics
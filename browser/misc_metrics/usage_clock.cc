@@ -5,7 +5,10 @@
 
 #include "brave/browser/misc_metrics/usage_clock.h"
 
+#include <utility>
+
 #include "base/check.h"
+#include "base/functional/callback.h"
 
 namespace misc_metrics {
 
@@ -41,11 +44,19 @@ bool UsageClock::IsInUse() const {
   return current_session_elapsed_timer_.has_value();
 }
 
+void UsageClock::SetSessionStateChangedCallback(
+    base::RepeatingClosure callback) {
+  session_state_changed_callback_ = std::move(callback);
+}
+
 void UsageClock::OnSessionStarted(base::TimeTicks session_start) {
   // Ignore |session_start| because it doesn't come from the resource
   // coordinator clock.
   DCHECK(!IsInUse());
   current_session_elapsed_timer_ = base::ElapsedTimer();
+  if (session_state_changed_callback_) {
+    session_state_changed_callback_.Run();
+  }
 }
 
 void UsageClock::OnSessionEnded(base::TimeDelta session_length,
@@ -56,6 +67,9 @@ void UsageClock::OnSessionEnded(base::TimeDelta session_length,
   usage_time_in_completed_sessions_ +=
       current_session_elapsed_timer_->Elapsed();
   current_session_elapsed_timer_ = std::nullopt;
+  if (session_state_changed_callback_) {
+    session_state_changed_callback_.Run();
+  }
 }
 
 }  // namespace misc_metrics
@@ -8,6 +8,7 @@
 
 #include <optional>
 
+#include "base/functional/callback.h"
 #include "base/time/time.h"
 #include "base/timer/elapsed_timer.h"
 #include "chrome/browser/metrics/desktop_session_duration/desktop_session_duration_tracker.h"
@@ -36,6 +37,9 @@ class UsageClock : public metrics::DesktopSessionDurationTracker::Observer {
   // Returns true if Chrome is currently considered to be in use.
   bool IsInUse() const;
 
+  // Runs |callback| after each transition into or out of use.
+  void SetSessionStateChangedCallback(base::RepeatingClosure callback);
+
  private:
   // DesktopSessionDurationTracker::Observer:
   void OnSessionStarted(base::TimeTicks session_start) override;
@@ -50,6 +54,8 @@ class UsageClock : public metrics::DesktopSessionDurationTracker::Observer {
   // Elapsed timer for the current session, or nullopt if not currently in a
   // session.
   std::optional<base::ElapsedTimer> current_session_elapsed_timer_;
+
+  base::RepeatingClosure session_state_changed_callback_;
 };
 
 }  // namespace misc_metrics
@@ -7,6 +7,7 @@
 
 #include <optional>
 #include <string>
+#include <utility>
 
 #include "base/memory/scoped_refptr.h"
 #include "brave/browser/brave_browser_process.h"
@@ -20,24 +21,34 @@
 
 namespace brave {
 
-std::optional<std::string> GetCspDirectivesOnTaskRunner(
-    std::shared_ptr<BraveRequestInfo> ctx,
-    std::optional<std::string> original_csp) {
-  std::string source_host;
-  if (ctx->initiator_url.is_valid() && !ctx->initiator_url.host().empty()) {
-    source_host = ctx->initiator_url.host();
-  } else if (ctx->request_url.is_valid()) {
+namespace {
+
+std::optional<std::string> GetSourceHost(const BraveRequestInfo& ctx) {
+  if (ctx.initiator_url.is_valid() && !ctx.initiator_url.host().empty()) {
+    return ctx.initiator_url.host();
+  }
+  if (ctx.request_url.is_valid()) {
     // Top-level document requests do not have a valid initiator URL, and
     // requests from special schemes like file:// do not have host parts, so we
     // use the request URL as the initiator.
-    source_host = ctx->request_url.host();
-  } else {
+    return ctx.request_url.host();
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
+std::optional<std::string> GetCspDirectivesOnTaskRunner(
+    std::shared_ptr<BraveRequestInfo> ctx,
+    std::optional<std::string> source_host,
+    std::optional<std::string> original_csp) {
+  if (!source_host) {
     return std::nullopt;
   }
 
   std::optional<std::string> csp_directives =
       g_brave_browser_process->ad_block_service()->GetCspDirectives(
-          ctx->request_url, ctx->resource_type, source_host);
+          ctx->request_url, ctx->resource_type, *source_host);
 
   brave_shields::MergeCspDirectiveInto(original_csp, &csp_directives);
   return csp_directives;
@@ -72,6 +83,16 @@ int OnHeadersReceived_AdBlockCspWork(
 
   if (ctx->resource_type == blink::mojom::ResourceType::kMainFrame ||
       ctx->resource_type == blink::mojom::ResourceType::kSubFrame) {
+    // Most documents match no `$csp` rule. If the engines already know that,
+    // leave the headers alone and skip the round trip to the matching task
+    // runner.
+    std::optional<std::string> source_host = GetSourceHost(*ctx);
+    if (source_host &&
+        !g_brave_browser_process->ad_block_service()->MayHaveCspDirectives(
+            ctx->request_url, ctx->resource_type, *source_host)) {
+      return net::OK;
+    }
+
     // If the override_response_headers have already been populated, we should
     // use those directly.  Otherwise, we populate them from the original
     // headers.
@@ -87,10 +108,11 @@ int OnHeadersReceived_AdBlockCspWork(
     (*override_response_headers)->RemoveHeader("Content-Security-Policy");
 
     g_brave_browser_process->ad_block_service()
-        ->GetTaskRunner()
+        ->GetMatchingTaskRunner()
         ->PostTaskAndReplyWithResult(
             FROM_HERE,
-            base::BindOnce(&GetCspDirectivesOnTaskRunner, ctx, original_csp),
+            base::BindOnce(&GetCspDirectivesOnTaskRunner, ctx,
+                           std::move(source_host), original_csp),
             base::BindOnce(&OnReceiveCspDirectives, next_callback, ctx,
                            *override_response_headers));
     return net::ERR_IO_PENDING;
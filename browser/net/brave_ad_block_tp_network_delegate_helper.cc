@@ -13,16 +13,21 @@
 
 #include "base/check.h"
 #include "base/check_op.h"
+#include "base/containers/flat_map.h"
 #include "base/feature_list.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/no_destructor.h"
 #include "base/notreached.h"
 #include "base/strings/string_util.h"
+#include "base/task/sequenced_task_runner.h"
+#include "base/task/task_runner.h"
 #include "base/timer/elapsed_timer.h"
 #include "brave/browser/brave_browser_process.h"
 #include "brave/browser/brave_shields/ad_block_pref_service_factory.h"
 #include "brave/browser/brave_shields/brave_shields_web_contents_observer.h"
 #include "brave/browser/net/url_context.h"
+#include "brave/components/brave_perf_predictor/browser/perf_predictor_tab_helper.h"
 #include "brave/components/brave_shields/content/browser/ad_block_pref_service.h"
 #include "brave/components/brave_shields/content/browser/ad_block_service.h"
 #include "brave/components/brave_shields/core/common/brave_shield_constants.h"
@@ -68,7 +73,7 @@ struct EngineFlags {
   bool did_match_important = false;
 };
 
-void UseCnameResult(scoped_refptr<base::SequencedTaskRunner> task_runner,
+void UseCnameResult(scoped_refptr<base::TaskRunner> task_runner,
                     const ResponseCallback& next_callback,
                     std::shared_ptr<BraveRequestInfo> ctx,
                     EngineFlags previous_result,
@@ -83,7 +88,7 @@ class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
  public:
   AdblockCnameResolveHostClient(
       const ResponseCallback& next_callback,
-      scoped_refptr<base::SequencedTaskRunner> task_runner,
+      scoped_refptr<base::TaskRunner> task_runner,
       std::shared_ptr<BraveRequestInfo> ctx,
       EngineFlags previous_result) {
     DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
@@ -172,42 +177,26 @@ class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
   }
 };
 
-// If `canonical_url` is specified, this will only check if the CNAME-uncloaked
-// response should be blocked. Otherwise, it will run the check for the
-// original request URL.
-EngineFlags ShouldBlockRequestOnTaskRunner(
-    std::shared_ptr<BraveRequestInfo> ctx,
-    EngineFlags previous_result,
-    std::optional<GURL> canonical_url) {
-  if (!ctx->initiator_url.is_valid()) {
-    return previous_result;
-  }
-  const std::string source_host = std::string(ctx->initiator_url.host());
-
-  GURL url_to_check;
-  if (canonical_url.has_value()) {
-    url_to_check = *canonical_url;
-  } else {
-    url_to_check = ctx->request_url;
-  }
-
-  bool force_aggressive = SameDomainOrHost(
-      ctx->initiator_url,
+bool ShouldForceAggressiveBlocking(const BraveRequestInfo& ctx) {
+  return SameDomainOrHost(
+      ctx.initiator_url,
       url::Origin::CreateFromNormalizedTuple("https", "youtube.com", 443),
       net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+}
 
-  SCOPED_UMA_HISTOGRAM_TIMER("Brave.Adblock.ShouldBlockRequest");
-  auto adblock_result =
-      g_brave_browser_process->ad_block_service()->ShouldStartRequest(
-          url_to_check, ctx->resource_type, source_host,
-          ctx->aggressive_blocking || force_aggressive,
-          previous_result.did_match_rule, previous_result.did_match_exception,
-          previous_result.did_match_important);
-
+// Records the engine's verdict for `url_to_check` on `ctx`, reports it to
+// devtools if needed, and returns the flags accumulated so far.
+EngineFlags ApplyAdBlockResult(std::shared_ptr<BraveRequestInfo> ctx,
+                               EngineFlags previous_result,
+                               bool is_canonical_url,
+                               const GURL& url_to_check,
+                               const std::string& source_host,
+                               bool aggressive,
+                               const adblock::BlockerResult& adblock_result) {
   bool has_valid_rewritten_url = false;
   // Note that `rewritten_url` results should only be used for the
   // "user-facing" URL; never for the canonical one.
-  if (!canonical_url && adblock_result.rewritten_url.has_value &&
+  if (!is_canonical_url && adblock_result.rewritten_url.has_value &&
       GURL(std::string(adblock_result.rewritten_url.value)).is_valid() &&
       (ctx->method == "GET" || ctx->method == "HEAD" ||
        ctx->method == "OPTIONS")) {
@@ -237,7 +226,7 @@ EngineFlags ShouldBlockRequestOnTaskRunner(
     info.checked_url = url_to_check;
     info.source_host = source_host;
     info.resource_type = ctx->resource_type;
-    info.aggressive = ctx->aggressive_blocking || force_aggressive;
+    info.aggressive = aggressive;
     info.blocked = ctx->blocked_by == kAdBlocked;
     info.did_match_important_rule = previous_result.did_match_important;
     info.did_match_rule = previous_result.did_match_rule;
@@ -254,13 +243,87 @@ EngineFlags ShouldBlockRequestOnTaskRunner(
   return previous_result;
 }
 
+// If `canonical_url` is specified, this will only check if the CNAME-uncloaked
+// response should be blocked. Otherwise, it will run the check for the
+// original request URL.
+EngineFlags ShouldBlockRequestOnTaskRunner(
+    std::shared_ptr<BraveRequestInfo> ctx,
+    EngineFlags previous_result,
+    std::optional<GURL> canonical_url) {
+  if (!ctx->initiator_url.is_valid()) {
+    return previous_result;
+  }
+  const std::string source_host = std::string(ctx->initiator_url.host());
+
+  GURL url_to_check;
+  if (canonical_url.has_value()) {
+    url_to_check = *canonical_url;
+  } else {
+    url_to_check = ctx->request_url;
+  }
+
+  const bool aggressive =
+      ctx->aggressive_blocking || ShouldForceAggressiveBlocking(*ctx);
+
+  SCOPED_UMA_HISTOGRAM_TIMER("Brave.Adblock.ShouldBlockRequest");
+  base::ElapsedTimer match_timer;
+  auto adblock_result =
+      g_brave_browser_process->ad_block_service()->ShouldStartRequest(
+          url_to_check, ctx->resource_type, source_host, aggressive,
+          previous_result.did_match_rule, previous_result.did_match_exception,
+          previous_result.did_match_important);
+  ctx->adblock_match_time += match_timer.Elapsed();
+
+  return ApplyAdBlockResult(ctx, previous_result, canonical_url.has_value(),
+                            url_to_check, source_host, aggressive,
+                            adblock_result);
+}
+
+// Batched variant of `ShouldBlockRequestOnTaskRunner` for the initial check of
+// requests that share the same initiator host and blocking mode.
+std::vector<EngineFlags> ShouldBlockRequestsOnTaskRunner(
+    std::vector<std::shared_ptr<BraveRequestInfo>> ctxs,
+    std::string source_host,
+    bool aggressive) {
+  std::vector<brave_shields::AdBlockService::RequestToMatch> requests;
+  requests.reserve(ctxs.size());
+  for (const auto& ctx : ctxs) {
+    requests.push_back({.url = ctx->request_url,
+                        .resource_type = ctx->resource_type});
+  }
+
+  SCOPED_UMA_HISTOGRAM_TIMER("Brave.Adblock.ShouldBlockRequests");
+  base::ElapsedTimer match_timer;
+  const auto adblock_results =
+      g_brave_browser_process->ad_block_service()->ShouldStartRequests(
+          requests, source_host, aggressive);
+  CHECK_EQ(adblock_results.size(), ctxs.size());
+  // The batch is matched in one engine call, so split its cost evenly.
+  const base::TimeDelta per_request_match_time =
+      ctxs.empty() ? base::TimeDelta() : match_timer.Elapsed() / ctxs.size();
+
+  std::vector<EngineFlags> results;
+  results.reserve(ctxs.size());
+  for (size_t i = 0; i < ctxs.size(); ++i) {
+    ctxs[i]->adblock_match_time += per_request_match_time;
+    results.push_back(ApplyAdBlockResult(ctxs[i], EngineFlags(),
+                                         /*is_canonical_url=*/false,
+                                         ctxs[i]->request_url, source_host,
+                                         aggressive, adblock_results[i]));
+  }
+  return results;
+}
+
 void OnShouldBlockRequestResult(
     bool then_check_uncloaked,
-    scoped_refptr<base::SequencedTaskRunner> task_runner,
+    scoped_refptr<base::TaskRunner> task_runner,
     const ResponseCallback& next_callback,
     std::shared_ptr<BraveRequestInfo> ctx,
     EngineFlags result) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  brave_perf_predictor::PerfPredictorTabHelper::DispatchShieldsCost(
+      ctx->adblock_match_time, ctx->frame_tree_node_id);
+  ctx->adblock_match_time = base::TimeDelta();
   if (ctx->blocked_by == kAdBlocked) {
     brave_shields::BraveShieldsWebContentsObserver::DispatchBlockedEvent(
         ctx->request_url, ctx->frame_tree_node_id, brave_shields::kAds);
@@ -273,7 +336,7 @@ void OnShouldBlockRequestResult(
   next_callback.Run();
 }
 
-void UseCnameResult(scoped_refptr<base::SequencedTaskRunner> task_runner,
+void UseCnameResult(scoped_refptr<base::TaskRunner> task_runner,
                     const ResponseCallback& next_callback,
                     std::shared_ptr<BraveRequestInfo> ctx,
                     EngineFlags previous_result,
@@ -297,6 +360,89 @@ void UseCnameResult(scoped_refptr<base::SequencedTaskRunner> task_runner,
   }
 }
 
+// Collects the requests that reach this helper within the same run of the UI
+// task queue, so that they can be matched in one task on the adblock task
+// runner instead of one task hop per request.
+class AdBlockRequestBatcher {
+ public:
+  static AdBlockRequestBatcher* GetInstance() {
+    static base::NoDestructor<AdBlockRequestBatcher> instance;
+    return instance.get();
+  }
+
+  AdBlockRequestBatcher() = default;
+  AdBlockRequestBatcher(const AdBlockRequestBatcher&) = delete;
+  AdBlockRequestBatcher& operator=(const AdBlockRequestBatcher&) = delete;
+
+  void Add(const ResponseCallback& next_callback,
+           std::shared_ptr<BraveRequestInfo> ctx,
+           bool should_check_uncloaked) {
+    DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+    const bool aggressive =
+        ctx->aggressive_blocking || ShouldForceAggressiveBlocking(*ctx);
+    auto& batch = pending_[{std::string(ctx->initiator_url.host()),
+                            aggressive}];
+    batch.push_back({next_callback, std::move(ctx), should_check_uncloaked});
+
+    if (!flush_scheduled_) {
+      flush_scheduled_ = true;
+      // base::Unretained is safe because the batcher is never destroyed.
+      base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+          FROM_HERE, base::BindOnce(&AdBlockRequestBatcher::Flush,
+                                    base::Unretained(this)));
+    }
+  }
+
+ private:
+  struct PendingRequest {
+    ResponseCallback next_callback;
+    std::shared_ptr<BraveRequestInfo> ctx;
+    bool should_check_uncloaked = false;
+  };
+  // Requests are batched by initiator host and aggressive blocking mode.
+  using BatchKey = std::pair<std::string, bool>;
+
+  void Flush() {
+    DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+    flush_scheduled_ = false;
+
+    scoped_refptr<base::TaskRunner> task_runner =
+        g_brave_browser_process->ad_block_service()->GetMatchingTaskRunner();
+
+    auto pending = std::exchange(pending_, {});
+    for (auto& [key, batch] : pending) {
+      UMA_HISTOGRAM_COUNTS_1000("Brave.Adblock.RequestBatchSize",
+                                batch.size());
+      std::vector<std::shared_ptr<BraveRequestInfo>> ctxs;
+      ctxs.reserve(batch.size());
+      for (const auto& request : batch) {
+        ctxs.push_back(request.ctx);
+      }
+      task_runner->PostTaskAndReplyWithResult(
+          FROM_HERE,
+          base::BindOnce(&ShouldBlockRequestsOnTaskRunner, std::move(ctxs),
+                         key.first, key.second),
+          base::BindOnce(&AdBlockRequestBatcher::OnBatchResult, task_runner,
+                         std::move(batch)));
+    }
+  }
+
+  static void OnBatchResult(
+      scoped_refptr<base::TaskRunner> task_runner,
+      std::vector<PendingRequest> batch,
+      std::vector<EngineFlags> results) {
+    CHECK_EQ(batch.size(), results.size());
+    for (size_t i = 0; i < batch.size(); ++i) {
+      OnShouldBlockRequestResult(batch[i].should_check_uncloaked, task_runner,
+                                 batch[i].next_callback, batch[i].ctx,
+                                 results[i]);
+    }
+  }
+
+  base::flat_map<BatchKey, std::vector<PendingRequest>> pending_;
+  bool flush_scheduled_ = false;
+};
+
 // If only particular types of network traffic are being proxied, or if no
 // proxy is configured, it should be safe to continue making unproxied DNS
 // queries. However, in SingleProxy mode all types of network traffic should go
@@ -350,8 +496,8 @@ void OnBeforeURLRequestAdBlockTP(const ResponseCallback& next_callback,
   DCHECK(!ctx->request_url.is_empty());
   DCHECK(!ctx->initiator_url.is_empty());
 
-  scoped_refptr<base::SequencedTaskRunner> task_runner =
-      g_brave_browser_process->ad_block_service()->GetTaskRunner();
+  scoped_refptr<base::TaskRunner> task_runner =
+      g_brave_browser_process->ad_block_service()->GetMatchingTaskRunner();
 
   SecureDnsConfig secure_dns_config =
       SystemNetworkContextManager::GetStubResolverConfigReader()
@@ -381,6 +527,14 @@ void OnBeforeURLRequestAdBlockTP(const ResponseCallback& next_callback,
     should_check_uncloaked = false;
   }
 
+  if (ctx->initiator_url.is_valid() &&
+      base::FeatureList::IsEnabled(
+          brave_shields::features::kBraveAdblockBatchedRequestMatching)) {
+    AdBlockRequestBatcher::GetInstance()->Add(next_callback, std::move(ctx),
+                                              should_check_uncloaked);
+    return;
+  }
+
   task_runner->PostTaskAndReplyWithResult(
       FROM_HERE,
       base::BindOnce(&ShouldBlockRequestOnTaskRunner, ctx, EngineFlags(),
@@ -8,18 +8,23 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/check.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/path_service.h"
+#include "base/strings/stringprintf.h"
 #include "base/task/single_thread_task_runner.h"
+#include "base/test/scoped_feature_list.h"
+#include "base/timer/elapsed_timer.h"
 #include "brave/browser/brave_browser_process.h"
 #include "brave/browser/net/url_context.h"
 #include "brave/components/brave_component_updater/browser/brave_component.h"
 #include "brave/components/brave_shields/content/browser/ad_block_service.h"
 #include "brave/components/brave_shields/content/browser/ad_block_subscription_download_manager.h"
 #include "brave/components/brave_shields/content/test/test_filters_provider.h"
+#include "brave/components/brave_shields/core/common/features.h"
 #include "brave/test/base/testing_brave_browser_process.h"
 #include "chrome/browser/net/system_network_context_manager.h"
 #include "chrome/common/chrome_paths.h"
@@ -31,6 +36,7 @@
 #include "net/log/net_log.h"
 #include "services/network/host_resolver.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
 
 using brave::ResponseCallback;
 using brave_component_updater::BraveComponent;
@@ -254,3 +260,109 @@ TEST_F(BraveAdBlockTPNetworkDelegateHelperTest, AggressiveNo1pException) {
   // made (`browser_context` is `nullptr`).
   EXPECT_EQ(0ULL, host_resolver_->num_resolve());
 }
+
+TEST_F(BraveAdBlockTPNetworkDelegateHelperTest, BatchedMatching) {
+  base::test::ScopedFeatureList feature_list(
+      brave_shields::features::kBraveAdblockBatchedRequestMatching);
+  ResetAdblockInstance("||brave.com/test.txt\n@@||brave.com/test.txt?ok");
+
+  const struct {
+    const char* url;
+    const char* initiator;
+    bool aggressive;
+    brave::BlockedBy expected;
+  } kCases[] = {
+      {"https://brave.com/test.txt", "https://bravesoftware.com", false,
+       brave::kAdBlocked},
+      {"https://brave.com/test.txt?ok", "https://bravesoftware.com", false,
+       brave::kNotBlocked},
+      {"https://brave.com/other.txt", "https://bravesoftware.com", false,
+       brave::kNotBlocked},
+      {"https://brave.com/test.txt", "https://brave.com", false,
+       brave::kNotBlocked},
+      {"https://brave.com/test.txt", "https://brave.com", true,
+       brave::kAdBlocked},
+  };
+
+  // Queue every request before letting any task run, so that they are all
+  // matched as part of the same flush.
+  std::vector<std::shared_ptr<brave::BraveRequestInfo>> requests;
+  for (const auto& test_case : kCases) {
+    auto request_info =
+        std::make_shared<brave::BraveRequestInfo>(GURL(test_case.url));
+    request_info->request_identifier = 1;
+    request_info->resource_type = blink::mojom::ResourceType::kScript;
+    request_info->initiator_url = GURL(test_case.initiator);
+    request_info->aggressive_blocking = test_case.aggressive;
+    EXPECT_EQ(net::ERR_IO_PENDING, OnBeforeURLRequest_AdBlockTPPreWork(
+                                       base::DoNothing(), request_info));
+    requests.push_back(std::move(request_info));
+  }
+  task_environment_.RunUntilIdle();
+
+  for (size_t i = 0; i < std::size(kCases); ++i) {
+    SCOPED_TRACE(testing::Message() << kCases[i].url << " from "
+                                    << kCases[i].initiator);
+    EXPECT_EQ(requests[i]->blocked_by, kCases[i].expected);
+    EXPECT_TRUE(requests[i]->new_url_spec.empty());
+  }
+  EXPECT_EQ(0ULL, host_resolver_->num_resolve());
+}
+
+// Compares single-thread throughput of per-request and batched matching on the
+// adblock service itself, without any task hops.
+TEST_F(BraveAdBlockTPNetworkDelegateHelperTest, BatchedMatchingThroughput) {
+  constexpr size_t kRequestCount = 400;
+  constexpr int kIterations = 10;
+
+  std::string rules;
+  for (size_t i = 0; i < 200; ++i) {
+    rules += base::StringPrintf("||ads%zu.example.com^\n", i);
+  }
+  ResetAdblockInstance(rules);
+
+  auto* service = g_brave_browser_process->ad_block_service();
+  const std::string tab_host = "publisher.example.org";
+  std::vector<brave_shields::AdBlockService::RequestToMatch> requests;
+  for (size_t i = 0; i < kRequestCount; ++i) {
+    requests.push_back(
+        {.url = GURL(base::StringPrintf("https://ads%zu.example.com/p.js",
+                                        i % 400)),
+         .resource_type = blink::mojom::ResourceType::kScript});
+  }
+
+  size_t single_matches = 0;
+  base::ElapsedTimer single_timer;
+  for (int iteration = 0; iteration < kIterations; ++iteration) {
+    for (const auto& request : requests) {
+      single_matches +=
+          service
+              ->ShouldStartRequest(request.url, request.resource_type,
+                                   tab_host, false, false, false, false)
+              .matched;
+    }
+  }
+  const base::TimeDelta single_elapsed = single_timer.Elapsed();
+
+  size_t batched_matches = 0;
+  base::ElapsedTimer batched_timer;
+  for (int iteration = 0; iteration < kIterations; ++iteration) {
+    for (const auto& result :
+         service->ShouldStartRequests(requests, tab_host, false)) {
+      batched_matches += result.matched;
+    }
+  }
+  const base::TimeDelta batched_elapsed = batched_timer.Elapsed();
+
+  EXPECT_EQ(single_matches, batched_matches);
+  EXPECT_EQ(single_matches, kIterations * 200u);
+
+  const size_t total = kRequestCount * kIterations;
+  perf_test::PerfResultReporter reporter("AdBlockService.", "Matching");
+  reporter.RegisterImportantMetric("per_request", "ns/request");
+  reporter.RegisterImportantMetric("batched", "ns/request");
+  reporter.AddResult("per_request", single_elapsed.InNanoseconds() /
+                                        static_cast<double>(total));
+  reporter.AddResult("batched", batched_elapsed.InNanoseconds() /
+                                    static_cast<double>(total));
+}
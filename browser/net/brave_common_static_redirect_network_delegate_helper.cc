@@ -5,10 +5,13 @@
 
 #include "brave/browser/net/brave_common_static_redirect_network_delegate_helper.h"
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 
 #include "base/check.h"
+#include "base/containers/flat_set.h"
 #include "base/no_destructor.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
@@ -44,6 +47,58 @@ bool RewriteBugReportingURL(const GURL& request_url, GURL* new_url) {
   return true;
 }
 
+// The redirect patterns, together with the hosts they can match. Every
+// request goes through this helper, so requests to any other host are
+// rejected with a set lookup per host label instead of matching each pattern.
+struct StaticRedirectPatterns {
+  StaticRedirectPatterns()
+      : chromecast(URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
+                   kChromeCastPrefix),
+        clients4(URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
+                 kClients4Prefix),
+        bugs_chromium(URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
+                      "*://bugs.chromium.org/p/chromium/issues/entry?*") {
+    for (const URLPattern* pattern : {&chromecast, &clients4, &bugs_chromium}) {
+      if (pattern->host().empty()) {
+        matches_all_hosts = true;
+      } else if (pattern->match_subdomains()) {
+        subdomain_hosts.insert(pattern->host());
+      } else {
+        exact_hosts.insert(pattern->host());
+      }
+    }
+  }
+
+  bool MayMatchHost(std::string_view host) const {
+    if (matches_all_hosts || exact_hosts.contains(host)) {
+      return true;
+    }
+    while (!host.empty()) {
+      if (subdomain_hosts.contains(host)) {
+        return true;
+      }
+      const size_t dot = host.find('.');
+      if (dot == std::string_view::npos) {
+        break;
+      }
+      host.remove_prefix(dot + 1);
+    }
+    return false;
+  }
+
+  const URLPattern chromecast;
+  const URLPattern clients4;
+  const URLPattern bugs_chromium;
+  base::flat_set<std::string, std::less<>> exact_hosts;
+  base::flat_set<std::string, std::less<>> subdomain_hosts;
+  bool matches_all_hosts = false;
+};
+
+const StaticRedirectPatterns& GetStaticRedirectPatterns() {
+  static const base::NoDestructor<StaticRedirectPatterns> patterns;
+  return *patterns;
+}
+
 }  // namespace
 
 int OnBeforeURLRequest_CommonStaticRedirectWork(
@@ -63,30 +118,30 @@ int OnBeforeURLRequest_CommonStaticRedirectWorkForGURL(
     GURL* new_url) {
   DCHECK(new_url);
 
+  if (!request_url.SchemeIsHTTPOrHTTPS()) {
+    return net::OK;
+  }
+  const StaticRedirectPatterns& patterns = GetStaticRedirectPatterns();
+  if (!patterns.MayMatchHost(request_url.host_piece())) {
+    return net::OK;
+  }
+
   GURL::Replacements replacements;
-  static base::NoDestructor<URLPattern> chromecast_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kChromeCastPrefix);
-  static base::NoDestructor<URLPattern> clients4_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kClients4Prefix);
-  static base::NoDestructor<URLPattern> bugsChromium_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      "*://bugs.chromium.org/p/chromium/issues/entry?*");
-
-  if (chromecast_pattern->MatchesURL(request_url)) {
+  if (patterns.chromecast.MatchesURL(request_url)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr(kBraveRedirectorProxy);
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (clients4_pattern->MatchesHost(request_url)) {
+  if (patterns.clients4.MatchesHost(request_url)) {
     replacements.SetSchemeStr("https");
     replacements.SetHostStr(kBraveClients4Proxy);
     *new_url = request_url.ReplaceComponents(replacements);
     return net::OK;
   }
 
-  if (bugsChromium_pattern->MatchesURL(request_url)) {
+  if (patterns.bugs_chromium.MatchesURL(request_url)) {
     if (RewriteBugReportingURL(request_url, new_url)) {
       return net::OK;
     }
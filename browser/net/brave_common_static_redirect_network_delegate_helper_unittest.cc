@@ -88,3 +88,19 @@ TEST(BraveCommonStaticRedirectNetworkDelegateHelperTest,
   EXPECT_TRUE(request_info->new_url_spec.empty());
   EXPECT_EQ(rc, net::OK);
 }
+
+TEST(BraveCommonStaticRedirectNetworkDelegateHelperTest,
+     NoRedirectForOtherHosts) {
+  for (const char* spec :
+       {"https://example.com/chrome-sync/dev",
+        "https://clients4.google.com.example.com/chrome-sync/dev",
+        "https://notbugs.chromium.org/p/chromium/issues/"
+        "entry?template=A&comment=B&labels=C",
+        "wss://clients4.google.com/chrome-sync/dev"}) {
+    auto request_info = std::make_shared<brave::BraveRequestInfo>(GURL(spec));
+    int rc = OnBeforeURLRequest_CommonStaticRedirectWork(ResponseCallback(),
+                                                         request_info);
+    EXPECT_TRUE(request_info->new_url_spec.empty()) << spec;
+    EXPECT_EQ(rc, net::OK);
+  }
+}
@@ -512,6 +512,10 @@ void BraveProxyingURLLoaderFactory::InProgressRequest::
     // |FollowRedirect()|.
     proxied_client_receiver_.reset();
     target_loader_.reset();
+    // The original body is never delivered, don't keep its pipe and metadata
+    // alive until the redirected request completes.
+    current_response_body_.reset();
+    cached_metadata_.reset();
 
     ctx_->internal_redirect = true;
     ContinueToBeforeRedirect(redirect_info, net::OK);
@@ -676,6 +680,22 @@ void BraveProxyingURLLoaderFactory::CreateLoaderAndStart(
     const net::MutableNetworkTrafficAnnotationTag& traffic_annotation) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
 
+  // Bind requests that no helper would touch straight to the target factory,
+  // so their loader and client messages skip the extra hop through
+  // InProgressRequest.
+  const bool should_proxy =
+      request_handler_->HasHelpersForURLLoaderRequest(request.url);
+  UMA_HISTOGRAM_BOOLEAN("Brave.ProxyingURLLoaderFactory.RequestProxied",
+                        should_proxy);
+  if (!should_proxy) {
+    if (target_factory_.is_bound()) {
+      target_factory_->CreateLoaderAndStart(
+          std::move(loader_receiver), request_id, options, request,
+          std::move(client), traffic_annotation);
+    }
+    return;
+  }
+
   // The request ID doesn't really matter in the Network Service path. It just
   // needs to be unique per-BrowserContext so request handlers can make sense of
   // it. Note that |network_service_request_id_| by contrast is not necessarily
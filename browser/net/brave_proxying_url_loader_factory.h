@@ -149,6 +149,11 @@ class BraveProxyingURLLoaderFactory
     // ExtensionWebRequestEventRouter) through much of the request's lifetime.
     // That code supports both Network Service and non-Network Service behavior,
     // which is why this weirdness exists here.
+    //
+    // The response body pipe and cached metadata are only held while the
+    // header helpers run and are then handed to |target_client_| as-is; this
+    // class never reads or copies the body. Body rewriting (de-AMP,
+    // speedreader) is done by body_sniffer throttles instead.
     std::optional<mojo_base::BigBuffer> cached_metadata_;
     network::mojom::URLResponseHeadPtr current_response_head_;
     mojo::ScopedDataPipeConsumerHandle current_response_body_;
@@ -12,7 +12,9 @@
 #include "base/check_op.h"
 #include "base/functional/bind.h"
 #include "base/memory/scoped_refptr.h"
+#include "base/metrics/histogram_functions.h"
 #include "brave/browser/net/brave_request_handler.h"
+#include "brave/browser/net/brave_web_socket_decision_cache.h"
 #include "brave/components/constants/network_constants.h"
 #include "content/public/browser/browser_context.h"
 #include "content/public/browser/browser_thread.h"
@@ -27,8 +29,10 @@ BraveProxyingWebSocket::BraveProxyingWebSocket(
     content::BrowserContext* browser_context,
     scoped_refptr<RequestIDGenerator> request_id_generator,
     BraveRequestHandler& handler,
+    BraveWebSocketDecisionCache* decision_cache,
     DisconnectCallback on_disconnect)
     : request_handler_(handler),
+      decision_cache_(decision_cache),
       frame_tree_node_id_(frame_tree_node_id),
       factory_(std::move(factory)),
       browser_context_(browser_context),
@@ -77,22 +81,24 @@ void BraveProxyingWebSocket::Start(
                      weak_factory_.GetWeakPtr()));
 
   request_id_ = request_id_generator_->Generate();
-  // If the header client will be used, we start the request immediately, and
-  // OnBeforeSendHeaders and OnSendHeaders will be handled there. Otherwise,
-  // send these events before the request starts.
-  base::RepeatingCallback<void(int)> continuation;
-  if (proxy_has_extra_headers()) {
-    continuation = base::BindRepeating(
-        &BraveProxyingWebSocket::ContinueToStartRequest,
-        weak_factory_.GetWeakPtr());
-  } else {
-    continuation = base::BindRepeating(
-        &BraveProxyingWebSocket::OnBeforeRequestComplete,
-        weak_factory_.GetWeakPtr());
-  }
+  start_time_ = base::TimeTicks::Now();
 
   ctx_ = brave::BraveRequestInfo::MakeCTX(request_, frame_tree_node_id_,
                                           request_id_, browser_context_, ctx_);
+  // Reconnects to an endpoint that was just allowed skip the request helpers.
+  // Header helpers still run, since they can differ for every handshake.
+  if (decision_cache_ &&
+      decision_cache_->IsAllowed(
+          frame_tree_node_id_,
+          request_.request_initiator.value_or(url::Origin()), request_.url)) {
+    used_cached_decision_ = true;
+    OnBeforeURLRequestComplete(net::OK);
+    return;
+  }
+
+  auto continuation =
+      base::BindRepeating(&BraveProxyingWebSocket::OnBeforeURLRequestComplete,
+                          weak_factory_.GetWeakPtr());
   int result = request_handler_->OnBeforeURLRequest(
       ctx_, continuation, &redirect_url_);
   // TODO(bridiver) - need to handle general case for redirect_url
@@ -112,6 +118,24 @@ void BraveProxyingWebSocket::Start(
   continuation.Run(net::OK);
 }
 
+void BraveProxyingWebSocket::OnBeforeURLRequestComplete(int error_code) {
+  if (error_code == net::OK && decision_cache_ && !used_cached_decision_ &&
+      redirect_url_.is_empty()) {
+    decision_cache_->RecordAllowed(
+        frame_tree_node_id_, request_.request_initiator.value_or(url::Origin()),
+        request_.url);
+  }
+
+  // If the header client will be used, we start the request immediately, and
+  // OnBeforeSendHeaders and OnSendHeaders will be handled there. Otherwise,
+  // send these events before the request starts.
+  if (proxy_has_extra_headers()) {
+    ContinueToStartRequest(error_code);
+  } else {
+    OnBeforeRequestComplete(error_code);
+  }
+}
+
 content::ContentBrowserClient::WebSocketFactory
 BraveProxyingWebSocket::CreateWebSocketFactory() {
   return base::BindOnce(&BraveProxyingWebSocket::WebSocketFactoryRun,
@@ -191,6 +215,10 @@ void BraveProxyingWebSocket::OnConnectionEstablished(
   DCHECK(forwarding_handshake_client_);
   DCHECK(!is_done_);
   remote_endpoint_ = response->remote_endpoint;
+  base::UmaHistogramTimes(used_cached_decision_
+                              ? "Brave.WebSocket.HandshakeTime.CachedDecision"
+                              : "Brave.WebSocket.HandshakeTime",
+                          base::TimeTicks::Now() - start_time_);
   forwarding_handshake_client_->OnConnectionEstablished(
       std::move(websocket), std::move(client_receiver), std::move(response),
       std::move(readable), std::move(writable));
@@ -311,6 +339,12 @@ void BraveProxyingWebSocket::ContinueToStartRequest(int error_code) {
     return;
   }
 
+  // Time spent in the Brave helpers before the handshake is started.
+  base::UmaHistogramMicrosecondsTimes(
+      used_cached_decision_ ? "Brave.WebSocket.ProxyOverhead.CachedDecision"
+                            : "Brave.WebSocket.ProxyOverhead",
+      base::TimeTicks::Now() - start_time_);
+
   std::vector<network::mojom::HttpHeaderPtr> additional_headers;
   if (!proxy_has_extra_headers()) {
     for (net::HttpRequestHeaders::Iterator it(request_.headers);
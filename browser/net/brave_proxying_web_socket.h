@@ -16,6 +16,7 @@
 #include "base/memory/raw_ref.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "brave/browser/net/resource_context_data.h"
 #include "brave/browser/net/url_context.h"
 #include "content/public/browser/content_browser_client.h"
@@ -34,6 +35,8 @@ class BrowserContext;
 class RenderFrameHost;
 }
 
+class BraveWebSocketDecisionCache;
+
 // Ensures that all web socket requests go through Brave network request
 // handling framework. Cargoculted from |WebRequestProxyingWebSocket|.
 class BraveProxyingWebSocket
@@ -52,6 +55,7 @@ class BraveProxyingWebSocket
       content::BrowserContext* browser_context,
       scoped_refptr<RequestIDGenerator> request_id_generator,
       BraveRequestHandler& handler,
+      BraveWebSocketDecisionCache* decision_cache,
       DisconnectCallback on_disconnect);
   BraveProxyingWebSocket(const BraveProxyingWebSocket&) = delete;
   BraveProxyingWebSocket& operator=(const BraveProxyingWebSocket&) = delete;
@@ -107,6 +111,7 @@ class BraveProxyingWebSocket
       mojo::PendingRemote<network::mojom::TrustedHeaderClient>
           trusted_header_client);
 
+  void OnBeforeURLRequestComplete(int error_code);
   void OnBeforeSendHeadersComplete(int error_code);
   void OnBeforeRequestComplete(int error_code);
   void ContinueToStartRequest(int error_code);
@@ -127,6 +132,8 @@ class BraveProxyingWebSocket
                              const std::string& description);
 
   const raw_ref<BraveRequestHandler> request_handler_;
+  // Null unless features::kBraveWebSocketHandshakeDecisionCache is enabled.
+  const raw_ptr<BraveWebSocketDecisionCache> decision_cache_;
   // TODO(iefremov): Get rid of shared_ptr, we should clearly own the pointer.
   // TODO(iefremov): Init this only once.
   std::shared_ptr<brave::BraveRequestInfo> ctx_;
@@ -152,6 +159,10 @@ class BraveProxyingWebSocket
   GURL redirect_url_;
   bool is_done_ = false;
   uint64_t request_id_ = 0;
+  base::TimeTicks start_time_;
+  // True if the OnBeforeURLRequest helpers were skipped because the endpoint
+  // was allowed recently.
+  bool used_cached_decision_ = false;
 
   // chrome websocket proxy
   GURL proxy_url_;
@@ -11,6 +11,12 @@
 #include "base/check.h"
 #include "base/feature_list.h"
 #include "base/memory/scoped_refptr.h"
+#include "base/metrics/histogram.h"
+#include "base/notreached.h"
+#include "base/strings/strcat.h"
+#include "base/time/time.h"
+#include "base/trace_event/trace_event.h"
+#include "brave/browser/brave_browser_features.h"
 #include "brave/browser/net/brave_ad_block_csp_network_delegate_helper.h"
 #include "brave/browser/net/brave_ad_block_tp_network_delegate_helper.h"
 #include "brave/browser/net/brave_common_static_redirect_network_delegate_helper.h"
@@ -40,85 +46,149 @@
 #include "brave/browser/net/decentralized_dns_network_delegate_helper.h"
 #endif
 
-static bool IsInternalScheme(std::shared_ptr<brave::BraveRequestInfo> ctx) {
-  DCHECK(ctx);
+static bool IsInternalScheme(const GURL& url) {
 #if BUILDFLAG(ENABLE_EXTENSIONS)
-  if (ctx->request_url.SchemeIs(extensions::kExtensionScheme))
+  if (url.SchemeIs(extensions::kExtensionScheme))
     return true;
 #endif
-  return ctx->request_url.SchemeIs(content::kChromeUIScheme);
+  return url.SchemeIs(content::kChromeUIScheme);
+}
+
+static bool IsInternalScheme(std::shared_ptr<brave::BraveRequestInfo> ctx) {
+  DCHECK(ctx);
+  return IsInternalScheme(ctx->request_url);
 }
 
-BraveRequestHandler::BraveRequestHandler() {
+BraveRequestHandler::BraveRequestHandler()
+    : helper_timing_enabled_(
+          base::FeatureList::IsEnabled(
+              features::kBraveRequestHandlerHelperTiming)) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   SetupCallbacks();
 }
 
 BraveRequestHandler::~BraveRequestHandler() = default;
 
-void BraveRequestHandler::SetupCallbacks() {
-  brave::OnBeforeURLRequestCallback callback =
-      base::BindRepeating(brave::OnBeforeURLRequest_SiteHacksWork);
-  before_url_request_callbacks_.push_back(callback);
+namespace {
+
+constexpr char kOnBeforeURLRequestStage[] = "OnBeforeURLRequest";
+constexpr char kOnBeforeStartTransactionStage[] = "OnBeforeStartTransaction";
+constexpr char kOnHeadersReceivedStage[] = "OnHeadersReceived";
+
+std::string_view GetStageName(brave::BraveNetworkDelegateEventType type) {
+  switch (type) {
+    case brave::kOnBeforeRequest:
+      return kOnBeforeURLRequestStage;
+    case brave::kOnBeforeStartTransaction:
+      return kOnBeforeStartTransactionStage;
+    case brave::kOnHeadersReceived:
+      return kOnHeadersReceivedStage;
+    default:
+      return "Unknown";
+  }
+}
 
-  callback = base::BindRepeating(brave::OnBeforeURLRequest_AdBlockTPPreWork);
-  before_url_request_callbacks_.push_back(callback);
+base::HistogramBase* GetLocalTimeHistogram(std::string_view name) {
+  return base::Histogram::FactoryMicrosecondsTimeGet(
+      std::string(name), base::Microseconds(1), base::Seconds(10), 50,
+      base::HistogramBase::kNoFlags);
+}
 
-  callback =
-      base::BindRepeating(brave::OnBeforeURLRequest_CommonStaticRedirectWork);
-  before_url_request_callbacks_.push_back(callback);
+}  // namespace
+
+template <typename Callback>
+void BraveRequestHandler::AddHelper(std::vector<Helper<Callback>>& helpers,
+                                    std::string_view stage,
+                                    std::string_view name,
+                                    Callback callback) {
+  // Looked up once here rather than by name on every request.
+  const std::string histogram_name =
+      base::StrCat({"Brave.RequestHandler.", stage, ".", name});
+  base::HistogramBase* latency_histogram =
+      base::Histogram::FactoryMicrosecondsTimeGet(
+          histogram_name, base::Microseconds(1), base::Milliseconds(100), 50,
+          base::HistogramBase::kUmaTargetedHistogramFlag);
+  base::HistogramBase* wall_time_histogram =
+      helper_timing_enabled_
+          ? GetLocalTimeHistogram(base::StrCat({histogram_name, ".WallTime"}))
+          : nullptr;
+  helpers.push_back({base::StrCat({stage, ".", name}), std::move(callback),
+                     latency_histogram, wall_time_histogram});
+}
+
+void BraveRequestHandler::SetupCallbacks() {
+  AddHelper(before_url_request_callbacks_, kOnBeforeURLRequestStage,
+            "SiteHacks",
+            base::BindRepeating(brave::OnBeforeURLRequest_SiteHacksWork));
+  AddHelper(before_url_request_callbacks_, kOnBeforeURLRequestStage,
+            "AdBlockTP",
+            base::BindRepeating(brave::OnBeforeURLRequest_AdBlockTPPreWork));
+  AddHelper(
+      before_url_request_callbacks_, kOnBeforeURLRequestStage,
+      "CommonStaticRedirect",
+      base::BindRepeating(brave::OnBeforeURLRequest_CommonStaticRedirectWork));
 
 #if BUILDFLAG(ENABLE_BRAVE_WALLET)
-  callback = base::BindRepeating(
-      decentralized_dns::OnBeforeURLRequest_DecentralizedDnsPreRedirectWork);
-  before_url_request_callbacks_.push_back(callback);
+  AddHelper(before_url_request_callbacks_, kOnBeforeURLRequestStage,
+            "DecentralizedDns",
+            base::BindRepeating(
+                decentralized_dns::
+                    OnBeforeURLRequest_DecentralizedDnsPreRedirectWork));
 #endif
 
   if (base::FeatureList::IsEnabled(
           brave_shields::features::kBraveLocalhostAccessPermission)) {
-    callback =
-        base::BindRepeating(brave::OnBeforeURLRequest_LocalhostPermissionWork);
-    before_url_request_callbacks_.push_back(callback);
+    AddHelper(
+        before_url_request_callbacks_, kOnBeforeURLRequestStage,
+        "LocalhostPermission",
+        base::BindRepeating(brave::OnBeforeURLRequest_LocalhostPermissionWork));
   }
 
-  brave::OnBeforeStartTransactionCallback start_transaction_callback =
-      base::BindRepeating(brave::OnBeforeStartTransaction_SiteHacksWork);
-  before_start_transaction_callbacks_.push_back(start_transaction_callback);
+  AddHelper(
+      before_start_transaction_callbacks_, kOnBeforeStartTransactionStage,
+      "SiteHacks",
+      base::BindRepeating(brave::OnBeforeStartTransaction_SiteHacksWork));
 
   if (base::FeatureList::IsEnabled(
           brave_user_agent::features::kUseBraveUserAgent)) {
-    start_transaction_callback =
-        base::BindRepeating(brave::OnBeforeStartTransaction_UserAgentWork);
-    before_start_transaction_callbacks_.push_back(start_transaction_callback);
+    AddHelper(
+        before_start_transaction_callbacks_, kOnBeforeStartTransactionStage,
+        "UserAgent",
+        base::BindRepeating(brave::OnBeforeStartTransaction_UserAgentWork));
   }
 
   if (base::FeatureList::IsEnabled(
           blink::features::kBraveGlobalPrivacyControl)) {
-    start_transaction_callback = base::BindRepeating(
-        brave::OnBeforeStartTransaction_GlobalPrivacyControlWork);
-    before_start_transaction_callbacks_.push_back(start_transaction_callback);
+    AddHelper(before_start_transaction_callbacks_,
+              kOnBeforeStartTransactionStage, "GlobalPrivacyControl",
+              base::BindRepeating(
+                  brave::OnBeforeStartTransaction_GlobalPrivacyControlWork));
   }
 
-  start_transaction_callback =
-      base::BindRepeating(brave::OnBeforeStartTransaction_BraveServiceKey);
-  before_start_transaction_callbacks_.push_back(start_transaction_callback);
+  AddHelper(
+      before_start_transaction_callbacks_, kOnBeforeStartTransactionStage,
+      "BraveServiceKey",
+      base::BindRepeating(brave::OnBeforeStartTransaction_BraveServiceKey));
 
   if (base::FeatureList::IsEnabled(
           brave_shields::features::kBraveReduceLanguage)) {
-    start_transaction_callback =
-        base::BindRepeating(brave::OnBeforeStartTransaction_ReduceLanguageWork);
-    before_start_transaction_callbacks_.push_back(start_transaction_callback);
+    AddHelper(
+        before_start_transaction_callbacks_, kOnBeforeStartTransactionStage,
+        "ReduceLanguage",
+        base::BindRepeating(
+            brave::OnBeforeStartTransaction_ReduceLanguageWork));
   }
 
-  start_transaction_callback =
-      base::BindRepeating(brave::OnBeforeStartTransaction_SearchAdsHeader);
-  before_start_transaction_callbacks_.push_back(start_transaction_callback);
+  AddHelper(
+      before_start_transaction_callbacks_, kOnBeforeStartTransactionStage,
+      "SearchAdsHeader",
+      base::BindRepeating(brave::OnBeforeStartTransaction_SearchAdsHeader));
 
   if (base::FeatureList::IsEnabled(
           ::brave_shields::features::kBraveAdblockCspRules)) {
-    brave::OnHeadersReceivedCallback headers_received_callback2 =
-        base::BindRepeating(brave::OnHeadersReceived_AdBlockCspWork);
-    headers_received_callbacks_.push_back(headers_received_callback2);
+    AddHelper(headers_received_callbacks_, kOnHeadersReceivedStage,
+              "AdBlockCsp",
+              base::BindRepeating(brave::OnHeadersReceived_AdBlockCspWork));
   }
 }
 
@@ -127,6 +197,17 @@ bool BraveRequestHandler::IsRequestIdentifierValid(
   return callbacks_.contains(request_identifier);
 }
 
+bool BraveRequestHandler::HasHelpersForURLLoaderRequest(
+    const GURL& url) const {
+  // BraveProxyingURLLoaderFactory only runs the header stages for HTTP(S), so
+  // other schemes only ever see OnBeforeURLRequest(), which skips internal
+  // schemes.
+  if (url.SchemeIsHTTPOrHTTPS()) {
+    return true;
+  }
+  return !before_url_request_callbacks_.empty() && !IsInternalScheme(url);
+}
+
 int BraveRequestHandler::OnBeforeURLRequest(
     std::shared_ptr<brave::BraveRequestInfo> ctx,
     net::CompletionOnceCallback callback,
@@ -137,8 +218,7 @@ int BraveRequestHandler::OnBeforeURLRequest(
   ctx->new_url = new_url;
   ctx->event_type = brave::kOnBeforeRequest;
   callbacks_[ctx->request_identifier] = std::move(callback);
-  RunNextCallback(ctx);
-  return net::ERR_IO_PENDING;
+  return RunHelpers(ctx, /*can_complete_synchronously=*/true);
 }
 
 int BraveRequestHandler::OnBeforeStartTransaction(
@@ -151,8 +231,7 @@ int BraveRequestHandler::OnBeforeStartTransaction(
   ctx->event_type = brave::kOnBeforeStartTransaction;
   ctx->headers = headers;
   callbacks_[ctx->request_identifier] = std::move(callback);
-  RunNextCallback(ctx);
-  return net::ERR_IO_PENDING;
+  return RunHelpers(ctx, /*can_complete_synchronously=*/true);
 }
 
 int BraveRequestHandler::OnHeadersReceived(
@@ -180,8 +259,7 @@ int BraveRequestHandler::OnHeadersReceived(
   ctx->override_response_headers = override_response_headers;
   ctx->allowed_unsafe_redirect_url = allowed_unsafe_redirect_url;
 
-  RunNextCallback(ctx);
-  return net::ERR_IO_PENDING;
+  return RunHelpers(ctx, /*can_complete_synchronously=*/true);
 }
 
 void BraveRequestHandler::OnURLRequestDestroyed(
@@ -195,44 +273,122 @@ void BraveRequestHandler::OnURLRequestDestroyed(
 void BraveRequestHandler::RunCallbackForRequestIdentifier(
     uint64_t request_identifier,
     int rv) {
-  std::map<uint64_t, net::CompletionOnceCallback>::iterator it =
-      callbacks_.find(request_identifier);
+  auto it = callbacks_.find(request_identifier);
   // We intentionally do the async call to maintain the proper flow
   // of URLLoader callbacks.
   content::GetUIThreadTaskRunner({})->PostTask(
       FROM_HERE, base::BindOnce(std::move(it->second), rv));
 }
 
-// TODO(iefremov): Merge all callback containers into one and run only one loop
-// instead of many (issues/5574).
+template <typename Callback, typename... Args>
+int BraveRequestHandler::RunHelper(
+    const Helper<Callback>& helper,
+    const std::shared_ptr<brave::BraveRequestInfo>& ctx,
+    const Args&... args) {
+  TRACE_EVENT("brave", "BraveRequestHandler::RunHelper", "helper",
+              helper.name, "request_id", ctx->request_identifier);
+  const base::TimeTicks start = base::TimeTicks::Now();
+  const int rv = helper.callback.Run(args..., ctx);
+  const base::TimeDelta elapsed = base::TimeTicks::Now() - start;
+  helper.latency_histogram->AddTimeMicrosecondsGranularity(elapsed);
+
+  if (rv == net::ERR_IO_PENDING) {
+    // Ended in RunNextCallback() once the helper responds.
+    TRACE_EVENT_BEGIN("brave", "BraveRequestHandler::PendingHelper",
+                      perfetto::Track(ctx->request_identifier), "helper",
+                      helper.name);
+    if (helper_timing_enabled_) {
+      ctx->pending_helper_start = start;
+      ++ctx->async_helper_hops;
+    }
+  } else if (helper.wall_time_histogram) {
+    helper.wall_time_histogram->AddTimeMicrosecondsGranularity(elapsed);
+  }
+  return rv;
+}
+
+base::HistogramBase* BraveRequestHandler::GetPendingHelperWallTimeHistogram(
+    const brave::BraveRequestInfo& ctx) const {
+  // `next_url_request_index` was advanced past the pending helper.
+  DCHECK_GT(ctx.next_url_request_index, 0u);
+  const size_t index = ctx.next_url_request_index - 1;
+  switch (ctx.event_type) {
+    case brave::kOnBeforeRequest:
+      return before_url_request_callbacks_[index].wall_time_histogram;
+    case brave::kOnBeforeStartTransaction:
+      return before_start_transaction_callbacks_[index].wall_time_histogram;
+    case brave::kOnHeadersReceived:
+      return headers_received_callbacks_[index].wall_time_histogram;
+    default:
+      NOTREACHED();
+  }
+}
+
 void BraveRequestHandler::RunNextCallback(
     std::shared_ptr<brave::BraveRequestInfo> ctx) {
+  TRACE_EVENT_END("brave", perfetto::Track(ctx->request_identifier));
+  if (!ctx->pending_helper_start.is_null()) {
+    GetPendingHelperWallTimeHistogram(*ctx)->AddTimeMicrosecondsGranularity(
+        base::TimeTicks::Now() - ctx->pending_helper_start);
+    ctx->pending_helper_start = base::TimeTicks();
+  }
+  RunHelpers(std::move(ctx), /*can_complete_synchronously=*/false);
+}
+
+int BraveRequestHandler::CompleteRequest(const brave::BraveRequestInfo& ctx,
+                                         int rv,
+                                         bool can_complete_synchronously) {
+  if (helper_timing_enabled_) {
+    base::LinearHistogram::FactoryGet(
+        base::StrCat({"Brave.RequestHandler.", GetStageName(ctx.event_type),
+                      ".AsyncHops"}),
+        1, 16, 17, base::HistogramBase::kNoFlags)
+        ->Add(ctx.async_helper_hops);
+  }
+
+  // Callers handle these two results synchronously, which saves a task hop
+  // for the common case where no helper had to wait.
+  if (can_complete_synchronously &&
+      (rv == net::OK || rv == net::ERR_BLOCKED_BY_CLIENT)) {
+    callbacks_.erase(ctx.request_identifier);
+    return rv;
+  }
+  RunCallbackForRequestIdentifier(ctx.request_identifier, rv);
+  return net::ERR_IO_PENDING;
+}
+
+// TODO(iefremov): Merge all callback containers into one and run only one loop
+// instead of many (issues/5574).
+int BraveRequestHandler::RunHelpers(
+    std::shared_ptr<brave::BraveRequestInfo> ctx,
+    bool can_complete_synchronously) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
 
   if (!callbacks_.contains(ctx->request_identifier)) {
-    return;
+    return net::ERR_IO_PENDING;
   }
 
   if (ctx->pending_error.has_value()) {
-    RunCallbackForRequestIdentifier(ctx->request_identifier,
-                                    ctx->pending_error.value());
-    return;
+    return CompleteRequest(*ctx, ctx->pending_error.value(),
+                           can_complete_synchronously);
   }
 
+  // Shared by all helpers of this stage; only one of them can be pending at a
+  // time.
+  const brave::ResponseCallback next_callback = base::BindRepeating(
+      &BraveRequestHandler::RunNextCallback, weak_factory_.GetWeakPtr(), ctx);
+
   // Continue processing callbacks until we hit one that returns PENDING
   int rv = net::OK;
 
   if (ctx->event_type == brave::kOnBeforeRequest) {
     while (before_url_request_callbacks_.size() !=
            ctx->next_url_request_index) {
-      brave::OnBeforeURLRequestCallback callback =
-          before_url_request_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback =
-          base::BindRepeating(&BraveRequestHandler::RunNextCallback,
-                              weak_factory_.GetWeakPtr(), ctx);
-      rv = callback.Run(next_callback, ctx);
+      rv = RunHelper(
+          before_url_request_callbacks_[ctx->next_url_request_index++], ctx,
+          next_callback);
       if (rv == net::ERR_IO_PENDING) {
-        return;
+        return net::ERR_IO_PENDING;
       }
       if (rv != net::OK) {
         break;
@@ -241,14 +397,11 @@ void BraveRequestHandler::RunNextCallback(
   } else if (ctx->event_type == brave::kOnBeforeStartTransaction) {
     while (before_start_transaction_callbacks_.size() !=
            ctx->next_url_request_index) {
-      brave::OnBeforeStartTransactionCallback callback =
-          before_start_transaction_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback =
-          base::BindRepeating(&BraveRequestHandler::RunNextCallback,
-                              weak_factory_.GetWeakPtr(), ctx);
-      rv = callback.Run(ctx->headers, next_callback, ctx);
+      rv = RunHelper(
+          before_start_transaction_callbacks_[ctx->next_url_request_index++],
+          ctx, ctx->headers.get(), next_callback);
       if (rv == net::ERR_IO_PENDING) {
-        return;
+        return net::ERR_IO_PENDING;
       }
       if (rv != net::OK) {
         break;
@@ -256,16 +409,12 @@ void BraveRequestHandler::RunNextCallback(
     }
   } else if (ctx->event_type == brave::kOnHeadersReceived) {
     while (headers_received_callbacks_.size() != ctx->next_url_request_index) {
-      brave::OnHeadersReceivedCallback callback =
-          headers_received_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback =
-          base::BindRepeating(&BraveRequestHandler::RunNextCallback,
-                              weak_factory_.GetWeakPtr(), ctx);
-      rv = callback.Run(ctx->original_response_headers,
-                        ctx->override_response_headers,
-                        ctx->allowed_unsafe_redirect_url, next_callback, ctx);
+      rv = RunHelper(headers_received_callbacks_[ctx->next_url_request_index++],
+                     ctx, ctx->original_response_headers.get(),
+                     ctx->override_response_headers.get(),
+                     ctx->allowed_unsafe_redirect_url.get(), next_callback);
       if (rv == net::ERR_IO_PENDING) {
-        return;
+        return net::ERR_IO_PENDING;
       }
       if (rv != net::OK) {
         break;
@@ -274,8 +423,8 @@ void BraveRequestHandler::RunNextCallback(
   }
 
   if (rv != net::OK) {
-    RunCallbackForRequestIdentifier(ctx->request_identifier, rv);
-    return;
+    return CompleteRequest(*ctx, rv,
+                           can_complete_synchronously);
   }
 
   if (ctx->event_type == brave::kOnBeforeRequest) {
@@ -287,11 +436,12 @@ void BraveRequestHandler::RunNextCallback(
     if (ctx->blocked_by == brave::kAdBlocked ||
         ctx->blocked_by == brave::kOtherBlocked) {
       if (!ctx->ShouldMockRequest()) {
-        RunCallbackForRequestIdentifier(ctx->request_identifier,
-                                        net::ERR_BLOCKED_BY_CLIENT);
-        return;
+        return CompleteRequest(*ctx,
+                               net::ERR_BLOCKED_BY_CLIENT,
+                               can_complete_synchronously);
       }
     }
   }
-  RunCallbackForRequestIdentifier(ctx->request_identifier, rv);
+  return CompleteRequest(*ctx, rv,
+                         can_complete_synchronously);
 }
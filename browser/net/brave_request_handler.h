@@ -6,15 +6,21 @@
 #ifndef BRAVE_BROWSER_NET_BRAVE_REQUEST_HANDLER_H_
 #define BRAVE_BROWSER_NET_BRAVE_REQUEST_HANDLER_H_
 
-#include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "base/memory/raw_ptr.h"
 #include "base/memory/scoped_refptr.h"
 #include "brave/browser/net/url_context.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/completion_once_callback.h"
+#include "third_party/abseil-cpp/absl/container/flat_hash_map.h"
+
+namespace base {
+class HistogramBase;
+}  // namespace base
 
 class PrefChangeRegistrar;
 
@@ -29,6 +35,10 @@ class BraveRequestHandler {
 
   bool IsRequestIdentifierValid(uint64_t request_identifier);
 
+  // Returns false when none of the helpers can act on a URL loader request
+  // for `url`, in which case the request does not need to be proxied.
+  bool HasHelpersForURLLoaderRequest(const GURL& url) const;
+
   int OnBeforeURLRequest(std::shared_ptr<brave::BraveRequestInfo> ctx,
                          net::CompletionOnceCallback callback,
                          GURL* new_url);
@@ -47,15 +57,54 @@ class BraveRequestHandler {
   void RunCallbackForRequestIdentifier(uint64_t request_identifier, int rv);
 
  private:
+  // A network delegate helper together with the histogram recording how long
+  // its synchronous part takes. `wall_time_histogram` also covers the time
+  // spent waiting on an asynchronous helper and is only created when
+  // features::kBraveRequestHandlerHelperTiming is enabled.
+  template <typename Callback>
+  struct Helper {
+    std::string name;
+    Callback callback;
+    raw_ptr<base::HistogramBase> latency_histogram;
+    raw_ptr<base::HistogramBase> wall_time_histogram;
+  };
+
   void SetupCallbacks();
+  template <typename Callback>
+  void AddHelper(std::vector<Helper<Callback>>& helpers,
+                 std::string_view stage,
+                 std::string_view name,
+                 Callback callback);
+
+  // Runs a single helper, recording its timing and trace events.
+  template <typename Callback, typename... Args>
+  int RunHelper(const Helper<Callback>& helper,
+                const std::shared_ptr<brave::BraveRequestInfo>& ctx,
+                const Args&... args);
+  // Returns the wall time histogram of the helper `ctx` is waiting on.
+  base::HistogramBase* GetPendingHelperWallTimeHistogram(
+      const brave::BraveRequestInfo& ctx) const;
+
+  // Continuation passed to helpers that complete asynchronously.
   void RunNextCallback(std::shared_ptr<brave::BraveRequestInfo> ctx);
+  // Runs the remaining helpers of the current stage. If they all complete
+  // synchronously and `can_complete_synchronously` is true, the result is
+  // returned directly instead of being posted to the request's callback.
+  int RunHelpers(std::shared_ptr<brave::BraveRequestInfo> ctx,
+                 bool can_complete_synchronously);
+  int CompleteRequest(const brave::BraveRequestInfo& ctx,
+                      int rv,
+                      bool can_complete_synchronously);
 
-  std::vector<brave::OnBeforeURLRequestCallback> before_url_request_callbacks_;
-  std::vector<brave::OnBeforeStartTransactionCallback>
+  std::vector<Helper<brave::OnBeforeURLRequestCallback>>
+      before_url_request_callbacks_;
+  std::vector<Helper<brave::OnBeforeStartTransactionCallback>>
       before_start_transaction_callbacks_;
-  std::vector<brave::OnHeadersReceivedCallback> headers_received_callbacks_;
+  std::vector<Helper<brave::OnHeadersReceivedCallback>>
+      headers_received_callbacks_;
 
-  std::map<uint64_t, net::CompletionOnceCallback> callbacks_;
+  absl::flat_hash_map<uint64_t, net::CompletionOnceCallback> callbacks_;
+  const bool helper_timing_enabled_;
 
   base::WeakPtrFactory<BraveRequestHandler> weak_factory_{this};
 };
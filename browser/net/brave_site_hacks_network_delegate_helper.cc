@@ -72,7 +72,9 @@ int OnBeforeURLRequest_SiteHacksWork(const ResponseCallback& next_callback,
                                      std::shared_ptr<BraveRequestInfo> ctx) {
   ApplyPotentialReferrerBlock(ctx);
 
-  if (ctx->allow_brave_shields &&
+  // Only URLs with a query string can carry tracking parameters, which skips
+  // the filter and its pref lookups for most requests.
+  if (ctx->allow_brave_shields && ctx->request_url.has_query() &&
       IsTrackingQueryParametersFilteringEnabled(ctx)) {
     auto filtered_url = query_filter::MaybeApplyQueryStringFilter(
         ctx->initiator_url, ctx->redirect_source, ctx->request_url, ctx->method,
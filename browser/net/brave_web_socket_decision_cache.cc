@@ -0,0 +1,43 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_web_socket_decision_cache.h"
+
+#include "base/time/tick_clock.h"
+
+namespace {
+
+constexpr size_t kMaxEntries = 64;
+
+}  // namespace
+
+BraveWebSocketDecisionCache::BraveWebSocketDecisionCache(
+    base::TimeDelta ttl,
+    const base::TickClock* tick_clock)
+    : ttl_(ttl), tick_clock_(tick_clock), allowed_(kMaxEntries) {}
+
+BraveWebSocketDecisionCache::~BraveWebSocketDecisionCache() = default;
+
+bool BraveWebSocketDecisionCache::IsAllowed(
+    content::FrameTreeNodeId frame_tree_node_id,
+    const url::Origin& initiator,
+    const GURL& url) {
+  auto it = allowed_.Peek({frame_tree_node_id, initiator, url});
+  if (it == allowed_.end()) {
+    return false;
+  }
+  if (tick_clock_->NowTicks() - it->second >= ttl_) {
+    allowed_.Erase(it);
+    return false;
+  }
+  return true;
+}
+
+void BraveWebSocketDecisionCache::RecordAllowed(
+    content::FrameTreeNodeId frame_tree_node_id,
+    const url::Origin& initiator,
+    const GURL& url) {
+  allowed_.Put({frame_tree_node_id, initiator, url}, tick_clock_->NowTicks());
+}
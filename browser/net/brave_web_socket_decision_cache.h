@@ -0,0 +1,56 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_BRAVE_WEB_SOCKET_DECISION_CACHE_H_
+#define BRAVE_BROWSER_NET_BRAVE_WEB_SOCKET_DECISION_CACHE_H_
+
+#include <tuple>
+
+#include "base/containers/lru_cache.h"
+#include "base/memory/raw_ptr.h"
+#include "base/time/time.h"
+#include "content/public/browser/frame_tree_node_id.h"
+#include "url/gurl.h"
+#include "url/origin.h"
+
+namespace base {
+class TickClock;
+}  // namespace base
+
+// Remembers WebSocket handshakes that passed the OnBeforeURLRequest helpers
+// untouched, so that apps reconnecting to the same endpoint in a loop do not
+// run ad-block matching and the rest of the helper chain every time. Entries
+// are scoped to the frame and its origin, since shields settings depend on
+// the page, and expire after a short TTL so that settings and filter list
+// changes are picked up quickly. Only allowed handshakes are cached; blocked
+// or redirected ones always go through the helpers.
+class BraveWebSocketDecisionCache {
+ public:
+  BraveWebSocketDecisionCache(base::TimeDelta ttl,
+                              const base::TickClock* tick_clock);
+  BraveWebSocketDecisionCache(const BraveWebSocketDecisionCache&) = delete;
+  BraveWebSocketDecisionCache& operator=(const BraveWebSocketDecisionCache&) =
+      delete;
+  ~BraveWebSocketDecisionCache();
+
+  // Returns true if a handshake to `url` from `initiator` in the given frame
+  // was allowed less than the TTL ago.
+  bool IsAllowed(content::FrameTreeNodeId frame_tree_node_id,
+                 const url::Origin& initiator,
+                 const GURL& url);
+  void RecordAllowed(content::FrameTreeNodeId frame_tree_node_id,
+                     const url::Origin& initiator,
+                     const GURL& url);
+
+ private:
+  using Key = std::tuple<content::FrameTreeNodeId, url::Origin, GURL>;
+
+  const base::TimeDelta ttl_;
+  const raw_ptr<const base::TickClock> tick_clock_;
+  // Maps to the time the handshake was allowed.
+  base::LRUCache<Key, base::TimeTicks> allowed_;
+};
+
+#endif  // BRAVE_BROWSER_NET_BRAVE_WEB_SOCKET_DECISION_CACHE_H_
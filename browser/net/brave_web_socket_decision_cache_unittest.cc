@@ -0,0 +1,51 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_web_socket_decision_cache.h"
+
+#include "base/test/simple_test_tick_clock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+#include "url/origin.h"
+
+namespace {
+
+constexpr base::TimeDelta kTtl = base::Seconds(10);
+
+}  // namespace
+
+class BraveWebSocketDecisionCacheTest : public testing::Test {
+ protected:
+  base::SimpleTestTickClock clock_;
+  BraveWebSocketDecisionCache cache_{kTtl, &clock_};
+  const content::FrameTreeNodeId frame_id_{1};
+  const url::Origin origin_ =
+      url::Origin::Create(GURL("https://chat.example.com"));
+  const GURL url_{"wss://ws.example.com/socket"};
+};
+
+TEST_F(BraveWebSocketDecisionCacheTest, AllowedUntilTtlExpires) {
+  EXPECT_FALSE(cache_.IsAllowed(frame_id_, origin_, url_));
+
+  cache_.RecordAllowed(frame_id_, origin_, url_);
+  EXPECT_TRUE(cache_.IsAllowed(frame_id_, origin_, url_));
+
+  clock_.Advance(kTtl - base::Milliseconds(1));
+  EXPECT_TRUE(cache_.IsAllowed(frame_id_, origin_, url_));
+
+  clock_.Advance(base::Milliseconds(1));
+  EXPECT_FALSE(cache_.IsAllowed(frame_id_, origin_, url_));
+}
+
+TEST_F(BraveWebSocketDecisionCacheTest, ScopedToFrameOriginAndUrl) {
+  cache_.RecordAllowed(frame_id_, origin_, url_);
+
+  EXPECT_FALSE(cache_.IsAllowed(content::FrameTreeNodeId(2), origin_, url_));
+  EXPECT_FALSE(cache_.IsAllowed(
+      frame_id_, url::Origin::Create(GURL("https://other.example.com")),
+      url_));
+  EXPECT_FALSE(cache_.IsAllowed(frame_id_, origin_,
+                                GURL("wss://ws.example.com/other")));
+}
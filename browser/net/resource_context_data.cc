@@ -11,10 +11,14 @@
 #include <utility>
 
 #include "base/check.h"
+#include "base/feature_list.h"
 #include "base/memory/scoped_refptr.h"
+#include "base/time/default_tick_clock.h"
+#include "brave/browser/brave_browser_features.h"
 #include "brave/browser/net/brave_proxying_url_loader_factory.h"
 #include "brave/browser/net/brave_proxying_web_socket.h"
 #include "brave/browser/net/brave_request_handler.h"
+#include "brave/browser/net/brave_web_socket_decision_cache.h"
 #include "content/public/browser/browser_context.h"
 #include "net/cookies/site_for_cookies.h"
 
@@ -95,9 +99,19 @@ BraveProxyingWebSocket* ResourceContextData::CreateProxyingWebSocket(
   }
   request.request_initiator = origin;
 
+  if (!self->websocket_decision_cache_ &&
+      base::FeatureList::IsEnabled(
+          features::kBraveWebSocketHandshakeDecisionCache)) {
+    self->websocket_decision_cache_ =
+        std::make_unique<BraveWebSocketDecisionCache>(
+            features::kBraveWebSocketHandshakeDecisionCacheTtl.Get(),
+            base::DefaultTickClock::GetInstance());
+  }
+
   auto proxy = std::make_unique<BraveProxyingWebSocket>(
       std::move(factory), request, frame_tree_node_id, browser_context,
       self->request_id_generator_, *self->request_handler_,
+      self->websocket_decision_cache_.get(),
       base::BindOnce(&ResourceContextData::RemoveProxyWebSocket,
                      self->weak_factory_.GetWeakPtr()));
 
@@ -26,6 +26,7 @@
 class BraveProxyingURLLoaderFactory;
 class BraveProxyingWebSocket;
 class BraveRequestHandler;
+class BraveWebSocketDecisionCache;
 
 namespace content {
 class BrowserContext;
@@ -85,6 +86,8 @@ class ResourceContextData : public base::SupportsUserData::Data {
 
   std::unique_ptr<BraveRequestHandler> request_handler_;
   scoped_refptr<RequestIDGenerator> request_id_generator_;
+  // Only set when features::kBraveWebSocketHandshakeDecisionCache is enabled.
+  std::unique_ptr<BraveWebSocketDecisionCache> websocket_decision_cache_;
 
   std::set<std::unique_ptr<BraveProxyingURLLoaderFactory>,
            base::UniquePtrComparator>
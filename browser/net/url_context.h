@@ -13,6 +13,7 @@
 
 #include "base/memory/raw_ptr.h"
 #include "base/memory/scoped_refptr.h"
+#include "base/time/time.h"
 #include "content/public/browser/frame_tree_node_id.h"
 #include "net/base/network_anonymization_key.h"
 #include "net/http/http_request_headers.h"
@@ -90,6 +91,13 @@ struct BraveRequestInfo {
   content::FrameTreeNodeId frame_tree_node_id;
   uint64_t request_identifier = 0;
   size_t next_url_request_index = 0;
+  // Helper timing bookkeeping, only used by BraveRequestHandler when
+  // features::kBraveRequestHandlerHelperTiming is enabled.
+  base::TimeTicks pending_helper_start;
+  int async_helper_hops = 0;
+  // Time spent in ad-block rule matching for this request that has not yet
+  // been reported to the per-page Shields cost accounting.
+  base::TimeDelta adblock_match_time;
 
   raw_ptr<content::BrowserContext, DanglingUntriaged> browser_context = nullptr;
   raw_ptr<net::HttpRequestHeaders> headers = nullptr;
@@ -5,7 +5,13 @@
 
 #include "brave/browser/perf/brave_perf_features_processor.h"
 
+#include <string>
+#include <string_view>
+#include <vector>
+
 #include "base/command_line.h"
+#include "base/containers/contains.h"
+#include "base/strings/string_split.h"
 #include "base/task/sequenced_task_runner.h"
 #include "brave/browser/brave_browser_process.h"
 #include "brave/browser/brave_rewards/rewards_service_factory.h"
@@ -30,6 +36,29 @@
 #endif
 
 namespace {
+
+constexpr char kAdsFeature[] = "ads";
+constexpr char kNewsFeature[] = "news";
+constexpr char kSpeedreaderFeature[] = "speedreader";
+constexpr char kAIChatFeature[] = "ai_chat";
+constexpr char kRewardsFeature[] = "rewards";
+constexpr char kCookieListFeature[] = "cookie_list";
+
+// Whether |feature| should be enabled for this perf run. An empty switch value
+// means every feature.
+bool IsFeatureRequested(const base::CommandLine& cmd,
+                        std::string_view feature) {
+  const std::string value = cmd.GetSwitchValueASCII(
+      perf::switches::kEnableBraveFeaturesForPerfTesting);
+  if (value.empty()) {
+    return true;
+  }
+  return base::Contains(
+      base::SplitStringPiece(value, ",", base::TRIM_WHITESPACE,
+                             base::SPLIT_WANT_NONEMPTY),
+      feature);
+}
+
 void FakeCallback(brave_rewards::mojom::CreateRewardsWalletResult) {}
 
 void EnableAdblockCookieList(base::WeakPtr<Profile> profile) {
@@ -65,26 +94,35 @@ void MaybeEnableBraveFeaturesPrefsForPerfTesting(Profile* profile) {
   }
 
   // Notification Ads
-  profile->GetPrefs()->SetBoolean(brave_ads::prefs::kOptedInToNotificationAds,
-                                  true);
+  if (IsFeatureRequested(*cmd, kAdsFeature)) {
+    profile->GetPrefs()->SetBoolean(
+        brave_ads::prefs::kOptedInToNotificationAds, true);
+  }
 
   // Brave news
-  profile->GetPrefs()->SetBoolean(brave_news::prefs::kNewTabPageShowToday,
-                                  true);
-  profile->GetPrefs()->SetBoolean(brave_news::prefs::kBraveNewsOptedIn, true);
+  if (IsFeatureRequested(*cmd, kNewsFeature)) {
+    profile->GetPrefs()->SetBoolean(brave_news::prefs::kNewTabPageShowToday,
+                                    true);
+    profile->GetPrefs()->SetBoolean(brave_news::prefs::kBraveNewsOptedIn,
+                                    true);
+  }
 
 #if BUILDFLAG(ENABLE_SPEEDREADER)
   // Speedreader - enable both the feature toggle and all-sites setting
-  profile->GetPrefs()->SetBoolean(speedreader::kSpeedreaderEnabled, true);
-  profile->GetPrefs()->SetBoolean(
-      speedreader::kSpeedreaderAllowedForAllReadableSites, true);
+  if (IsFeatureRequested(*cmd, kSpeedreaderFeature)) {
+    profile->GetPrefs()->SetBoolean(speedreader::kSpeedreaderEnabled, true);
+    profile->GetPrefs()->SetBoolean(
+        speedreader::kSpeedreaderAllowedForAllReadableSites, true);
+  }
 #endif
 
 #if BUILDFLAG(ENABLE_AI_CHAT)
-  profile->GetPrefs()->SetTime(ai_chat::prefs::kLastAcceptedDisclaimer,
-                               base::Time::Now());
-  profile->GetPrefs()->SetBoolean(
-      ai_chat::prefs::kBraveChatAutocompleteProviderEnabled, true);
+  if (IsFeatureRequested(*cmd, kAIChatFeature)) {
+    profile->GetPrefs()->SetTime(ai_chat::prefs::kLastAcceptedDisclaimer,
+                                 base::Time::Now());
+    profile->GetPrefs()->SetBoolean(
+        ai_chat::prefs::kBraveChatAutocompleteProviderEnabled, true);
+  }
 #endif
 }
 
@@ -97,12 +135,16 @@ void MaybeEnableBraveFeaturesServicesAndComponentsForPerfTesting(
   }
 
   // Rewards
-  auto* rewards_service =
-      brave_rewards::RewardsServiceFactory::GetForProfile(profile);
-  rewards_service->CreateRewardsWallet("US", base::BindOnce(&FakeCallback));
+  if (IsFeatureRequested(*cmd, kRewardsFeature)) {
+    auto* rewards_service =
+        brave_rewards::RewardsServiceFactory::GetForProfile(profile);
+    rewards_service->CreateRewardsWallet("US", base::BindOnce(&FakeCallback));
+  }
 
   // Adblock
-  EnableAdblockCookieList(profile->GetWeakPtr());
+  if (IsFeatureRequested(*cmd, kCookieListFeature)) {
+    EnableAdblockCookieList(profile->GetWeakPtr());
+  }
 }
 
 }  // namespace perf
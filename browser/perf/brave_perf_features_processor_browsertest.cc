@@ -105,3 +105,26 @@ IN_PROC_BROWSER_TEST_F(BraveSpeedFeatureProcessorBrowserTest, Default) {
   EXPECT_TRUE(ai_chat::HasUserOptedIn(prefs));
 #endif
 }
+
+// Only the features named in the switch value are enabled.
+class BraveSpeedFeatureProcessorSingleFeatureBrowserTest
+    : public BraveSpeedFeatureProcessorBrowserTest {
+ protected:
+  void SetUpCommandLine(base::CommandLine* command_line) override {
+    InProcessBrowserTest::SetUpCommandLine(command_line);
+    command_line->AppendSwitchASCII(
+        perf::switches::kEnableBraveFeaturesForPerfTesting, "news");
+  }
+};
+
+IN_PROC_BROWSER_TEST_F(BraveSpeedFeatureProcessorSingleFeatureBrowserTest,
+                       OnlyRequestedFeature) {
+  EXPECT_TRUE(BraveNewsAreEnabled());
+  EXPECT_FALSE(HasOptedInToNotificationAds());
+#if BUILDFLAG(ENABLE_SPEEDREADER)
+  EXPECT_FALSE(SpeedreaderIsEnabled());
+#endif
+#if BUILDFLAG(ENABLE_AI_CHAT)
+  EXPECT_FALSE(ai_chat::HasUserOptedIn(browser()->profile()->GetPrefs()));
+#endif
+}
@@ -56,6 +56,13 @@ class RefCountedMemMap : public base::RefCountedMemory {
     initialized_ = memory_mapped_file_.Initialize(std::move(file));
   }
 
+  // Maps only |region| of |file|. Range requests are then served straight
+  // from the page cache instead of being read into a heap buffer first.
+  RefCountedMemMap(base::File file,
+                   const base::MemoryMappedFile::Region& region) {
+    initialized_ = memory_mapped_file_.Initialize(std::move(file), region);
+  }
+
   bool initialized() const { return initialized_; }
 
  private:
@@ -120,17 +127,30 @@ content::URLDataSource::RangeDataResult ReadFileRange(
                                last_byte_position - first_byte_position + 1);
   CHECK_GE(read_size, 0);
 
-  std::vector<unsigned char> buffer(read_size);
-  auto read_result = file.Read(first_byte_position, buffer);
-  if (!read_result.has_value()) {
-    return {};
+  content::URLDataSource::RangeDataResult result;
+  read_size = std::min(read_size, file_length - first_byte_position);
+  if (read_size > 0) {
+    auto mapped_range = base::MakeRefCounted<RefCountedMemMap>(
+        file.Duplicate(),
+        base::MemoryMappedFile::Region{
+            first_byte_position, static_cast<size_t>(read_size)});
+    if (mapped_range->initialized()) {
+      result.buffer = std::move(mapped_range);
+    }
+  }
+
+  if (!result.buffer) {
+    std::vector<unsigned char> buffer(std::max<int64_t>(read_size, 0));
+    auto read_result = file.Read(first_byte_position, buffer);
+    if (!read_result.has_value()) {
+      return {};
+    }
+    read_size = read_result.value();
+    buffer.resize(read_size);
+    result.buffer =
+        base::MakeRefCounted<base::RefCountedBytes>(std::move(buffer));
   }
-  read_size = read_result.value();
-  buffer.resize(read_size);
 
-  content::URLDataSource::RangeDataResult result;
-  result.buffer =
-      base::MakeRefCounted<base::RefCountedBytes>(std::move(buffer));
   result.file_size = file_length;
   result.range = net::HttpByteRange::Bounded(
       first_byte_position, first_byte_position + read_size - 1);
@@ -34,8 +34,11 @@
 #include "components/sessions/content/session_tab_helper.h"
 #include "ipc/constants.mojom.h"
 #include "services/data_decoder/public/cpp/decode_image.h"
+#include "skia/ext/image_operations.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "ui/gfx/codec/png_codec.h"
+#include "ui/gfx/geometry/size.h"
+#include "ui/gfx/geometry/size_conversions.h"
 #include "ui/gfx/image/image.h"
 
 #if BUILDFLAG(IS_ANDROID)
@@ -174,7 +177,23 @@ class PlaylistServiceDelegateImpl : public PlaylistService::Delegate {
       base::OnceCallback<void(scoped_refptr<base::RefCountedBytes>)> callback,
       const gfx::Image& decoded_image) {
     auto encode = base::BindOnce(
-        [](const SkBitmap& bitmap) {
+        [](SkBitmap bitmap) {
+          // Scale down large thumbnails here, off the UI thread, so that the
+          // UI only ever decodes images of about the size it draws them at.
+          if (const int max_dimension =
+                  features::kPlaylistThumbnailMaxDimension.Get();
+              max_dimension > 0 && !bitmap.drawsNothing() &&
+              std::max(bitmap.width(), bitmap.height()) > max_dimension) {
+            const gfx::Size target_size = gfx::ScaleToFlooredSize(
+                gfx::Size(bitmap.width(), bitmap.height()),
+                static_cast<float>(max_dimension) /
+                    std::max(bitmap.width(), bitmap.height()));
+            bitmap = skia::ImageOperations::Resize(
+                bitmap, skia::ImageOperations::RESIZE_GOOD,
+                std::max(target_size.width(), 1),
+                std::max(target_size.height(), 1));
+          }
+
           auto encoded = base::MakeRefCounted<base::RefCountedBytes>();
           if (auto result = gfx::PNGCodec::EncodeBGRASkBitmap(
                   bitmap,
@@ -20,6 +20,7 @@
 #include "brave/components/global_privacy_control/pref_names.h"
 #include "brave/components/ipfs/buildflags/buildflags.h"
 #include "brave/components/p3a/pref_names.h"
+#include "brave/components/performance_profile/pref_names.h"
 #include "brave/components/playlist/core/common/pref_names.h"
 #include "brave/components/query_filter/pref_names.h"
 #include "brave/components/speedreader/common/buildflags/buildflags.h"
@@ -121,6 +122,9 @@ inline constexpr PolicyToPreferenceMapEntry kBraveSimplePolicyMap[] = {
     {policy::key::kBraveGlobalPrivacyControlEnabled,
      global_privacy_control::kGlobalPrivacyControlEnabled,
      base::Value::Type::BOOLEAN},
+    {policy::key::kBravePerformanceProfileEnabled,
+     performance_profile::kPerformanceProfileEnabled,
+     base::Value::Type::BOOLEAN},
 };
 
 }  // namespace policy
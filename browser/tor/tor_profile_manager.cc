@@ -10,8 +10,10 @@
 
 #include "base/check.h"
 #include "base/feature_list.h"
+#include "base/functional/bind.h"
 #include "brave/browser/tor/tor_profile_service_factory.h"
 #include "brave/components/constants/pref_names.h"
+#include "brave/components/tor/features.h"
 #include "brave/components/tor/tor_constants.h"
 #include "brave/components/tor/tor_launcher_factory.h"
 #include "brave/components/tor/tor_launcher_observer.h"
@@ -235,6 +237,50 @@ void TorProfileManager::CloseAllTorWindows() {
   }
 }
 
+void TorProfileManager::PrewarmTor(Profile* original_profile) {
+  if (!base::FeatureList::IsEnabled(tor::features::kBraveTorPrewarm)) {
+    return;
+  }
+
+  if (prewarm_timer_.IsRunning() ||
+      TorLauncherFactory::GetInstance()->GetTorPid() >= 0) {
+    return;
+  }
+
+  Profile* tor_profile = GetTorProfile(original_profile);
+  if (!tor_profile) {
+    return;
+  }
+
+  prewarm_timer_.Start(
+      FROM_HERE, tor::features::kBraveTorPrewarmTimeout.Get(),
+      base::BindOnce(&TorProfileManager::OnPrewarmTimeout,
+                     base::Unretained(this), tor_profile->UniqueId()));
+}
+
+void TorProfileManager::OnPrewarmTimeout(const std::string& context_id) {
+  auto it = tor_profiles_.find(context_id);
+  if (it == tor_profiles_.end()) {
+    return;
+  }
+
+  Profile* tor_profile = it->second;
+  if (chrome::FindBrowserWithProfile(tor_profile)) {
+    // A Tor window was opened, it now owns the Tor process.
+    return;
+  }
+
+  // Forget the profile so that the next GetTorProfile() registers the Tor
+  // client updater again, which is what launches Tor.
+  tor_profiles_.erase(it);
+  tor_profile->RemoveObserver(this);
+
+  tor::TorProfileService* service =
+      TorProfileServiceFactory::GetForContext(tor_profile);
+  DCHECK(service);
+  service->KillTor();
+}
+
 void TorProfileManager::OnProfileWillBeDestroyed(Profile* profile) {
   const std::string context_id = profile->UniqueId();
   tor_profiles_.erase(context_id);
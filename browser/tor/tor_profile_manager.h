@@ -11,6 +11,7 @@
 
 #include "base/containers/flat_map.h"
 #include "base/no_destructor.h"
+#include "base/timer/timer.h"
 #include "chrome/browser/profiles/profile_observer.h"
 #include "url/gurl.h"
 
@@ -28,6 +29,11 @@ class TorProfileManager : public ProfileObserver {
   // Close all Tor windows for all tor profiles
   void CloseAllTorWindows();
 
+  // Starts Tor for `original_profile` without opening a window, if
+  // `tor::features::kBraveTorPrewarm` is enabled. Tor is stopped again if no
+  // Tor window has been opened when the prewarm timeout expires.
+  void PrewarmTor(Profile* original_profile);
+
  private:
   friend class base::NoDestructor<TorProfileManager>;
   TorProfileManager();
@@ -38,9 +44,12 @@ class TorProfileManager : public ProfileObserver {
 
   void InitTorProfileUserPrefs(Profile* profile);
 
+  void OnPrewarmTimeout(const std::string& context_id);
+
   // One regular profile can only have one tor profile
   base::flat_map<std::string, Profile*> tor_profiles_;
   std::unique_ptr<BrowserListObserver> browser_list_observer_;
+  base::OneShotTimer prewarm_timer_;
 
   TorProfileManager(const TorProfileManager&) = delete;
   TorProfileManager& operator=(const TorProfileManager&) = delete;
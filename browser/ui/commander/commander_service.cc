@@ -198,9 +198,16 @@ void CommanderService::UpdateText(const std::u16string& text, bool force) {
     return;
   }
 
+  // Without the prefix, commands are only shown as omnibox suggestions, so
+  // don't query the command sources on every keystroke if those are off.
   auto has_prefix = text.starts_with(kCommandPrefix);
-  if (!has_prefix && !browser->profile()->GetPrefs()->GetBoolean(
-                         omnibox::kCommanderSuggestionsEnabled)) {
+  if (!has_prefix &&
+      (!base::FeatureList::IsEnabled(features::kBraveCommandsInOmnibox) ||
+       !browser->profile()->GetPrefs()->GetBoolean(
+           omnibox::kCommanderSuggestionsEnabled))) {
+    // The current results no longer match the omnibox text, so make sure the
+    // next query is treated as changed.
+    last_searched_.clear();
     return;
   }
 
@@ -37,6 +37,27 @@ constexpr size_t kMaxHaystack = 1024;
 // Needles longer than this are scored by ConsecutiveMatchWithGaps
 constexpr size_t kMaxNeedle = 16;
 
+// Returns a bitmask with the bit `c % 64` set for every code unit `c` in
+// `str`. Any match needs every code unit of the needle to be present in the
+// haystack, so a needle bit that is missing from the haystack mask rules out
+// a match without scanning.
+uint64_t CodeUnitMask(const std::u16string& str) {
+  uint64_t mask = 0;
+  for (char16_t c : str) {
+    mask |= uint64_t{1} << (c & 63);
+  }
+  return mask;
+}
+
+// Case folding ASCII is the same as lowercasing it, which avoids a trip
+// through ICU for the common case.
+std::u16string FoldCase(const std::u16string& str) {
+  if (base::IsStringASCII(str)) {
+    return base::ToLowerASCII(str);
+  }
+  return base::i18n::FoldCase(str);
+}
+
 struct MatchRecord {
   MatchRecord(int start, int end, int length, bool is_boundary, int gap_before)
       : range(start, end),
@@ -235,7 +256,7 @@ int ScoreForMatrix(base::span<int> score_matrix,
 namespace commander {
 
 FuzzyFinder::FuzzyFinder(const std::u16string& needle)
-    : needle_(base::i18n::FoldCase(needle)) {
+    : needle_(FoldCase(needle)), needle_mask_(CodeUnitMask(needle_)) {
   if (needle_.size() <= kMaxNeedle) {
     score_matrix_.reserve(needle_.size() * kMaxHaystack);
     consecutive_matrix_.reserve(needle_.size() * kMaxHaystack);
@@ -247,7 +268,7 @@ FuzzyFinder::~FuzzyFinder() = default;
 double FuzzyFinder::Find(const std::u16string& haystack,
                          std::vector<gfx::Range>& matched_ranges) {
   matched_ranges.clear();
-  const std::u16string& folded = base::i18n::FoldCase(haystack);
+  const std::u16string& folded = FoldCase(haystack);
   size_t m = needle_.size();
   size_t n = folded.size();
   // Special case 0: M > N. We don't allow skipping anything in |needle|, so
@@ -255,6 +276,10 @@ double FuzzyFinder::Find(const std::u16string& haystack,
   if (m > n) {
     return 0;
   }
+  // Special case 0.5: some code unit of |needle| is absent from |haystack|.
+  if (needle_mask_ & ~CodeUnitMask(folded)) {
+    return 0;
+  }
   // Special case 1: M == N. It must be either an exact match,
   // or a non-match.
   if (m == n) {
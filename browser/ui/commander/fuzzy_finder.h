@@ -11,6 +11,7 @@
 #ifndef BRAVE_BROWSER_UI_COMMANDER_FUZZY_FINDER_H_
 #define BRAVE_BROWSER_UI_COMMANDER_FUZZY_FINDER_H_
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -47,6 +48,9 @@ class FuzzyFinder {
                      std::vector<gfx::Range>& matched_ranges);
   // Case-folded input string.
   std::u16string needle_;
+  // Bitmask of the code units in `needle_`, used to quickly reject haystacks
+  // that cannot match. See CodeUnitMask().
+  uint64_t needle_mask_;
   // Scratch space for MatrixMatch().
   std::vector<int> score_matrix_;
   std::vector<int> consecutive_matrix_;
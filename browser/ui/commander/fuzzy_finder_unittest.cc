@@ -79,6 +79,14 @@ TEST(CommanderFuzzyFinder, CaseInsensitive) {
   EXPECT_EQ(ranges, std::vector<gfx::Range>({{0, 6}}));
 }
 
+TEST(CommanderFuzzyFinder, CaseInsensitiveNonASCII) {
+  std::vector<gfx::Range> ranges;
+  EXPECT_EQ(1, FuzzyFind(u"ÉCOLE", u"école", ranges));
+  EXPECT_EQ(ranges, std::vector<gfx::Range>({{0, 5}}));
+  EXPECT_EQ(0, FuzzyFind(u"ÉCOLE", u"ecole", ranges));
+  EXPECT_TRUE(ranges.empty());
+}
+
 TEST(CommanderFuzzyFinder, PrefixRanksHigherThanInternal) {
   std::vector<gfx::Range> ranges;
   FuzzyFinder finder(u"orange");
@@ -9,11 +9,13 @@
 #include <memory>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "base/check.h"
 #include "base/check_is_test.h"
 #include "base/check_op.h"
 #include "base/containers/flat_map.h"
+#include "base/containers/flat_set.h"
 #include "base/feature_list.h"
 #include "brave/browser/ui/color/brave_color_id.h"
 #include "brave/browser/ui/tabs/brave_tab_prefs.h"
@@ -290,22 +292,23 @@ void BraveTabContainer::PaintBoundingBoxForSplitTabs(gfx::Canvas& canvas) {
   auto* tab_strip_model = tab_slot_controller_->GetBrowser()->tab_strip_model();
   const int offset =
       IsPinnedTabContainer() ? 0 : tab_strip_model->IndexOfFirstNonPinnedTab();
-  // Cache unique ids to avoid paiting same split tab twice.
-  base::flat_set<split_tabs::SplitTabId> split_tab_ids;
+  // Cache unique ids to avoid paiting same split tab twice. Split data is only
+  // listed once per split below, as this runs on every paint and the strip can
+  // hold thousands of tabs in vertical mode.
+  std::vector<split_tabs::SplitTabId> split_tab_ids;
   for (int i = 0; i < GetTabCount(); ++i) {
     Tab* tab = GetTabAtModelIndex(i);
-    if (!tab->split().has_value()) {
-      continue;
+    if (tab->split().has_value()) {
+      split_tab_ids.push_back(*tab->split());
     }
-    auto tabs = tab_strip_model->GetSplitData(*tab->split())->ListTabs();
-    if (tabs.empty()) {
-      continue;
-    }
-    split_tab_ids.insert(*tab->split());
   }
 
-  for (const auto& id : split_tab_ids) {
+  for (const auto& id : base::flat_set<split_tabs::SplitTabId>(
+           std::move(split_tab_ids))) {
     auto tabs = tab_strip_model->GetSplitData(id)->ListTabs();
+    if (tabs.empty()) {
+      continue;
+    }
     CHECK(tabs.size() == 2);
     PaintBoundingBoxForSplitTab(
         canvas, {tab_strip_model->GetIndexOfTab(tabs[0]) - offset,
@@ -483,7 +486,11 @@ std::optional<BrowserRootView::DropIndex> BraveTabContainer::GetDropIndex(
   }
 
   // Force animations to stop, otherwise it makes the index calculation tricky.
-  CompleteAnimationAndLayout();
+  // This is called for every drag update, so skip the full relayout of all
+  // children when nothing is animating and the bounds are already final.
+  if (bounds_animator_.IsAnimating()) {
+    CompleteAnimationAndLayout();
+  }
 
   const int x = GetMirroredXInView(event.x());
   const int y = event.y();
@@ -7,10 +7,12 @@
 
 #include <memory>
 
+#include "base/feature_list.h"
 #include "base/functional/bind.h"
 #include "brave/browser/ui/tabs/brave_tab_prefs.h"
 #include "chrome/browser/profiles/profile.h"
 #include "chrome/browser/ui/browser.h"
+#include "chrome/browser/ui/tabs/features.h"
 #include "chrome/browser/ui/views/tabs/tab.h"
 #include "chrome/browser/ui/views/tabs/tab_hover_card_bubble_view.h"
 #include "chrome/browser/ui/views/tabs/tab_hover_card_controller.h"
@@ -46,12 +48,62 @@ void BraveTabHoverCardController::CreateHoverCard(Tab* tab) {
   UpdateHoverCardArrow();
 }
 
+void BraveTabHoverCardController::MaybeStartThumbnailObservation(
+    Tab* tab,
+    bool is_initial_show) {
+  if (!base::FeatureList::IsEnabled(tabs::kBraveHoverCardThumbnailThrottle) ||
+      is_initial_show || !thumbnail_observer_) {
+    thumbnail_throttle_timer_.Stop();
+    last_thumbnail_observation_time_ = base::TimeTicks::Now();
+    TabHoverCardController::MaybeStartThumbnailObservation(tab,
+                                                           is_initial_show);
+    return;
+  }
+
+  const base::TimeDelta interval =
+      tabs::kBraveHoverCardThumbnailThrottleInterval.Get();
+  const base::TimeDelta elapsed =
+      base::TimeTicks::Now() - last_thumbnail_observation_time_;
+  if (elapsed >= interval) {
+    thumbnail_throttle_timer_.Stop();
+    last_thumbnail_observation_time_ = base::TimeTicks::Now();
+    TabHoverCardController::MaybeStartThumbnailObservation(tab,
+                                                           is_initial_show);
+    return;
+  }
+
+  // Don't keep showing the preview of the previous tab while waiting.
+  if (hover_card_) {
+    hover_card_->SetPlaceholderImage();
+  }
+  thumbnail_observer_->Observe(nullptr);
+
+  // Restarting the timer drops the request for any tab the pointer has
+  // already left; the target tab is picked up again when it fires.
+  thumbnail_throttle_timer_.Start(
+      FROM_HERE, interval - elapsed,
+      base::BindOnce(
+          &BraveTabHoverCardController::OnThumbnailThrottleTimerFired,
+          base::Unretained(this)));
+}
+
+void BraveTabHoverCardController::OnThumbnailThrottleTimerFired() {
+  if (!hover_card_ || !target_tab_) {
+    return;
+  }
+
+  last_thumbnail_observation_time_ = base::TimeTicks::Now();
+  TabHoverCardController::MaybeStartThumbnailObservation(
+      target_tab_, /*is_initial_show=*/false);
+}
+
 void BraveTabHoverCardController::OnHovercardImagesEnabledChanged() {
   hover_card_image_previews_enabled_ =
       AreHoverCardImagesEnabled() ||
       brave_tabs::AreCardPreviewsEnabled(
           tab_strip_->GetBrowser()->profile()->GetPrefs());
   if (!hover_card_image_previews_enabled_) {
+    thumbnail_throttle_timer_.Stop();
     thumbnail_subscription_ = base::CallbackListSubscription();
     thumbnail_observer_.reset();
   }
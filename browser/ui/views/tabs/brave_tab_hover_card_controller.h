@@ -6,6 +6,8 @@
 #ifndef BRAVE_BROWSER_UI_VIEWS_TABS_BRAVE_TAB_HOVER_CARD_CONTROLLER_H_
 #define BRAVE_BROWSER_UI_VIEWS_TABS_BRAVE_TAB_HOVER_CARD_CONTROLLER_H_
 
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "chrome/browser/ui/views/tabs/tab_hover_card_controller.h"
 
 class Tab;
@@ -24,8 +26,17 @@ class BraveTabHoverCardController : public TabHoverCardController {
 
   // TabHoverCardController:
   void CreateHoverCard(Tab* tab) override;
+  void MaybeStartThumbnailObservation(Tab* tab, bool is_initial_show) override;
 
   bool is_vertical_tabs_ = false;
+
+ private:
+  void OnThumbnailThrottleTimerFired();
+
+  // While the pointer sweeps across tabs, preview requests for each tab are
+  // coalesced so that only the tab it settles on asks for a thumbnail.
+  base::TimeTicks last_thumbnail_observation_time_;
+  base::OneShotTimer thumbnail_throttle_timer_;
 };
 
 #endif  // BRAVE_BROWSER_UI_VIEWS_TABS_BRAVE_TAB_HOVER_CARD_CONTROLLER_H_
@@ -5,8 +5,11 @@
 
 #include "brave/browser/ui/views/tabs/brave_tab_strip_layout_helper.h"
 
+#include <algorithm>
+#include <iterator>
 #include <limits>
 #include <optional>
+#include <utility>
 
 #include "base/check.h"
 #include "base/check_op.h"
@@ -70,6 +73,42 @@ void CalculatePinnedTabsBoundsInGrid(
   }
 }
 
+// Appends bounds for |tabs| from |result->size()|, continuing from the last
+// rect in |result| if any.
+void LayOutTabsVertically(const std::vector<TabWidthConstraints>& tabs,
+                          std::optional<int> width,
+                          std::vector<gfx::Rect>* result) {
+  DCHECK(result);
+  DCHECK_LE(result->size(), tabs.size());
+
+  gfx::Rect rect;
+  if (result->empty()) {
+    rect.set_y(kMarginForVerticalTabContainers);
+  } else {
+    const bool is_last_open =
+        tabs[result->size() - 1].state().open() == TabOpen::kOpen;
+    rect.set_y(is_last_open ? result->back().bottom() + kVerticalTabsSpacing
+                            : result->back().y());
+  }
+
+  result->reserve(tabs.size());
+  for (auto iter = tabs.begin() + result->size(); iter != tabs.end(); iter++) {
+    auto& tab = *iter;
+    rect.set_x(
+        kMarginForVerticalTabContainers +
+        (tab.is_tab_in_group() ? BraveTabGroupHeader::kPaddingForGroup : 0));
+    rect.set_width(width.value_or(tab.GetPreferredWidth()) - rect.x() * 2);
+    rect.set_height(tab.state().open() == TabOpen::kOpen ? kVerticalTabHeight
+                                                         : 0);
+    result->push_back(rect);
+
+    // Update rect for the next tab.
+    if (tab.state().open() == TabOpen::kOpen) {
+      rect.set_y(rect.bottom() + kVerticalTabsSpacing);
+    }
+  }
+}
+
 void CalculateVerticalLayout(const std::vector<TabWidthConstraints>& tabs,
                              std::optional<int> width,
                              std::vector<gfx::Rect>* result) {
@@ -91,23 +130,7 @@ void CalculateVerticalLayout(const std::vector<TabWidthConstraints>& tabs,
     return;
   }
 
-  gfx::Rect rect;
-  rect.set_y(kMarginForVerticalTabContainers);
-  for (auto iter = tabs.begin() + result->size(); iter != tabs.end(); iter++) {
-    auto& tab = *iter;
-    rect.set_x(
-        kMarginForVerticalTabContainers +
-        (tab.is_tab_in_group() ? BraveTabGroupHeader::kPaddingForGroup : 0));
-    rect.set_width(width.value_or(tab.GetPreferredWidth()) - rect.x() * 2);
-    rect.set_height(tab.state().open() == TabOpen::kOpen ? kVerticalTabHeight
-                                                         : 0);
-    result->push_back(rect);
-
-    // Update rect for the next tab.
-    if (tab.state().open() == TabOpen::kOpen) {
-      rect.set_y(rect.bottom() + kVerticalTabsSpacing);
-    }
-  }
+  LayOutTabsVertically(tabs, width, result);
 }
 
 }  // namespace
@@ -136,7 +159,57 @@ std::pair<std::vector<gfx::Rect>, LayoutDomain> CalculateVerticalTabBounds(
   CalculateVerticalLayout(tabs, width, &bounds);
 
   DCHECK_EQ(tabs.size(), bounds.size());
-  return {bounds, LayoutDomain::kInactiveWidthEqualsActiveWidth};
+  return {std::move(bounds), LayoutDomain::kInactiveWidthEqualsActiveWidth};
+}
+
+VerticalTabBoundsCache::VerticalTabBoundsCache() = default;
+
+VerticalTabBoundsCache::~VerticalTabBoundsCache() = default;
+
+std::pair<std::vector<gfx::Rect>, LayoutDomain>
+VerticalTabBoundsCache::Calculate(const std::vector<TabWidthConstraints>& tabs,
+                                  std::optional<int> width,
+                                  bool is_floating_mode) {
+  if (tabs.empty() || (!is_floating_mode && tabs.front().state().pinned() ==
+                                                TabPinned::kPinned)) {
+    // Pinned tabs are laid out in a grid and there are only a few of them, so
+    // don't bother caching them.
+    Reset();
+    return CalculateVerticalTabBounds(tabs, width, is_floating_mode);
+  }
+
+  std::vector<SlotKey> keys;
+  keys.reserve(tabs.size());
+  for (const auto& tab : tabs) {
+    keys.push_back({.open = tab.state().open(),
+                    .pinned = tab.state().pinned(),
+                    .in_group = tab.is_tab_in_group(),
+                    .width = width.value_or(tab.GetPreferredWidth())});
+  }
+
+  size_t first_changed_index = 0;
+  if (is_floating_mode == is_floating_mode_) {
+    first_changed_index =
+        std::distance(keys.begin(), std::ranges::mismatch(keys, keys_).in1);
+  }
+
+  // Slots before the first changed one keep their bounds. The rest are shifted
+  // by laying them out again, continuing from the last kept rect.
+  bounds_.resize(first_changed_index);
+  LayOutTabsVertically(tabs, width, &bounds_);
+
+  keys_ = std::move(keys);
+  is_floating_mode_ = is_floating_mode;
+  first_recomputed_index_ = first_changed_index;
+
+  DCHECK_EQ(tabs.size(), bounds_.size());
+  return {bounds_, LayoutDomain::kInactiveWidthEqualsActiveWidth};
+}
+
+void VerticalTabBoundsCache::Reset() {
+  keys_.clear();
+  bounds_.clear();
+  first_recomputed_index_ = 0;
 }
 
 std::vector<gfx::Rect> CalculateBoundsForVerticalDraggedViews(
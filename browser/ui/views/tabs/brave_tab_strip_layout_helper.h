@@ -10,11 +10,9 @@
 #include <utility>
 #include <vector>
 
+#include "chrome/browser/ui/tabs/tab_types.h"
 #include "chrome/browser/ui/views/tabs/tab_strip_layout_types.h"
-
-namespace gfx {
-class Rect;
-}  // namespace gfx
+#include "ui/gfx/geometry/rect.h"
 
 class Tab;
 class TabStripLayoutHelper;
@@ -38,6 +36,45 @@ std::pair<std::vector<gfx::Rect>, LayoutDomain> CalculateVerticalTabBounds(
     std::optional<int> width,
     bool is_floating_mode);
 
+// Keeps the result of the last vertical layout so that a single mutation in a
+// long strip, e.g. inserting a tab or moving it into a group, only lays out
+// the slots from the first changed one onward.
+class VerticalTabBoundsCache {
+ public:
+  VerticalTabBoundsCache();
+  VerticalTabBoundsCache(const VerticalTabBoundsCache&) = delete;
+  VerticalTabBoundsCache& operator=(const VerticalTabBoundsCache&) = delete;
+  ~VerticalTabBoundsCache();
+
+  // Same as CalculateVerticalTabBounds().
+  std::pair<std::vector<gfx::Rect>, LayoutDomain> Calculate(
+      const std::vector<TabWidthConstraints>& tabs,
+      std::optional<int> width,
+      bool is_floating_mode);
+
+  size_t first_recomputed_index_for_testing() const {
+    return first_recomputed_index_;
+  }
+
+ private:
+  // Inputs that affect the bounds of a slot.
+  struct SlotKey {
+    TabOpen open;
+    TabPinned pinned;
+    bool in_group;
+    int width;
+
+    bool operator==(const SlotKey&) const = default;
+  };
+
+  void Reset();
+
+  std::vector<SlotKey> keys_;
+  std::vector<gfx::Rect> bounds_;
+  bool is_floating_mode_ = false;
+  size_t first_recomputed_index_ = 0;
+};
+
 std::vector<gfx::Rect> CalculateBoundsForVerticalDraggedViews(
     const std::vector<TabSlotView*>& views,
     TabStrip* tab_strip);
@@ -0,0 +1,77 @@
+// Copyright (c) 2026 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "brave/browser/ui/views/tabs/brave_tab_strip_layout_helper.h"
+
+#include <vector>
+
+#include "chrome/browser/ui/tabs/tab_types.h"
+#include "chrome/browser/ui/views/tabs/tab_strip_layout.h"
+#include "chrome/browser/ui/views/tabs/tab_width_constraints.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/rect.h"
+
+namespace tabs {
+
+namespace {
+
+constexpr int kWidth = 200;
+
+TabWidthConstraints CreateTab(bool in_group = false,
+                              TabOpen open = TabOpen::kOpen) {
+  TabWidthConstraints tab(
+      TabLayoutState(open, TabPinned::kUnpinned, TabActive::kInactive),
+      TabSizeInfo());
+  tab.set_is_tab_in_group(in_group);
+  return tab;
+}
+
+}  // namespace
+
+TEST(VerticalTabBoundsCacheTest, MatchesFullLayout) {
+  std::vector<TabWidthConstraints> tabs(10, CreateTab());
+  tabs[3] = CreateTab(/*in_group=*/true);
+  tabs[5] = CreateTab(/*in_group=*/false, TabOpen::kClosed);
+
+  VerticalTabBoundsCache cache;
+  EXPECT_EQ(CalculateVerticalTabBounds(tabs, kWidth, false).first,
+            cache.Calculate(tabs, kWidth, false).first);
+  EXPECT_EQ(0u, cache.first_recomputed_index_for_testing());
+
+  // Nothing changed, so nothing should be laid out again.
+  EXPECT_EQ(CalculateVerticalTabBounds(tabs, kWidth, false).first,
+            cache.Calculate(tabs, kWidth, false).first);
+  EXPECT_EQ(tabs.size(), cache.first_recomputed_index_for_testing());
+
+  // Width change invalidates all slots.
+  EXPECT_EQ(CalculateVerticalTabBounds(tabs, kWidth + 10, false).first,
+            cache.Calculate(tabs, kWidth + 10, false).first);
+  EXPECT_EQ(0u, cache.first_recomputed_index_for_testing());
+}
+
+TEST(VerticalTabBoundsCacheTest, InsertionOnlyShiftsSuffix) {
+  std::vector<TabWidthConstraints> tabs(1000, CreateTab());
+  VerticalTabBoundsCache cache;
+  cache.Calculate(tabs, kWidth, false);
+
+  // Open 100 tabs in the middle of the strip, as if from a link.
+  for (int i = 0; i < 100; ++i) {
+    const size_t index = 500 + i;
+    tabs.insert(tabs.begin() + index, CreateTab(/*in_group=*/i % 2));
+    EXPECT_EQ(CalculateVerticalTabBounds(tabs, kWidth, false).first,
+              cache.Calculate(tabs, kWidth, false).first);
+    // An ungrouped tab inserted in front of an ungrouped tab is identical to
+    // it, so the first changed slot could be after |index|.
+    EXPECT_GE(cache.first_recomputed_index_for_testing(), index);
+  }
+
+  // Moving a tab into a group only lays out from that tab.
+  tabs[700].set_is_tab_in_group(true);
+  EXPECT_EQ(CalculateVerticalTabBounds(tabs, kWidth, false).first,
+            cache.Calculate(tabs, kWidth, false).first);
+  EXPECT_EQ(700u, cache.first_recomputed_index_for_testing());
+}
+
+}  // namespace tabs
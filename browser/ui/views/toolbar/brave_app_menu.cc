@@ -26,6 +26,7 @@
 #include "brave/components/brave_vpn/common/buildflags/buildflags.h"
 #include "brave/components/misc_metrics/menu_metrics.h"
 #include "brave/components/sidebar/browser/sidebar_service.h"
+#include "brave/components/tor/buildflags/buildflags.h"
 #include "brave/grit/brave_generated_resources.h"
 #include "cc/paint/paint_flags.h"
 #include "chrome/app/chrome_command_ids.h"
@@ -54,6 +55,10 @@
 #include "brave/browser/ui/views/toolbar/brave_vpn_toggle_button.h"
 #endif
 
+#if BUILDFLAG(ENABLE_TOR)
+#include "brave/browser/tor/tor_profile_manager.h"
+#endif  // BUILDFLAG(ENABLE_TOR)
+
 using views::MenuItemView;
 
 namespace {
@@ -235,6 +240,17 @@ void BraveAppMenu::OnMenuClosed(views::MenuItemView* menu) {
   }
 }
 
+void BraveAppMenu::SelectionChanged(views::MenuItemView* menu) {
+  AppMenu::SelectionChanged(menu);
+#if BUILDFLAG(ENABLE_TOR)
+  // Highlighting the item is a good hint that a Tor window is about to be
+  // opened, so give Tor a head start.
+  if (menu && menu->GetCommand() == IDC_NEW_OFFTHERECORD_WINDOW_TOR) {
+    TorProfileManager::GetInstance().PrewarmTor(browser_->profile());
+  }
+#endif  // BUILDFLAG(ENABLE_TOR)
+}
+
 void BraveAppMenu::RecordMenuUsage(int command_id) {
   misc_metrics::MenuGroup group;
 
@@ -25,6 +25,7 @@ class BraveAppMenu : public AppMenu {
   void RunMenu(views::MenuButtonController* host) override;
   void ExecuteCommand(int command_id, int mouse_event_flags) override;
   void OnMenuClosed(views::MenuItemView* menu) override;
+  void SelectionChanged(views::MenuItemView* menu) override;
 
  private:
   void RecordMenuUsage(int command_id);
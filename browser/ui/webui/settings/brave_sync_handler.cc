@@ -248,14 +248,27 @@ void BraveSyncHandler::HandleSetSyncCode(const base::Value::List& args) {
     return;
   }
 
-  auto pure_words_with_status = TimeLimitedWords::Parse(time_limited_sync_code);
+  // BIP39 validation of the words is done off the UI thread.
+  TimeLimitedWords::ParseAsync(
+      time_limited_sync_code,
+      base::BindOnce(&BraveSyncHandler::OnSyncCodeParsed,
+                     weak_ptr_factory_.GetWeakPtr(), args[0].Clone()));
+}
+
+void BraveSyncHandler::OnSyncCodeParsed(
+    base::Value callback_id,
+    base::expected<std::string, TimeLimitedWords::ValidationStatus>
+        pure_words_with_status) {
+  if (!IsJavascriptAllowed()) {
+    return;
+  }
 
   if (!pure_words_with_status.has_value()) {
     LOG(ERROR) << "Could not validate a sync code, validation_result="
                << static_cast<int>(pure_words_with_status.error()) << " "
                << GetSyncCodeValidationErrorString(
                       pure_words_with_status.error());
-    RejectJavascriptCallback(args[0],
+    RejectJavascriptCallback(callback_id,
                              base::Value(GetSyncCodeValidationErrorString(
                                  pure_words_with_status.error())));
     return;
@@ -267,19 +280,19 @@ void BraveSyncHandler::HandleSetSyncCode(const base::Value::List& args) {
   if (!sync_service) {
     LOG(ERROR) << "Cannot get sync_service";
     RejectJavascriptCallback(
-        args[0].Clone(),
+        callback_id,
         l10n_util::GetStringUTF8(IDS_BRAVE_SYNC_INTERNAL_SETUP_ERROR));
     return;
   }
 
-  base::Value callback_id_arg(args[0].Clone());
+  base::Value callback_id_arg(callback_id.Clone());
   sync_service->SetJoinChainResultCallback(base::BindOnce(
       &BraveSyncHandler::OnJoinChainResult, weak_ptr_factory_.GetWeakPtr(),
       std::move(callback_id_arg)));
 
   if (!sync_service->SetSyncCode(pure_words_with_status.value())) {
     RejectJavascriptCallback(
-        args[0].Clone(),
+        callback_id,
         l10n_util::GetStringUTF8(IDS_BRAVE_SYNC_INTERNAL_SETUP_ERROR));
     return;
   }
@@ -6,10 +6,14 @@
 #ifndef BRAVE_BROWSER_UI_WEBUI_SETTINGS_BRAVE_SYNC_HANDLER_H_
 #define BRAVE_BROWSER_UI_WEBUI_SETTINGS_BRAVE_SYNC_HANDLER_H_
 
+#include <string>
+
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/scoped_observation.h"
+#include "base/types/expected.h"
 #include "base/values.h"
+#include "brave/components/brave_sync/time_limited_words.h"
 #include "chrome/browser/ui/webui/settings/settings_page_ui_handler.h"
 #include "components/sync/engine/sync_protocol_error.h"
 #include "components/sync_device_info/device_info_tracker.h"
@@ -54,6 +58,11 @@ class BraveSyncHandler : public settings::SettingsPageUIHandler,
   void OnAccountPermanentlyDeleted(base::Value callback_id,
                                    const syncer::SyncProtocolError& spe);
 
+  void OnSyncCodeParsed(
+      base::Value callback_id,
+      base::expected<std::string,
+                     brave_sync::TimeLimitedWords::ValidationStatus>
+          pure_words_with_status);
   void OnJoinChainResult(base::Value callback_id, bool result);
 
   base::Value::List GetSyncDeviceList();
@@ -31,6 +31,14 @@ BASE_FEATURE(kBraveTreeTab, base::FEATURE_DISABLED_BY_DEFAULT);
 
 BASE_FEATURE(kBraveRenamingTabs, base::FEATURE_DISABLED_BY_DEFAULT);
 
+BASE_FEATURE(kBraveHoverCardThumbnailThrottle,
+             base::FEATURE_DISABLED_BY_DEFAULT);
+BASE_FEATURE_PARAM(base::TimeDelta,
+                   kBraveHoverCardThumbnailThrottleInterval,
+                   &kBraveHoverCardThumbnailThrottle,
+                   "interval",
+                   base::Milliseconds(150));
+
 bool HorizontalTabsUpdateEnabled() {
   return base::FeatureList::IsEnabled(kBraveHorizontalTabsUpdate);
 }
@@ -9,6 +9,8 @@
 #include <chrome/browser/ui/tabs/features.h>  // IWYU pragma: export
 
 #include "base/feature_list.h"
+#include "base/metrics/field_trial_params.h"
+#include "base/time/time.h"
 
 namespace tabs {
 
@@ -32,6 +34,11 @@ BASE_DECLARE_FEATURE(kBraveTreeTab);
 
 BASE_DECLARE_FEATURE(kBraveRenamingTabs);
 
+// Throttles hover card preview requests while the pointer sweeps across tabs.
+BASE_DECLARE_FEATURE(kBraveHoverCardThumbnailThrottle);
+BASE_DECLARE_FEATURE_PARAM(base::TimeDelta,
+                           kBraveHoverCardThumbnailThrottleInterval);
+
 bool HorizontalTabsUpdateEnabled();
 
 }  // namespace tabs
@@ -16,8 +16,13 @@
   OnHovercardImagesEnabledChanged_Unused(); \
   virtual void OnHovercardImagesEnabledChanged
 
+#define MaybeStartThumbnailObservation     \
+  MaybeStartThumbnailObservation_Unused(); \
+  virtual void MaybeStartThumbnailObservation
+
 #include <chrome/browser/ui/views/tabs/tab_hover_card_controller.h>  // IWYU pragma: export
 
+#undef MaybeStartThumbnailObservation
 #undef OnHovercardImagesEnabledChanged
 #undef CreateHoverCard
 
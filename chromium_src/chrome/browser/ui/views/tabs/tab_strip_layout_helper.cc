@@ -10,7 +10,7 @@
 
 #define CalculateTabBounds                                                     \
           use_vertical_tabs_&& FillGroupInfo(tab_widths)                       \
-      ? tabs::CalculateVerticalTabBounds(                                      \
+      ? vertical_tab_bounds_cache_.Calculate(                                  \
             tab_widths, available_width,                                       \
             GetBraveTabStrip() -> IsVerticalTabsFloating())                    \
       : CalculateTabBounds
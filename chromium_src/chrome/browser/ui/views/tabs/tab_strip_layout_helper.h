@@ -29,6 +29,7 @@ class BraveTabStrip;
   BraveTabStrip* GetBraveTabStrip() const;                          \
   bool use_vertical_tabs_ = false;                                  \
   raw_ptr<TabStrip> tab_strip_ = nullptr;                           \
+  tabs::VerticalTabBoundsCache vertical_tab_bounds_cache_;          \
                                                                     \
  public:                                                            \
   int UpdateIdealBounds
@@ -27,29 +27,41 @@ void ApplyBraveHardwareConcurrencyOverride(blink::ExecutionContext* context,
     *hardware_concurrency = true_value;
     return;
   }
-  unsigned farbled_value = true_value;
-  switch (brave::GetBraveFarblingLevelFor(
-      context, ContentSettingsType::BRAVE_WEBCOMPAT_HARDWARE_CONCURRENCY,
-      BraveFarblingLevel::OFF)) {
-    case BraveFarblingLevel::OFF: {
-      break;
-    }
-    case BraveFarblingLevel::MAXIMUM: {
-      true_value = kFakeMaxProcessors;
-      // "Maximum" behavior is "balanced" behavior but with a fake maximum,
-      // so fall through here.
-      [[fallthrough]];
-    }
-    case BraveFarblingLevel::BALANCED: {
-      brave::FarblingPRNG prng =
-          brave::BraveSessionCache::From(*context).MakePseudoRandomGenerator();
-      farbled_value =
-          kFakeMinProcessors + (prng() % (true_value + 1 - kFakeMinProcessors));
-      break;
-    }
-    default:
-      NOTREACHED();
+  if (!context) {
+    *hardware_concurrency = true_value;
+    return;
   }
+  auto compute_farbled_value = [&]() -> double {
+    unsigned farbled_value = true_value;
+    switch (brave::GetBraveFarblingLevelFor(
+        context, ContentSettingsType::BRAVE_WEBCOMPAT_HARDWARE_CONCURRENCY,
+        BraveFarblingLevel::OFF)) {
+      case BraveFarblingLevel::OFF: {
+        break;
+      }
+      case BraveFarblingLevel::MAXIMUM: {
+        true_value = kFakeMaxProcessors;
+        // "Maximum" behavior is "balanced" behavior but with a fake maximum,
+        // so fall through here.
+        [[fallthrough]];
+      }
+      case BraveFarblingLevel::BALANCED: {
+        brave::FarblingPRNG prng = brave::BraveSessionCache::From(*context)
+                                       .MakePseudoRandomGenerator();
+        farbled_value = kFakeMinProcessors +
+                        (prng() % (true_value + 1 - kFakeMinProcessors));
+        break;
+      }
+      default:
+        NOTREACHED();
+    }
+    return farbled_value;
+  };
+  // Scripts read this in loops, so farble once per context.
+  unsigned farbled_value = static_cast<unsigned>(
+      brave::BraveSessionCache::From(*context).GetOrComputeFarbledValue(
+          brave::FarbledValueKey::kHardwareConcurrency,
+          compute_farbled_value));
   *hardware_concurrency = farbled_value;
 }
 
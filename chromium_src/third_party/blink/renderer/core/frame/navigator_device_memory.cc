@@ -13,7 +13,9 @@
 
 namespace brave {
 
-float FarbleDeviceMemory(blink::ExecutionContext* context) {
+namespace {
+
+float ComputeFarbledDeviceMemory(blink::ExecutionContext* context) {
   float true_value =
       blink::ApproximatedDeviceMemory::GetApproximatedDeviceMemory();
   BraveFarblingLevel farbling_level = brave::GetBraveFarblingLevelFor(
@@ -56,6 +58,19 @@ float FarbleDeviceMemory(blink::ExecutionContext* context) {
                       (prng() % (max_farbled_index + 1 - min_farbled_index))];
 }
 
+}  // namespace
+
+float FarbleDeviceMemory(blink::ExecutionContext* context) {
+  if (!context) {
+    return blink::ApproximatedDeviceMemory::GetApproximatedDeviceMemory();
+  }
+  // Scripts read this in loops, so farble once per context.
+  return static_cast<float>(
+      BraveSessionCache::From(*context).GetOrComputeFarbledValue(
+          FarbledValueKey::kDeviceMemory,
+          [context] { return ComputeFarbledDeviceMemory(context); }));
+}
+
 }  // namespace brave
 
 namespace blink {
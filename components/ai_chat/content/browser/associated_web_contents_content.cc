@@ -11,21 +11,27 @@
 #include <ostream>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include "base/barrier_callback.h"
 #include "base/functional/bind.h"
+#include "base/functional/callback_helpers.h"
 #include "base/logging.h"
 #include "base/memory/weak_ptr.h"
+#include "base/numerics/safe_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_ostream_operators.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/thread_pool.h"
 #include "base/types/fixed_array.h"
 #include "brave/components/ai_chat/content/browser/page_content_fetcher.h"
 #include "brave/components/ai_chat/content/browser/pdf_utils.h"
 #include "brave/components/ai_chat/core/browser/associated_content_driver.h"
 #include "brave/components/ai_chat/core/browser/constants.h"
+#include "brave/components/ai_chat/core/browser/page_content_cache.h"
 #include "brave/components/ai_chat/core/browser/utils.h"
+#include "brave/components/ai_chat/core/common/features.h"
 #include "brave/components/ai_chat/core/common/mojom/ai_chat.mojom.h"
 #include "brave/components/ai_chat/core/common/mojom/common.mojom.h"
 #include "brave/components/ai_chat/core/common/mojom/page_content_extractor.mojom.h"
@@ -49,6 +55,24 @@
 
 namespace ai_chat {
 
+namespace {
+
+constexpr char kPageContentCacheUserDataKey[] = "ai_chat_page_content_cache";
+
+// Each BrowserContext, including off-the-record ones, gets its own cache.
+PageContentCache* GetPageContentCache(content::BrowserContext* context) {
+  auto* cache = static_cast<PageContentCache*>(
+      context->GetUserData(kPageContentCacheUserDataKey));
+  if (!cache) {
+    auto new_cache = std::make_unique<PageContentCache>();
+    cache = new_cache.get();
+    context->SetUserData(kPageContentCacheUserDataKey, std::move(new_cache));
+  }
+  return cache;
+}
+
+}  // namespace
+
 AssociatedWebContentsContent::AssociatedWebContentsContent(
     content::WebContents* web_contents,
     std::unique_ptr<PrintPreviewExtractionDelegate>
@@ -62,6 +86,8 @@ AssociatedWebContentsContent::AssociatedWebContentsContent(
       page_content_fetcher_delegate_(
           std::make_unique<PageContentFetcher>(web_contents)) {
   previous_page_title_ = web_contents->GetTitle();
+  set_page_content_cache(
+      GetPageContentCache(web_contents->GetBrowserContext()));
 }
 
 AssociatedWebContentsContent::~AssociatedWebContentsContent() = default;
@@ -125,6 +151,16 @@ void AssociatedWebContentsContent::DidFinishLoad(
   }
 }
 
+void AssociatedWebContentsContent::OnWebContentsFocused(
+    content::RenderWidgetHost* render_widget_host) {
+  // Start extracting PDF text as soon as the tab is focused so that it is
+  // ready, or at least under way, by the time a conversation asks for it.
+  // Concurrent requests share the same fetch.
+  if (features::IsAIChatPdfExtractionCacheEnabled() && IsPdf(web_contents())) {
+    GetContent(base::DoNothing());
+  }
+}
+
 void AssociatedWebContentsContent::GetPageContent(
     FetchPageContentCallback callback,
     std::string_view invalidation_token) {
@@ -139,7 +175,8 @@ void AssociatedWebContentsContent::GetPageContent(
           weak_ptr_factory_.GetWeakPtr(),
           base::BindOnce(
               &AssociatedWebContentsContent::OnFetchPageContentComplete,
-              weak_ptr_factory_.GetWeakPtr(), std::move(callback))));
+              weak_ptr_factory_.GetWeakPtr(), std::move(callback)),
+          std::string(invalidation_token)));
       return;
     }
 #endif  // BUILDFLAG(ENABLE_PDF)
@@ -181,8 +218,10 @@ void AssociatedWebContentsContent::OnFetchPageContentComplete(
     std::string invalidation_token) {
   base::TrimWhitespaceASCII(content, base::TRIM_ALL, &content);
   // If content is empty, and page was not loaded yet, wait for page load.
-  // Once page load is complete, try again.
-  if (content.empty() && !is_video && !is_page_loaded_) {
+  // Once page load is complete, try again. An invalidation token without
+  // content means the previously fetched content is still valid.
+  if (content.empty() && invalidation_token.empty() && !is_video &&
+      !is_page_loaded_) {
     DVLOG(1) << "page was not loaded yet, will try again after load";
     SetPendingGetContentCallback(std::move(callback));
     return;
@@ -225,7 +264,8 @@ void AssociatedWebContentsContent::MaybeSameDocumentIsNewPage() {
 
 #if BUILDFLAG(ENABLE_PDF)
 void AssociatedWebContentsContent::OnPDFDocumentLoadComplete(
-    FetchPageContentCallback callback) {
+    FetchPageContentCallback callback,
+    std::string invalidation_token) {
   auto* pdf_helper =
       pdf::PDFDocumentHelper::MaybeGetForWebContents(web_contents());
   if (!pdf_helper) {
@@ -233,22 +273,76 @@ void AssociatedWebContentsContent::OnPDFDocumentLoadComplete(
     return;
   }
 
-  // Fetch zero PDF bytes to just receive the total page count.
+  // Fetch zero PDF bytes to just receive the total page count, unless the
+  // document is needed to compute its invalidation token.
+  uint32_t size_limit = 0;
+  if (features::IsAIChatPdfExtractionCacheEnabled()) {
+    size_limit = base::saturated_cast<uint32_t>(
+        static_cast<int64_t>(
+            features::kAIChatPdfExtractionCacheMaxDocumentMB.Get()) *
+        1024 * 1024);
+  }
   pdf_helper->GetPdfBytes(
-      /*size_limit=*/0,
+      size_limit,
       base::BindOnce(&AssociatedWebContentsContent::OnGetPDFPageCount,
-                     weak_ptr_factory_.GetWeakPtr(), std::move(callback)));
+                     weak_ptr_factory_.GetWeakPtr(), std::move(callback),
+                     std::move(invalidation_token)));
 }
 
 void AssociatedWebContentsContent::OnGetPDFPageCount(
     FetchPageContentCallback callback,
+    std::string invalidation_token,
     pdf::mojom::PdfListener::GetPdfBytesStatus status,
     const std::vector<uint8_t>& bytes,
     uint32_t page_count) {
+  if (status == pdf::mojom::PdfListener::GetPdfBytesStatus::kFailed ||
+      !pdf::PDFDocumentHelper::MaybeGetForWebContents(web_contents())) {
+    std::move(callback).Run("", false, "");
+    return;
+  }
+
+  // Documents over the size limit come back without bytes and are extracted
+  // without a token, as before.
+  if (status == pdf::mojom::PdfListener::GetPdfBytesStatus::kSuccess &&
+      !bytes.empty()) {
+    base::ThreadPool::PostTaskAndReplyWithResult(
+        FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+        base::BindOnce(
+            [](std::vector<uint8_t> pdf_bytes) {
+              return GetPdfInvalidationToken(pdf_bytes);
+            },
+            bytes),
+        base::BindOnce(
+            &AssociatedWebContentsContent::OnPDFInvalidationTokenComputed,
+            weak_ptr_factory_.GetWeakPtr(), std::move(callback),
+            std::move(invalidation_token), page_count));
+    return;
+  }
+
+  GetPDFPagesText(std::move(callback), page_count, "");
+}
+
+void AssociatedWebContentsContent::OnPDFInvalidationTokenComputed(
+    FetchPageContentCallback callback,
+    std::string previous_invalidation_token,
+    uint32_t page_count,
+    std::string invalidation_token) {
+  if (invalidation_token == previous_invalidation_token) {
+    DVLOG(1) << "PDF is unchanged, reusing previously extracted text";
+    std::move(callback).Run("", false, std::move(invalidation_token));
+    return;
+  }
+  GetPDFPagesText(std::move(callback), page_count,
+                  std::move(invalidation_token));
+}
+
+void AssociatedWebContentsContent::GetPDFPagesText(
+    FetchPageContentCallback callback,
+    uint32_t page_count,
+    std::string invalidation_token) {
   auto* pdf_helper =
       pdf::PDFDocumentHelper::MaybeGetForWebContents(web_contents());
-  if (status == pdf::mojom::PdfListener::GetPdfBytesStatus::kFailed ||
-      !pdf_helper) {
+  if (!pdf_helper) {
     std::move(callback).Run("", false, "");
     return;
   }
@@ -257,7 +351,8 @@ void AssociatedWebContentsContent::OnGetPDFPageCount(
   auto barrier_callback = base::BarrierCallback<std::pair<size_t, std::string>>(
       page_count,
       base::BindOnce(&AssociatedWebContentsContent::OnAllPDFPagesTextReceived,
-                     weak_ptr_factory_.GetWeakPtr(), std::move(callback)));
+                     weak_ptr_factory_.GetWeakPtr(), std::move(callback),
+                     std::move(invalidation_token)));
 
   for (size_t i = 0; i < page_count; ++i) {
     pdf_helper->GetPageText(
@@ -276,6 +371,7 @@ void AssociatedWebContentsContent::OnGetPDFPageCount(
 
 void AssociatedWebContentsContent::OnAllPDFPagesTextReceived(
     FetchPageContentCallback callback,
+    std::string invalidation_token,
     const std::vector<std::pair<size_t, std::string>>& page_texts) {
   base::FixedArray<std::string_view> ordered_texts(page_texts.size());
 
@@ -284,7 +380,8 @@ void AssociatedWebContentsContent::OnAllPDFPagesTextReceived(
     ordered_texts[index] = text;
   }
 
-  std::move(callback).Run(base::JoinString(ordered_texts, "\n"), false, "");
+  std::move(callback).Run(base::JoinString(ordered_texts, "\n"), false,
+                          std::move(invalidation_token));
 }
 #endif  // BUILDFLAG(ENABLE_PDF)
 
@@ -122,6 +122,8 @@ class AssociatedWebContentsContent : public content::WebContentsObserver,
   void TitleWasSet(content::NavigationEntry* entry) override;
   void DidFinishLoad(content::RenderFrameHost* render_frame_host,
                      const GURL& validated_url) override;
+  void OnWebContentsFocused(
+      content::RenderWidgetHost* render_widget_host) override;
 
   // ai_chat::AssociatedContentDriver
   void GetPageContent(FetchPageContentCallback callback,
@@ -150,15 +152,30 @@ class AssociatedWebContentsContent : public content::WebContentsObserver,
                                   std::string invalidation_token);
 
 #if BUILDFLAG(ENABLE_PDF)
-  void OnPDFDocumentLoadComplete(FetchPageContentCallback callback);
+  void OnPDFDocumentLoadComplete(FetchPageContentCallback callback,
+                                 std::string invalidation_token);
 
   void OnGetPDFPageCount(FetchPageContentCallback callback,
+                         std::string invalidation_token,
                          pdf::mojom::PdfListener::GetPdfBytesStatus status,
                          const std::vector<uint8_t>& bytes,
                          uint32_t page_count);
 
+  // Called with the invalidation token of the document once it has been
+  // hashed. Text extraction is skipped when it matches the token of the
+  // content the driver already has.
+  void OnPDFInvalidationTokenComputed(FetchPageContentCallback callback,
+                                      std::string previous_invalidation_token,
+                                      uint32_t page_count,
+                                      std::string invalidation_token);
+
+  void GetPDFPagesText(FetchPageContentCallback callback,
+                       uint32_t page_count,
+                       std::string invalidation_token);
+
   void OnAllPDFPagesTextReceived(
       FetchPageContentCallback callback,
+      std::string invalidation_token,
       const std::vector<std::pair<size_t, std::string>>& page_texts);
 #endif  // BUILDFLAG(ENABLE_PDF)
 
@@ -6,16 +6,19 @@
 #include "brave/components/ai_chat/content/browser/full_screenshotter.h"
 
 #include <algorithm>
+#include <optional>
 #include <utility>
 
 #include "base/check.h"
 #include "base/logging.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/task/task_traits.h"
 #include "base/task/thread_pool.h"
 #include "base/types/expected.h"
 #include "brave/components/ai_chat/content/browser/pdf_utils.h"
 #include "brave/components/ai_chat/core/browser/utils.h"
+#include "brave/components/ai_chat/core/common/features.h"
 #include "components/paint_preview/browser/compositor_utils.h"
 #include "components/paint_preview/browser/paint_preview_base_service.h"
 #include "components/paint_preview/common/recording_map.h"
@@ -23,11 +26,23 @@
 #include "mojo/public/cpp/base/proto_wrapper.h"
 #include "third_party/abseil-cpp/absl/strings/str_format.h"
 #include "third_party/skia/include/core/SkBitmap.h"
+#include "ui/gfx/codec/jpeg_codec.h"
 #include "ui/gfx/codec/png_codec.h"
+#include "ui/gfx/codec/webp_codec.h"
 #include "ui/gfx/geometry/rect.h"
+#include "ui/gfx/geometry/rect_conversions.h"
+#include "ui/gfx/geometry/rect_f.h"
 
 namespace ai_chat {
 
+namespace {
+
+// Float error tolerated when scaling tile rects, so that a tile scaled to
+// exactly the target size is not rounded up by a pixel.
+constexpr float kRasterRoundingError = 0.01f;
+
+}  // namespace
+
 FullScreenshotter::FullScreenshotter()
     : paint_preview::PaintPreviewBaseService(
           /*file_mixin=*/nullptr,  // in-memory captures
@@ -189,6 +204,17 @@ void FullScreenshotter::OnCompositeFinished(
     pending->remaining_rects.emplace(0, y, content_size.width(), height);
   }
 
+  // Let the compositor rasterize tiles at the resolution sent to the model
+  // rather than transferring full size bitmaps only to scale them down.
+  if (features::IsAIChatScreenshotEncodingEnabled() &&
+      !content_size.IsEmpty()) {
+    pending->raster_scale = std::min(
+        {1.0f,
+         static_cast<float>(kMaxImageWidth) / content_size.width(),
+         static_cast<float>(kMaxImageHeight) /
+             std::min(viewport_height, total_height)});
+  }
+
   pending->callback = std::move(callback);
   CaptureNextScreenshot(std::move(pending));
 }
@@ -206,8 +232,13 @@ void FullScreenshotter::CaptureNextScreenshot(
   gfx::Rect capture_rect = pending->remaining_rects.front();
   pending->remaining_rects.pop();
 
+  // The clip rect is in the coordinate space of the scaled bitmap.
+  const float raster_scale = pending->raster_scale;
+  const gfx::Rect clip_rect = gfx::ToEnclosingRectIgnoringError(
+      gfx::ScaleRect(gfx::RectF(capture_rect), raster_scale),
+      kRasterRoundingError);
   paint_preview_compositor_client_->BitmapForMainFrame(
-      capture_rect, 1,
+      clip_rect, raster_scale,
       base::BindOnce(&FullScreenshotter::OnBitmapReceived,
                      weak_ptr_factory_.GetWeakPtr(), std::move(pending),
                      pending->completed_images.size() -
@@ -229,9 +260,14 @@ void FullScreenshotter::OnBitmapReceived(
     return;
   }
 
+  const bool encoding_enabled = features::IsAIChatScreenshotEncodingEnabled();
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&FullScreenshotter::EncodeBitmap, ScaleDownBitmap(bitmap)),
+      base::BindOnce(&FullScreenshotter::EncodeBitmap,
+                     encoding_enabled
+                         ? features::kAIChatScreenshotEncodingFormat.Get()
+                         : features::ScreenshotEncodingFormat::kPng,
+                     features::kAIChatScreenshotEncodingQuality.Get(), bitmap),
       base::BindOnce(&FullScreenshotter::OnBitmapEncoded,
                      weak_ptr_factory_.GetWeakPtr(), std::move(pending),
                      index));
@@ -239,12 +275,31 @@ void FullScreenshotter::OnBitmapReceived(
 
 // static
 base::expected<std::vector<uint8_t>, std::string>
-FullScreenshotter::EncodeBitmap(const SkBitmap& bitmap) {
-  auto data = gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false);
+FullScreenshotter::EncodeBitmap(features::ScreenshotEncodingFormat format,
+                                int quality,
+                                const SkBitmap& bitmap) {
+  // Scaling happens here so that it stays off the UI thread. Bitmaps
+  // rasterized at the target resolution are returned as is.
+  const SkBitmap scaled_bitmap = ScaleDownBitmap(bitmap);
+  quality = std::clamp(quality, 0, 100);
+  std::optional<std::vector<uint8_t>> data;
+  switch (format) {
+    case features::ScreenshotEncodingFormat::kPng:
+      data = gfx::PNGCodec::EncodeBGRASkBitmap(scaled_bitmap, false);
+      break;
+    case features::ScreenshotEncodingFormat::kJpeg:
+      data = gfx::JPEGCodec::Encode(scaled_bitmap, quality);
+      break;
+    case features::ScreenshotEncodingFormat::kWebp:
+      data = gfx::WebpCodec::Encode(scaled_bitmap, quality);
+      break;
+  }
   if (!data) {
     return base::unexpected("Failed to encode the bitmap");
   }
-  return base::ok(*data);
+  base::UmaHistogramMemoryKB("Brave.AIChat.ScreenshotEncodedSizeKB",
+                             static_cast<int>(data->size() / 1024));
+  return base::ok(std::move(*data));
 }
 
 void FullScreenshotter::OnBitmapEncoded(
@@ -15,6 +15,7 @@
 #include "base/memory/weak_ptr.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/types/expected.h"
+#include "brave/components/ai_chat/core/common/features.h"
 #include "components/paint_preview/browser/paint_preview_base_service.h"
 #include "components/paint_preview/public/paint_preview_compositor_service.h"
 #include "content/public/browser/web_contents.h"
@@ -26,7 +27,9 @@ namespace ai_chat {
 // This class uses paint preview service and compositor service to capture
 // screenshot of a web_contents and split it into multiple ones based on the
 // viewport height. If a single screenshot is larger than 1024x768, it will be
-// scaled down to that resolution.
+// scaled down to that resolution. When kAIChatScreenshotEncoding is enabled,
+// tiles are rasterized by the compositor at that resolution directly and
+// encoded with the configured format instead of PNG.
 class FullScreenshotter : public paint_preview::PaintPreviewBaseService {
  public:
   FullScreenshotter();
@@ -73,9 +76,13 @@ class FullScreenshotter : public paint_preview::PaintPreviewBaseService {
     std::queue<gfx::Rect> remaining_rects;
     std::vector<std::vector<uint8_t>> completed_images;
     CaptureScreenshotsCallback callback;
+    // Scale at which tiles are rasterized by the compositor.
+    float raster_scale = 1.0f;
   };
 
   static base::expected<std::vector<uint8_t>, std::string> EncodeBitmap(
+      features::ScreenshotEncodingFormat format,
+      int quality,
       const SkBitmap& bitmap);
   void OnBitmapReceived(
       std::unique_ptr<PendingScreenshots> pending,
@@ -5,7 +5,10 @@
 
 #include "brave/components/ai_chat/content/browser/pdf_utils.h"
 
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
 #include "content/public/browser/web_contents.h"
+#include "crypto/sha2.h"
 
 namespace ai_chat {
 
@@ -13,4 +16,9 @@ bool IsPdf(content::WebContents* web_contents) {
   return web_contents->GetContentsMimeType() == "application/pdf";
 }
 
+std::string GetPdfInvalidationToken(base::span<const uint8_t> pdf_bytes) {
+  return base::StrCat(
+      {"pdf-sha256:", base::HexEncode(crypto::SHA256Hash(pdf_bytes))});
+}
+
 }  // namespace ai_chat
@@ -6,6 +6,11 @@
 #ifndef BRAVE_COMPONENTS_AI_CHAT_CONTENT_BROWSER_PDF_UTILS_H_
 #define BRAVE_COMPONENTS_AI_CHAT_CONTENT_BROWSER_PDF_UTILS_H_
 
+#include <cstdint>
+#include <string>
+
+#include "base/containers/span.h"
+
 namespace content {
 class WebContents;
 }  // namespace content
@@ -14,6 +19,11 @@ namespace ai_chat {
 
 bool IsPdf(content::WebContents* web_contents);
 
+// Returns an invalidation token identifying the document |pdf_bytes|, so that
+// text extracted from it can be reused for as long as it is unchanged.
+// Hashing may be slow for large documents, so call this off the UI thread.
+std::string GetPdfInvalidationToken(base::span<const uint8_t> pdf_bytes);
+
 }  // namespace ai_chat
 
 #endif  // BRAVE_COMPONENTS_AI_CHAT_CONTENT_BROWSER_PDF_UTILS_H_
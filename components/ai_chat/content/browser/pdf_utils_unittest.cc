@@ -0,0 +1,30 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ai_chat/content/browser/pdf_utils.h"
+
+#include <cstdint>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace ai_chat {
+
+TEST(PdfUtilsTest, GetPdfInvalidationToken) {
+  EXPECT_EQ(GetPdfInvalidationToken({}),
+            "pdf-sha256:"
+            "E3B0C44298FC1C149AFBF4C8996FB92427AE41E4649B934CA495991B7852B855");
+
+  const std::vector<uint8_t> document = {'%', 'P', 'D', 'F',
+                                         '-', '1', '.', '7'};
+  std::vector<uint8_t> changed_document = document;
+  changed_document.back() = '6';
+  EXPECT_EQ(GetPdfInvalidationToken(document),
+            GetPdfInvalidationToken(document));
+  EXPECT_NE(GetPdfInvalidationToken(document),
+            GetPdfInvalidationToken(changed_document));
+}
+
+}  // namespace ai_chat
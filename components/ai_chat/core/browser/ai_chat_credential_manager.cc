@@ -5,6 +5,7 @@
 
 #include "brave/components/ai_chat/core/browser/ai_chat_credential_manager.h"
 
+#include <algorithm>
 #include <compare>
 #include <optional>
 #include <ostream>
@@ -24,6 +25,7 @@
 #include "base/value_iterators.h"
 #include "base/values.h"
 #include "brave/brave_domains/service_domains.h"
+#include "brave/components/ai_chat/core/common/features.h"
 #include "brave/components/ai_chat/core/common/pref_names.h"
 #include "components/prefs/pref_service.h"
 #include "components/prefs/scoped_user_pref_update.h"
@@ -44,6 +46,9 @@ namespace {
 
 constexpr char kLeoSkuHostnamePart[] = "leo";
 
+// How long credential queue changes are batched before being written to prefs.
+constexpr base::TimeDelta kCredentialQueuePersistDelay = base::Seconds(5);
+
 }  // namespace
 
 namespace ai_chat {
@@ -54,7 +59,10 @@ AIChatCredentialManager::AIChatCredentialManager(
     PrefService* prefs_service)
     : skus_service_getter_(std::move(skus_service_getter)),
       prefs_service_(prefs_service) {}
-AIChatCredentialManager::~AIChatCredentialManager() = default;
+
+AIChatCredentialManager::~AIChatCredentialManager() {
+  PersistCredentialQueue();
+}
 
 void AIChatCredentialManager::GetPremiumStatus(
     mojom::Service::GetPremiumStatusCallback callback) {
@@ -68,17 +76,25 @@ void AIChatCredentialManager::GetPremiumStatus(
     return;
   }
 
-  const auto& cached_creds_dict =
-      prefs_service_->GetDict(prefs::kBraveChatPremiumCredentialCache);
-  for (const auto [credential, expires_at_value] : cached_creds_dict) {
-    std::optional<base::Time> expires_at = base::ValueToTime(expires_at_value);
-    if (!expires_at) {
-      continue;
-    }
-
-    if (*expires_at > now) {
-      credential_in_cache = true;
-      break;
+  if (features::IsAIChatCredentialQueueEnabled()) {
+    // The queue is ordered by expiry, so only the last entry needs checking.
+    EnsureCredentialQueueLoaded();
+    credential_in_cache = !credential_queue_.empty() &&
+                          credential_queue_.back().expires_at > now;
+  } else {
+    const auto& cached_creds_dict =
+        prefs_service_->GetDict(prefs::kBraveChatPremiumCredentialCache);
+    for (const auto [credential, expires_at_value] : cached_creds_dict) {
+      std::optional<base::Time> expires_at =
+          base::ValueToTime(expires_at_value);
+      if (!expires_at) {
+        continue;
+      }
+
+      if (*expires_at > now) {
+        credential_in_cache = true;
+        break;
+      }
     }
   }
 
@@ -182,6 +198,22 @@ void AIChatCredentialManager::OnCredentialSummary(
 void AIChatCredentialManager::FetchPremiumCredential(
     base::OnceCallback<void(std::optional<CredentialCacheEntry> credential)>
         callback) {
+  if (features::IsAIChatCredentialQueueEnabled()) {
+    std::optional<CredentialCacheEntry> queued = PopCredentialFromQueue();
+    if (queued) {
+      MaybeReplenishCredentials();
+      std::move(callback).Run(std::move(queued));
+      return;
+    }
+
+    GetPremiumStatus(base::BindOnce(
+        &AIChatCredentialManager::OnGetPremiumStatus,
+        weak_ptr_factory_.GetWeakPtr(),
+        base::BindOnce(&AIChatCredentialManager::OnFetchedCredentialFromSkus,
+                       weak_ptr_factory_.GetWeakPtr(), std::move(callback))));
+    return;
+  }
+
   // Loop through credentials looking for a valid credential and remove it. If
   // there is more than one valid credential, use the one that is expiring
   // soonest. Also, remove any expired credentials as we go.
@@ -314,12 +346,158 @@ void AIChatCredentialManager::OnPrepareCredentialsPresentation(
 
 void AIChatCredentialManager::PutCredentialInCache(
     CredentialCacheEntry credential) {
+  if (features::IsAIChatCredentialQueueEnabled()) {
+    PushCredentialToQueue(std::move(credential));
+    return;
+  }
+
   ScopedDictPrefUpdate update(prefs_service_,
                               prefs::kBraveChatPremiumCredentialCache);
   base::Value::Dict& dict = update.Get();
   dict.Set(credential.credential, base::TimeToValue(credential.expires_at));
 }
 
+void AIChatCredentialManager::EnsureCredentialQueueLoaded() {
+  if (credential_queue_loaded_) {
+    return;
+  }
+  credential_queue_loaded_ = true;
+
+  // |pref_service_| can be null in tests.
+  if (!prefs_service_) {
+    return;
+  }
+
+  std::vector<CredentialCacheEntry> entries;
+  const auto& dict =
+      prefs_service_->GetDict(prefs::kBraveChatPremiumCredentialCache);
+  for (const auto [credential, expires_at_value] : dict) {
+    std::optional<base::Time> expires_at = base::ValueToTime(expires_at_value);
+    if (!expires_at) {
+      // Drop malformed entries the next time the queue is persisted.
+      pending_credential_removals_.insert(credential);
+      continue;
+    }
+    entries.push_back({credential, *expires_at});
+  }
+  std::ranges::stable_sort(entries, {}, &CredentialCacheEntry::expires_at);
+  credential_queue_ = base::circular_deque<CredentialCacheEntry>(
+      std::make_move_iterator(entries.begin()),
+      std::make_move_iterator(entries.end()));
+
+  if (!pending_credential_removals_.empty()) {
+    SchedulePersistCredentialQueue();
+  }
+}
+
+std::optional<CredentialCacheEntry>
+AIChatCredentialManager::PopCredentialFromQueue() {
+  EnsureCredentialQueueLoaded();
+
+  // Expired credentials are always at the front of the queue.
+  const base::Time now = base::Time::Now();
+  std::optional<CredentialCacheEntry> result;
+  while (!credential_queue_.empty() && !result) {
+    CredentialCacheEntry entry = std::move(credential_queue_.front());
+    credential_queue_.pop_front();
+    pending_credential_puts_.erase(entry.credential);
+    pending_credential_removals_.insert(entry.credential);
+    if (entry.expires_at >= now) {
+      result = std::move(entry);
+    }
+  }
+
+  if (!pending_credential_removals_.empty()) {
+    SchedulePersistCredentialQueue();
+  }
+  return result;
+}
+
+void AIChatCredentialManager::PushCredentialToQueue(
+    CredentialCacheEntry credential) {
+  EnsureCredentialQueueLoaded();
+
+  // Credentials are keyed by value, so replace any existing copy.
+  base::EraseIf(credential_queue_, [&](const CredentialCacheEntry& entry) {
+    return entry.credential == credential.credential;
+  });
+  pending_credential_removals_.erase(credential.credential);
+  pending_credential_puts_[credential.credential] = credential.expires_at;
+
+  auto it = std::upper_bound(
+      credential_queue_.begin(), credential_queue_.end(), credential.expires_at,
+      [](base::Time expires_at, const CredentialCacheEntry& entry) {
+        return expires_at < entry.expires_at;
+      });
+  credential_queue_.insert(it, std::move(credential));
+  SchedulePersistCredentialQueue();
+}
+
+void AIChatCredentialManager::SchedulePersistCredentialQueue() {
+  if (persist_timer_.IsRunning()) {
+    return;
+  }
+  persist_timer_.Start(FROM_HERE, kCredentialQueuePersistDelay, this,
+                       &AIChatCredentialManager::PersistCredentialQueue);
+}
+
+void AIChatCredentialManager::PersistCredentialQueue() {
+  persist_timer_.Stop();
+  if (!prefs_service_ || (pending_credential_puts_.empty() &&
+                          pending_credential_removals_.empty())) {
+    return;
+  }
+
+  ScopedDictPrefUpdate update(prefs_service_,
+                              prefs::kBraveChatPremiumCredentialCache);
+  base::Value::Dict& dict = update.Get();
+  for (const auto& credential : pending_credential_removals_) {
+    dict.Remove(credential);
+  }
+  for (const auto& [credential, expires_at] : pending_credential_puts_) {
+    dict.Set(credential, base::TimeToValue(expires_at));
+  }
+  pending_credential_removals_.clear();
+  pending_credential_puts_.clear();
+}
+
+void AIChatCredentialManager::MaybeReplenishCredentials() {
+  if (replenish_in_flight_ ||
+      credential_queue_.size() >=
+          static_cast<size_t>(
+              features::kAIChatCredentialQueueLowWatermark.Get())) {
+    return;
+  }
+
+  replenish_in_flight_ = true;
+  GetPremiumStatus(
+      base::BindOnce(&AIChatCredentialManager::OnGetPremiumStatus,
+                     weak_ptr_factory_.GetWeakPtr(),
+                     base::BindOnce(
+                         &AIChatCredentialManager::OnCredentialReplenished,
+                         weak_ptr_factory_.GetWeakPtr())));
+}
+
+void AIChatCredentialManager::OnCredentialReplenished(
+    std::optional<CredentialCacheEntry> credential) {
+  replenish_in_flight_ = false;
+  if (credential) {
+    PushCredentialToQueue(std::move(*credential));
+  }
+}
+
+void AIChatCredentialManager::OnFetchedCredentialFromSkus(
+    base::OnceCallback<void(std::optional<CredentialCacheEntry> credential)>
+        callback,
+    std::optional<CredentialCacheEntry> credential) {
+  // Only premium users get a credential back, so only they get a spare one
+  // fetched for the next request.
+  if (credential) {
+    MaybeReplenishCredentials();
+  }
+  std::move(callback).Run(std::move(credential));
+}
+
 #if BUILDFLAG(IS_ANDROID)
 void AIChatCredentialManager::CreateOrderFromReceipt(
     const std::string& purchase_token,
@@ -9,10 +9,14 @@
 #include <optional>
 #include <string>
 
+#include "base/containers/circular_deque.h"
+#include "base/containers/flat_map.h"
+#include "base/containers/flat_set.h"
 #include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "brave/components/ai_chat/core/common/mojom/ai_chat.mojom.h"
 #include "brave/components/ai_chat/core/common/mojom/common.mojom.h"
 #include "brave/components/skus/common/skus_sdk.mojom.h"
@@ -91,11 +95,35 @@ class AIChatCredentialManager {
       const std::string& domain,
       skus::mojom::SkusResultPtr credential_as_cookie);
 
+  // Credential queue, used when features::kAIChatCredentialQueue is enabled.
+  void EnsureCredentialQueueLoaded();
+  std::optional<CredentialCacheEntry> PopCredentialFromQueue();
+  void PushCredentialToQueue(CredentialCacheEntry credential);
+  void SchedulePersistCredentialQueue();
+  void PersistCredentialQueue();
+  void MaybeReplenishCredentials();
+  void OnCredentialReplenished(std::optional<CredentialCacheEntry> credential);
+  void OnFetchedCredentialFromSkus(
+      base::OnceCallback<void(std::optional<CredentialCacheEntry> credential)>
+          callback,
+      std::optional<CredentialCacheEntry> credential);
+
   base::RepeatingCallback<mojo::PendingRemote<skus::mojom::SkusService>()>
       skus_service_getter_;
   mojo::Remote<skus::mojom::SkusService> skus_service_;
   raw_ptr<PrefService> prefs_service_ = nullptr;
 
+  // Cached credentials ordered by expiry, soonest first. Loaded from prefs on
+  // first use.
+  base::circular_deque<CredentialCacheEntry> credential_queue_;
+  bool credential_queue_loaded_ = false;
+  // Queue changes not yet written to prefs. The pref is shared by every
+  // profile, so only these are applied instead of rewriting the whole dict.
+  base::flat_map<std::string, base::Time> pending_credential_puts_;
+  base::flat_set<std::string> pending_credential_removals_;
+  base::OneShotTimer persist_timer_;
+  bool replenish_in_flight_ = false;
+
   base::WeakPtrFactory<AIChatCredentialManager> weak_ptr_factory_{this};
 };
 
@@ -22,6 +22,7 @@
 #include "base/test/task_environment.h"
 #include "base/time/time.h"
 #include "base/values.h"
+#include "brave/components/ai_chat/core/common/features.h"
 #include "brave/components/ai_chat/core/common/mojom/ai_chat.mojom.h"
 #include "brave/components/ai_chat/core/common/mojom/common.mojom.h"
 #include "brave/components/ai_chat/core/common/pref_names.h"
@@ -426,4 +427,63 @@ TEST_F(AIChatCredentialManagerUnitTest, FetchPremiumCredential) {
   EXPECT_EQ(cached_creds_list4.size(), 0u);
 }
 
+class AIChatCredentialManagerQueueUnitTest
+    : public AIChatCredentialManagerUnitTest {
+ public:
+  AIChatCredentialManagerQueueUnitTest() {
+    queue_feature_list_.InitAndEnableFeature(features::kAIChatCredentialQueue);
+  }
+
+ private:
+  base::test::ScopedFeatureList queue_feature_list_;
+};
+
+TEST_F(AIChatCredentialManagerQueueUnitTest, FetchPremiumCredential) {
+  const base::Time now = base::Time::Now();
+  base::Value::Dict cache;
+  cache.Set("expired", base::TimeToValue(now - base::Hours(1)));
+  cache.Set("later", base::TimeToValue(now + base::Hours(3)));
+  prefs()->SetDict(prefs::kBraveChatPremiumCredentialCache, std::move(cache));
+
+  CredentialCacheEntry sooner;
+  sooner.credential = "sooner";
+  sooner.expires_at = now + base::Hours(1);
+  ai_chat_credential_manager_->PutCredentialInCache(sooner);
+
+  // Changes are not written to prefs on the request path.
+  TestFetchPremiumCredential(sooner);
+  EXPECT_EQ(prefs()->GetDict(prefs::kBraveChatPremiumCredentialCache).size(),
+            2u);
+
+  CredentialCacheEntry later;
+  later.credential = "later";
+  later.expires_at = now + base::Hours(3);
+  TestFetchPremiumCredential(later);
+
+  // Nothing is left in the queue and there is no SKUs state to replenish it.
+  TestFetchPremiumCredential(std::nullopt);
+
+  // Pending changes are flushed when the manager goes away.
+  ai_chat_credential_manager_.reset();
+  EXPECT_TRUE(
+      prefs()->GetDict(prefs::kBraveChatPremiumCredentialCache).empty());
+}
+
+TEST_F(AIChatCredentialManagerQueueUnitTest, GetPremiumStatus) {
+  CredentialCacheEntry entry;
+  entry.credential = "credential";
+  entry.expires_at = base::Time::Now() + base::Hours(1);
+  ai_chat_credential_manager_->PutCredentialInCache(entry);
+  EXPECT_TRUE(
+      prefs()->GetDict(prefs::kBraveChatPremiumCredentialCache).empty());
+
+  TestGetPremiumStatus(mojom::PremiumStatus::Active,
+                       mojom::PremiumInfo::New(1, std::nullopt));
+
+  ai_chat_credential_manager_.reset();
+  const auto& dict = prefs()->GetDict(prefs::kBraveChatPremiumCredentialCache);
+  ASSERT_EQ(dict.size(), 1u);
+  EXPECT_EQ(base::ValueToTime(*dict.Find("credential")), entry.expires_at);
+}
+
 }  // namespace ai_chat
@@ -6,6 +6,7 @@
 #include "brave/components/ai_chat/core/browser/ai_chat_database.h"
 
 #include <algorithm>
+#include <array>
 #include <map>
 #include <numeric>
 #include <optional>
@@ -13,20 +14,27 @@
 #include <utility>
 #include <vector>
 
+#include "base/base64.h"
 #include "base/check.h"
 #include "base/check_op.h"
+#include "base/containers/span.h"
 #include "base/logging.h"
+#include "base/numerics/safe_conversions.h"
 #include "base/sequence_checker.h"
+#include "base/strings/strcat.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
 #include "base/strings/string_view_util.h"
 #include "base/threading/thread_restrictions.h"
+#include "base/time/time.h"
 #include "base/types/cxx23_to_underlying.h"
 #include "brave/components/ai_chat/core/common/mojom/ai_chat.mojom.h"
 #include "brave/components/ai_chat/core/common/mojom/common.mojom.h"
 #include "brave/components/ai_chat/core/common/proto_conversion.h"
 #include "brave/components/ai_chat/core/proto/store.pb.h"
 #include "components/os_crypt/async/common/encryptor.h"
+#include "crypto/hmac.h"
+#include "crypto/random.h"
 #include "sql/init_status.h"
 #include "sql/meta_table.h"
 #include "sql/statement.h"
@@ -39,6 +47,26 @@ namespace {
 
 constexpr char kSearchQueriesSeparator[] = "|||";
 
+// Meta table key of the encrypted key which search tokens are hashed with.
+constexpr char kSearchTokenKeyMetaKey[] = "search_token_key";
+constexpr size_t kSearchTokenKeySize = 32;
+// Bytes of each search token's HMAC which are stored. A collision only causes
+// a false positive match.
+constexpr size_t kSearchTokenSize = 12;
+// Words shorter than this are too common to be worth indexing, and longer
+// words are truncated.
+constexpr size_t kMinSearchTermLength = 2;
+constexpr size_t kMaxSearchTermLength = 64;
+// Further words of a search query are ignored.
+constexpr size_t kMaxSearchQueryTerms = 16;
+
+// Columns read by AIChatDatabase::ReadConversationEntry, in order.
+// Note: Column name kept as 'smart_mode_data' for backward compatibility
+// (feature is now called 'skills').
+#define ENTRY_COLUMNS                                                    \
+  "uuid, date, entry_text, prompt, character_type, editing_entry_uuid, " \
+  "action_type, selected_text, model_key, smart_mode_data, is_near_verified"
+
 std::optional<std::string> GetOptionalString(sql::Statement& statement,
                                              int index) {
   if (statement.GetColumnType(index) == sql::ColumnType::kNull) {
@@ -57,6 +85,46 @@ void BindOptionalString(sql::Statement& statement,
   }
 }
 
+bool IsSearchTermChar(char c) {
+  // Bytes of non-ASCII characters are kept so that those words can be matched
+  // exactly, even though they aren't lower-cased.
+  return base::IsAsciiAlphaNumeric(c) || static_cast<unsigned char>(c) >= 0x80;
+}
+
+// Splits |text| into lower-cased words and appends them to |terms|.
+void AppendSearchTerms(std::string_view text, std::vector<std::string>& terms) {
+  size_t start = 0;
+  while (start < text.size()) {
+    while (start < text.size() && !IsSearchTermChar(text[start])) {
+      ++start;
+    }
+    size_t end = start;
+    while (end < text.size() && IsSearchTermChar(text[end])) {
+      ++end;
+    }
+    if (end - start >= kMinSearchTermLength) {
+      terms.push_back(base::ToLowerASCII(
+          text.substr(start, std::min(end - start, kMaxSearchTermLength))));
+    }
+    start = end;
+  }
+}
+
+void SortAndDeduplicate(std::vector<std::string>& terms) {
+  std::ranges::sort(terms);
+  auto duplicates = std::ranges::unique(terms);
+  terms.erase(duplicates.begin(), duplicates.end());
+}
+
+std::array<uint8_t, kSearchTokenSize> HashSearchTerm(
+    base::span<const uint8_t> key,
+    std::string_view term) {
+  const auto hmac = crypto::hmac::SignSha256(key, base::as_byte_span(term));
+  std::array<uint8_t, kSearchTokenSize> token;
+  base::span(token).copy_from(base::span(hmac).first<kSearchTokenSize>());
+  return token;
+}
+
 bool MigrateFrom1To2(sql::Database* db) {
   // Add a new column to the associated_content table to store the content type.
   static constexpr char kAddPromptColumnQuery[] =
@@ -176,6 +244,26 @@ constexpr int kCompatibleDatabaseVersionNumber = 7;
 // Current version of the database. Increase if breaking changes are made.
 constexpr int kCurrentDatabaseVersion = 9;
 
+ConversationUpdates::ToolUseEventUpdate::ToolUseEventUpdate(
+    std::string entry_uuid,
+    size_t event_order,
+    mojom::ToolUseEventPtr tool_use_event)
+    : entry_uuid(std::move(entry_uuid)),
+      event_order(event_order),
+      tool_use_event(std::move(tool_use_event)) {}
+ConversationUpdates::ToolUseEventUpdate::ToolUseEventUpdate(
+    ToolUseEventUpdate&&) = default;
+ConversationUpdates::ToolUseEventUpdate&
+ConversationUpdates::ToolUseEventUpdate::operator=(ToolUseEventUpdate&&) =
+    default;
+ConversationUpdates::ToolUseEventUpdate::~ToolUseEventUpdate() = default;
+
+ConversationUpdates::ConversationUpdates() = default;
+ConversationUpdates::ConversationUpdates(ConversationUpdates&&) = default;
+ConversationUpdates& ConversationUpdates::operator=(ConversationUpdates&&) =
+    default;
+ConversationUpdates::~ConversationUpdates() = default;
+
 AIChatDatabase::AIChatDatabase(const base::FilePath& db_file_path,
                                os_crypt_async::Encryptor encryptor)
     : db_file_path_(db_file_path),
@@ -323,6 +411,11 @@ sql::InitStatus AIChatDatabase::InitInternal() {
     }
   }
 
+  if (!InitSearchTokenKey(meta_table)) {
+    DVLOG(0) << "Failed to init search token key";
+    return sql::InitStatus::INIT_FAILURE;
+  }
+
   if (!transaction.Commit()) {
     return sql::InitStatus::INIT_FAILURE;
   }
@@ -417,6 +510,74 @@ std::vector<mojom::ConversationPtr> AIChatDatabase::GetAllConversations() {
   return conversation_list;
 }
 
+std::vector<std::string> AIChatDatabase::GetConversationUuidsInTimeRange(
+    std::optional<base::Time> begin_time,
+    std::optional<base::Time> end_time) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (!LazyInit()) {
+    return {};
+  }
+
+  static constexpr char kQuery[] =
+      "SELECT conversation_uuid FROM conversation_entry"
+      " GROUP BY conversation_uuid"
+      " HAVING MAX(date) >= ? AND MAX(date) <= ?";
+  sql::Statement statement(GetDB().GetCachedStatement(SQL_FROM_HERE, kQuery));
+  CHECK(statement.is_valid());
+  statement.BindTime(0, begin_time.value_or(base::Time()));
+  statement.BindTime(1, end_time.value_or(base::Time::Max()));
+
+  std::vector<std::string> conversation_uuids;
+  while (statement.Step()) {
+    conversation_uuids.push_back(statement.ColumnString(0));
+  }
+  return conversation_uuids;
+}
+
+std::vector<std::string> AIChatDatabase::SearchConversations(
+    std::string_view query,
+    size_t max_results) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (!LazyInit()) {
+    return {};
+  }
+
+  std::vector<std::string> terms;
+  AppendSearchTerms(query, terms);
+  SortAndDeduplicate(terms);
+  if (terms.size() > kMaxSearchQueryTerms) {
+    terms.resize(kMaxSearchQueryTerms);
+  }
+  if (terms.empty() || max_results == 0) {
+    return {};
+  }
+
+  // A conversation matches when each of the tokens is in any of its entries.
+  const std::string query_sql = base::StrCat(
+      {"SELECT e.conversation_uuid FROM conversation_entry_search_token t"
+       " JOIN conversation_entry e ON e.uuid = t.conversation_entry_uuid"
+       " WHERE t.token IN (",
+       base::JoinString(std::vector<std::string_view>(terms.size(), "?"), ","),
+       ") GROUP BY e.conversation_uuid"
+       " HAVING COUNT(DISTINCT t.token) = ?"
+       " ORDER BY MAX(e.date) DESC LIMIT ?"});
+  sql::Statement statement(GetDB().GetUniqueStatement(query_sql));
+  CHECK(statement.is_valid());
+  int index = 0;
+  for (const auto& term : terms) {
+    const auto token = HashSearchTerm(search_token_key_, term);
+    statement.BindBlob(index++, token);
+  }
+  statement.BindInt(index++, static_cast<int>(terms.size()));
+  statement.BindInt64(index++, base::checked_cast<int64_t>(max_results));
+
+  std::vector<std::string> conversation_uuids;
+  while (statement.Step()) {
+    conversation_uuids.push_back(statement.ColumnString(0));
+  }
+  return conversation_uuids;
+}
+
 mojom::ConversationArchivePtr AIChatDatabase::GetConversationData(
     std::string_view conversation_uuid) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
@@ -434,11 +595,7 @@ std::vector<mojom::ConversationTurnPtr> AIChatDatabase::GetConversationEntries(
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
   static constexpr char kEntriesQuery[] =
-      "SELECT uuid, date, entry_text, prompt, character_type, "
-      "editing_entry_uuid, "
-      // Note: Column name kept as 'smart_mode_data' for backward compatibility
-      // (feature is now called 'skills').
-      "action_type, selected_text, model_key, smart_mode_data, is_near_verified"
+      "SELECT " ENTRY_COLUMNS
       " FROM conversation_entry"
       " WHERE conversation_uuid=?"
       " ORDER BY date ASC";
@@ -455,185 +612,9 @@ std::vector<mojom::ConversationTurnPtr> AIChatDatabase::GetConversationEntries(
   std::map<std::string, std::vector<mojom::ConversationTurnPtr>> edits;
 
   while (statement.Step()) {
-    // basic metadata
-    std::string entry_uuid = statement.ColumnString(0);
-    DVLOG(4) << "Found entry row for conversation " << conversation_uuid
-             << " with id " << entry_uuid;
-    int index = 1;
-    auto date = statement.ColumnTime(index++);
-    auto text = DecryptOptionalColumnToString(statement, index++).value_or("");
-    auto prompt = DecryptOptionalColumnToString(statement, index++);
-    auto character_type =
-        static_cast<mojom::CharacterType>(statement.ColumnInt(index++));
-    auto editing_entry_id = GetOptionalString(statement, index++);
-    auto action_type =
-        static_cast<mojom::ActionType>(statement.ColumnInt(index++));
-    auto selected_text = DecryptOptionalColumnToString(statement, index++);
-    auto model_key = GetOptionalString(statement, index++);
-
-    // Deserialize skill data
-    mojom::SkillEntryPtr skill = nullptr;
-    auto skill_data = DecryptOptionalColumnToString(statement, index++);
-    if (skill_data.has_value() && !skill_data.value().empty()) {
-      store::SkillEntryProto proto_skill;
-      if (proto_skill.ParseFromString(skill_data.value())) {
-        skill = DeserializeSkillEntry(proto_skill);
-      }
-    }
-
-    // Retrieve is_near_verified
-    mojom::NEARVerificationStatusPtr near_verification_status;
-    if (statement.GetColumnType(index) != sql::ColumnType::kNull) {
-      near_verification_status =
-          mojom::NEARVerificationStatus::New(statement.ColumnBool(index));
-    }
-    index++;
-
-    auto entry = mojom::ConversationTurn::New(
-        entry_uuid, character_type, action_type, text, prompt, selected_text,
-        std::nullopt, date, std::nullopt, std::nullopt, std::move(skill), false,
-        model_key, std::move(near_verification_status));
-
-    // events
-    struct Event {
-      int event_order;
-      mojom::ConversationEntryEventPtr event;
-    };
-    std::vector<Event> events;
-
-    // Completion events
-    {
-      sql::Statement event_statement(
-          GetDB().GetCachedStatement(SQL_FROM_HERE,
-                                     "SELECT event_order, text"
-                                     " FROM conversation_entry_event_completion"
-                                     " WHERE conversation_entry_uuid=?"
-                                     " ORDER BY event_order ASC"));
-      event_statement.BindString(0, entry_uuid);
-
-      while (event_statement.Step()) {
-        int event_order = event_statement.ColumnInt(0);
-        std::string completion = DecryptColumnToString(event_statement, 1);
-        events.emplace_back(Event{
-            event_order, mojom::ConversationEntryEvent::NewCompletionEvent(
-                             mojom::CompletionEvent::New(completion))});
-      }
-    }
-
-    // Search Query events
-    {
-      sql::Statement event_statement(GetDB().GetUniqueStatement(
-          "SELECT event_order, queries"
-          " FROM conversation_entry_event_search_queries"
-          " WHERE conversation_entry_uuid=?"
-          " ORDER BY event_order ASC"));
-      event_statement.BindString(0, entry_uuid);
-
-      while (event_statement.Step()) {
-        int event_order = event_statement.ColumnInt(0);
-        auto queries_data = DecryptColumnToString(event_statement, 1);
-        std::vector<std::string> queries =
-            base::SplitString(queries_data, kSearchQueriesSeparator,
-                              base::WhitespaceHandling::TRIM_WHITESPACE,
-                              base::SplitResult::SPLIT_WANT_NONEMPTY);
-        events.emplace_back(Event{
-            event_order, mojom::ConversationEntryEvent::NewSearchQueriesEvent(
-                             mojom::SearchQueriesEvent::New(queries))});
-      }
-    }
-
-    // Web Source events
-    {
-      sql::Statement event_statement(GetDB().GetUniqueStatement(
-          "SELECT event_order, sources_serialized"
-          " FROM conversation_entry_event_web_sources"
-          " WHERE conversation_entry_uuid=?"
-          " ORDER BY event_order ASC"));
-      event_statement.BindString(0, entry_uuid);
-
-      while (event_statement.Step()) {
-        int event_order = event_statement.ColumnInt(0);
-        auto data = DecryptColumnToString(event_statement, 1);
-        store::WebSourcesEventProto proto_event;
-        if (proto_event.ParseFromString(data)) {
-          mojom::WebSourcesEventPtr mojom_event =
-              DeserializeWebSourcesEvent(proto_event);
-          if (mojom_event->sources.empty()) {
-            DVLOG(0) << "Empty WebSourcesEvent found in database for entry "
-                     << entry_uuid;
-            continue;
-          }
-          events.emplace_back(
-              Event{event_order, mojom::ConversationEntryEvent::NewSourcesEvent(
-                                     std::move(mojom_event))});
-        }
-      }
-    }
-
-    // Tool use events
-    {
-      sql::Statement event_statement(
-          GetDB().GetCachedStatement(SQL_FROM_HERE,
-                                     "SELECT event_order, tool_use_serialized"
-                                     " FROM conversation_entry_event_tool_use"
-                                     " WHERE conversation_entry_uuid=?"
-                                     " ORDER BY event_order ASC"));
-      event_statement.BindString(0, entry_uuid);
-
-      while (event_statement.Step()) {
-        int event_order = event_statement.ColumnInt(0);
-        auto data = DecryptColumnToString(event_statement, 1);
-        store::ToolUseEventProto proto_event;
-        if (proto_event.ParseFromString(data)) {
-          mojom::ToolUseEventPtr mojom_event =
-              DeserializeToolUseEvent(proto_event);
-          if (!mojom_event) {
-            DLOG(ERROR) << "Invalid ToolUseEvent found in database for entry "
-                        << entry_uuid;
-            continue;
-          }
-          events.emplace_back(
-              Event{event_order, mojom::ConversationEntryEvent::NewToolUseEvent(
-                                     std::move(mojom_event))});
-        }
-      }
-    }
-
-    // insert events in order
-    if (!events.empty()) {
-      std::ranges::sort(events, [](const Event& a, const Event& b) {
-        return a.event_order < b.event_order;
-      });
-      entry->events = std::vector<mojom::ConversationEntryEventPtr>{};
-      for (auto& event : events) {
-        entry->events->emplace_back(std::move(event.event));
-      }
-    }
-
-    // Uploaded files
-    sql::Statement uploaded_file_statement(
-        GetDB().GetUniqueStatement("SELECT filename, filesize, data, type"
-                                   " FROM conversation_entry_uploaded_files"
-                                   " WHERE conversation_entry_uuid=?"
-                                   " ORDER BY file_order ASC"));
-    uploaded_file_statement.BindString(0, entry_uuid);
-
-    while (uploaded_file_statement.Step()) {
-      auto filename = DecryptColumnToString(uploaded_file_statement, 0);
-      int64_t filesize = uploaded_file_statement.ColumnInt64(1);
-      auto decrypted_bytes_str =
-          DecryptColumnToString(uploaded_file_statement, 2);
-      base::span<const uint8_t> raw_bytes =
-          base::as_byte_span(decrypted_bytes_str);
-      std::vector<uint8_t> data(raw_bytes.begin(), raw_bytes.end());
-      auto type = static_cast<mojom::UploadedFileType>(
-          uploaded_file_statement.ColumnInt(3));
-      if (!entry->uploaded_files) {
-        entry->uploaded_files = std::vector<mojom::UploadedFilePtr>{};
-      }
-      entry->uploaded_files->emplace_back(mojom::UploadedFile::New(
-          std::move(filename), filesize, std::move(data), type));
-    }
+    std::optional<std::string> editing_entry_id;
+    auto entry = ReadConversationEntry(statement, editing_entry_id);
+    auto entry_uuid = entry->uuid.value();
 
     // root entry or edited entry
     if (editing_entry_id.has_value()) {
@@ -661,6 +642,245 @@ std::vector<mojom::ConversationTurnPtr> AIChatDatabase::GetConversationEntries(
   return history;
 }
 
+std::vector<mojom::ConversationTurnPtr>
+AIChatDatabase::GetConversationEntriesPage(std::string_view conversation_uuid,
+                                           std::optional<base::Time> before,
+                                           size_t max_count) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (!LazyInit() || max_count == 0) {
+    return {};
+  }
+
+  // Served by the conversation_entry_conversation_uuid_date index, so only
+  // the rows of the requested page are read and decrypted.
+  static constexpr char kPageQuery[] =
+      "SELECT " ENTRY_COLUMNS
+      " FROM conversation_entry"
+      " WHERE conversation_uuid=? AND editing_entry_uuid IS NULL AND date<?"
+      " ORDER BY date DESC LIMIT ?";
+  sql::Statement statement(
+      GetDB().GetCachedStatement(SQL_FROM_HERE, kPageQuery));
+  CHECK(statement.is_valid());
+  statement.BindString(0, conversation_uuid);
+  statement.BindTime(1, before.value_or(base::Time::Max()));
+  statement.BindInt64(2, base::checked_cast<int64_t>(max_count));
+
+  std::vector<mojom::ConversationTurnPtr> page;
+  while (statement.Step()) {
+    std::optional<std::string> editing_entry_id;
+    page.emplace_back(ReadConversationEntry(statement, editing_entry_id));
+    DCHECK(!editing_entry_id.has_value());
+  }
+
+  static constexpr char kEditsQuery[] =
+      "SELECT " ENTRY_COLUMNS
+      " FROM conversation_entry"
+      " WHERE editing_entry_uuid=?"
+      " ORDER BY date ASC";
+  for (auto& entry : page) {
+    sql::Statement edits_statement(
+        GetDB().GetCachedStatement(SQL_FROM_HERE, kEditsQuery));
+    CHECK(edits_statement.is_valid());
+    edits_statement.BindString(0, entry->uuid.value());
+    while (edits_statement.Step()) {
+      std::optional<std::string> editing_entry_id;
+      if (!entry->edits) {
+        entry->edits = std::vector<mojom::ConversationTurnPtr>{};
+      }
+      entry->edits->emplace_back(
+          ReadConversationEntry(edits_statement, editing_entry_id));
+    }
+  }
+
+  return page;
+}
+
+mojom::ConversationTurnPtr AIChatDatabase::ReadConversationEntry(
+    sql::Statement& statement,
+    std::optional<std::string>& editing_entry_id) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  // basic metadata
+  std::string entry_uuid = statement.ColumnString(0);
+  DVLOG(4) << "Found entry row with id " << entry_uuid;
+  int index = 1;
+  auto date = statement.ColumnTime(index++);
+  auto text = DecryptOptionalColumnToString(statement, index++).value_or("");
+  auto prompt = DecryptOptionalColumnToString(statement, index++);
+  auto character_type =
+      static_cast<mojom::CharacterType>(statement.ColumnInt(index++));
+  editing_entry_id = GetOptionalString(statement, index++);
+  auto action_type =
+      static_cast<mojom::ActionType>(statement.ColumnInt(index++));
+  auto selected_text = DecryptOptionalColumnToString(statement, index++);
+  auto model_key = GetOptionalString(statement, index++);
+
+  // Deserialize skill data
+  mojom::SkillEntryPtr skill = nullptr;
+  auto skill_data = DecryptOptionalColumnToString(statement, index++);
+  if (skill_data.has_value() && !skill_data.value().empty()) {
+    store::SkillEntryProto proto_skill;
+    if (proto_skill.ParseFromString(skill_data.value())) {
+      skill = DeserializeSkillEntry(proto_skill);
+    }
+  }
+
+  // Retrieve is_near_verified
+  mojom::NEARVerificationStatusPtr near_verification_status;
+  if (statement.GetColumnType(index) != sql::ColumnType::kNull) {
+    near_verification_status =
+        mojom::NEARVerificationStatus::New(statement.ColumnBool(index));
+  }
+  index++;
+
+  auto entry = mojom::ConversationTurn::New(
+      entry_uuid, character_type, action_type, text, prompt, selected_text,
+      std::nullopt, date, std::nullopt, std::nullopt, std::move(skill), false,
+      model_key, std::move(near_verification_status));
+
+  // events
+  struct Event {
+    int event_order;
+    mojom::ConversationEntryEventPtr event;
+  };
+  std::vector<Event> events;
+
+  // Completion events
+  {
+    sql::Statement event_statement(
+        GetDB().GetCachedStatement(SQL_FROM_HERE,
+                                   "SELECT event_order, text"
+                                   " FROM conversation_entry_event_completion"
+                                   " WHERE conversation_entry_uuid=?"
+                                   " ORDER BY event_order ASC"));
+    event_statement.BindString(0, entry_uuid);
+
+    while (event_statement.Step()) {
+      int event_order = event_statement.ColumnInt(0);
+      std::string completion = DecryptColumnToString(event_statement, 1);
+      events.emplace_back(Event{
+          event_order, mojom::ConversationEntryEvent::NewCompletionEvent(
+                           mojom::CompletionEvent::New(completion))});
+    }
+  }
+
+  // Search Query events
+  {
+    sql::Statement event_statement(GetDB().GetUniqueStatement(
+        "SELECT event_order, queries"
+        " FROM conversation_entry_event_search_queries"
+        " WHERE conversation_entry_uuid=?"
+        " ORDER BY event_order ASC"));
+    event_statement.BindString(0, entry_uuid);
+
+    while (event_statement.Step()) {
+      int event_order = event_statement.ColumnInt(0);
+      auto queries_data = DecryptColumnToString(event_statement, 1);
+      std::vector<std::string> queries =
+          base::SplitString(queries_data, kSearchQueriesSeparator,
+                            base::WhitespaceHandling::TRIM_WHITESPACE,
+                            base::SplitResult::SPLIT_WANT_NONEMPTY);
+      events.emplace_back(Event{
+          event_order, mojom::ConversationEntryEvent::NewSearchQueriesEvent(
+                           mojom::SearchQueriesEvent::New(queries))});
+    }
+  }
+
+  // Web Source events
+  {
+    sql::Statement event_statement(GetDB().GetUniqueStatement(
+        "SELECT event_order, sources_serialized"
+        " FROM conversation_entry_event_web_sources"
+        " WHERE conversation_entry_uuid=?"
+        " ORDER BY event_order ASC"));
+    event_statement.BindString(0, entry_uuid);
+
+    while (event_statement.Step()) {
+      int event_order = event_statement.ColumnInt(0);
+      auto data = DecryptColumnToString(event_statement, 1);
+      store::WebSourcesEventProto proto_event;
+      if (proto_event.ParseFromString(data)) {
+        mojom::WebSourcesEventPtr mojom_event =
+            DeserializeWebSourcesEvent(proto_event);
+        if (mojom_event->sources.empty()) {
+          DVLOG(0) << "Empty WebSourcesEvent found in database for entry "
+                   << entry_uuid;
+          continue;
+        }
+        events.emplace_back(
+            Event{event_order, mojom::ConversationEntryEvent::NewSourcesEvent(
+                                   std::move(mojom_event))});
+      }
+    }
+  }
+
+  // Tool use events
+  {
+    sql::Statement event_statement(
+        GetDB().GetCachedStatement(SQL_FROM_HERE,
+                                   "SELECT event_order, tool_use_serialized"
+                                   " FROM conversation_entry_event_tool_use"
+                                   " WHERE conversation_entry_uuid=?"
+                                   " ORDER BY event_order ASC"));
+    event_statement.BindString(0, entry_uuid);
+
+    while (event_statement.Step()) {
+      int event_order = event_statement.ColumnInt(0);
+      auto data = DecryptColumnToString(event_statement, 1);
+      store::ToolUseEventProto proto_event;
+      if (proto_event.ParseFromString(data)) {
+        mojom::ToolUseEventPtr mojom_event =
+            DeserializeToolUseEvent(proto_event);
+        if (!mojom_event) {
+          DLOG(ERROR) << "Invalid ToolUseEvent found in database for entry "
+                      << entry_uuid;
+          continue;
+        }
+        events.emplace_back(
+            Event{event_order, mojom::ConversationEntryEvent::NewToolUseEvent(
+                                   std::move(mojom_event))});
+      }
+    }
+  }
+
+  // insert events in order
+  if (!events.empty()) {
+    std::ranges::sort(events, [](const Event& a, const Event& b) {
+      return a.event_order < b.event_order;
+    });
+    entry->events = std::vector<mojom::ConversationEntryEventPtr>{};
+    for (auto& event : events) {
+      entry->events->emplace_back(std::move(event.event));
+    }
+  }
+
+  // Uploaded files
+  sql::Statement uploaded_file_statement(
+      GetDB().GetUniqueStatement("SELECT filename, filesize, data, type"
+                                 " FROM conversation_entry_uploaded_files"
+                                 " WHERE conversation_entry_uuid=?"
+                                 " ORDER BY file_order ASC"));
+  uploaded_file_statement.BindString(0, entry_uuid);
+
+  while (uploaded_file_statement.Step()) {
+    auto filename = DecryptColumnToString(uploaded_file_statement, 0);
+    int64_t filesize = uploaded_file_statement.ColumnInt64(1);
+    auto decrypted_bytes_str =
+        DecryptColumnToString(uploaded_file_statement, 2);
+    base::span<const uint8_t> raw_bytes =
+        base::as_byte_span(decrypted_bytes_str);
+    std::vector<uint8_t> data(raw_bytes.begin(), raw_bytes.end());
+    auto type = static_cast<mojom::UploadedFileType>(
+        uploaded_file_statement.ColumnInt(3));
+    if (!entry->uploaded_files) {
+      entry->uploaded_files = std::vector<mojom::UploadedFilePtr>{};
+    }
+    entry->uploaded_files->emplace_back(mojom::UploadedFile::New(
+        std::move(filename), filesize, std::move(data), type));
+  }
+
+  return entry;
+}
+
 std::vector<mojom::ContentArchivePtr>
 AIChatDatabase::GetArchiveContentsForConversation(
     std::string_view conversation_uuid) {
@@ -1074,6 +1294,20 @@ bool AIChatDatabase::AddConversationEntry(
     }
   }
 
+  std::vector<std::string> search_terms;
+  AppendSearchTerms(entry->text, search_terms);
+  if (entry->events.has_value()) {
+    for (const auto& event : entry->events.value()) {
+      if (event->is_completion_event()) {
+        AppendSearchTerms(event->get_completion_event()->completion,
+                          search_terms);
+      }
+    }
+  }
+  if (!AddSearchTokens(entry->uuid.value(), std::move(search_terms))) {
+    return false;
+  }
+
   if (entry->edits.has_value()) {
     for (auto& edit : entry->edits.value()) {
       if (!AddConversationEntry(conversation_uuid, std::move(edit),
@@ -1225,6 +1459,43 @@ bool AIChatDatabase::UpdateConversationTokenInfo(
   return statement.Run();
 }
 
+bool AIChatDatabase::UpdateConversations(
+    std::vector<std::pair<std::string, ConversationUpdates>> updates) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  DVLOG(4) << __func__ << " for " << updates.size() << " conversations";
+  if (!LazyInit()) {
+    return false;
+  }
+
+  sql::Transaction transaction(&GetDB());
+  if (!transaction.Begin()) {
+    DVLOG(0) << "Transaction cannot begin";
+    return false;
+  }
+
+  for (auto& [conversation_uuid, conversation_updates] : updates) {
+    if (conversation_updates.title.has_value() &&
+        !UpdateConversationTitle(conversation_uuid,
+                                 conversation_updates.title.value())) {
+      return false;
+    }
+    if (conversation_updates.token_info.has_value() &&
+        !UpdateConversationTokenInfo(
+            conversation_uuid, conversation_updates.token_info->total_tokens,
+            conversation_updates.token_info->trimmed_tokens)) {
+      return false;
+    }
+    for (auto& tool_use : conversation_updates.tool_use_events) {
+      // Invalid events are skipped rather than failing the batch, matching
+      // the outcome of persisting them individually.
+      UpdateToolUseEvent(tool_use.entry_uuid, tool_use.event_order,
+                         std::move(tool_use.tool_use_event));
+    }
+  }
+
+  return transaction.Commit();
+}
+
 bool AIChatDatabase::DeleteConversation(std::string_view conversation_uuid) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   if (!LazyInit()) {
@@ -1282,6 +1553,17 @@ bool AIChatDatabase::DeleteConversation(std::string_view conversation_uuid) {
       return false;
     }
 
+    static constexpr char kDeleteSearchTokensQuery[] =
+        "DELETE FROM conversation_entry_search_token"
+        " WHERE conversation_entry_uuid=?";
+    sql::Statement delete_search_tokens_statement(
+        GetDB().GetUniqueStatement(kDeleteSearchTokensQuery));
+    CHECK(delete_search_tokens_statement.is_valid());
+    delete_search_tokens_statement.BindString(0, conversation_entry_uuid);
+    if (!delete_search_tokens_statement.Run()) {
+      return false;
+    }
+
     static constexpr char kDeleteEntryQuery[] =
         "DELETE FROM conversation_entry WHERE uuid=?";
     sql::Statement delete_conversation_entry_statement(
@@ -1409,6 +1691,25 @@ bool AIChatDatabase::DeleteConversationEntry(
     }
   }
 
+  // Delete from conversation_entry_search_token, for the entry and its edits
+  {
+    static constexpr char kQuery[] =
+        "DELETE FROM conversation_entry_search_token WHERE "
+        "conversation_entry_uuid=? OR conversation_entry_uuid IN ("
+        " SELECT uuid FROM conversation_entry WHERE editing_entry_uuid=?)";
+    sql::Statement delete_statement(GetDB().GetUniqueStatement(kQuery));
+    CHECK(delete_statement.is_valid());
+    delete_statement.BindString(0, conversation_entry_uuid);
+    delete_statement.BindString(1, conversation_entry_uuid);
+    if (!delete_statement.Run()) {
+      DLOG(ERROR) << "Failed to delete from "
+                     "conversation_entry_search_token for conversation "
+                     "entry uuid: "
+                  << conversation_entry_uuid;
+      return false;
+    }
+  }
+
   // Delete edits
   {
     static constexpr char kQuery[] =
@@ -1577,6 +1878,91 @@ bool AIChatDatabase::BindAndEncryptString(sql::Statement& statement,
   return true;
 }
 
+bool AIChatDatabase::InitSearchTokenKey(sql::MetaTable& meta_table) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  std::string encoded_key;
+  if (meta_table.GetValue(kSearchTokenKeyMetaKey, &encoded_key)) {
+    std::optional<std::vector<uint8_t>> encrypted_key =
+        base::Base64Decode(encoded_key);
+    std::optional<std::string> key;
+    if (encrypted_key) {
+      key = encryptor_.DecryptData(*encrypted_key);
+    }
+    if (key && key->size() == kSearchTokenKeySize) {
+      search_token_key_.assign(key->begin(), key->end());
+      return true;
+    }
+    // Tokens hashed with a key that can't be read are useless.
+    DVLOG(0) << "Failed to decrypt search token key, rebuilding index";
+    if (!GetDB().Execute("DELETE FROM conversation_entry_search_token")) {
+      return false;
+    }
+  }
+
+  search_token_key_ = crypto::RandBytesAsVector(kSearchTokenKeySize);
+  std::optional<std::vector<uint8_t>> encrypted_key =
+      encryptor_.EncryptString(
+          std::string(base::as_string_view(search_token_key_)));
+  if (!encrypted_key ||
+      !meta_table.SetValue(kSearchTokenKeyMetaKey,
+                           base::Base64Encode(*encrypted_key))) {
+    return false;
+  }
+
+  // Entries persisted before the index existed still need to be found.
+  return IndexAllConversationEntries();
+}
+
+bool AIChatDatabase::AddSearchTokens(std::string_view conversation_entry_uuid,
+                                     std::vector<std::string> terms) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  SortAndDeduplicate(terms);
+  for (const auto& term : terms) {
+    sql::Statement statement(GetDB().GetCachedStatement(
+        SQL_FROM_HERE,
+        "INSERT OR IGNORE INTO conversation_entry_search_token"
+        " (token, conversation_entry_uuid) VALUES(?, ?)"));
+    CHECK(statement.is_valid());
+    const auto token = HashSearchTerm(search_token_key_, term);
+    statement.BindBlob(0, token);
+    statement.BindString(1, conversation_entry_uuid);
+    if (!statement.Run()) {
+      DVLOG(0) << "Failed to insert search token: " << db_.GetErrorMessage();
+      return false;
+    }
+  }
+  return true;
+}
+
+bool AIChatDatabase::IndexAllConversationEntries() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  sql::Statement entry_statement(GetDB().GetUniqueStatement(
+      "SELECT uuid, entry_text FROM conversation_entry"));
+  CHECK(entry_statement.is_valid());
+  while (entry_statement.Step()) {
+    std::vector<std::string> terms;
+    AppendSearchTerms(
+        DecryptOptionalColumnToString(entry_statement, 1).value_or(""), terms);
+    if (!AddSearchTokens(entry_statement.ColumnString(0), std::move(terms))) {
+      return false;
+    }
+  }
+
+  sql::Statement completion_statement(GetDB().GetUniqueStatement(
+      "SELECT conversation_entry_uuid, text"
+      " FROM conversation_entry_event_completion"));
+  CHECK(completion_statement.is_valid());
+  while (completion_statement.Step()) {
+    std::vector<std::string> terms;
+    AppendSearchTerms(DecryptColumnToString(completion_statement, 1), terms);
+    if (!AddSearchTokens(completion_statement.ColumnString(0),
+                         std::move(terms))) {
+      return false;
+    }
+  }
+  return entry_statement.Succeeded() && completion_statement.Succeeded();
+}
+
 bool AIChatDatabase::CreateSchema() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   static constexpr char kCreateConversationTableQuery[] =
@@ -1619,6 +2005,14 @@ bool AIChatDatabase::CreateSchema() {
     return false;
   }
 
+  static constexpr char kCreateAssociatedContentConversationIndexQuery[] =
+      "CREATE INDEX IF NOT EXISTS associated_content_conversation_uuid"
+      " ON associated_content(conversation_uuid)";
+  CHECK(GetDB().IsSQLValid(kCreateAssociatedContentConversationIndexQuery));
+  if (!GetDB().Execute(kCreateAssociatedContentConversationIndexQuery)) {
+    return false;
+  }
+
   // AKA ConversationTurn in mojom
   static constexpr char kCreateConversationEntryTableQuery[] =
       "CREATE TABLE IF NOT EXISTS conversation_entry("
@@ -1651,6 +2045,25 @@ bool AIChatDatabase::CreateSchema() {
     return false;
   }
 
+  // Entries are looked up per conversation in date order, and edits by the
+  // entry they edit. The columns exist in every schema version, so the
+  // indexes are also created for databases which are already migrated.
+  static constexpr char kCreateConversationEntryDateIndexQuery[] =
+      "CREATE INDEX IF NOT EXISTS conversation_entry_conversation_uuid_date"
+      " ON conversation_entry(conversation_uuid, date)";
+  CHECK(GetDB().IsSQLValid(kCreateConversationEntryDateIndexQuery));
+  if (!GetDB().Execute(kCreateConversationEntryDateIndexQuery)) {
+    return false;
+  }
+
+  static constexpr char kCreateConversationEntryEditingIndexQuery[] =
+      "CREATE INDEX IF NOT EXISTS conversation_entry_editing_entry_uuid"
+      " ON conversation_entry(editing_entry_uuid)";
+  CHECK(GetDB().IsSQLValid(kCreateConversationEntryEditingIndexQuery));
+  if (!GetDB().Execute(kCreateConversationEntryEditingIndexQuery)) {
+    return false;
+  }
+
   // TODO(petemill): Consider storing all conversation entry events in a
   // single table, with serialized data in protocol buffers format. If we need
   // to add search capability for the encrypted data, we could store some
@@ -1726,6 +2139,31 @@ bool AIChatDatabase::CreateSchema() {
     return false;
   }
 
+  // Inverted index of the words in conversation entries and their completions,
+  // so that conversations can be searched without decrypting every entry. It
+  // is created for databases which are already migrated, and filled in when
+  // the search token key is generated.
+  static constexpr char kCreateSearchTokenTableQuery[] =
+      "CREATE TABLE IF NOT EXISTS conversation_entry_search_token("
+      // Truncated HMAC of a lower-cased word, keyed with the encrypted
+      // search_token_key from the meta table.
+      "token BLOB NOT NULL,"
+      "conversation_entry_uuid TEXT NOT NULL,"
+      "PRIMARY KEY(token, conversation_entry_uuid)"
+      ") WITHOUT ROWID";
+  CHECK(GetDB().IsSQLValid(kCreateSearchTokenTableQuery));
+  if (!GetDB().Execute(kCreateSearchTokenTableQuery)) {
+    return false;
+  }
+
+  static constexpr char kCreateSearchTokenEntryIndexQuery[] =
+      "CREATE INDEX IF NOT EXISTS conversation_entry_search_token_entry_uuid"
+      " ON conversation_entry_search_token(conversation_entry_uuid)";
+  CHECK(GetDB().IsSQLValid(kCreateSearchTokenEntryIndexQuery));
+  if (!GetDB().Execute(kCreateSearchTokenEntryIndexQuery)) {
+    return false;
+  }
+
   return true;
 }
 
@@ -9,22 +9,60 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include "base/sequence_checker.h"
 #include "base/thread_annotations.h"
+#include "base/time/time.h"
 #include "brave/components/ai_chat/core/common/mojom/ai_chat.mojom-forward.h"
 #include "brave/components/ai_chat/core/common/mojom/common.mojom-forward.h"
 #include "components/os_crypt/async/common/encryptor.h"
 #include "sql/database.h"
 #include "sql/init_status.h"
 
+namespace sql {
+class MetaTable;
+}  // namespace sql
+
 namespace ai_chat {
 
 extern const int kLowestSupportedDatabaseVersion;
 extern const int kCompatibleDatabaseVersionNumber;
 extern const int kCurrentDatabaseVersion;
 
+// Latest values of conversation properties which change often whilst a
+// conversation is in progress, collected so that they can be written in a
+// single transaction.
+struct ConversationUpdates {
+  struct TokenInfo {
+    uint64_t total_tokens = 0;
+    uint64_t trimmed_tokens = 0;
+  };
+
+  struct ToolUseEventUpdate {
+    ToolUseEventUpdate(std::string entry_uuid,
+                       size_t event_order,
+                       mojom::ToolUseEventPtr tool_use_event);
+    ToolUseEventUpdate(ToolUseEventUpdate&&);
+    ToolUseEventUpdate& operator=(ToolUseEventUpdate&&);
+    ~ToolUseEventUpdate();
+
+    std::string entry_uuid;
+    size_t event_order;
+    mojom::ToolUseEventPtr tool_use_event;
+  };
+
+  ConversationUpdates();
+  ConversationUpdates(ConversationUpdates&&);
+  ConversationUpdates& operator=(ConversationUpdates&&);
+  ~ConversationUpdates();
+
+  std::optional<std::string> title;
+  std::optional<TokenInfo> token_info;
+  std::vector<ToolUseEventUpdate> tool_use_events;
+};
+
 // Persists AI Chat conversations and associated content. Conversations are
 // mainly formed of their conversation entries. Edits to conversation entries
 // should be handled with removal and re-adding so that other classes can make
@@ -42,10 +80,33 @@ class AIChatDatabase {
   // data is returned.
   virtual std::vector<mojom::ConversationPtr> GetAllConversations();
 
+  // Gets the uuids of conversations which were last updated between
+  // |begin_time| and |end_time|. Only reads the conversation entry date index,
+  // so nothing needs to be decrypted.
+  virtual std::vector<std::string> GetConversationUuidsInTimeRange(
+      std::optional<base::Time> begin_time,
+      std::optional<base::Time> end_time);
+
+  // Gets the uuids of up to |max_results| conversations which contain every
+  // word of |query|, ordered by their most recent matching entry first. Words
+  // are matched whole and case-insensitively via the search token index, so
+  // nothing needs to be decrypted.
+  virtual std::vector<std::string> SearchConversations(std::string_view query,
+                                                       size_t max_results);
+
   // Gets all data needed to rehydrate a conversation
   virtual mojom::ConversationArchivePtr GetConversationData(
       std::string_view conversation_uuid);
 
+  // Gets up to |max_count| root entries of a conversation, newest first, that
+  // are older than |before| (or the newest entries when not provided), along
+  // with their edits. Pass the date of the oldest returned entry as |before|
+  // to fetch the next page.
+  virtual std::vector<mojom::ConversationTurnPtr> GetConversationEntriesPage(
+      std::string_view conversation_uuid,
+      std::optional<base::Time> before,
+      size_t max_count);
+
   // Returns new ID for the provided entry and any provided associated content
   virtual bool AddConversation(mojom::ConversationPtr conversation,
                                std::vector<std::string> contents,
@@ -80,6 +141,11 @@ class AIChatDatabase {
                                            uint64_t total_tokens,
                                            uint64_t trimmed_tokens);
 
+  // Writes all of the |updates|, keyed by conversation UUID, in a single
+  // transaction. Nothing is written if any of the updates fail.
+  virtual bool UpdateConversations(
+      std::vector<std::pair<std::string, ConversationUpdates>> updates);
+
   // Deletes the conversation with the provided UUID
   virtual bool DeleteConversation(std::string_view conversation_uuid);
 
@@ -108,6 +174,11 @@ class AIChatDatabase {
 
   std::vector<mojom::ConversationTurnPtr> GetConversationEntries(
       std::string_view conversation_id);
+  // Reads the conversation entry at the current row of |statement|, including
+  // its events and uploaded files.
+  mojom::ConversationTurnPtr ReadConversationEntry(
+      sql::Statement& statement,
+      std::optional<std::string>& editing_entry_id);
   std::vector<mojom::ContentArchivePtr> GetArchiveContentsForConversation(
       std::string_view conversation_uuid);
 
@@ -124,12 +195,23 @@ class AIChatDatabase {
 
   bool CreateSchema();
 
+  // Reads the key which search tokens are hashed with from |meta_table|, or
+  // generates and stores a new one and indexes all existing entries with it.
+  bool InitSearchTokenKey(sql::MetaTable& meta_table);
+  // Adds the hashed search tokens for |terms| to the conversation entry.
+  bool AddSearchTokens(std::string_view conversation_entry_uuid,
+                       std::vector<std::string> terms);
+  bool IndexAllConversationEntries();
+
   // The directory storing the database.
   const base::FilePath db_file_path_;
 
   // The underlying SQL database
   sql::Database db_ GUARDED_BY_CONTEXT(sequence_checker_);
   os_crypt_async::Encryptor encryptor_ GUARDED_BY_CONTEXT(sequence_checker_);
+  // Random key for hashing search tokens, stored encrypted in the meta table.
+  std::vector<uint8_t> search_token_key_
+      GUARDED_BY_CONTEXT(sequence_checker_);
   // The initialization status of the database. It's not set if never attempted.
   std::optional<sql::InitStatus> db_init_status_ = std::nullopt;
 
@@ -20,6 +20,7 @@
 #include "base/path_service.h"
 #include "base/run_loop.h"
 #include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/test/task_environment.h"
 #include "base/test/test_future.h"
 #include "base/time/time.h"
@@ -32,6 +33,7 @@
 #include "sql/init_status.h"
 #include "sql/meta_table.h"
 #include "sql/test/test_helpers.h"
+#include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/abseil-cpp/absl/strings/str_format.h"
 
@@ -262,6 +264,124 @@ TEST_P(AIChatDatabaseTest, AddAndGetConversationAndEntries) {
   EXPECT_EQ(conversations.size(), 0u);
 }
 
+TEST_P(AIChatDatabaseTest, GetConversationEntriesPage) {
+  const std::string uuid = "paged";
+  auto history = CreateSampleChatHistory(3u);
+  ASSERT_EQ(history.size(), 6u);
+  const mojom::ConversationPtr metadata = mojom::Conversation::New(
+      uuid, "title", base::Time::Now(), true, std::nullopt, 0, 0, false,
+      std::vector<mojom::AssociatedContentPtr>());
+  EXPECT_TRUE(db_->AddConversation(metadata->Clone(), {}, history[0]->Clone()));
+  for (size_t i = 1; i < history.size(); ++i) {
+    EXPECT_TRUE(db_->AddConversationEntry(uuid, history[i]->Clone()));
+  }
+
+  // Edit the oldest query so that edits are returned with their entry.
+  history[0]->edits = std::vector<mojom::ConversationTurnPtr>{};
+  history[0]->edits->emplace_back(mojom::ConversationTurn::New(
+      base::Uuid::GenerateRandomV4().AsLowercaseString(),
+      mojom::CharacterType::HUMAN, mojom::ActionType::QUERY, "edited query",
+      std::nullopt, std::nullopt, std::nullopt,
+      base::Time::Now() + base::Hours(1), std::nullopt, std::nullopt,
+      nullptr /* skill */, false, std::nullopt, nullptr));
+  EXPECT_TRUE(db_->DeleteConversationEntry(history[0]->uuid.value()));
+  EXPECT_TRUE(db_->AddConversationEntry(uuid, history[0]->Clone()));
+
+  // Newest entries first
+  auto first_page = db_->GetConversationEntriesPage(uuid, std::nullopt, 4u);
+  ASSERT_EQ(first_page.size(), 4u);
+  for (size_t i = 0; i < first_page.size(); ++i) {
+    ExpectConversationEntryEquals(FROM_HERE, first_page[i],
+                                  history[history.size() - 1 - i]);
+  }
+
+  // The next page continues from the oldest entry of the previous one
+  auto second_page = db_->GetConversationEntriesPage(
+      uuid, first_page.back()->created_time, 4u);
+  ASSERT_EQ(second_page.size(), 2u);
+  ExpectConversationEntryEquals(FROM_HERE, second_page[0], history[1]);
+  ExpectConversationEntryEquals(FROM_HERE, second_page[1], history[0]);
+  ASSERT_TRUE(second_page[1]->edits.has_value());
+  EXPECT_EQ(second_page[1]->edits->size(), 1u);
+
+  EXPECT_TRUE(db_
+                  ->GetConversationEntriesPage(
+                      uuid, second_page.back()->created_time, 4u)
+                  .empty());
+  EXPECT_TRUE(db_->GetConversationEntriesPage("unknown", std::nullopt, 4u)
+                  .empty());
+}
+
+TEST_P(AIChatDatabaseTest, GetConversationUuidsInTimeRange) {
+  // Conversations last updated 3, 2 and 1 hours ago.
+  for (int hours_ago = 3; hours_ago > 0; --hours_ago) {
+    const std::string uuid = "conversation" + base::NumberToString(hours_ago);
+    auto history = CreateSampleChatHistory(1u, -hours_ago);
+    const mojom::ConversationPtr metadata = mojom::Conversation::New(
+        uuid, "title", base::Time::Now(), true, std::nullopt, 0, 0, false,
+        std::vector<mojom::AssociatedContentPtr>());
+    EXPECT_TRUE(
+        db_->AddConversation(metadata->Clone(), {}, history[0]->Clone()));
+    EXPECT_TRUE(db_->AddConversationEntry(uuid, history[1]->Clone()));
+  }
+
+  auto uuids = db_->GetConversationUuidsInTimeRange(
+      base::Time::Now() - base::Minutes(245),
+      base::Time::Now() - base::Minutes(110));
+  EXPECT_THAT(uuids, testing::UnorderedElementsAre("conversation3",
+                                                   "conversation2"));
+
+  uuids = db_->GetConversationUuidsInTimeRange(
+      base::Time::Now() - base::Minutes(90), std::nullopt);
+  EXPECT_THAT(uuids, testing::UnorderedElementsAre("conversation1"));
+
+  EXPECT_EQ(
+      db_->GetConversationUuidsInTimeRange(std::nullopt, std::nullopt).size(),
+      3u);
+}
+
+TEST_P(AIChatDatabaseTest, SearchConversations) {
+  // Conversations last updated 2 and 1 hours ago, with the same sample text
+  // except for the first query of the second conversation.
+  std::vector<std::string> entry_uuids;
+  for (int hours_ago = 2; hours_ago > 0; --hours_ago) {
+    const std::string uuid = "conversation" + base::NumberToString(hours_ago);
+    auto history = CreateSampleChatHistory(1u, -hours_ago);
+    if (hours_ago == 1) {
+      history[0]->text = "Tell me about TARDIGRADES, please";
+    }
+    entry_uuids.push_back(history[0]->uuid.value());
+    const mojom::ConversationPtr metadata = mojom::Conversation::New(
+        uuid, "title", base::Time::Now(), true, std::nullopt, 0, 0, false,
+        std::vector<mojom::AssociatedContentPtr>());
+    EXPECT_TRUE(
+        db_->AddConversation(metadata->Clone(), {}, history[0]->Clone()));
+    EXPECT_TRUE(db_->AddConversationEntry(uuid, history[1]->Clone()));
+  }
+
+  // Words of completions match, most recent conversation first.
+  EXPECT_THAT(db_->SearchConversations("Generated response", 10u),
+              testing::ElementsAre("conversation1", "conversation2"));
+  EXPECT_THAT(db_->SearchConversations("generated", 1u),
+              testing::ElementsAre("conversation1"));
+  // Words are matched case-insensitively and across entries.
+  EXPECT_THAT(db_->SearchConversations("tardigrades generated", 10u),
+              testing::ElementsAre("conversation1"));
+  EXPECT_TRUE(db_->SearchConversations("tardigrades xylophone", 10u).empty());
+  EXPECT_TRUE(db_->SearchConversations("tardi", 10u).empty());
+  EXPECT_TRUE(db_->SearchConversations("", 10u).empty());
+
+  // Deleted entries and conversations are removed from the index.
+  EXPECT_TRUE(db_->DeleteConversationEntry(entry_uuids[1]));
+  EXPECT_TRUE(db_->SearchConversations("tardigrades", 10u).empty());
+  EXPECT_TRUE(db_->DeleteConversation("conversation2"));
+  EXPECT_THAT(db_->SearchConversations("generated", 10u),
+              testing::ElementsAre("conversation1"));
+
+  EXPECT_TRUE(db_->DeleteAllData());
+  EXPECT_TRUE(db_->SearchConversations("generated", 10u).empty());
+}
+
 TEST_P(AIChatDatabaseTest, WebSourcesEvent) {
   const std::string uuid = "first";
   const GURL page_url = GURL("https://example.com/page");
@@ -24,8 +24,11 @@
 #include "base/containers/fixed_flat_set.h"
 #include "base/functional/bind.h"
 #include "base/functional/callback_helpers.h"
+#include "base/json/values_util.h"
 #include "base/logging.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/numerics/clamped_math.h"
+#include "base/numerics/safe_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/task/task_traits.h"
 #include "base/task/thread_pool.h"
@@ -55,6 +58,7 @@
 #include "build/build_config.h"
 #include "components/os_crypt/async/browser/os_crypt_async.h"
 #include "components/prefs/pref_service.h"
+#include "components/prefs/scoped_user_pref_update.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "mojo/public/cpp/bindings/struct_ptr.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
@@ -66,6 +70,10 @@ namespace {
 constexpr base::FilePath::StringViewType kDBFileName =
     FILE_PATH_LITERAL("AIChat");
 
+// How long frequently changing conversation properties are buffered before
+// being written to the database, if nothing else causes a write first.
+constexpr base::TimeDelta kConversationUpdatesFlushDelay = base::Seconds(2);
+
 /**
  * @brief Sorts conversations by their updated time in descending order.
  *
@@ -203,6 +211,9 @@ void AIChatService::Shutdown() {
   receivers_.ClearWithReason(0, "Shutting down");
   weak_ptr_factory_.InvalidateWeakPtrs();
   if (ai_chat_db_) {
+    // The database sequence blocks shutdown, so buffered updates posted here
+    // are still committed.
+    FlushPendingConversationUpdates();
     ai_chat_db_.Reset();
   }
 
@@ -311,6 +322,7 @@ void AIChatService::GetConversation(
         }
         mojom::ConversationPtr& metadata = conversation_it->second;
         // Get archive content and conversation entries
+        instance->FlushPendingConversationUpdates();
         instance->ai_chat_db_.AsyncCall(&AIChatDatabase::GetConversationData)
             .WithArgs(metadata->uuid)
             .Then(base::BindOnce(&AIChatService::OnConversationDataReceived,
@@ -393,6 +405,7 @@ void AIChatService::DeleteConversations(std::optional<base::Time> begin_time,
 
     // Delete database data
     if (ai_chat_db_) {
+      FlushPendingConversationUpdates();
       ai_chat_db_.AsyncCall(base::IgnoreResult(&AIChatDatabase::DeleteAllData));
       ReloadConversations();
     }
@@ -419,6 +432,85 @@ void AIChatService::DeleteConversations(std::optional<base::Time> begin_time,
   if (!conversation_keys.empty()) {
     OnConversationListChanged();
   }
+
+  // Conversations which aren't loaded yet are found via the database's entry
+  // date index, rather than by loading and decrypting all their metadata.
+  const bool conversations_loaded =
+      on_conversations_loaded_callbacks_.has_value() &&
+      on_conversations_loaded_callbacks_->empty();
+  if (ai_chat_db_ && !conversations_loaded) {
+    FlushPendingConversationUpdates();
+    ai_chat_db_.AsyncCall(&AIChatDatabase::GetConversationUuidsInTimeRange)
+        .WithArgs(begin_time, end_time)
+        .Then(base::BindOnce(
+            &AIChatService::OnConversationsInTimeRangeForDeletion,
+            weak_ptr_factory_.GetWeakPtr(), begin_time, end_time,
+            std::move(conversation_keys)));
+  }
+}
+
+void AIChatService::SearchConversations(const std::string& query,
+                                        size_t max_results,
+                                        SearchConversationsCallback callback) {
+  // Only persisted conversations are indexed.
+  if (!ai_chat_db_) {
+    std::move(callback).Run({});
+    return;
+  }
+  ai_chat_db_.AsyncCall(&AIChatDatabase::SearchConversations)
+      .WithArgs(query, max_results)
+      .Then(base::BindOnce(&AIChatService::OnSearchConversations,
+                           weak_ptr_factory_.GetWeakPtr(),
+                           std::move(callback)));
+}
+
+void AIChatService::OnSearchConversations(
+    SearchConversationsCallback callback,
+    std::vector<std::string> conversation_uuids) {
+  LoadConversationsLazy(base::BindOnce(
+      [](SearchConversationsCallback callback,
+         std::vector<std::string> conversation_uuids,
+         ConversationMap& conversations_map) {
+        std::vector<mojom::ConversationPtr> conversations;
+        for (const auto& uuid : conversation_uuids) {
+          // Skip conversations which were deleted since the search.
+          auto it = conversations_map.find(uuid);
+          if (it != conversations_map.end()) {
+            conversations.push_back(it->second->Clone());
+          }
+        }
+        std::move(callback).Run(std::move(conversations));
+      },
+      std::move(callback), std::move(conversation_uuids)));
+}
+
+void AIChatService::OnConversationsInTimeRangeForDeletion(
+    std::optional<base::Time> begin_time,
+    std::optional<base::Time> end_time,
+    std::vector<std::string> already_deleted_uuids,
+    std::vector<std::string> conversation_uuids) {
+  bool deleted = false;
+  for (const auto& uuid : conversation_uuids) {
+    if (base::Contains(already_deleted_uuids, uuid)) {
+      continue;
+    }
+    // The conversation may have been loaded and updated since the query.
+    auto conversation_it = conversations_.find(uuid);
+    if (conversation_it != conversations_.end() &&
+        !IsConversationUpdatedTimeWithinRange(begin_time, end_time,
+                                              conversation_it->second)) {
+      continue;
+    }
+    DeleteConversation(uuid);
+    deleted = true;
+  }
+
+  // A load which started before the deletion would bring the conversations
+  // back, so start it again.
+  if (deleted && on_conversations_loaded_callbacks_.has_value() &&
+      !on_conversations_loaded_callbacks_->empty()) {
+    ReloadConversations();
+  }
 }
 
 void AIChatService::DeleteAssociatedWebContent(
@@ -430,6 +522,7 @@ void AIChatService::DeleteAssociatedWebContent(
     return;
   }
 
+  FlushPendingConversationUpdates();
   ai_chat_db_.AsyncCall(&AIChatDatabase::DeleteAssociatedWebContent)
       .WithArgs(begin_time, end_time)
       .Then(std::move(callback));
@@ -451,6 +544,7 @@ void AIChatService::MaybeInitStorage() {
     // Delete all stored data from database
     if (ai_chat_db_) {
       DVLOG(0) << "Unloading AI Chat database due to pref change";
+      FlushPendingConversationUpdates();
       base::SequenceBound<std::unique_ptr<AIChatDatabase>> ai_chat_db =
           std::move(ai_chat_db_);
       ai_chat_db.AsyncCall(&AIChatDatabase::DeleteAllData)
@@ -531,6 +625,7 @@ void AIChatService::LoadConversationsLazy(ConversationMapCallback callback) {
 
   on_conversations_loaded_callbacks_ = std::vector<ConversationMapCallback>();
   on_conversations_loaded_callbacks_->push_back(std::move(callback));
+  FlushPendingConversationUpdates();
   ai_chat_db_.AsyncCall(&AIChatDatabase::GetAllConversations)
       .Then(base::BindOnce(&AIChatService::OnLoadConversationsLazyData,
                            weak_ptr_factory_.GetWeakPtr()));
@@ -576,6 +671,7 @@ void AIChatService::OnLoadConversationsLazyData(
       // If a reload was asked for, then we should also update the deeper
       // conversation data from the database, since the reload was likely due
       // to underlying data changing.
+      FlushPendingConversationUpdates();
       ai_chat_db_.AsyncCall(&AIChatDatabase::GetConversationData)
           .WithArgs(uuid)
           .Then(base::BindOnce(
@@ -714,6 +810,7 @@ void AIChatService::DeleteConversation(const std::string& id) {
   OnConversationListChanged();
   // Update database
   if (ai_chat_db_ && !temporary) {
+    FlushPendingConversationUpdates();
     ai_chat_db_
         .AsyncCall(base::IgnoreResult(&AIChatDatabase::DeleteConversation))
         .WithArgs(id);
@@ -799,6 +896,7 @@ void AIChatService::QueueMaybeUnloadConversation(
     ConversationHandler* conversation_handler) {
   // Only queue the MaybeUnload if we can unload the conversation now.
   if (!CanUnloadConversation(conversation_handler)) {
+    QueueReleaseIdleConversation(conversation_handler);
     return;
   }
 
@@ -811,6 +909,52 @@ void AIChatService::QueueMaybeUnloadConversation(
       kUnloadDelay);
 }
 
+void AIChatService::QueueReleaseIdleConversation(
+    ConversationHandler* conversation_handler) {
+  if (!features::IsAIChatIdleConversationReleaseEnabled() ||
+      conversation_handler->IsAnyClientConnected() ||
+      conversation_handler->IsRequestInProgress()) {
+    return;
+  }
+
+  const base::TimeTicks now = base::TimeTicks::Now();
+  const std::string& uuid = conversation_handler->get_conversation_uuid();
+  idle_since_[uuid] = now;
+  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
+      FROM_HERE,
+      base::BindOnce(&AIChatService::ReleaseIdleConversation,
+                     weak_ptr_factory_.GetWeakPtr(), uuid, now),
+      features::kAIChatIdleConversationReleaseDelay.Get());
+}
+
+void AIChatService::ReleaseIdleConversation(
+    const std::string& conversation_uuid,
+    base::TimeTicks queued_time) {
+  // Only the latest queued release counts; the conversation may have been
+  // used, and become idle again, since this one was queued.
+  auto it = idle_since_.find(conversation_uuid);
+  if (it == idle_since_.end() || it->second != queued_time) {
+    return;
+  }
+  idle_since_.erase(it);
+
+  auto handler_it = conversation_handlers_.find(conversation_uuid);
+  if (handler_it == conversation_handlers_.end()) {
+    return;
+  }
+  ConversationHandler* conversation_handler = handler_it->second.get();
+  if (conversation_handler->IsAnyClientConnected() ||
+      conversation_handler->IsRequestInProgress()) {
+    return;
+  }
+
+  base::UmaHistogramMemoryKB(
+      "Brave.AIChat.IdleConversationMemoryKB",
+      base::saturated_cast<int>(conversation_handler->EstimateMemoryUsage() /
+                                1024));
+  conversation_handler->ReleaseCachedResources();
+}
+
 void AIChatService::MaybeUnloadConversation(
     base::WeakPtr<ConversationHandler> conversation_handler) {
   // If the conversation has already been destroyed there's nothing to do.
@@ -828,6 +972,7 @@ void AIChatService::MaybeUnloadConversation(
   auto uuid = conversation_handler->get_conversation_uuid();
   conversation_observations_.RemoveObservation(conversation_handler.get());
   conversation_handlers_.erase(uuid);
+  idle_since_.erase(uuid);
 
   DVLOG(1) << "Unloaded conversation (" << uuid << ") from memory. Now have "
            << conversations_.size() << " Conversation metadata items and "
@@ -951,6 +1096,7 @@ void AIChatService::HandleFirstEntry(
   // We can persist the conversation metadata for the first time as well as the
   // entry.
   if (ai_chat_db_ && !conversation->temporary) {
+    FlushPendingConversationUpdates();
     ai_chat_db_.AsyncCall(base::IgnoreResult(&AIChatDatabase::AddConversation))
         .WithArgs(conversation->Clone(), std::move(associated_content),
                   entry->Clone());
@@ -975,6 +1121,9 @@ void AIChatService::HandleNewEntry(
 
   // Persist the new entry and update the associated content data, if present
   if (ai_chat_db_ && !conversation->temporary) {
+    // A new entry completes the previous turn, so anything buffered for it
+    // is written now rather than waiting for the timer.
+    FlushPendingConversationUpdates();
     ai_chat_db_
         .AsyncCall(base::IgnoreResult(&AIChatDatabase::AddConversationEntry))
         .WithArgs(handler->get_conversation_uuid(), entry.Clone(),
@@ -1008,6 +1157,7 @@ void AIChatService::OnConversationEntryRemoved(ConversationHandler* handler,
                                                std::string entry_uuid) {
   // Persist the removal
   if (ai_chat_db_ && !handler->GetIsTemporary()) {
+    FlushPendingConversationUpdates();
     ai_chat_db_
         .AsyncCall(base::IgnoreResult(&AIChatDatabase::DeleteConversationEntry))
         .WithArgs(entry_uuid);
@@ -1020,9 +1170,19 @@ void AIChatService::OnToolUseEventOutput(ConversationHandler* handler,
                                          mojom::ToolUseEventPtr tool_use) {
   // Persist the tool use event
   if (ai_chat_db_ && !handler->GetIsTemporary()) {
-    ai_chat_db_
-        .AsyncCall(base::IgnoreResult(&AIChatDatabase::UpdateToolUseEvent))
-        .WithArgs(entry_uuid, event_order, std::move(tool_use));
+    auto& tool_use_events =
+        GetPendingConversationUpdates(handler->get_conversation_uuid())
+            .tool_use_events;
+    auto it = std::ranges::find_if(tool_use_events, [&](const auto& update) {
+      return update.entry_uuid == entry_uuid &&
+             update.event_order == event_order;
+    });
+    if (it != tool_use_events.end()) {
+      it->tool_use_event = std::move(tool_use);
+    } else {
+      tool_use_events.emplace_back(std::string(entry_uuid), event_order,
+                                   std::move(tool_use));
+    }
   }
 }
 
@@ -1052,9 +1212,7 @@ void AIChatService::OnConversationTitleChanged(
 
   // Persist the change
   if (ai_chat_db_ && !conversation_metadata->temporary) {
-    ai_chat_db_
-        .AsyncCall(base::IgnoreResult(&AIChatDatabase::UpdateConversationTitle))
-        .WithArgs(conversation_uuid, new_title);
+    GetPendingConversationUpdates(conversation_uuid).title = new_title;
   }
 }
 
@@ -1076,13 +1234,45 @@ void AIChatService::OnConversationTokenInfoChanged(
 
   // Persist the change
   if (ai_chat_db_ && !conversation_metadata->temporary) {
-    ai_chat_db_
-        .AsyncCall(
-            base::IgnoreResult(&AIChatDatabase::UpdateConversationTokenInfo))
-        .WithArgs(conversation_uuid, total_tokens, trimmed_tokens);
+    GetPendingConversationUpdates(conversation_uuid).token_info =
+        ConversationUpdates::TokenInfo{total_tokens, trimmed_tokens};
   }
 }
 
+ConversationUpdates& AIChatService::GetPendingConversationUpdates(
+    const std::string& conversation_uuid) {
+  CHECK(ai_chat_db_);
+  pending_conversation_update_count_++;
+  if (!conversation_updates_flush_timer_.IsRunning()) {
+    conversation_updates_flush_timer_.Start(
+        FROM_HERE, kConversationUpdatesFlushDelay,
+        base::BindOnce(&AIChatService::FlushPendingConversationUpdates,
+                       base::Unretained(this)));
+  }
+  return pending_conversation_updates_[conversation_uuid];
+}
+
+void AIChatService::FlushPendingConversationUpdates() {
+  conversation_updates_flush_timer_.Stop();
+  if (pending_conversation_updates_.empty()) {
+    return;
+  }
+  auto updates = std::move(pending_conversation_updates_).extract();
+  pending_conversation_updates_.clear();
+  const size_t update_count =
+      std::exchange(pending_conversation_update_count_, 0u);
+  if (!ai_chat_db_) {
+    return;
+  }
+  // Each flush is a single transaction, i.e. a single commit to disk, however
+  // many updates it replaces.
+  base::UmaHistogramCounts1000("Brave.AIChat.Database.UpdatesPerTransaction",
+                               update_count);
+  ai_chat_db_
+      .AsyncCall(base::IgnoreResult(&AIChatDatabase::UpdateConversations))
+      .WithArgs(std::move(updates));
+}
+
 void AIChatService::OnAssociatedContentUpdated(ConversationHandler* handler) {
   if (handler->associated_content_manager()->HasAssociatedContent()) {
     return;
@@ -1149,6 +1339,27 @@ bool AIChatService::HasUserOptedIn() {
   return ai_chat::HasUserOptedIn(profile_prefs_);
 }
 
+bool AIChatService::ConsumeSuggestedQuestionsPrefetchBudget() {
+  const int budget =
+      features::kAIChatSuggestedQuestionsPrefetchDailyBudget.Get();
+  if (budget <= 0) {
+    return false;
+  }
+  const base::Time today = base::Time::Now().LocalMidnight();
+  ScopedDictPrefUpdate usage(
+      profile_prefs_, prefs::kBraveAIChatSuggestedQuestionsPrefetchUsage);
+  int count = 0;
+  if (base::ValueToTime(usage->Find("day")) == today) {
+    count = usage->FindInt("count").value_or(0);
+  }
+  if (count >= budget) {
+    return false;
+  }
+  usage->Set("day", base::TimeToValue(today));
+  usage->Set("count", count + 1);
+  return true;
+}
+
 bool AIChatService::IsPremiumStatus() {
   return ai_chat::IsPremiumStatus(last_premium_status_);
 }
@@ -16,6 +16,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/functional/callback.h"
 #include "base/functional/callback_helpers.h"
 #include "base/memory/raw_ptr.h"
@@ -23,6 +24,7 @@
 #include "base/memory/weak_ptr.h"
 #include "base/scoped_multi_source_observation.h"
 #include "base/threading/sequence_bound.h"
+#include "base/timer/timer.h"
 #include "brave/components/ai_chat/core/browser/ai_chat_credential_manager.h"
 #include "brave/components/ai_chat/core/browser/ai_chat_database.h"
 #include "brave/components/ai_chat/core/browser/ai_chat_feedback_api.h"
@@ -78,6 +80,8 @@ class AIChatService : public KeyedService,
       base::expected<std::vector<std::string>, mojom::APIError>)>;
   using GetFocusTabsCallback = base::OnceCallback<void(
       base::expected<std::vector<std::string>, mojom::APIError>)>;
+  using SearchConversationsCallback =
+      base::OnceCallback<void(std::vector<mojom::ConversationPtr>)>;
 
   /**
    * @brief Constructs an AIChatService instance.
@@ -286,6 +290,18 @@ class AIChatService : public KeyedService,
   void DeleteConversations(std::optional<base::Time> begin_time = std::nullopt,
                            std::optional<base::Time> end_time = std::nullopt);
 
+  /**
+   * @brief Finds persisted conversations containing every word of a query.
+   *
+   * @param query Words to match, whole and case-insensitively.
+   * @param max_results Maximum number of conversations to return.
+   * @param callback Callback with the matching conversations, ordered by
+   * their most recent matching entry first.
+   */
+  void SearchConversations(const std::string& query,
+                           size_t max_results,
+                           SearchConversationsCallback callback);
+
   /**
    * @brief Remove only web-content data from conversations.
    *
@@ -510,6 +526,14 @@ class AIChatService : public KeyedService,
    */
   bool HasUserOptedIn();
 
+  /**
+   * @brief Uses up one of today's background suggested questions
+   * generations, see features::kAIChatSuggestedQuestionsPrefetch.
+   *
+   * @return True if today's budget allowed it, false otherwise.
+   */
+  bool ConsumeSuggestedQuestionsPrefetchBudget();
+
   /**
    * @brief Checks if the user has premium status.
    *
@@ -630,6 +654,13 @@ class AIChatService : public KeyedService,
   // Called when the database encryptor is ready.
   void OnOsCryptAsyncReady(os_crypt_async::Encryptor encryptor);
   void LoadConversationsLazy(ConversationMapCallback callback);
+  void OnConversationsInTimeRangeForDeletion(
+      std::optional<base::Time> begin_time,
+      std::optional<base::Time> end_time,
+      std::vector<std::string> already_deleted_uuids,
+      std::vector<std::string> conversation_uuids);
+  void OnSearchConversations(SearchConversationsCallback callback,
+                             std::vector<std::string> conversation_uuids);
   void OnLoadConversationsLazyData(
       std::vector<mojom::ConversationPtr> conversations);
   void ReloadConversations(bool from_cancel = false);
@@ -664,6 +695,13 @@ class AIChatService : public KeyedService,
   // 1. It hasn't already been unloaded
   // 2. |CanUnloadConversation| is true
   void MaybeUnloadConversation(base::WeakPtr<ConversationHandler> conversation);
+
+  // For conversations that must stay loaded without any UI connected, queues
+  // releasing their cached resources once they have been idle for
+  // |kAIChatIdleConversationReleaseDelay|.
+  void QueueReleaseIdleConversation(ConversationHandler* conversation);
+  void ReleaseIdleConversation(const std::string& conversation_uuid,
+                               base::TimeTicks queued_time);
   void HandleFirstEntry(ConversationHandler* handler,
                         mojom::ConversationTurnPtr& entry,
                         std::optional<std::vector<std::string>> maybe_content,
@@ -683,6 +721,14 @@ class AIChatService : public KeyedService,
                                mojom::PremiumStatus status,
                                mojom::PremiumInfoPtr info);
   void OnDataDeletedForDisabledStorage(bool success);
+  // Returns the buffered updates for |conversation_uuid| and schedules a
+  // flush. Only call when there is a database.
+  ConversationUpdates& GetPendingConversationUpdates(
+      const std::string& conversation_uuid);
+  // Writes all buffered updates to the database in one transaction. Must be
+  // called before any other database operation so that operations stay in
+  // order.
+  void FlushPendingConversationUpdates();
   mojom::ServiceStatePtr BuildState();
   void OnStateChanged();
   void OnSkillsChanged();
@@ -733,6 +779,14 @@ class AIChatService : public KeyedService,
   // Storage for conversations
   base::SequenceBound<std::unique_ptr<AIChatDatabase>> ai_chat_db_;
 
+  // Frequently changing conversation properties waiting to be written to
+  // |ai_chat_db_|, keyed by conversation uuid. The newest value of each
+  // property replaces any older one still in the buffer.
+  base::flat_map<std::string, ConversationUpdates>
+      pending_conversation_updates_;
+  size_t pending_conversation_update_count_ = 0;
+  base::OneShotTimer conversation_updates_flush_timer_;
+
   // nullopt if haven't started fetching, empty if done fetching
   std::optional<std::vector<ConversationMapCallback>>
       on_conversations_loaded_callbacks_;
@@ -750,6 +804,9 @@ class AIChatService : public KeyedService,
   std::map<std::string, std::unique_ptr<ConversationHandler>>
       conversation_handlers_;
 
+  // When each loaded conversation with a queued idle release became idle.
+  base::flat_map<std::string, base::TimeTicks> idle_since_;
+
   // Map associated content id (a.k.a navigation id) to conversation uuid. This
   // acts as a cache for back-navigation to find the most recent conversation
   // for that navigation. This should be periodically cleaned up by removing any
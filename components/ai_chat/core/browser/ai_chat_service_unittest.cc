@@ -30,6 +30,7 @@
 #include "base/task/thread_pool.h"
 #include "base/test/bind.h"
 #include "base/test/gmock_callback_support.h"
+#include "base/test/metrics/histogram_tester.h"
 #include "base/test/mock_callback.h"
 #include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
@@ -216,6 +217,11 @@ class MockAIChatDatabase : public AIChatDatabase {
               (std::string_view, uint64_t, uint64_t),
               (override));
 
+  MOCK_METHOD(bool,
+              UpdateConversations,
+              ((std::vector<std::pair<std::string, ConversationUpdates>>)),
+              (override));
+
   MOCK_METHOD(bool, DeleteConversationEntry, (std::string_view), (override));
   MOCK_METHOD(bool, DeleteConversation, (std::string_view), (override));
   MOCK_METHOD(bool, DeleteAllData, (), (override));
@@ -671,6 +677,44 @@ TEST_P(AIChatServiceUnitTest, ConversationLifecycle_WithContent) {
   }
 }
 
+TEST_P(AIChatServiceUnitTest, ConversationLifecycle_IdleContentIsReleased) {
+  base::test::ScopedFeatureList feature_list(
+      features::kAIChatIdleConversationRelease);
+  base::HistogramTester histogram_tester;
+  NiceMock<MockAssociatedContent> associated_content{};
+  associated_content.SetUrl(GURL("https://example.com"));
+  associated_content.SetContentId(1);
+  ConversationHandler* conversation =
+      ai_chat_service_->GetOrCreateConversationHandlerForContent(
+          associated_content.content_id(), associated_content.GetWeakPtr());
+  conversation->SetChatHistoryForTesting(CreateSampleChatHistory(1u));
+  auto client = CreateConversationClient(conversation);
+  DisconnectConversationClient(client.get());
+  WaitForConversationUnload();
+  // The conversation is kept alive by its content, but nothing has been
+  // released yet.
+  EXPECT_EQ(ai_chat_service_->GetInMemoryConversationCountForTesting(), 1u);
+  histogram_tester.ExpectTotalCount("Brave.AIChat.IdleConversationMemoryKB",
+                                    0);
+
+  task_environment_.FastForwardBy(
+      features::kAIChatIdleConversationReleaseDelay.Get());
+  histogram_tester.ExpectTotalCount("Brave.AIChat.IdleConversationMemoryKB",
+                                    1);
+  // Releasing caches does not unload the conversation.
+  EXPECT_EQ(ai_chat_service_->GetInMemoryConversationCountForTesting(), 1u);
+
+  // Reconnecting before the delay elapses skips the release.
+  auto client2 = CreateConversationClient(conversation);
+  DisconnectConversationClient(client2.get());
+  WaitForConversationUnload();
+  auto client3 = CreateConversationClient(conversation);
+  task_environment_.FastForwardBy(
+      features::kAIChatIdleConversationReleaseDelay.Get());
+  histogram_tester.ExpectTotalCount("Brave.AIChat.IdleConversationMemoryKB",
+                                    1);
+}
+
 TEST_P(AIChatServiceUnitTest, ConversationLifecycle_IsNotDeletedImmediately) {
   ConversationHandler* conversation = CreateConversation();
   auto client = CreateConversationClient(conversation);
@@ -1012,6 +1056,34 @@ TEST_P(AIChatServiceUnitTest, DeleteConversations_TimeRange) {
   ExpectConversationsSize(FROM_HERE, IsAIChatHistoryEnabled() ? 1 : 0);
 }
 
+TEST_P(AIChatServiceUnitTest, DeleteConversations_TimeRange_NotLoaded) {
+  if (!IsAIChatHistoryEnabled()) {
+    GTEST_SKIP() << "Nothing is persisted without history";
+  }
+
+  ConversationHandler* conversation_handler1 = CreateConversation();
+  auto client1 = CreateConversationClient(conversation_handler1);
+  // This conversation 3 hours in the past
+  conversation_handler1->SetChatHistoryForTesting(
+      CreateSampleChatHistory(1u, -3));
+
+  ConversationHandler* conversation_handler2 = CreateConversation();
+  auto client2 = CreateConversationClient(conversation_handler2);
+  // This conversation 1 hour in the past
+  conversation_handler2->SetChatHistoryForTesting(
+      CreateSampleChatHistory(1u, -1));
+  ExpectConversationsSize(FROM_HERE, 2);
+
+  // Delete before the conversations are loaded from the database again.
+  ResetService();
+  ai_chat_service_->DeleteConversations(base::Time::Now() - base::Minutes(245),
+                                        base::Time::Now() - base::Minutes(110));
+  ExpectConversationsSize(FROM_HERE, 1);
+
+  ResetService();
+  ExpectConversationsSize(FROM_HERE, 1);
+}
+
 TEST_P(
     AIChatServiceUnitTest,
     CreateConversationHandlerForContent_ShouldNotAssociate_WhenPageContextEnabledInitiallyDisabled) {
@@ -1395,6 +1467,7 @@ TEST_P(AIChatServiceUnitTest, TemporaryConversation_NoDatabaseInteraction) {
   EXPECT_CALL(*mock_db_ptr, UpdateConversationTitle(_, _)).Times(0);
   EXPECT_CALL(*mock_db_ptr, UpdateConversationModelKey).Times(0);
   EXPECT_CALL(*mock_db_ptr, UpdateConversationTokenInfo(_, _, _)).Times(0);
+  EXPECT_CALL(*mock_db_ptr, UpdateConversations).Times(0);
   EXPECT_CALL(*mock_db_ptr, DeleteConversationEntry(_)).Times(0);
   EXPECT_CALL(*mock_db_ptr, DeleteConversation(_)).Times(0);
 
@@ -1439,6 +1512,66 @@ TEST_P(AIChatServiceUnitTest, TemporaryConversation_NoDatabaseInteraction) {
   testing::Mock::VerifyAndClearExpectations(mock_db_ptr);
 }
 
+TEST_P(AIChatServiceUnitTest, ConversationUpdatesAreCoalesced) {
+  if (!IsAIChatHistoryEnabled()) {
+    return;
+  }
+
+  auto mock_ptr = std::make_unique<NiceMock<MockAIChatDatabase>>();
+  auto* mock_db_ptr = mock_ptr.get();
+  ai_chat_service_->SetDatabaseForTesting(
+      base::SequenceBound<std::unique_ptr<AIChatDatabase>>(
+          task_environment_.GetMainThreadTaskRunner(), std::move(mock_ptr)));
+
+  ConversationHandler* conversation = CreateConversation();
+  auto client = CreateConversationClient(conversation);
+  auto uuid = conversation->get_conversation_uuid();
+  conversation->SetChatHistoryForTesting(CreateSampleChatHistory(1u));
+  task_environment_.RunUntilIdle();
+
+  // Updates are not written individually
+  EXPECT_CALL(*mock_db_ptr, UpdateConversationTitle).Times(0);
+  EXPECT_CALL(*mock_db_ptr, UpdateConversationTokenInfo).Times(0);
+  EXPECT_CALL(*mock_db_ptr, UpdateConversations).Times(0);
+  ai_chat_service_->OnConversationTitleChanged(uuid, "First Title");
+  ai_chat_service_->OnConversationTokenInfoChanged(uuid, 10, 0);
+  ai_chat_service_->OnConversationTitleChanged(uuid, "Second Title");
+  ai_chat_service_->OnConversationTokenInfoChanged(uuid, 100, 50);
+  task_environment_.RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(mock_db_ptr);
+
+  // Only the latest values are written, in a single batch, after the delay
+  EXPECT_CALL(*mock_db_ptr, UpdateConversations)
+      .WillOnce(
+          [&uuid](std::vector<std::pair<std::string, ConversationUpdates>>
+                      updates) {
+            EXPECT_EQ(updates.size(), 1u);
+            EXPECT_EQ(updates[0].first, uuid);
+            EXPECT_EQ(updates[0].second.title, "Second Title");
+            EXPECT_TRUE(updates[0].second.token_info.has_value());
+            EXPECT_EQ(updates[0].second.token_info->total_tokens, 100u);
+            EXPECT_EQ(updates[0].second.token_info->trimmed_tokens, 50u);
+            return true;
+          });
+  task_environment_.FastForwardBy(base::Seconds(3));
+  testing::Mock::VerifyAndClearExpectations(mock_db_ptr);
+
+  // A conversation operation writes buffered updates first, keeping order
+  {
+    testing::InSequence sequence;
+    EXPECT_CALL(*mock_db_ptr, UpdateConversations)
+        .WillOnce(testing::Return(true));
+    EXPECT_CALL(*mock_db_ptr, DeleteConversationEntry("entry"))
+        .WillOnce(testing::Return(true));
+  }
+  ai_chat_service_->OnConversationTitleChanged(uuid, "Third Title");
+  ai_chat_service_->OnConversationEntryRemoved(conversation, "entry");
+  task_environment_.RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(mock_db_ptr);
+
+  DisconnectConversationClient(client.get());
+}
+
 TEST_P(AIChatServiceUnitTest,
        OnConversationEntryAdded_GetsLatestAssociatedContent) {
   NiceMock<MockAssociatedContent> associated_content;
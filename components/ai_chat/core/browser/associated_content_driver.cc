@@ -22,6 +22,7 @@
 #include "brave/brave_domains/service_domains.h"
 #include "brave/components/ai_chat/core/browser/associated_content_delegate.h"
 #include "brave/components/ai_chat/core/browser/brave_search_responses.h"
+#include "brave/components/ai_chat/core/browser/page_content_cache.h"
 #include "brave/components/ai_chat/core/browser/utils.h"
 #include "brave/components/ai_chat/core/common/constants.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
@@ -85,6 +86,16 @@ void AssociatedContentDriver::GetContent(GetPageContentCallback callback) {
                 "operation to complete";
     return;
   }
+  // A page that another driver has already fetched can be seeded from the
+  // shared cache. The fetcher still receives the token and only skips the
+  // fetch if the content is unchanged.
+  if (content_invalidation_token_.empty() && page_content_cache_ &&
+      url().is_valid()) {
+    if (const auto* entry = page_content_cache_->Get(url())) {
+      content_invalidation_token_ = entry->invalidation_token;
+      set_cached_page_content(entry->content);
+    }
+  }
   // No operation already in progress, so fetch the page content and signal the
   // event when done.
   GetPageContent(
@@ -126,8 +137,13 @@ void AssociatedContentDriver::OnGeneratePageContentComplete(
 
     if (cached_page_content().content.empty()) {
       DVLOG(1) << __func__ << ": No data";
+    } else if (!invalidation_token.empty() && page_content_cache_ &&
+               url().is_valid()) {
+      page_content_cache_->Put(url(), invalidation_token,
+                               cached_page_content());
     }
   }
+  content_invalidation_token_ = std::move(invalidation_token);
 
   on_page_text_fetch_complete_->Signal();
   on_page_text_fetch_complete_ = nullptr;
@@ -221,6 +237,7 @@ AssociatedContentDriver::ParseSearchQuerySummaryResponse(
 
 void AssociatedContentDriver::OnNewPage(int64_t navigation_id) {
   api_request_helper_.reset();
+  content_invalidation_token_.clear();
 
   AssociatedContentDelegate::OnNewPage(navigation_id);
 }
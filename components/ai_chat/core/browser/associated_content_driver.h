@@ -15,6 +15,7 @@
 
 #include "base/functional/callback.h"
 #include "base/gtest_prod_util.h"
+#include "base/memory/raw_ptr.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/one_shot_event.h"
@@ -41,6 +42,8 @@ class OneShotEvent;
 
 namespace ai_chat {
 
+class PageContentCache;
+
 // Contains a platform-independent relationship between multiple conversations
 // and a single piece of content. Must be subclassed to
 // provide the platform-specific retrieval of the content details, such as
@@ -94,6 +97,12 @@ class AssociatedContentDriver : public AssociatedContentDelegate {
   // conversation is expected.
   void OnNewPage(int64_t navigation_id) override;
 
+  // Shares content with a valid invalidation token with other drivers using
+  // the same |cache|, which must outlive this instance.
+  void set_page_content_cache(PageContentCache* cache) {
+    page_content_cache_ = cache;
+  }
+
  private:
   friend class ::AIChatUIBrowserTest;
   FRIEND_TEST_ALL_PREFIXES(::AIChatUIBrowserTest, PrintPreviewFallback);
@@ -124,6 +133,7 @@ class AssociatedContentDriver : public AssociatedContentDelegate {
 
   std::unique_ptr<base::OneShotEvent> on_page_text_fetch_complete_ = nullptr;
   std::string content_invalidation_token_;
+  raw_ptr<PageContentCache> page_content_cache_ = nullptr;
 
   base::WeakPtrFactory<AssociatedContentDriver> weak_ptr_factory_{this};
 };
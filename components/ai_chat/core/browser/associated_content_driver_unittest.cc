@@ -19,8 +19,10 @@
 #include "base/test/gmock_callback_support.h"
 #include "base/test/mock_callback.h"
 #include "base/test/task_environment.h"
+#include "base/test/test_future.h"
 #include "base/test/values_test_util.h"
 #include "brave/components/ai_chat/core/browser/conversation_handler.h"
+#include "brave/components/ai_chat/core/browser/page_content_cache.h"
 #include "brave/components/ai_chat/core/browser/types.h"
 #include "brave/components/ai_chat/core/common/mojom/page_content_extractor.mojom.h"
 #include "services/data_decoder/public/cpp/test_support/in_process_data_decoder.h"
@@ -46,6 +48,8 @@ class MockAssociatedContentDriver : public AssociatedContentDriver {
       : AssociatedContentDriver(url_loader_factory) {}
   ~MockAssociatedContentDriver() override = default;
 
+  using AssociatedContentDriver::set_page_content_cache;
+
   void SetUrl(GURL url) { url_ = std::move(url); }
   void SetTitle(std::u16string title) { title_ = std::move(title); }
 
@@ -126,6 +130,40 @@ TEST_F(AssociatedContentDriverUnitTest, GetContent) {
   testing::Mock::VerifyAndClearExpectations(associated_content_driver_.get());
 }
 
+TEST_F(AssociatedContentDriverUnitTest, GetContent_InvalidationToken) {
+  const GURL url("https://www.youtube.com/watch?v=abc");
+  PageContentCache cache;
+  associated_content_driver_->set_page_content_cache(&cache);
+  associated_content_driver_->SetUrl(url);
+
+  // First fetch has no token and fills the shared cache
+  EXPECT_CALL(*associated_content_driver_, GetPageContent(_, ""))
+      .WillOnce(base::test::RunOnceCallback<0>("transcript", true, "token"));
+  base::test::TestFuture<PageContent> future;
+  associated_content_driver_->GetContent(future.GetCallback());
+  EXPECT_EQ(future.Take(), PageContent("transcript", true));
+  testing::Mock::VerifyAndClearExpectations(associated_content_driver_.get());
+
+  // The token is handed back, and an unchanged result keeps the content
+  EXPECT_CALL(*associated_content_driver_, GetPageContent(_, "token"))
+      .WillOnce(base::test::RunOnceCallback<0>("", true, "token"));
+  associated_content_driver_->GetContent(future.GetCallback());
+  EXPECT_EQ(future.Take(), PageContent("transcript", true));
+  testing::Mock::VerifyAndClearExpectations(associated_content_driver_.get());
+
+  // Another driver for the same page is seeded from the cache
+  NiceMock<MockAssociatedContentDriver> other_driver(
+      shared_url_loader_factory_);
+  other_driver.set_page_content_cache(&cache);
+  other_driver.SetUrl(url);
+  EXPECT_CALL(other_driver, GetPageContent(_, "token"))
+      .WillOnce(base::test::RunOnceCallback<0>("", true, "token"));
+  other_driver.GetContent(future.GetCallback());
+  EXPECT_EQ(future.Take(), PageContent("transcript", true));
+  EXPECT_EQ(cache.hit_count(), 1u);
+  testing::Mock::VerifyAndClearExpectations(&other_driver);
+}
+
 TEST_F(AssociatedContentDriverUnitTest, GetStagedEntriesFromContent) {
   SetSearchQuerySummaryInterceptor();
   // Give the function a valid URL
@@ -15,13 +15,16 @@
 #include "base/barrier_callback.h"
 #include "base/barrier_closure.h"
 #include "base/check.h"
+#include "base/containers/adapters.h"
 #include "base/containers/contains.h"
 #include "base/functional/bind.h"
 #include "base/functional/callback_forward.h"
 #include "base/logging.h"
 #include "base/memory/weak_ptr.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/time/time.h"
 #include "brave/components/ai_chat/core/browser/associated_archive_content.h"
 #include "brave/components/ai_chat/core/browser/associated_content_delegate.h"
 #include "brave/components/ai_chat/core/browser/conversation_handler.h"
@@ -29,6 +32,15 @@
 
 namespace ai_chat {
 
+namespace {
+
+constexpr char kContentFetchTimeHistogramName[] =
+    "Brave.AIChat.AssociatedContent.FetchTime";
+constexpr char kContentFetchSizeHistogramName[] =
+    "Brave.AIChat.AssociatedContent.FetchSize";
+
+}  // namespace
+
 AssociatedContentManager::AssociatedContentManager(
     ConversationHandler* conversation)
     : conversation_(conversation) {}
@@ -336,16 +348,58 @@ void AssociatedContentManager::GetContent(base::OnceClosure callback) {
               self->on_page_text_fetch_complete_ = nullptr;
             },
             weak_ptr_factory_.GetWeakPtr()));
-    for (auto* content : content_delegates_) {
-      content->GetContent(base::BindOnce(
-          [](base::RepeatingClosure callback, PageContent) { callback.Run(); },
-          content_callback));
+
+    // Fetch the most recently attached content first, as it is the most
+    // likely to be the focus of the user's request.
+    DCHECK(pending_content_fetches_.empty());
+    for (auto* content : base::Reversed(content_delegates_)) {
+      pending_content_fetches_.push_back(content);
     }
+    StartPendingContentFetches(content_callback);
   } else {
     on_page_text_fetch_complete_->Post(FROM_HERE, std::move(callback));
   }
 }
 
+void AssociatedContentManager::StartPendingContentFetches(
+    base::RepeatingClosure on_content_fetched) {
+  // Extracting a page is expensive for the renderer, so only a few are run at
+  // once, rather than one after another or all at the same time.
+  while (in_flight_content_fetches_ < kMaxConcurrentContentFetches &&
+         !pending_content_fetches_.empty()) {
+    AssociatedContentDelegate* content = pending_content_fetches_.front();
+    pending_content_fetches_.pop_front();
+
+    // The content may have been removed while it was waiting for a slot.
+    if (!base::Contains(content_delegates_, content)) {
+      on_content_fetched.Run();
+      continue;
+    }
+
+    ++in_flight_content_fetches_;
+    content->GetContent(base::BindOnce(
+        &AssociatedContentManager::OnContentFetched,
+        weak_ptr_factory_.GetWeakPtr(), on_content_fetched,
+        base::TimeTicks::Now()));
+  }
+}
+
+void AssociatedContentManager::OnContentFetched(
+    base::RepeatingClosure on_content_fetched,
+    base::TimeTicks fetch_start,
+    PageContent content) {
+  DCHECK_GT(in_flight_content_fetches_, 0u);
+  --in_flight_content_fetches_;
+
+  base::UmaHistogramMediumTimes(kContentFetchTimeHistogramName,
+                                base::TimeTicks::Now() - fetch_start);
+  base::UmaHistogramCounts1M(kContentFetchSizeHistogramName,
+                             content.content.size());
+
+  on_content_fetched.Run();
+  StartPendingContentFetches(std::move(on_content_fetched));
+}
+
 void AssociatedContentManager::GetScreenshots(
     mojom::ConversationHandler::GetScreenshotsCallback callback) {
   DVLOG(1) << __func__;
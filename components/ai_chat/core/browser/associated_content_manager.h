@@ -13,10 +13,13 @@
 #include <string_view>
 #include <vector>
 
+#include "base/containers/circular_deque.h"
+#include "base/functional/callback_forward.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/one_shot_event.h"
 #include "base/scoped_multi_source_observation.h"
+#include "base/time/time.h"
 #include "brave/components/ai_chat/core/browser/associated_archive_content.h"
 #include "brave/components/ai_chat/core/browser/associated_content_delegate.h"
 #include "brave/components/ai_chat/core/common/mojom/ai_chat.mojom.h"
@@ -37,6 +40,10 @@ using PageContentsMap = base::flat_map<std::string, PageContents>;
 // - Managing whether content should be used as part of the context
 class AssociatedContentManager : public AssociatedContentDelegate::Observer {
  public:
+  // The maximum number of contents which will be fetched at the same time by
+  // |GetContent|.
+  static constexpr size_t kMaxConcurrentContentFetches = 4;
+
   explicit AssociatedContentManager(ConversationHandler* conversation);
   ~AssociatedContentManager() override;
 
@@ -122,6 +129,13 @@ class AssociatedContentManager : public AssociatedContentDelegate::Observer {
  private:
   void DetachContent();
 
+  // Starts fetching queued contents until |kMaxConcurrentContentFetches| are
+  // in flight. |on_content_fetched| is run once for each queued content.
+  void StartPendingContentFetches(base::RepeatingClosure on_content_fetched);
+  void OnContentFetched(base::RepeatingClosure on_content_fetched,
+                        base::TimeTicks fetch_start,
+                        PageContent content);
+
   raw_ptr<ConversationHandler> conversation_;
 
   std::vector<AssociatedContentDelegate*> content_delegates_;
@@ -139,6 +153,11 @@ class AssociatedContentManager : public AssociatedContentDelegate::Observer {
 
   std::unique_ptr<base::OneShotEvent> on_page_text_fetch_complete_ = nullptr;
 
+  // Contents waiting for a fetch slot during |GetContent|.
+  base::circular_deque<raw_ptr<AssociatedContentDelegate>>
+      pending_content_fetches_;
+  size_t in_flight_content_fetches_ = 0;
+
   base::WeakPtrFactory<AssociatedContentManager> weak_ptr_factory_{this};
 };
 
@@ -4,7 +4,9 @@
 // You can obtain one at https://mozilla.org/MPL/2.0/.
 
 #include "base/files/scoped_temp_dir.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/test/task_environment.h"
+#include "base/test/test_future.h"
 #include "brave/components/ai_chat/core/browser/ai_chat_credential_manager.h"
 #include "brave/components/ai_chat/core/browser/ai_chat_service.h"
 #include "brave/components/ai_chat/core/browser/conversation_handler.h"
@@ -30,6 +32,32 @@ namespace ai_chat {
 
 namespace {
 
+// Holds on to |GetContent| requests until the test completes them.
+class DeferredAssociatedContent : public AssociatedContentDelegate {
+ public:
+  explicit DeferredAssociatedContent(std::string uuid) {
+    set_uuid(std::move(uuid));
+  }
+
+  void GetContent(GetPageContentCallback callback) override {
+    pending_callbacks_.push_back(std::move(callback));
+  }
+
+  bool HasPendingFetch() const { return !pending_callbacks_.empty(); }
+
+  void CompleteFetch(std::string content) {
+    ASSERT_TRUE(HasPendingFetch());
+    auto callback = std::move(pending_callbacks_.front());
+    pending_callbacks_.erase(pending_callbacks_.begin());
+    PageContent page_content(std::move(content), false);
+    set_cached_page_content(page_content);
+    std::move(callback).Run(std::move(page_content));
+  }
+
+ private:
+  std::vector<GetPageContentCallback> pending_callbacks_;
+};
+
 class MockAIChatCredentialManager : public AIChatCredentialManager {
  public:
   using AIChatCredentialManager::AIChatCredentialManager;
@@ -482,4 +510,47 @@ TEST_F(AssociatedContentManagerUnitTest,
             mojom::ContentType::VideoTranscript);
 }
 
+TEST_F(AssociatedContentManagerUnitTest, GetContent_BoundedConcurrency) {
+  auto* manager = conversation_handler_->associated_content_manager();
+  constexpr size_t kMaxFetches =
+      AssociatedContentManager::kMaxConcurrentContentFetches;
+
+  std::vector<std::unique_ptr<DeferredAssociatedContent>> contents;
+  for (size_t i = 0; i < kMaxFetches + 2; ++i) {
+    contents.push_back(std::make_unique<DeferredAssociatedContent>(
+        "content-" + base::NumberToString(i)));
+    manager->AddContent(contents.back().get(), /*notify_updated=*/false);
+  }
+  // Complete the fetches started when the content was added.
+  for (auto& content : contents) {
+    while (content->HasPendingFetch()) {
+      content->CompleteFetch("initial");
+    }
+  }
+
+  base::test::TestFuture<void> future;
+  manager->GetContent(future.GetCallback());
+
+  // Only the most recently attached contents are fetched at first.
+  for (size_t i = 0; i < contents.size(); ++i) {
+    EXPECT_EQ(i >= 2, contents[i]->HasPendingFetch()) << i;
+  }
+
+  // Finishing a fetch frees a slot for the next queued content.
+  contents.back()->CompleteFetch("last");
+  EXPECT_TRUE(contents[1]->HasPendingFetch());
+  EXPECT_FALSE(contents[0]->HasPendingFetch());
+
+  contents[4]->CompleteFetch("content");
+  EXPECT_TRUE(contents[0]->HasPendingFetch());
+
+  for (size_t i = 0; i < 4; ++i) {
+    EXPECT_FALSE(future.IsReady());
+    contents[i]->CompleteFetch("content");
+  }
+  EXPECT_TRUE(future.Wait());
+
+  EXPECT_EQ("last", contents.back()->cached_page_content().content);
+}
+
 }  // namespace ai_chat
@@ -25,9 +25,11 @@
 #include "base/files/file_path.h"
 #include "base/functional/bind.h"
 #include "base/functional/callback.h"
+#include "base/hash/hash.h"
 #include "base/json/json_reader.h"
 #include "base/logging.h"
 #include "base/memory/weak_ptr.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/numerics/safe_math.h"
 #include "base/rand_util.h"
 #include "base/strings/strcat.h"
@@ -48,6 +50,7 @@
 #include "brave/components/ai_chat/core/common/features.h"
 #include "brave/components/ai_chat/core/common/mojom/ai_chat.mojom.h"
 #include "brave/components/ai_chat/core/common/mojom/common.mojom.h"
+#include "brave/components/ai_chat/core/common/mojom/ollama.mojom.h"
 #include "brave/components/ai_chat/core/common/prefs.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "components/grit/brave_components_strings.h"
@@ -58,6 +61,7 @@
 #include "mojo/public/cpp/bindings/struct_ptr.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 #include "ui/base/l10n/l10n_util.h"
+#include "url/gurl.h"
 
 #define STARTER_PROMPT(TYPE)                                              \
   l10n_util::GetStringUTF8(IDS_AI_CHAT_STATIC_STARTER_TITLE_##TYPE),      \
@@ -74,6 +78,16 @@ using ai_chat::mojom::ConversationTurn;
 
 constexpr size_t kDefaultSuggestionsCount = 4;
 
+// How long Ollama keeps a model loaded after a request which didn't specify a
+// keep-alive.
+constexpr base::TimeDelta kOllamaDefaultKeepAlive = base::Minutes(5);
+
+bool IsOllamaModel(const mojom::Model& model) {
+  return model.options && model.options->is_custom_model_options() &&
+         model.options->get_custom_model_options()->endpoint ==
+             GURL(mojom::kOllamaEndpoint);
+}
+
 }  // namespace
 
 ConversationHandler::Suggestion::Suggestion(std::string title)
@@ -157,6 +171,7 @@ ConversationHandler::ConversationHandler(
       &ConversationHandler::OnConversationUIConnectionChanged,
       weak_ptr_factory_.GetWeakPtr()));
   models_observer_.Observe(model_service_.get());
+  model_list_version_ = model_service_->GetModelListVersion();
 
   ChangeModel(metadata_->model_key.value_or("").empty()
                   ? model_service->GetDefaultModelKey()
@@ -255,6 +270,7 @@ void ConversationHandler::OnAssociatedContentUpdated() {
 
   OnStateForConversationEntriesChanged();
   MaybeSeedOrClearSuggestions();
+  MaybePrefetchSuggestedQuestions();
   MaybeFetchOrClearContentStagedConversation();
 
   for (auto& observer : observers_) {
@@ -281,6 +297,32 @@ bool ConversationHandler::IsRequestInProgress() {
   return is_request_in_progress_;
 }
 
+size_t ConversationHandler::EstimateMemoryUsage() const {
+  size_t size = 0;
+  for (const auto& turn : chat_history_) {
+    size += turn->text.size();
+    if (turn->selected_text) {
+      size += turn->selected_text->size();
+    }
+    if (turn->uploaded_files) {
+      for (const auto& file : *turn->uploaded_files) {
+        size += file->data.size();
+      }
+    }
+  }
+  for (const PageContent& content :
+       associated_content_manager_->GetCachedContents()) {
+    size += content.content.size();
+  }
+  return size;
+}
+
+void ConversationHandler::ReleaseCachedResources() {
+  if (engine_) {
+    engine_->ReleaseCachedResources();
+  }
+}
+
 void ConversationHandler::OnConversationDeleted() {
   for (auto& client : conversation_ui_handlers_) {
     client->OnConversationDeleted();
@@ -904,6 +946,12 @@ void ConversationHandler::GenerateQuestions() {
     return;
   }
 
+  if (is_prefetching_suggestions_) {
+    DVLOG(1) << "Suggested questions are already being generated in the "
+                "background";
+    return;
+  }
+
   if (suggestion_generation_status_ ==
           mojom::SuggestionGenerationStatus::IsGenerating ||
       suggestion_generation_status_ ==
@@ -931,6 +979,73 @@ void ConversationHandler::PerformQuestionGeneration() {
                      weak_ptr_factory_.GetWeakPtr()));
 }
 
+void ConversationHandler::MaybePrefetchSuggestedQuestions() {
+  if (!features::IsAIChatSuggestedQuestionsPrefetchEnabled()) {
+    return;
+  }
+
+  size_t content_hash = 0;
+  bool has_content = false;
+  for (const auto& page_content :
+       associated_content_manager_->GetCachedContents()) {
+    const std::string& content = page_content.get().content;
+    has_content |= !base::TrimWhitespaceASCII(content, base::TRIM_ALL).empty();
+    content_hash = base::HashInts(content_hash, base::FastHash(content));
+  }
+
+  if (is_prefetching_suggestions_) {
+    if (suggestion_generation_status_ ==
+            mojom::SuggestionGenerationStatus::IsGenerating &&
+        content_hash == prefetched_suggestions_content_hash_) {
+      return;
+    }
+    // Content changed, e.g. due to a navigation, so the questions being
+    // generated would no longer be relevant.
+    CancelSuggestedQuestionsPrefetch();
+  }
+
+  if (suggestion_generation_status_ !=
+          mojom::SuggestionGenerationStatus::CanGenerate ||
+      !has_content || !ai_chat_service_->HasUserOptedIn() ||
+      !associated_content_manager_->HasAssociatedContent()) {
+    return;
+  }
+
+  if (!ai_chat_service_->ConsumeSuggestedQuestionsPrefetchBudget()) {
+    DVLOG(1) << "Daily budget for background suggested questions is used up";
+    return;
+  }
+
+  is_prefetching_suggestions_ = true;
+  prefetched_suggestions_content_hash_ = content_hash;
+  suggestion_generation_status_ =
+      mojom::SuggestionGenerationStatus::IsGenerating;
+  OnSuggestedQuestionsChanged();
+  engine_->GenerateQuestionSuggestions(
+      associated_content_manager_->GetCachedContents(), selected_language_,
+      base::BindOnce(
+          &ConversationHandler::OnPrefetchedSuggestedQuestionsResponse,
+          suggestions_prefetch_weak_ptr_factory_.GetWeakPtr()));
+}
+
+void ConversationHandler::CancelSuggestedQuestionsPrefetch() {
+  DVLOG(1) << __func__;
+  suggestions_prefetch_weak_ptr_factory_.InvalidateWeakPtrs();
+  is_prefetching_suggestions_ = false;
+  if (suggestion_generation_status_ ==
+      mojom::SuggestionGenerationStatus::IsGenerating) {
+    suggestion_generation_status_ =
+        mojom::SuggestionGenerationStatus::CanGenerate;
+    OnSuggestedQuestionsChanged();
+  }
+}
+
+void ConversationHandler::OnPrefetchedSuggestedQuestionsResponse(
+    EngineConsumer::SuggestedQuestionResult result) {
+  is_prefetching_suggestions_ = false;
+  OnSuggestedQuestionsResponse(std::move(result));
+}
+
 void ConversationHandler::GetAssociatedContentInfo(
     GetAssociatedContentInfoCallback callback) {
   std::move(callback).Run(associated_content_manager_->GetAssociatedContent());
@@ -1210,6 +1325,12 @@ void ConversationHandler::PerformAssistantGeneration() {
   // assistant entries in a row.
   needs_new_entry_ = true;
 
+  local_model_generation_start_.reset();
+  if (IsOllamaModel(GetCurrentModel())) {
+    local_model_generation_start_ = base::TimeTicks::Now();
+    local_model_generation_warm_ = model_service_->IsLocalModelWarm(model_key_);
+  }
+
   engine_->GenerateAssistantResponse(
       associated_content_manager_->GetCachedContentsMap(), chat_history_,
       selected_language_, IsTemporaryChat(), GetTools(),
@@ -1282,11 +1403,14 @@ void ConversationHandler::UpdateOrCreateLastAssistantEntry(
       if (entry->events->size() > 0) {
         auto& last_event = entry->events->back();
         if (last_event->is_completion_event()) {
-          // Merge completion events
+          // Merge completion events by appending the delta to the previous
+          // event's text in place, rather than building a new string from
+          // both on every chunk which is quadratic in the response length.
           if (engine_->SupportsDeltaTextResponses()) {
-            event->get_completion_event()->completion =
-                base::StrCat({last_event->get_completion_event()->completion,
-                              event->get_completion_event()->completion});
+            std::string& completion =
+                last_event->get_completion_event()->completion;
+            completion.append(event->get_completion_event()->completion);
+            event->get_completion_event()->completion = std::move(completion);
           }
           // Remove the last event because we'll replace in both delta and
           // non-delta cases
@@ -1312,9 +1436,8 @@ void ConversationHandler::UpdateOrCreateLastAssistantEntry(
 
       if (last_event->is_tool_use_event() &&
           tool_use_event->tool_name.empty()) {
-        last_event->get_tool_use_event()->arguments_json =
-            base::StrCat({last_event->get_tool_use_event()->arguments_json,
-                          tool_use_event->arguments_json});
+        last_event->get_tool_use_event()->arguments_json.append(
+            tool_use_event->arguments_json);
         // TODO(petemill): Don't clone
         OnHistoryUpdate(entry.Clone());
         return;
@@ -1569,11 +1692,25 @@ void ConversationHandler::OnGeneratePageContentComplete(
 
 void ConversationHandler::OnEngineCompletionDataReceived(
     EngineConsumer::GenerationResultData result) {
+  if (local_model_generation_start_) {
+    base::UmaHistogramMediumTimes(
+        local_model_generation_warm_
+            ? "Brave.AIChat.Ollama.TimeToFirstToken.Warm"
+            : "Brave.AIChat.Ollama.TimeToFirstToken.Cold",
+        base::TimeTicks::Now() - *local_model_generation_start_);
+    local_model_generation_start_.reset();
+  }
   UpdateOrCreateLastAssistantEntry(std::move(result));
 }
 
 void ConversationHandler::OnEngineCompletionComplete(
     EngineConsumer::GenerationResult result) {
+  local_model_generation_start_.reset();
+  if (result.has_value() && IsOllamaModel(GetCurrentModel())) {
+    model_service_->SetLocalModelWarmUntil(
+        model_key_, base::TimeTicks::Now() + kOllamaDefaultKeepAlive);
+  }
+
   // Handle failure
   if (!result.has_value()) {
     if (result.error() != mojom::APIError::None) {
@@ -1684,6 +1821,14 @@ void ConversationHandler::OnSuggestedQuestionsResponse(
 }
 
 void ConversationHandler::OnModelListUpdated() {
+  // Nothing to do if this conversation already saw this version of the list,
+  // e.g. it was created after the change but before the notification.
+  const uint64_t model_list_version = model_service_->GetModelListVersion();
+  if (model_list_version == model_list_version_) {
+    return;
+  }
+  model_list_version_ = model_list_version;
+
   OnModelDataChanged();
 
   const mojom::Model* model = model_service_->GetModel(model_key_);
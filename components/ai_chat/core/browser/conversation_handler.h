@@ -24,6 +24,7 @@
 #include "base/observer_list.h"
 #include "base/observer_list_types.h"
 #include "base/scoped_observation.h"
+#include "base/time/time.h"
 #include "base/types/expected.h"
 #include "brave/components/ai_chat/core/browser/ai_chat_credential_manager.h"
 #include "brave/components/ai_chat/core/browser/ai_chat_metrics.h"
@@ -169,6 +170,11 @@ class ConversationHandler : public mojom::ConversationHandler,
   bool HasAnyHistory();
   bool IsRequestInProgress();
 
+  // Approximate bytes held for this conversation's history and content.
+  size_t EstimateMemoryUsage() const;
+  // Drops caches that can be rebuilt on the next request.
+  void ReleaseCachedResources();
+
   const mojom::Model& GetCurrentModel();
   const std::vector<mojom::ConversationTurnPtr>& GetConversationHistory() const;
 
@@ -359,6 +365,13 @@ class ConversationHandler : public mojom::ConversationHandler,
       EngineConsumer::GenerationResultData result);
   void MaybeSeedOrClearSuggestions();
   void PerformQuestionGeneration();
+  // Starts generating suggested questions in the background once content has
+  // been extracted, or cancels a background generation whose content has
+  // since changed. See features::kAIChatSuggestedQuestionsPrefetch.
+  void MaybePrefetchSuggestedQuestions();
+  void CancelSuggestedQuestionsPrefetch();
+  void OnPrefetchedSuggestedQuestionsResponse(
+      EngineConsumer::SuggestedQuestionResult result);
 
   void OnGetStagedEntriesFromContent(
       const std::optional<std::vector<SearchQuerySummary>>& entries);
@@ -418,6 +431,8 @@ class ConversationHandler : public mojom::ConversationHandler,
   std::unique_ptr<AssociatedContentManager> associated_content_manager_;
 
   std::string model_key_;
+  // ModelService model list version this conversation last synced with.
+  uint64_t model_list_version_ = 0;
   // Chat conversation entries
   std::vector<mojom::ConversationTurnPtr> chat_history_;
   mojom::ConversationTurnPtr pending_conversation_entry_;
@@ -439,6 +454,11 @@ class ConversationHandler : public mojom::ConversationHandler,
   // successfully.
   mojom::SuggestionGenerationStatus suggestion_generation_status_ =
       mojom::SuggestionGenerationStatus::None;
+  // Whether the current generation of suggested questions was started in the
+  // background rather than by the UI, and a hash of the content it was
+  // started for.
+  bool is_prefetching_suggestions_ = false;
+  size_t prefetched_suggestions_content_hash_ = 0;
 
   // When this is true, the most recent content retrieval was different to the
   // previous one.
@@ -452,6 +472,11 @@ class ConversationHandler : public mojom::ConversationHandler,
   // created in a new sibling ConversationEntry.
   bool needs_new_entry_ = false;
 
+  // Set while waiting for the first response data from a locally served
+  // (Ollama) model, for time-to-first-token metrics.
+  std::optional<base::TimeTicks> local_model_generation_start_;
+  bool local_model_generation_warm_ = false;
+
   bool is_print_preview_fallback_requested_ = false;
 
   std::unique_ptr<EngineConsumer> engine_ = nullptr;
@@ -498,6 +523,10 @@ class ConversationHandler : public mojom::ConversationHandler,
   mojo::RemoteSet<mojom::UntrustedConversationUI>
       untrusted_conversation_ui_handlers_;
 
+  // Invalidated to drop the response of a cancelled background generation of
+  // suggested questions.
+  base::WeakPtrFactory<ConversationHandler>
+      suggestions_prefetch_weak_ptr_factory_{this};
   base::WeakPtrFactory<ConversationHandler> weak_ptr_factory_{this};
 };
 
@@ -2135,6 +2135,76 @@ TEST_F(ConversationHandlerUnitTest, GenerateQuestions) {
   testing::Mock::VerifyAndClearExpectations(engine);
 }
 
+TEST_F(ConversationHandlerUnitTest, PrefetchSuggestedQuestions) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeatureWithParameters(
+      features::kAIChatSuggestedQuestionsPrefetch, {{"daily_budget", "1"}});
+  const std::vector<std::string> questions = {"Question 1?", "Question 2?"};
+  associated_content_->SetUrl(GURL("https://www.example.com"));
+  associated_content_->SetTextContent("Some example page content");
+
+  MockEngineConsumer* engine = static_cast<MockEngineConsumer*>(
+      conversation_handler_->GetEngineForTesting());
+  // Questions are generated without any client connected or asking for them.
+  EXPECT_CALL(*engine, GenerateQuestionSuggestions(_, _, _))
+      .WillOnce(base::test::RunOnceCallback<2>(questions));
+
+  base::RunLoop loop;
+  conversation_handler_->associated_content_manager()->GetContent(
+      loop.QuitClosure());
+  loop.Run();
+  conversation_handler_->OnAssociatedContentUpdated();
+  task_environment_.RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(engine);
+
+  // The summarize suggestion followed by the generated questions.
+  EXPECT_EQ(conversation_handler_->GetSuggestedQuestionsForTest().size(), 3u);
+  // The daily budget has been used up.
+  EXPECT_FALSE(ai_chat_service_->ConsumeSuggestedQuestionsPrefetchBudget());
+}
+
+TEST_F(ConversationHandlerUnitTest,
+       PrefetchSuggestedQuestions_CancelledWhenContentChanges) {
+  base::test::ScopedFeatureList feature_list(
+      features::kAIChatSuggestedQuestionsPrefetch);
+  associated_content_->SetUrl(GURL("https://www.example.com"));
+  associated_content_->SetTextContent("Some example page content");
+
+  MockEngineConsumer* engine = static_cast<MockEngineConsumer*>(
+      conversation_handler_->GetEngineForTesting());
+  std::vector<EngineConsumer::SuggestedQuestionsCallback> callbacks;
+  EXPECT_CALL(*engine, GenerateQuestionSuggestions(_, _, _))
+      .Times(2)
+      .WillRepeatedly(testing::WithArg<2>(
+          [&](EngineConsumer::SuggestedQuestionsCallback callback) {
+            callbacks.push_back(std::move(callback));
+          }));
+
+  base::RunLoop loop1;
+  conversation_handler_->associated_content_manager()->GetContent(
+      loop1.QuitClosure());
+  loop1.Run();
+  conversation_handler_->OnAssociatedContentUpdated();
+  ASSERT_EQ(callbacks.size(), 1u);
+
+  associated_content_->SetTextContent("Some other page content");
+  base::RunLoop loop2;
+  conversation_handler_->associated_content_manager()->GetContent(
+      loop2.QuitClosure());
+  loop2.Run();
+  conversation_handler_->OnAssociatedContentUpdated();
+  ASSERT_EQ(callbacks.size(), 2u);
+
+  // The response for the previous content is dropped.
+  std::move(callbacks[0]).Run(std::vector<std::string>{"Stale question?"});
+  EXPECT_EQ(conversation_handler_->GetSuggestedQuestionsForTest().size(), 1u);
+  std::move(callbacks[1]).Run(std::vector<std::string>{"Question?"});
+  const auto& suggestions =
+      conversation_handler_->GetSuggestedQuestionsForTest();
+  ASSERT_EQ(suggestions.size(), 2u);
+  EXPECT_EQ(suggestions[1].title, "Question?");
+}
+
 TEST_F(ConversationHandlerUnitTest,
        MaybeSeedOrClearSuggestions_UpdatesWithAssociatedContentType) {
   associated_content_->SetUrl(GURL("https://www.example.com/"));
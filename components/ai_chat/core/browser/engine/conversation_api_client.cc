@@ -352,10 +352,14 @@ void ConversationAPIClient::PerformRequestWithCredentials(
                        weak_ptr_factory_.GetWeakPtr(), std::move(credential),
                        std::move(completed_callback));
 
+    // Events from the Brave endpoint are small deltas, so parse them on this
+    // sequence rather than hopping to the decoder task runner per token.
+    api_request_helper::APIRequestOptions options;
+    options.parse_sse_in_process = true;
     api_request_helper_->RequestSSE(net::HttpRequestHeaders::kPostMethod,
                                     api_url, request_body, "application/json",
                                     std::move(on_received),
-                                    std::move(on_complete), headers, {});
+                                    std::move(on_complete), headers, options);
   } else {
     DVLOG(2) << "Making non-streaming AI Chat Conversation API Request";
     auto on_complete =
@@ -447,8 +451,7 @@ void ConversationAPIClient::OnQueryDataReceived(
   }
 
   // Tool calls - they may happen individually or combined with a response event
-  if (const base::Value::List* tool_calls =
-          result_params.FindList("tool_calls")) {
+  if (base::Value::List* tool_calls = result_params.FindList("tool_calls")) {
     // Check for alignment_check that applies to tool calls in this response
     mojom::PermissionChallengePtr permission_challenge = nullptr;
     if (const base::Value::Dict* alignment_dict =
@@ -493,24 +496,26 @@ ConversationAPIClient::ParseResponseEvent(base::Value::Dict& response_event,
 
   // Vary response parsing based on type
   if (*type == "completion") {
-    const std::string* completion = response_event.FindString("completion");
+    std::string* completion = response_event.FindString("completion");
     if (!completion || completion->empty()) {
       return std::nullopt;
     }
     event = mojom::ConversationEntryEvent::NewCompletionEvent(
-        mojom::CompletionEvent::New(*completion));
+        mojom::CompletionEvent::New(std::move(*completion)));
   } else if (*type == "isSearching") {
     event = mojom::ConversationEntryEvent::NewSearchStatusEvent(
         mojom::SearchStatusEvent::New());
   } else if (*type == "searchQueries") {
-    const base::Value::List* queries = response_event.FindList("queries");
+    base::Value::List* queries = response_event.FindList("queries");
     if (!queries) {
       return std::nullopt;
     }
     auto search_queries_event = mojom::SearchQueriesEvent::New();
+    search_queries_event->search_queries.reserve(queries->size());
     for (auto& item : *queries) {
       if (item.is_string()) {
-        search_queries_event->search_queries.push_back(item.GetString());
+        search_queries_event->search_queries.push_back(
+            std::move(item.GetString()));
       }
     }
     event = mojom::ConversationEntryEvent::NewSearchQueriesEvent(
@@ -580,7 +585,7 @@ ConversationAPIClient::ParseResponseEvent(base::Value::Dict& response_event,
           // Add the raw JSON string to the rich results list
           std::string json;
           base::JSONWriter::Write(rich_source_item, &json);
-          web_sources_event->rich_results.push_back(json);
+          web_sources_event->rich_results.push_back(std::move(json));
         }
       }
     }
@@ -591,12 +596,12 @@ ConversationAPIClient::ParseResponseEvent(base::Value::Dict& response_event,
     event = mojom::ConversationEntryEvent::NewSourcesEvent(
         std::move(web_sources_event));
   } else if (*type == "conversationTitle") {
-    const std::string* title = response_event.FindString("title");
+    std::string* title = response_event.FindString("title");
     if (!title) {
       return std::nullopt;
     }
     event = mojom::ConversationEntryEvent::NewConversationTitleEvent(
-        mojom::ConversationTitleEvent::New(*title));
+        mojom::ConversationTitleEvent::New(std::move(*title)));
   } else if (*type == "selectedLanguage") {
     const std::string* selected_language =
         response_event.FindString("language");
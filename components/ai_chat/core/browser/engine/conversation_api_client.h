@@ -172,6 +172,8 @@ class ConversationAPIClient {
 
   void ClearAllQueries();
 
+  // Strings are moved out of |response_event| rather than copied, so it
+  // should not be read again for the fields of the parsed event type.
   static std::optional<GenerationResultData> ParseResponseEvent(
       base::Value::Dict& response_event,
       ModelService* model_service);
@@ -415,6 +415,7 @@ TEST_F(ConversationAPIUnitTest, PerformRequest_PremiumHeaders) {
         EXPECT_EQ(cookie_header->second,
                   "__Secure-sku#brave-leo-premium=" + expected_crediential);
         EXPECT_NE(headers.find("x-brave-key"), headers.end());
+        EXPECT_TRUE(options.parse_sse_in_process);
 
         base::Value::Dict body_dict = base::test::ParseJsonDict(body);
         EXPECT_TRUE(!body_dict.empty());
@@ -7,6 +7,7 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 
 #include "base/base64.h"
 #include "base/strings/escape.h"
@@ -60,8 +61,22 @@ bool EngineConsumer::RequiresClientSideTitleGeneration() const {
 }
 
 std::string EngineConsumer::GetImageDataURL(base::span<uint8_t> image_data) {
-  constexpr char kDataUrlPrefix[] = "data:image/png;base64,";
-  return base::StrCat({kDataUrlPrefix, base::Base64Encode(image_data)});
+  // Screenshots may be encoded as JPEG or WebP, see
+  // features::kAIChatScreenshotEncoding. Anything else is sent as PNG.
+  constexpr uint8_t kJpegSignature[] = {0xFF, 0xD8, 0xFF};
+  constexpr uint8_t kRiffSignature[] = {'R', 'I', 'F', 'F'};
+  constexpr uint8_t kWebpSignature[] = {'W', 'E', 'B', 'P'};
+  std::string_view data_url_prefix = "data:image/png;base64,";
+  if (image_data.size() >= std::size(kJpegSignature) &&
+      image_data.first<std::size(kJpegSignature)>() ==
+          base::span(kJpegSignature)) {
+    data_url_prefix = "data:image/jpeg;base64,";
+  } else if (image_data.size() >= 12 &&
+             image_data.first<4u>() == base::span(kRiffSignature) &&
+             image_data.subspan<8u, 4u>() == base::span(kWebpSignature)) {
+    data_url_prefix = "data:image/webp;base64,";
+  }
+  return base::StrCat({data_url_prefix, base::Base64Encode(image_data)});
 }
 
 std::string EngineConsumer::GetPdfDataURL(base::span<uint8_t> pdf_data) {
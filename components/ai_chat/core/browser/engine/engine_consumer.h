@@ -123,6 +123,10 @@ class EngineConsumer {
   // Stop any in-progress operations
   virtual void ClearAllQueries() = 0;
 
+  // Drops any data cached to speed up future requests. Everything dropped
+  // must be rebuildable from the conversation history.
+  virtual void ReleaseCachedResources() {}
+
   // For streaming responses, whether the engine provides the entire completion
   // each time the callback is run (use |false|) or whether it provides a delta
   // from the previous run (use |true|).
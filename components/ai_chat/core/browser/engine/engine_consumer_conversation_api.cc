@@ -31,6 +31,7 @@
 #include "brave/components/ai_chat/core/browser/associated_content_manager.h"
 #include "brave/components/ai_chat/core/browser/engine/oai_parsing.h"
 #include "brave/components/ai_chat/core/browser/model_service.h"
+#include "brave/components/ai_chat/core/browser/utils.h"
 #include "brave/components/ai_chat/core/common/features.h"
 #include "brave/components/ai_chat/core/common/mojom/ai_chat.mojom.h"
 #include "brave/components/ai_chat/core/common/mojom/common.mojom.h"
@@ -257,11 +258,12 @@ void EngineConsumerConversationAPI::OnGenerateQuestionSuggestionsResponse(
 
 std::optional<ConversationEvent>
 EngineConsumerConversationAPI::GetUserMemoryEvent(
-    bool is_temporary_chat) const {
+    bool is_temporary_chat,
+    std::string_view query) const {
   if (is_temporary_chat) {
     return std::nullopt;
   }
-  auto user_memory_dict = prefs::GetUserMemoryDictFromPrefs(*prefs_);
+  auto user_memory_dict = prefs::GetUserMemoryDictFromPrefs(*prefs_, query);
   if (!user_memory_dict.has_value()) {
     return std::nullopt;
   }
@@ -291,7 +293,8 @@ void EngineConsumerConversationAPI::GenerateAssistantResponse(
   std::vector<ConversationEvent> conversation;
 
   // user memory
-  if (auto event = GetUserMemoryEvent(is_temporary_chat)) {
+  if (auto event = GetUserMemoryEvent(is_temporary_chat,
+                                      conversation_history.back()->text)) {
     conversation.push_back(std::move(*event));
   }
 
@@ -337,8 +340,8 @@ void EngineConsumerConversationAPI::GenerateAssistantResponse(
           break;
         }
 
-        events.push_back(
-            GetAssociatedContentConversationEvent(content, remaining_length));
+        events.push_back(GetAssociatedContentConversationEvent(
+            content, remaining_length, message->text));
         if (content.get().content.size() > remaining_length) {
           remaining_length = 0;
         } else {
@@ -558,9 +561,10 @@ bool EngineConsumerConversationAPI::SupportsDeltaTextResponses() const {
 ConversationEvent
 EngineConsumerConversationAPI::GetAssociatedContentConversationEvent(
     const PageContent& content,
-    uint32_t remaining_length) {
+    uint32_t remaining_length,
+    std::string_view query) {
   std::string truncated_page_content =
-      content.content.substr(0, remaining_length);
+      TruncateContentForQuery(content.content, remaining_length, query);
   SanitizeInput(truncated_page_content);
 
   ConversationEvent event;
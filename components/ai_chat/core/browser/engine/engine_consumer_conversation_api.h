@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -126,9 +127,11 @@ class EngineConsumerConversationAPI : public EngineConsumer {
 
   ConversationAPIClient::ConversationEvent
   GetAssociatedContentConversationEvent(const PageContent& content,
-                                        uint32_t remaining_length);
+                                        uint32_t remaining_length,
+                                        std::string_view query = {});
   std::optional<ConversationAPIClient::ConversationEvent> GetUserMemoryEvent(
-      bool is_temporary_chat) const;
+      bool is_temporary_chat,
+      std::string_view query) const;
 
   std::unique_ptr<ConversationAPIClient> api_ = nullptr;
 
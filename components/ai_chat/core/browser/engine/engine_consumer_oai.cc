@@ -15,6 +15,7 @@
 
 #include "base/containers/adapters.h"
 #include "base/containers/flat_map.h"
+#include "base/containers/lru_cache.h"
 #include "base/functional/bind.h"
 #include "base/functional/callback.h"
 #include "base/functional/callback_helpers.h"
@@ -70,6 +71,9 @@ std::string GetPromptContentForEntry(const mojom::ConversationTurnPtr& turn) {
              : EngineConsumer::GetPromptForEntry(turn);
 }
 
+// Number of turns whose uploaded files messages are kept around.
+constexpr size_t kUploadedFilesMessagesCacheSize = 16;
+
 using mojom::CharacterType;
 using mojom::ConversationTurn;
 
@@ -80,7 +84,8 @@ EngineConsumerOAIRemote::EngineConsumerOAIRemote(
     scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
     ModelService* model_service,
     PrefService* prefs)
-    : EngineConsumer(model_service, prefs) {
+    : EngineConsumer(model_service, prefs),
+      uploaded_files_messages_cache_(kUploadedFilesMessagesCacheSize) {
   model_options_ = model_options;
   max_associated_content_length_ = model_options.max_associated_content_length;
 
@@ -94,6 +99,10 @@ void EngineConsumerOAIRemote::ClearAllQueries() {
   api_->ClearAllQueries();
 }
 
+void EngineConsumerOAIRemote::ReleaseCachedResources() {
+  uploaded_files_messages_cache_.Clear();
+}
+
 bool EngineConsumerOAIRemote::SupportsDeltaTextResponses() const {
   return true;
 }
@@ -251,7 +260,8 @@ void EngineConsumerOAIRemote::GenerateConversationTitle(
          BuildPageContentMessages(page_content_it->second, remaining_length,
                                   IDS_AI_CHAT_LLAMA2_VIDEO_PROMPT_SEGMENT,
                                   IDS_AI_CHAT_LLAMA2_ARTICLE_PROMPT_SEGMENT,
-                                  kMaxContextCharsForTitleGeneration)) {
+                                  kMaxContextCharsForTitleGeneration,
+                                  first_turn->text)) {
       messages.Append(std::move(message));
     }
   }
@@ -314,8 +324,9 @@ void EngineConsumerOAIRemote::GenerateAssistantResponse(
   }
 
   base::Value::List messages = BuildMessages(
-      model_options_, page_contents, BuildUserMemoryMessage(is_temporary_chat),
-      selected_text, conversation_history);
+      model_options_, page_contents,
+      BuildUserMemoryMessage(is_temporary_chat, last_turn->text), selected_text,
+      conversation_history);
 
   api_->PerformRequest(model_options_, std::move(messages),
                        std::move(data_received_callback),
@@ -341,7 +352,8 @@ base::Value::List EngineConsumerOAIRemote::BuildPageContentMessages(
     uint32_t& max_associated_content_length,
     int video_message_id,
     int page_message_id,
-    std::optional<uint32_t> max_per_content_length) {
+    std::optional<uint32_t> max_per_content_length,
+    std::string_view query) {
   base::Value::List messages;
   for (const auto& page_content : base::Reversed(page_contents)) {
     uint32_t effective_length_limit = max_associated_content_length;
@@ -350,8 +362,8 @@ base::Value::List EngineConsumerOAIRemote::BuildPageContentMessages(
           std::min(effective_length_limit, max_per_content_length.value());
     }
 
-    std::string truncated_page_content =
-        page_content.get().content.substr(0, effective_length_limit);
+    std::string truncated_page_content = TruncateContentForQuery(
+        page_content.get().content, effective_length_limit, query);
     uint32_t truncated_page_content_size = truncated_page_content.size();
 
     SanitizeInput(truncated_page_content);
@@ -405,7 +417,8 @@ base::Value::List EngineConsumerOAIRemote::BuildMessages(
       for (auto& message : BuildPageContentMessages(
                page_content_it->second, remaining_content_length,
                IDS_AI_CHAT_LLAMA2_VIDEO_PROMPT_SEGMENT,
-               IDS_AI_CHAT_LLAMA2_ARTICLE_PROMPT_SEGMENT)) {
+               IDS_AI_CHAT_LLAMA2_ARTICLE_PROMPT_SEGMENT, std::nullopt,
+               turn->text)) {
         messages.Append(std::move(message));
       }
     }
@@ -460,64 +473,8 @@ base::Value::List EngineConsumerOAIRemote::BuildMessages(
     }
 
     if (turn->uploaded_files) {
-      base::Value::List content_uploaded_images;
-      base::Value::List content_screenshots;
-      base::Value::List content_uploaded_pdfs;
-
-      content_uploaded_images.Append(
-          base::Value::Dict()
-              .Set("type", "text")
-              .Set("text", "These images are uploaded by the user"));
-      content_screenshots.Append(
-          base::Value::Dict()
-              .Set("type", "text")
-              .Set("text", "These images are screenshots"));
-      content_uploaded_pdfs.Append(
-          base::Value::Dict()
-              .Set("type", "text")
-              .Set("text", "These PDFs are uploaded by the user"));
-      for (const auto& uploaded_file : turn->uploaded_files.value()) {
-        if (uploaded_file->type == mojom::UploadedFileType::kImage ||
-            uploaded_file->type == mojom::UploadedFileType::kScreenshot) {
-          base::Value::Dict image;
-          image.Set("type", "image_url");
-          base::Value::Dict image_url_dict;
-          image_url_dict.Set(
-              "url", EngineConsumer::GetImageDataURL(uploaded_file->data));
-          image.Set("image_url", std::move(image_url_dict));
-          if (uploaded_file->type == mojom::UploadedFileType::kImage) {
-            content_uploaded_images.Append(std::move(image));
-          } else {
-            content_screenshots.Append(std::move(image));
-          }
-        } else if (uploaded_file->type == mojom::UploadedFileType::kPdf) {
-          base::Value::Dict pdf_file;
-          pdf_file.Set("type", "file");
-          base::Value::Dict file_dict;
-          file_dict.Set("filename", uploaded_file->filename.empty()
-                                        ? "uploaded.pdf"
-                                        : uploaded_file->filename);
-          file_dict.Set("file_data",
-                        EngineConsumer::GetPdfDataURL(uploaded_file->data));
-          pdf_file.Set("file", std::move(file_dict));
-          content_uploaded_pdfs.Append(std::move(pdf_file));
-        }
-      }
-      if (content_uploaded_images.size() > 1) {
-        messages.Append(
-            base::Value::Dict()
-                .Set("role", "user")
-                .Set("content", std::move(content_uploaded_images)));
-      }
-      if (content_screenshots.size() > 1) {
-        messages.Append(base::Value::Dict()
-                            .Set("role", "user")
-                            .Set("content", std::move(content_screenshots)));
-      }
-      if (content_uploaded_pdfs.size() > 1) {
-        messages.Append(base::Value::Dict()
-                            .Set("role", "user")
-                            .Set("content", std::move(content_uploaded_pdfs)));
+      for (const auto& message : GetUploadedFilesMessages(turn)) {
+        messages.Append(message.Clone());
       }
     }
 
@@ -555,12 +512,90 @@ base::Value::List EngineConsumerOAIRemote::BuildMessages(
   return messages;
 }
 
+const base::Value::List& EngineConsumerOAIRemote::GetUploadedFilesMessages(
+    const mojom::ConversationTurnPtr& turn) {
+  // Files can't be changed once a turn is submitted, so the (base64-encoded)
+  // messages built for a turn stay valid for every later request of the
+  // conversation.
+  auto cached = uploaded_files_messages_cache_.Get(turn->uuid.value());
+  if (cached != uploaded_files_messages_cache_.end()) {
+    return cached->second;
+  }
+
+  base::Value::List content_uploaded_images;
+  base::Value::List content_screenshots;
+  base::Value::List content_uploaded_pdfs;
+
+  content_uploaded_images.Append(
+      base::Value::Dict()
+          .Set("type", "text")
+          .Set("text", "These images are uploaded by the user"));
+  content_screenshots.Append(
+      base::Value::Dict()
+          .Set("type", "text")
+          .Set("text", "These images are screenshots"));
+  content_uploaded_pdfs.Append(
+      base::Value::Dict()
+          .Set("type", "text")
+          .Set("text", "These PDFs are uploaded by the user"));
+  for (const auto& uploaded_file : turn->uploaded_files.value()) {
+    if (uploaded_file->type == mojom::UploadedFileType::kImage ||
+        uploaded_file->type == mojom::UploadedFileType::kScreenshot) {
+      base::Value::Dict image;
+      image.Set("type", "image_url");
+      base::Value::Dict image_url_dict;
+      image_url_dict.Set(
+          "url", EngineConsumer::GetImageDataURL(uploaded_file->data));
+      image.Set("image_url", std::move(image_url_dict));
+      if (uploaded_file->type == mojom::UploadedFileType::kImage) {
+        content_uploaded_images.Append(std::move(image));
+      } else {
+        content_screenshots.Append(std::move(image));
+      }
+    } else if (uploaded_file->type == mojom::UploadedFileType::kPdf) {
+      base::Value::Dict pdf_file;
+      pdf_file.Set("type", "file");
+      base::Value::Dict file_dict;
+      file_dict.Set("filename", uploaded_file->filename.empty()
+                                    ? "uploaded.pdf"
+                                    : uploaded_file->filename);
+      file_dict.Set("file_data",
+                    EngineConsumer::GetPdfDataURL(uploaded_file->data));
+      pdf_file.Set("file", std::move(file_dict));
+      content_uploaded_pdfs.Append(std::move(pdf_file));
+    }
+  }
+  base::Value::List files_messages;
+  if (content_uploaded_images.size() > 1) {
+    files_messages.Append(
+        base::Value::Dict()
+            .Set("role", "user")
+            .Set("content", std::move(content_uploaded_images)));
+  }
+  if (content_screenshots.size() > 1) {
+    files_messages.Append(
+        base::Value::Dict()
+            .Set("role", "user")
+            .Set("content", std::move(content_screenshots)));
+  }
+  if (content_uploaded_pdfs.size() > 1) {
+    files_messages.Append(
+        base::Value::Dict()
+            .Set("role", "user")
+            .Set("content", std::move(content_uploaded_pdfs)));
+  }
+  auto it = uploaded_files_messages_cache_.Put(turn->uuid.value(),
+                                               std::move(files_messages));
+  return it->second;
+}
+
 std::optional<base::Value::Dict>
-EngineConsumerOAIRemote::BuildUserMemoryMessage(bool is_temporary_chat) {
+EngineConsumerOAIRemote::BuildUserMemoryMessage(bool is_temporary_chat,
+                                                std::string_view query) {
   if (is_temporary_chat) {
     return std::nullopt;
   }
-  auto memories = prefs::GetUserMemoryDictFromPrefs(*prefs_);
+  auto memories = prefs::GetUserMemoryDictFromPrefs(*prefs_, query);
   if (!memories) {
     return std::nullopt;
   }
@@ -9,10 +9,13 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "base/containers/lru_cache.h"
 #include "base/memory/weak_ptr.h"
+#include "base/values.h"
 #include "brave/components/ai_chat/core/browser/ai_chat_credential_manager.h"
 #include "brave/components/ai_chat/core/browser/associated_content_manager.h"
 #include "brave/components/ai_chat/core/browser/engine/engine_consumer.h"
@@ -75,6 +78,7 @@ class EngineConsumerOAIRemote : public EngineConsumer {
       GenerationCompletedCallback completed_callback) override;
   void SanitizeInput(std::string& input) override;
   void ClearAllQueries() override;
+  void ReleaseCachedResources() override;
   bool SupportsDeltaTextResponses() const override;
   bool RequiresClientSideTitleGeneration() const override;
   void GetSuggestedTopics(const std::vector<Tab>& tabs,
@@ -122,7 +126,8 @@ class EngineConsumerOAIRemote : public EngineConsumer {
       uint32_t& max_associated_content_length,
       int video_message_id,
       int page_message_id,
-      std::optional<uint32_t> max_per_content_length = std::nullopt);
+      std::optional<uint32_t> max_per_content_length = std::nullopt,
+      std::string_view query = {});
 
   base::Value::List BuildMessages(
       const mojom::CustomModelOptions& model_options,
@@ -131,8 +136,14 @@ class EngineConsumerOAIRemote : public EngineConsumer {
       const std::optional<std::string>& selected_text,
       const EngineConsumer::ConversationHistory& conversation_history);
 
+  // Returns the messages carrying the files uploaded with `turn`, built once
+  // per turn.
+  const base::Value::List& GetUploadedFilesMessages(
+      const mojom::ConversationTurnPtr& turn);
+
   std::optional<base::Value::Dict> BuildUserMemoryMessage(
-      bool is_temporary_chat);
+      bool is_temporary_chat,
+      std::string_view query);
 
   void OnGenerateQuestionSuggestionsResponse(
       SuggestedQuestionsCallback callback,
@@ -144,6 +155,9 @@ class EngineConsumerOAIRemote : public EngineConsumer {
 
   std::unique_ptr<OAIAPIClient> api_ = nullptr;
   mojom::CustomModelOptions model_options_;
+  // Uploaded files messages by turn uuid.
+  base::LRUCache<std::string, base::Value::List>
+      uploaded_files_messages_cache_;
 
   base::WeakPtrFactory<EngineConsumerOAIRemote> weak_ptr_factory_{this};
 };
@@ -794,6 +794,74 @@ TEST_F(EngineConsumerOAIUnitTest, GenerateAssistantResponseUploadImage) {
   testing::Mock::VerifyAndClearExpectations(client);
 }
 
+TEST_F(EngineConsumerOAIUnitTest,
+       GenerateAssistantResponseReusesUploadedFilesMessages) {
+  EngineConsumer::ConversationHistory history;
+  auto* client = GetClient();
+  auto uploaded_images =
+      CreateSampleUploadedFiles(2, mojom::UploadedFileType::kImage);
+  history.push_back(mojom::ConversationTurn::New(
+      "turn-1", mojom::CharacterType::HUMAN, mojom::ActionType::UNSPECIFIED,
+      "What are these images?", "What are these images?", std::nullopt,
+      std::nullopt, base::Time::Now(), std::nullopt, Clone(uploaded_images),
+      nullptr /* skill */, false, std::nullopt /* model_key */,
+      nullptr /* near_verification_status */));
+
+  // Both requests for the same turn must carry identical file messages, the
+  // second one being served from the per-turn cache.
+  std::vector<base::Value::List> requests;
+  EXPECT_CALL(*client, PerformRequest(_, _, _, _, _))
+      .Times(2)
+      .WillRepeatedly(
+          [&requests](
+              const mojom::CustomModelOptions, base::Value::List messages,
+              EngineConsumer::GenerationDataCallback,
+              EngineConsumer::GenerationCompletedCallback completed_callback,
+              const std::optional<std::vector<std::string>>&) {
+            requests.push_back(std::move(messages));
+            std::move(completed_callback)
+                .Run(base::unexpected(mojom::APIError::None));
+          });
+
+  for (int i = 0; i < 2; ++i) {
+    base::test::TestFuture<EngineConsumer::GenerationResult> future;
+    engine_->GenerateAssistantResponse({}, history, "", false, {},
+                                       std::nullopt,
+                                       mojom::ConversationCapability::CHAT,
+                                       base::DoNothing(), future.GetCallback());
+    EXPECT_FALSE(future.Take().has_value());
+  }
+
+  ASSERT_EQ(requests.size(), 2u);
+  ASSERT_EQ(requests[0].size(), 3u);
+  ASSERT_EQ(requests[1].size(), 3u);
+  EXPECT_EQ(requests[0][1], requests[1][1]);
+  const base::Value::List* content =
+      requests[1][1].GetDict().FindList("content");
+  ASSERT_TRUE(content);
+  ASSERT_EQ(content->size(), 3u);
+  EXPECT_EQ(*(*content)[1].GetDict().FindStringByDottedPath("image_url.url"),
+            EngineConsumer::GetImageDataURL(uploaded_images[0]->data));
+  testing::Mock::VerifyAndClearExpectations(client);
+}
+
+TEST_F(EngineConsumerOAIUnitTest, GetImageDataURL) {
+  std::vector<uint8_t> png = {0x89, 'P', 'N', 'G'};
+  EXPECT_EQ(EngineConsumer::GetImageDataURL(png),
+            "data:image/png;base64,iVBORw==");
+  std::vector<uint8_t> jpeg = {0xFF, 0xD8, 0xFF, 0xE0};
+  EXPECT_EQ(EngineConsumer::GetImageDataURL(jpeg),
+            "data:image/jpeg;base64,/9j/4A==");
+  std::vector<uint8_t> webp = {'R', 'I', 'F', 'F', 0, 0, 0, 0,
+                               'W', 'E', 'B', 'P'};
+  EXPECT_EQ(EngineConsumer::GetImageDataURL(webp),
+            "data:image/webp;base64,UklGRgAAAABXRUJQ");
+  // Too short to carry a WebP signature.
+  std::vector<uint8_t> riff = {'R', 'I', 'F', 'F'};
+  EXPECT_EQ(EngineConsumer::GetImageDataURL(riff),
+            "data:image/png;base64,UklGRg==");
+}
+
 TEST_F(EngineConsumerOAIUnitTest, GenerateAssistantResponseUploadPdf) {
   EngineConsumer::ConversationHistory history;
   auto* client = GetClient();
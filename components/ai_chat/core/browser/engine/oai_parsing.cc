@@ -14,38 +14,41 @@
 namespace ai_chat {
 
 std::vector<mojom::ToolUseEventPtr> ToolUseEventFromToolCallsResponse(
-    const base::Value::List* tool_calls_api_response) {
+    base::Value::List* tool_calls_api_response) {
   // https://platform.openai.com/docs/api-reference/chat/create#chat-create-tools
   // https://platform.openai.com/docs/api-reference/chat/object
   // choices -> message -> tool_calls
   std::vector<mojom::ToolUseEventPtr> tool_use_events;
+  tool_use_events.reserve(tool_calls_api_response->size());
   for (auto& tool_call_raw : *tool_calls_api_response) {
     if (!tool_call_raw.is_dict()) {
       DLOG(ERROR) << "Tool call is not a dictionary.";
       continue;
     }
-    const auto& tool_call = tool_call_raw.GetDict();
+    auto& tool_call = tool_call_raw.GetDict();
 
     // Most APIs that have partial chunk responses seem to initially always have
     // the tool name and id, and only chunk the arguments json. So whilst id and
     // name are required for the completed event, we can't rely on them being
     // present for parsing.
 
-    const base::Value::Dict* function = tool_call.FindDict("function");
+    base::Value::Dict* function = tool_call.FindDict("function");
     if (!function) {
       DLOG(ERROR) << "No function info found in tool call.";
       continue;
     }
 
-    const std::string* id = tool_call.FindString("id");
-    const std::string* name = function->FindString("name");
+    std::string* id = tool_call.FindString("id");
+    std::string* name = function->FindString("name");
 
-    mojom::ToolUseEventPtr tool_use_event = mojom::ToolUseEvent::New(
-        name ? *name : "", id ? *id : "", "", std::nullopt, nullptr);
+    mojom::ToolUseEventPtr tool_use_event =
+        mojom::ToolUseEvent::New(name ? std::move(*name) : "",
+                                 id ? std::move(*id) : "", "", std::nullopt,
+                                 nullptr);
 
-    const std::string* arguments_raw = function->FindString("arguments");
+    std::string* arguments_raw = function->FindString("arguments");
     if (arguments_raw) {
-      tool_use_event->arguments_json = *arguments_raw;
+      tool_use_event->arguments_json = std::move(*arguments_raw);
     }
 
     tool_use_events.push_back(std::move(tool_use_event));
@@ -16,9 +16,10 @@
 namespace ai_chat {
 
 // Construct a tool use event from a tool calls part of a Chat API-style
-// response
+// response. Strings, notably the partial arguments JSON, are moved out of
+// |tool_calls_api_response| rather than copied.
 std::vector<mojom::ToolUseEventPtr> ToolUseEventFromToolCallsResponse(
-    const base::Value::List* tool_calls_api_response);
+    base::Value::List* tool_calls_api_response);
 
 // Convert some Tools to Chat API-style JSON list of tool definitions
 std::optional<base::Value::List> ToolApiDefinitionsFromTools(
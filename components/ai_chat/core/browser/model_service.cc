@@ -21,6 +21,8 @@
 #include "base/check.h"
 #include "base/containers/checked_iterators.h"
 #include "base/containers/contains.h"
+#include "base/functional/bind.h"
+#include "base/location.h"
 #include "base/logging.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/metrics/field_trial_params.h"
@@ -29,6 +31,7 @@
 #include "base/numerics/safe_math.h"
 #include "base/strings/strcat.h"
 #include "base/strings/string_util.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/uuid.h"
 #include "base/values.h"
 #include "brave/components/ai_chat/core/browser/constants.h"
@@ -762,7 +765,26 @@ void ModelService::InitModels() {
   std::transform(custom_models.cbegin(), custom_models.cend(),
                  std::back_inserter(models_),
                  [](const mojom::ModelPtr& model) { return model.Clone(); });
+  ++model_list_version_;
 
+  if (!features::IsAIChatModelListBatchingEnabled()) {
+    NotifyModelListUpdated();
+    return;
+  }
+
+  // The list itself is always up to date; only the notification is deferred
+  // so that several changes in one task reach observers once.
+  if (model_list_notification_pending_ || observers_.empty()) {
+    return;
+  }
+  model_list_notification_pending_ = true;
+  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+      FROM_HERE, base::BindOnce(&ModelService::NotifyModelListUpdated,
+                                weak_ptr_factory_.GetWeakPtr()));
+}
+
+void ModelService::NotifyModelListUpdated() {
+  model_list_notification_pending_ = false;
   for (auto& obs : observers_) {
     obs.OnModelListUpdated();
   }
@@ -1074,6 +1096,18 @@ const std::string& ModelService::GetDefaultModelKey() {
   return pref_service_->GetString(kDefaultModelKey);
 }
 
+void ModelService::SetLocalModelWarmUntil(const std::string& model_key,
+                                          base::TimeTicks warm_until) {
+  auto& current = local_model_warm_until_[model_key];
+  current = std::max(current, warm_until);
+}
+
+bool ModelService::IsLocalModelWarm(const std::string& model_key) const {
+  auto it = local_model_warm_until_.find(model_key);
+  return it != local_model_warm_until_.end() &&
+         it->second > base::TimeTicks::Now();
+}
+
 const std::vector<mojom::ModelPtr> ModelService::GetCustomModels() {
   std::vector<mojom::ModelPtr> models;
 
@@ -14,11 +14,13 @@
 #include <string_view>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
 #include "base/observer_list_types.h"
+#include "base/time/time.h"
 #include "brave/components/ai_chat/core/browser/ai_chat_credential_manager.h"
 #include "brave/components/ai_chat/core/common/mojom/ai_chat.mojom-forward.h"
 #include "brave/components/ai_chat/core/common/mojom/common.mojom-forward.h"
@@ -66,6 +68,9 @@ class ModelService : public KeyedService {
   // All models that the user can choose for chat conversations, in UI display
   // order.
   const std::vector<ai_chat::mojom::ModelPtr>& GetModels();
+  // Incremented each time the list returned by GetModels() changes, so
+  // observers can tell whether a notification carries anything new.
+  uint64_t GetModelListVersion() const { return model_list_version_; }
   std::vector<ai_chat::mojom::ModelWithSubtitlePtr> GetModelsWithSubtitles();
   const ai_chat::mojom::Model* GetModel(std::string_view key);
 
@@ -86,6 +91,13 @@ class ModelService : public KeyedService {
   void SetDefaultModelKey(const std::string& model_key);
   const std::string& GetDefaultModelKey();
 
+  // Records that the locally served model |model_key| (e.g. via Ollama) is
+  // expected to stay loaded in memory until at least |warm_until|. Used to
+  // tell cold and warm starts apart when measuring response latency.
+  void SetLocalModelWarmUntil(const std::string& model_key,
+                              base::TimeTicks warm_until);
+  bool IsLocalModelWarm(const std::string& model_key) const;
+
   void AddObserver(Observer* observer);
   void RemoveObserver(Observer* observer);
 
@@ -104,11 +116,15 @@ class ModelService : public KeyedService {
 
  private:
   void InitModels();
+  void NotifyModelListUpdated();
 
   base::ObserverList<Observer> observers_;
   std::vector<ai_chat::mojom::ModelPtr> models_;
+  uint64_t model_list_version_ = 0;
+  bool model_list_notification_pending_ = false;
   raw_ptr<PrefService> pref_service_;
   bool is_migrating_claude_instant_ = false;
+  base::flat_map<std::string, base::TimeTicks> local_model_warm_until_;
 
   base::WeakPtrFactory<ModelService> weak_ptr_factory_{this};
 };
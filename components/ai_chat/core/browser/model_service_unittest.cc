@@ -15,6 +15,7 @@
 #include "base/scoped_observation.h"
 #include "base/test/bind.h"
 #include "base/test/scoped_feature_list.h"
+#include "base/test/task_environment.h"
 #include "brave/components/ai_chat/core/browser/constants.h"
 #include "brave/components/ai_chat/core/browser/model_validator.h"
 #include "brave/components/ai_chat/core/common/constants.h"
@@ -389,6 +390,31 @@ TEST_F(ModelServiceTest, GetLeoModelKeyByName_And_GetLeoModelNameByKey) {
   EXPECT_FALSE(name.has_value());
 }
 
+TEST_F(ModelServiceTest, ModelListUpdatesCoalesced) {
+  base::test::TaskEnvironment task_environment;
+  base::test::ScopedFeatureList feature_list(
+      features::kAIChatModelListBatching);
+  const GURL endpoint("http://example.com");
+  const size_t initial_size = GetService()->GetModels().size();
+  const uint64_t initial_version = GetService()->GetModelListVersion();
+
+  // Changes are visible right away, but observers are told once.
+  EXPECT_CALL(*observer_, OnModelListUpdated()).Times(0);
+  for (const char* name : {"model1", "model2"}) {
+    mojom::ModelPtr model = mojom::Model::New();
+    model->display_name = name;
+    model->options = mojom::ModelOptions::NewCustomModelOptions(
+        mojom::CustomModelOptions::New(name, 0, 0, 0, "", endpoint, ""));
+    GetService()->AddCustomModel(std::move(model));
+  }
+  EXPECT_EQ(GetService()->GetModels().size(), initial_size + 2);
+  EXPECT_EQ(GetService()->GetModelListVersion(), initial_version + 2);
+  testing::Mock::VerifyAndClearExpectations(observer_.get());
+
+  EXPECT_CALL(*observer_, OnModelListUpdated()).Times(1);
+  task_environment.RunUntilIdle();
+}
+
 TEST_F(ModelServiceTest, DeleteCustomModelsByEndpoint) {
   const GURL endpoint1 = GURL("http://example.com");
   const GURL endpoint2 = GURL("http://other.com");
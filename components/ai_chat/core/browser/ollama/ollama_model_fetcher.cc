@@ -13,10 +13,13 @@
 
 #include "base/json/json_reader.h"
 #include "base/logging.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/values.h"
 #include "brave/components/ai_chat/core/browser/model_service.h"
 #include "brave/components/ai_chat/core/common/constants.h"
+#include "brave/components/ai_chat/core/common/features.h"
+#include "brave/components/ai_chat/core/common/mojom/ai_chat.mojom.h"
 #include "brave/components/ai_chat/core/common/mojom/ollama.mojom.h"
 #include "brave/components/ai_chat/core/common/pref_names.h"
 #include "components/prefs/pref_service.h"
@@ -55,6 +58,75 @@ void OllamaModelFetcher::SetDelegate(Delegate* delegate) {
   delegate_ = delegate;
 }
 
+void OllamaModelFetcher::WarmDefaultModel() {
+  if (!delegate_ || !features::IsOllamaWarmPoolEnabled() ||
+      !prefs_->GetBoolean(prefs::kBraveAIChatOllamaFetchEnabled)) {
+    return;
+  }
+
+  const std::string model_key = model_service_->GetDefaultModelKey();
+  if (warming_model_key_ == model_key ||
+      model_service_->IsLocalModelWarm(model_key)) {
+    return;
+  }
+
+  const mojom::Model* model = model_service_->GetModel(model_key);
+  if (!model || !model->options ||
+      !model->options->is_custom_model_options() ||
+      model->options->get_custom_model_options()->endpoint !=
+          GURL(mojom::kOllamaEndpoint)) {
+    return;
+  }
+
+  // Check the size of the model before asking Ollama to load it.
+  warming_model_key_ = model_key;
+  const std::string& model_name =
+      model->options->get_custom_model_options()->model_request_name;
+  delegate_->ShowModel(
+      model_name,
+      base::BindOnce(&OllamaModelFetcher::OnWarmModelDetailsFetched,
+                     weak_ptr_factory_.GetWeakPtr(), model_key, model_name));
+}
+
+void OllamaModelFetcher::OnWarmModelDetailsFetched(
+    const std::string& model_key,
+    const std::string& model_name,
+    std::optional<ModelDetails> details) {
+  const uint64_t max_parameter_count =
+      static_cast<uint64_t>(
+          std::max(features::kOllamaWarmPoolMaxParameterBillions.Get(), 0)) *
+      1'000'000'000;
+  // Models of unknown size aren't preloaded, as they may not fit the limit.
+  if (!delegate_ || !details || details->parameter_count == 0 ||
+      details->parameter_count > max_parameter_count) {
+    DVLOG(1) << "Not preloading Ollama model " << model_name;
+    warming_model_key_.reset();
+    return;
+  }
+
+  delegate_->PreloadModel(
+      model_name, features::kOllamaWarmPoolKeepAlive.Get(),
+      base::BindOnce(&OllamaModelFetcher::OnModelPreloaded,
+                     weak_ptr_factory_.GetWeakPtr(), model_key,
+                     base::TimeTicks::Now()));
+}
+
+void OllamaModelFetcher::OnModelPreloaded(const std::string& model_key,
+                                          base::TimeTicks preload_start,
+                                          bool success) {
+  warming_model_key_.reset();
+  base::UmaHistogramBoolean("Brave.AIChat.Ollama.PreloadSucceeded", success);
+  if (!success) {
+    return;
+  }
+
+  const base::TimeTicks now = base::TimeTicks::Now();
+  base::UmaHistogramMediumTimes("Brave.AIChat.Ollama.PreloadTime",
+                                now - preload_start);
+  model_service_->SetLocalModelWarmUntil(
+      model_key, now + features::kOllamaWarmPoolKeepAlive.Get());
+}
+
 void OllamaModelFetcher::OnOllamaFetchEnabledChanged() {
   bool ollama_fetch_enabled =
       prefs_->GetBoolean(prefs::kBraveAIChatOllamaFetchEnabled);
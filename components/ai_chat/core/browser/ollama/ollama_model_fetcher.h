@@ -17,6 +17,7 @@
 #include "base/memory/raw_ptr.h"
 #include "base/memory/raw_ref.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "components/prefs/pref_change_registrar.h"
 
 namespace ai_chat {
@@ -31,6 +32,8 @@ class OllamaModelFetcher {
   struct ModelDetails {
     uint32_t context_length = 0;
     bool has_vision = false;
+    // Zero when Ollama doesn't report it.
+    uint64_t parameter_count = 0;
   };
 
   // Delegate interface for Ollama API operations.
@@ -41,6 +44,7 @@ class OllamaModelFetcher {
         base::OnceCallback<void(std::optional<std::vector<std::string>>)>;
     using ModelDetailsCallback =
         base::OnceCallback<void(std::optional<ModelDetails>)>;
+    using PreloadModelCallback = base::OnceCallback<void(bool success)>;
 
     virtual ~Delegate() = default;
 
@@ -50,6 +54,12 @@ class OllamaModelFetcher {
     // Fetch detailed information for a specific model.
     virtual void ShowModel(const std::string& model_name,
                            ModelDetailsCallback callback) = 0;
+
+    // Ask Ollama to load a model into memory and keep it loaded for
+    // |keep_alive|.
+    virtual void PreloadModel(const std::string& model_name,
+                              base::TimeDelta keep_alive,
+                              PreloadModelCallback callback) = 0;
   };
 
   OllamaModelFetcher(ModelService& model_service,
@@ -64,6 +74,11 @@ class OllamaModelFetcher {
   // before the fetcher is used if constructed with a nullptr delegate.
   void SetDelegate(Delegate* delegate);
 
+  // Preloads the default model if it is served by Ollama, so that the first
+  // request to it doesn't have to wait for it to load. Does nothing unless
+  // |features::kOllamaWarmPool| and Ollama fetching are enabled.
+  void WarmDefaultModel();
+
  private:
   friend class OllamaModelFetcherTest;
   FRIEND_TEST_ALL_PREFIXES(OllamaModelFetcherTest, FetchModelsAddsNewModels);
@@ -73,6 +88,7 @@ class OllamaModelFetcher {
                            FetchModelsHandlesEmptyResponse);
   FRIEND_TEST_ALL_PREFIXES(OllamaModelFetcherTest,
                            FetchModelsHandlesInvalidJSON);
+  FRIEND_TEST_ALL_PREFIXES(OllamaModelFetcherTest, WarmDefaultModel);
 
   void OnOllamaFetchEnabledChanged();
   void FetchModels();
@@ -85,6 +101,12 @@ class OllamaModelFetcher {
   void FetchModelDetails(const std::string& model_name);
   void OnModelDetailsFetched(const std::string& model_name,
                              std::optional<ModelDetails> details);
+  void OnWarmModelDetailsFetched(const std::string& model_key,
+                                 const std::string& model_name,
+                                 std::optional<ModelDetails> details);
+  void OnModelPreloaded(const std::string& model_key,
+                        base::TimeTicks preload_start,
+                        bool success);
 
   // TODO(https://github.com/brave/brave-browser/issues/49828): display_name is
   // currently identical to model_name but will be used for proper name
@@ -95,6 +117,8 @@ class OllamaModelFetcher {
   raw_ptr<Delegate> delegate_ = nullptr;
   PrefChangeRegistrar pref_change_registrar_;
   std::map<std::string, PendingModelInfo> pending_models_;
+  // Key of the model being preloaded by |WarmDefaultModel|, if any.
+  std::optional<std::string> warming_model_key_;
   base::WeakPtrFactory<OllamaModelFetcher> weak_ptr_factory_{this};
 };
 
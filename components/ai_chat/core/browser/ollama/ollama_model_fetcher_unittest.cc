@@ -13,8 +13,12 @@
 #include "base/test/bind.h"
 #include "base/test/gmock_callback_support.h"
 #include "base/test/run_until.h"
+#include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
+#include "base/time/time.h"
 #include "brave/components/ai_chat/core/browser/model_service.h"
+#include "brave/components/ai_chat/core/common/features.h"
+#include "brave/components/ai_chat/core/common/mojom/ai_chat.mojom.h"
 #include "brave/components/ai_chat/core/common/mojom/ollama.mojom.h"
 #include "brave/components/ai_chat/core/common/pref_names.h"
 #include "components/os_crypt/sync/os_crypt_mocker.h"
@@ -39,6 +43,10 @@ class MockDelegate : public OllamaModelFetcher::Delegate {
               ShowModel,
               (const std::string&, ModelDetailsCallback),
               (override));
+  MOCK_METHOD(void,
+              PreloadModel,
+              (const std::string&, base::TimeDelta, PreloadModelCallback),
+              (override));
 };
 
 }  // namespace
@@ -280,4 +288,47 @@ TEST_F(OllamaModelFetcherTest, PrefChangeDoesntTriggersRemove) {
   }));
 }
 
+TEST_F(OllamaModelFetcherTest, WarmDefaultModel) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeatureWithParameters(
+      features::kOllamaWarmPool,
+      {{"keep_alive", "10m"}, {"max_parameter_billions", "8"}});
+  pref_service()->SetBoolean(prefs::kBraveAIChatOllamaFetchEnabled, true);
+
+  auto custom_options = mojom::CustomModelOptions::New();
+  custom_options->model_request_name = "llama3:8b";
+  custom_options->endpoint = GURL(mojom::kOllamaEndpoint);
+  custom_options->context_size = 4096;
+  auto model = mojom::Model::New();
+  model->display_name = "llama3:8b";
+  model->options =
+      mojom::ModelOptions::NewCustomModelOptions(std::move(custom_options));
+  model_service()->AddCustomModel(std::move(model));
+  const std::string model_key = model_service()->GetCustomModels().back()->key;
+  model_service()->SetDefaultModelKey(model_key);
+
+  // Models which are larger than the limit aren't preloaded.
+  OllamaModelFetcher::ModelDetails details;
+  details.parameter_count = 70'000'000'000;
+  EXPECT_CALL(*mock_delegate(), ShowModel("llama3:8b", _))
+      .WillOnce(base::test::RunOnceCallback<1>(details));
+  EXPECT_CALL(*mock_delegate(), PreloadModel).Times(0);
+  ollama_model_fetcher()->WarmDefaultModel();
+  testing::Mock::VerifyAndClearExpectations(mock_delegate());
+  EXPECT_FALSE(model_service()->IsLocalModelWarm(model_key));
+
+  details.parameter_count = 8'000'000'000;
+  EXPECT_CALL(*mock_delegate(), ShowModel("llama3:8b", _))
+      .WillOnce(base::test::RunOnceCallback<1>(details));
+  EXPECT_CALL(*mock_delegate(), PreloadModel("llama3:8b", base::Minutes(10), _))
+      .WillOnce(base::test::RunOnceCallback<2>(true));
+  ollama_model_fetcher()->WarmDefaultModel();
+  testing::Mock::VerifyAndClearExpectations(mock_delegate());
+  EXPECT_TRUE(model_service()->IsLocalModelWarm(model_key));
+
+  // A model which is already warm isn't preloaded again.
+  EXPECT_CALL(*mock_delegate(), ShowModel).Times(0);
+  ollama_model_fetcher()->WarmDefaultModel();
+}
+
 }  // namespace ai_chat
@@ -11,7 +11,11 @@
 
 #include "base/functional/bind.h"
 #include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
+#include "base/values.h"
 #include "brave/components/ai_chat/core/browser/ollama/ollama_model_fetcher.h"
 #include "net/http/http_request_headers.h"
 #include "net/traffic_annotation/network_traffic_annotation.h"
@@ -79,10 +83,34 @@ constexpr net::NetworkTrafficAnnotationTag kOllamaModelDetailsAnnotation =
           setting: "This feature can be disabled in Leo Assistant settings."
         })");
 
+constexpr net::NetworkTrafficAnnotationTag kOllamaPreloadModelAnnotation =
+    net::DefineNetworkTrafficAnnotation(
+        "brave_leo_assistant_ollama_preload_model",
+        R"(
+        semantics {
+          sender: "Brave Leo Assistant"
+          description:
+            "Ask the local Ollama instance to preload the default model."
+          trigger:
+            "User opens Leo Assistant with an Ollama model as the default."
+          data:
+            "HTTP POST request to localhost:11434/api/generate with model."
+          destination: LOCAL
+        }
+        policy {
+          cookies_allowed: NO
+          setting: "This feature can be disabled in Leo Assistant settings."
+        })");
+
+// Ollama loads a model without generating anything when a generate request
+// has no prompt.
+constexpr char kOllamaGenerateAPIPath[] = "/api/generate";
+
 // Max download sizes for Ollama API responses
 constexpr size_t kConnectionCheckMaxSize = 1024;   // 1KB for connection check
 constexpr size_t kModelListMaxSize = 1024 * 1024;  // 1MB for model list
 constexpr size_t kModelDetailsMaxSize = 1024 * 1024;  // 1MB for model details
+constexpr size_t kPreloadModelMaxSize = 16 * 1024;    // 16KB for preload
 
 }  // namespace
 
@@ -98,6 +126,12 @@ OllamaService::OllamaService(
 
 OllamaService::~OllamaService() = default;
 
+void OllamaService::WarmDefaultModel() {
+  if (model_fetcher_) {
+    model_fetcher_->WarmDefaultModel();
+  }
+}
+
 void OllamaService::Shutdown() {
   model_fetcher_.reset();
 }
@@ -194,6 +228,41 @@ void OllamaService::OnModelDetailsComplete(
   std::move(callback).Run(ParseModelDetailsResponse(*response));
 }
 
+void OllamaService::PreloadModel(const std::string& model_name,
+                                 base::TimeDelta keep_alive,
+                                 PreloadModelCallback callback) {
+  auto request = std::make_unique<network::ResourceRequest>();
+  request->url = GURL(mojom::kOllamaBaseUrl).Resolve(kOllamaGenerateAPIPath);
+  request->method = "POST";
+
+  auto loader = network::SimpleURLLoader::Create(
+      std::move(request), kOllamaPreloadModelAnnotation);
+
+  base::Value::Dict body;
+  body.Set("model", model_name);
+  body.Set("keep_alive",
+           base::StrCat({base::NumberToString(keep_alive.InSeconds()), "s"}));
+  loader->AttachStringForUpload(*base::WriteJson(body), "application/json");
+
+  auto* loader_ptr = loader.get();
+  loader_ptr->DownloadToString(
+      url_loader_factory_.get(),
+      base::BindOnce(&OllamaService::OnPreloadModelComplete,
+                     weak_ptr_factory_.GetWeakPtr(), std::move(callback),
+                     std::move(loader)),
+      kPreloadModelMaxSize);
+}
+
+void OllamaService::OnPreloadModelComplete(
+    PreloadModelCallback callback,
+    std::unique_ptr<network::SimpleURLLoader> loader,
+    std::optional<std::string> response) {
+  bool success = response && loader->ResponseInfo() &&
+                 loader->ResponseInfo()->headers &&
+                 loader->ResponseInfo()->headers->response_code() == 200;
+  std::move(callback).Run(success);
+}
+
 std::optional<std::vector<std::string>> OllamaService::ParseModelsResponse(
     const std::string& response_body) {
   std::optional<base::Value::Dict> json_dict = base::JSONReader::ReadDict(
@@ -244,6 +313,14 @@ OllamaService::ParseModelDetailsResponse(const std::string& response_body) {
         break;
       }
     }
+
+    // Parameter counts are usually too large for an int, so may be parsed as
+    // a double.
+    std::optional<double> parameter_count =
+        model_info->FindDouble("general.parameter_count");
+    if (parameter_count && *parameter_count > 0) {
+      details.parameter_count = static_cast<uint64_t>(*parameter_count);
+    }
   }
 
   // Check capabilities for vision support
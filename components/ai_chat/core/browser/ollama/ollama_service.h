@@ -37,6 +37,8 @@ class OllamaService : public KeyedService,
   using ModelsCallback = OllamaModelFetcher::Delegate::ModelsCallback;
   using ModelDetailsCallback =
       OllamaModelFetcher::Delegate::ModelDetailsCallback;
+  using PreloadModelCallback =
+      OllamaModelFetcher::Delegate::PreloadModelCallback;
 
   OllamaService(
       scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
@@ -49,6 +51,10 @@ class OllamaService : public KeyedService,
   // Bind a receiver for the OllamaService interface
   void BindReceiver(mojo::PendingReceiver<mojom::OllamaService> receiver);
 
+  // Preloads the user's default model when it is served by Ollama. Called
+  // when the AI Chat UI is opened.
+  void WarmDefaultModel();
+
   // KeyedService implementation:
   void Shutdown() override;
 
@@ -59,6 +65,9 @@ class OllamaService : public KeyedService,
   void FetchModels(ModelsCallback callback) override;
   void ShowModel(const std::string& model_name,
                  ModelDetailsCallback callback) override;
+  void PreloadModel(const std::string& model_name,
+                    base::TimeDelta keep_alive,
+                    PreloadModelCallback callback) override;
 
  private:
   FRIEND_TEST_ALL_PREFIXES(OllamaServiceTest, ParseModelsResponse_Valid);
@@ -77,6 +86,8 @@ class OllamaService : public KeyedService,
                            ParseModelDetailsResponse_NoCapabilities);
   FRIEND_TEST_ALL_PREFIXES(OllamaServiceTest,
                            ParseModelDetailsResponse_EmptyResponse);
+  FRIEND_TEST_ALL_PREFIXES(OllamaServiceTest,
+                           ParseModelDetailsResponse_ParameterCount);
 
   void OnConnectionCheckComplete(
       IsConnectedCallback callback,
@@ -91,6 +102,10 @@ class OllamaService : public KeyedService,
                               std::unique_ptr<network::SimpleURLLoader> loader,
                               std::optional<std::string> response);
 
+  void OnPreloadModelComplete(PreloadModelCallback callback,
+                              std::unique_ptr<network::SimpleURLLoader> loader,
+                              std::optional<std::string> response);
+
   std::optional<std::vector<std::string>> ParseModelsResponse(
       const std::string& response_body);
   std::optional<ModelDetails> ParseModelDetailsResponse(
@@ -363,6 +363,20 @@ TEST_F(OllamaServiceTest, ParseModelDetailsResponse_Valid) {
   EXPECT_TRUE(result->has_vision);
 }
 
+TEST_F(OllamaServiceTest, ParseModelDetailsResponse_ParameterCount) {
+  constexpr char kResponse[] = R"({
+    "model_info": {
+      "general.parameter_count": 8030261248,
+      "llama.context_length": 8192
+    }
+  })";
+
+  auto result = ollama_client()->ParseModelDetailsResponse(kResponse);
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(8030261248u, result->parameter_count);
+  EXPECT_EQ(8192u, result->context_length);
+}
+
 TEST_F(OllamaServiceTest, ParseModelDetailsResponse_InvalidJSON) {
   auto result = ollama_client()->ParseModelDetailsResponse("{invalid}");
   EXPECT_FALSE(result.has_value());
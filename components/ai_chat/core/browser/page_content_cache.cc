@@ -0,0 +1,40 @@
+/* Copyright (c) 2025 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ai_chat/core/browser/page_content_cache.h"
+
+#include <utility>
+
+#include "base/check.h"
+#include "base/metrics/histogram_functions.h"
+
+namespace ai_chat {
+
+PageContentCache::PageContentCache() : entries_(kMaxEntries) {}
+
+PageContentCache::~PageContentCache() = default;
+
+const PageContentCache::Entry* PageContentCache::Get(const GURL& url) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  auto it = entries_.Get(url);
+  const bool hit = it != entries_.end();
+  base::UmaHistogramBoolean("Brave.AIChat.PageContentCacheHit", hit);
+  if (!hit) {
+    miss_count_++;
+    return nullptr;
+  }
+  hit_count_++;
+  return &it->second;
+}
+
+void PageContentCache::Put(const GURL& url,
+                           std::string_view invalidation_token,
+                           PageContent content) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  DCHECK(!invalidation_token.empty());
+  entries_.Put(url, Entry{std::string(invalidation_token), std::move(content)});
+}
+
+}  // namespace ai_chat
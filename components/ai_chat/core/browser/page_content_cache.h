@@ -0,0 +1,61 @@
+/* Copyright (c) 2025 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_AI_CHAT_CORE_BROWSER_PAGE_CONTENT_CACHE_H_
+#define BRAVE_COMPONENTS_AI_CHAT_CORE_BROWSER_PAGE_CONTENT_CACHE_H_
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+#include "base/containers/lru_cache.h"
+#include "base/sequence_checker.h"
+#include "base/supports_user_data.h"
+#include "base/thread_annotations.h"
+#include "brave/components/ai_chat/core/browser/associated_content_delegate.h"
+#include "url/gurl.h"
+
+namespace ai_chat {
+
+// Per-profile cache of extracted page content, shared by every
+// AssociatedContentDriver of the profile, so that pages which are opened in
+// several tabs or come back from the back/forward cache don't need their
+// expensive content (e.g. video transcripts) fetched again. Only content that
+// came with an invalidation token is kept: the token is handed back to the
+// extractor, which confirms that the cached content is still valid.
+class PageContentCache : public base::SupportsUserData::Data {
+ public:
+  struct Entry {
+    std::string invalidation_token;
+    PageContent content;
+  };
+
+  static constexpr size_t kMaxEntries = 16;
+
+  PageContentCache();
+  ~PageContentCache() override;
+  PageContentCache(const PageContentCache&) = delete;
+  PageContentCache& operator=(const PageContentCache&) = delete;
+
+  // Returns the entry for |url|, or nullptr. Counts as a hit or miss.
+  const Entry* Get(const GURL& url);
+  void Put(const GURL& url,
+           std::string_view invalidation_token,
+           PageContent content);
+
+  size_t hit_count() const { return hit_count_; }
+  size_t miss_count() const { return miss_count_; }
+
+ private:
+  base::LRUCache<GURL, Entry> entries_ GUARDED_BY_CONTEXT(sequence_checker_);
+  size_t hit_count_ = 0;
+  size_t miss_count_ = 0;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+};
+
+}  // namespace ai_chat
+
+#endif  // BRAVE_COMPONENTS_AI_CHAT_CORE_BROWSER_PAGE_CONTENT_CACHE_H_
@@ -0,0 +1,54 @@
+/* Copyright (c) 2025 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/ai_chat/core/browser/page_content_cache.h"
+
+#include <string>
+
+#include "base/strings/string_number_conversions.h"
+#include "brave/components/ai_chat/core/browser/associated_content_delegate.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace ai_chat {
+
+TEST(PageContentCacheUnitTest, GetAndPut) {
+  PageContentCache cache;
+  const GURL url("https://www.youtube.com/watch?v=abc");
+
+  EXPECT_FALSE(cache.Get(url));
+  EXPECT_EQ(cache.miss_count(), 1u);
+
+  cache.Put(url, "token", PageContent("transcript", true));
+  const auto* entry = cache.Get(url);
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(entry->invalidation_token, "token");
+  EXPECT_EQ(entry->content, PageContent("transcript", true));
+  EXPECT_EQ(cache.hit_count(), 1u);
+
+  // Newer content replaces the entry for the same URL
+  cache.Put(url, "token2", PageContent("transcript2", true));
+  entry = cache.Get(url);
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(entry->invalidation_token, "token2");
+  EXPECT_EQ(entry->content.content, "transcript2");
+}
+
+TEST(PageContentCacheUnitTest, EvictsLeastRecentlyUsed) {
+  PageContentCache cache;
+  const GURL first("https://example.com/0");
+  for (size_t i = 0; i < PageContentCache::kMaxEntries; ++i) {
+    cache.Put(GURL("https://example.com/" + base::NumberToString(i)), "token",
+              PageContent("content", false));
+  }
+  // Use the first entry so that the second one is the oldest
+  EXPECT_TRUE(cache.Get(first));
+  cache.Put(GURL("https://example.com/new"), "token",
+            PageContent("content", false));
+  EXPECT_TRUE(cache.Get(first));
+  EXPECT_FALSE(cache.Get(GURL("https://example.com/1")));
+}
+
+}  // namespace ai_chat
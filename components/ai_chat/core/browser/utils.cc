@@ -5,6 +5,9 @@
 
 #include "brave/components/ai_chat/core/browser/utils.h"
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -121,6 +124,71 @@ void OnGetTextFromImage(
 }
 #endif
 
+// Target size of the chunks |TruncateContentForQuery| selects from. Chunks
+// end at a line break or space where possible so that words stay whole.
+constexpr size_t kContentChunkSize = 512;
+
+// BM25 parameters, see https://en.wikipedia.org/wiki/Okapi_BM25.
+constexpr double kBM25TermFrequencySaturation = 1.2;
+constexpr double kBM25LengthNormalization = 0.75;
+
+bool IsTermChar(char c) {
+  // Non-ASCII bytes are treated as part of a term so that UTF-8 words are not
+  // split up.
+  return base::IsAsciiAlphaNumeric(c) || static_cast<unsigned char>(c) >= 0x80;
+}
+
+// Calls |callback| with each term of |text|, without copying.
+template <typename Callback>
+void ForEachTerm(std::string_view text, Callback callback) {
+  size_t start = 0;
+  while (start < text.size()) {
+    while (start < text.size() && !IsTermChar(text[start])) {
+      ++start;
+    }
+    size_t end = start;
+    while (end < text.size() && IsTermChar(text[end])) {
+      ++end;
+    }
+    if (end > start) {
+      callback(text.substr(start, end - start));
+    }
+    start = end;
+  }
+}
+
+// Splits |content| into consecutive, non-overlapping chunks of at most
+// |kContentChunkSize| bytes which together cover all of |content|.
+std::vector<std::string_view> SplitContentIntoChunks(std::string_view content) {
+  std::vector<std::string_view> chunks;
+  chunks.reserve(content.size() / kContentChunkSize + 1);
+  size_t start = 0;
+  while (start < content.size()) {
+    size_t end = std::min(start + kContentChunkSize, content.size());
+    if (end < content.size()) {
+      // Prefer ending the chunk after a line break, then after a space, as
+      // long as that doesn't make the chunk less than half the target size.
+      const size_t min_end = start + kContentChunkSize / 2;
+      std::string_view window = content.substr(min_end, end - min_end);
+      size_t split = window.rfind('\n');
+      if (split == std::string_view::npos) {
+        split = window.rfind(' ');
+      }
+      if (split != std::string_view::npos) {
+        end = min_end + split + 1;
+      } else {
+        // Don't split a multi-byte UTF-8 character.
+        while (end > min_end && (content[end] & 0xC0) == 0x80) {
+          --end;
+        }
+      }
+    }
+    chunks.push_back(content.substr(start, end - start));
+    start = end;
+  }
+  return chunks;
+}
+
 }  // namespace
 
 bool IsAIChatEnabled(PrefService* prefs) {
@@ -213,8 +281,8 @@ EngineConsumer::GenerationDataCallback BindParseRewriteReceivedData(
 }
 
 SkBitmap ScaleDownBitmap(const SkBitmap& bitmap) {
-  constexpr int kTargetWidth = 1024;
-  constexpr int kTargetHeight = 768;
+  constexpr int kTargetWidth = kMaxImageWidth;
+  constexpr int kTargetHeight = kMaxImageHeight;
 
   // Don't need to scale if dimensions are already smaller than target
   // dimensions
@@ -282,4 +350,100 @@ GURL GetEndpointUrl(bool premium, const std::string& path) {
   return url;
 }
 
+std::string TruncateContentForQuery(std::string_view content,
+                                    size_t max_length,
+                                    std::string_view query) {
+  if (content.size() <= max_length) {
+    return std::string(content);
+  }
+
+  std::vector<std::string_view> query_terms;
+  ForEachTerm(query, [&](std::string_view term) {
+    if (!std::ranges::any_of(query_terms, [&](std::string_view other) {
+          return base::EqualsCaseInsensitiveASCII(term, other);
+        })) {
+      query_terms.push_back(term);
+    }
+  });
+  if (query_terms.empty() || max_length == 0) {
+    return std::string(content.substr(0, max_length));
+  }
+
+  // Count how often each query term appears in each chunk, in a single pass
+  // over the content.
+  const std::vector<std::string_view> chunks = SplitContentIntoChunks(content);
+  std::vector<std::vector<size_t>> term_counts(
+      chunks.size(), std::vector<size_t>(query_terms.size(), 0));
+  std::vector<size_t> chunks_with_term(query_terms.size(), 0);
+  for (size_t chunk_index = 0; chunk_index < chunks.size(); ++chunk_index) {
+    auto& counts = term_counts[chunk_index];
+    ForEachTerm(chunks[chunk_index], [&](std::string_view term) {
+      for (size_t i = 0; i < query_terms.size(); ++i) {
+        if (base::EqualsCaseInsensitiveASCII(term, query_terms[i])) {
+          ++counts[i];
+        }
+      }
+    });
+    for (size_t i = 0; i < query_terms.size(); ++i) {
+      if (counts[i] > 0) {
+        ++chunks_with_term[i];
+      }
+    }
+  }
+
+  // None of the content is relevant to the query, so keep the start of it.
+  if (std::ranges::all_of(chunks_with_term,
+                          [](size_t count) { return count == 0; })) {
+    return std::string(content.substr(0, max_length));
+  }
+
+  const double chunk_count = chunks.size();
+  const double average_chunk_size = content.size() / chunk_count;
+  std::vector<double> scores(chunks.size(), 0);
+  for (size_t chunk_index = 0; chunk_index < chunks.size(); ++chunk_index) {
+    const double length_ratio = chunks[chunk_index].size() / average_chunk_size;
+    for (size_t i = 0; i < query_terms.size(); ++i) {
+      const double term_count = term_counts[chunk_index][i];
+      if (term_count == 0) {
+        continue;
+      }
+      const double idf =
+          std::log(1 + (chunk_count - chunks_with_term[i] + 0.5) /
+                           (chunks_with_term[i] + 0.5));
+      scores[chunk_index] +=
+          idf * term_count * (kBM25TermFrequencySaturation + 1) /
+          (term_count +
+           kBM25TermFrequencySaturation *
+               (1 - kBM25LengthNormalization +
+                kBM25LengthNormalization * length_ratio));
+    }
+  }
+
+  // Take the highest scoring chunks that fit, then fill any space left with
+  // the remaining chunks in document order.
+  std::vector<size_t> ranked(chunks.size());
+  std::iota(ranked.begin(), ranked.end(), 0);
+  std::ranges::stable_sort(ranked, [&](size_t a, size_t b) {
+    return scores[a] > scores[b];
+  });
+
+  std::vector<bool> selected(chunks.size(), false);
+  size_t remaining_length = max_length;
+  for (size_t chunk_index : ranked) {
+    if (chunks[chunk_index].size() <= remaining_length) {
+      selected[chunk_index] = true;
+      remaining_length -= chunks[chunk_index].size();
+    }
+  }
+
+  std::string result;
+  result.reserve(max_length - remaining_length);
+  for (size_t chunk_index = 0; chunk_index < chunks.size(); ++chunk_index) {
+    if (selected[chunk_index]) {
+      result.append(chunks[chunk_index]);
+    }
+  }
+  return result;
+}
+
 }  // namespace ai_chat
@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_AI_CHAT_CORE_BROWSER_UTILS_H_
 
 #include <string>
+#include <string_view>
 
 #include "base/functional/callback_forward.h"
 #include "brave/components/ai_chat/core/browser/conversation_handler.h"
@@ -44,12 +45,24 @@ const std::string& GetActionTypeQuestion(mojom::ActionType action_type);
 EngineConsumer::GenerationDataCallback BindParseRewriteReceivedData(
     ConversationHandler::GeneratedTextCallback callback);
 
+// Target dimensions of images sent to the models.
+inline constexpr int kMaxImageWidth = 1024;
+inline constexpr int kMaxImageHeight = 768;
+
 // Only scales down to target dimension when input bitmap is larger than
-// 1024x768
+// kMaxImageWidth x kMaxImageHeight
 SkBitmap ScaleDownBitmap(const SkBitmap& bitmap);
 
 GURL GetEndpointUrl(bool premium, const std::string& path);
 
+// Returns at most |max_length| bytes of |content|. When |content| doesn't fit,
+// the chunks of it most relevant to |query| (ranked with BM25) are kept in
+// their original order. With no relevant chunks, the start of |content| is
+// kept instead.
+std::string TruncateContentForQuery(std::string_view content,
+                                    size_t max_length,
+                                    std::string_view query);
+
 }  // namespace ai_chat
 
 #endif  // BRAVE_COMPONENTS_AI_CHAT_CORE_BROWSER_UTILS_H_
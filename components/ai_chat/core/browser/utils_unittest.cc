@@ -5,6 +5,7 @@
 
 #include "brave/components/ai_chat/core/browser/utils.h"
 
+#include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -68,4 +69,35 @@ TEST_F(AIChatUtilsUnitTest, ScaleDownBitmap) {
   }
 }
 
+TEST_F(AIChatUtilsUnitTest, TruncateContentForQuery) {
+  // Content which fits is returned as is.
+  EXPECT_EQ(TruncateContentForQuery("short content", 100, "query"),
+            "short content");
+
+  // Without a query, or without any relevant content, the start is kept.
+  const std::string filler(2000, 'a');
+  EXPECT_EQ(TruncateContentForQuery(filler, 100, ""), filler.substr(0, 100));
+  EXPECT_EQ(TruncateContentForQuery(filler, 100, "lighthouse"),
+            filler.substr(0, 100));
+
+  // Relevant chunks are kept over the start of the content, in their original
+  // order.
+  std::string content;
+  for (int i = 0; i < 20; ++i) {
+    content += std::string(400, 'x') + " filler text.\n";
+  }
+  const std::string relevant =
+      "The Lighthouse was built in 1850 on the island.\n";
+  content += relevant;
+  for (int i = 0; i < 20; ++i) {
+    content += std::string(400, 'y') + " more filler.\n";
+  }
+
+  std::string truncated =
+      TruncateContentForQuery(content, 600, "when was the lighthouse built?");
+  EXPECT_LE(truncated.size(), 600u);
+  EXPECT_NE(truncated.find(relevant), std::string::npos);
+  EXPECT_EQ(truncated.find(std::string(400, 'x')), std::string::npos);
+}
+
 }  // namespace ai_chat
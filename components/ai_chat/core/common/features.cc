@@ -9,6 +9,7 @@
 
 #include "base/feature_list.h"
 #include "base/metrics/field_trial_params.h"
+#include "base/time/time.h"
 #include "brave/components/ai_chat/core/common/buildflags/buildflags.h"
 #include "brave/components/ai_chat/core/common/constants.h"
 #include "build/build_config.h"
@@ -151,6 +152,94 @@ bool IsNEARModelsEnabled() {
   return base::FeatureList::IsEnabled(features::kNEARModels);
 }
 
+BASE_FEATURE(kOllamaWarmPool,
+             "AIChatOllamaWarmPool",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
+bool IsOllamaWarmPoolEnabled() {
+  return base::FeatureList::IsEnabled(features::kOllamaWarmPool);
+}
+
+const base::FeatureParam<base::TimeDelta> kOllamaWarmPoolKeepAlive{
+    &kOllamaWarmPool, "keep_alive", base::Minutes(10)};
+const base::FeatureParam<int> kOllamaWarmPoolMaxParameterBillions{
+    &kOllamaWarmPool, "max_parameter_billions", 14};
+
+BASE_FEATURE(kAIChatCredentialQueue, base::FEATURE_DISABLED_BY_DEFAULT);
+
+bool IsAIChatCredentialQueueEnabled() {
+  return base::FeatureList::IsEnabled(features::kAIChatCredentialQueue);
+}
+
+const base::FeatureParam<int> kAIChatCredentialQueueLowWatermark{
+    &kAIChatCredentialQueue, "low_watermark", 1};
+
+BASE_FEATURE(kAIChatMemoryRetrieval, base::FEATURE_DISABLED_BY_DEFAULT);
+
+bool IsAIChatMemoryRetrievalEnabled() {
+  return base::FeatureList::IsEnabled(features::kAIChatMemoryRetrieval);
+}
+
+const base::FeatureParam<int> kAIChatMemoryRetrievalMaxMemories{
+    &kAIChatMemoryRetrieval, "max_memories", 20};
+
+BASE_FEATURE(kAIChatModelListBatching, base::FEATURE_DISABLED_BY_DEFAULT);
+
+bool IsAIChatModelListBatchingEnabled() {
+  return base::FeatureList::IsEnabled(features::kAIChatModelListBatching);
+}
+
+BASE_FEATURE(kAIChatIdleConversationRelease,
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
+bool IsAIChatIdleConversationReleaseEnabled() {
+  return base::FeatureList::IsEnabled(
+      features::kAIChatIdleConversationRelease);
+}
+
+const base::FeatureParam<base::TimeDelta> kAIChatIdleConversationReleaseDelay{
+    &kAIChatIdleConversationRelease, "delay", base::Minutes(10)};
+
+BASE_FEATURE(kAIChatScreenshotEncoding, base::FEATURE_DISABLED_BY_DEFAULT);
+
+bool IsAIChatScreenshotEncodingEnabled() {
+  return base::FeatureList::IsEnabled(features::kAIChatScreenshotEncoding);
+}
+
+constexpr base::FeatureParam<ScreenshotEncodingFormat>::Option
+    kScreenshotEncodingFormatOptions[] = {
+        {ScreenshotEncodingFormat::kPng, "png"},
+        {ScreenshotEncodingFormat::kJpeg, "jpeg"},
+        {ScreenshotEncodingFormat::kWebp, "webp"},
+};
+
+const base::FeatureParam<ScreenshotEncodingFormat>
+    kAIChatScreenshotEncodingFormat{&kAIChatScreenshotEncoding, "format",
+                                    ScreenshotEncodingFormat::kJpeg,
+                                    &kScreenshotEncodingFormatOptions};
+const base::FeatureParam<int> kAIChatScreenshotEncodingQuality{
+    &kAIChatScreenshotEncoding, "quality", 80};
+
+BASE_FEATURE(kAIChatPdfExtractionCache, base::FEATURE_DISABLED_BY_DEFAULT);
+
+bool IsAIChatPdfExtractionCacheEnabled() {
+  return base::FeatureList::IsEnabled(features::kAIChatPdfExtractionCache);
+}
+
+const base::FeatureParam<int> kAIChatPdfExtractionCacheMaxDocumentMB{
+    &kAIChatPdfExtractionCache, "max_document_mb", 32};
+
+BASE_FEATURE(kAIChatSuggestedQuestionsPrefetch,
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
+bool IsAIChatSuggestedQuestionsPrefetchEnabled() {
+  return base::FeatureList::IsEnabled(
+      features::kAIChatSuggestedQuestionsPrefetch);
+}
+
+const base::FeatureParam<int> kAIChatSuggestedQuestionsPrefetchDailyBudget{
+    &kAIChatSuggestedQuestionsPrefetch, "daily_budget", 20};
+
 BASE_FEATURE(kRichSearchWidgets, base::FEATURE_ENABLED_BY_DEFAULT);
 
 const base::FeatureParam<std::string> kRichSearchWidgetsOrigin{
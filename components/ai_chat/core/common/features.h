@@ -11,6 +11,7 @@
 #include "base/component_export.h"
 #include "base/feature_list.h"
 #include "base/metrics/field_trial_params.h"
+#include "base/time/time.h"
 
 namespace ai_chat::features {
 
@@ -105,6 +106,89 @@ COMPONENT_EXPORT(AI_CHAT_COMMON)
 BASE_DECLARE_FEATURE(kNEARModels);
 COMPONENT_EXPORT(AI_CHAT_COMMON) bool IsNEARModelsEnabled();
 
+// Preloads the user's default Ollama model when the AI Chat UI is opened, so
+// that the first request doesn't have to wait for the model to load.
+COMPONENT_EXPORT(AI_CHAT_COMMON) BASE_DECLARE_FEATURE(kOllamaWarmPool);
+COMPONENT_EXPORT(AI_CHAT_COMMON) bool IsOllamaWarmPoolEnabled();
+// How long Ollama should keep a preloaded model in memory.
+COMPONENT_EXPORT(AI_CHAT_COMMON)
+extern const base::FeatureParam<base::TimeDelta> kOllamaWarmPoolKeepAlive;
+// Models with more parameters than this, in billions, are not preloaded as
+// they would hold on to more memory than the user may expect.
+COMPONENT_EXPORT(AI_CHAT_COMMON)
+extern const base::FeatureParam<int> kOllamaWarmPoolMaxParameterBillions;
+
+// Keeps premium credentials in an in-memory queue ordered by expiry, persists
+// changes to prefs lazily and fetches a replacement in the background when the
+// queue runs low.
+COMPONENT_EXPORT(AI_CHAT_COMMON) BASE_DECLARE_FEATURE(kAIChatCredentialQueue);
+COMPONENT_EXPORT(AI_CHAT_COMMON) bool IsAIChatCredentialQueueEnabled();
+// A background fetch starts when fewer credentials than this are queued.
+COMPONENT_EXPORT(AI_CHAT_COMMON)
+extern const base::FeatureParam<int> kAIChatCredentialQueueLowWatermark;
+
+// Sends only the user memories most relevant to the latest user turn instead
+// of all of them.
+COMPONENT_EXPORT(AI_CHAT_COMMON) BASE_DECLARE_FEATURE(kAIChatMemoryRetrieval);
+COMPONENT_EXPORT(AI_CHAT_COMMON) bool IsAIChatMemoryRetrievalEnabled();
+// Maximum number of memories sent with a request.
+COMPONENT_EXPORT(AI_CHAT_COMMON)
+extern const base::FeatureParam<int> kAIChatMemoryRetrievalMaxMemories;
+
+// Coalesces ModelService model list changes made in the same task into a
+// single OnModelListUpdated notification.
+COMPONENT_EXPORT(AI_CHAT_COMMON) BASE_DECLARE_FEATURE(kAIChatModelListBatching);
+COMPONENT_EXPORT(AI_CHAT_COMMON) bool IsAIChatModelListBatchingEnabled();
+
+// Releases rebuildable per-conversation resources, such as engine caches,
+// for conversations that stay loaded without any connected UI.
+COMPONENT_EXPORT(AI_CHAT_COMMON)
+BASE_DECLARE_FEATURE(kAIChatIdleConversationRelease);
+COMPONENT_EXPORT(AI_CHAT_COMMON) bool IsAIChatIdleConversationReleaseEnabled();
+// How long a conversation must be idle before its resources are released.
+COMPONENT_EXPORT(AI_CHAT_COMMON)
+extern const base::FeatureParam<base::TimeDelta>
+    kAIChatIdleConversationReleaseDelay;
+
+// Rasterizes full page screenshot tiles at the size sent to the model and
+// encodes them with a configurable, lossy capable encoder instead of PNG.
+COMPONENT_EXPORT(AI_CHAT_COMMON)
+BASE_DECLARE_FEATURE(kAIChatScreenshotEncoding);
+COMPONENT_EXPORT(AI_CHAT_COMMON) bool IsAIChatScreenshotEncodingEnabled();
+enum class ScreenshotEncodingFormat {
+  kPng,
+  kJpeg,
+  kWebp,
+};
+COMPONENT_EXPORT(AI_CHAT_COMMON)
+extern const base::FeatureParam<ScreenshotEncodingFormat>
+    kAIChatScreenshotEncodingFormat;
+// Quality, from 0 to 100, used by the lossy encoders.
+COMPONENT_EXPORT(AI_CHAT_COMMON)
+extern const base::FeatureParam<int> kAIChatScreenshotEncodingQuality;
+
+// Keys extracted PDF text by a hash of the document so it can be reused from
+// the shared page content cache, and starts extraction as soon as a PDF tab is
+// focused.
+COMPONENT_EXPORT(AI_CHAT_COMMON)
+BASE_DECLARE_FEATURE(kAIChatPdfExtractionCache);
+COMPONENT_EXPORT(AI_CHAT_COMMON) bool IsAIChatPdfExtractionCacheEnabled();
+// Documents larger than this, in megabytes, are not hashed and are extracted
+// on every request as before.
+COMPONENT_EXPORT(AI_CHAT_COMMON)
+extern const base::FeatureParam<int> kAIChatPdfExtractionCacheMaxDocumentMB;
+
+// Generates suggested questions in the background as soon as page content
+// has been extracted, so that they are ready when the panel is opened.
+COMPONENT_EXPORT(AI_CHAT_COMMON)
+BASE_DECLARE_FEATURE(kAIChatSuggestedQuestionsPrefetch);
+COMPONENT_EXPORT(AI_CHAT_COMMON)
+bool IsAIChatSuggestedQuestionsPrefetchEnabled();
+// Maximum number of background generations per day.
+COMPONENT_EXPORT(AI_CHAT_COMMON)
+extern const base::FeatureParam<int>
+    kAIChatSuggestedQuestionsPrefetchDailyBudget;
+
 // Whether we should show rich search widgets in the conversation.
 COMPONENT_EXPORT(AI_CHAT_COMMON) BASE_DECLARE_FEATURE(kRichSearchWidgets);
 
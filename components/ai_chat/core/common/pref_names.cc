@@ -40,6 +40,8 @@ void RegisterProfilePrefs(PrefRegistrySimple* registry) {
     registry->RegisterListPref(kBraveAIChatUserMemories);
     registry->RegisterDictionaryPref(kBraveAIChatSkills);
     registry->RegisterBooleanPref(kBraveAIChatOllamaFetchEnabled, false);
+    registry->RegisterDictionaryPref(
+        kBraveAIChatSuggestedQuestionsPrefetchUsage);
   }
   registry->RegisterBooleanPref(kEnabledByPolicy, true);
 }
@@ -119,6 +119,10 @@ inline constexpr char kBraveAIChatUserMemories[] =
 inline constexpr char kBraveAIChatSkills[] = "brave.ai_chat.smart_modes";
 inline constexpr char kBraveAIChatOllamaFetchEnabled[] =
     "brave.ai_chat.ollama_fetch_enabled";
+// Day and number of suggested questions generations made in the background
+// that day, see features::kAIChatSuggestedQuestionsPrefetch.
+inline constexpr char kBraveAIChatSuggestedQuestionsPrefetchUsage[] =
+    "brave.ai_chat.suggested_questions_prefetch_usage";
 
 COMPONENT_EXPORT(AI_CHAT_COMMON)
 void RegisterProfilePrefs(PrefRegistrySimple* registry);
@@ -5,13 +5,16 @@
 
 #include "brave/components/ai_chat/core/common/prefs.h"
 
+#include <algorithm>
 #include <utility>
 
+#include "base/containers/flat_set.h"
 #include "base/json/values_util.h"
 #include "base/strings/string_util.h"
 #include "base/time/time.h"
 #include "base/uuid.h"
 #include "base/values.h"
+#include "brave/components/ai_chat/core/common/features.h"
 #include "brave/components/ai_chat/core/common/mojom/ai_chat.mojom.h"
 #include "brave/components/ai_chat/core/common/mojom/common.mojom.h"
 #include "brave/components/ai_chat/core/common/mojom/customization_settings.mojom.h"
@@ -23,6 +26,32 @@ namespace ai_chat::prefs {
 
 namespace {
 
+// Shorter words are mostly articles and prepositions, which say little about
+// relevance.
+constexpr size_t kMinKeywordLength = 3;
+
+// Splits |text| into lowercase words. Non-ASCII bytes are kept as part of
+// words so that non-English text still yields keywords.
+base::flat_set<std::string> GetKeywords(std::string_view text) {
+  std::vector<std::string> keywords;
+  std::string word;
+  auto add_word = [&]() {
+    if (word.size() >= kMinKeywordLength) {
+      keywords.push_back(std::move(word));
+    }
+    word.clear();
+  };
+  for (char c : text) {
+    if (base::IsAsciiAlphaNumeric(c) || !base::IsAscii(c)) {
+      word.push_back(base::ToLowerASCII(c));
+    } else {
+      add_word();
+    }
+  }
+  add_word();
+  return base::flat_set<std::string>(std::move(keywords));
+}
+
 // Helper function to convert a dictionary to Skill
 mojom::SkillPtr SkillDictToStruct(const std::string& id,
                                   const base::Value::Dict& skill_dict) {
@@ -190,8 +219,52 @@ void DeleteAllMemoriesFromPrefs(PrefService& prefs) {
   prefs.ClearPref(prefs::kBraveAIChatUserMemories);
 }
 
+base::Value::List SelectRelevantMemories(const base::Value::List& memories,
+                                         std::string_view query,
+                                         size_t max_count) {
+  if (memories.size() <= max_count) {
+    return memories.Clone();
+  }
+
+  const auto query_keywords = GetKeywords(query);
+  struct Candidate {
+    size_t score;
+    size_t index;
+  };
+  std::vector<Candidate> candidates;
+  candidates.reserve(memories.size());
+  for (size_t i = 0; i < memories.size(); ++i) {
+    if (!memories[i].is_string()) {
+      continue;
+    }
+    size_t score = 0;
+    for (const auto& keyword : GetKeywords(memories[i].GetString())) {
+      score += query_keywords.contains(keyword);
+    }
+    candidates.push_back({score, i});
+  }
+
+  // Most relevant first, newer memories winning ties.
+  const size_t count = std::min(max_count, candidates.size());
+  std::partial_sort(candidates.begin(), candidates.begin() + count,
+                    candidates.end(), [](const auto& a, const auto& b) {
+                      return a.score != b.score ? a.score > b.score
+                                                : a.index > b.index;
+                    });
+  candidates.resize(count);
+  std::sort(candidates.begin(), candidates.end(),
+            [](const auto& a, const auto& b) { return a.index < b.index; });
+
+  base::Value::List selected;
+  for (const auto& candidate : candidates) {
+    selected.Append(memories[candidate.index].Clone());
+  }
+  return selected;
+}
+
 std::optional<base::Value::Dict> GetUserMemoryDictFromPrefs(
-    PrefService& prefs) {
+    PrefService& prefs,
+    std::string_view query) {
   bool customization_enabled =
       prefs.GetBoolean(prefs::kBraveAIChatUserCustomizationEnabled);
   bool memory_enabled = prefs.GetBoolean(prefs::kBraveAIChatUserMemoryEnabled);
@@ -231,7 +304,14 @@ std::optional<base::Value::Dict> GetUserMemoryDictFromPrefs(
     const base::Value::List& memories =
         prefs.GetList(prefs::kBraveAIChatUserMemories);
     if (!memories.empty()) {
-      user_memory.Set("memories", memories.Clone());
+      user_memory.Set(
+          "memories",
+          features::IsAIChatMemoryRetrievalEnabled()
+              ? SelectRelevantMemories(
+                    memories, query,
+                    std::max(features::kAIChatMemoryRetrievalMaxMemories.Get(),
+                             1))
+              : memories.Clone());
     }
   }
 
@@ -8,6 +8,7 @@
 
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "base/component_export.h"
@@ -57,8 +58,20 @@ bool HasMemoryFromPrefs(const std::string& memory, const PrefService& prefs);
 COMPONENT_EXPORT(AI_CHAT_COMMON)
 void DeleteAllMemoriesFromPrefs(PrefService& prefs);
 
-COMPONENT_EXPORT(AI_CHAT_COMMON)
-std::optional<base::Value::Dict> GetUserMemoryDictFromPrefs(PrefService& prefs);
+// Returns the customizations and memories to send with a request. When
+// kAIChatMemoryRetrieval is enabled, only the memories most relevant to
+// |query| (usually the latest user turn) are included.
+COMPONENT_EXPORT(AI_CHAT_COMMON)
+std::optional<base::Value::Dict> GetUserMemoryDictFromPrefs(
+    PrefService& prefs,
+    std::string_view query = {});
+// Returns at most |max_count| of |memories|, preferring those sharing the most
+// keywords with |query| and, on ties, the most recently added. The original
+// order is kept.
+COMPONENT_EXPORT(AI_CHAT_COMMON)
+base::Value::List SelectRelevantMemories(const base::Value::List& memories,
+                                         std::string_view query,
+                                         size_t max_count);
 
 // Skills prefs
 // Returns skills from the skills dictionary in the pref.
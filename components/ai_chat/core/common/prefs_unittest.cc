@@ -10,8 +10,10 @@
 #include <vector>
 
 #include "base/json/values_util.h"
+#include "base/test/scoped_feature_list.h"
 #include "base/time/time.h"
 #include "base/values.h"
+#include "brave/components/ai_chat/core/common/features.h"
 #include "brave/components/ai_chat/core/common/mojom/ai_chat.mojom.h"
 #include "brave/components/ai_chat/core/common/mojom/common.mojom.h"
 #include "brave/components/ai_chat/core/common/mojom/customization_settings.mojom.h"
@@ -284,6 +286,52 @@ TEST_F(AIChatPrefsTest, GetUserMemoryDictFromPrefs_MemoryOnly) {
   EXPECT_EQ((*memories)[1].GetString(), "I prefer dark mode");
 }
 
+TEST_F(AIChatPrefsTest, GetUserMemoryDictFromPrefs_MemoryRetrieval) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeatureWithParameters(
+      features::kAIChatMemoryRetrieval, {{"max_memories", "2"}});
+  pref_service_.SetBoolean(kBraveAIChatUserMemoryEnabled, true);
+
+  AddMemoryToPrefs("I work as a software engineer", pref_service_);
+  AddMemoryToPrefs("I prefer dark mode", pref_service_);
+  AddMemoryToPrefs("My cat is called Tom", pref_service_);
+  AddMemoryToPrefs("I live in Berlin", pref_service_);
+
+  auto result =
+      GetUserMemoryDictFromPrefs(pref_service_, "What should I feed my CAT?");
+  ASSERT_TRUE(result.has_value());
+  const base::Value::List* memories = result->FindList("memories");
+  ASSERT_TRUE(memories);
+  // The matching memory plus the newest one, in their original order.
+  ASSERT_EQ(memories->size(), 2u);
+  EXPECT_EQ((*memories)[0].GetString(), "My cat is called Tom");
+  EXPECT_EQ((*memories)[1].GetString(), "I live in Berlin");
+}
+
+TEST_F(AIChatPrefsTest, SelectRelevantMemories) {
+  base::Value::List memories;
+  memories.Append("Python developer working on machine learning");
+  memories.Append("Likes cats");
+  memories.Append("Learning React, prefers TypeScript examples");
+
+  // Everything fits, so nothing is dropped.
+  EXPECT_EQ(SelectRelevantMemories(memories, "", 3), memories);
+
+  auto selected = SelectRelevantMemories(
+      memories, "Show me a typescript example with react hooks", 1);
+  ASSERT_EQ(selected.size(), 1u);
+  EXPECT_EQ(selected[0].GetString(),
+            "Learning React, prefers TypeScript examples");
+
+  selected =
+      SelectRelevantMemories(memories, "Which machine learning library?", 2);
+  ASSERT_EQ(selected.size(), 2u);
+  EXPECT_EQ(selected[0].GetString(),
+            "Python developer working on machine learning");
+  EXPECT_EQ(selected[1].GetString(),
+            "Learning React, prefers TypeScript examples");
+}
+
 TEST_F(AIChatPrefsTest, GetUserMemoryDictFromPrefs_BothEnabled) {
   // Both customization and memory are enabled
   pref_service_.SetBoolean(kBraveAIChatUserCustomizationEnabled, true);
@@ -39,6 +39,8 @@ namespace api_request_helper {
 namespace {
 
 const unsigned int kRetriesCountOnNetworkChange = 1;
+// Upper bound for a single SSE line that is still waiting for its terminator.
+constexpr size_t kMaxPendingSSEDataSize = 4 * 1024 * 1024;
 
 void ParseJsonInWorkerTaskRunner(
     std::string json,
@@ -233,6 +235,7 @@ APIRequestHelper::Ticket APIRequestHelper::RequestSSE(
 
   // Set streaming data callback
   handler->data_received_callback_ = std::move(data_received_callback);
+  handler->parse_sse_in_process_ = request_options.parse_sse_in_process;
 
   handler->response_started_callback_ = std::move(response_started_callback);
 
@@ -378,6 +381,17 @@ void APIRequestHelper::URLLoaderHandler::send_sse_data_for_testing(
   is_sse_ = is_sse;
   data_received_callback_ = std::move(callback);
   OnDataReceived(string_piece, base::BindOnce([]() {}));
+  if (is_sse_) {
+    FlushPendingSSEData();
+  }
+}
+
+void APIRequestHelper::URLLoaderHandler::send_sse_chunk_for_testing(
+    std::string_view string_piece,
+    DataReceivedCallback callback) {
+  is_sse_ = true;
+  data_received_callback_ = std::move(callback);
+  ParseSSE(string_piece);
 }
 
 void APIRequestHelper::URLLoaderHandler::ParseJsonImpl(
@@ -413,6 +427,14 @@ void APIRequestHelper::URLLoaderHandler::OnComplete(bool success) {
   VLOG(1) << "[[" << __func__ << "]]"
           << " Response completed\n";
 
+  if (is_sse_) {
+    auto weak_this = weak_ptr_factory_.GetWeakPtr();
+    FlushPendingSSEData();
+    if (!weak_this) {
+      return;
+    }
+  }
+
   request_is_finished_ = true;
 
   // Delete now or when decoding operations are complete
@@ -447,13 +469,19 @@ void APIRequestHelper::URLLoaderHandler::OnResponse(
   }
   auto& raw_body = *response_body;
   if (conversion_callback) {
-    auto converted_body = std::move(conversion_callback).Run(raw_body);
-    if (!converted_body) {
-      result.response_code_ = 422;
-      std::move(result_callback_).Run(std::move(result));
-      return;
-    }
-    raw_body = converted_body.value();
+    // Conversions re-serialize the whole response, which can be large, so run
+    // them on the decoder sequence rather than on the UI thread.
+    task_runner_->PostTaskAndReplyWithResult(
+        FROM_HERE,
+        base::BindOnce(
+            [](ResponseConversionCallback conversion_callback,
+               std::string raw_body) {
+              return std::move(conversion_callback).Run(raw_body);
+            },
+            std::move(conversion_callback), std::move(raw_body)),
+        base::BindOnce(&APIRequestHelper::URLLoaderHandler::OnResponseConverted,
+                       GetWeakPtr(), std::move(result)));
+    return;
   }
 
   ParseJsonImpl(
@@ -462,6 +490,21 @@ void APIRequestHelper::URLLoaderHandler::OnResponse(
                      GetWeakPtr(), std::move(result)));
 }
 
+void APIRequestHelper::URLLoaderHandler::OnResponseConverted(
+    APIRequestResult result,
+    std::optional<std::string> converted_body) {
+  if (!converted_body) {
+    result.response_code_ = 422;
+    std::move(result_callback_).Run(std::move(result));
+    return;
+  }
+
+  ParseJsonImpl(
+      std::move(*converted_body),
+      base::BindOnce(&APIRequestHelper::URLLoaderHandler::OnParseJsonResponse,
+                     GetWeakPtr(), std::move(result)));
+}
+
 void APIRequestHelper::URLLoaderHandler::OnParseJsonResponse(
     APIRequestResult result,
     ValueOrError result_value) {
@@ -518,56 +561,120 @@ void APIRequestHelper::URLLoaderHandler::ParseSSE(
     std::string_view string_piece) {
   // New chunks should only be received before the request is completed
   DCHECK(!request_is_finished_);
-  // We split the string into multiple chunks because there are cases where
-  // multiple chunks are received in a single call.
-  std::vector<std::string_view> stream_data = base::SplitStringPiece(
-      string_piece, "\r\n", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
+  // An event can be split at any byte across chunks, so only complete lines
+  // are dispatched and the unterminated remainder waits for the next chunk.
+  std::string_view data = string_piece;
+  const bool is_buffered = !pending_sse_data_.empty();
+  if (is_buffered) {
+    pending_sse_data_.append(string_piece);
+    data = pending_sse_data_;
+  }
+
+  const size_t lines_end = data.rfind('\n');
+  if (lines_end == std::string_view::npos) {
+    if (data.size() > kMaxPendingSSEDataSize) {
+      VLOG(1) << "Dropping oversized unterminated SSE line";
+      pending_sse_data_.clear();
+    } else if (!is_buffered) {
+      pending_sse_data_.assign(data);
+    }
+    return;
+  }
+
+  if (!DispatchSSELines(data.substr(0, lines_end))) {
+    return;
+  }
+  if (is_buffered) {
+    pending_sse_data_.erase(0, lines_end + 1);
+  } else {
+    pending_sse_data_.assign(data.substr(lines_end + 1));
+  }
+}
 
+void APIRequestHelper::URLLoaderHandler::FlushPendingSSEData() {
+  if (pending_sse_data_.empty()) {
+    return;
+  }
+  std::string data = std::move(pending_sse_data_);
+  pending_sse_data_.clear();
+  DispatchSSELines(data);
+}
+
+bool APIRequestHelper::URLLoaderHandler::DispatchSSELines(
+    std::string_view lines) {
   // Remove SSE events that don't look like JSON - could be string or [DONE]
   // message.
   // TODO(@nullhook): Parse both JSON and string values. The below currently
   // only identifies JSON values.
-  static constexpr char kDataPrefix[] = "data: {";
-  std::erase_if(stream_data, [](std::string_view item) {
-    DVLOG(3) << "Received chunk: " << item;
-    if (!item.starts_with(kDataPrefix)) {
+  static constexpr std::string_view kDataPrefix = "data: {";
+  auto weak_this = weak_ptr_factory_.GetWeakPtr();
+  for (std::string_view line : base::SplitStringPiece(
+           lines, "\n", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    if (line.ends_with('\r')) {
+      line.remove_suffix(1);
+    }
+    if (line.empty()) {
+      continue;
+    }
+    DVLOG(3) << "Received chunk: " << line;
+    if (!line.starts_with(kDataPrefix)) {
       // This is useful to log in case an API starts
       // coming back with unknown data type in some
       // scenarios.
       VLOG(1) << "Data did not start with SSE prefix";
-      return true;
+      continue;
     }
-    return false;
-  });
+    DispatchSSEJson(line.substr(kDataPrefix.size() - 1));
+    // The data callback may have cancelled the request.
+    if (!weak_this) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void APIRequestHelper::URLLoaderHandler::DispatchSSEJson(
+    std::string_view json) {
+  if (parse_sse_in_process_) {
+    TRACE_EVENT0("brave", "APIRequestHelper_ParseSSEInProcess");
+    ScopedPerfTracker tracker("Brave.APIRequestHelper.ParseSSEInProcess");
+    auto result =
+        base::JSONReader::ReadAndReturnValueWithError(json,
+                                                      base::JSON_PARSE_RFC);
+    DCHECK(data_received_callback_);
+    if (!result.has_value()) {
+      data_received_callback_.Run(base::unexpected(result.error().message));
+    } else {
+      data_received_callback_.Run(std::move(*result));
+    }
+    return;
+  }
 
   // Keep track of number of in-progress data decoding operations
   // so that we can know if any are still in-progress when the request
   // completes.
-  current_decoding_operation_count_ += stream_data.size();
-
-  for (const auto& data : stream_data) {
-    auto json = data.substr(strlen(kDataPrefix) - 1);
-    auto on_json_parsed =
-        [](base::WeakPtr<APIRequestHelper::URLLoaderHandler> handler,
-           ValueOrError result) {
-          DVLOG(2) << "Chunk parsed";
-          if (!handler) {
-            return;
-          }
-          TRACE_EVENT0("brave", "APIRequestHelper_ParseSSECallback");
-          ScopedPerfTracker tracker("Brave.APIRequestHelper.ParseSSECallback");
-          handler->current_decoding_operation_count_--;
-          DCHECK(handler->data_received_callback_);
-          handler->data_received_callback_.Run(std::move(result));
-          // Parsing is potentially the last operation for |URLLoaderHandler|.
-          handler->MaybeSendResult();
-        };
-
-    DVLOG(2) << "Going to call ParseJsonImpl";
-    ParseJsonImpl(std::string(json),
-                  base::BindOnce(std::move(on_json_parsed),
-                                 weak_ptr_factory_.GetWeakPtr()));
-  }
+  current_decoding_operation_count_++;
+
+  auto on_json_parsed =
+      [](base::WeakPtr<APIRequestHelper::URLLoaderHandler> handler,
+         ValueOrError result) {
+        DVLOG(2) << "Chunk parsed";
+        if (!handler) {
+          return;
+        }
+        TRACE_EVENT0("brave", "APIRequestHelper_ParseSSECallback");
+        ScopedPerfTracker tracker("Brave.APIRequestHelper.ParseSSECallback");
+        handler->current_decoding_operation_count_--;
+        DCHECK(handler->data_received_callback_);
+        handler->data_received_callback_.Run(std::move(result));
+        // Parsing is potentially the last operation for |URLLoaderHandler|.
+        handler->MaybeSendResult();
+      };
+
+  DVLOG(2) << "Going to call ParseJsonImpl";
+  ParseJsonImpl(std::string(json),
+                base::BindOnce(std::move(on_json_parsed),
+                               weak_ptr_factory_.GetWeakPtr()));
 }
 
 void APIRequestHelper::SetUrlLoaderFactoryForTesting(
@@ -89,6 +89,10 @@ struct APIRequestOptions {
   bool enable_cache = false;
   size_t max_body_size = -1u;
   std::optional<base::TimeDelta> timeout;
+  // Parse SSE JSON events synchronously on the calling sequence instead of
+  // posting each one to the decoder task runner. Only meant for trusted
+  // endpoints streaming small events.
+  bool parse_sse_in_process = false;
 };
 
 using ValueOrError = base::expected<base::Value, std::string>;
@@ -121,9 +125,17 @@ class APIRequestHelper {
     void SetResultCallback(ResultCallback result_callback);
     base::WeakPtr<URLLoaderHandler> GetWeakPtr();
 
+    // |string_piece| is treated as the end of the stream, so a trailing
+    // event without a line terminator is dispatched as well.
     void send_sse_data_for_testing(std::string_view string_piece,
                                    bool is_sse,
                                    DataReceivedCallback callback);
+    // Feeds one SSE chunk without ending the stream.
+    void send_sse_chunk_for_testing(std::string_view string_piece,
+                                    DataReceivedCallback callback);
+    void set_parse_sse_in_process_for_testing(bool parse_sse_in_process) {
+      parse_sse_in_process_ = parse_sse_in_process;
+    }
 
    private:
     friend class APIRequestHelper;
@@ -136,6 +148,12 @@ class APIRequestHelper {
     // then call |APIRequestHelper::Cancel|.
     void MaybeSendResult();
     void ParseSSE(std::string_view string_piece);
+    // Dispatches any buffered partial SSE line once the stream has ended.
+    void FlushPendingSSEData();
+    // Dispatches every complete line in |lines|. Returns false if |this| was
+    // destroyed by one of the callbacks.
+    bool DispatchSSELines(std::string_view lines);
+    void DispatchSSEJson(std::string_view json);
 
     // network::SimpleURLLoaderStreamConsumer implementation:
     void OnDataReceived(std::string_view string_piece,
@@ -147,6 +165,10 @@ class APIRequestHelper {
     void OnResponse(ResponseConversionCallback conversion_callback,
                     const std::unique_ptr<std::string> response_body);
 
+    // Continues OnResponse() once |conversion_callback| has run.
+    void OnResponseConverted(APIRequestResult result,
+                             std::optional<std::string> converted_body);
+
     // Decode one shot responses
     void OnParseJsonResponse(APIRequestResult result,
                              ValueOrError result_value);
@@ -160,6 +182,11 @@ class APIRequestHelper {
     ResponseConversionCallback conversion_callback_;
 
     bool is_sse_ = false;
+    bool parse_sse_in_process_ = false;
+
+    // Holds a trailing SSE line that has not been terminated yet because the
+    // event was split across chunks.
+    std::string pending_sse_data_;
 
     // Keep track of number of in-progress data decoding operations
     // so that we can know if any are still in-progress when the request
@@ -7,8 +7,10 @@
 
 #include <memory>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "base/functional/callback.h"
 #include "base/test/bind.h"
@@ -110,6 +112,19 @@ class ApiRequestHelperUnitTest : public testing::Test {
                                                        std::move(callback));
   }
 
+  void SendMessageSSEChunks(const std::vector<std::string_view>& chunks,
+                           bool parse_in_process,
+                           APIRequestHelper::DataReceivedCallback callback) {
+    DCHECK(!chunks.empty());
+    loader_wrapper_handler_->set_parse_sse_in_process_for_testing(
+        parse_in_process);
+    for (size_t i = 0; i + 1 < chunks.size(); ++i) {
+      loader_wrapper_handler_->send_sse_chunk_for_testing(chunks[i], callback);
+    }
+    loader_wrapper_handler_->send_sse_data_for_testing(chunks.back(), true,
+                                                       std::move(callback));
+  }
+
   void SendMessageSSE(std::string_view string_piece,
                       APIRequestHelper::DataReceivedCallback callback) {
     loader_wrapper_handler_->send_sse_data_for_testing(string_piece, false,
@@ -252,4 +267,38 @@ TEST_F(ApiRequestHelperUnitTest, SSEJsonParsing) {
   task_environment_.RunUntilIdle();
 }
 
+TEST_F(ApiRequestHelperUnitTest, SSEJsonParsingAcrossChunks) {
+  for (bool parse_in_process : {false, true}) {
+    SCOPED_TRACE(parse_in_process);
+    std::vector<std::string> completions;
+    SendMessageSSEChunks(
+        {"data: {\"completion\": \" Hel", "lo\"}\r\n\r\ndata: ",
+         "{\"completion\": \" there\"}\r", "\n\r\ndata: [DONE]\r\n",
+         "data: {\"completion\": \"!\"}"},
+        parse_in_process,
+        base::BindLambdaForTesting([&](ValueOrError result) {
+          ASSERT_TRUE(result.has_value());
+          const std::string* completion =
+              result->GetDict().FindString("completion");
+          ASSERT_TRUE(completion);
+          completions.push_back(*completion);
+        }));
+    task_environment_.RunUntilIdle();
+    EXPECT_EQ(completions,
+              std::vector<std::string>({" Hello", " there", "!"}));
+  }
+}
+
+TEST_F(ApiRequestHelperUnitTest, SSEJsonParsingInProcessIsSynchronous) {
+  int received = 0;
+  SendMessageSSEChunks(
+      {"data: {\"completion\": \"a\"}\n\ndata: {\"completion\": \"b\"}\n\n"},
+      true, base::BindLambdaForTesting([&](ValueOrError result) {
+        EXPECT_TRUE(result.has_value());
+        ++received;
+      }));
+  // Events are delivered without waiting for the decoder task runner.
+  EXPECT_EQ(received, 2);
+}
+
 }  // namespace api_request_helper
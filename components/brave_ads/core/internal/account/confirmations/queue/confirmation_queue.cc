@@ -98,6 +98,11 @@ void ConfirmationQueue::ProcessQueueItem(
 
   is_processing_ = true;
 
+  if (!drain_started_at_) {
+    drain_started_at_ = base::Time::Now();
+    processed_queue_item_count_ = 0;
+  }
+
   RedeemConfirmationFactory::BuildAndRedeemConfirmation(
       weak_factory_.GetWeakPtr(),
       RebuildConfirmationDynamicUserData(confirmation_queue_item.confirmation));
@@ -116,6 +121,8 @@ void ConfirmationQueue::SuccessfullyProcessedQueueItemCallback(
     bool success) {
   is_processing_ = false;
 
+  ++processed_queue_item_count_;
+
   NotifyDidProcessConfirmationQueue(confirmation);
 
   if (!success) {
@@ -173,6 +180,13 @@ void ConfirmationQueue::ProcessNextQueueItemCallback(
   }
 
   if (confirmation_queue_items.empty()) {
+    if (drain_started_at_) {
+      BLOG(1, "Processed " << processed_queue_item_count_
+                           << " confirmation queue items in "
+                           << base::Time::Now() - *drain_started_at_);
+      drain_started_at_.reset();
+    }
+
     return NotifyDidExhaustConfirmationQueue();
   }
 
@@ -6,9 +6,12 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ACCOUNT_CONFIRMATIONS_QUEUE_CONFIRMATION_QUEUE_H_
 #define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ACCOUNT_CONFIRMATIONS_QUEUE_CONFIRMATION_QUEUE_H_
 
+#include <optional>
+
 #include "base/check_op.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "brave/components/brave_ads/core/internal/account/confirmations/queue/confirmation_queue_database_table.h"
 #include "brave/components/brave_ads/core/internal/account/confirmations/queue/confirmation_queue_delegate.h"
 #include "brave/components/brave_ads/core/internal/account/confirmations/queue/queue_item/confirmation_queue_item_info.h"
@@ -95,6 +98,11 @@ class ConfirmationQueue final : public AdsClientNotifierObserver,
 
   bool is_processing_ = false;
 
+  // When the queue started to drain and how many queue items have been
+  // processed since, used to log how long draining the queue took.
+  std::optional<base::Time> drain_started_at_;
+  int processed_queue_item_count_ = 0;
+
   base::WeakPtrFactory<ConfirmationQueue> weak_factory_{this};
 };
 
@@ -5,11 +5,13 @@
 
 #include "brave/components/brave_ads/core/internal/catalog/catalog.h"
 
+#include <utility>
+
 #include "base/check.h"
 #include "base/functional/bind.h"
 #include "base/time/time.h"
 #include "brave/components/brave_ads/core/internal/ads_client/ads_client_util.h"
-#include "brave/components/brave_ads/core/internal/catalog/catalog_info.h"
+#include "brave/components/brave_ads/core/internal/catalog/catalog_feature.h"
 #include "brave/components/brave_ads/core/internal/catalog/catalog_url_request.h"
 #include "brave/components/brave_ads/core/internal/catalog/catalog_util.h"
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
@@ -77,6 +79,7 @@ void Catalog::ShutdownCatalogUrlRequest() {
     catalog_url_request_.reset();
     BLOG(1, "Shutdown catalog URL request");
 
+    last_catalog_.reset();
     ResetCatalog(/*intentional*/ base::DoNothing());
   }
 }
@@ -123,15 +126,25 @@ void Catalog::OnDidFetchCatalog(const CatalogInfo& catalog) {
     return BLOG(1, "Catalog id " << catalog.id << " is up to date");
   }
 
-  SaveCatalog(catalog, base::BindOnce(&Catalog::OnDidFetchCatalogCallback,
-                                      weak_factory_.GetWeakPtr(), catalog));
+  ResultCallback callback =
+      base::BindOnce(&Catalog::OnDidFetchCatalogCallback,
+                     weak_factory_.GetWeakPtr(), catalog);
+
+  if (kShouldUpdateCatalogIncrementally.Get() && last_catalog_) {
+    return UpdateCatalog(*last_catalog_, catalog, std::move(callback));
+  }
+
+  SaveCatalog(catalog, std::move(callback));
 }
 
 void Catalog::OnDidFetchCatalogCallback(const CatalogInfo& catalog,
                                         bool success) {
   if (success) {
+    last_catalog_ = catalog;
     NotifyDidFetchCatalog(catalog);
   } else {
+    // The stored catalog is unknown, so the next catalog is saved in full.
+    last_catalog_.reset();
     NotifyFailedToFetchCatalog();
   }
 }
@@ -141,6 +154,7 @@ void Catalog::OnFailedToFetchCatalog() {
 }
 
 void Catalog::OnDidMigrateDatabase(int /*from_version*/, int /*to_version*/) {
+  last_catalog_.reset();
   ResetCatalog(/*intentional*/ base::DoNothing());
 }
 
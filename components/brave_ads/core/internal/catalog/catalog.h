@@ -7,10 +7,12 @@
 #define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CATALOG_CATALOG_H_
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
+#include "brave/components/brave_ads/core/internal/catalog/catalog_info.h"
 #include "brave/components/brave_ads/core/internal/catalog/catalog_observer.h"
 #include "brave/components/brave_ads/core/internal/catalog/catalog_url_request_delegate.h"
 #include "brave/components/brave_ads/core/internal/database/database_manager_observer.h"
@@ -19,7 +21,6 @@
 namespace brave_ads {
 
 class CatalogUrlRequest;
-struct CatalogInfo;
 
 class Catalog final : public AdsClientNotifierObserver,
                       public CatalogUrlRequestDelegate,
@@ -63,6 +64,10 @@ class Catalog final : public AdsClientNotifierObserver,
 
   std::unique_ptr<CatalogUrlRequest> catalog_url_request_;
 
+  // The catalog which was last saved to the database, used to only write the
+  // campaigns which changed. Unset if the stored catalog is unknown.
+  std::optional<CatalogInfo> last_catalog_;
+
   base::WeakPtrFactory<Catalog> weak_factory_{this};
 };
 
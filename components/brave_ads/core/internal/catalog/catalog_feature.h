@@ -17,6 +17,12 @@ BASE_DECLARE_FEATURE(kCatalogFeature);
 inline constexpr base::FeatureParam<base::TimeDelta> kCatalogLifespan{
     &kCatalogFeature, "lifespan", base::Days(1)};
 
+// Set to `true` to only write the campaigns which were added, changed or
+// removed since the last saved catalog, instead of rebuilding every creative
+// table.
+inline constexpr base::FeatureParam<bool> kShouldUpdateCatalogIncrementally{
+    &kCatalogFeature, "should_update_incrementally", false};
+
 }  // namespace brave_ads
 
 #endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CATALOG_CATALOG_FEATURE_H_
@@ -6,11 +6,14 @@
 #include "brave/components/brave_ads/core/internal/catalog/catalog_url_request.h"
 
 #include <optional>
+#include <string>
 #include <utility>
 
 #include "base/check.h"
 #include "base/functional/bind.h"
+#include "base/json/json_reader.h"
 #include "base/location.h"
+#include "base/task/thread_pool.h"
 #include "base/time/time.h"
 #include "brave/components/brave_ads/core/internal/ads_client/ads_client_util.h"
 #include "brave/components/brave_ads/core/internal/ads_notifier_manager.h"
@@ -36,6 +39,10 @@ constexpr base::TimeDelta kDebugCatalogPing = base::Minutes(3);
 
 constexpr base::TimeDelta kRetryAfter = base::Minutes(1);
 
+std::optional<base::Value::Dict> ParseCatalogJson(const std::string& json) {
+  return base::JSONReader::ReadDict(json, base::JSON_PARSE_RFC);
+}
+
 }  // namespace
 
 CatalogUrlRequest::CatalogUrlRequest() = default;
@@ -103,8 +110,25 @@ void CatalogUrlRequest::FetchCallback(
   }
 
   BLOG(1, "Parsing catalog");
-  std::optional<CatalogInfo> catalog =
-      json::reader::ReadCatalog(mojom_url_response.body);
+
+  // Large catalogs take a while to parse, so the JSON is parsed on a background
+  // sequence. The catalog is read from the parsed JSON on this sequence as it
+  // logs to the ads client.
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::BEST_EFFORT},
+      base::BindOnce(&ParseCatalogJson, mojom_url_response.body),
+      base::BindOnce(&CatalogUrlRequest::ParseCatalogCallback,
+                     weak_factory_.GetWeakPtr()));
+}
+
+void CatalogUrlRequest::ParseCatalogCallback(
+    std::optional<base::Value::Dict> dict) {
+  if (!dict) {
+    BLOG(0, "Failed to read catalog JSON");
+    return FailedToFetchCatalog(/*should_retry=*/true);
+  }
+
+  std::optional<CatalogInfo> catalog = json::reader::ReadCatalog(*dict);
   if (!catalog) {
     BLOG(0, "Failed to parse catalog");
     return FailedToFetchCatalog(/*should_retry=*/true);
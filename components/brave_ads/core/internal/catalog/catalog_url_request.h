@@ -6,9 +6,12 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CATALOG_CATALOG_URL_REQUEST_H_
 #define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CATALOG_CATALOG_URL_REQUEST_H_
 
+#include <optional>
+
 #include "base/check_op.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/values.h"
 #include "brave/components/brave_ads/core/internal/catalog/catalog_url_request_delegate.h"
 #include "brave/components/brave_ads/core/internal/common/timer/backoff_timer.h"
 #include "brave/components/brave_ads/core/mojom/brave_ads.mojom-forward.h"
@@ -36,6 +39,7 @@ class CatalogUrlRequest final {
  private:
   void Fetch();
   void FetchCallback(const mojom::UrlResponseInfo& mojom_url_response);
+  void ParseCatalogCallback(std::optional<base::Value::Dict> dict);
   void FetchAfterDelay();
 
   void SuccessfullyFetchedCatalog(const CatalogInfo& catalog);
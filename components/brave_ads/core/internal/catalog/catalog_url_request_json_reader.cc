@@ -604,9 +604,13 @@ std::optional<CatalogInfo> ReadCatalog(const std::string& json) {
     return std::nullopt;
   }
 
+  return ReadCatalog(*dict);
+}
+
+std::optional<CatalogInfo> ReadCatalog(const base::Value::Dict& dict) {
   TRACE_EVENT_BEGIN(kTraceEventCategory,
                     "CatalogUrlRequestJsonReader::ParseCatalog");
-  std::optional<CatalogInfo> catalog = ParseCatalog(*dict);
+  std::optional<CatalogInfo> catalog = ParseCatalog(dict);
   if (!catalog) {
     BLOG(0, "Failed to parse catalog");
     TRACE_EVENT_END1(kTraceEventCategory,
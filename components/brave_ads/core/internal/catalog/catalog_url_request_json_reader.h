@@ -9,6 +9,8 @@
 #include <optional>
 #include <string>
 
+#include "base/values.h"
+
 namespace brave_ads {
 
 struct CatalogInfo;
@@ -17,6 +19,10 @@ namespace json::reader {
 
 std::optional<CatalogInfo> ReadCatalog(const std::string& json);
 
+// Reads a catalog from a `dict` which was already parsed from JSON, i.e. on a
+// background sequence.
+std::optional<CatalogInfo> ReadCatalog(const base::Value::Dict& dict);
+
 }  // namespace json::reader
 
 }  // namespace brave_ads
@@ -5,10 +5,17 @@
 
 #include "brave/components/brave_ads/core/internal/catalog/catalog_util.h"
 
+#include <string_view>
 #include <utility>
+#include <vector>
 
+#include "base/containers/flat_map.h"
+#include "base/containers/map_util.h"
 #include "base/functional/bind.h"
+#include "base/strings/string_util.h"
 #include "base/time/time.h"
+#include "brave/components/brave_ads/core/internal/catalog/campaign/creative_set/catalog_creative_set_info.h"
+#include "brave/components/brave_ads/core/internal/catalog/campaign/creative_set/creative/notification_ad/catalog_creative_notification_ad_info.h"
 #include "brave/components/brave_ads/core/internal/catalog/catalog_feature.h"
 #include "brave/components/brave_ads/core/internal/catalog/catalog_info.h"
 #include "brave/components/brave_ads/core/internal/common/database/database_transaction_util.h"
@@ -103,6 +110,107 @@ void Delete(ResultCallback callback) {
                            std::move(callback));
 }
 
+std::string BuildQuotedList(const std::vector<std::string>& values) {
+  std::vector<std::string> quoted_values;
+  quoted_values.reserve(values.size());
+  for (const auto& value : values) {
+    quoted_values.push_back(
+        base::ReplaceStringPlaceholders("'$1'", {value}, nullptr));
+  }
+
+  return base::JoinString(quoted_values, ", ");
+}
+
+void DeleteRows(const mojom::DBTransactionInfoPtr& mojom_db_transaction,
+                const std::string& table_name,
+                const std::string& column,
+                const std::string& new_tab_page_ads_column,
+                const std::vector<std::string>& values) {
+  if (values.empty()) {
+    return;
+  }
+
+  // Rows associated with new tab page ads are provided by component resources
+  // and must be kept.
+  database::Execute(mojom_db_transaction, R"(
+      DELETE FROM
+        $1
+      WHERE
+        $2 IN ($3)
+        AND $2 NOT IN (
+          SELECT
+            DISTINCT $4
+          FROM
+            creative_new_tab_page_ads
+        ))",
+                    {table_name, column, BuildQuotedList(values),
+                     new_tab_page_ads_column});
+}
+
+void DeleteCampaigns(const CatalogCampaignList& campaigns,
+                     ResultCallback callback) {
+  if (campaigns.empty()) {
+    return std::move(callback).Run(/*success=*/true);
+  }
+
+  std::vector<std::string> campaign_ids;
+  std::vector<std::string> creative_set_ids;
+  std::vector<std::string> creative_instance_ids;
+  for (const auto& campaign : campaigns) {
+    campaign_ids.push_back(campaign.id);
+    for (const auto& creative_set : campaign.creative_sets) {
+      creative_set_ids.push_back(creative_set.id);
+      for (const auto& creative : creative_set.creative_notification_ads) {
+        creative_instance_ids.push_back(creative.instance_id);
+      }
+    }
+  }
+
+  mojom::DBTransactionInfoPtr mojom_db_transaction =
+      mojom::DBTransactionInfo::New();
+
+  DeleteRows(mojom_db_transaction, "campaigns", "id", "campaign_id",
+             campaign_ids);
+  DeleteRows(mojom_db_transaction, "geo_targets", "campaign_id", "campaign_id",
+             campaign_ids);
+  DeleteRows(mojom_db_transaction, "dayparts", "campaign_id", "campaign_id",
+             campaign_ids);
+  DeleteRows(mojom_db_transaction, "segments", "creative_set_id",
+             "creative_set_id", creative_set_ids);
+  DeleteRows(mojom_db_transaction, "creative_ads", "creative_instance_id",
+             "creative_instance_id", creative_instance_ids);
+  DeleteRows(mojom_db_transaction, "creative_ad_notifications",
+             "creative_instance_id", "creative_instance_id",
+             creative_instance_ids);
+
+  database::RunTransaction(FROM_HERE, std::move(mojom_db_transaction),
+                           std::move(callback));
+}
+
+// Returns the campaigns in `catalog` which are not in `other_catalog` as is.
+CatalogCampaignList GetCampaignsNotIn(const CatalogInfo& catalog,
+                                      const CatalogInfo& other_catalog) {
+  std::vector<std::pair<std::string_view, const CatalogCampaignInfo*>>
+      other_campaigns;
+  other_campaigns.reserve(other_catalog.campaigns.size());
+  for (const auto& campaign : other_catalog.campaigns) {
+    other_campaigns.emplace_back(campaign.id, &campaign);
+  }
+  const base::flat_map<std::string_view, const CatalogCampaignInfo*>
+      other_campaigns_by_id(std::move(other_campaigns));
+
+  CatalogCampaignList campaigns;
+  for (const auto& campaign : catalog.campaigns) {
+    const CatalogCampaignInfo* const* const other_campaign =
+        base::FindOrNull(other_campaigns_by_id, campaign.id);
+    if (!other_campaign || **other_campaign != campaign) {
+      campaigns.push_back(campaign);
+    }
+  }
+
+  return campaigns;
+}
+
 void SaveCatalogCallback(const CatalogInfo& catalog,
                          ResultCallback callback,
                          bool success) {
@@ -139,6 +247,28 @@ void SaveCatalog(const CatalogInfo& catalog, ResultCallback callback) {
   Delete(base::BindOnce(&SaveCatalogCallback, catalog, std::move(callback)));
 }
 
+void UpdateCatalog(const CatalogInfo& last_catalog,
+                   const CatalogInfo& catalog,
+                   ResultCallback callback) {
+  CatalogInfo changed_catalog;
+  changed_catalog.id = catalog.id;
+  changed_catalog.version = catalog.version;
+  changed_catalog.ping = catalog.ping;
+  changed_catalog.campaigns = GetChangedCatalogCampaigns(last_catalog, catalog);
+
+  const CatalogCampaignList stale_campaigns =
+      GetStaleCatalogCampaigns(last_catalog, catalog);
+
+  BLOG(1, "Updating " << changed_catalog.campaigns.size()
+                      << " and removing " << stale_campaigns.size()
+                      << " catalog campaigns");
+
+  DeleteCampaigns(stale_campaigns,
+                  base::BindOnce(&SaveCatalogCallback,
+                                 std::move(changed_catalog),
+                                 std::move(callback)));
+}
+
 void ResetCatalog(ResultCallback callback) {
   Delete(base::BindOnce(&ResetCatalogCallback, std::move(callback)));
 }
@@ -187,4 +317,14 @@ bool HasCatalogExpired() {
   return base::Time::Now() >= GetCatalogLastUpdated() + kCatalogLifespan.Get();
 }
 
+CatalogCampaignList GetChangedCatalogCampaigns(const CatalogInfo& last_catalog,
+                                               const CatalogInfo& catalog) {
+  return GetCampaignsNotIn(catalog, last_catalog);
+}
+
+CatalogCampaignList GetStaleCatalogCampaigns(const CatalogInfo& last_catalog,
+                                             const CatalogInfo& catalog) {
+  return GetCampaignsNotIn(last_catalog, catalog);
+}
+
 }  // namespace brave_ads
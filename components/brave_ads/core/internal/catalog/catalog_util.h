@@ -8,6 +8,7 @@
 
 #include <string>
 
+#include "brave/components/brave_ads/core/internal/catalog/campaign/catalog_campaign_info.h"
 #include "brave/components/brave_ads/core/public/ads_callback.h"
 
 namespace base {
@@ -20,6 +21,12 @@ namespace brave_ads {
 struct CatalogInfo;
 
 void SaveCatalog(const CatalogInfo& catalog, ResultCallback callback);
+
+// Saves `catalog` by only writing the campaigns which were added, changed or
+// removed since `last_catalog` was saved.
+void UpdateCatalog(const CatalogInfo& last_catalog,
+                   const CatalogInfo& catalog,
+                   ResultCallback callback);
 void ResetCatalog(ResultCallback callback);
 
 std::string GetCatalogId();
@@ -38,6 +45,16 @@ bool DoesCatalogExist();
 bool HasCatalogChanged(const std::string& catalog_id);
 bool HasCatalogExpired();
 
+// Returns the campaigns in `catalog` which were added or changed since
+// `last_catalog`.
+CatalogCampaignList GetChangedCatalogCampaigns(const CatalogInfo& last_catalog,
+                                               const CatalogInfo& catalog);
+
+// Returns the campaigns in `last_catalog` which were changed or removed in
+// `catalog`.
+CatalogCampaignList GetStaleCatalogCampaigns(const CatalogInfo& last_catalog,
+                                             const CatalogInfo& catalog);
+
 }  // namespace brave_ads
 
 #endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CATALOG_CATALOG_UTIL_H_
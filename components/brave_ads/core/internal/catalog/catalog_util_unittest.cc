@@ -5,8 +5,11 @@
 
 #include "brave/components/brave_ads/core/internal/catalog/catalog_util.h"
 
+#include <string>
+
 #include "base/test/gmock_callback_support.h"
 #include "base/test/mock_callback.h"
+#include "brave/components/brave_ads/core/internal/catalog/catalog_info.h"
 #include "brave/components/brave_ads/core/internal/catalog/catalog_test_constants.h"
 #include "brave/components/brave_ads/core/internal/common/test/test_base.h"
 #include "brave/components/brave_ads/core/internal/common/test/time_test_util.h"
@@ -17,6 +20,17 @@
 
 namespace brave_ads {
 
+namespace {
+
+CatalogCampaignInfo BuildCatalogCampaign(const std::string& id, int priority) {
+  CatalogCampaignInfo campaign;
+  campaign.id = id;
+  campaign.priority = priority;
+  return campaign;
+}
+
+}  // namespace
+
 class BraveAdsCatalogUtilTest : public test::TestBase {};
 
 TEST_F(BraveAdsCatalogUtilTest, ResetCatalog) {
@@ -94,4 +108,40 @@ TEST_F(BraveAdsCatalogUtilTest, CatalogHasNotExpired) {
   EXPECT_FALSE(HasCatalogExpired());
 }
 
+TEST_F(BraveAdsCatalogUtilTest, GetChangedAndStaleCatalogCampaigns) {
+  // Arrange
+  CatalogInfo last_catalog;
+  last_catalog.campaigns = {BuildCatalogCampaign("unchanged", /*priority=*/1),
+                            BuildCatalogCampaign("changed", /*priority=*/1),
+                            BuildCatalogCampaign("removed", /*priority=*/1)};
+
+  CatalogInfo catalog;
+  catalog.campaigns = {BuildCatalogCampaign("unchanged", /*priority=*/1),
+                       BuildCatalogCampaign("changed", /*priority=*/2),
+                       BuildCatalogCampaign("added", /*priority=*/1)};
+
+  // Act & Assert
+  EXPECT_EQ(CatalogCampaignList({BuildCatalogCampaign("changed",
+                                                      /*priority=*/2),
+                                 BuildCatalogCampaign("added",
+                                                      /*priority=*/1)}),
+            GetChangedCatalogCampaigns(last_catalog, catalog));
+  EXPECT_EQ(CatalogCampaignList({BuildCatalogCampaign("changed",
+                                                      /*priority=*/1),
+                                 BuildCatalogCampaign("removed",
+                                                      /*priority=*/1)}),
+            GetStaleCatalogCampaigns(last_catalog, catalog));
+}
+
+TEST_F(BraveAdsCatalogUtilTest, NoChangedOrStaleCatalogCampaigns) {
+  // Arrange
+  CatalogInfo catalog;
+  catalog.campaigns = {BuildCatalogCampaign("campaign", /*priority=*/1)};
+
+  // Act & Assert
+  EXPECT_THAT(GetChangedCatalogCampaigns(catalog, catalog),
+              ::testing::IsEmpty());
+  EXPECT_THAT(GetStaleCatalogCampaigns(catalog, catalog), ::testing::IsEmpty());
+}
+
 }  // namespace brave_ads
@@ -299,24 +299,33 @@ void AdHistory::GetHighestRankedPlacementsForDateRange(
               created_at BETWEEN $2 AND $3
           ),
 
-          -- Then, it uses another CTE to filter the records, keeping only the
-          -- one with the lowest priority for each `placement_id`.
+          -- Then, it uses another CTE to find the lowest priority for each
+          -- `placement_id` in a single pass, rather than with a correlated
+          -- subquery for every record.
 
-          FilteredAdHistory AS (
+          PlacementPriorities AS (
             SELECT
-              *
+              placement_id,
+              MIN(priority) AS priority
             FROM
-              PrioritizedAdHistory as ad_history
+              PrioritizedAdHistory
             WHERE
-              priority = (
-                SELECT
-                  MIN(priority)
-                FROM
-                  PrioritizedAdHistory AS other_ad_history
-                WHERE
-                  other_ad_history.placement_id = ad_history.placement_id
-                  AND other_ad_history.priority > 0
-              )
+              priority > 0
+            GROUP BY
+              placement_id
+          ),
+
+          -- Then, it filters the records, keeping only the ones with the lowest
+          -- priority for each `placement_id`.
+
+          FilteredAdHistory AS (
+            SELECT
+              ad_history.*
+            FROM
+              PrioritizedAdHistory AS ad_history
+              INNER JOIN PlacementPriorities AS placement_priorities
+                ON placement_priorities.placement_id = ad_history.placement_id
+                AND placement_priorities.priority = ad_history.priority
           )
 
           -- Finally, it selects the required columns from the filtered records
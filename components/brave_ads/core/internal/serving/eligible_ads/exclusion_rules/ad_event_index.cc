@@ -0,0 +1,96 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/ad_event_index.h"
+
+#include <algorithm>
+
+#include "base/check.h"
+#include "base/containers/map_util.h"
+#include "brave/components/brave_ads/core/mojom/brave_ads.mojom.h"
+
+namespace brave_ads {
+
+AdEventIndex::AdEventIndex(const AdEventList& ad_events) {
+  for (const auto& ad_event : ad_events) {
+    CHECK(ad_event.created_at);
+
+    const base::Time created_at = *ad_event.created_at;
+    campaign_ad_event_times_[ad_event.confirmation_type][ad_event.campaign_id]
+        .push_back(created_at);
+    creative_set_ad_event_times_[ad_event.confirmation_type]
+                                [ad_event.creative_set_id]
+                                    .push_back(created_at);
+    creative_instance_ad_event_times_[ad_event.confirmation_type]
+                                     [ad_event.creative_instance_id]
+                                         .push_back(created_at);
+  }
+
+  for (auto* ad_event_times :
+       {&campaign_ad_event_times_, &creative_set_ad_event_times_,
+        &creative_instance_ad_event_times_}) {
+    for (auto& [mojom_confirmation_type, ids] : *ad_event_times) {
+      for (auto& [id, times] : ids) {
+        std::ranges::sort(times);
+      }
+    }
+  }
+}
+
+AdEventIndex::AdEventIndex(AdEventIndex&&) noexcept = default;
+
+AdEventIndex& AdEventIndex::operator=(AdEventIndex&&) noexcept = default;
+
+AdEventIndex::~AdEventIndex() = default;
+
+size_t AdEventIndex::CountCampaignAdEvents(
+    const std::string& campaign_id,
+    mojom::ConfirmationType mojom_confirmation_type,
+    base::TimeDelta time_window) const {
+  return Count(campaign_ad_event_times_, campaign_id, mojom_confirmation_type,
+               time_window);
+}
+
+size_t AdEventIndex::CountCreativeSetAdEvents(
+    const std::string& creative_set_id,
+    mojom::ConfirmationType mojom_confirmation_type,
+    base::TimeDelta time_window) const {
+  return Count(creative_set_ad_event_times_, creative_set_id,
+               mojom_confirmation_type, time_window);
+}
+
+size_t AdEventIndex::CountCreativeInstanceAdEvents(
+    const std::string& creative_instance_id,
+    mojom::ConfirmationType mojom_confirmation_type,
+    base::TimeDelta time_window) const {
+  return Count(creative_instance_ad_event_times_, creative_instance_id,
+               mojom_confirmation_type, time_window);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+// static
+size_t AdEventIndex::Count(const AdEventTimesMap& ad_event_times,
+                           const std::string& id,
+                           mojom::ConfirmationType mojom_confirmation_type,
+                           base::TimeDelta time_window) {
+  const auto* const ids =
+      base::FindOrNull(ad_event_times, mojom_confirmation_type);
+  if (!ids) {
+    return 0;
+  }
+
+  const auto* const times = base::FindOrNull(*ids, id);
+  if (!times) {
+    return 0;
+  }
+
+  // Ad events are counted if |now - created_at < time_window|.
+  const base::Time threshold = base::Time::Now() - time_window;
+  return static_cast<size_t>(
+      times->cend() - std::ranges::upper_bound(*times, threshold));
+}
+
+}  // namespace brave_ads
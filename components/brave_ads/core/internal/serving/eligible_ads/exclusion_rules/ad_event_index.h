@@ -0,0 +1,70 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_SERVING_ELIGIBLE_ADS_EXCLUSION_RULES_AD_EVENT_INDEX_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_SERVING_ELIGIBLE_ADS_EXCLUSION_RULES_AD_EVENT_INDEX_H_
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/time/time.h"
+#include "brave/components/brave_ads/core/internal/user_engagement/ad_events/ad_event_info.h"
+#include "brave/components/brave_ads/core/mojom/brave_ads.mojom-forward.h"
+
+namespace brave_ads {
+
+// Indexes ad events by campaign, creative set and creative instance so that
+// frequency caps can be checked for each creative ad without scanning all ad
+// events. The index is built once from the ad events of a serving attempt.
+class AdEventIndex final {
+ public:
+  explicit AdEventIndex(const AdEventList& ad_events);
+
+  AdEventIndex(const AdEventIndex&) = delete;
+  AdEventIndex& operator=(const AdEventIndex&) = delete;
+
+  AdEventIndex(AdEventIndex&&) noexcept;
+  AdEventIndex& operator=(AdEventIndex&&) noexcept;
+
+  ~AdEventIndex();
+
+  // Returns the number of ad events of |mojom_confirmation_type| for the given
+  // id which were created less than |time_window| ago.
+  size_t CountCampaignAdEvents(const std::string& campaign_id,
+                               mojom::ConfirmationType mojom_confirmation_type,
+                               base::TimeDelta time_window) const;
+  size_t CountCreativeSetAdEvents(
+      const std::string& creative_set_id,
+      mojom::ConfirmationType mojom_confirmation_type,
+      base::TimeDelta time_window) const;
+  size_t CountCreativeInstanceAdEvents(
+      const std::string& creative_instance_id,
+      mojom::ConfirmationType mojom_confirmation_type,
+      base::TimeDelta time_window) const;
+
+ private:
+  // Creation times of the ad events for an id, in ascending order.
+  using AdEventTimes = std::vector<base::Time>;
+  using AdEventTimesMap = base::flat_map<
+      mojom::ConfirmationType,
+      std::map</*id*/ std::string, AdEventTimes, std::less<>>>;
+
+  static size_t Count(const AdEventTimesMap& ad_event_times,
+                      const std::string& id,
+                      mojom::ConfirmationType mojom_confirmation_type,
+                      base::TimeDelta time_window);
+
+  AdEventTimesMap campaign_ad_event_times_;
+  AdEventTimesMap creative_set_ad_event_times_;
+  AdEventTimesMap creative_instance_ad_event_times_;
+};
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_SERVING_ELIGIBLE_ADS_EXCLUSION_RULES_AD_EVENT_INDEX_H_
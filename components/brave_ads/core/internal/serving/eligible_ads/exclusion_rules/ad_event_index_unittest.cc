@@ -0,0 +1,91 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/ad_event_index.h"
+
+#include "base/time/time.h"
+#include "brave/components/brave_ads/core/internal/ad_units/ad_test_constants.h"
+#include "brave/components/brave_ads/core/internal/common/test/test_base.h"
+#include "brave/components/brave_ads/core/internal/common/test/time_test_util.h"
+#include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
+#include "brave/components/brave_ads/core/internal/user_engagement/ad_events/ad_event_builder_test_util.h"
+#include "brave/components/brave_ads/core/mojom/brave_ads.mojom.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds*
+
+namespace brave_ads {
+
+class BraveAdsAdEventIndexTest : public test::TestBase {};
+
+TEST_F(BraveAdsAdEventIndexTest, CountAdEvents) {
+  // Arrange
+  CreativeAdInfo creative_ad;
+  creative_ad.creative_instance_id = test::kCreativeInstanceId;
+  creative_ad.creative_set_id = test::kCreativeSetId;
+  creative_ad.campaign_id = test::kCampaignId;
+
+  AdEventList ad_events;
+  ad_events.push_back(test::BuildAdEvent(
+      creative_ad, mojom::AdType::kNotificationAd,
+      mojom::ConfirmationType::kServedImpression,
+      /*created_at=*/test::Now() - base::Days(2),
+      /*should_generate_random_uuids=*/true));
+  ad_events.push_back(test::BuildAdEvent(
+      creative_ad, mojom::AdType::kNotificationAd,
+      mojom::ConfirmationType::kServedImpression,
+      /*created_at=*/test::Now() - base::Hours(1),
+      /*should_generate_random_uuids=*/true));
+  ad_events.push_back(test::BuildAdEvent(
+      creative_ad, mojom::AdType::kNotificationAd,
+      mojom::ConfirmationType::kClicked,
+      /*created_at=*/test::Now(), /*should_generate_random_uuids=*/true));
+
+  const AdEventIndex ad_event_index(ad_events);
+
+  // Act & Assert
+  EXPECT_EQ(1U, ad_event_index.CountCampaignAdEvents(
+                    test::kCampaignId,
+                    mojom::ConfirmationType::kServedImpression, base::Days(1)));
+  EXPECT_EQ(2U, ad_event_index.CountCreativeSetAdEvents(
+                    test::kCreativeSetId,
+                    mojom::ConfirmationType::kServedImpression, base::Days(3)));
+  EXPECT_EQ(2U, ad_event_index.CountCreativeSetAdEvents(
+                    test::kCreativeSetId,
+                    mojom::ConfirmationType::kServedImpression,
+                    base::TimeDelta::Max()));
+  EXPECT_EQ(1U, ad_event_index.CountCreativeInstanceAdEvents(
+                    test::kCreativeInstanceId,
+                    mojom::ConfirmationType::kClicked, base::Hours(1)));
+  EXPECT_EQ(0U, ad_event_index.CountCreativeInstanceAdEvents(
+                    test::kCreativeInstanceId,
+                    mojom::ConfirmationType::kDismissed, base::Days(1)));
+}
+
+TEST_F(BraveAdsAdEventIndexTest, DoNotCountAdEventsAtTheEndOfTheTimeWindow) {
+  // Arrange
+  CreativeAdInfo creative_ad;
+  creative_ad.campaign_id = test::kCampaignId;
+
+  AdEventList ad_events;
+  ad_events.push_back(test::BuildAdEvent(
+      creative_ad, mojom::AdType::kNotificationAd,
+      mojom::ConfirmationType::kServedImpression,
+      /*created_at=*/test::Now(), /*should_generate_random_uuids=*/true));
+
+  const AdEventIndex ad_event_index(ad_events);
+
+  AdvanceClockBy(base::Days(1) - base::Milliseconds(1));
+  EXPECT_EQ(1U, ad_event_index.CountCampaignAdEvents(
+                    test::kCampaignId,
+                    mojom::ConfirmationType::kServedImpression, base::Days(1)));
+
+  // Act & Assert
+  AdvanceClockBy(base::Milliseconds(1));
+  EXPECT_EQ(0U, ad_event_index.CountCampaignAdEvents(
+                    test::kCampaignId,
+                    mojom::ConfirmationType::kServedImpression, base::Days(1)));
+}
+
+}  // namespace brave_ads
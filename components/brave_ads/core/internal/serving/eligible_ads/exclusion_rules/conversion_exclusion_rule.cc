@@ -5,8 +5,6 @@
 
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/conversion_exclusion_rule.h"
 
-#include <utility>
-
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/exclusion_rule_feature.h"
@@ -14,8 +12,8 @@
 
 namespace brave_ads {
 
-ConversionExclusionRule::ConversionExclusionRule(AdEventList ad_events)
-    : ad_events_(std::move(ad_events)) {}
+ConversionExclusionRule::ConversionExclusionRule(const AdEventList& ad_events)
+    : ad_event_index_(ad_events) {}
 
 ConversionExclusionRule::~ConversionExclusionRule() = default;
 
@@ -27,7 +25,7 @@ std::string ConversionExclusionRule::GetCacheKey(
 bool ConversionExclusionRule::ShouldInclude(
     const CreativeAdInfo& creative_ad) const {
   if (!DoesRespectCreativeSetCap(
-          creative_ad, ad_events_, mojom::ConfirmationType::kConversion,
+          creative_ad, ad_event_index_, mojom::ConfirmationType::kConversion,
           kShouldExcludeAdIfCreativeSetExceedsConversionCap.Get())) {
     BLOG(1, "creativeSetId " << creative_ad.creative_set_id
                              << " has exceeded the conversions frequency cap");
@@ -8,6 +8,7 @@
 
 #include <string>
 
+#include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/ad_event_index.h"
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/exclusion_rule_interface.h"
 #include "brave/components/brave_ads/core/internal/user_engagement/ad_events/ad_event_info.h"
 
@@ -18,7 +19,7 @@ struct CreativeAdInfo;
 class ConversionExclusionRule final
     : public ExclusionRuleInterface<CreativeAdInfo> {
  public:
-  explicit ConversionExclusionRule(AdEventList ad_events);
+  explicit ConversionExclusionRule(const AdEventList& ad_events);
 
   ConversionExclusionRule(const ConversionExclusionRule&) = delete;
   ConversionExclusionRule& operator=(const ConversionExclusionRule&) = delete;
@@ -30,7 +31,7 @@ class ConversionExclusionRule final
   bool ShouldInclude(const CreativeAdInfo& creative_ad) const override;
 
  private:
-  AdEventList ad_events_;
+  const AdEventIndex ad_event_index_;
 };
 
 }  // namespace brave_ads
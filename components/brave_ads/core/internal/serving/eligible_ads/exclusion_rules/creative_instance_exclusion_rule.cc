@@ -5,8 +5,6 @@
 
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/creative_instance_exclusion_rule.h"
 
-#include <utility>
-
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/exclusion_rule_feature.h"
@@ -16,8 +14,8 @@
 namespace brave_ads {
 
 CreativeInstanceExclusionRule::CreativeInstanceExclusionRule(
-    AdEventList ad_events)
-    : ad_events_(std::move(ad_events)) {}
+    const AdEventList& ad_events)
+    : ad_event_index_(ad_events) {}
 
 CreativeInstanceExclusionRule::~CreativeInstanceExclusionRule() = default;
 
@@ -29,7 +27,8 @@ std::string CreativeInstanceExclusionRule::GetCacheKey(
 bool CreativeInstanceExclusionRule::ShouldInclude(
     const CreativeAdInfo& creative_ad) const {
   if (!DoesRespectCreativeCap(
-          creative_ad, ad_events_, mojom::ConfirmationType::kServedImpression,
+          creative_ad, ad_event_index_,
+          mojom::ConfirmationType::kServedImpression,
           kShouldExcludeAdIfCreativeInstanceWithinTimeWindow.Get(),
           kShouldExcludeAdIfCreativeInstanceExceedsPerHourCap.Get())) {
     BLOG(1, "creativeInstanceId "
@@ -8,6 +8,7 @@
 
 #include <string>
 
+#include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/ad_event_index.h"
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/exclusion_rule_interface.h"
 #include "brave/components/brave_ads/core/internal/user_engagement/ad_events/ad_event_info.h"
 
@@ -18,7 +19,7 @@ struct CreativeAdInfo;
 class CreativeInstanceExclusionRule final
     : public ExclusionRuleInterface<CreativeAdInfo> {
  public:
-  explicit CreativeInstanceExclusionRule(AdEventList ad_events);
+  explicit CreativeInstanceExclusionRule(const AdEventList& ad_events);
 
   CreativeInstanceExclusionRule(const CreativeInstanceExclusionRule&) = delete;
   CreativeInstanceExclusionRule& operator=(
@@ -31,7 +32,7 @@ class CreativeInstanceExclusionRule final
   bool ShouldInclude(const CreativeAdInfo& creative_ad) const override;
 
  private:
-  AdEventList ad_events_;
+  const AdEventIndex ad_event_index_;
 };
 
 }  // namespace brave_ads
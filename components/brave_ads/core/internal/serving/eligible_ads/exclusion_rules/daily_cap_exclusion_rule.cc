@@ -5,8 +5,6 @@
 
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/daily_cap_exclusion_rule.h"
 
-#include <utility>
-
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/exclusion_rule_util.h"
@@ -14,8 +12,8 @@
 
 namespace brave_ads {
 
-DailyCapExclusionRule::DailyCapExclusionRule(AdEventList ad_events)
-    : ad_events_(std::move(ad_events)) {}
+DailyCapExclusionRule::DailyCapExclusionRule(const AdEventList& ad_events)
+    : ad_event_index_(ad_events) {}
 
 DailyCapExclusionRule::~DailyCapExclusionRule() = default;
 
@@ -26,7 +24,7 @@ std::string DailyCapExclusionRule::GetCacheKey(
 
 bool DailyCapExclusionRule::ShouldInclude(
     const CreativeAdInfo& creative_ad) const {
-  if (!DoesRespectCampaignCap(creative_ad, ad_events_,
+  if (!DoesRespectCampaignCap(creative_ad, ad_event_index_,
                               mojom::ConfirmationType::kServedImpression,
                               base::Days(1), creative_ad.daily_cap)) {
     BLOG(1, "campaignId " << creative_ad.campaign_id
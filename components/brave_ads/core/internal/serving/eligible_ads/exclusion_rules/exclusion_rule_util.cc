@@ -5,10 +5,9 @@
 
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/exclusion_rule_util.h"
 
-#include "base/check.h"
 #include "base/time/time.h"
-#include "brave/components/brave_ads/core/internal/common/algorithm/count_if_until_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
+#include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/ad_event_index.h"
 #include "brave/components/brave_ads/core/mojom/brave_ads.mojom.h"
 
 namespace brave_ads {
@@ -22,7 +21,7 @@ bool ShouldAlwaysRespectCap(base::TimeDelta time_constraint, size_t cap) {
 }  // namespace
 
 bool DoesRespectCampaignCap(const CreativeAdInfo& creative_ad,
-                            const AdEventList& ad_events,
+                            const AdEventIndex& ad_event_index,
                             mojom::ConfirmationType mojom_confirmation_type,
                             base::TimeDelta time_constraint,
                             size_t cap) {
@@ -30,33 +29,22 @@ bool DoesRespectCampaignCap(const CreativeAdInfo& creative_ad,
     return true;
   }
 
-  const base::Time now = base::Time::Now();
-
-  const size_t count = count_if_until(
-      ad_events,
-      [&creative_ad, mojom_confirmation_type, now,
-       time_constraint](const AdEventInfo& ad_event) {
-        CHECK(ad_event.created_at);
-
-        return ad_event.confirmation_type == mojom_confirmation_type &&
-               ad_event.campaign_id == creative_ad.campaign_id &&
-               now - *ad_event.created_at < time_constraint;
-      },
-      cap);
-
-  return count < cap;
+  return ad_event_index.CountCampaignAdEvents(creative_ad.campaign_id,
+                                              mojom_confirmation_type,
+                                              time_constraint) < cap;
 }
 
 bool DoesRespectCampaignCap(const CreativeAdInfo& creative_ad,
-                            const AdEventList& ad_events,
+                            const AdEventIndex& ad_event_index,
                             mojom::ConfirmationType mojom_confirmation_type,
                             size_t cap) {
-  return DoesRespectCampaignCap(creative_ad, ad_events, mojom_confirmation_type,
+  return DoesRespectCampaignCap(creative_ad, ad_event_index,
+                                mojom_confirmation_type,
                                 base::TimeDelta::FiniteMax(), cap);
 }
 
 bool DoesRespectCreativeSetCap(const CreativeAdInfo& creative_ad,
-                               const AdEventList& ad_events,
+                               const AdEventIndex& ad_event_index,
                                mojom::ConfirmationType mojom_confirmation_type,
                                base::TimeDelta time_constraint,
                                size_t cap) {
@@ -64,34 +52,22 @@ bool DoesRespectCreativeSetCap(const CreativeAdInfo& creative_ad,
     return true;
   }
 
-  const base::Time now = base::Time::Now();
-
-  const size_t count = count_if_until(
-      ad_events,
-      [&creative_ad, mojom_confirmation_type, now,
-       time_constraint](const AdEventInfo& ad_event) {
-        CHECK(ad_event.created_at);
-
-        return ad_event.confirmation_type == mojom_confirmation_type &&
-               ad_event.creative_set_id == creative_ad.creative_set_id &&
-               now - *ad_event.created_at < time_constraint;
-      },
-      cap);
-
-  return count < cap;
+  return ad_event_index.CountCreativeSetAdEvents(creative_ad.creative_set_id,
+                                                 mojom_confirmation_type,
+                                                 time_constraint) < cap;
 }
 
 bool DoesRespectCreativeSetCap(const CreativeAdInfo& creative_ad,
-                               const AdEventList& ad_events,
+                               const AdEventIndex& ad_event_index,
                                mojom::ConfirmationType mojom_confirmation_type,
                                size_t cap) {
-  return DoesRespectCreativeSetCap(creative_ad, ad_events,
+  return DoesRespectCreativeSetCap(creative_ad, ad_event_index,
                                    mojom_confirmation_type,
                                    base::TimeDelta::FiniteMax(), cap);
 }
 
 bool DoesRespectCreativeCap(const CreativeAdInfo& creative_ad,
-                            const AdEventList& ad_events,
+                            const AdEventIndex& ad_event_index,
                             mojom::ConfirmationType mojom_confirmation_type,
                             base::TimeDelta time_constraint,
                             size_t cap) {
@@ -99,29 +75,17 @@ bool DoesRespectCreativeCap(const CreativeAdInfo& creative_ad,
     return true;
   }
 
-  const base::Time now = base::Time::Now();
-
-  const size_t count = count_if_until(
-      ad_events,
-      [&creative_ad, mojom_confirmation_type, now,
-       time_constraint](const AdEventInfo& ad_event) {
-        CHECK(ad_event.created_at);
-
-        return ad_event.confirmation_type == mojom_confirmation_type &&
-               ad_event.creative_instance_id ==
-                   creative_ad.creative_instance_id &&
-               now - *ad_event.created_at < time_constraint;
-      },
-      cap);
-
-  return count < cap;
+  return ad_event_index.CountCreativeInstanceAdEvents(
+             creative_ad.creative_instance_id, mojom_confirmation_type,
+             time_constraint) < cap;
 }
 
 bool DoesRespectCreativeCap(const CreativeAdInfo& creative_ad,
-                            const AdEventList& ad_events,
+                            const AdEventIndex& ad_event_index,
                             mojom::ConfirmationType mojom_confirmation_type,
                             size_t cap) {
-  return DoesRespectCreativeCap(creative_ad, ad_events, mojom_confirmation_type,
+  return DoesRespectCreativeCap(creative_ad, ad_event_index,
+                                mojom_confirmation_type,
                                 base::TimeDelta::FiniteMax(), cap);
 }
 
@@ -8,7 +8,6 @@
 
 #include <cstddef>
 
-#include "brave/components/brave_ads/core/internal/user_engagement/ad_events/ad_event_info.h"
 #include "brave/components/brave_ads/core/mojom/brave_ads.mojom-forward.h"
 
 namespace base {
@@ -17,35 +16,36 @@ class TimeDelta;
 
 namespace brave_ads {
 
+class AdEventIndex;
 struct CreativeAdInfo;
 
 bool DoesRespectCampaignCap(const CreativeAdInfo& creative_ad,
-                            const AdEventList& ad_events,
+                            const AdEventIndex& ad_event_index,
                             mojom::ConfirmationType mojom_confirmation_type,
                             base::TimeDelta time_constraint,
                             size_t cap);
 bool DoesRespectCampaignCap(const CreativeAdInfo& creative_ad,
-                            const AdEventList& ad_events,
+                            const AdEventIndex& ad_event_index,
                             mojom::ConfirmationType mojom_confirmation_type,
                             size_t cap);
 
 bool DoesRespectCreativeSetCap(const CreativeAdInfo& creative_ad,
-                               const AdEventList& ad_events,
+                               const AdEventIndex& ad_event_index,
                                mojom::ConfirmationType mojom_confirmation_type,
                                base::TimeDelta time_constraint,
                                size_t cap);
 bool DoesRespectCreativeSetCap(const CreativeAdInfo& creative_ad,
-                               const AdEventList& ad_events,
+                               const AdEventIndex& ad_event_index,
                                mojom::ConfirmationType mojom_confirmation_type,
                                size_t cap);
 
 bool DoesRespectCreativeCap(const CreativeAdInfo& creative_ad,
-                            const AdEventList& ad_events,
+                            const AdEventIndex& ad_event_index,
                             mojom::ConfirmationType mojom_confirmation_type,
                             base::TimeDelta time_constraint,
                             size_t cap);
 bool DoesRespectCreativeCap(const CreativeAdInfo& creative_ad,
-                            const AdEventList& ad_events,
+                            const AdEventIndex& ad_event_index,
                             mojom::ConfirmationType mojom_confirmation_type,
                             size_t cap);
 
@@ -6,7 +6,11 @@
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/exclusion_rules_base.h"
 
 #include <algorithm>
+#include <numeric>
+#include <string>
+#include <utility>
 
+#include "base/check_op.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/anti_targeting_exclusion_rule.h"
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/command_line_exclusion_rule.h"
@@ -28,6 +32,23 @@
 
 namespace brave_ads {
 
+namespace {
+
+// The number of creative ads between updates of the evaluation order.
+constexpr size_t kUpdateEvaluationOrderInterval = 16;
+
+// Returns the time spent by a rule for each creative ad it excluded, or the
+// maximum if it has not excluded any.
+base::TimeDelta GetDurationPerExclusion(
+    const ExclusionRulesBase::ExclusionRuleStats& stats) {
+  if (stats.exclusion_count == 0) {
+    return base::TimeDelta::Max();
+  }
+  return stats.duration / stats.exclusion_count;
+}
+
+}  // namespace
+
 ExclusionRulesBase::ExclusionRulesBase(
     const AdEventList& ad_events,
     const SubdivisionTargeting& subdivision_targeting,
@@ -81,13 +102,33 @@ bool ExclusionRulesBase::ShouldExcludeCreativeAd(
     return true;
   }
 
-  return std::ranges::any_of(exclusion_rules_, [&](const auto& exclusion_rule) {
-    if (!exclusion_rule->ShouldInclude(creative_ad)) {
-      Cache(exclusion_rule->GetCacheKey(creative_ad));
+  MaybeUpdateEvaluationOrder();
+
+  for (const size_t index : evaluation_order_) {
+    const auto& exclusion_rule = exclusion_rules_[index];
+    ExclusionRuleStats& stats = exclusion_rule_stats_[index];
+
+    std::string cache_key = exclusion_rule->GetCacheKey(creative_ad);
+    if (included_cache_[index].contains(cache_key)) {
+      ++stats.cache_hit_count;
+      continue;
+    }
+
+    const base::TimeTicks start_time = base::TimeTicks::Now();
+    const bool should_include = exclusion_rule->ShouldInclude(creative_ad);
+    stats.duration += base::TimeTicks::Now() - start_time;
+    ++stats.evaluation_count;
+
+    if (!should_include) {
+      ++stats.exclusion_count;
+      Cache(cache_key);
       return true;
     }
-    return false;
-  });
+
+    included_cache_[index].insert(std::move(cache_key));
+  }
+
+  return false;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -104,4 +145,26 @@ void ExclusionRulesBase::Cache(const std::string& key) {
   cache_.insert(key);
 }
 
+void ExclusionRulesBase::MaybeUpdateEvaluationOrder() {
+  // Subclasses add their rules after this class is constructed.
+  if (evaluation_order_.size() != exclusion_rules_.size()) {
+    CHECK_GT(exclusion_rules_.size(), evaluation_order_.size());
+    exclusion_rule_stats_.resize(exclusion_rules_.size());
+    included_cache_.resize(exclusion_rules_.size());
+    evaluation_order_.resize(exclusion_rules_.size());
+    std::iota(evaluation_order_.begin(), evaluation_order_.end(), 0);
+  }
+
+  ++creative_ad_count_;
+  if (creative_ad_count_ % kUpdateEvaluationOrderInterval != 0) {
+    return;
+  }
+
+  // Rules which have not excluded anything yet keep their relative order.
+  std::ranges::stable_sort(evaluation_order_, [this](size_t lhs, size_t rhs) {
+    return GetDurationPerExclusion(exclusion_rule_stats_[lhs]) <
+           GetDurationPerExclusion(exclusion_rule_stats_[rhs]);
+  });
+}
+
 }  // namespace brave_ads
@@ -6,11 +6,14 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_SERVING_ELIGIBLE_ADS_EXCLUSION_RULES_EXCLUSION_RULES_BASE_H_
 #define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_SERVING_ELIGIBLE_ADS_EXCLUSION_RULES_EXCLUSION_RULES_BASE_H_
 
+#include <cstddef>
 #include <memory>
 #include <set>
 #include <string>
 #include <vector>
 
+#include "base/time/time.h"
+
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/exclusion_rule_interface.h"
 #include "brave/components/brave_ads/core/internal/user_engagement/ad_events/ad_event_info.h"
 #include "brave/components/brave_ads/core/public/history/site_history.h"
@@ -30,6 +33,21 @@ class ExclusionRulesBase {
 
   virtual bool ShouldExcludeCreativeAd(const CreativeAdInfo& creative_ad);
 
+  struct ExclusionRuleStats final {
+    base::TimeDelta duration;
+    size_t evaluation_count = 0;
+    size_t exclusion_count = 0;
+    // The number of creative ads which were included without evaluating the
+    // rule, because another creative ad with the same cache key was.
+    size_t cache_hit_count = 0;
+  };
+
+  // Returns the stats of each exclusion rule, in the order the rules were
+  // added.
+  const std::vector<ExclusionRuleStats>& GetExclusionRuleStats() const {
+    return exclusion_rule_stats_;
+  }
+
  protected:
   ExclusionRulesBase(const AdEventList& ad_events,
                      const SubdivisionTargeting& subdivision_targeting,
@@ -43,7 +61,22 @@ class ExclusionRulesBase {
   bool IsCached(const CreativeAdInfo& creative_ad) const;
   void Cache(const std::string& key);
 
+  // Rules are evaluated cheapest per exclusion first, so creative ads which
+  // are excluded are rejected as early as possible. The order does not change
+  // the outcome, as a creative ad is excluded if any rule excludes it.
+  void MaybeUpdateEvaluationOrder();
+
   std::set</*key*/ std::string> cache_;
+
+  // Like |cache_| but for creative ads which were included, for each rule and
+  // indexed like |exclusion_rules_|. Rules only depend on the ids used for
+  // their cache key, so creative ads sharing a campaign or creative set are
+  // only evaluated once per rule.
+  std::vector<std::set</*key*/ std::string>> included_cache_;
+
+  std::vector<ExclusionRuleStats> exclusion_rule_stats_;
+  std::vector</*exclusion_rules_index*/ size_t> evaluation_order_;
+  size_t creative_ad_count_ = 0;
 };
 
 }  // namespace brave_ads
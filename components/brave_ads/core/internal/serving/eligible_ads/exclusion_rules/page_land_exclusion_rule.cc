@@ -5,8 +5,6 @@
 
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/page_land_exclusion_rule.h"
 
-#include <utility>
-
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/exclusion_rule_feature.h"
@@ -16,8 +14,8 @@
 
 namespace brave_ads {
 
-PageLandExclusionRule::PageLandExclusionRule(AdEventList ad_events)
-    : ad_events_(std::move(ad_events)) {}
+PageLandExclusionRule::PageLandExclusionRule(const AdEventList& ad_events)
+    : ad_event_index_(ad_events) {}
 
 PageLandExclusionRule::~PageLandExclusionRule() = default;
 
@@ -29,7 +27,7 @@ std::string PageLandExclusionRule::GetCacheKey(
 bool PageLandExclusionRule::ShouldInclude(
     const CreativeAdInfo& creative_ad) const {
   if (!DoesRespectCampaignCap(
-          creative_ad, ad_events_, mojom::ConfirmationType::kLanded,
+          creative_ad, ad_event_index_, mojom::ConfirmationType::kLanded,
           kShouldExcludeAdIfLandedOnPageWithinTimeWindow.Get(),
           kPageLandCap.Get())) {
     BLOG(1, "creativeSetId " << creative_ad.campaign_id
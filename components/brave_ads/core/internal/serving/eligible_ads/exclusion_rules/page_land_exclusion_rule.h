@@ -8,6 +8,7 @@
 
 #include <string>
 
+#include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/ad_event_index.h"
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/exclusion_rule_interface.h"
 #include "brave/components/brave_ads/core/internal/user_engagement/ad_events/ad_event_info.h"
 
@@ -18,7 +19,7 @@ struct CreativeAdInfo;
 class PageLandExclusionRule final
     : public ExclusionRuleInterface<CreativeAdInfo> {
  public:
-  explicit PageLandExclusionRule(AdEventList ad_events);
+  explicit PageLandExclusionRule(const AdEventList& ad_events);
 
   PageLandExclusionRule(const PageLandExclusionRule&) = delete;
   PageLandExclusionRule& operator=(const PageLandExclusionRule&) = delete;
@@ -30,7 +31,7 @@ class PageLandExclusionRule final
   bool ShouldInclude(const CreativeAdInfo& creative_ad) const override;
 
  private:
-  AdEventList ad_events_;
+  const AdEventIndex ad_event_index_;
 };
 
 }  // namespace brave_ads
@@ -5,16 +5,14 @@
 
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/per_day_exclusion_rule.h"
 
-#include <utility>
-
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/exclusion_rule_util.h"
 
 namespace brave_ads {
 
-PerDayExclusionRule::PerDayExclusionRule(AdEventList ad_events)
-    : ad_events_(std::move(ad_events)) {}
+PerDayExclusionRule::PerDayExclusionRule(const AdEventList& ad_events)
+    : ad_event_index_(ad_events) {}
 
 PerDayExclusionRule::~PerDayExclusionRule() = default;
 
@@ -26,7 +24,8 @@ std::string PerDayExclusionRule::GetCacheKey(
 bool PerDayExclusionRule::ShouldInclude(
     const CreativeAdInfo& creative_ad) const {
   if (!DoesRespectCreativeSetCap(
-          creative_ad, ad_events_, mojom::ConfirmationType::kServedImpression,
+          creative_ad, ad_event_index_,
+          mojom::ConfirmationType::kServedImpression,
           /*time_constraint=*/base::Days(1), creative_ad.per_day)) {
     BLOG(1, "creativeSetId " << creative_ad.creative_set_id
                              << " has exceeded the perDay frequency cap");
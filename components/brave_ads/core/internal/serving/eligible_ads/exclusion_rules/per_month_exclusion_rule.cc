@@ -5,8 +5,6 @@
 
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/per_month_exclusion_rule.h"
 
-#include <utility>
-
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/exclusion_rule_util.h"
@@ -14,8 +12,8 @@
 
 namespace brave_ads {
 
-PerMonthExclusionRule::PerMonthExclusionRule(AdEventList ad_events)
-    : ad_events_(std::move(ad_events)) {}
+PerMonthExclusionRule::PerMonthExclusionRule(const AdEventList& ad_events)
+    : ad_event_index_(ad_events) {}
 
 PerMonthExclusionRule::~PerMonthExclusionRule() = default;
 
@@ -27,7 +25,8 @@ std::string PerMonthExclusionRule::GetCacheKey(
 bool PerMonthExclusionRule::ShouldInclude(
     const CreativeAdInfo& creative_ad) const {
   if (!DoesRespectCreativeSetCap(
-          creative_ad, ad_events_, mojom::ConfirmationType::kServedImpression,
+          creative_ad, ad_event_index_,
+          mojom::ConfirmationType::kServedImpression,
           /*time_constraint=*/base::Days(28), creative_ad.per_month)) {
     BLOG(1, "creativeSetId " << creative_ad.creative_set_id
                              << " has exceeded the perMonth frequency cap");
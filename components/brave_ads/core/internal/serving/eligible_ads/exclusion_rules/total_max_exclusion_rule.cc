@@ -5,41 +5,35 @@
 
 #include "brave/components/brave_ads/core/internal/serving/eligible_ads/exclusion_rules/total_max_exclusion_rule.h"
 
-#include <utility>
+#include <cstddef>
 
+#include "base/time/time.h"
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
+#include "brave/components/brave_ads/core/mojom/brave_ads.mojom.h"
 
 namespace brave_ads {
 
 namespace {
 
-bool DoesRespectCap(const AdEventList& ad_events,
+bool DoesRespectCap(const AdEventIndex& ad_event_index,
                     const CreativeAdInfo& creative_ad) {
   if (creative_ad.total_max == 0) {
     // Always respect cap if set to 0.
     return true;
   }
 
-  int count = 0;
-  for (const auto& ad_event : ad_events) {
-    if (ad_event.confirmation_type ==
-            mojom::ConfirmationType::kServedImpression &&
-        ad_event.creative_set_id == creative_ad.creative_set_id) {
-      ++count;
-      if (count >= creative_ad.total_max) {
-        return false;
-      }
-    }
-  }
-
-  return true;
+  return ad_event_index.CountCreativeSetAdEvents(
+             creative_ad.creative_set_id,
+             mojom::ConfirmationType::kServedImpression,
+             base::TimeDelta::Max()) <
+         static_cast<size_t>(creative_ad.total_max);
 }
 
 }  // namespace
 
-TotalMaxExclusionRule::TotalMaxExclusionRule(AdEventList ad_events)
-    : ad_events_(std::move(ad_events)) {}
+TotalMaxExclusionRule::TotalMaxExclusionRule(const AdEventList& ad_events)
+    : ad_event_index_(ad_events) {}
 
 TotalMaxExclusionRule::~TotalMaxExclusionRule() = default;
 
@@ -50,7 +44,7 @@ std::string TotalMaxExclusionRule::GetCacheKey(
 
 bool TotalMaxExclusionRule::ShouldInclude(
     const CreativeAdInfo& creative_ad) const {
-  if (!DoesRespectCap(ad_events_, creative_ad)) {
+  if (!DoesRespectCap(ad_event_index_, creative_ad)) {
     BLOG(1, "creativeSetId " << creative_ad.creative_set_id
                              << " has exceeded the totalMax frequency cap");
     return false;
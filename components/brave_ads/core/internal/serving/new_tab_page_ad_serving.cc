@@ -5,8 +5,12 @@
 
 #include "brave/components/brave_ads/core/internal/serving/new_tab_page_ad_serving.h"
 
+#include <memory>
+#include <optional>
 #include <utility>
 
+#include "base/barrier_closure.h"
+#include "base/check.h"
 #include "base/functional/bind.h"
 #include "base/trace_event/trace_event.h"
 #include "base/trace_event/trace_id_helper.h"
@@ -28,6 +32,36 @@
 
 namespace brave_ads {
 
+namespace {
+
+void GetAdEventsCallback(std::optional<AdEventList>* const ad_events,
+                         base::OnceClosure barrier_closure,
+                         bool success,
+                         const AdEventList& result) {
+  CHECK(ad_events);
+
+  if (success) {
+    *ad_events = result;
+  }
+  std::move(barrier_closure).Run();
+}
+
+void BuildUserModelCallback(UserModelInfo* const user_model,
+                            base::OnceClosure barrier_closure,
+                            uint64_t trace_id,
+                            UserModelInfo result) {
+  CHECK(user_model);
+
+  TRACE_EVENT_NESTABLE_ASYNC_END0(
+      kTraceEventCategory, "NewTabPageAdServing::GetUserModel",
+      TRACE_ID_WITH_SCOPE("NewTabPageAdServing", trace_id));
+
+  *user_model = std::move(result);
+  std::move(barrier_closure).Run();
+}
+
+}  // namespace
+
 NewTabPageAdServing::NewTabPageAdServing(
     const SubdivisionTargeting& subdivision_targeting,
     const AntiTargetingResource& anti_targeting_resource) {
@@ -42,7 +76,7 @@ NewTabPageAdServing::~NewTabPageAdServing() {
 
 void NewTabPageAdServing::MaybeServeAd(
     MaybeServeNewTabPageAdCallback callback) {
-  GetAdEvents(std::move(callback));
+  GetAdEventsAndUserModel(std::move(callback));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -66,55 +100,57 @@ bool NewTabPageAdServing::CanServeAd(const AdEventList& ad_events) const {
   return true;
 }
 
-void NewTabPageAdServing::GetAdEvents(MaybeServeNewTabPageAdCallback callback) {
+void NewTabPageAdServing::GetAdEventsAndUserModel(
+    MaybeServeNewTabPageAdCallback callback) {
+  // The ad events and the user model do not depend on each other, so they are
+  // fetched concurrently to reduce the time it takes to serve an ad.
+  auto ad_events = std::make_unique<std::optional<AdEventList>>();
+  std::optional<AdEventList>* const ad_events_ptr = ad_events.get();
+
+  auto user_model = std::make_unique<UserModelInfo>();
+  UserModelInfo* const user_model_ptr = user_model.get();
+
+  auto barrier_closure = base::BarrierClosure(
+      /*num_closures=*/2,
+      base::BindOnce(&NewTabPageAdServing::GetAdEventsAndUserModelCallback,
+                     weak_factory_.GetWeakPtr(), std::move(callback),
+                     std::move(ad_events), std::move(user_model)));
+
   const database::table::AdEvents database_table;
   database_table.Get(
       mojom::AdType::kNewTabPageAd, mojom::ConfirmationType::kServedImpression,
       /*time_window=*/base::Days(1),
-      base::BindOnce(&NewTabPageAdServing::GetAdEventsCallback,
-                     weak_factory_.GetWeakPtr(), std::move(callback)));
+      base::BindOnce(&GetAdEventsCallback, ad_events_ptr, barrier_closure));
+
+  const uint64_t trace_id = base::trace_event::GetNextGlobalTraceId();
+  TRACE_EVENT_NESTABLE_ASYNC_BEGIN0(
+      kTraceEventCategory, "NewTabPageAdServing::GetUserModel",
+      TRACE_ID_WITH_SCOPE("NewTabPageAdServing", trace_id));
+
+  BuildUserModel(base::BindOnce(&BuildUserModelCallback, user_model_ptr,
+                                barrier_closure, trace_id));
 }
 
-void NewTabPageAdServing::GetAdEventsCallback(
+void NewTabPageAdServing::GetAdEventsAndUserModelCallback(
     MaybeServeNewTabPageAdCallback callback,
-    bool success,
-    const AdEventList& ad_events) {
-  if (!success) {
+    std::unique_ptr<std::optional<AdEventList>> ad_events,
+    std::unique_ptr<UserModelInfo> user_model) {
+  CHECK(ad_events);
+  CHECK(user_model);
+
+  if (!*ad_events) {
     BLOG(0, "New tab page ad not served: Failed to get ad events");
     return FailedToServeAd(std::move(callback));
   }
 
-  if (!CanServeAd(ad_events)) {
+  if (!CanServeAd(**ad_events)) {
     BLOG(1, "New tab page ad not served: Not allowed");
     return FailedToServeAd(std::move(callback));
   }
 
-  GetUserModel(std::move(callback));
-}
-
-void NewTabPageAdServing::GetUserModel(
-    MaybeServeNewTabPageAdCallback callback) {
-  const uint64_t trace_id = base::trace_event::GetNextGlobalTraceId();
-  TRACE_EVENT_NESTABLE_ASYNC_BEGIN0(
-      kTraceEventCategory, "NewTabPageAdServing::GetUserModel",
-      TRACE_ID_WITH_SCOPE("NewTabPageAdServing", trace_id));
-
-  BuildUserModel(base::BindOnce(&NewTabPageAdServing::GetUserModelCallback,
-                                weak_factory_.GetWeakPtr(), std::move(callback),
-                                trace_id));
-}
-
-void NewTabPageAdServing::GetUserModelCallback(
-    MaybeServeNewTabPageAdCallback callback,
-    uint64_t trace_id,
-    UserModelInfo user_model) const {
-  TRACE_EVENT_NESTABLE_ASYNC_END0(
-      kTraceEventCategory, "NewTabPageAdServing::GetUserModel",
-      TRACE_ID_WITH_SCOPE("NewTabPageAdServing", trace_id));
-
   NotifyOpportunityAroseToServeNewTabPageAd();
 
-  GetEligibleAds(std::move(callback), std::move(user_model));
+  GetEligibleAds(std::move(callback), std::move(*user_model));
 }
 
 void NewTabPageAdServing::GetEligibleAds(
@@ -8,6 +8,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 
 #include "base/check_op.h"
 #include "base/memory/raw_ptr.h"
@@ -47,15 +48,11 @@ class NewTabPageAdServing final {
 
   bool CanServeAd(const AdEventList& ad_events) const;
 
-  void GetAdEvents(MaybeServeNewTabPageAdCallback callback);
-  void GetAdEventsCallback(MaybeServeNewTabPageAdCallback callback,
-                           bool success,
-                           const AdEventList& ad_events);
-
-  void GetUserModel(MaybeServeNewTabPageAdCallback callback);
-  void GetUserModelCallback(MaybeServeNewTabPageAdCallback callback,
-                            uint64_t trace_id,
-                            UserModelInfo user_model) const;
+  void GetAdEventsAndUserModel(MaybeServeNewTabPageAdCallback callback);
+  void GetAdEventsAndUserModelCallback(
+      MaybeServeNewTabPageAdCallback callback,
+      std::unique_ptr<std::optional<AdEventList>> ad_events,
+      std::unique_ptr<UserModelInfo> user_model);
 
   void GetEligibleAds(MaybeServeNewTabPageAdCallback callback,
                       UserModelInfo user_model) const;
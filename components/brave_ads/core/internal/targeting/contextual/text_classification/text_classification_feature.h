@@ -20,6 +20,12 @@ inline constexpr base::FeatureParam<size_t>
     kTextClassificationPageProbabilitiesHistorySize{
         &kTextClassificationFeature, "page_probabilities_history_size", 15};
 
+// Set to `true` to reuse the page probabilities when the same text is processed
+// again, i.e. after a reload, instead of classifying it again.
+inline constexpr base::FeatureParam<bool>
+    kShouldReuseTextClassificationForUnchangedText{
+        &kTextClassificationFeature, "should_reuse_for_unchanged_text", false};
+
 }  // namespace brave_ads
 
 #endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_TARGETING_CONTEXTUAL_TEXT_CLASSIFICATION_TEXT_CLASSIFICATION_FEATURE_H_
@@ -17,6 +17,7 @@
 #include "brave/components/brave_ads/core/internal/deprecated/client/client_state_manager.h"
 #include "brave/components/brave_ads/core/internal/tabs/tab_manager.h"
 #include "brave/components/brave_ads/core/internal/targeting/contextual/text_classification/resource/text_classification_resource.h"
+#include "brave/components/brave_ads/core/internal/targeting/contextual/text_classification/text_classification_feature.h"
 #include "brave/components/brave_ads/core/public/ads_constants.h"
 #include "url/gurl.h"
 
@@ -49,20 +50,29 @@ TextClassificationProcessor::~TextClassificationProcessor() {
 }
 
 void TextClassificationProcessor::Process(const std::string& text) {
-  if (resource_->IsLoaded()) {
-    const uint64_t trace_id = base::trace_event::GetNextGlobalTraceId();
-    TRACE_EVENT_NESTABLE_ASYNC_BEGIN0(
-        kTraceEventCategory, "TextClassificationProcessor::Process",
-        TRACE_ID_WITH_SCOPE("TextClassificationProcessor", trace_id));
-
-    resource_->ClassifyPage(
-        text, base::BindOnce(&TextClassificationProcessor::ClassifyPageCallback,
-                             weak_factory_.GetWeakPtr(), trace_id));
+  if (!resource_->IsLoaded()) {
+    return;
   }
+
+  if (kShouldReuseTextClassificationForUnchangedText.Get() &&
+      !last_probabilities_.empty() && text == last_classified_text_) {
+    BLOG(1, "Reusing text classification for unchanged text");
+    return SuccessfullyClassifiedPage(last_probabilities_);
+  }
+
+  const uint64_t trace_id = base::trace_event::GetNextGlobalTraceId();
+  TRACE_EVENT_NESTABLE_ASYNC_BEGIN0(
+      kTraceEventCategory, "TextClassificationProcessor::Process",
+      TRACE_ID_WITH_SCOPE("TextClassificationProcessor", trace_id));
+
+  resource_->ClassifyPage(
+      text, base::BindOnce(&TextClassificationProcessor::ClassifyPageCallback,
+                           weak_factory_.GetWeakPtr(), trace_id, text));
 }
 
 void TextClassificationProcessor::ClassifyPageCallback(
     uint64_t trace_id,
+    const std::string& text,
     base::optional_ref<const TextClassificationProbabilityMap> probabilities) {
   TRACE_EVENT_NESTABLE_ASYNC_END0(
       kTraceEventCategory, "TextClassificationProcessor::Process",
@@ -76,13 +86,23 @@ void TextClassificationProcessor::ClassifyPageCallback(
     return BLOG(1, "Text not classified as not enough content");
   }
 
+  if (kShouldReuseTextClassificationForUnchangedText.Get()) {
+    last_classified_text_ = text;
+    last_probabilities_ = *probabilities;
+  }
+
+  SuccessfullyClassifiedPage(*probabilities);
+}
+
+void TextClassificationProcessor::SuccessfullyClassifiedPage(
+    const TextClassificationProbabilityMap& probabilities) {
   const std::string top_segment =
-      GetTopSegmentFromPageProbabilities(*probabilities);
+      GetTopSegmentFromPageProbabilities(probabilities);
   CHECK(!top_segment.empty());
   BLOG(1, "Classified text with the top segment as " << top_segment);
 
   ClientStateManager::GetInstance()
-      .AppendTextClassificationProbabilitiesToHistory(*probabilities);
+      .AppendTextClassificationProbabilitiesToHistory(probabilities);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
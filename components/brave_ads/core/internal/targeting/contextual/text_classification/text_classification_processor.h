@@ -37,8 +37,12 @@ class TextClassificationProcessor final : public TabManagerObserver {
  private:
   void ClassifyPageCallback(
       uint64_t trace_id,
+      const std::string& text,
       base::optional_ref<const TextClassificationProbabilityMap> probabilities);
 
+  void SuccessfullyClassifiedPage(
+      const TextClassificationProbabilityMap& probabilities);
+
   // TabManagerObserver:
   void OnTextContentDidChange(int32_t tab_id,
                               const std::vector<GURL>& redirect_chain,
@@ -46,6 +50,10 @@ class TextClassificationProcessor final : public TabManagerObserver {
 
   const raw_ref<TextClassificationResource> resource_;
 
+  // The last successfully classified text and its page probabilities.
+  std::string last_classified_text_;
+  TextClassificationProbabilityMap last_probabilities_;
+
   base::WeakPtrFactory<TextClassificationProcessor> weak_factory_{this};
 };
 
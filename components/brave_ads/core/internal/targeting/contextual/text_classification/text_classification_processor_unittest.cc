@@ -7,11 +7,13 @@
 
 #include <memory>
 
+#include "base/test/scoped_feature_list.h"
 #include "brave/components/brave_ads/core/internal/common/resources/language_components_test_constants.h"
 #include "brave/components/brave_ads/core/internal/common/test/test_base.h"
 #include "brave/components/brave_ads/core/internal/deprecated/client/client_state_manager.h"
 #include "brave/components/brave_ads/core/internal/targeting/contextual/text_classification/model/text_classification_alias.h"
 #include "brave/components/brave_ads/core/internal/targeting/contextual/text_classification/resource/text_classification_resource.h"
+#include "brave/components/brave_ads/core/internal/targeting/contextual/text_classification/text_classification_feature.h"
 
 // npm run test -- brave_unit_tests --filter=BraveAds*
 
@@ -116,4 +118,32 @@ TEST_F(BraveAdsTextClassificationProcessorTest, ProcessMultipleText) {
   EXPECT_THAT(text_classification_probabilities, ::testing::SizeIs(3));
 }
 
+TEST_F(BraveAdsTextClassificationProcessorTest,
+       ReuseTextClassificationForUnchangedText) {
+  // Arrange
+  base::test::ScopedFeatureList scoped_feature_list;
+  scoped_feature_list.InitAndEnableFeatureWithParameters(
+      kTextClassificationFeature,
+      {{"should_reuse_for_unchanged_text", "true"}});
+
+  NotifyResourceComponentDidChange(test::kLanguageComponentManifestVersion,
+                                   test::kLanguageComponentId);
+  ASSERT_TRUE(resource_->IsLoaded());
+
+  TextClassificationProcessor processor(*resource_);
+  processor.Process(/*text=*/"Some content about technology & computing");
+  task_environment_.RunUntilIdle();
+
+  // Act
+  processor.Process(/*text=*/"Some content about technology & computing");
+
+  // Assert
+  const TextClassificationProbabilityList& text_classification_probabilities =
+      ClientStateManager::GetInstance()
+          .GetTextClassificationProbabilitiesHistory();
+  ASSERT_THAT(text_classification_probabilities, ::testing::SizeIs(2));
+  EXPECT_EQ(text_classification_probabilities.front(),
+            text_classification_probabilities.back());
+}
+
 }  // namespace brave_ads
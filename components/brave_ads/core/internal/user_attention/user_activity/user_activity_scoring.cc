@@ -6,12 +6,10 @@
 #include "brave/components/brave_ads/core/internal/user_attention/user_activity/user_activity_scoring.h"
 
 #include <algorithm>
-#include <iterator>
+#include <cstdint>
 #include <string>
-#include <vector>
 
 #include "base/strings/string_number_conversions.h"
-#include "base/strings/string_util.h"
 
 namespace brave_ads {
 
@@ -30,30 +28,27 @@ UserActivityTriggerList SortTriggers(const UserActivityTriggerList& triggers) {
 }
 
 std::string EncodeEvents(const UserActivityEventList& events) {
-  std::vector<UserActivityEventType> eligible_events;
-  eligible_events.reserve(events.size());
+  // Each event type is a single byte encoded as two uppercase hex characters.
+  std::string encoded_events;
+  encoded_events.reserve(events.size() * 2);
 
-  std::transform(events.cbegin(), events.cend(),
-                 std::back_inserter(eligible_events),
-                 [](const auto& event) { return event.type; });
-
-  const std::string encoded_eligible_events =
-      base::HexEncode(eligible_events.data(), eligible_events.size());
+  for (const auto& event : events) {
+    base::AppendHexEncodedByte(static_cast<uint8_t>(event.type),
+                               encoded_events);
+  }
 
-  return base::ToUpperASCII(encoded_eligible_events);
+  return encoded_events;
 }
 
 double CalculateScore(const UserActivityTriggerList& triggers,
-                      const std::string& events) {
-  std::string mutable_events(events);
-
+                      std::string events) {
   double score = 0.0;
 
   for (const auto& trigger : triggers) {
     std::string::size_type pos = 0;
 
     for (;;) {
-      pos = mutable_events.find(trigger.event_sequence, pos);
+      pos = events.find(trigger.event_sequence, pos);
       if (pos == std::string::npos) {
         break;
       }
@@ -64,7 +59,7 @@ double CalculateScore(const UserActivityTriggerList& triggers,
         continue;
       }
 
-      mutable_events.erase(pos, trigger.event_sequence.length());
+      events.erase(pos, trigger.event_sequence.length());
       score += trigger.score;
     }
   }
@@ -82,9 +77,7 @@ double GetUserActivityScore(const UserActivityTriggerList& triggers,
 
   const UserActivityTriggerList sorted_triggers = SortTriggers(triggers);
 
-  const std::string encoded_events = EncodeEvents(events);
-
-  return CalculateScore(sorted_triggers, encoded_events);
+  return CalculateScore(sorted_triggers, EncodeEvents(events));
 }
 
 }  // namespace brave_ads
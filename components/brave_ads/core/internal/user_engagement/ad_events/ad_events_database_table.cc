@@ -5,16 +5,20 @@
 
 #include "brave/components/brave_ads/core/internal/user_engagement/ad_events/ad_events_database_table.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "base/check.h"
 #include "base/functional/bind.h"
 #include "base/location.h"
 #include "base/strings/string_util.h"
 #include "base/time/time.h"
+#include "brave/components/brave_ads/core/internal/common/algorithm/split_vector_util.h"
 #include "brave/components/brave_ads/core/internal/common/database/database_column_util.h"
 #include "brave/components/brave_ads/core/internal/common/database/database_statement_util.h"
 #include "brave/components/brave_ads/core/internal/common/database/database_table_util.h"
@@ -32,6 +36,8 @@ namespace {
 
 constexpr char kTableName[] = "ad_events";
 
+constexpr int kDefaultBatchSize = 50;
+
 void BindColumnTypes(const mojom::DBActionInfoPtr& mojom_db_action) {
   CHECK(mojom_db_action);
 
@@ -245,17 +251,39 @@ void MigrateToV51(const mojom::DBTransactionInfoPtr& mojom_db_transaction) {
 
 }  // namespace
 
+AdEvents::AdEvents() : batch_size_(kDefaultBatchSize) {}
+
 void AdEvents::RecordEvent(const AdEventInfo& ad_event,
                            ResultCallback callback) {
-  if (!ad_event.IsValid()) {
-    BLOG(0, "Invalid ad event");
+  RecordEvents({ad_event}, std::move(callback));
+}
+
+void AdEvents::RecordEvents(const AdEventList& ad_events,
+                            ResultCallback callback) {
+  AdEventList filtered_ad_events;
+  std::copy_if(ad_events.cbegin(), ad_events.cend(),
+               std::back_inserter(filtered_ad_events),
+               [](const AdEventInfo& ad_event) {
+                 const bool is_valid = ad_event.IsValid();
+                 if (!is_valid) {
+                   BLOG(0, "Invalid ad event");
+                 }
+
+                 return is_valid;
+               });
+  if (filtered_ad_events.empty()) {
     return std::move(callback).Run(/*success=*/true);
   }
 
   mojom::DBTransactionInfoPtr mojom_db_transaction =
       mojom::DBTransactionInfo::New();
 
-  Insert(mojom_db_transaction, {ad_event});
+  const std::vector<AdEventList> batches =
+      SplitVector(filtered_ad_events, batch_size_);
+
+  for (const auto& batch : batches) {
+    Insert(mojom_db_transaction, batch);
+  }
 
   RunTransaction(FROM_HERE, std::move(mojom_db_transaction),
                  std::move(callback));
@@ -560,42 +588,37 @@ void AdEvents::PurgeExpired(ResultCallback callback) const {
   mojom::DBTransactionInfoPtr mojom_db_transaction =
       mojom::DBTransactionInfo::New();
 
-  size_t days;
+  const base::Time now = base::Time::Now();
 
   // Non-new tab page ads.
-  days = UserHasJoinedBraveRewards() ? 90 : 30;
-  Execute(mojom_db_transaction, R"(
-            DELETE FROM
-              $1
-            WHERE
-              creative_set_id NOT IN (
-                SELECT
-                  creative_set_id
-                FROM
-                  creative_set_conversions
-              )
-              AND type != 'new_tab_page_ad'
-              AND created_at <= $2)",
-          {GetTableName(),
-           TimeToSqlValueAsString(base::Time::Now() - base::Days(days))});
+  const size_t days = UserHasJoinedBraveRewards() ? 90 : 30;
 
   // New tab page ads.
-  days =
+  const size_t new_tab_page_ad_days =
       UserHasJoinedBraveRewards() || UserHasOptedInToSurveyPanelist() ? 90 : 2;
+
+  // Purge both kinds of ad events in a single pass so the conversions subquery
+  // and the `created_at` index are only walked once.
   Execute(mojom_db_transaction, R"(
             DELETE FROM
               $1
             WHERE
-              creative_set_id NOT IN (
+              created_at <= $2
+              AND creative_set_id NOT IN (
                 SELECT
                   creative_set_id
                 FROM
                   creative_set_conversions
               )
-              AND type == 'new_tab_page_ad'
-              AND created_at <= $2)",
+              AND created_at <= CASE type
+                WHEN 'new_tab_page_ad' THEN $3
+                ELSE $4
+              END)",
           {GetTableName(),
-           TimeToSqlValueAsString(base::Time::Now() - base::Days(days))});
+           TimeToSqlValueAsString(
+               now - base::Days(std::min(days, new_tab_page_ad_days))),
+           TimeToSqlValueAsString(now - base::Days(new_tab_page_ad_days)),
+           TimeToSqlValueAsString(now - base::Days(days))});
 
   RunTransaction(FROM_HERE, std::move(mojom_db_transaction),
                  std::move(callback));
@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 
+#include "base/check_op.h"
 #include "base/containers/flat_set.h"
 #include "base/functional/callback.h"
 #include "base/values.h"
@@ -33,8 +34,14 @@ using GetAdEventVirtualPrefsCallback =
 
 class AdEvents final : public TableInterface {
  public:
+  AdEvents();
+
   void RecordEvent(const AdEventInfo& ad_event, ResultCallback callback);
 
+  // Records `ad_events` in a single transaction using multi-row inserts of up
+  // to `batch_size_` rows. Invalid ad events are skipped.
+  void RecordEvents(const AdEventList& ad_events, ResultCallback callback);
+
   // Should be called after recording the ad event. The callback takes two
   // arguments - `success` is set to `true` if successful otherwise `false`.
   // `is_first_time` is set to `true` if the ad event has only one entry
@@ -66,6 +73,12 @@ class AdEvents final : public TableInterface {
                      ResultCallback callback) const;
   void PurgeAllOrphaned(ResultCallback callback) const;
 
+  void SetBatchSize(int batch_size) {
+    CHECK_GT(batch_size, 0);
+
+    batch_size_ = batch_size;
+  }
+
   std::string GetTableName() const override;
   void Create(const mojom::DBTransactionInfoPtr& mojom_db_transaction) override;
   void Migrate(const mojom::DBTransactionInfoPtr& mojom_db_transaction,
@@ -77,6 +90,8 @@ class AdEvents final : public TableInterface {
 
   std::string BuildInsertSql(const mojom::DBActionInfoPtr& mojom_db_action,
                              const AdEventList& ad_events) const;
+
+  int batch_size_;
 };
 
 }  // namespace brave_ads::database::table
@@ -56,6 +56,36 @@ TEST_F(BraveAdsAdEventsDatabaseTableTest, RecordEvent) {
   run_loop.Run();
 }
 
+TEST_F(BraveAdsAdEventsDatabaseTableTest, RecordEventsInBatches) {
+  // Arrange
+  database_table_.SetBatchSize(2);
+
+  const NotificationAdInfo ad =
+      test::BuildNotificationAd(/*should_generate_random_uuids=*/true);
+  const AdEventList ad_events = {
+      BuildAdEvent(ad, mojom::ConfirmationType::kServedImpression,
+                   /*created_at=*/test::Now()),
+      BuildAdEvent(ad, mojom::ConfirmationType::kViewedImpression,
+                   /*created_at=*/test::Now()),
+      BuildAdEvent(ad, mojom::ConfirmationType::kClicked,
+                   /*created_at=*/test::Now())};
+
+  base::MockCallback<ResultCallback> record_ad_events_callback;
+  EXPECT_CALL(record_ad_events_callback, Run(/*success=*/true));
+
+  // Act
+  database_table_.RecordEvents(ad_events, record_ad_events_callback.Get());
+
+  // Assert
+  base::MockCallback<database::table::GetAdEventsCallback> callback;
+  base::RunLoop run_loop;
+  EXPECT_CALL(callback, Run(/*success=*/true,
+                            ::testing::UnorderedElementsAreArray(ad_events)))
+      .WillOnce(base::test::RunOnceClosure(run_loop.QuitClosure()));
+  database_table_.GetAll(callback.Get());
+  run_loop.Run();
+}
+
 TEST_F(BraveAdsAdEventsDatabaseTableTest, IsFirstTime) {
   // Arrange
   AdvanceClockTo(test::TimeFromUTCString("Tue, 19 Mar 2024 05:35"));
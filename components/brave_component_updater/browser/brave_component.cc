@@ -10,6 +10,7 @@
 #include "base/check.h"
 #include "base/functional/bind.h"
 #include "base/logging.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/task/sequenced_task_runner.h"
 
 namespace brave_component_updater {
@@ -27,6 +28,7 @@ void BraveComponent::Register(const std::string& component_name,
   component_name_ = component_name;
   component_id_ = component_id;
   component_base64_public_key_ = component_base64_public_key;
+  register_time_ = base::TimeTicks::Now();
 
   auto registered_callback =
       base::BindOnce(&BraveComponent::OnComponentRegistered,
@@ -67,6 +69,15 @@ void BraveComponent::OnComponentReadyInternal(
     const base::FilePath& install_dir,
     const std::string& manifest) {
   VLOG(2) << "component ready: " << manifest;
+  if (!register_time_.is_null()) {
+    const base::TimeDelta time_to_ready =
+        base::TimeTicks::Now() - register_time_;
+    register_time_ = base::TimeTicks();
+    VLOG(1) << "component " << component_name_
+            << " ready after: " << time_to_ready;
+    base::UmaHistogramMediumTimes("Brave.ComponentUpdater.TimeToReady",
+                                  time_to_ready);
+  }
   OnComponentReady(component_id, install_dir, manifest);
 }
 
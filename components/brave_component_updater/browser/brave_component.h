@@ -14,6 +14,7 @@
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/task/sequenced_task_runner.h"
+#include "base/time/time.h"
 #include "components/update_client/update_client.h"
 
 class PrefService;
@@ -101,6 +102,9 @@ class COMPONENT_EXPORT(BRAVE_COMPONENT_UPDATER) BraveComponent {
   std::string component_name_;
   std::string component_id_;
   std::string component_base64_public_key_;
+  // Set on Register() and cleared once the component is first ready, to
+  // measure time-to-ready at startup.
+  base::TimeTicks register_time_;
   raw_ptr<Delegate, DanglingUntriaged> delegate_ = nullptr;  // NOT OWNED
   base::WeakPtrFactory<BraveComponent> weak_factory_;
 };
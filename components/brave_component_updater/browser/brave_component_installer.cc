@@ -33,6 +33,13 @@ bool RewriteManifestFile(const base::FilePath& extension_root,
   // Add the public key
   DCHECK(!public_key.empty());
 
+  // Already rewritten on a previous run. This runs for every installed
+  // component on each startup, so avoid writing the same file again.
+  if (const std::string* key = manifest.FindString("key");
+      key && *key == public_key) {
+    return true;
+  }
+
   base::Value::Dict final_manifest = manifest.Clone();
   final_manifest.Set("key", public_key);
 
@@ -0,0 +1,72 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_component_updater/browser/host_set.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/check_op.h"
+#include "base/numerics/safe_conversions.h"
+#include "base/strings/string_split.h"
+
+namespace brave_component_updater {
+
+HostSet::HostSet() = default;
+
+HostSet::HostSet(std::vector<std::string> hosts) {
+  std::ranges::sort(hosts);
+  auto duplicates = std::ranges::unique(hosts);
+  hosts.erase(duplicates.begin(), duplicates.end());
+
+  size_t total_size = 0;
+  for (const auto& host : hosts) {
+    total_size += host.size();
+  }
+  buffer_.reserve(total_size);
+  entries_.reserve(hosts.size());
+  for (const auto& host : hosts) {
+    entries_.emplace_back(base::checked_cast<uint32_t>(buffer_.size()),
+                          base::checked_cast<uint32_t>(host.size()));
+    buffer_.append(host);
+  }
+  DCHECK_EQ(buffer_.size(), total_size);
+}
+
+HostSet::HostSet(HostSet&&) = default;
+
+HostSet& HostSet::operator=(HostSet&&) = default;
+
+HostSet::~HostSet() = default;
+
+// static
+HostSet HostSet::FromLines(std::string_view contents) {
+  return HostSet(base::SplitString(contents, "\n", base::TRIM_WHITESPACE,
+                                   base::SPLIT_WANT_NONEMPTY));
+}
+
+bool HostSet::Contains(std::string_view host) const {
+  auto it = std::ranges::lower_bound(
+      entries_, host, {},
+      [this](const Entry& entry) { return GetHost(entry); });
+  return it != entries_.end() && GetHost(*it) == host;
+}
+
+std::vector<std::string> HostSet::GetHostsForTesting() const {
+  std::vector<std::string> hosts;
+  hosts.reserve(entries_.size());
+  for (const auto& entry : entries_) {
+    hosts.emplace_back(GetHost(entry));
+  }
+  return hosts;
+}
+
+std::string_view HostSet::GetHost(const Entry& entry) const {
+  return std::string_view(buffer_).substr(entry.first, entry.second);
+}
+
+}  // namespace brave_component_updater
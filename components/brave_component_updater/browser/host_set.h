@@ -0,0 +1,61 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_COMPONENT_UPDATER_BROWSER_HOST_SET_H_
+#define BRAVE_COMPONENTS_BRAVE_COMPONENT_UPDATER_BROWSER_HOST_SET_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "base/component_export.h"
+
+namespace brave_component_updater {
+
+// An immutable set of host names compiled from component data.
+//
+// All hosts are stored back to back in one buffer, with a sorted table of
+// (offset, length) pairs into it. Compared to a std::set<std::string> this
+// avoids a heap node and a string allocation per entry, and a lookup is a
+// binary search over contiguous memory. Sets are cheap to move, so they can be
+// built on the thread pool and handed to the sequence that queries them.
+class COMPONENT_EXPORT(BRAVE_COMPONENT_UPDATER) HostSet {
+ public:
+  HostSet();
+  explicit HostSet(std::vector<std::string> hosts);
+  HostSet(const HostSet&) = delete;
+  HostSet& operator=(const HostSet&) = delete;
+  HostSet(HostSet&&);
+  HostSet& operator=(HostSet&&);
+  ~HostSet();
+
+  // Builds a set from a list with one host per line. Lines are trimmed and
+  // empty lines are skipped.
+  static HostSet FromLines(std::string_view contents);
+
+  bool Contains(std::string_view host) const;
+
+  size_t size() const { return entries_.size(); }
+  bool empty() const { return entries_.empty(); }
+
+  std::vector<std::string> GetHostsForTesting() const;
+
+ private:
+  // (offset, length) into `buffer_`.
+  using Entry = std::pair<uint32_t, uint32_t>;
+
+  std::string_view GetHost(const Entry& entry) const;
+
+  std::string buffer_;
+  // Sorted by the host each entry refers to.
+  std::vector<Entry> entries_;
+};
+
+}  // namespace brave_component_updater
+
+#endif  // BRAVE_COMPONENTS_BRAVE_COMPONENT_UPDATER_BROWSER_HOST_SET_H_
@@ -0,0 +1,50 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_component_updater/browser/host_set.h"
+
+#include <string>
+#include <vector>
+
+#include "testing/gmock/include/gmock/gmock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_component_updater {
+
+TEST(HostSetTest, Empty) {
+  const HostSet hosts;
+  EXPECT_TRUE(hosts.empty());
+  EXPECT_FALSE(hosts.Contains("brave.com"));
+  EXPECT_FALSE(hosts.Contains(""));
+}
+
+TEST(HostSetTest, FromLines) {
+  const HostSet hosts = HostSet::FromLines(R"(
+    brave.com
+    site.example
+
+    a.test
+    brave.com
+  )");
+  EXPECT_EQ(hosts.size(), 3u);
+  EXPECT_TRUE(hosts.Contains("brave.com"));
+  EXPECT_TRUE(hosts.Contains("site.example"));
+  EXPECT_TRUE(hosts.Contains("a.test"));
+
+  // Only exact hosts match.
+  EXPECT_FALSE(hosts.Contains("www.brave.com"));
+  EXPECT_FALSE(hosts.Contains("brave.co"));
+  EXPECT_FALSE(hosts.Contains("brave.com."));
+  EXPECT_FALSE(hosts.Contains(""));
+  EXPECT_FALSE(hosts.Contains("z.test"));
+}
+
+TEST(HostSetTest, GetHostsForTesting) {
+  const HostSet hosts(std::vector<std::string>{"b.test", "a.test", "b.test"});
+  EXPECT_THAT(hosts.GetHostsForTesting(),
+              testing::ElementsAre("a.test", "b.test"));
+}
+
+}  // namespace brave_component_updater
@@ -40,6 +40,7 @@
 #include "brave/components/brave_news/browser/network.h"
 #include "brave/components/brave_news/browser/publishers_parsing.h"
 #include "brave/components/brave_news/common/brave_news.mojom.h"
+#include "brave/components/brave_news/common/features.h"
 #include "brave/components/brave_news/common/locales_helper.h"
 #include "brave/components/brave_news/common/subscriptions_snapshot.h"
 #include "brave/components/brave_private_cdn/private_cdn_helper.h"
@@ -75,6 +76,41 @@ mojo::StructPtr<EventType> CreateChangeEvent(
   return event;
 }
 
+#if BUILDFLAG(IS_ANDROID)
+constexpr size_t kMaxCachedImages = 32;
+constexpr size_t kMaxPrefetchedImages = 10;
+
+// Returns whether |padded_image_url| will contain (Brave's PrivateCDN) padding
+// or be a direct image, or std::nullopt if it can't be loaded.
+std::optional<bool> IsPaddedImageUrl(const GURL& padded_image_url) {
+  if (!padded_image_url.is_valid()) {
+    return std::nullopt;
+  }
+  // Use file ending to determine if response
+  // will contain (Brave's PrivateCDN) padding or
+  // be a direct image
+  const auto file_name = padded_image_url.path();
+  const std::string ending = ".pad";
+  if (file_name.length() >= file_name.max_size() - 1 ||
+      file_name.length() <= ending.length()) {
+    return std::nullopt;
+  }
+  return file_name.compare(file_name.length() - ending.length(),
+                           ending.length(), ending) == 0;
+}
+
+std::optional<std::vector<uint8_t>> GetImageBytes(bool is_padded,
+                                                  std::string body) {
+  // Attempt to remove byte padding if applicable
+  std::string_view body_payload(body);
+  if (is_padded && !brave::private_cdn::RemovePadding(&body_payload)) {
+    return std::nullopt;
+  }
+  // uint8Array will be easier to move over mojom.
+  return std::vector<uint8_t>(body_payload.begin(), body_payload.end());
+}
+#endif
+
 }  // namespace
 
 // Invokes a method on the BraveNewsEngine in a background thread and invokes
@@ -105,6 +141,7 @@ BraveNewsController::BraveNewsController(
 #if BUILDFLAG(IS_ANDROID)
       private_cdn_request_helper_(GetNetworkTrafficAnnotationTag(),
                                   url_loader_factory),
+      image_data_cache_(kMaxCachedImages),
 #endif
       history_service_(history_service),
       url_loader_factory_(url_loader_factory),
@@ -144,6 +181,7 @@ void BraveNewsController::Bind(
     mojo::PendingReceiver<mojom::BraveNewsController> receiver) {
   DVLOG(1) << __FUNCTION__;
   receivers_.Add(this, std::move(receiver));
+  MaybeStartDeferredLoading();
 }
 
 void BraveNewsController::Bind(
@@ -163,6 +201,7 @@ BraveNewsController::MakeRemote() {
   mojo::PendingRemote<mojom::BraveNewsController> remote;
   DVLOG(1) << __FUNCTION__;
   receivers_.Add(this, remote.InitWithNewPipeAndPassReceiver());
+  MaybeStartDeferredLoading();
   return remote;
 }
 
@@ -447,55 +486,100 @@ void BraveNewsController::GetImageData(const GURL& padded_image_url,
 #if BUILDFLAG(IS_ANDROID)
   VLOG(2) << __FUNCTION__ << " " << padded_image_url.spec();
   // Validate
-  if (!padded_image_url.is_valid()) {
-    std::optional<std::vector<uint8_t>> args;
-    std::move(callback).Run(std::move(args));
+  const auto is_padded = IsPaddedImageUrl(padded_image_url);
+  if (!is_padded) {
+    std::move(callback).Run(std::nullopt);
     return;
   }
-  // Use file ending to determine if response
-  // will contain (Brave's PrivateCDN) padding or
-  // be a direct image
-  const auto file_name = padded_image_url.path();
-  const std::string ending = ".pad";
-  if (file_name.length() >= file_name.max_size() - 1 ||
-      file_name.length() <= ending.length()) {
-    std::optional<std::vector<uint8_t>> args;
-    std::move(callback).Run(std::move(args));
+  VLOG(3) << "is padded: " << *is_padded;
+
+  if (auto it = image_data_cache_.Get(padded_image_url);
+      it != image_data_cache_.end()) {
+    std::move(callback).Run(it->second);
     return;
   }
-  const bool is_padded =
-      (file_name.compare(file_name.length() - ending.length(), ending.length(),
-                         ending) == 0);
-  VLOG(3) << "is padded: " << is_padded;
-  // Make the request
-  private_cdn_request_helper_.DownloadToString(
-      padded_image_url,
-      base::BindOnce(
-          [](GetImageDataCallback callback, const bool is_padded,
-             const int response_code, const std::string& body) {
-            // Handle the response
-            VLOG(3) << "getimagedata response code: " << response_code;
-            // Attempt to remove byte padding if applicable
-            std::string_view body_payload(body.data(), body.size());
-            if (response_code < 200 || response_code >= 300 ||
-                (is_padded &&
-                 !brave::private_cdn::RemovePadding(&body_payload))) {
-              // Byte padding removal failed
-              std::move(callback).Run(std::nullopt);
-              return;
-            }
-            // Download (and optional unpadding) was successful,
-            // uint8Array will be easier to move over mojom.
-            std::vector<uint8_t> image_bytes(body_payload.begin(),
-                                             body_payload.end());
-            std::move(callback).Run(image_bytes);
-          },
-          std::move(callback), is_padded));
+
+  // The image might already be prefetching.
+  auto [pending_it, inserted] =
+      pending_image_data_.try_emplace(padded_image_url);
+  pending_it->second.push_back(std::move(callback));
+  if (inserted) {
+    DownloadImageData(padded_image_url, *is_padded);
+  }
 #else
   NOTREACHED();
 #endif
 }
 
+void BraveNewsController::PrefetchImages(
+    const std::vector<GURL>& padded_image_urls) {
+#if BUILDFLAG(IS_ANDROID)
+  size_t prefetch_count = 0;
+  for (const auto& padded_image_url : padded_image_urls) {
+    if (prefetch_count >= kMaxPrefetchedImages) {
+      break;
+    }
+    const auto is_padded = IsPaddedImageUrl(padded_image_url);
+    if (!is_padded ||
+        image_data_cache_.Peek(padded_image_url) != image_data_cache_.end() ||
+        !pending_image_data_.try_emplace(padded_image_url).second) {
+      continue;
+    }
+    DownloadImageData(padded_image_url, *is_padded);
+    prefetch_count++;
+  }
+#else
+  NOTREACHED();
+#endif
+}
+
+#if BUILDFLAG(IS_ANDROID)
+void BraveNewsController::DownloadImageData(const GURL& padded_image_url,
+                                            bool is_padded) {
+  // Make the request
+  private_cdn_request_helper_.DownloadToString(
+      padded_image_url,
+      base::BindOnce(&BraveNewsController::OnImageDataDownloaded,
+                     weak_ptr_factory_.GetWeakPtr(), padded_image_url,
+                     is_padded));
+}
+
+void BraveNewsController::OnImageDataDownloaded(const GURL& padded_image_url,
+                                                bool is_padded,
+                                                int response_code,
+                                                const std::string& body) {
+  // Handle the response
+  VLOG(3) << "getimagedata response code: " << response_code;
+  if (response_code < 200 || response_code >= 300) {
+    OnImageDataReady(padded_image_url, std::nullopt);
+    return;
+  }
+
+  // Images can be large, so they are unpadded and copied off the main thread.
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&GetImageBytes, is_padded, body),
+      base::BindOnce(&BraveNewsController::OnImageDataReady,
+                     weak_ptr_factory_.GetWeakPtr(), padded_image_url));
+}
+
+void BraveNewsController::OnImageDataReady(
+    const GURL& padded_image_url,
+    std::optional<std::vector<uint8_t>> image_data) {
+  auto node = pending_image_data_.extract(padded_image_url);
+  if (image_data) {
+    image_data_cache_.Put(padded_image_url, *image_data);
+  }
+  if (node.empty()) {
+    return;
+  }
+
+  for (auto& callback : node.mapped()) {
+    std::move(callback).Run(image_data);
+  }
+}
+#endif
+
 void BraveNewsController::SetPublisherPref(const std::string& publisher_id,
                                            mojom::UserEnabled new_status) {
   VLOG(1) << __FUNCTION__ << " " << publisher_id << ": " << new_status;
@@ -666,6 +750,16 @@ void BraveNewsController::ResetEngine() {
 
 void BraveNewsController::ConditionallyStartOrStopTimer() {
   DVLOG(1) << __FUNCTION__;
+  // Nothing displays Brave News until a client connects, so users who rarely
+  // open it don't need to pay for loading it at startup.
+  if (pref_manager_.IsEnabled() && receivers_.empty() &&
+      base::FeatureList::IsEnabled(features::kBraveNewsDeferLoadingFeature)) {
+    VLOG(1) << "Deferring loading until a client connects";
+    is_loading_deferred_ = true;
+    return;
+  }
+  is_loading_deferred_ = false;
+
   // If the user has just enabled the feature for the first time,
   // make sure we're setup or migrated.
   MaybeInitPrefs();
@@ -727,6 +821,14 @@ void BraveNewsController::ConditionallyStartOrStopTimer() {
   }
 }
 
+void BraveNewsController::MaybeStartDeferredLoading() {
+  if (!is_loading_deferred_) {
+    return;
+  }
+  VLOG(1) << "A client connected, starting deferred loading";
+  ConditionallyStartOrStopTimer();
+}
+
 void BraveNewsController::MaybeInitPrefs() {
   DVLOG(1) << __FUNCTION__;
   // When first enabled, we need to create the initial "Top Sources" channel
@@ -758,7 +860,7 @@ void BraveNewsController::OnInitializingPrefsComplete() {
 void BraveNewsController::OnNetworkChanged(
     net::NetworkChangeNotifier::ConnectionType type) {
   DVLOG(1) << __FUNCTION__;
-  if (!pref_manager_.IsEnabled()) {
+  if (!pref_manager_.IsEnabled() || is_loading_deferred_) {
     return;
   }
 
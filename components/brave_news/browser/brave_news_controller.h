@@ -6,9 +6,13 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_NEWS_BROWSER_BRAVE_NEWS_CONTROLLER_H_
 #define BRAVE_COMPONENTS_BRAVE_NEWS_BROWSER_BRAVE_NEWS_CONTROLLER_H_
 
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
+#include "base/containers/lru_cache.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/scoped_observation.h"
@@ -112,6 +116,7 @@ class BraveNewsController
   void RemoveDirectFeed(const std::string& publisher_id) override;
   void GetImageData(const GURL& padded_image_url,
                     GetImageDataCallback callback) override;
+  void PrefetchImages(const std::vector<GURL>& padded_image_urls) override;
   void SetPublisherPref(const std::string& publisher_id,
                         mojom::UserEnabled new_status) override;
   void ClearPrefs() override;
@@ -157,6 +162,7 @@ class BraveNewsController
   void CheckForFeedsUpdate();
   void CheckForPublishersUpdate();
   void Prefetch();
+  void MaybeStartDeferredLoading();
   void MaybeInitPrefs();
   void OnInitializingPrefsComplete();
   void OnVerifiedDirectFeedUrl(const GURL& feed_url,
@@ -170,12 +176,28 @@ class BraveNewsController
 
   BackgroundHistoryQuerier MakeHistoryQuerier();
 
+#if BUILDFLAG(IS_ANDROID)
+  void DownloadImageData(const GURL& padded_image_url, bool is_padded);
+  void OnImageDataDownloaded(const GURL& padded_image_url,
+                             bool is_padded,
+                             int response_code,
+                             const std::string& body);
+  void OnImageDataReady(const GURL& padded_image_url,
+                        std::optional<std::vector<uint8_t>> image_data);
+#endif
+
   raw_ptr<brave_ads::AdsService> ads_service_ = nullptr;
 
 #if BUILDFLAG(IS_ANDROID)
   // Note: This is only used by Android, to load padded images from the Private
   // CDN.
   brave_private_cdn::PrivateCDNRequestHelper private_cdn_request_helper_;
+
+  // Unpadded images which were recently loaded or prefetched.
+  base::LRUCache<GURL, std::vector<uint8_t>> image_data_cache_;
+  // Callbacks waiting for an image which is being downloaded. Prefetched
+  // images have no callbacks until |GetImageData| asks for them.
+  std::map<GURL, std::vector<GetImageDataCallback>> pending_image_data_;
 #endif
 
   raw_ptr<history::HistoryService> history_service_;
@@ -194,6 +216,10 @@ class BraveNewsController
   // Created on this sequence but lives on |task_runner_|.
   std::unique_ptr<BraveNewsEngine, base::OnTaskRunnerDeleter> engine_;
 
+  // Whether loading was deferred until a client connects, see
+  // |features::kBraveNewsDeferLoadingFeature|.
+  bool is_loading_deferred_ = false;
+
   base::OneShotTimer timer_prefetch_;
   base::RepeatingTimer timer_feed_update_;
   base::RepeatingTimer timer_publishers_update_;
@@ -83,10 +83,10 @@ base::expected<mojom::FeedItemPtr, std::string> ParseFeedItem(
                            &GetMigratedChannel);
   }
 
-  metadata->title = feed_item.title;
-  metadata->description = feed_item.description;
-  metadata->publisher_id = feed_item.publisher_id;
-  metadata->publisher_name = feed_item.publisher_name;
+  metadata->title = std::move(feed_item.title);
+  metadata->description = std::move(feed_item.description);
+  metadata->publisher_id = std::move(feed_item.publisher_id);
+  metadata->publisher_name = std::move(feed_item.publisher_name);
   metadata->image = mojom::Image::NewPaddedImageUrl(GURL(feed_item.padded_img));
   metadata->url = std::move(url);
 
@@ -141,15 +141,19 @@ base::expected<mojom::FeedItemPtr, std::string> ParseFeedItem(
 
 }  // namespace
 
-std::vector<mojom::FeedItemPtr> ParseFeedItems(const base::Value& value) {
+std::vector<mojom::FeedItemPtr> ParseFeedItems(base::Value value) {
   std::vector<mojom::FeedItemPtr> items;
   if (!value.is_list()) {
     VLOG(1) << "Expected combined feed json to be a list but was "
             << value.type() << ". Returning an empty list of items.";
     return items;
   }
-  for (const base::Value& feed_item : value.GetList()) {
+  items.reserve(value.GetList().size());
+  for (base::Value& feed_item : value.GetList()) {
     auto item = ParseFeedItem(feed_item);
+    // The json of an item is not needed anymore, so it is released right away
+    // rather than keeping the whole feed around until all items are parsed.
+    feed_item = base::Value();
     if (item.has_value()) {
       items.push_back(std::move(*item));
     } else {
@@ -15,7 +15,8 @@
 namespace brave_news {
 
 // Convert from the "combined feed" hosted remotely to Brave News mojom items.
-std::vector<mojom::FeedItemPtr> ParseFeedItems(const base::Value& value);
+// `value` is consumed while the items are converted.
+std::vector<mojom::FeedItemPtr> ParseFeedItems(base::Value value);
 
 }  // namespace brave_news
 
@@ -14,6 +14,7 @@
 #include "brave/components/brave_news/common/brave_news.mojom-shared.h"
 #include "brave/components/brave_news/common/brave_news.mojom.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
 
 namespace brave_news {
 
@@ -46,7 +47,13 @@ TEST(BraveNewsCombinedFeedParsing, Success) {
   std::vector<mojom::FeedItemPtr> feed_items =
       ParseFeedItems(std::move(json_value));
   // The single item should be successfully parsed to a FeedItem
-  EXPECT_EQ(feed_items.size(), 1u);
+  ASSERT_EQ(feed_items.size(), 1u);
+  const auto& data = feed_items[0]->get_article()->data;
+  EXPECT_EQ(data->title, "Title");
+  EXPECT_EQ(data->description, "Description");
+  EXPECT_EQ(data->publisher_id, "Id1");
+  EXPECT_EQ(data->publisher_name, "Publisher1");
+  EXPECT_EQ(data->url, GURL("https://www.hello.com"));
 }
 
 TEST(BraveNewsCombinedFeedParsing, GetItemWithChannels) {
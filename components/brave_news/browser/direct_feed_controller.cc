@@ -17,6 +17,7 @@
 #include "base/functional/bind.h"
 #include "base/functional/callback.h"
 #include "base/logging.h"
+#include "base/task/thread_pool.h"
 #include "brave/components/brave_news/browser/direct_feed_fetcher.h"
 #include "brave/components/brave_news/browser/html_parsing.h"
 #include "brave/components/brave_news/common/brave_news.mojom.h"
@@ -96,38 +97,21 @@ void DirectFeedController::OnFindFeedsImplDownloadedFeed(
 
   if (!response.mime_type.empty() &&
       response.mime_type.find("html") != std::string::npos) {
-    auto& body_content =
-        std::get<DirectFeedError>(response.result).body_content;
     VLOG(1) << "Had html type";
-    // Get feed links from doc
-    auto feed_urls = GetFeedURLsFromHTMLDocument(response.charset, body_content,
-                                                 response.final_url);
-    auto all_done_handler = base::BindOnce(
-        [](mojom::BraveNewsController::FindFeedsCallback callback,
-           std::vector<DirectFeedResponse> responses) {
-          std::vector<mojom::FeedSearchResultItemPtr> results;
-          for (const auto& response : responses) {
-            if (auto* feed = std::get_if<DirectFeedResult>(&response.result)) {
-              if (feed->title.empty()) {
-                continue;
-              }
-              auto feed_result = mojom::FeedSearchResultItem::New();
-              feed_result->feed_title = (std::string)feed->title;
-              feed_result->feed_url = response.url;
-              results.emplace_back(std::move(feed_result));
-            }
-          }
-          VLOG(1) << "Valid feeds found via HTML content: " << results.size();
-          std::move(callback).Run(std::move(results));
-        },
-        base::BindOnce(&DirectFeedController::OnFindFeedsImplResponse,
+    // Get feed links from doc. Pages can be large so it is done off the main
+    // thread.
+    base::ThreadPool::PostTaskAndReplyWithResult(
+        FROM_HERE,
+        base::BindOnce(
+            [](std::string charset, std::string body_content, GURL final_url) {
+              return GetFeedURLsFromHTMLDocument(charset, body_content,
+                                                 final_url);
+            },
+            std::move(response.charset),
+            std::move(std::get<DirectFeedError>(response.result).body_content),
+            std::move(response.final_url)),
+        base::BindOnce(&DirectFeedController::OnFindFeedsImplParsedHTML,
                        weak_ptr_factory_.GetWeakPtr(), feed_url));
-    VLOG(1) << "Feed URLs found in HTML content: " << feed_urls.size();
-    auto feed_handler = base::BarrierCallback<DirectFeedResponse>(
-        feed_urls.size(), std::move(all_done_handler));
-    for (auto& url : feed_urls) {
-      fetcher_.DownloadFeed(url, "", feed_handler);
-    }
     return;
   }
 
@@ -135,6 +119,37 @@ void DirectFeedController::OnFindFeedsImplDownloadedFeed(
   OnFindFeedsImplResponse(feed_url, {});
 }
 
+void DirectFeedController::OnFindFeedsImplParsedHTML(
+    const GURL& feed_url,
+    std::vector<GURL> feed_urls) {
+  auto all_done_handler = base::BindOnce(
+      [](mojom::BraveNewsController::FindFeedsCallback callback,
+         std::vector<DirectFeedResponse> responses) {
+        std::vector<mojom::FeedSearchResultItemPtr> results;
+        for (const auto& response : responses) {
+          if (auto* feed = std::get_if<DirectFeedResult>(&response.result)) {
+            if (feed->title.empty()) {
+              continue;
+            }
+            auto feed_result = mojom::FeedSearchResultItem::New();
+            feed_result->feed_title = (std::string)feed->title;
+            feed_result->feed_url = response.url;
+            results.emplace_back(std::move(feed_result));
+          }
+        }
+        VLOG(1) << "Valid feeds found via HTML content: " << results.size();
+        std::move(callback).Run(std::move(results));
+      },
+      base::BindOnce(&DirectFeedController::OnFindFeedsImplResponse,
+                     weak_ptr_factory_.GetWeakPtr(), feed_url));
+  VLOG(1) << "Feed URLs found in HTML content: " << feed_urls.size();
+  auto feed_handler = base::BarrierCallback<DirectFeedResponse>(
+      feed_urls.size(), std::move(all_done_handler));
+  for (auto& url : feed_urls) {
+    fetcher_.DownloadFeed(url, "", feed_handler);
+  }
+}
+
 void DirectFeedController::OnFindFeedsImplResponse(
     const GURL& feed_url,
     std::vector<mojom::FeedSearchResultItemPtr> results) {
@@ -60,6 +60,8 @@ class DirectFeedController {
   void FindFeedsImpl(const GURL& possible_feed_or_site_url);
   void OnFindFeedsImplDownloadedFeed(const GURL& feed_url,
                                      DirectFeedResponse result);
+  void OnFindFeedsImplParsedHTML(const GURL& feed_url,
+                                 std::vector<GURL> feed_urls);
   void OnFindFeedsImplResponse(
       const GURL& feed_url,
       std::vector<mojom::FeedSearchResultItemPtr> results);
@@ -11,6 +11,7 @@
 #include <utility>
 #include <variant>
 
+#include "base/check_op.h"
 #include "base/functional/bind.h"
 #include "base/logging.h"
 #include "base/strings/utf_string_conversions.h"
@@ -20,6 +21,9 @@
 #include "brave/components/brave_news/common/brave_news.mojom.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/load_flags.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_status_code.h"
 #include "services/network/public/cpp/resource_request.h"
 #include "services/network/public/cpp/simple_url_loader.h"
 #include "services/network/public/mojom/url_response_head.mojom.h"
@@ -33,6 +37,7 @@ namespace brave_news {
 namespace {
 
 constexpr size_t kMaxRedirectCount = 7;
+constexpr size_t kMaxConcurrentDownloads = 6;
 
 std::string GetResponseCharset(network::SimpleURLLoader* loader) {
   auto* response_info = loader->ResponseInfo();
@@ -43,6 +48,12 @@ std::string GetResponseCharset(network::SimpleURLLoader* loader) {
   return response_info->charset.empty() ? "utf-8" : response_info->charset;
 }
 
+std::string GetRelativeTimeDescription(base::TimeDelta relative_time_delta) {
+  return base::UTF16ToUTF8(ui::TimeFormat::Simple(
+      ui::TimeFormat::Format::FORMAT_ELAPSED,
+      ui::TimeFormat::Length::LENGTH_LONG, relative_time_delta));
+}
+
 mojom::ArticlePtr RustFeedItemToArticle(const FeedItem& rust_feed_item,
                                         const std::string& publisher_id) {
   // We don't include description since there does not exist a
@@ -60,9 +71,7 @@ mojom::ArticlePtr RustFeedItemToArticle(const FeedItem& rust_feed_item,
   base::TimeDelta relative_time_delta =
       base::Time::Now() - metadata->publish_time;
   metadata->relative_time_description =
-      base::UTF16ToUTF8(ui::TimeFormat::Simple(
-          ui::TimeFormat::Format::FORMAT_ELAPSED,
-          ui::TimeFormat::Length::LENGTH_LONG, relative_time_delta));
+      GetRelativeTimeDescription(relative_time_delta);
   auto article = mojom::Article::New();
   article->data = std::move(metadata);
   // Calculate score same method as brave news aggregator
@@ -149,6 +158,12 @@ DirectFeedResponse::DirectFeedResponse() = default;
 DirectFeedResponse::~DirectFeedResponse() = default;
 DirectFeedResponse::DirectFeedResponse(DirectFeedResponse&&) = default;
 
+DirectFeedFetcher::CachedFeed::CachedFeed() = default;
+DirectFeedFetcher::CachedFeed::~CachedFeed() = default;
+DirectFeedFetcher::CachedFeed::CachedFeed(CachedFeed&&) = default;
+DirectFeedFetcher::CachedFeed& DirectFeedFetcher::CachedFeed::operator=(
+    CachedFeed&&) = default;
+
 DirectFeedFetcher::DirectFeedFetcher(
     scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
     base::WeakPtr<Delegate> delegate)
@@ -158,8 +173,37 @@ DirectFeedFetcher::~DirectFeedFetcher() = default;
 void DirectFeedFetcher::DownloadFeed(GURL url,
                                      std::string publisher_id,
                                      DownloadFeedCallback callback) {
-  DownloadFeedHelper(url, url, publisher_id, 0, std::move(callback),
-                     std::nullopt);
+  auto download = base::BindOnce(
+      &DirectFeedFetcher::StartDownload, weak_ptr_factory_.GetWeakPtr(),
+      std::move(url), std::move(publisher_id), std::move(callback));
+  if (active_downloads_ >= kMaxConcurrentDownloads) {
+    pending_downloads_.push_back(std::move(download));
+    return;
+  }
+  std::move(download).Run();
+}
+
+void DirectFeedFetcher::StartDownload(GURL url,
+                                      std::string publisher_id,
+                                      DownloadFeedCallback callback) {
+  active_downloads_++;
+  DownloadFeedHelper(
+      url, url, std::move(publisher_id), 0,
+      base::BindOnce(&DirectFeedFetcher::OnDownloadFeedComplete,
+                     weak_ptr_factory_.GetWeakPtr(), std::move(callback)),
+      std::nullopt);
+}
+
+void DirectFeedFetcher::OnDownloadFeedComplete(DownloadFeedCallback callback,
+                                               DirectFeedResponse response) {
+  DCHECK_GT(active_downloads_, 0u);
+  active_downloads_--;
+  if (!pending_downloads_.empty()) {
+    auto download = std::move(pending_downloads_.front());
+    pending_downloads_.pop_front();
+    std::move(download).Run();
+  }
+  std::move(callback).Run(std::move(response));
 }
 
 void DirectFeedFetcher::DownloadFeedHelper(
@@ -216,6 +260,20 @@ void DirectFeedFetcher::DownloadFeedHelper(
   request->credentials_mode = network::mojom::CredentialsMode::kOmit;
   request->method = net::HttpRequestHeaders::kGetMethod;
   request->redirect_mode = network::mojom::RedirectMode::kError;
+  // Ask the server to only send the feed again if it changed since the last
+  // time we parsed it.
+  if (auto it = feed_cache_.find(original_url);
+      it != feed_cache_.end() && it->second.final_url == url &&
+      it->second.publisher_id == publisher_id) {
+    if (!it->second.etag.empty()) {
+      request->headers.SetHeader(net::HttpRequestHeaders::kIfNoneMatch,
+                                 it->second.etag);
+    }
+    if (!it->second.last_modified.empty()) {
+      request->headers.SetHeader(net::HttpRequestHeaders::kIfModifiedSince,
+                                 it->second.last_modified);
+    }
+  }
   auto url_loader = network::SimpleURLLoader::Create(
       std::move(request), GetNetworkTrafficAnnotationTag());
   url_loader->SetRetryOptions(
@@ -256,6 +314,8 @@ void DirectFeedFetcher::OnFeedDownloaded(
   }
 
   auto response_code = -1;
+  std::string etag;
+  std::string last_modified;
 
   auto result = DirectFeedResponse();
   result.charset = GetResponseCharset(loader);
@@ -267,11 +327,32 @@ void DirectFeedFetcher::OnFeedDownloaded(
     result.mime_type = loader->ResponseInfo()->mime_type;
     if (headers_list) {
       response_code = headers_list->response_code();
+      etag = headers_list->GetNormalizedHeader("ETag").value_or("");
+      last_modified =
+          headers_list->GetNormalizedHeader("Last-Modified").value_or("");
     }
   }
 
   url_loaders_.erase(iter);
 
+  if (response_code == net::HTTP_NOT_MODIFIED) {
+    if (auto it = feed_cache_.find(original_url);
+        it != feed_cache_.end() && it->second.publisher_id == publisher_id) {
+      DirectFeedResult feed;
+      feed.id = publisher_id;
+      feed.title = it->second.title;
+      feed.articles.reserve(it->second.articles.size());
+      for (const auto& article : it->second.articles) {
+        auto& cloned = feed.articles.emplace_back(article.Clone());
+        cloned->data->relative_time_description = GetRelativeTimeDescription(
+            base::Time::Now() - cloned->data->publish_time);
+      }
+      result.result = std::move(feed);
+      std::move(callback).Run(std::move(result));
+      return;
+    }
+  }
+
   std::string body_content = response_body ? *response_body : "";
 
   if (response_code < 200 || response_code >= 300 || body_content.empty()) {
@@ -297,13 +378,35 @@ void DirectFeedFetcher::OnFeedDownloaded(
       url, std::move(publisher_id), std::move(body_content),
       base::BindOnce(&DirectFeedFetcher::OnParsedFeedData,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback),
-                     std::move(result)));
+                     std::move(result), std::move(etag),
+                     std::move(last_modified)));
 }
 
 void DirectFeedFetcher::OnParsedFeedData(
     DownloadFeedCallback callback,
     DirectFeedResponse result,
+    std::string etag,
+    std::string last_modified,
     std::variant<DirectFeedResult, DirectFeedError> data) {
+  // Speculative downloads are not cached as their articles don't belong to
+  // any publisher yet.
+  auto* feed = std::get_if<DirectFeedResult>(&data);
+  if (feed && !feed->id.empty() && (!etag.empty() || !last_modified.empty())) {
+    CachedFeed cached;
+    cached.publisher_id = feed->id;
+    cached.final_url = result.final_url;
+    cached.etag = std::move(etag);
+    cached.last_modified = std::move(last_modified);
+    cached.title = feed->title;
+    cached.articles.reserve(feed->articles.size());
+    for (const auto& article : feed->articles) {
+      cached.articles.push_back(article.Clone());
+    }
+    feed_cache_.insert_or_assign(result.url, std::move(cached));
+  } else {
+    feed_cache_.erase(result.url);
+  }
+
   result.result = std::move(data);
   std::move(callback).Run(std::move(result));
 }
@@ -7,12 +7,15 @@
 #define BRAVE_COMPONENTS_BRAVE_NEWS_BROWSER_DIRECT_FEED_FETCHER_H_
 
 #include <list>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <variant>
 #include <vector>
 
-#include "base/functional/callback_forward.h"
+#include "base/containers/circular_deque.h"
+#include "base/functional/callback.h"
 #include "base/memory/weak_ptr.h"
 #include "brave/components/brave_news/common/brave_news.mojom-forward.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
@@ -89,6 +92,7 @@ class DirectFeedFetcher {
 
   // |publisher_id| can be empty, if one we're speculatively downloading a feed.
   // This |publisher_id| will be used for any returned articles.
+  // Only a few feeds are downloaded at a time, the others are queued.
   void DownloadFeed(GURL url,
                     std::string publisher_id,
                     DownloadFeedCallback callback);
@@ -97,6 +101,27 @@ class DirectFeedFetcher {
   using SimpleURLLoaderList =
       std::list<std::unique_ptr<network::SimpleURLLoader>>;
 
+  // Articles of the last successful download of a publisher's feed, along
+  // with the validators used to make a conditional request for it.
+  struct CachedFeed {
+    CachedFeed();
+    ~CachedFeed();
+    CachedFeed(CachedFeed&&);
+    CachedFeed& operator=(CachedFeed&&);
+
+    std::string publisher_id;
+    GURL final_url;
+    std::string etag;
+    std::string last_modified;
+    std::string title;
+    std::vector<mojom::ArticlePtr> articles;
+  };
+
+  void StartDownload(GURL url,
+                     std::string publisher_id,
+                     DownloadFeedCallback callback);
+  void OnDownloadFeedComplete(DownloadFeedCallback callback,
+                              DirectFeedResponse response);
   void DownloadFeedHelper(
       GURL url,
       GURL original_url,
@@ -116,10 +141,18 @@ class DirectFeedFetcher {
       const std::unique_ptr<std::string> response_body);
   void OnParsedFeedData(DownloadFeedCallback callback,
                         DirectFeedResponse result,
+                        std::string etag,
+                        std::string last_modified,
                         std::variant<DirectFeedResult, DirectFeedError> data);
 
   SimpleURLLoaderList url_loaders_;
 
+  size_t active_downloads_ = 0;
+  base::circular_deque<base::OnceClosure> pending_downloads_;
+
+  // Keyed by the URL the feed was requested with.
+  std::map<GURL, CachedFeed> feed_cache_;
+
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
 
   base::WeakPtr<Delegate> delegate_;
@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <map>
 #include <string>
 #include <tuple>
 #include <unordered_set>
@@ -36,6 +37,7 @@
 #include "brave/components/brave_news/common/locales_helper.h"
 #include "brave/components/brave_news/common/subscriptions_snapshot.h"
 #include "brave/components/brave_private_cdn/headers.h"
+#include "net/http/http_status_code.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 
 namespace brave_news {
@@ -43,6 +45,7 @@ namespace brave_news {
 namespace {
 
 constexpr char kEtagHeaderKey[] = "etag";
+constexpr char kIfNoneMatchHeaderKey[] = "If-None-Match";
 
 GURL GetFeedUrl(const std::string& locale) {
   GURL feed_url("https://" + brave_news::GetHostname() + "/brave-today/feed." +
@@ -50,6 +53,15 @@ GURL GetFeedUrl(const std::string& locale) {
   return feed_url;
 }
 
+FeedItems CloneFeedItems(const FeedItems& items) {
+  FeedItems result;
+  result.reserve(items.size());
+  for (const auto& item : items) {
+    result.push_back(item->Clone());
+  }
+  return result;
+}
+
 }  // namespace
 
 FeedFetcher::FeedSourceResult::FeedSourceResult() = default;
@@ -60,6 +72,8 @@ FeedFetcher::FeedSourceResult::FeedSourceResult(std::string key,
 FeedFetcher::FeedSourceResult::~FeedSourceResult() = default;
 FeedFetcher::FeedSourceResult::FeedSourceResult(
     FeedFetcher::FeedSourceResult&&) = default;
+FeedFetcher::FeedSourceResult& FeedFetcher::FeedSourceResult::operator=(
+    FeedFetcher::FeedSourceResult&&) = default;
 
 // static
 std::tuple<FeedItems, ETags> FeedFetcher::CombineFeedSourceResults(
@@ -138,6 +152,9 @@ void FeedFetcher::OnFetchFeedFetchedPublishers(
 
   auto locales =
       GetMinimalLocalesSet(subscriptions.GetChannelLocales(), publishers);
+  std::erase_if(locale_feeds_cache_, [&locales](const auto& entry) {
+    return !locales.contains(entry.first);
+  });
   std::vector<mojom::PublisherPtr> direct_publishers;
   for (const auto& [_, publisher] : publishers) {
     if (publisher->type != mojom::PublisherType::DIRECT_SOURCE) {
@@ -155,12 +172,17 @@ void FeedFetcher::OnFetchFeedFetchedPublishers(
   for (const auto& locale : locales) {
     GURL feed_url(GetFeedUrl(locale));
     VLOG(1) << "Making feed request to " << feed_url.spec();
+    // Unchanged feeds are not downloaded and parsed again.
+    base::flat_map<std::string, std::string> headers;
+    if (const auto* cached = base::FindOrNull(locale_feeds_cache_, locale)) {
+      headers.emplace(kIfNoneMatchHeaderKey, cached->etag);
+    }
     api_request_helper_.Request(
         "GET", feed_url, "", "",
         base::BindOnce(&FeedFetcher::OnFetchFeedFetchedFeed,
                        weak_ptr_factory_.GetWeakPtr(), locale,
                        downloaded_callback),
-        {}, {.timeout = GetDefaultRequestTimeout()});
+        std::move(headers), {.timeout = GetDefaultRequestTimeout()});
   }
 
   for (const auto& direct_publisher : direct_publishers) {
@@ -198,6 +220,15 @@ void FeedFetcher::OnFetchFeedFetchedFeed(
   VLOG(1) << "Downloaded feed, status: " << result.response_code()
           << " etag: " << etag;
 
+  if (result.response_code() == net::HTTP_NOT_MODIFIED) {
+    if (const auto* cached = base::FindOrNull(locale_feeds_cache_, locale)) {
+      VLOG(1) << "Feed for " << locale << " was not modified";
+      std::move(callback).Run(
+          {std::move(locale), cached->etag, CloneFeedItems(cached->items)});
+      return;
+    }
+  }
+
   // Handle bad response
   if (result.response_code() != 200 || result.value_body().is_none()) {
     LOG(ERROR) << "Bad response from brave news feed.json. Status: "
@@ -216,6 +247,11 @@ void FeedFetcher::OnFetchFeedFetchedFeed(
             if (!fetcher) {
               return;
             }
+            if (!etag.empty()) {
+              fetcher->locale_feeds_cache_.insert_or_assign(
+                  locale,
+                  FeedSourceResult(locale, etag, CloneFeedItems(items)));
+            }
             std::move(callback).Run(
                 {std::move(locale), std::move(etag), std::move(items)});
           },
@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_NEWS_BROWSER_FEED_FETCHER_H_
 #define BRAVE_COMPONENTS_BRAVE_NEWS_BROWSER_FEED_FETCHER_H_
 
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -52,6 +53,7 @@ class FeedFetcher {
     FeedSourceResult(std::string key, std::string etag, FeedItems items);
     ~FeedSourceResult();
     FeedSourceResult(FeedSourceResult&&);
+    FeedSourceResult& operator=(FeedSourceResult&&);
     FeedSourceResult(const FeedSourceResult&) = delete;
     FeedSourceResult& operator=(const FeedSourceResult&) = delete;
   };
@@ -89,6 +91,10 @@ class FeedFetcher {
   api_request_helper::APIRequestHelper api_request_helper_;
   DirectFeedFetcher direct_feed_fetcher_;
 
+  // Items of the last download of each locale feed which had an etag, reused
+  // when the feed was not modified since.
+  std::map<std::string, FeedSourceResult> locale_feeds_cache_;
+
   base::WeakPtrFactory<FeedFetcher> weak_ptr_factory_{this};
 };
 
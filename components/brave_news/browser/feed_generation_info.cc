@@ -9,6 +9,7 @@
 #include <numeric>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -21,6 +22,7 @@
 #include "brave/components/brave_news/browser/feed_sampling.h"
 #include "brave/components/brave_news/browser/publishers_controller.h"
 #include "brave/components/brave_news/browser/signal_calculator.h"
+#include "brave/components/brave_news/browser/string_interner.h"
 #include "brave/components/brave_news/common/brave_news.mojom.h"
 #include "brave/components/brave_news/common/features.h"
 #include "brave/components/brave_news/common/subscriptions_snapshot.h"
@@ -89,7 +91,7 @@ std::vector<mojom::Signal*> GetSignals(
 
 ArticleMetadata GetArticleMetadata(const mojom::FeedItemMetadataPtr& article,
                                    const std::vector<mojom::Signal*>& signals,
-                                   std::vector<std::string> publisher_channels,
+                                   base::flat_set<std::string_view> channels,
                                    const bool& discoverable) {
   // We should have at least one |Signal| from the |Publisher| for this source.
   CHECK(!signals.empty());
@@ -107,19 +109,24 @@ ArticleMetadata GetArticleMetadata(const mojom::FeedItemMetadataPtr& article,
   metadata.visited = signals.at(0)->visit_weight != 0;
   metadata.subscribed = subscribed_weight != 0,
   metadata.discoverable = discoverable;
-  metadata.channels =
-      base::flat_set<std::string>(std::move(publisher_channels));
+  metadata.channels = std::move(channels);
   return metadata;
 }
 
 ArticleInfos GetArticleInfos(const std::string& locale,
                              const FeedItems& feed_items,
                              const Publishers& publishers,
-                             const Signals& signals) {
+                             const Signals& signals,
+                             StringInterner& interner) {
   ArticleInfos articles;
   base::flat_set<GURL> seen_articles;
   base::flat_set<std::string> non_discoverable_publishers;
 
+  // The channels of each publisher are only looked up once, rather than for
+  // every article.
+  base::flat_map<std::string_view, base::flat_set<std::string_view>>
+      publisher_channels;
+  publisher_channels.reserve(publishers.size());
   for (const auto& [publisher_id, publisher] : publishers) {
     auto channels = GetChannelsForPublisher(locale, publisher);
     if (std::ranges::any_of(kSensitiveChannels,
@@ -128,6 +135,15 @@ ArticleInfos GetArticleInfos(const std::string& locale,
                             })) {
       non_discoverable_publishers.insert(publisher_id);
     }
+
+    std::vector<std::string_view> interned_channels;
+    interned_channels.reserve(channels.size());
+    for (const auto& channel : channels) {
+      interned_channels.push_back(interner.Intern(channel));
+    }
+    publisher_channels.emplace(
+        interner.Intern(publisher_id),
+        base::flat_set<std::string_view>(std::move(interned_channels)));
   }
 
   for (const auto& item : feed_items) {
@@ -159,12 +175,13 @@ ArticleInfos GetArticleInfos(const std::string& locale,
       const bool discoverable =
           !non_discoverable_publishers.contains(article->data->publisher_id);
 
-      auto channels = GetChannelsForPublisher(
-          locale, publishers.at(article->data->publisher_id));
-      ArticleInfo pair =
-          std::tuple(article->data->Clone(),
-                     GetArticleMetadata(article->data, article_signals,
-                                        std::move(channels), discoverable));
+      auto* channels =
+          base::FindOrNull(publisher_channels, article->data->publisher_id);
+      CHECK(channels);
+      ArticleInfo pair = std::tuple(
+          article->data->Clone(),
+          GetArticleMetadata(article->data, article_signals, *channels,
+                             discoverable));
 
       articles.push_back(std::move(pair));
     }
@@ -221,8 +238,10 @@ FeedGenerationInfo::~FeedGenerationInfo() = default;
 
 const ArticleInfos& FeedGenerationInfo::GetArticleInfos() {
   if (!article_infos_) {
-    article_infos_ = brave_news::GetArticleInfos(locale_, feed_items_,
-                                                 publishers_, signals_);
+    article_infos_ = brave_news::GetArticleInfos(
+        locale_, feed_items_, publishers_, signals_, interner_);
+    article_ids_.resize(article_infos_->size());
+    std::iota(article_ids_.begin(), article_ids_.end(), 0);
   }
   return article_infos_.value();
 }
@@ -285,8 +304,52 @@ mojom::FeedItemMetadataPtr FeedGenerationInfo::PickAndConsume(
     return nullptr;
   }
 
-  auto index = maybe_index.value();
-  CHECK_LT(index, articles.size());
+  CHECK_LT(maybe_index.value(), articles.size());
+  return ConsumeArticle(maybe_index.value());
+}
+
+mojom::FeedItemMetadataPtr FeedGenerationInfo::PickAndConsumeWeighted(
+    const std::string& sampler_key,
+    const GetWeighting& get_weighting) {
+  CHECK(article_infos_.has_value());
+  auto& articles = article_infos_.value();
+
+  auto sampler_it = samplers_.find(sampler_key);
+  if (sampler_it == samplers_.end()) {
+    // Consumed articles keep a weight of zero.
+    std::vector<double> weights(
+        article_ids_.empty() ? 0 : article_ids_.back() + 1, 0.0);
+    for (size_t i = 0; i < articles.size(); ++i) {
+      const auto& [article, metadata] = articles[i];
+      weights[article_ids_[i]] = get_weighting.Run(article, metadata);
+    }
+    sampler_it =
+        samplers_.emplace(sampler_key, WeightedSampler(std::move(weights)))
+            .first;
+  }
+
+  auto article_id = sampler_it->second.Sample();
+  // There won't be an article if none of them were eligible.
+  if (!article_id.has_value()) {
+    return nullptr;
+  }
+
+  // Ids are still sorted, as consuming an article doesn't reorder the others.
+  auto id_it = std::ranges::lower_bound(article_ids_, article_id.value());
+  CHECK(id_it != article_ids_.end());
+  CHECK_EQ(*id_it, article_id.value());
+  return ConsumeArticle(std::distance(article_ids_.begin(), id_it));
+}
+
+mojom::FeedItemMetadataPtr FeedGenerationInfo::ConsumeArticle(size_t index) {
+  auto& articles = article_infos_.value();
+
+  for (auto& [key, sampler] : samplers_) {
+    if (article_ids_[index] < sampler.size()) {
+      sampler.Remove(article_ids_[index]);
+    }
+  }
+  article_ids_.erase(article_ids_.begin() + index);
 
   auto [article, metadata] = std::move(articles[index]);
   articles.erase(articles.begin() + index);
@@ -299,7 +362,7 @@ mojom::FeedItemMetadataPtr FeedGenerationInfo::PickAndConsume(
 void FeedGenerationInfo::GenerateAvailableCounts() {
   CHECK(available_counts_.empty());
   for (auto& [article, metadata] : GetArticleInfos()) {
-    available_counts_[article->publisher_id]++;
+    available_counts_[interner_.Intern(article->publisher_id)]++;
     for (const auto& channel : metadata.channels) {
       available_counts_[channel]++;
     }
@@ -314,7 +377,7 @@ void FeedGenerationInfo::ReduceCounts(const mojom::FeedItemMetadataPtr& article,
   }
 
   // Decrease the publisher count for this article.
-  std::vector<std::string> remove_content_groups;
+  std::vector<std::string_view> remove_content_groups;
   auto publisher_it = available_counts_.find(article->publisher_id);
   if (publisher_it != available_counts_.end()) {
     if (publisher_it->second <= 1) {
@@ -359,8 +422,9 @@ void FeedGenerationInfo::ReduceCounts(const mojom::FeedItemMetadataPtr& article,
 ArticleInfos GetArticleInfosForTesting(const std::string& locale,  // IN-TEST
                                        const FeedItems& feed_items,
                                        const Publishers& publishers,
-                                       const Signals& signals) {
-  return GetArticleInfos(locale, feed_items, publishers, signals);
+                                       const Signals& signals,
+                                       StringInterner& interner) {
+  return GetArticleInfos(locale, feed_items, publishers, signals, interner);
 }
 
 }  // namespace brave_news
@@ -8,6 +8,7 @@
 
 #include <cstddef>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "base/containers/flat_map.h"
@@ -17,6 +18,7 @@
 #include "brave/components/brave_news/browser/feed_sampling.h"
 #include "brave/components/brave_news/browser/publishers_controller.h"
 #include "brave/components/brave_news/browser/signal_calculator.h"
+#include "brave/components/brave_news/browser/string_interner.h"
 #include "brave/components/brave_news/browser/topics_fetcher.h"
 #include "brave/components/brave_news/common/brave_news.mojom-forward.h"
 #include "brave/components/brave_news/common/subscriptions_snapshot.h"
@@ -54,6 +56,13 @@ class FeedGenerationInfo {
   // maintain the list of content groups.
   mojom::FeedItemMetadataPtr PickAndConsume(PickArticles picker);
 
+  // Same as PickAndConsume, but samples an article proportionally to
+  // |get_weighting|. Articles are only weighed once per |sampler_key|, so all
+  // calls with the same key must use the same weighting.
+  mojom::FeedItemMetadataPtr PickAndConsumeWeighted(
+      const std::string& sampler_key,
+      const GetWeighting& get_weighting);
+
   const SubscriptionsSnapshot& subscriptions() { return subscriptions_; }
   const std::string locale() { return locale_; }
   const Publishers& publishers() { return publishers_; }
@@ -72,6 +81,7 @@ class FeedGenerationInfo {
  private:
   friend class BraveNewsFeedGenerationInfoTest;
 
+  mojom::FeedItemMetadataPtr ConsumeArticle(size_t index);
   void GenerateAvailableCounts();
   void ReduceCounts(const mojom::FeedItemMetadataPtr& article,
                     const ArticleMetadata& meta);
@@ -90,15 +100,26 @@ class FeedGenerationInfo {
 
   TopicsResult topics_;
 
+  // Owns the channel names and publisher ids referenced by |article_infos_|
+  // and |available_counts_|.
+  StringInterner interner_;
+
   std::optional<ArticleInfos> article_infos_;
+
+  // The index each article of |article_infos_| had before any was consumed.
+  // Samplers are indexed by these, so they stay valid as articles are removed.
+  std::vector<size_t> article_ids_;
+  base::flat_map<std::string, WeightedSampler> samplers_;
+
   std::optional<std::vector<ContentGroup>> content_groups_;
-  base::flat_map<std::string, size_t> available_counts_;
+  base::flat_map<std::string_view, size_t> available_counts_;
 };
 
 ArticleInfos GetArticleInfosForTesting(const std::string& locale,
                                        const FeedItems& feed_items,
                                        const Publishers& publishers,
-                                       const Signals& signals);
+                                       const Signals& signals,
+                                       StringInterner& interner);
 
 }  // namespace brave_news
 
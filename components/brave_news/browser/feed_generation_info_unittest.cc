@@ -20,6 +20,7 @@
 #include "brave/components/brave_news/browser/feed_fetcher.h"
 #include "brave/components/brave_news/browser/feed_sampling.h"
 #include "brave/components/brave_news/browser/publishers_controller.h"
+#include "brave/components/brave_news/browser/string_interner.h"
 #include "brave/components/brave_news/browser/topics_fetcher.h"
 #include "brave/components/brave_news/common/brave_news.mojom.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -202,12 +203,47 @@ TEST_F(BraveNewsFeedGenerationInfoTest,
   EXPECT_TRUE(base::Contains(channels, kFooChannel));
 }
 
+TEST_F(BraveNewsFeedGenerationInfoTest, PickAndConsumeWeightedSkipsConsumed) {
+  auto [locale, feed_items, publishers, signals, topics] = MockFetchedData();
+  feed_items.push_back(MakeArticleItem(kPublisher1));
+  feed_items.push_back(MakeArticleItem(kPublisher2));
+  FeedGenerationInfo info(SubscriptionsSnapshot(), "en_NZ", feed_items,
+                          publishers, {kTopNewsChannel, kFooChannel}, signals,
+                          {}, topics);
+  ASSERT_EQ(2u, info.GetArticleInfos().size());
+
+  GetWeighting weigh_p2 = base::BindRepeating(
+      [](const mojom::FeedItemMetadataPtr& article,
+         const ArticleMetadata& meta) {
+        return article->publisher_id == kPublisher2 ? 1.0 : 0.0;
+      });
+  GetWeighting weigh_all = base::BindRepeating(
+      [](const mojom::FeedItemMetadataPtr& article,
+         const ArticleMetadata& meta) { return 1.0; });
+
+  auto picked = info.PickAndConsumeWeighted("p2", weigh_p2);
+  ASSERT_TRUE(picked);
+  EXPECT_EQ(kPublisher2, picked->publisher_id);
+  EXPECT_FALSE(info.PickAndConsumeWeighted("p2", weigh_p2));
+  EXPECT_EQ(1u, info.GetArticleInfos().size());
+
+  // Samplers built after an article was consumed don't include it.
+  picked = info.PickAndConsumeWeighted("all", weigh_all);
+  ASSERT_TRUE(picked);
+  EXPECT_EQ(kPublisher1, picked->publisher_id);
+  EXPECT_TRUE(info.GetArticleInfos().empty());
+  EXPECT_FALSE(info.PickAndConsumeWeighted("all", weigh_all));
+}
+
 TEST(BraveNewsFeedSampling, GetArticleInfosSkipsNull) {
   auto [locale, items, publishers, signals, topics] = MockFetchedData();
   items.push_back(nullptr);
 
-  EXPECT_EQ(
-      0u, GetArticleInfosForTesting(locale, items, publishers, signals).size());
+  StringInterner interner;
+  EXPECT_EQ(0u,
+            GetArticleInfosForTesting(locale, items, publishers, signals,
+                                      interner)
+                .size());
 }
 
 TEST(BraveNewsFeedSampling, GetArticleInfosSkipsNonArticles) {
@@ -217,8 +253,11 @@ TEST(BraveNewsFeedSampling, GetArticleInfosSkipsNonArticles) {
   items.push_back(MakeArticleItem("two"));
   items.push_back(mojom::FeedItem::NewDeal(mojom::Deal::New()));
 
-  EXPECT_EQ(
-      2u, GetArticleInfosForTesting(locale, items, publishers, signals).size());
+  StringInterner interner;
+  EXPECT_EQ(2u,
+            GetArticleInfosForTesting(locale, items, publishers, signals,
+                                      interner)
+                .size());
 }
 
 TEST(BraveNewsFeedSampling, GetArticleInfosDuplicatesExcluded) {
@@ -228,8 +267,11 @@ TEST(BraveNewsFeedSampling, GetArticleInfosDuplicatesExcluded) {
   items.push_back(item->Clone());
   items.push_back(std::move(item));
 
-  EXPECT_EQ(
-      1u, GetArticleInfosForTesting(locale, items, publishers, signals).size());
+  StringInterner interner;
+  EXPECT_EQ(1u,
+            GetArticleInfosForTesting(locale, items, publishers, signals,
+                                      interner)
+                .size());
 }
 TEST(BraveNewsFeedSampling, GetArticleInfosUnknownPublishersSkipped) {
   auto [locale, items, publishers, signals, topics] = MockFetchedData();
@@ -237,8 +279,11 @@ TEST(BraveNewsFeedSampling, GetArticleInfosUnknownPublishersSkipped) {
   items.push_back(MakeArticleItem("one"));
   items.push_back(MakeArticleItem("not-a-real-publisher"));
 
-  EXPECT_EQ(
-      1u, GetArticleInfosForTesting(locale, items, publishers, signals).size());
+  StringInterner interner;
+  EXPECT_EQ(1u,
+            GetArticleInfosForTesting(locale, items, publishers, signals,
+                                      interner)
+                .size());
 }
 
 TEST(BraveNewsFeedSampling, GetArticleInfosDisabledArticlesExcluded) {
@@ -247,8 +292,11 @@ TEST(BraveNewsFeedSampling, GetArticleInfosDisabledArticlesExcluded) {
   items.push_back(MakeArticleItem("disabled"));
   items.push_back(MakeArticleItem("one"));
 
-  EXPECT_EQ(
-      1u, GetArticleInfosForTesting(locale, items, publishers, signals).size());
+  StringInterner interner;
+  EXPECT_EQ(1u,
+            GetArticleInfosForTesting(locale, items, publishers, signals,
+                                      interner)
+                .size());
 }
 
 TEST(BraveNewsFeedSampling, GetArticleInfosUsesCorrectSignals) {
@@ -259,7 +307,9 @@ TEST(BraveNewsFeedSampling, GetArticleInfosUsesCorrectSignals) {
   items.push_back(MakeArticleItem("two"));
   items.push_back(MakeArticleItem("not-a-real-publisher"));
 
-  auto infos = GetArticleInfosForTesting(locale, items, publishers, signals);
+  StringInterner interner;
+  auto infos =
+      GetArticleInfosForTesting(locale, items, publishers, signals, interner);
   EXPECT_EQ(2u, infos.size());
 
   auto& [article0, weight0] = infos.at(0);
@@ -273,4 +323,20 @@ TEST(BraveNewsFeedSampling, GetArticleInfosUsesCorrectSignals) {
   EXPECT_TRUE(weight1.subscribed);
 }
 
+TEST(BraveNewsFeedSampling, StringInternerKeepsOneCopy) {
+  StringInterner interner;
+  std::string channel = kTopNewsChannel;
+  auto first = interner.Intern(channel);
+  channel.clear();
+
+  EXPECT_EQ(kTopNewsChannel, first);
+  EXPECT_EQ(first.data(), interner.Intern(kTopNewsChannel).data());
+  EXPECT_EQ(1u, interner.size());
+
+  // Interned views survive moving the interner.
+  StringInterner moved = std::move(interner);
+  EXPECT_EQ(first.data(), moved.Intern(kTopNewsChannel).data());
+  EXPECT_EQ(1u, moved.size());
+}
+
 }  // namespace brave_news
@@ -6,22 +6,110 @@
 #include "brave/components/brave_news/browser/feed_sampling.h"
 
 #include <algorithm>
+#include <bit>
 #include <numeric>
 #include <optional>
+#include <utility>
 #include <vector>
 
+#include "base/check_op.h"
 #include "base/functional/bind.h"
 #include "base/functional/callback.h"
+#include "base/notreached.h"
 #include "base/rand_util.h"
 #include "brave/components/brave_news/common/brave_news.mojom.h"
 
 namespace brave_news {
 
+namespace {
+
+// The range of weights covered by a node of a Fenwick tree.
+size_t LowestSetBit(size_t i) {
+  return i & (~i + 1);
+}
+
+}  // namespace
+
 ArticleMetadata::ArticleMetadata() = default;
 ArticleMetadata::~ArticleMetadata() = default;
 ArticleMetadata::ArticleMetadata(ArticleMetadata&&) = default;
 ArticleMetadata& ArticleMetadata::operator=(ArticleMetadata&&) = default;
 
+WeightedSampler::WeightedSampler(std::vector<double> weights)
+    : weights_(std::move(weights)), tree_(weights_.size() + 1, 0.0) {
+  // Builds the tree in linear time by pushing each node's sum up to its
+  // parent.
+  for (size_t i = 1; i <= weights_.size(); ++i) {
+    auto& weight = weights_[i - 1];
+    if (weight > 0) {
+      remaining_++;
+    } else {
+      weight = 0;
+    }
+    tree_[i] += weight;
+    const size_t parent = i + LowestSetBit(i);
+    if (parent <= weights_.size()) {
+      tree_[parent] += tree_[i];
+    }
+  }
+}
+
+WeightedSampler::WeightedSampler(WeightedSampler&&) = default;
+WeightedSampler& WeightedSampler::operator=(WeightedSampler&&) = default;
+WeightedSampler::~WeightedSampler() = default;
+
+std::optional<size_t> WeightedSampler::Sample() const {
+  if (remaining_ == 0) {
+    return std::nullopt;
+  }
+
+  double total_weight = 0;
+  for (size_t i = weights_.size(); i > 0; i -= LowestSetBit(i)) {
+    total_weight += tree_[i];
+  }
+
+  // Find the first index whose cumulative weight is above the picked value.
+  double picked_value = base::RandDouble() * total_weight;
+  size_t index = 0;
+  for (size_t step = std::bit_floor(weights_.size()); step > 0; step >>= 1) {
+    if (index + step <= weights_.size() &&
+        tree_[index + step] <= picked_value) {
+      index += step;
+      picked_value -= tree_[index];
+    }
+  }
+
+  // Rounding errors left behind by removals could land us on an index which
+  // has already been removed, in which case we take the closest one left.
+  index = std::min(index, weights_.size() - 1);
+  if (weights_[index] > 0) {
+    return index;
+  }
+  for (size_t i = 1; i < weights_.size(); ++i) {
+    if (index >= i && weights_[index - i] > 0) {
+      return index - i;
+    }
+    if (index + i < weights_.size() && weights_[index + i] > 0) {
+      return index + i;
+    }
+  }
+  NOTREACHED();
+}
+
+void WeightedSampler::Remove(size_t index) {
+  CHECK_LT(index, weights_.size());
+  const double weight = weights_[index];
+  if (weight == 0) {
+    return;
+  }
+
+  weights_[index] = 0;
+  remaining_--;
+  for (size_t i = index + 1; i <= weights_.size(); i += LowestSetBit(i)) {
+    tree_[i] -= weight;
+  }
+}
+
 ContentGroup SampleContentGroup(
     base::span<const ContentGroup> eligible_content_groups) {
   ContentGroup sampled_content_group;
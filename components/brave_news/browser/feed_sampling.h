@@ -9,6 +9,7 @@
 #include <cstddef>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -44,8 +45,10 @@ struct ArticleMetadata {
   // content should not be used for discovery.
   bool discoverable = false;
 
-  // All the channels this Article belongs to.
-  base::flat_set<std::string> channels;
+  // All the channels this Article belongs to. These are interned by the
+  // StringInterner which was used to build the article, and are only valid
+  // while it is alive.
+  base::flat_set<std::string_view> channels;
 
   ArticleMetadata();
   ArticleMetadata(const ArticleMetadata&) = delete;
@@ -71,6 +74,34 @@ using PickArticles =
     base::RepeatingCallback<std::optional<size_t>(const ArticleInfos& infos)>;
 using ContentGroup = std::pair<std::string, bool>;
 
+// Samples indices with a probability proportional to their weight. Sampling
+// and removing an index are both O(log n), as the weights are kept in a
+// Fenwick tree, so articles don't need to be weighed again for every pick.
+class WeightedSampler {
+ public:
+  explicit WeightedSampler(std::vector<double> weights);
+  WeightedSampler(const WeightedSampler&) = delete;
+  WeightedSampler& operator=(const WeightedSampler&) = delete;
+  WeightedSampler(WeightedSampler&&);
+  WeightedSampler& operator=(WeightedSampler&&);
+  ~WeightedSampler();
+
+  // Returns std::nullopt if none of the remaining indices has any weight.
+  std::optional<size_t> Sample() const;
+
+  // Removes |index| so it won't be sampled anymore.
+  void Remove(size_t index);
+
+  size_t size() const { return weights_.size(); }
+
+ private:
+  std::vector<double> weights_;
+  std::vector<double> tree_;
+
+  // The number of indices which still have a positive weight.
+  size_t remaining_ = 0;
+};
+
 template <typename T>
 T PickRandom(const base::span<T>& items) {
   CHECK(!items.empty());
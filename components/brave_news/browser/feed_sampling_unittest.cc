@@ -120,4 +120,37 @@ TEST(BraveNewsFeedSampling, PickRouletteWithWeighting) {
   EXPECT_EQ(2, PickRouletteWithWeighting(infos, make_picker_for(third)));
 }
 
+TEST(BraveNewsFeedSampling, WeightedSamplerOnlySamplesWeightedIndices) {
+  EXPECT_EQ(std::nullopt, WeightedSampler(std::vector<double>()).Sample());
+  EXPECT_EQ(std::nullopt, WeightedSampler({0.0, 0.0, -1.0}).Sample());
+
+  WeightedSampler sampler({0.0, 1.0, 0.0, 2.0, 0.0});
+  constexpr int iterations = 1000;
+  for (auto i = 0; i < iterations; ++i) {
+    auto index = sampler.Sample();
+    ASSERT_TRUE(index.has_value());
+    EXPECT_TRUE(index == 1u || index == 3u);
+  }
+}
+
+TEST(BraveNewsFeedSampling, WeightedSamplerRemovesIndices) {
+  std::vector<double> weights(100, 0.5);
+  WeightedSampler sampler(weights);
+
+  // Every sample is removed, so each index is sampled exactly once.
+  std::vector<bool> sampled(weights.size(), false);
+  for (size_t i = 0; i < weights.size(); ++i) {
+    auto index = sampler.Sample();
+    ASSERT_TRUE(index.has_value());
+    EXPECT_FALSE(sampled[*index]);
+    sampled[*index] = true;
+    sampler.Remove(*index);
+  }
+  EXPECT_EQ(std::nullopt, sampler.Sample());
+
+  // Removing an index twice doesn't break anything.
+  sampler.Remove(0);
+  EXPECT_EQ(std::nullopt, sampler.Sample());
+}
+
 }  // namespace brave_news
@@ -19,6 +19,7 @@
 #include "base/containers/flat_map.h"
 #include "base/containers/map_util.h"
 #include "base/containers/span.h"
+#include "base/feature_list.h"
 #include "base/functional/bind.h"
 #include "base/functional/callback_forward.h"
 #include "base/functional/callback_helpers.h"
@@ -28,6 +29,7 @@
 #include "base/memory/weak_ptr.h"
 #include "base/notreached.h"
 #include "base/rand_util.h"
+#include "base/strings/strcat.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/time/time.h"
 #include "brave/components/brave_news/api/topics.h"
@@ -93,20 +95,131 @@ std::tuple<std::string, size_t> GetFeedHashAndSubscribedCount(
   return {hash, subscribed_count};
 }
 
+// Returns a key identifying a feed of |type| generated for |subscriptions|.
+std::string GetFeedCacheKey(const mojom::FeedV2Type& type,
+                            const SubscriptionsSnapshot& subscriptions) {
+  std::vector<std::string> hash_items;
+  for (const auto& id : subscriptions.enabled_publishers()) {
+    hash_items.push_back(id);
+  }
+  for (const auto& id : subscriptions.disabled_publishers()) {
+    hash_items.push_back(id + "_disabled");
+  }
+  for (const auto& direct_feed : subscriptions.direct_feeds()) {
+    hash_items.push_back(direct_feed.id);
+  }
+  for (const auto& [locale, channels] : subscriptions.channels()) {
+    for (const auto& channel : channels) {
+      hash_items.push_back(locale + channel);
+    }
+  }
+
+  std::hash<std::string> hasher;
+  std::string hash;
+  for (const auto& hash_item : hash_items) {
+    hash = base::NumberToString(hasher(hash + hash_item));
+  }
+
+  switch (type.which()) {
+    case mojom::FeedV2Type::Tag::kAll:
+      return base::StrCat({"all:", hash});
+    case mojom::FeedV2Type::Tag::kFollowing:
+      return base::StrCat({"following:", hash});
+    case mojom::FeedV2Type::Tag::kPublisher:
+      return base::StrCat(
+          {"publisher:", type.get_publisher()->publisher_id, ":", hash});
+    case mojom::FeedV2Type::Tag::kChannel:
+      return base::StrCat({"channel:", type.get_channel()->channel, ":", hash});
+  }
+  NOTREACHED();
+}
+
+using PublisherIdToChannels =
+    base::RefCountedData<base::flat_map<std::string, std::vector<std::string>>>;
+
+// Picks and consumes the next article of a block from |info|, or returns
+// nullptr if no article could be picked.
+using ArticleConsumer =
+    base::RepeatingCallback<mojom::FeedItemMetadataPtr(FeedGenerationInfo&)>;
+
+ArticleConsumer ConsumeWithPicker(PickArticles picker) {
+  return base::BindRepeating(
+      [](const PickArticles& picker, FeedGenerationInfo& info) {
+        return info.PickAndConsume(picker);
+      },
+      std::move(picker));
+}
+
+// Consumes articles with a roulette selection over |get_weighting|. The
+// weights are only computed the first time |sampler_key| is used by |info|.
+ArticleConsumer ConsumeWeighted(std::string sampler_key,
+                                GetWeighting get_weighting) {
+  return base::BindRepeating(
+      [](const std::string& sampler_key, const GetWeighting& get_weighting,
+         FeedGenerationInfo& info) {
+        return info.PickAndConsumeWeighted(sampler_key, get_weighting);
+      },
+      std::move(sampler_key), std::move(get_weighting));
+}
+
+// Picking a discovery article works the same way as as a normal roulette
+// selection, but we only consider articles that:
+// 1. The user hasn't subscribed to.
+// 2. **AND** The user hasn't visited.
+double GetDiscoverWeighting(const mojom::FeedItemMetadataPtr& data,
+                            const ArticleMetadata& meta) {
+  if (!meta.discoverable) {
+    return 0.0;
+  }
+
+  if (meta.subscribed) {
+    return 0.0;
+  }
+  return meta.pop_recency;
+}
+
+double GetContentGroupWeighting(
+    bool is_hero,
+    const ContentGroup& content_group,
+    const scoped_refptr<PublisherIdToChannels>& publisher_id_to_channels,
+    const mojom::FeedItemMetadataPtr& article,
+    const ArticleMetadata& meta) {
+  if (is_hero) {
+    const auto& image_url = article->image->is_padded_image_url()
+                                ? article->image->get_padded_image_url()
+                                : article->image->get_image_url();
+    if (!image_url.is_valid()) {
+      return 0.0;
+    }
+  }
+
+  if (/*is_channel*/ content_group.second) {
+    auto channels = publisher_id_to_channels->data.find(article->publisher_id);
+    if (base::Contains(channels->second, content_group.first)) {
+      return meta.weighting;
+    }
+
+    return 0.0;
+  }
+
+  return article->publisher_id == content_group.first ? meta.weighting : 0.0;
+}
+
 // Generates a standard block:
 // 1. Hero Article
 // 2. 1 - 5 Inline Articles (a percentage of which might be discover cards).
-std::vector<mojom::FeedItemV2Ptr> GenerateBlock(FeedGenerationInfo& info,
-                                                PickArticles hero_picker,
-                                                PickArticles article_picker,
-                                                double inline_discovery_ratio) {
+std::vector<mojom::FeedItemV2Ptr> GenerateBlock(
+    FeedGenerationInfo& info,
+    const ArticleConsumer& consume_hero,
+    const ArticleConsumer& consume_article,
+    double inline_discovery_ratio) {
   DVLOG(1) << __FUNCTION__;
   std::vector<mojom::FeedItemV2Ptr> result;
   if (info.GetArticleInfos().empty()) {
     return result;
   }
 
-  auto hero_article = info.PickAndConsume(hero_picker);
+  auto hero_article = consume_hero.Run(info);
 
   // We might not be able to generate a hero card, if none of the articles in
   // this feed have an image.
@@ -123,28 +236,10 @@ std::vector<mojom::FeedItemV2Ptr> GenerateBlock(FeedGenerationInfo& info,
     mojom::FeedItemMetadataPtr generated;
 
     if (is_discover) {
-      // Picking a discovery article works the same way as as a normal roulette
-      // selection, but we only consider articles that:
-      // 1. The user hasn't subscribed to.
-      // 2. **AND** The user hasn't visited.
-      generated = info.PickAndConsume(
-          base::BindRepeating([](const ArticleInfos& articles) {
-            return PickRouletteWithWeighting(
-                articles,
-                base::BindRepeating([](const mojom::FeedItemMetadataPtr& data,
-                                       const ArticleMetadata& meta) {
-                  if (!meta.discoverable) {
-                    return 0.0;
-                  }
-
-                  if (meta.subscribed) {
-                    return 0.0;
-                  }
-                  return meta.pop_recency;
-                }));
-          }));
+      generated = info.PickAndConsumeWeighted(
+          "discover", base::BindRepeating(&GetDiscoverWeighting));
     } else {
-      generated = info.PickAndConsume(article_picker);
+      generated = consume_article.Run(info);
     }
 
     if (!generated) {
@@ -181,8 +276,6 @@ std::vector<mojom::FeedItemV2Ptr> GenerateBlockFromContentGroups(
     return result;
   }
 
-  using PublisherIdToChannels = base::RefCountedData<
-      base::flat_map<std::string, std::vector<std::string>>>;
   scoped_refptr<PublisherIdToChannels> publisher_id_to_channels =
       base::MakeRefCounted<PublisherIdToChannels>();
 
@@ -191,67 +284,37 @@ std::vector<mojom::FeedItemV2Ptr> GenerateBlockFromContentGroups(
         GetChannelsForPublisher(info.locale(), publisher);
   }
 
-  // Generates a GetWeighting function tied to a specific content group. Each
-  // invocation of |get_weighting| will generate a new |GetWeighting| tied to a
-  // (freshly sampled) content_group.
-  auto get_weighting = base::BindRepeating(
-      [](const std::string& locale,
-         std::vector<ContentGroup> eligible_content_groups,
+  // Each invocation of |consume_from_content_group| picks an article from a
+  // freshly sampled content_group. The weights of a content group don't change
+  // during feed generation, so the sampler for it is only built once.
+  auto consume_from_content_group = base::BindRepeating(
+      [](std::vector<ContentGroup> eligible_content_groups,
          scoped_refptr<PublisherIdToChannels> publisher_id_to_channels,
-         bool is_hero) {
-        return base::BindRepeating(
-            [](const bool is_hero, const ContentGroup& content_group,
-               const scoped_refptr<PublisherIdToChannels>&
-                   publisher_id_to_channels,
-               const std::string& locale,
-               const mojom::FeedItemMetadataPtr& article,
-               const ArticleMetadata& meta) {
-              if (is_hero) {
-                const auto& image_url =
-                    article->image->is_padded_image_url()
-                        ? article->image->get_padded_image_url()
-                        : article->image->get_image_url();
-                if (!image_url.is_valid()) {
-                  return 0.0;
-                }
-              }
-
-              if (/*is_channel*/ content_group.second) {
-                auto channels =
-                    publisher_id_to_channels->data.find(article->publisher_id);
-                if (base::Contains(channels->second, content_group.first)) {
-                  return meta.weighting;
-                }
-
-                return 0.0;
-              }
-
-              return article->publisher_id == content_group.first
-                         ? meta.weighting
-                         : 0.0;
-            },
-            is_hero, SampleContentGroup(eligible_content_groups),
-            publisher_id_to_channels, locale);
+         bool is_hero, FeedGenerationInfo& info) {
+        auto content_group = SampleContentGroup(eligible_content_groups);
+        auto sampler_key = base::StrCat(
+            {is_hero ? "hero:" : "article:",
+             content_group.second ? "channel:" : "publisher:",
+             content_group.first});
+        return info.PickAndConsumeWeighted(
+            sampler_key,
+            base::BindRepeating(&GetContentGroupWeighting, is_hero,
+                                std::move(content_group),
+                                publisher_id_to_channels));
       },
-      info.locale(), std::move(eligible_content_groups),
-      std::move(publisher_id_to_channels));
+      std::move(eligible_content_groups), std::move(publisher_id_to_channels));
 
+  ArticleConsumer consume_hero;
   if (pick_hero.is_null()) {
-    pick_hero = base::BindRepeating(
-        [](GetWeighting weighting, const ArticleInfos& articles) {
-          return PickRouletteWithWeighting(articles, std::move(weighting));
-        },
-        get_weighting.Run(true));
+    consume_hero = base::BindRepeating(consume_from_content_group, true);
+  } else {
+    consume_hero = ConsumeWithPicker(std::move(pick_hero));
   }
+  ArticleConsumer consume_article =
+      base::BindRepeating(consume_from_content_group, false);
 
-  PickArticles pick_article = base::BindRepeating(
-      [](base::RepeatingCallback<GetWeighting(bool)> gen_weighting,
-         const ArticleInfos& articles) {
-        return PickRouletteWithWeighting(articles, gen_weighting.Run(false));
-      },
-      std::move(get_weighting));
-
-  return GenerateBlock(info, pick_hero, pick_article, inline_discovery_ratio);
+  return GenerateBlock(info, consume_hero, consume_article,
+                       inline_discovery_ratio);
 }
 
 // Generates a Channel Block
@@ -265,8 +328,17 @@ std::vector<mojom::FeedItemV2Ptr> GenerateChannelBlock(
     const std::string& channel) {
   DVLOG(1) << __FUNCTION__;
 
-  auto channel_picker = base::BindRepeating(&PickChannelRoulette, channel);
-  auto block = GenerateBlock(info, channel_picker, channel_picker, 0);
+  auto consume_from_channel = ConsumeWeighted(
+      base::StrCat({"channel:", channel}),
+      base::BindRepeating(
+          [](const std::string& channel,
+             const mojom::FeedItemMetadataPtr& metadata,
+             const ArticleMetadata& weight) {
+            return weight.channels.contains(channel) ? weight.weighting : 0.0;
+          },
+          channel));
+  auto block =
+      GenerateBlock(info, consume_from_channel, consume_from_channel, 0);
 
   // If we didn't manage to generate a block, don't return any elements.
   if (block.empty()) {
@@ -482,11 +554,16 @@ mojom::FeedV2Ptr FeedV2Builder::GenerateBasicFeed(FeedGenerationInfo info,
   DVLOG(1) << __FUNCTION__;
   auto feed = mojom::FeedV2::New();
 
+  const auto consume_hero = ConsumeWithPicker(std::move(pick_hero));
+  const auto consume_article = ConsumeWithPicker(std::move(pick_article));
+  const auto consume_peeking = ConsumeWithPicker(std::move(pick_peeking));
+
   constexpr size_t kIterationsPerAd = 2;
   size_t blocks = 0;
   while (!info.GetArticleInfos().empty()) {
     auto items = GenerateBlock(
-        info, feed->items.empty() ? pick_peeking : pick_hero, pick_article,
+        info, feed->items.empty() ? consume_peeking : consume_hero,
+        consume_article,
         /*inline_discovery_ratio=*/0);
     if (items.empty()) {
       break;
@@ -626,7 +703,8 @@ FeedV2Builder::FeedV2Builder(
       topics_fetcher_(url_loader_factory),
       signal_calculator_(publishers_controller,
                          channels_controller,
-                         history_querier) {}
+                         history_querier),
+      feed_cache_(kMaxCachedFeeds) {}
 
 FeedV2Builder::~FeedV2Builder() = default;
 
@@ -989,18 +1067,45 @@ void FeedV2Builder::NotifyUpdateCompleted() {
   }
 }
 
+mojom::FeedV2Ptr FeedV2Builder::GetCachedFeed(const std::string& cache_key) {
+  auto it = feed_cache_.Get(cache_key);
+  if (it == feed_cache_.end()) {
+    return nullptr;
+  }
+
+  if (hash_.empty() || it->second->source_hash != hash_) {
+    feed_cache_.Erase(it);
+    return nullptr;
+  }
+
+  return it->second->Clone();
+}
+
 void FeedV2Builder::GenerateFeed(const SubscriptionsSnapshot& subscriptions,
                                  UpdateSettings settings,
                                  mojom::FeedV2TypePtr type,
                                  FeedGenerator generator,
                                  BuildFeedCallback callback) {
+  std::string cache_key;
+  if (base::FeatureList::IsEnabled(features::kBraveNewsFeedCacheFeature)) {
+    cache_key = GetFeedCacheKey(*type, subscriptions);
+    // While an update is in progress the data might be about to change, so
+    // the cache is only used when nothing is pending.
+    if (!current_update_) {
+      if (auto feed = GetCachedFeed(cache_key)) {
+        std::move(callback).Run(std::move(feed));
+        return;
+      }
+    }
+  }
+
   UpdateData(
       subscriptions, std::move(settings),
       base::BindOnce(
           [](const base::WeakPtr<FeedV2Builder> builder,
              const SubscriptionsSnapshot& subscriptions,
-             mojom::FeedV2TypePtr type, FeedGenerator generate,
-             BuildFeedCallback callback) {
+             mojom::FeedV2TypePtr type, const std::string& cache_key,
+             FeedGenerator generate, BuildFeedCallback callback) {
             if (!builder) {
               std::move(callback).Run(mojom::FeedV2::New());
               return;
@@ -1047,10 +1152,14 @@ void FeedV2Builder::GenerateFeed(const SubscriptionsSnapshot& subscriptions,
               }
             }
 
+            if (!cache_key.empty()) {
+              builder->feed_cache_.Put(cache_key, feed->Clone());
+            }
+
             std::move(callback).Run(std::move(feed));
           },
           weak_ptr_factory_.GetWeakPtr(), subscriptions, std::move(type),
-          std::move(generator), std::move(callback)));
+          std::move(cache_key), std::move(generator), std::move(callback)));
 }
 
 }  // namespace brave_news
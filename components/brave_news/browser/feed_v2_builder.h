@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/lru_cache.h"
 #include "base/functional/callback_forward.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
@@ -76,6 +77,9 @@ class FeedV2Builder {
   using FeedGenerator =
       base::OnceCallback<mojom::FeedV2Ptr(FeedGenerationInfo)>;
 
+  // The number of generated feeds which are kept by |feed_cache_|.
+  static constexpr size_t kMaxCachedFeeds = 8;
+
   using UpdateCallback = base::OnceClosure;
   struct UpdateSettings {
     bool signals = false;
@@ -150,6 +154,10 @@ class FeedV2Builder {
 
   void NotifyUpdateCompleted();
 
+  // Returns a copy of the feed generated for |cache_key| if it was generated
+  // from the current data, or nullptr.
+  mojom::FeedV2Ptr GetCachedFeed(const std::string& cache_key);
+
   void GenerateFeed(const SubscriptionsSnapshot& subscriptions,
                     UpdateSettings settings,
                     mojom::FeedV2TypePtr type,
@@ -176,6 +184,10 @@ class FeedV2Builder {
   std::optional<UpdateRequest> current_update_;
   std::optional<UpdateRequest> next_update_;
 
+  // Generated feeds, keyed by feed type and subscriptions. Entries are only
+  // served while their |source_hash| matches |hash_|.
+  base::LRUCache<std::string, mojom::FeedV2Ptr> feed_cache_;
+
   mojo::RemoteSet<mojom::FeedListener> listeners_;
 
   base::WeakPtrFactory<FeedV2Builder> weak_ptr_factory_{this};
@@ -37,13 +37,29 @@ constexpr auto kSupportedRels =
                                                  "service.feed",
                                              });
 
+constexpr std::string_view kHeadEndTag = "</head";
+
+// Returns the part of |raw_body| up to the end of its head, or all of it when
+// there is no closing head tag.
+std::string_view GetDocumentHead(std::string_view raw_body) {
+  for (size_t pos = raw_body.find('<'); pos != std::string_view::npos;
+       pos = raw_body.find('<', pos + 1)) {
+    if (base::StartsWith(raw_body.substr(pos), kHeadEndTag,
+                         base::CompareCase::INSENSITIVE_ASCII)) {
+      return raw_body.substr(0, pos);
+    }
+  }
+  return raw_body;
+}
+
 }  // namespace
 
 std::vector<GURL> GetFeedURLsFromHTMLDocument(const std::string& charset,
-                                              const std::string& raw_body,
+                                              std::string_view raw_body,
                                               const GURL& html_url) {
   std::string html_body;
-  if (!base::ConvertToUtf8AndNormalize(raw_body, charset, &html_body)) {
+  if (!base::ConvertToUtf8AndNormalize(GetDocumentHead(raw_body), charset,
+                                       &html_body)) {
     return std::vector<GURL>();
   }
 
@@ -7,14 +7,18 @@
 #define BRAVE_COMPONENTS_BRAVE_NEWS_BROWSER_HTML_PARSING_H_
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 class GURL;
 
 namespace brave_news {
 
+// Feed links are only looked up in the document head, so anything after the
+// first `</head>` is never converted nor scanned. This may be slow on large
+// documents and is meant to be called from a background task.
 std::vector<GURL> GetFeedURLsFromHTMLDocument(const std::string& charset,
-                                              const std::string& html_body,
+                                              std::string_view html_body,
                                               const GURL& html_url);
 
 }  // namespace brave_news
@@ -84,4 +84,19 @@ TEST(BraveNewsHTMLParsing, GetFeedUrlsFromHTML) {
   ASSERT_EQ(feed_urls[1].spec(), "https://www.example.com/rss-relative-test");
 }
 
+TEST(BraveNewsHTMLParsing, OnlyParsesDocumentHead) {
+  GURL site_url = GURL("https://www.example.com/page");
+  constexpr char kHTML[] = R"(
+    <html><head>
+      <link rel="alternate" type="application/rss+xml" href="/head-feed" />
+    </HEAD>
+    <body>
+      <link rel="alternate" type="application/rss+xml" href="/body-feed" />
+    </body></html>
+  )";
+  auto feed_urls = GetFeedURLsFromHTMLDocument("utf8", kHTML, site_url);
+  ASSERT_EQ(feed_urls.size(), 1u);
+  EXPECT_EQ(feed_urls[0].spec(), "https://www.example.com/head-feed");
+}
+
 }  // namespace brave_news
@@ -5,8 +5,8 @@
 
 #include "brave/components/brave_news/browser/signal_calculator.h"
 
-#include <algorithm>
-#include <iterator>
+#include <functional>
+#include <map>
 #include <string>
 #include <utility>
 #include <vector>
@@ -86,19 +86,22 @@ void SignalCalculator::OnGotHistory(
     }
   }
 
-  base::flat_map<std::string_view, std::vector<std::string>> origin_visits;
+  // Only the number of visits to each host is needed, so the visited urls are
+  // not kept around.
+  std::map<std::string, size_t, std::less<>> host_visits;
   for (const auto& item : results) {
-    auto host = item.url().host();
-    origin_visits[host].push_back(item.url().spec());
+    host_visits[std::string(item.url().host())]++;
   }
 
   // Start at one - it'll make the calculations very slightly off but it also
   // means we'll never divide by zero, and it will be consistent.
-  uint32_t total_publisher_visits = 1;
-  uint32_t total_channel_visits = 1;
+  size_t total_publisher_visits = 1;
+  size_t total_channel_visits = 1;
 
-  base::flat_map<std::string, std::vector<std::string>> publisher_visits;
-  base::flat_map<std::string, std::vector<std::string>> channel_visits;
+  // Visits of each publisher, in the order of |publishers|.
+  std::vector<size_t> publisher_visits;
+  publisher_visits.reserve(publishers.size());
+  std::map<std::string, size_t, std::less<>> channel_visits;
 
   for (auto& [publisher_id, publisher] : publishers) {
     auto host = publisher->site_url.host();
@@ -108,15 +111,13 @@ void SignalCalculator::OnGotHistory(
       host = publisher->feed_source.host();
     }
 
-    auto* visits = base::FindOrNull(origin_visits, host);
+    auto* visits = base::FindOrNull(host_visits, host);
+    publisher_visits.push_back(visits ? *visits : 0);
     if (!visits) {
-      publisher_visits[publisher_id] = {};
       continue;
     }
 
-    std::ranges::copy(*visits,
-                      std::back_inserter(publisher_visits[publisher_id]));
-    total_publisher_visits += visits->size();
+    total_publisher_visits += *visits;
 
     for (const auto& locale_info : publisher->locales) {
       if (locale_info->locale != locale) {
@@ -124,8 +125,8 @@ void SignalCalculator::OnGotHistory(
       }
 
       for (const auto& channel : locale_info->channels) {
-        total_channel_visits += visits->size();
-        std::ranges::copy(*visits, std::back_inserter(channel_visits[channel]));
+        total_channel_visits += *visits;
+        channel_visits[channel] += *visits;
       }
       break;
     }
@@ -134,20 +135,21 @@ void SignalCalculator::OnGotHistory(
   Signals signals;
 
   // Add publisher signals
+  size_t publisher_index = 0;
   for (const auto& [id, publisher] : publishers) {
-    const auto& visits = publisher_visits.at(publisher->publisher_id);
+    const size_t visits = publisher_visits[publisher_index++];
     auto disabled =
         publisher->user_enabled_status == mojom::UserEnabled::DISABLED;
     signals[id] = mojom::Signal::New(
         disabled, GetSubscribedWeight(publisher),
-        visits.size() / static_cast<double>(total_publisher_visits),
+        visits / static_cast<double>(total_publisher_visits),
         article_counts[id]);
   }
 
   // Add channel signals
   for (const auto& channel : channels) {
-    auto* channel_visit_vec = base::FindOrNull(channel_visits, channel.first);
-    auto visit_count = channel_visit_vec ? channel_visit_vec->size() : 0;
+    auto* channel_visit_count = base::FindOrNull(channel_visits, channel.first);
+    auto visit_count = channel_visit_count ? *channel_visit_count : 0;
     signals[channel.first] = mojom::Signal::New(
         /*disabled=*/false,
         subscriptions.GetChannelSubscribed(locale, channel.first)
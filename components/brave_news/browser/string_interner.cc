@@ -0,0 +1,26 @@
+// Copyright (c) 2026 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "brave/components/brave_news/browser/string_interner.h"
+
+#include <string>
+#include <string_view>
+
+namespace brave_news {
+
+StringInterner::StringInterner() = default;
+StringInterner::StringInterner(StringInterner&&) = default;
+StringInterner& StringInterner::operator=(StringInterner&&) = default;
+StringInterner::~StringInterner() = default;
+
+std::string_view StringInterner::Intern(std::string_view value) {
+  auto it = strings_.find(value);
+  if (it == strings_.end()) {
+    it = strings_.emplace(value).first;
+  }
+  return *it;
+}
+
+}  // namespace brave_news
@@ -0,0 +1,41 @@
+// Copyright (c) 2026 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef BRAVE_COMPONENTS_BRAVE_NEWS_BROWSER_STRING_INTERNER_H_
+#define BRAVE_COMPONENTS_BRAVE_NEWS_BROWSER_STRING_INTERNER_H_
+
+#include <cstddef>
+#include <functional>
+#include <set>
+#include <string>
+#include <string_view>
+
+namespace brave_news {
+
+// Keeps a single copy of identifiers which are repeated across many articles,
+// such as publisher ids and channel names. The views returned by |Intern| stay
+// valid for as long as the interner (or the interner it is moved into) lives,
+// so they can be stored instead of copying the string for every article.
+class StringInterner {
+ public:
+  StringInterner();
+  StringInterner(const StringInterner&) = delete;
+  StringInterner& operator=(const StringInterner&) = delete;
+  StringInterner(StringInterner&&);
+  StringInterner& operator=(StringInterner&&);
+  ~StringInterner();
+
+  std::string_view Intern(std::string_view value);
+
+  size_t size() const { return strings_.size(); }
+
+ private:
+  // Nodes of a std::set are never relocated, which keeps the views stable.
+  std::set<std::string, std::less<>> strings_;
+};
+
+}  // namespace brave_news
+
+#endif  // BRAVE_COMPONENTS_BRAVE_NEWS_BROWSER_STRING_INTERNER_H_
@@ -15,6 +15,14 @@ BASE_FEATURE(kBraveNewsCardPeekFeature,
              "BraveNewsCardPeek",
              base::FEATURE_ENABLED_BY_DEFAULT);
 
+BASE_FEATURE(kBraveNewsDeferLoadingFeature,
+             "BraveNewsDeferLoading",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
+BASE_FEATURE(kBraveNewsFeedCacheFeature,
+             "BraveNewsFeedCache",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
 BASE_FEATURE(kBraveNewsFeedUpdate,
 #if BUILDFLAG(IS_ANDROID)
              base::FEATURE_DISABLED_BY_DEFAULT
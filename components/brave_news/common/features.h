@@ -13,6 +13,14 @@ namespace brave_news::features {
 
 BASE_DECLARE_FEATURE(kBraveNewsCardPeekFeature);
 
+// When enabled, publishers, channels and the feed aren't loaded at startup,
+// but only once a client (i.e. the New Tab Page) connects to Brave News.
+BASE_DECLARE_FEATURE(kBraveNewsDeferLoadingFeature);
+
+// When enabled, generated feeds are kept and served again until the feed data
+// or the subscriptions change, instead of being regenerated on every request.
+BASE_DECLARE_FEATURE(kBraveNewsFeedCacheFeature);
+
 BASE_DECLARE_FEATURE(kBraveNewsFeedUpdate);
 // The minimum number of cards (following the hero) in a block.
 extern const base::FeatureParam<int> kBraveNewsMinBlockCards;
@@ -5,11 +5,13 @@
 
 #include "brave/components/brave_perf_predictor/browser/named_third_party_registry.h"
 
+#include <functional>
+#include <map>
 #include <optional>
 #include <string_view>
-#include <tuple>
 #include <utility>
 
+#include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
 #include "base/containers/map_util.h"
 #include "base/functional/bind.h"
@@ -17,6 +19,7 @@
 #include "base/logging.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/task/thread_pool.h"
+#include "base/trace_event/trace_event.h"
 #include "base/values.h"
 #include "brave/components/brave_perf_predictor/browser/bandwidth_linreg_parameters.h"
 #include "components/grit/brave_components_resources.h"
@@ -28,13 +31,9 @@ namespace brave_perf_predictor {
 
 namespace {
 
-std::pair<base::flat_map<std::string, std::string>,
-          base::flat_map<std::string, std::string>>
-ParseMappings(std::string_view entities, bool discard_irrelevant) {
-  std::pair<base::flat_map<std::string, std::string>,
-            base::flat_map<std::string, std::string>>
-      result;
-  auto& [entity_by_domain, entity_by_root_domain] = result;
+NamedThirdPartyRegistry::Mappings ParseMappings(std::string_view entities,
+                                                bool discard_irrelevant) {
+  NamedThirdPartyRegistry::Mappings result;
 
   // Parse the JSON
   std::optional<base::Value::List> document = base::JSONReader::ReadList(
@@ -44,7 +43,11 @@ ParseMappings(std::string_view entities, bool discard_irrelevant) {
     return {};
   }
 
-  // Collect the mappings
+  // Collect the mappings into plain containers first and build the flat maps
+  // in one go, rather than paying for a sorted insert per domain.
+  std::vector<std::pair<std::string, size_t>> entity_by_domain;
+  std::map<std::string, std::optional<size_t>, std::less<>>
+      entity_by_root_domain;
   for (auto& item : *document) {
     const auto& entity = item.GetDict();
 
@@ -59,41 +62,63 @@ ParseMappings(std::string_view entities, bool discard_irrelevant) {
     if (!entity_domains)
       continue;
 
+    const size_t entity_index = result.entity_names.size();
+    result.entity_names.push_back(*entity_name);
+
     for (auto& entity_domain_it : *entity_domains) {
       if (!entity_domain_it.is_string()) {
         continue;
       }
       const std::string_view entity_domain(entity_domain_it.GetString());
 
-      const auto inserted =
-          entity_by_domain.emplace(entity_domain, *entity_name);
-      if (!inserted.second) {
-        VLOG(2) << "Malformed data: duplicate domain " << entity_domain;
-      }
+      entity_by_domain.emplace_back(entity_domain, entity_index);
       auto root_domain = net::registry_controlled_domains::GetDomainAndRegistry(
           entity_domain,
           net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
 
       auto root_entity_entry = entity_by_root_domain.find(root_domain);
-      if (root_entity_entry != entity_by_root_domain.end() &&
-          root_entity_entry->second != *entity_name) {
+      if (root_entity_entry == entity_by_root_domain.end()) {
+        entity_by_root_domain.emplace(std::move(root_domain), entity_index);
+      } else if (!root_entity_entry->second) {
+        // A previous clash removed this root domain, the next entity to claim
+        // it takes it over again.
+        root_entity_entry->second = entity_index;
+      } else if (result.entity_names[*root_entity_entry->second] !=
+                 *entity_name) {
         // If there is a clash at root domain level, neither is correct
-        entity_by_root_domain.erase(root_entity_entry);
-      } else {
-        entity_by_root_domain.emplace(root_domain, *entity_name);
+        root_entity_entry->second = std::nullopt;
       }
     }
   }
 
-  entity_by_domain.shrink_to_fit();
-  entity_by_root_domain.shrink_to_fit();
+  // The flat_map constructor keeps the first of any duplicate keys, which
+  // matches the previous emplace-based behaviour.
+  const size_t domain_count = entity_by_domain.size();
+  result.entity_by_domain =
+      base::flat_map<std::string, size_t>(std::move(entity_by_domain));
+  if (result.entity_by_domain.size() != domain_count) {
+    VLOG(2) << "Malformed data: "
+            << domain_count - result.entity_by_domain.size()
+            << " duplicate domains";
+  }
+
+  std::vector<std::pair<std::string, size_t>> root_entries;
+  root_entries.reserve(entity_by_root_domain.size());
+  for (auto& [root_domain, entity_index] : entity_by_root_domain) {
+    if (entity_index) {
+      root_entries.emplace_back(root_domain, *entity_index);
+    }
+  }
+  // `root_entries` is already sorted and unique, coming from a std::map.
+  result.entity_by_root_domain = base::flat_map<std::string, size_t>(
+      base::sorted_unique, std::move(root_entries));
+
+  result.entity_names.shrink_to_fit();
   return result;
 }
 
-std::pair<base::flat_map<std::string, std::string>,
-          base::flat_map<std::string, std::string>>
-ParseFromResource(int resource_id) {
-  // TODO(AndriusA): insert trace event here
+NamedThirdPartyRegistry::Mappings ParseFromResource(int resource_id) {
+  TRACE_EVENT0("brave", "NamedThirdPartyRegistry_ParseFromResource");
   SCOPED_UMA_HISTOGRAM_TIMER(
       "Brave.Savings.NamedThirdPartyRegistry.LoadTimeMS");
   auto& resource_bundle = ui::ResourceBundle::GetSharedInstance();
@@ -105,29 +130,31 @@ ParseFromResource(int resource_id) {
 
 }  // namespace
 
+NamedThirdPartyRegistry::Mappings::Mappings() = default;
+NamedThirdPartyRegistry::Mappings::~Mappings() = default;
+NamedThirdPartyRegistry::Mappings::Mappings(Mappings&&) = default;
+NamedThirdPartyRegistry::Mappings&
+NamedThirdPartyRegistry::Mappings::operator=(Mappings&&) = default;
+
 bool NamedThirdPartyRegistry::LoadMappings(std::string_view entities,
                                            bool discard_irrelevant) {
   // Reset previous mappings
-  entity_by_domain_.clear();
-  entity_by_root_domain_.clear();
   initialized_ = false;
 
-  std::tie(entity_by_domain_, entity_by_root_domain_) =
-      ParseMappings(entities, discard_irrelevant);
-  if (entity_by_domain_.size() == 0 || entity_by_root_domain_.size() == 0)
+  mappings_ = ParseMappings(entities, discard_irrelevant);
+  if (mappings_.entity_by_domain.size() == 0 ||
+      mappings_.entity_by_root_domain.size() == 0)
     return false;
 
   initialized_ = true;
   return true;
 }
 
-void NamedThirdPartyRegistry::UpdateMappings(
-    std::pair<base::flat_map<std::string, std::string>,
-              base::flat_map<std::string, std::string>> entity_mappings) {
-  std::tie(entity_by_domain_, entity_by_root_domain_) =
-      std::move(entity_mappings);
-  VLOG(2) << "Loaded " << entity_by_domain_.size() << " mappings by domain and "
-          << entity_by_root_domain_.size() << " by root domain; size";
+void NamedThirdPartyRegistry::UpdateMappings(Mappings mappings) {
+  mappings_ = std::move(mappings);
+  VLOG(2) << "Loaded " << mappings_.entity_by_domain.size()
+          << " mappings by domain and "
+          << mappings_.entity_by_root_domain.size() << " by root domain; size";
   initialized_ = true;
 }
 
@@ -143,16 +170,17 @@ std::optional<std::string> NamedThirdPartyRegistry::GetThirdParty(
     return std::nullopt;
 
   if (url.has_host()) {
-    if (const auto* entity = base::FindOrNull(entity_by_domain_, url.host())) {
-      return *entity;
+    if (const auto* entity_index =
+            base::FindOrNull(mappings_.entity_by_domain, url.host())) {
+      return mappings_.entity_names[*entity_index];
     }
 
     auto root_domain = net::registry_controlled_domains::GetDomainAndRegistry(
         url, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
 
-    if (const auto* entity =
-            base::FindOrNull(entity_by_root_domain_, root_domain)) {
-      return *entity;
+    if (const auto* entity_index =
+            base::FindOrNull(mappings_.entity_by_root_domain, root_domain)) {
+      return mappings_.entity_names[*entity_index];
     }
   }
 
@@ -10,6 +10,7 @@
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
@@ -37,16 +38,26 @@ class NamedThirdPartyRegistry : public KeyedService {
   void InitializeDefault();
   std::optional<std::string> GetThirdParty(std::string_view domain) const;
 
+  // Parsed mappings. Entity names are interned in `entity_names`, the domain
+  // maps store indices into it.
+  struct Mappings {
+    Mappings();
+    ~Mappings();
+    Mappings(Mappings&&);
+    Mappings& operator=(Mappings&&);
+
+    std::vector<std::string> entity_names;
+    base::flat_map<std::string, size_t> entity_by_domain;
+    base::flat_map<std::string, size_t> entity_by_root_domain;
+  };
+
  private:
   bool IsInitialized() const { return initialized_; }
   void MarkInitialized(bool initialized) { initialized_ = initialized; }
-  void UpdateMappings(
-      std::pair<base::flat_map<std::string, std::string>,
-                base::flat_map<std::string, std::string>> entity_mappings);
+  void UpdateMappings(Mappings mappings);
 
   bool initialized_ = false;
-  base::flat_map<std::string, std::string> entity_by_domain_;
-  base::flat_map<std::string, std::string> entity_by_root_domain_;
+  Mappings mappings_;
 
   base::WeakPtrFactory<NamedThirdPartyRegistry> weak_factory_{this};
 };
@@ -6,6 +6,7 @@
 #include "brave/components/brave_perf_predictor/browser/perf_predictor_tab_helper.h"
 
 #include "base/logging.h"
+#include "base/trace_event/trace_event.h"
 #include "brave/components/brave_perf_predictor/browser/named_third_party_registry_factory.h"
 #include "brave/components/brave_perf_predictor/common/pref_names.h"
 #include "build/build_config.h"
@@ -70,12 +71,38 @@ void PerfPredictorTabHelper::DispatchBlockedEvent(
   }
 }
 
+// static
+void PerfPredictorTabHelper::DispatchShieldsCost(
+    base::TimeDelta match_time,
+    content::FrameTreeNodeId frame_tree_node_id) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  content::WebContents* web_contents =
+      content::WebContents::FromFrameTreeNodeId(frame_tree_node_id);
+  if (!web_contents)
+    return;
+
+  PerfPredictorTabHelper* observer =
+      PerfPredictorTabHelper::FromWebContents(web_contents);
+  if (observer) {
+    observer->OnShieldsCost(match_time);
+  }
+}
+
 void PerfPredictorTabHelper::RecordSavings() {
   if (web_contents()) {
     const uint64_t savings =
         static_cast<uint64_t>(bandwidth_predictor_->PredictSavingsBytes());
     bandwidth_predictor_->Reset();
     VLOG(3) << "Saving computed bw saving = " << savings;
+    VLOG(3) << "Shields cost = " << shields_match_time_ << " over "
+            << shields_checks_ << " ad-block checks";
+    TRACE_EVENT_INSTANT2("brave.adblock", "PerfPredictor_ShieldsCostVsSavings",
+                         TRACE_EVENT_SCOPE_THREAD, "match_time_us",
+                         shields_match_time_.InMicroseconds(), "savings_bytes",
+                         savings);
+    shields_match_time_ = base::TimeDelta();
+    shields_checks_ = 0;
     if (savings > 0) {
       // BrowserContenxt can be null in tests
       auto* browser_context = web_contents()->GetBrowserContext();
@@ -103,6 +130,11 @@ void PerfPredictorTabHelper::OnBlockedSubresource(
   bandwidth_predictor_->OnSubresourceBlocked(subresource);
 }
 
+void PerfPredictorTabHelper::OnShieldsCost(base::TimeDelta match_time) {
+  shields_match_time_ += match_time;
+  ++shields_checks_;
+}
+
 void PerfPredictorTabHelper::DidStartNavigation(
     content::NavigationHandle* handle) {
   if (!handle || !handle->IsInMainFrame() || handle->IsDownload())
@@ -119,6 +151,8 @@ void PerfPredictorTabHelper::DidFinishNavigation(
     return;
   // Reset predictor state when we're committed to this navigation
   bandwidth_predictor_->Reset();
+  shields_match_time_ = base::TimeDelta();
+  shields_checks_ = 0;
   // Record current navigation ID to know if we're in the same navigation later
   navigation_id_ = handle->GetNavigationId();
 }
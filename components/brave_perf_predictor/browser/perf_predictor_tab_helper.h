@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 
+#include "base/time/time.h"
 #include "brave/components/brave_perf_predictor/browser/bandwidth_savings_predictor.h"
 #include "brave/components/brave_perf_predictor/browser/p3a_bandwidth_savings_tracker.h"
 #include "content/public/browser/web_contents_observer.h"
@@ -56,11 +57,17 @@ class PerfPredictorTabHelper
   // Called from Brave Shields
   static void DispatchBlockedEvent(const std::string& subresource,
                                    content::FrameTreeNodeId frame_tree_node_id);
+  // Called from Brave Shields with the time spent matching a request against
+  // the ad-block engines, so that the per-page cost can be reported next to
+  // the predicted savings.
+  static void DispatchShieldsCost(base::TimeDelta match_time,
+                                  content::FrameTreeNodeId frame_tree_node_id);
 
  private:
   friend class content::WebContentsUserData<PerfPredictorTabHelper>;
   void RecordSavings();
   void OnBlockedSubresource(const std::string& subresource);
+  void OnShieldsCost(base::TimeDelta match_time);
 
   // content::WebContentsObserver overrides.
 
@@ -89,6 +96,9 @@ class PerfPredictorTabHelper
   int64_t navigation_id_ = -1;
   std::unique_ptr<BandwidthSavingsPredictor> bandwidth_predictor_;
   std::unique_ptr<P3ABandwidthSavingsTracker> bandwidth_tracker_;
+  // Shields cost accumulated for the current page, reset with the predictor.
+  base::TimeDelta shields_match_time_;
+  int shields_checks_ = 0;
 
   WEB_CONTENTS_USER_DATA_KEY_DECL();
 };
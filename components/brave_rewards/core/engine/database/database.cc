@@ -40,6 +40,8 @@ void Database::Initialize(ResultCallback callback) {
 }
 
 void Database::Close(ResultCallback callback) {
+  activity_info_.WritePendingUpdates();
+
   auto transaction = mojom::DBTransaction::New();
   auto command = mojom::DBCommand::New();
   command->type = mojom::DBCommand::Type::CLOSE;
@@ -304,6 +306,8 @@ void Database::GetPublisherInfo(const std::string& publisher_key,
 
 void Database::GetPanelPublisherInfo(mojom::ActivityInfoFilterPtr filter,
                                      GetPublisherPanelInfoCallback callback) {
+  // The panel record reads the current activity percentage.
+  activity_info_.WritePendingUpdates();
   publisher_info_.GetPanelRecord(std::move(filter), std::move(callback));
 }
 
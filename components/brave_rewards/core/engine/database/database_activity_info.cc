@@ -8,11 +8,14 @@
 #include <map>
 #include <utility>
 
+#include "base/feature_list.h"
+#include "base/functional/bind.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/types/cxx23_to_underlying.h"
 #include "brave/components/brave_rewards/core/engine/contribution/contribution.h"
 #include "brave/components/brave_rewards/core/engine/database/database_util.h"
 #include "brave/components/brave_rewards/core/engine/rewards_engine.h"
+#include "brave/components/brave_rewards/core/features.h"
 #include "third_party/abseil-cpp/absl/strings/str_format.h"
 
 namespace brave_rewards::internal {
@@ -132,6 +135,8 @@ DatabaseActivityInfo::~DatabaseActivityInfo() = default;
 void DatabaseActivityInfo::NormalizeList(
     std::vector<mojom::PublisherInfoPtr> list,
     ResultCallback callback) {
+  WritePendingUpdates();
+
   if (list.empty()) {
     std::move(callback).Run(mojom::Result::OK);
     return;
@@ -184,7 +189,32 @@ void DatabaseActivityInfo::InsertOrUpdate(mojom::PublisherInfoPtr info,
     return;
   }
 
+  if (base::FeatureList::IsEnabled(
+          features::kCoalesceActivityInfoWritesFeature)) {
+    const std::string publisher_id = info->id;
+    pending_updates_[publisher_id] = std::move(info);
+    pending_callbacks_.push_back(std::move(callback));
+    if (!write_timer_.IsRunning()) {
+      write_timer_.Start(FROM_HERE, features::kActivityInfoWriteDelay.Get(),
+                         this, &DatabaseActivityInfo::WritePendingUpdates);
+    }
+    return;
+  }
+
   auto transaction = mojom::DBTransaction::New();
+  CreateInsertOrUpdate(transaction.get(), std::move(info));
+
+  engine_->client()->RunDBTransaction(
+      std::move(transaction),
+      base::BindOnce(&OnResultCallback, std::move(callback)));
+}
+
+void DatabaseActivityInfo::CreateInsertOrUpdate(
+    mojom::DBTransaction* transaction,
+    mojom::PublisherInfoPtr info) {
+  DCHECK(transaction);
+  DCHECK(info);
+
   const std::string query = absl::StrFormat(
       "INSERT OR REPLACE INTO %s "
       "(publisher_id, duration, score, percent, "
@@ -205,10 +235,38 @@ void DatabaseActivityInfo::InsertOrUpdate(mojom::PublisherInfoPtr info,
   BindInt(command.get(), 6, info->visits);
 
   transaction->commands.push_back(std::move(command));
+}
+
+void DatabaseActivityInfo::WritePendingUpdates() {
+  write_timer_.Stop();
+
+  if (pending_updates_.empty()) {
+    return;
+  }
+
+  auto transaction = mojom::DBTransaction::New();
+  for (auto& [publisher_id, info] : pending_updates_) {
+    CreateInsertOrUpdate(transaction.get(), std::move(info));
+  }
+  pending_updates_.clear();
 
   engine_->client()->RunDBTransaction(
       std::move(transaction),
-      base::BindOnce(&OnResultCallback, std::move(callback)));
+      base::BindOnce(&DatabaseActivityInfo::OnPendingUpdatesWritten,
+                     base::Unretained(this), std::move(pending_callbacks_)));
+  pending_callbacks_.clear();
+}
+
+void DatabaseActivityInfo::OnPendingUpdatesWritten(
+    std::vector<ResultCallback> callbacks,
+    mojom::DBCommandResponsePtr response) {
+  const bool success =
+      response &&
+      response->status == mojom::DBCommandResponse::Status::RESPONSE_OK;
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(success ? mojom::Result::OK
+                                    : mojom::Result::FAILED);
+  }
 }
 
 void DatabaseActivityInfo::GetRecordsList(
@@ -221,6 +279,8 @@ void DatabaseActivityInfo::GetRecordsList(
     return;
   }
 
+  WritePendingUpdates();
+
   auto transaction = mojom::DBTransaction::New();
 
   std::string query = absl::StrFormat(
@@ -309,6 +369,8 @@ void DatabaseActivityInfo::DeleteRecord(const std::string& publisher_key,
     return;
   }
 
+  WritePendingUpdates();
+
   auto transaction = mojom::DBTransaction::New();
 
   const std::string query = absl::StrFormat(
@@ -331,6 +393,8 @@ void DatabaseActivityInfo::DeleteRecord(const std::string& publisher_key,
 
 void DatabaseActivityInfo::GetPublishersVisitedCount(
     base::OnceCallback<void(int)> callback) {
+  WritePendingUpdates();
+
   auto transaction = mojom::DBTransaction::New();
 
   std::string query = absl::StrFormat(
@@ -6,9 +6,11 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_CORE_ENGINE_DATABASE_DATABASE_ACTIVITY_INFO_H_
 #define BRAVE_COMPONENTS_BRAVE_REWARDS_CORE_ENGINE_DATABASE_DATABASE_ACTIVITY_INFO_H_
 
+#include <map>
 #include <string>
 #include <vector>
 
+#include "base/timer/timer.h"
 #include "brave/components/brave_rewards/core/engine/database/database_table.h"
 
 namespace brave_rewards::internal {
@@ -33,10 +35,24 @@ class DatabaseActivityInfo : public DatabaseTable {
 
   void GetPublishersVisitedCount(base::OnceCallback<void(int)> callback);
 
+  // Writes any buffered activity info updates in a single transaction. Must be
+  // called before running a query that reads the activity info table so that
+  // the query observes the latest visit data.
+  void WritePendingUpdates();
+
  private:
   void CreateInsertOrUpdate(mojom::DBTransaction* transaction,
                             mojom::PublisherInfoPtr info);
 
+  void OnPendingUpdatesWritten(std::vector<ResultCallback> callbacks,
+                               mojom::DBCommandResponsePtr response);
+
+  // Latest buffered activity info keyed by publisher ID. Since updates replace
+  // the whole row, only the most recent update for a publisher is written.
+  std::map<std::string, mojom::PublisherInfoPtr> pending_updates_;
+  std::vector<ResultCallback> pending_callbacks_;
+  base::OneShotTimer write_timer_;
+
   void OnNormalizeList(ResultCallback callback,
                        std::vector<mojom::PublisherInfoPtr> list,
                        mojom::DBCommandResponsePtr response);
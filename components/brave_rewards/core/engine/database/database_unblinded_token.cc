@@ -7,8 +7,11 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <map>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
@@ -23,6 +26,10 @@ namespace {
 
 constexpr char kTableName[] = "unblinded_tokens";
 
+// Each token binds 6 parameters, keeping a full chunk well below the default
+// SQLite limit of 999 host parameters per statement.
+constexpr size_t kInsertChunkSize = 100;
+
 }  // namespace
 
 DatabaseUnblindedToken::DatabaseUnblindedToken(RewardsEngine& engine)
@@ -41,29 +48,37 @@ void DatabaseUnblindedToken::InsertOrUpdateList(
 
   auto transaction = mojom::DBTransaction::New();
 
-  const std::string query = absl::StrFormat(
-      "INSERT OR IGNORE INTO %s "
-      "(token_id, token_value, public_key, value, creds_id, expires_at) "
-      "VALUES (?, ?, ?, ?, ?, ?)",
-      kTableName);
+  // Tokens are inserted using multi-row statements. Rows are chunked so that
+  // the number of bound parameters stays below SQLite's variable limit.
+  for (size_t offset = 0; offset < list.size(); offset += kInsertChunkSize) {
+    const size_t count = std::min(kInsertChunkSize, list.size() - offset);
 
-  for (const auto& info : list) {
     auto command = mojom::DBCommand::New();
     command->type = mojom::DBCommand::Type::RUN;
-    command->command = query;
-
-    if (info->id != 0) {
-      BindInt64(command.get(), 0, info->id);
-    } else {
-      BindNull(command.get(), 0);
+    command->command = absl::StrFormat(
+        "INSERT OR IGNORE INTO %s "
+        "(token_id, token_value, public_key, value, creds_id, expires_at) "
+        "VALUES %s",
+        kTableName,
+        base::JoinString(
+            std::vector<std::string>(count, "(?, ?, ?, ?, ?, ?)"), ", "));
+
+    int column = 0;
+    for (size_t i = offset; i < offset + count; ++i) {
+      const auto& info = list[i];
+      if (info->id != 0) {
+        BindInt64(command.get(), column++, info->id);
+      } else {
+        BindNull(command.get(), column++);
+      }
+
+      BindString(command.get(), column++, info->token_value);
+      BindString(command.get(), column++, info->public_key);
+      BindDouble(command.get(), column++, info->value);
+      BindString(command.get(), column++, info->creds_id);
+      BindInt64(command.get(), column++, info->expires_at);
     }
 
-    BindString(command.get(), 1, info->token_value);
-    BindString(command.get(), 2, info->public_key);
-    BindDouble(command.get(), 3, info->value);
-    BindString(command.get(), 4, info->creds_id);
-    BindInt64(command.get(), 5, info->expires_at);
-
     transaction->commands.push_back(std::move(command));
   }
 
@@ -46,4 +46,14 @@ BASE_FEATURE(kPlatformCreatorDetectionFeature,
 #endif
 );
 
+BASE_FEATURE(kCoalesceActivityInfoWritesFeature,
+             "BraveRewardsCoalesceActivityInfoWrites",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
+BASE_FEATURE_PARAM(base::TimeDelta,
+                   kActivityInfoWriteDelay,
+                   &kCoalesceActivityInfoWritesFeature,
+                   "write_delay",
+                   base::Seconds(10));
+
 }  // namespace brave_rewards::features
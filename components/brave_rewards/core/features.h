@@ -7,6 +7,8 @@
 #define BRAVE_COMPONENTS_BRAVE_REWARDS_CORE_FEATURES_H_
 
 #include "base/feature_list.h"
+#include "base/metrics/field_trial_params.h"
+#include "base/time/time.h"
 #include "brave/components/brave_rewards/core/buildflags/buildflags.h"
 #include "build/build_config.h"
 
@@ -30,6 +32,12 @@ BASE_DECLARE_FEATURE(kAnimatedBackgroundFeature);
 
 BASE_DECLARE_FEATURE(kPlatformCreatorDetectionFeature);
 
+// When enabled, activity info updates produced by publisher visits are
+// buffered per publisher and written to the database in a single transaction
+// once `kActivityInfoWriteDelay` has elapsed.
+BASE_DECLARE_FEATURE(kCoalesceActivityInfoWritesFeature);
+BASE_DECLARE_FEATURE_PARAM(base::TimeDelta, kActivityInfoWriteDelay);
+
 }  // namespace brave_rewards::features
 
 #endif  // BRAVE_COMPONENTS_BRAVE_REWARDS_CORE_FEATURES_H_
@@ -81,6 +81,10 @@ std::string AdBlockCustomFiltersProvider::GetNameForDebugging() {
   return "AdBlockCustomFiltersProvider";
 }
 
+std::string AdBlockCustomFiltersProvider::GetCacheKey() {
+  return base::StrCat({"custom:", GetCustomFilters()});
+}
+
 void AdBlockCustomFiltersProvider::CreateSiteExemption(std::string_view host) {
   std::string custom_filters = GetCustomFilters();
   UpdateCustomFilters(
@@ -52,6 +52,7 @@ class AdBlockCustomFiltersProvider : public AdBlockFiltersProvider {
           base::OnceCallback<void(rust::Box<adblock::FilterSet>*)>)>) override;
 
   std::string GetNameForDebugging() override;
+  std::string GetCacheKey() override;
 
  private:
   void AppendCustomFilter(std::string_view filter);
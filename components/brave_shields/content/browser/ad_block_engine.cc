@@ -5,19 +5,27 @@
 
 #include "brave/components/brave_shields/content/browser/ad_block_engine.h"
 
+#include <algorithm>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "base/functional/bind.h"
 #include "base/json/json_reader.h"
 #include "base/logging.h"
 #include "base/metrics/histogram_functions.h"
+#include "base/process/process_metrics.h"
 #include "base/sequence_checker.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/task/thread_pool.h"
 #include "base/timer/elapsed_timer.h"
 #include "base/trace_event/trace_event.h"
+#include "brave/components/brave_shields/content/browser/ad_block_engine_cache.h"
+#include "brave/components/brave_shields/core/common/features.h"
+#include "build/build_config.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "url/origin.h"
 
@@ -91,18 +99,100 @@ std::string ResourceTypeToString(blink::mojom::ResourceType resource_type) {
   return filter_option;
 }
 
+std::optional<size_t> GetResidentSetSizeKB() {
+#if BUILDFLAG(IS_LINUX) || BUILDFLAG(IS_CHROMEOS) || BUILDFLAG(IS_ANDROID)
+  return base::ProcessMetrics::CreateCurrentProcessMetrics()
+             ->GetResidentSetSize() /
+         1024;
+#else
+  return std::nullopt;
+#endif
+}
+
+// Regexes used within this many seconds count as recently used in the debug
+// info.
+constexpr uint64_t kRecentlyUsedRegexSecs = 60;
+
+// Number of CSP queries without directives remembered per engine.
+constexpr size_t kEmptyCspQueryCacheSize = 256;
+
+size_t GetCosmeticResultCacheSize() {
+  return std::max(1, brave_shields::features::
+                         kBraveAdblockCosmeticResultCacheSize.Get());
+}
+
+// Serializes `engine` and writes it to `cache_file` on a background thread,
+// tagged with `cache_key`.
+void WriteEngineToCache(const adblock::Engine& engine,
+                        bool is_default_engine,
+                        const base::FilePath& cache_file,
+                        const std::string& cache_key) {
+  if (cache_file.empty() || cache_key.empty()) {
+    return;
+  }
+  TRACE_EVENT("brave.adblock", "EngineSerializeForCache", "is_default_engine",
+              is_default_engine);
+  const auto serialized = engine.serialize();
+  base::ThreadPool::PostTask(
+      FROM_HERE,
+      {base::MayBlock(), base::TaskPriority::BEST_EFFORT,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(
+          [](const base::FilePath& cache_file, const std::string& cache_key,
+             const std::vector<uint8_t>& serialized_engine) {
+            brave_shields::AdBlockEngineCache::Write(cache_file, cache_key,
+                                                     serialized_engine);
+          },
+          cache_file, cache_key,
+          std::vector<uint8_t>(serialized.begin(), serialized.end())));
+}
+
+base::Value::Dict CosmeticCacheStatsToDict(size_t hits, size_t misses) {
+  base::Value::Dict stats;
+  stats.Set("hits", static_cast<int>(hits));
+  stats.Set("misses", static_cast<int>(misses));
+  return stats;
+}
+
 }  // namespace
 
 namespace brave_shields {
 
+struct AdBlockEngine::CompiledEngine {
+  // Null if compilation failed.
+  std::unique_ptr<rust::Box<adblock::Engine>> engine;
+  base::TimeDelta duration;
+};
+
+AdBlockEngine::Snapshot::Snapshot(rust::Box<adblock::Engine> engine)
+    : engine_(std::move(engine)) {}
+
+AdBlockEngine::Snapshot::~Snapshot() = default;
+
 AdBlockEngine::AdBlockEngine(bool is_default_engine)
-    : ad_block_client_(adblock::new_engine()),
-      is_default_engine_(is_default_engine) {
+    : AdBlockEngine(is_default_engine, base::FilePath()) {}
+
+AdBlockEngine::AdBlockEngine(bool is_default_engine, base::FilePath cache_file)
+    : snapshot_(base::MakeRefCounted<Snapshot>(adblock::new_engine())),
+      is_default_engine_(is_default_engine),
+      cache_file_(std::move(cache_file)),
+      cosmetic_result_cache_enabled_(base::FeatureList::IsEnabled(
+          features::kBraveAdblockCosmeticResultCache)),
+      cosmetic_resources_cache_(GetCosmeticResultCacheSize()),
+      hidden_selectors_cache_(GetCosmeticResultCacheSize()),
+      csp_query_cache_enabled_(base::FeatureList::IsEnabled(
+          features::kBraveAdblockCspQueryCache)),
+      empty_csp_queries_(kEmptyCspQueryCacheSize) {
   DETACH_FROM_SEQUENCE(sequence_checker_);
 }
 
 AdBlockEngine::~AdBlockEngine() = default;
 
+scoped_refptr<AdBlockEngine::Snapshot> AdBlockEngine::GetSnapshot() const {
+  base::AutoLock lock(snapshot_lock_);
+  return snapshot_;
+}
+
 adblock::BlockerResult AdBlockEngine::ShouldStartRequest(
     const GURL& url,
     blink::mojom::ResourceType resource_type,
@@ -110,64 +200,117 @@ adblock::BlockerResult AdBlockEngine::ShouldStartRequest(
     bool previously_matched_rule,
     bool previously_matched_exception,
     bool previously_matched_important) {
-  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  // Determine third-party here so the library doesn't need to figure it out.
   // CreateFromNormalizedTuple is needed because SameDomainOrHost needs
   // a URL or origin and not a string to a host name.
-  bool is_third_party = !SameDomainOrHost(
-      url, url::Origin::CreateFromNormalizedTuple("https", tab_host, 80),
-      INCLUDE_PRIVATE_REGISTRIES);
-  return ad_block_client_->matches(
-      url.spec(), std::string(url.host()), tab_host,
-      ResourceTypeToString(resource_type), is_third_party,
-      // Checking normal rules is skipped if a normal rule or exception rule was
-      // found previously
-      previously_matched_rule || previously_matched_exception,
-      // Always check exceptions unless one was found previously
-      !previously_matched_exception);
+  return ShouldStartRequest(
+      url, resource_type, tab_host,
+      url::Origin::CreateFromNormalizedTuple("https", tab_host, 80),
+      previously_matched_rule, previously_matched_exception,
+      previously_matched_important);
+}
+
+adblock::BlockerResult AdBlockEngine::ShouldStartRequest(
+    const GURL& url,
+    blink::mojom::ResourceType resource_type,
+    const std::string& tab_host,
+    const url::Origin& tab_origin,
+    bool previously_matched_rule,
+    bool previously_matched_exception,
+    bool previously_matched_important) {
+  // Determine third-party here so the library doesn't need to figure it out.
+  bool is_third_party =
+      !SameDomainOrHost(url, tab_origin, INCLUDE_PRIVATE_REGISTRIES);
+  return GetSnapshot()->Run([&](adblock::Engine& engine) {
+    return engine.matches(
+        url.spec(), std::string(url.host()), tab_host,
+        ResourceTypeToString(resource_type), is_third_party,
+        // Checking normal rules is skipped if a normal rule or exception rule
+        // was found previously
+        previously_matched_rule || previously_matched_exception,
+        // Always check exceptions unless one was found previously
+        !previously_matched_exception);
+  });
 }
 
 std::optional<std::string> AdBlockEngine::GetCspDirectives(
     const GURL& url,
     blink::mojom::ResourceType resource_type,
     const std::string& tab_host) {
-  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  uint64_t generation = 0;
+  if (csp_query_cache_enabled_) {
+    base::AutoLock lock(csp_query_cache_lock_);
+    generation = csp_query_cache_generation_;
+  }
+
   // Determine third-party here so the library doesn't need to figure it out.
   // CreateFromNormalizedTuple is needed because SameDomainOrHost needs
   // a URL or origin and not a string to a host name.
   bool is_third_party = !SameDomainOrHost(
       url, url::Origin::CreateFromNormalizedTuple("https", tab_host, 80),
       INCLUDE_PRIVATE_REGISTRIES);
-  auto result = ad_block_client_->get_csp_directives(
-      url.spec(), std::string(url.host()), tab_host,
-      ResourceTypeToString(resource_type), is_third_party);
+  auto result = GetSnapshot()->Run([&](adblock::Engine& engine) {
+    return engine.get_csp_directives(url.spec(), std::string(url.host()),
+                                     tab_host,
+                                     ResourceTypeToString(resource_type),
+                                     is_third_party);
+  });
 
   if (result.empty()) {
+    if (csp_query_cache_enabled_) {
+      base::AutoLock lock(csp_query_cache_lock_);
+      if (generation == csp_query_cache_generation_) {
+        empty_csp_queries_.Put({url.spec(), resource_type, tab_host}, true);
+      }
+    }
     return std::nullopt;
   } else {
     return std::optional<std::string>(std::string(result));
   }
 }
 
+bool AdBlockEngine::MayHaveCspDirectives(
+    const GURL& url,
+    blink::mojom::ResourceType resource_type,
+    const std::string& tab_host) {
+  if (!csp_query_cache_enabled_) {
+    return true;
+  }
+  base::AutoLock lock(csp_query_cache_lock_);
+  return empty_csp_queries_.Get({url.spec(), resource_type, tab_host}) ==
+         empty_csp_queries_.end();
+}
+
 void AdBlockEngine::EnableTag(const std::string& tag, bool enabled) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   if (enabled) {
     if (tags_.find(tag) == tags_.end()) {
-      ad_block_client_->enable_tag(tag);
+      GetSnapshot()->Run(
+          [&](adblock::Engine& engine) { engine.enable_tag(tag); });
       tags_.insert(tag);
+      InvalidateCosmeticCaches();
+      OnMatchingStateChanged();
     }
   } else {
-    ad_block_client_->disable_tag(tag);
+    GetSnapshot()->Run(
+        [&](adblock::Engine& engine) { engine.disable_tag(tag); });
     tags_.erase(tag);
+    InvalidateCosmeticCaches();
+    OnMatchingStateChanged();
   }
 }
 
-void AdBlockEngine::UseResources(const std::string& resources) {
+void AdBlockEngine::UseResources(AdBlockResources resources) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  bool result = ad_block_client_->use_resources(resources);
+  bool result = GetSnapshot()->Run([&](adblock::Engine& engine) {
+    return engine.use_resources(resources->as_string());
+  });
   if (!result) {
     LOG(ERROR) << "AdBlockEngine::UseResources failed";
   }
+  if (pending_resources_) {
+    pending_resources_ = std::move(resources);
+  }
+  InvalidateCosmeticCaches();
 }
 
 bool AdBlockEngine::TagExists(const std::string& tag) {
@@ -177,9 +320,18 @@ bool AdBlockEngine::TagExists(const std::string& tag) {
 
 base::Value::Dict AdBlockEngine::GetDebugInfo() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  const auto debug_info_struct = ad_block_client_->get_debug_info();
+  const auto debug_info_struct = GetSnapshot()->Run(
+      [](adblock::Engine& engine) { return engine.get_debug_info(); });
   base::Value::List regex_list;
+  // Totals over every regex the engine currently holds compiled, so that the
+  // cost of lazy regex compilation is visible without walking `regex_data`.
+  uint64_t regex_usage_count = 0;
+  size_t recently_used_regex_count = 0;
   for (const auto& regex_entry : debug_info_struct.regex_data) {
+    regex_usage_count += regex_entry.usage_count;
+    if (regex_entry.unused_secs < kRecentlyUsedRegexSecs) {
+      ++recently_used_regex_count;
+    }
     base::Value::Dict regex_info;
     regex_info.Set("id", base::NumberToString(regex_entry.id));
     regex_info.Set("regex", std::string(regex_entry.regex.value));
@@ -194,24 +346,96 @@ base::Value::Dict AdBlockEngine::GetDebugInfo() {
   result.Set("flatbuffer_size",
              static_cast<int>(debug_info_struct.flatbuffer_size));
   result.Set("regex_data", std::move(regex_list));
+
+  base::Value::Dict regex_stats;
+  regex_stats.Set("compiled_count",
+                  static_cast<int>(debug_info_struct.regex_data.size()));
+  regex_stats.Set("recently_used_count",
+                  static_cast<int>(recently_used_regex_count));
+  regex_stats.Set("total_usage_count",
+                  base::NumberToString(regex_usage_count));
+  if (regex_discard_policy_) {
+    regex_stats.Set(
+        "discard_unused_sec",
+        static_cast<int>(regex_discard_policy_->discard_unused_secs));
+  }
+  result.Set("regex_stats", std::move(regex_stats));
+
+  if (cosmetic_result_cache_enabled_) {
+    base::Value::Dict cache_info;
+    cache_info.Set("url_cosmetic_resources",
+                   CosmeticCacheStatsToDict(
+                       cosmetic_resources_cache_stats_.hits,
+                       cosmetic_resources_cache_stats_.misses));
+    cache_info.Set("hidden_class_id_selectors",
+                   CosmeticCacheStatsToDict(
+                       hidden_selectors_cache_stats_.hits,
+                       hidden_selectors_cache_stats_.misses));
+    result.Set("cosmetic_result_cache", std::move(cache_info));
+  }
+
+  if (last_load_stats_) {
+    base::Value::Dict load_info;
+    load_info.Set("source", last_load_stats_->source);
+    load_info.Set("duration_ms",
+                  static_cast<int>(
+                      last_load_stats_->duration.InMilliseconds()));
+    if (last_load_stats_->rss_before_kb) {
+      load_info.Set("rss_before_kb",
+                    static_cast<int>(*last_load_stats_->rss_before_kb));
+    }
+    if (last_load_stats_->rss_after_kb) {
+      load_info.Set("rss_after_kb",
+                    static_cast<int>(*last_load_stats_->rss_after_kb));
+    }
+    load_info.Set("cache_enabled", !cache_file_.empty());
+    result.Set("last_load", std::move(load_info));
+  }
   return result;
 }
 
 void AdBlockEngine::DiscardRegex(uint64_t regex_id) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  ad_block_client_->discard_regex(regex_id);
+  GetSnapshot()->Run(
+      [&](adblock::Engine& engine) { engine.discard_regex(regex_id); });
 }
 
 void AdBlockEngine::SetupDiscardPolicy(
     const adblock::RegexManagerDiscardPolicy& policy) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   regex_discard_policy_ = policy;
-  ad_block_client_->set_regex_discard_policy(policy);
+  GetSnapshot()->Run([&](adblock::Engine& engine) {
+    engine.set_regex_discard_policy(policy);
+  });
 }
 
 base::Value::Dict AdBlockEngine::UrlCosmeticResources(const std::string& url) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  auto result = ad_block_client_->url_cosmetic_resources(url);
+  if (!cosmetic_result_cache_enabled_) {
+    return ComputeUrlCosmeticResources(url);
+  }
+
+  // The fragment never affects which rules apply, so same-document URLs share
+  // an entry.
+  const GURL gurl(url);
+  const std::string key = gurl.is_valid() ? gurl.GetWithoutRef().spec() : url;
+  auto it = cosmetic_resources_cache_.Get(key);
+  if (it != cosmetic_resources_cache_.end()) {
+    ++cosmetic_resources_cache_stats_.hits;
+    return it->second.Clone();
+  }
+  ++cosmetic_resources_cache_stats_.misses;
+  base::Value::Dict resources = ComputeUrlCosmeticResources(url);
+  cosmetic_resources_cache_.Put(key, resources.Clone());
+  return resources;
+}
+
+base::Value::Dict AdBlockEngine::ComputeUrlCosmeticResources(
+    const std::string& url) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  auto result = GetSnapshot()->Run([&](adblock::Engine& engine) {
+    return engine.url_cosmetic_resources(url);
+  });
 
   std::optional<base::Value::Dict> parsed_result = base::JSONReader::ReadDict(
       std::string_view(result.data(), result.size()), base::JSON_PARSE_RFC);
@@ -226,8 +450,31 @@ base::Value::List AdBlockEngine::HiddenClassIdSelectors(
     const std::vector<std::string>& ids,
     const std::vector<std::string>& exceptions) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  auto result =
-      ad_block_client_->hidden_class_id_selectors(classes, ids, exceptions);
+  if (!cosmetic_result_cache_enabled_) {
+    return ComputeHiddenClassIdSelectors(classes, ids, exceptions);
+  }
+
+  HiddenSelectorsQuery key(classes, ids, exceptions);
+  auto it = hidden_selectors_cache_.Get(key);
+  if (it != hidden_selectors_cache_.end()) {
+    ++hidden_selectors_cache_stats_.hits;
+    return it->second.Clone();
+  }
+  ++hidden_selectors_cache_stats_.misses;
+  base::Value::List selectors =
+      ComputeHiddenClassIdSelectors(classes, ids, exceptions);
+  hidden_selectors_cache_.Put(std::move(key), selectors.Clone());
+  return selectors;
+}
+
+base::Value::List AdBlockEngine::ComputeHiddenClassIdSelectors(
+    const std::vector<std::string>& classes,
+    const std::vector<std::string>& ids,
+    const std::vector<std::string>& exceptions) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  auto result = GetSnapshot()->Run([&](adblock::Engine& engine) {
+    return engine.hidden_class_id_selectors(classes, ids, exceptions);
+  });
   if (result.result_kind != adblock::ResultKind::Success) {
     LOG(ERROR) << "AdBlockEngine::HiddenClassIdSelectors failed: "
                << result.error_message.c_str();
@@ -255,7 +502,143 @@ void AdBlockEngine::Load(bool deserialize,
 
 void AdBlockEngine::Load(rust::Box<adblock::FilterSet> filter_set,
                          const std::string& resources_json) {
-  OnFilterSetLoaded(std::move(filter_set), resources_json);
+  OnFilterSetLoaded(std::move(filter_set), resources_json, std::string());
+}
+
+void AdBlockEngine::Load(rust::Box<adblock::FilterSet> filter_set,
+                         const std::string& resources_json,
+                         const std::string& cache_key) {
+  OnFilterSetLoaded(std::move(filter_set), resources_json, cache_key);
+}
+
+void AdBlockEngine::LoadInBackground(rust::Box<adblock::FilterSet> filter_set,
+                                     AdBlockResources resources,
+                                     const std::string& cache_key,
+                                     base::OnceClosure on_loaded) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  CHECK(resources);
+  const uint64_t load_id = ++load_id_;
+  pending_resources_ = std::move(resources);
+  // The first engine is needed as soon as possible. Later rebuilds only
+  // replace an engine that is already serving requests, so they yield to
+  // everything else.
+  const base::TaskPriority priority = last_load_stats_
+                                          ? base::TaskPriority::BEST_EFFORT
+                                          : base::TaskPriority::USER_VISIBLE;
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {priority, base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(&AdBlockEngine::CompileFilterSet,
+                     std::make_unique<rust::Box<adblock::FilterSet>>(
+                         std::move(filter_set)),
+                     is_default_engine_, cache_file_, cache_key),
+      base::BindOnce(&AdBlockEngine::OnFilterSetCompiled,
+                     weak_ptr_factory_.GetWeakPtr(), load_id,
+                     GetResidentSetSizeKB(), std::move(on_loaded)));
+}
+
+// static
+AdBlockEngine::CompiledEngine AdBlockEngine::CompileFilterSet(
+    std::unique_ptr<rust::Box<adblock::FilterSet>> filter_set,
+    bool is_default_engine,
+    const base::FilePath& cache_file,
+    const std::string& cache_key) {
+  base::ElapsedTimer timer;
+  TRACE_EVENT_BEGIN("brave.adblock", "MakeEngineWithRules", "is_default_engine",
+                    is_default_engine);
+
+  auto result = adblock::engine_from_filter_set(std::move(*filter_set));
+
+  TRACE_EVENT_END("brave.adblock");
+  if (is_default_engine) {
+    base::UmaHistogramTimes("Brave.Adblock.MakeEngineWithRules.Default",
+                            timer.Elapsed());
+  } else {
+    base::UmaHistogramTimes("Brave.Adblock.MakeEngineWithRules.Additional",
+                            timer.Elapsed());
+  }
+
+  CompiledEngine compiled;
+  if (result.result_kind != adblock::ResultKind::Success) {
+    VLOG(0) << "AdBlockEngine::OnFilterSetLoaded failed: "
+            << result.error_message.c_str();
+    compiled.duration = timer.Elapsed();
+    return compiled;
+  }
+  WriteEngineToCache(*result.value, is_default_engine, cache_file, cache_key);
+  compiled.engine =
+      std::make_unique<rust::Box<adblock::Engine>>(std::move(result.value));
+  compiled.duration = timer.Elapsed();
+  return compiled;
+}
+
+void AdBlockEngine::OnFilterSetCompiled(uint64_t load_id,
+                                        std::optional<size_t> rss_before_kb,
+                                        base::OnceClosure on_loaded,
+                                        CompiledEngine compiled) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  // Drop the engine if a newer one was published, or started compiling, in
+  // the meantime.
+  if (load_id == load_id_ && compiled.engine) {
+    AdBlockResources resources = std::move(pending_resources_);
+    UpdateAdBlockClient(std::move(*compiled.engine), resources->as_string());
+    RecordLoadStats("filter_set", compiled.duration, rss_before_kb);
+  }
+  std::move(on_loaded).Run();
+}
+
+bool AdBlockEngine::LoadFromCache(const std::string& cache_key,
+                                  const std::string& resources_json) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (cache_file_.empty() || cache_key.empty()) {
+    return false;
+  }
+
+  const auto rss_before_kb = GetResidentSetSizeKB();
+  base::ElapsedTimer timer;
+  TRACE_EVENT_BEGIN("brave.adblock", "EngineLoadFromCache",
+                    "is_default_engine", is_default_engine_);
+
+  auto client = adblock::new_engine();
+  {
+    AdBlockEngineCache cache;
+    const auto serialized_engine = cache.Map(cache_file_, cache_key);
+    if (!serialized_engine) {
+      TRACE_EVENT_END("brave.adblock");
+      return false;
+    }
+    // The FFI only accepts an owned buffer, so the mapped bytes are copied
+    // once. The mapping itself is released at the end of this scope.
+    if (!client->deserialize(DATFileDataBuffer(serialized_engine->begin(),
+                                               serialized_engine->end()))) {
+      TRACE_EVENT_END("brave.adblock");
+      LOG(ERROR) << "AdBlockEngine::LoadFromCache deserialize failed";
+      AdBlockEngineCache::Delete(cache_file_);
+      return false;
+    }
+  }
+
+  TRACE_EVENT_END("brave.adblock");
+  if (is_default_engine_) {
+    base::UmaHistogramTimes("Brave.Adblock.EngineLoadFromCache.Default",
+                            timer.Elapsed());
+  } else {
+    base::UmaHistogramTimes("Brave.Adblock.EngineLoadFromCache.Additional",
+                            timer.Elapsed());
+  }
+
+  UpdateAdBlockClient(std::move(client), resources_json);
+  RecordLoadStats("cache", timer.Elapsed(), rss_before_kb);
+  return true;
+}
+
+void AdBlockEngine::RecordLoadStats(std::string source,
+                                    base::TimeDelta duration,
+                                    std::optional<size_t> rss_before_kb) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  last_load_stats_ = LoadStats{.source = std::move(source),
+                               .duration = duration,
+                               .rss_before_kb = rss_before_kb,
+                               .rss_after_kb = GetResidentSetSizeKB()};
 }
 
 void AdBlockEngine::UpdateAdBlockClient(
@@ -264,56 +647,81 @@ void AdBlockEngine::UpdateAdBlockClient(
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
   TRACE_EVENT("brave.adblock", "UpdateAdBlockClient");
-  ad_block_client_ = std::move(ad_block_client);
+  // Any engine still being compiled in the background is now outdated.
+  ++load_id_;
+  pending_resources_.reset();
+  // The new engine is fully set up before it is published, so that readers
+  // never observe it without resources or tags.
   if (regex_discard_policy_) {
-    ad_block_client_->set_regex_discard_policy(*regex_discard_policy_);
+    ad_block_client->set_regex_discard_policy(*regex_discard_policy_);
   }
-  UseResources(resources_json);
-  AddKnownTagsToAdBlockInstance();
+  if (!ad_block_client->use_resources(resources_json)) {
+    LOG(ERROR) << "AdBlockEngine::UseResources failed";
+  }
+  AddKnownTagsToAdBlockInstance(*ad_block_client);
+
+  auto snapshot = base::MakeRefCounted<Snapshot>(std::move(ad_block_client));
+  {
+    base::AutoLock lock(snapshot_lock_);
+    snapshot_.swap(snapshot);
+  }
+  // The previous snapshot is released here, or by the last reader still
+  // holding it.
+  snapshot.reset();
+  InvalidateCosmeticCaches();
+  OnMatchingStateChanged();
+
   if (test_observer_) {
     test_observer_->OnEngineUpdated();
   }
 }
 
-void AdBlockEngine::AddKnownTagsToAdBlockInstance() {
+void AdBlockEngine::InvalidateCosmeticCaches() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  cosmetic_resources_cache_.Clear();
+  hidden_selectors_cache_.Clear();
+}
+
+void AdBlockEngine::OnMatchingStateChanged() {
+  generation_.fetch_add(1, std::memory_order_relaxed);
+  InvalidateCspQueryCache();
+}
+
+void AdBlockEngine::InvalidateCspQueryCache() {
+  base::AutoLock lock(csp_query_cache_lock_);
+  ++csp_query_cache_generation_;
+  empty_csp_queries_.Clear();
+}
+
+void AdBlockEngine::AddKnownTagsToAdBlockInstance(adblock::Engine& engine) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   std::for_each(tags_.begin(), tags_.end(), [&](const std::string& tag) {
     DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-    ad_block_client_->enable_tag(tag);
+    engine.enable_tag(tag);
   });
 }
 
 void AdBlockEngine::OnFilterSetLoaded(rust::Box<adblock::FilterSet> filter_set,
-                                      const std::string& resources_json) {
+                                      const std::string& resources_json,
+                                      const std::string& cache_key) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  base::ElapsedTimer timer;
-  TRACE_EVENT_BEGIN("brave.adblock", "MakeEngineWithRules", "is_default_engine",
-                    is_default_engine_);
-
-  auto result = adblock::engine_from_filter_set(std::move(filter_set));
-
-  TRACE_EVENT_END("brave.adblock");
-  if (is_default_engine_) {
-    base::UmaHistogramTimes("Brave.Adblock.MakeEngineWithRules.Default",
-                            timer.Elapsed());
-  } else {
-    base::UmaHistogramTimes("Brave.Adblock.MakeEngineWithRules.Additional",
-                            timer.Elapsed());
-  }
-
-  if (result.result_kind != adblock::ResultKind::Success) {
-    VLOG(0) << "AdBlockEngine::OnFilterSetLoaded failed: "
-            << result.error_message.c_str();
+  const auto rss_before_kb = GetResidentSetSizeKB();
+  CompiledEngine compiled = CompileFilterSet(
+      std::make_unique<rust::Box<adblock::FilterSet>>(std::move(filter_set)),
+      is_default_engine_, cache_file_, cache_key);
+  if (!compiled.engine) {
     return;
   }
-  UpdateAdBlockClient(std::move(result.value), resources_json);
+  UpdateAdBlockClient(std::move(*compiled.engine), resources_json);
+  RecordLoadStats("filter_set", compiled.duration, rss_before_kb);
 }
 
 void AdBlockEngine::OnListSourceLoaded(const DATFileDataBuffer& filters,
                                        const std::string& resources_json) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
+  const auto rss_before_kb = GetResidentSetSizeKB();
   base::ElapsedTimer timer;
   TRACE_EVENT_BEGIN("brave.adblock", "MakeEngineWithRules", "size",
                     filters.size(), "is_default_engine", is_default_engine_);
@@ -335,6 +743,7 @@ void AdBlockEngine::OnListSourceLoaded(const DATFileDataBuffer& filters,
     return;
   }
   UpdateAdBlockClient(std::move(result.value), resources_json);
+  RecordLoadStats("list_source", timer.Elapsed(), rss_before_kb);
 }
 
 void AdBlockEngine::OnDATLoaded(const DATFileDataBuffer& dat_buf,
@@ -346,6 +755,7 @@ void AdBlockEngine::OnDATLoaded(const DATFileDataBuffer& dat_buf,
     return;
   }
 
+  const auto rss_before_kb = GetResidentSetSizeKB();
   base::ElapsedTimer timer;
   TRACE_EVENT_BEGIN("brave.adblock", "EngineDeserialize", "size",
                     dat_buf.size(), "is_default_engine", is_default_engine_);
@@ -368,6 +778,7 @@ void AdBlockEngine::OnDATLoaded(const DATFileDataBuffer& dat_buf,
   }
 
   UpdateAdBlockClient(std::move(client), resources_json);
+  RecordLoadStats("dat", timer.Elapsed(), rss_before_kb);
 }
 
 void AdBlockEngine::AddObserverForTest(AdBlockEngine::TestObserver* observer) {
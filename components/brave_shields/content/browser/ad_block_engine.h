@@ -8,22 +8,33 @@
 
 #include <stdint.h>
 
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <set>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+#include "base/containers/lru_cache.h"
+#include "base/files/file_path.h"
+#include "base/functional/callback_forward.h"
+#include "base/memory/ref_counted.h"
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list_types.h"
 #include "base/sequence_checker.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
+#include "base/time/time.h"
 #include "base/values.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
+#include "brave/components/brave_shields/core/browser/ad_block_resource_provider.h"
 #include "brave/components/brave_shields/core/browser/adblock/rs/src/lib.rs.h"
 #include "third_party/blink/public/mojom/loader/resource_load_info.mojom-shared.h"
 #include "third_party/rust/cxx/v1/cxx.h"
 #include "url/gurl.h"
+#include "url/origin.h"
 
 using brave_component_updater::DATFileDataBuffer;
 
@@ -35,19 +46,70 @@ class PerfPredictorTabHelperTest;
 namespace brave_shields {
 
 // Service managing an adblock engine.
+//
+// Apart from `ShouldStartRequest` and `GetCspDirectives`, which may be called
+// from any thread, methods must be called on the sequence the engine is bound
+// to. Network matching always runs against the most recently published
+// `Snapshot`, so a new engine can be built without blocking in-flight matches.
 class AdBlockEngine {
  public:
+  // Holds one published adblock-rust engine. Readers take a reference to the
+  // current snapshot and keep using it even if a newer one is published in the
+  // meantime; the old engine is freed once its last reader is done.
+  class Snapshot : public base::RefCountedThreadSafe<Snapshot> {
+   public:
+    explicit Snapshot(rust::Box<adblock::Engine> engine);
+    Snapshot(const Snapshot&) = delete;
+    Snapshot& operator=(const Snapshot&) = delete;
+
+    // Runs `fn` with the underlying engine. adblock-rust keeps an internal,
+    // unsynchronized regex cache, so calls into the same snapshot are
+    // serialized; calls into different snapshots are not.
+    template <typename Fn>
+    auto Run(Fn&& fn) {
+      base::AutoLock lock(lock_);
+      return std::forward<Fn>(fn)(*engine_);
+    }
+
+   private:
+    friend class base::RefCountedThreadSafe<Snapshot>;
+    ~Snapshot();
+
+    base::Lock lock_;
+    rust::Box<adblock::Engine> engine_ GUARDED_BY(lock_);
+  };
+
   explicit AdBlockEngine(bool is_default_engine);
+  // `cache_file` is where compiled engines are serialized to and reloaded
+  // from on the next startup. An empty path disables the cache.
+  AdBlockEngine(bool is_default_engine, base::FilePath cache_file);
   AdBlockEngine(const AdBlockEngine&) = delete;
   AdBlockEngine& operator=(const AdBlockEngine&) = delete;
   ~AdBlockEngine();
 
   bool IsDefaultEngine() { return is_default_engine_; }
 
+  // Changes whenever network matching results may change, i.e. when a new
+  // engine is published or a tag is toggled. May be called from any thread.
+  uint64_t generation() const {
+    return generation_.load(std::memory_order_relaxed);
+  }
+  bool HasCacheFile() const { return !cache_file_.empty(); }
+
+  adblock::BlockerResult ShouldStartRequest(
+      const GURL& url,
+      blink::mojom::ResourceType resource_type,
+      const std::string& tab_host,
+      bool previously_matched_rule,
+      bool previously_matched_exception,
+      bool previously_matched_important);
+  // Same as above, but takes the tab origin precomputed from `tab_host` so
+  // that callers matching many requests for the same tab only build it once.
   adblock::BlockerResult ShouldStartRequest(
       const GURL& url,
       blink::mojom::ResourceType resource_type,
       const std::string& tab_host,
+      const url::Origin& tab_origin,
       bool previously_matched_rule,
       bool previously_matched_exception,
       bool previously_matched_important);
@@ -55,7 +117,13 @@ class AdBlockEngine {
       const GURL& url,
       blink::mojom::ResourceType resource_type,
       const std::string& tab_host);
-  void UseResources(const std::string& resources);
+  // Returns false if `GetCspDirectives` is already known to return nothing for
+  // these arguments with the current engine and tags. May be called from any
+  // thread.
+  bool MayHaveCspDirectives(const GURL& url,
+                            blink::mojom::ResourceType resource_type,
+                            const std::string& tab_host);
+  void UseResources(AdBlockResources resources);
   void EnableTag(const std::string& tag, bool enabled);
   bool TagExists(const std::string& tag);
 
@@ -74,6 +142,26 @@ class AdBlockEngine {
             const std::string& resources_json);
   void Load(rust::Box<adblock::FilterSet> filter_set,
             const std::string& resources_json);
+  // If `cache_key` is not empty, the compiled engine is also written to the
+  // cache file, tagged with `cache_key`.
+  void Load(rust::Box<adblock::FilterSet> filter_set,
+            const std::string& resources_json,
+            const std::string& cache_key);
+  // Same as above, but compiles the engine on a background thread so that the
+  // engine sequence stays free for matching while a large filter set is being
+  // compiled. The current snapshot keeps serving requests until the new engine
+  // is published. `on_loaded` runs on the engine sequence once the new engine
+  // was published, or once compilation failed or was superseded by a newer
+  // load.
+  void LoadInBackground(rust::Box<adblock::FilterSet> filter_set,
+                        AdBlockResources resources,
+                        const std::string& cache_key,
+                        base::OnceClosure on_loaded);
+  // Replaces the engine with the one serialized in the cache file, if it was
+  // written for `cache_key`. Returns false, leaving the engine unchanged, if
+  // there is no usable cache entry.
+  bool LoadFromCache(const std::string& cache_key,
+                     const std::string& resources_json);
 
   class TestObserver : public base::CheckedObserver {
    public:
@@ -86,19 +174,20 @@ class AdBlockEngine {
   base::WeakPtr<AdBlockEngine> AsWeakPtr();
 
  protected:
-  void AddKnownTagsToAdBlockInstance();
+  void AddKnownTagsToAdBlockInstance(adblock::Engine& engine);
   void UpdateAdBlockClient(rust::Box<adblock::Engine> ad_block_client,
                            const std::string& resources_json);
 
   void OnFilterSetLoaded(rust::Box<adblock::FilterSet> filter_set,
-                         const std::string& resources_json);
+                         const std::string& resources_json,
+                         const std::string& cache_key);
   void OnListSourceLoaded(const DATFileDataBuffer& filters,
                           const std::string& resources_json);
   void OnDATLoaded(const DATFileDataBuffer& dat_buf,
                    const std::string& resources_json);
 
-  rust::Box<adblock::Engine> ad_block_client_
-      GUARDED_BY_CONTEXT(sequence_checker_);
+  // Returns the currently published engine snapshot.
+  scoped_refptr<Snapshot> GetSnapshot() const;
 
  private:
   friend class ::AdBlockServiceTest;
@@ -106,13 +195,99 @@ class AdBlockEngine {
   friend class ::EphemeralStorage1pDomainBlockBrowserTest;
   friend class ::PerfPredictorTabHelperTest;
 
+  // Timing and memory of the most recent engine load, for
+  // brave://adblock-internals.
+  struct LoadStats {
+    std::string source;
+    base::TimeDelta duration;
+    std::optional<size_t> rss_before_kb;
+    std::optional<size_t> rss_after_kb;
+  };
+  void RecordLoadStats(std::string source,
+                       base::TimeDelta duration,
+                       std::optional<size_t> rss_before_kb);
+  // Result of compiling a filter set off the engine sequence.
+  struct CompiledEngine;
+  // Task run on the thread pool by `LoadInBackground`. The compiled engine is
+  // also serialized to `cache_file` if both it and `cache_key` are non-empty.
+  static CompiledEngine CompileFilterSet(
+      std::unique_ptr<rust::Box<adblock::FilterSet>> filter_set,
+      bool is_default_engine,
+      const base::FilePath& cache_file,
+      const std::string& cache_key);
+  void OnFilterSetCompiled(uint64_t load_id,
+                           std::optional<size_t> rss_before_kb,
+                           base::OnceClosure on_loaded,
+                           CompiledEngine compiled);
+
+  base::Value::Dict ComputeUrlCosmeticResources(const std::string& url);
+  base::Value::List ComputeHiddenClassIdSelectors(
+      const std::vector<std::string>& classes,
+      const std::vector<std::string>& ids,
+      const std::vector<std::string>& exceptions);
+
+  // Drops cached cosmetic results, which are only valid for the snapshot,
+  // resources and tags they were computed with.
+  void InvalidateCosmeticCaches();
+  // Called whenever the published snapshot or its tags change.
+  void OnMatchingStateChanged();
+  // Drops the CSP queries known to have no directives.
+  void InvalidateCspQueryCache();
+
+  struct CosmeticCacheStats {
+    size_t hits = 0;
+    size_t misses = 0;
+  };
+  // (classes, ids, exceptions) as passed to `HiddenClassIdSelectors`.
+  using HiddenSelectorsQuery = std::tuple<std::vector<std::string>,
+                                          std::vector<std::string>,
+                                          std::vector<std::string>>;
+  // (url, resource type, tab host) as passed to `GetCspDirectives`.
+  using CspQuery =
+      std::tuple<std::string, blink::mojom::ResourceType, std::string>;
+
   std::set<std::string> tags_ GUARDED_BY_CONTEXT(sequence_checker_);
   std::optional<adblock::RegexManagerDiscardPolicy> regex_discard_policy_
       GUARDED_BY_CONTEXT(sequence_checker_);
 
+  mutable base::Lock snapshot_lock_;
+  scoped_refptr<Snapshot> snapshot_ GUARDED_BY(snapshot_lock_);
+
+  std::optional<LoadStats> last_load_stats_
+      GUARDED_BY_CONTEXT(sequence_checker_);
+
+  // Bumped every time an engine is published or a background load starts, so
+  // that a background compile finishing after a newer load is dropped.
+  uint64_t load_id_ GUARDED_BY_CONTEXT(sequence_checker_) = 0;
+  // Resources to publish the background-compiled engine with. Kept up to date
+  // by `UseResources` while the compile is running.
+  AdBlockResources pending_resources_ GUARDED_BY_CONTEXT(sequence_checker_);
+
   raw_ptr<TestObserver> test_observer_ = nullptr;
 
   bool is_default_engine_;
+  const base::FilePath cache_file_;
+
+  const bool cosmetic_result_cache_enabled_;
+  base::LRUCache<std::string, base::Value::Dict> cosmetic_resources_cache_
+      GUARDED_BY_CONTEXT(sequence_checker_);
+  base::LRUCache<HiddenSelectorsQuery, base::Value::List>
+      hidden_selectors_cache_ GUARDED_BY_CONTEXT(sequence_checker_);
+  CosmeticCacheStats cosmetic_resources_cache_stats_
+      GUARDED_BY_CONTEXT(sequence_checker_);
+  CosmeticCacheStats hidden_selectors_cache_stats_
+      GUARDED_BY_CONTEXT(sequence_checker_);
+
+  const bool csp_query_cache_enabled_;
+  base::Lock csp_query_cache_lock_;
+  // CSP queries that returned no directives. The value is unused.
+  base::LRUCache<CspQuery, bool> empty_csp_queries_
+      GUARDED_BY(csp_query_cache_lock_);
+  // Bumped on invalidation, so that a query that started against an older
+  // snapshot does not add its result after the cache was cleared.
+  uint64_t csp_query_cache_generation_ GUARDED_BY(csp_query_cache_lock_) = 0;
+
+  std::atomic<uint64_t> generation_{0};
 
   SEQUENCE_CHECKER(sequence_checker_);
   base::WeakPtrFactory<AdBlockEngine> weak_ptr_factory_{this};
@@ -0,0 +1,89 @@
+// Copyright (c) 2026 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "brave/components/brave_shields/content/browser/ad_block_engine_cache.h"
+
+#include <string>
+
+#include "base/files/file_util.h"
+#include "base/files/important_file_writer.h"
+#include "base/logging.h"
+#include "base/numerics/byte_conversions.h"
+#include "crypto/sha2.h"
+
+namespace brave_shields {
+
+namespace {
+
+constexpr std::string_view kMagic = "BRAVEADBLOCKENGINE";
+constexpr size_t kHeaderSize =
+    kMagic.size() + sizeof(uint32_t) + crypto::kSHA256Length;
+
+}  // namespace
+
+AdBlockEngineCache::AdBlockEngineCache() = default;
+
+AdBlockEngineCache::~AdBlockEngineCache() = default;
+
+std::optional<base::span<const uint8_t>> AdBlockEngineCache::Map(
+    const base::FilePath& cache_file,
+    std::string_view cache_key) {
+  if (!base::PathExists(cache_file) || !mapped_file_.Initialize(cache_file)) {
+    return std::nullopt;
+  }
+
+  base::span<const uint8_t> data = mapped_file_.bytes();
+  if (data.size() <= kHeaderSize) {
+    return std::nullopt;
+  }
+
+  auto [magic, rest] = data.split_at(kMagic.size());
+  if (base::as_string_view(magic) != kMagic) {
+    return std::nullopt;
+  }
+
+  auto [version, rest2] = rest.split_at<sizeof(uint32_t)>();
+  if (base::U32FromLittleEndian(version) != kAdBlockEngineCacheFormatVersion) {
+    return std::nullopt;
+  }
+
+  auto [key_hash, serialized_engine] = rest2.split_at(crypto::kSHA256Length);
+  if (base::as_string_view(key_hash) != crypto::SHA256HashString(cache_key)) {
+    return std::nullopt;
+  }
+
+  return serialized_engine;
+}
+
+// static
+bool AdBlockEngineCache::Write(const base::FilePath& cache_file,
+                               std::string_view cache_key,
+                               base::span<const uint8_t> serialized_engine) {
+  if (!base::CreateDirectory(cache_file.DirName())) {
+    return false;
+  }
+
+  std::string contents;
+  contents.reserve(kHeaderSize + serialized_engine.size());
+  contents.append(kMagic);
+  const auto version =
+      base::U32ToLittleEndian(kAdBlockEngineCacheFormatVersion);
+  contents.append(base::as_string_view(base::span(version)));
+  contents.append(crypto::SHA256HashString(cache_key));
+  contents.append(base::as_string_view(serialized_engine));
+
+  if (!base::ImportantFileWriter::WriteFileAtomically(cache_file, contents)) {
+    LOG(ERROR) << "Failed to write adblock engine cache to " << cache_file;
+    return false;
+  }
+  return true;
+}
+
+// static
+void AdBlockEngineCache::Delete(const base::FilePath& cache_file) {
+  base::DeleteFile(cache_file);
+}
+
+}  // namespace brave_shields
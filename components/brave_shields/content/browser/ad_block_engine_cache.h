@@ -0,0 +1,62 @@
+// Copyright (c) 2026 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_CONTENT_BROWSER_AD_BLOCK_ENGINE_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_CONTENT_BROWSER_AD_BLOCK_ENGINE_CACHE_H_
+
+#include <stdint.h>
+
+#include <optional>
+#include <string_view>
+
+#include "base/containers/span.h"
+#include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
+
+namespace brave_shields {
+
+// Bump this whenever the layout of the cache file changes.
+inline constexpr uint32_t kAdBlockEngineCacheFormatVersion = 1;
+
+// Memory-mapped view of a serialized adblock engine written by a previous
+// session.
+//
+// The file starts with a fixed header holding a magic string, the format
+// version and a SHA-256 of the cache key describing the filter lists the engine
+// was built from, followed by the serialized engine. Only the pages that are
+// actually read while deserializing are faulted in, and the mapping is
+// released as soon as this object goes away.
+//
+// All methods block on file IO.
+class AdBlockEngineCache {
+ public:
+  AdBlockEngineCache();
+  AdBlockEngineCache(const AdBlockEngineCache&) = delete;
+  AdBlockEngineCache& operator=(const AdBlockEngineCache&) = delete;
+  ~AdBlockEngineCache();
+
+  // Maps `cache_file` and returns the serialized engine it holds, or
+  // std::nullopt if the file is missing, truncated, from another format
+  // version, or was written for a different `cache_key`. The returned span is
+  // valid for as long as this object is alive.
+  std::optional<base::span<const uint8_t>> Map(const base::FilePath& cache_file,
+                                               std::string_view cache_key);
+
+  // Atomically replaces `cache_file` with `serialized_engine`, tagged with
+  // `cache_key`.
+  static bool Write(const base::FilePath& cache_file,
+                    std::string_view cache_key,
+                    base::span<const uint8_t> serialized_engine);
+
+  // Removes `cache_file`, e.g. after it failed to deserialize.
+  static void Delete(const base::FilePath& cache_file);
+
+ private:
+  base::MemoryMappedFile mapped_file_;
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_CONTENT_BROWSER_AD_BLOCK_ENGINE_CACHE_H_
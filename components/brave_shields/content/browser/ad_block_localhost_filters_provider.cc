@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/strings/strcat.h"
 #include "base/task/single_thread_task_runner.h"
 #include "brave/components/brave_shields/core/browser/ad_block_filters_provider_manager.h"
 #include "components/prefs/pref_service.h"
@@ -45,6 +46,10 @@ std::string AdBlockLocalhostFiltersProvider::GetNameForDebugging() {
   return "AdBlockLocalhostFiltersProvider";
 }
 
+std::string AdBlockLocalhostFiltersProvider::GetCacheKey() {
+  return base::StrCat({"localhost:", kLocalhostBadfilters});
+}
+
 void AdBlockLocalhostFiltersProvider::LoadFilterSet(
     base::OnceCallback<
         void(base::OnceCallback<void(rust::Box<adblock::FilterSet>*)>)> cb) {
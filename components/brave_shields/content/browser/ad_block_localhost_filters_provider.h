@@ -40,6 +40,7 @@ class AdBlockLocalhostFiltersProvider : public AdBlockFiltersProvider {
           base::OnceCallback<void(rust::Box<adblock::FilterSet>*)>)>) override;
 
   std::string GetNameForDebugging() override;
+  std::string GetCacheKey() override;
 
  private:
   SEQUENCE_CHECKER(sequence_checker_);
@@ -7,7 +7,10 @@
 
 #include <memory>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include "base/check.h"
 #include "base/feature_list.h"
@@ -15,6 +18,8 @@
 #include "base/functional/bind.h"
 #include "base/json/json_reader.h"
 #include "base/strings/strcat.h"
+#include "base/task/bind_post_task.h"
+#include "base/task/thread_pool.h"
 #include "base/threading/thread_restrictions.h"
 #include "base/trace_event/trace_event.h"
 #include "brave/components/brave_shields/content/browser/ad_block_custom_filters_provider.h"
@@ -39,10 +44,27 @@
 
 namespace brave_shields {
 
+namespace {
+
+constexpr char kEngineCacheDirName[] = "AdBlockEngineCache";
+
+base::FilePath GetEngineCacheFile(const base::FilePath& profile_dir,
+                                  bool is_default_engine) {
+  if (profile_dir.empty() ||
+      !base::FeatureList::IsEnabled(features::kAdblockEngineCache)) {
+    return base::FilePath();
+  }
+  return profile_dir.AppendASCII(kEngineCacheDirName)
+      .AppendASCII(is_default_engine ? "default.dat" : "additional.dat");
+}
+
+}  // namespace
+
 AdBlockService::SourceProviderObserver::SourceProviderObserver(
     AdBlockService* owner,
     bool engine_is_default)
-    : adblock_engine_(engine_is_default
+    : owner_(owner),
+      adblock_engine_(engine_is_default
                           ? owner->default_engine_.get()
                           : owner->additional_filters_engine_.get()),
       resource_provider_(owner->resource_provider_.get()),
@@ -62,6 +84,78 @@ void AdBlockService::SourceProviderObserver::OnChanged(bool is_default_engine) {
     // Skip updates of another engine.
     return;
   }
+  if (rebuild_in_progress_) {
+    rebuild_pending_ = true;
+    return;
+  }
+  RebuildEngine(is_default_engine);
+}
+
+void AdBlockService::SourceProviderObserver::RebuildEngine(
+    bool is_default_engine) {
+  rebuild_in_progress_ = true;
+  if (!is_default_engine) {
+    pending_user_filters_watermark_ =
+        owner_->GetLatestPendingUserCosmeticFilterId();
+  }
+  cache_key_.clear();
+  if (adblock_engine_->HasCacheFile()) {
+    cache_key_ =
+        filters_provider_manager_->GetCacheKeyForEngine(is_default_engine);
+  }
+  if (cache_key_.empty()) {
+    LoadFilterSet(is_default_engine);
+    return;
+  }
+
+  // Try the serialized engine from a previous session before compiling the
+  // filter lists again. Resources are loaded first so that the cached engine
+  // is published with them.
+  resource_provider_->AddObserver(this);
+  resource_provider_->LoadResources(
+      base::BindOnce(&SourceProviderObserver::OnResourcesLoadedForCache,
+                     weak_factory_.GetWeakPtr()));
+}
+
+void AdBlockService::SourceProviderObserver::OnResourcesLoadedForCache(
+    AdBlockResources resources) {
+  task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(
+          [](base::WeakPtr<AdBlockEngine> engine, const std::string& cache_key,
+             AdBlockResources resources) {
+            return engine &&
+                   engine->LoadFromCache(cache_key, resources->as_string());
+          },
+          adblock_engine_->AsWeakPtr(), cache_key_, std::move(resources)),
+      base::BindOnce(&SourceProviderObserver::OnCacheLoadAttempted,
+                     weak_factory_.GetWeakPtr(),
+                     adblock_engine_->IsDefaultEngine()));
+}
+
+void AdBlockService::SourceProviderObserver::OnCacheLoadAttempted(
+    bool is_default_engine,
+    bool loaded) {
+  if (!loaded) {
+    LoadFilterSet(is_default_engine);
+    return;
+  }
+  OnRebuildFinished();
+}
+
+void AdBlockService::SourceProviderObserver::OnRebuildFinished() {
+  rebuild_in_progress_ = false;
+  if (!adblock_engine_->IsDefaultEngine()) {
+    owner_->RemovePendingUserCosmeticFiltersUpTo(
+        pending_user_filters_watermark_);
+  }
+  if (std::exchange(rebuild_pending_, false)) {
+    RebuildEngine(adblock_engine_->IsDefaultEngine());
+  }
+}
+
+void AdBlockService::SourceProviderObserver::LoadFilterSet(
+    bool is_default_engine) {
   auto on_loaded_cb = base::BindOnce(
       &AdBlockService::SourceProviderObserver::OnFilterSetCallbackLoaded,
       weak_factory_.GetWeakPtr());
@@ -97,22 +191,32 @@ void AdBlockService::SourceProviderObserver::OnFilterSetCreated(
 }
 
 void AdBlockService::SourceProviderObserver::OnResourcesLoaded(
-    const std::string& resources_json) {
+    AdBlockResources resources) {
   if (!filter_set_) {
     task_runner_->PostTask(
         FROM_HERE,
         base::BindOnce(&AdBlockEngine::UseResources,
-                       adblock_engine_->AsWeakPtr(), resources_json));
+                       adblock_engine_->AsWeakPtr(), std::move(resources)));
   } else {
+    // The engine is compiled off the engine sequence, so the rebuild is only
+    // finished once the compiled engine has been published.
     auto engine_load_callback = base::BindOnce(
         [](base::WeakPtr<AdBlockEngine> engine,
            std::unique_ptr<rust::Box<adblock::FilterSet>> filter_set,
-           const std::string& resources_json) {
+           AdBlockResources resources, const std::string& cache_key,
+           base::OnceClosure on_loaded) {
           if (engine) {
-            engine->Load(std::move(*filter_set.get()), resources_json);
+            engine->LoadInBackground(std::move(*filter_set.get()),
+                                     std::move(resources), cache_key,
+                                     std::move(on_loaded));
           }
         },
-        adblock_engine_->AsWeakPtr(), std::move(filter_set_), resources_json);
+        adblock_engine_->AsWeakPtr(), std::move(filter_set_),
+        std::move(resources),
+        cache_key_,
+        base::BindPostTaskToCurrentDefault(
+            base::BindOnce(&SourceProviderObserver::OnRebuildFinished,
+                           weak_factory_.GetWeakPtr())));
     task_runner_->PostTask(FROM_HERE, std::move(engine_load_callback));
   }
 }
@@ -125,18 +229,58 @@ adblock::BlockerResult AdBlockService::ShouldStartRequest(
     bool previously_matched_rule,
     bool previously_matched_exception,
     bool previously_matched_important) {
-  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-
   TRACE_EVENT("brave.adblock", "ShouldStartRequest", "url", url);
 
+  return ShouldStartRequestInternal(
+      url, resource_type, tab_host,
+      url::Origin::CreateFromNormalizedTuple("https", tab_host, 80),
+      aggressive_blocking,
+      base::FeatureList::IsEnabled(
+          brave_shields::features::kBraveAdblockDefault1pBlocking),
+      previously_matched_rule, previously_matched_exception,
+      previously_matched_important);
+}
+
+std::vector<adblock::BlockerResult> AdBlockService::ShouldStartRequests(
+    const std::vector<RequestToMatch>& requests,
+    const std::string& tab_host,
+    bool aggressive_blocking) {
+  TRACE_EVENT("brave.adblock", "ShouldStartRequests", "count",
+              requests.size());
+
+  const url::Origin tab_origin =
+      url::Origin::CreateFromNormalizedTuple("https", tab_host, 80);
+  const bool default_1p_blocking = base::FeatureList::IsEnabled(
+      brave_shields::features::kBraveAdblockDefault1pBlocking);
+
+  std::vector<adblock::BlockerResult> results;
+  results.reserve(requests.size());
+  for (const auto& request : requests) {
+    results.push_back(ShouldStartRequestInternal(
+        request.url, request.resource_type, tab_host, tab_origin,
+        aggressive_blocking, default_1p_blocking,
+        request.previously_matched_rule, request.previously_matched_exception,
+        request.previously_matched_important));
+  }
+  return results;
+}
+
+adblock::BlockerResult AdBlockService::ShouldStartRequestInternal(
+    const GURL& url,
+    blink::mojom::ResourceType resource_type,
+    const std::string& tab_host,
+    const url::Origin& tab_origin,
+    bool aggressive_blocking,
+    bool default_1p_blocking,
+    bool previously_matched_rule,
+    bool previously_matched_exception,
+    bool previously_matched_important) {
   adblock::BlockerResult fp_result = default_engine_->ShouldStartRequest(
-      url, resource_type, tab_host, previously_matched_rule,
+      url, resource_type, tab_host, tab_origin, previously_matched_rule,
       previously_matched_exception, previously_matched_important);
-  if (aggressive_blocking ||
-      base::FeatureList::IsEnabled(
-          brave_shields::features::kBraveAdblockDefault1pBlocking) ||
+  if (aggressive_blocking || default_1p_blocking ||
       !SameDomainOrHost(
-          url, url::Origin::CreateFromNormalizedTuple("https", tab_host, 80),
+          url, tab_origin,
           net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES)) {
     // removeparam results from the default engine are ignored in default
     // blocking mode
@@ -156,7 +300,7 @@ adblock::BlockerResult AdBlockService::ShouldStartRequest(
                          ? GURL(std::string(fp_result.rewritten_url.value))
                          : url;
   auto result = additional_filters_engine_->ShouldStartRequest(
-      request_url, resource_type, tab_host,
+      request_url, resource_type, tab_host, tab_origin,
       previously_matched_rule | fp_result.matched,
       previously_matched_exception | fp_result.has_exception,
       previously_matched_important | fp_result.important);
@@ -177,8 +321,6 @@ std::optional<std::string> AdBlockService::GetCspDirectives(
     const GURL& url,
     blink::mojom::ResourceType resource_type,
     const std::string& tab_host) {
-  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-
   TRACE_EVENT("brave.adblock", "GetCspDirectives", "url", url);
   auto csp_directives =
       default_engine_->GetCspDirectives(url, resource_type, tab_host);
@@ -190,6 +332,21 @@ std::optional<std::string> AdBlockService::GetCspDirectives(
   return csp_directives;
 }
 
+uint64_t AdBlockService::GetEngineGeneration() const {
+  // Both counters only grow, so their sum changes whenever either does.
+  return default_engine_->generation() +
+         additional_filters_engine_->generation();
+}
+
+bool AdBlockService::MayHaveCspDirectives(
+    const GURL& url,
+    blink::mojom::ResourceType resource_type,
+    const std::string& tab_host) {
+  return default_engine_->MayHaveCspDirectives(url, resource_type, tab_host) ||
+         additional_filters_engine_->MayHaveCspDirectives(url, resource_type,
+                                                          tab_host);
+}
+
 base::Value::Dict AdBlockService::UrlCosmeticResources(
     const std::string& url,
     bool aggressive_blocking) {
@@ -225,6 +382,7 @@ base::Value::Dict AdBlockService::UrlCosmeticResources(
 
   MergeResourcesInto(std::move(additional_resources), resources,
                      /*force_hide=*/true);
+  AppendPendingUserCosmeticFilters(url, resources);
 
   return resources;
 }
@@ -297,13 +455,22 @@ AdBlockService::AdBlockService(
           std::move(subscription_download_manager_getter)),
       component_update_service_(cus),
       task_runner_(task_runner),
+      matching_task_runner_(
+          base::FeatureList::IsEnabled(
+              features::kBraveAdblockConcurrentMatching)
+              ? base::ThreadPool::CreateTaskRunner(
+                    {base::TaskPriority::USER_BLOCKING,
+                     base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})
+              : task_runner_),
       list_p3a_(local_state),
       default_engine_(std::unique_ptr<AdBlockEngine, base::OnTaskRunnerDeleter>(
-          new AdBlockEngine(true /* is_default */),
+          new AdBlockEngine(true /* is_default */,
+                            GetEngineCacheFile(profile_dir, true)),
           base::OnTaskRunnerDeleter(GetTaskRunner()))),
       additional_filters_engine_(
           std::unique_ptr<AdBlockEngine, base::OnTaskRunnerDeleter>(
-              new AdBlockEngine(false /* is_default */),
+              new AdBlockEngine(false /* is_default */,
+                                GetEngineCacheFile(profile_dir, false)),
               base::OnTaskRunnerDeleter(GetTaskRunner()))) {
   TRACE_EVENT("brave.adblock", "AdBlockService");
   // Initializes adblock-rust's domain resolution implementation
@@ -376,6 +543,17 @@ void AdBlockService::EnableTag(const std::string& tag, bool enabled) {
 
 void AdBlockService::AddUserCosmeticFilter(const std::string& filter) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  const size_t separator = filter.find("##");
+  if (base::FeatureList::IsEnabled(
+          features::kBraveAdblockUserCosmeticFilterOverlay) &&
+      separator != std::string::npos && separator > 0) {
+    // Must be queued before the custom filters change, which starts the
+    // rebuild that picks the filter up.
+    base::AutoLock lock(pending_user_cosmetic_filters_lock_);
+    pending_user_cosmetic_filters_.push_back(
+        {next_pending_user_cosmetic_filter_id_++, filter.substr(0, separator),
+         filter.substr(separator + 2)});
+  }
   custom_filters_provider_->AddUserCosmeticFilter(filter);
 }
 
@@ -386,9 +564,47 @@ bool AdBlockService::AreAnyBlockedElementsPresent(std::string_view host) {
 
 void AdBlockService::ResetCosmeticFilter(std::string_view host) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  {
+    base::AutoLock lock(pending_user_cosmetic_filters_lock_);
+    std::erase_if(pending_user_cosmetic_filters_,
+                  [host](const PendingUserCosmeticFilter& pending) {
+                    return pending.host == host;
+                  });
+  }
   custom_filters_provider_->ResetCosmeticFilter(host);
 }
 
+void AdBlockService::AppendPendingUserCosmeticFilters(
+    const std::string& url,
+    base::Value::Dict& resources) {
+  base::AutoLock lock(pending_user_cosmetic_filters_lock_);
+  if (pending_user_cosmetic_filters_.empty()) {
+    return;
+  }
+  const GURL gurl(url);
+  for (const auto& pending : pending_user_cosmetic_filters_) {
+    if (!gurl.DomainIs(pending.host)) {
+      continue;
+    }
+    base::Value::List* force_hide_selectors =
+        resources.EnsureList("force_hide_selectors");
+    force_hide_selectors->Append(pending.selector);
+  }
+}
+
+uint64_t AdBlockService::GetLatestPendingUserCosmeticFilterId() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  return next_pending_user_cosmetic_filter_id_ - 1;
+}
+
+void AdBlockService::RemovePendingUserCosmeticFiltersUpTo(uint64_t id) {
+  base::AutoLock lock(pending_user_cosmetic_filters_lock_);
+  std::erase_if(pending_user_cosmetic_filters_,
+                [id](const PendingUserCosmeticFilter& pending) {
+                  return pending.id <= id;
+                });
+}
+
 void AdBlockService::GetDebugInfoAsync(GetDebugInfoCallback callback) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
@@ -429,6 +645,10 @@ base::SequencedTaskRunner* AdBlockService::GetTaskRunner() {
   return task_runner_.get();
 }
 
+scoped_refptr<base::TaskRunner> AdBlockService::GetMatchingTaskRunner() {
+  return matching_task_runner_;
+}
+
 void RegisterPrefsForAdBlockService(PrefRegistrySimple* registry) {
   registry->RegisterBooleanPref(prefs::kAdBlockCookieListSettingTouched, false);
   registry->RegisterBooleanPref(
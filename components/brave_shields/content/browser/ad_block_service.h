@@ -17,6 +17,7 @@
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
+#include "base/synchronization/lock.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/values.h"
 #include "brave/components/brave_shields/content/browser/ad_block_subscription_download_manager.h"
@@ -29,6 +30,7 @@
 #include "third_party/blink/public/mojom/loader/resource_load_info.mojom-shared.h"
 #include "third_party/rust/cxx/v1/cxx.h"
 #include "url/gurl.h"
+#include "url/origin.h"
 
 class AdBlockServiceTest;
 class EphemeralStorage1pDomainBlockBrowserTest;
@@ -75,13 +77,30 @@ class AdBlockService {
         base::OnceCallback<void(rust::Box<adblock::FilterSet>*)> cb);
     void OnFilterSetCreated(std::unique_ptr<rust::Box<adblock::FilterSet>>);
 
+    void RebuildEngine(bool is_default_engine);
+    void OnRebuildFinished();
+    void LoadFilterSet(bool is_default_engine);
+    void OnResourcesLoadedForCache(AdBlockResources resources);
+    void OnCacheLoadAttempted(bool is_default_engine, bool loaded);
+
     // AdBlockFiltersProvider::Observer
     void OnChanged(bool is_default_engine) override;
 
     // AdBlockResourceProvider::Observer
-    void OnResourcesLoaded(const std::string& resources_json) override;
+    void OnResourcesLoaded(AdBlockResources resources) override;
 
+    raw_ptr<AdBlockService> owner_ = nullptr;  // not owned
+    // The newest pending user cosmetic filter when the current rebuild
+    // started, i.e. the newest one the rebuilt engine is known to contain.
+    uint64_t pending_user_filters_watermark_ = 0;
     std::unique_ptr<rust::Box<adblock::FilterSet>> filter_set_;
+    // Describes the filters of the most recent change, see
+    // AdBlockFiltersProviderManager::GetCacheKeyForEngine.
+    std::string cache_key_;
+    // Changes that arrive while a rebuild is in flight are folded into a
+    // single follow-up rebuild instead of one rebuild per change.
+    bool rebuild_in_progress_ = false;
+    bool rebuild_pending_ = false;
     raw_ptr<AdBlockEngine> adblock_engine_ = nullptr;               // not owned
     raw_ptr<AdBlockResourceProvider> resource_provider_ = nullptr;  // not owned
     raw_ptr<AdBlockResourceProvider> custom_resource_provider_ =
@@ -105,6 +124,8 @@ class AdBlockService {
   AdBlockService& operator=(const AdBlockService&) = delete;
   ~AdBlockService();
 
+  // Request matching methods. These may be called from any thread, see
+  // `GetMatchingTaskRunner`.
   adblock::BlockerResult ShouldStartRequest(
       const GURL& url,
       blink::mojom::ResourceType resource_type,
@@ -113,10 +134,37 @@ class AdBlockService {
       bool previously_matched_rule,
       bool previously_matched_exception,
       bool previously_matched_important);
+
+  // A single request to be matched by `ShouldStartRequests`.
+  struct RequestToMatch {
+    GURL url;
+    blink::mojom::ResourceType resource_type;
+    bool previously_matched_rule = false;
+    bool previously_matched_exception = false;
+    bool previously_matched_important = false;
+  };
+
+  // Batched variant of `ShouldStartRequest` for requests that share the same
+  // tab host and blocking mode. Results are returned in the same order as
+  // `requests`. Per-tab state (the tab origin, feature checks) is computed
+  // once for the whole batch.
+  std::vector<adblock::BlockerResult> ShouldStartRequests(
+      const std::vector<RequestToMatch>& requests,
+      const std::string& tab_host,
+      bool aggressive_blocking);
   std::optional<std::string> GetCspDirectives(
       const GURL& url,
       blink::mojom::ResourceType resource_type,
       const std::string& tab_host);
+  // Returns false if `GetCspDirectives` is already known to return nothing for
+  // these arguments, in which case it does not need to be called. Can be
+  // called from any thread.
+  bool MayHaveCspDirectives(const GURL& url,
+                            blink::mojom::ResourceType resource_type,
+                            const std::string& tab_host);
+  // Changes whenever the result of `ShouldStartRequest` may change for any
+  // request. Can be called from any thread.
+  uint64_t GetEngineGeneration() const;
   base::Value::Dict UrlCosmeticResources(const std::string& url,
                                          bool aggressive_blocking);
   base::Value::Dict HiddenClassIdSelectors(
@@ -144,6 +192,12 @@ class AdBlockService {
 
   base::SequencedTaskRunner* GetTaskRunner();
 
+  // Returns the task runner on which network requests should be matched with
+  // `ShouldStartRequest(s)` and `GetCspDirectives`. Unlike the rest of the
+  // service, those methods may run on any thread, so this is a parallel task
+  // runner when kBraveAdblockConcurrentMatching is enabled.
+  scoped_refptr<base::TaskRunner> GetMatchingTaskRunner();
+
  private:
   friend class ::AdBlockServiceTest;
   friend class ::EphemeralStorage1pDomainBlockBrowserTest;
@@ -154,6 +208,17 @@ class AdBlockService {
 
   static std::string g_ad_block_dat_file_version_;
 
+  adblock::BlockerResult ShouldStartRequestInternal(
+      const GURL& url,
+      blink::mojom::ResourceType resource_type,
+      const std::string& tab_host,
+      const url::Origin& tab_origin,
+      bool aggressive_blocking,
+      bool default_1p_blocking,
+      bool previously_matched_rule,
+      bool previously_matched_exception,
+      bool previously_matched_important);
+
   AdBlockDefaultResourceProvider* default_resource_provider();
   AdBlockComponentFiltersProvider* default_filters_provider() {
     DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
@@ -178,6 +243,18 @@ class AdBlockService {
 
   static void StripProceduralFilters(base::Value::Dict& resources);
 
+  // Element picker rules waiting for the additional filters engine to be
+  // rebuilt with them, see kBraveAdblockUserCosmeticFilterOverlay.
+  struct PendingUserCosmeticFilter {
+    uint64_t id;
+    std::string host;
+    std::string selector;
+  };
+  void AppendPendingUserCosmeticFilters(const std::string& url,
+                                        base::Value::Dict& resources);
+  uint64_t GetLatestPendingUserCosmeticFilterId();
+  void RemovePendingUserCosmeticFiltersUpTo(uint64_t id);
+
   raw_ptr<PrefService> local_state_;
   std::string locale_;
   base::FilePath profile_dir_;
@@ -188,6 +265,7 @@ class AdBlockService {
   raw_ptr<component_updater::ComponentUpdateService> component_update_service_;
 
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
+  scoped_refptr<base::TaskRunner> matching_task_runner_;
 
   AdBlockListP3A list_p3a_;
 
@@ -223,6 +301,13 @@ class AdBlockService {
   std::unique_ptr<SourceProviderObserver> additional_filters_service_observer_
       GUARDED_BY_CONTEXT(sequence_checker_);
 
+  // Read on the adblock task runner, written on the UI sequence.
+  base::Lock pending_user_cosmetic_filters_lock_;
+  std::vector<PendingUserCosmeticFilter> pending_user_cosmetic_filters_
+      GUARDED_BY(pending_user_cosmetic_filters_lock_);
+  uint64_t next_pending_user_cosmetic_filter_id_
+      GUARDED_BY_CONTEXT(sequence_checker_) = 1;
+
   SEQUENCE_CHECKER(sequence_checker_);
 
   base::WeakPtrFactory<AdBlockService> weak_factory_{this};
@@ -17,10 +17,22 @@
 #include "brave/components/brave_shields/content/browser/ad_block_subscription_download_manager.h"
 #include "brave/components/brave_shields/content/browser/ad_block_subscription_service_manager.h"
 #include "components/download/public/background_service/download_metadata.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_status_code.h"
 #include "services/network/public/cpp/resource_request_body.h"
 
 namespace brave_shields {
 
+namespace {
+
+bool IsNotModified(const download::CompletionInfo& completion_info) {
+  return completion_info.response_headers &&
+         completion_info.response_headers->response_code() ==
+             net::HTTP_NOT_MODIFIED;
+}
+
+}  // namespace
+
 AdBlockSubscriptionDownloadClient::AdBlockSubscriptionDownloadClient(
     AdBlockSubscriptionServiceManager* subscription_manager)
     : subscription_manager_(subscription_manager) {}
@@ -71,9 +83,18 @@ void AdBlockSubscriptionDownloadClient::OnDownloadFailed(
     download::Client::FailureReason reason) {
   AdBlockSubscriptionDownloadManager* download_manager =
       GetAdBlockSubscriptionDownloadManager();
-  if (download_manager) {
-    download_manager->OnDownloadFailed(guid);
+  if (!download_manager) {
+    return;
   }
+
+  // Conditional refreshes of unchanged lists end up here, since the download
+  // service treats any non-2xx response as a failure.
+  if (IsNotModified(completion_info)) {
+    download_manager->OnDownloadNotModified(guid);
+    return;
+  }
+
+  download_manager->OnDownloadFailed(guid);
 }
 
 void AdBlockSubscriptionDownloadClient::OnDownloadSucceeded(
@@ -90,6 +111,11 @@ void AdBlockSubscriptionDownloadClient::OnDownloadSucceeded(
     return;
   }
 
+  if (IsNotModified(completion_info)) {
+    download_manager->OnDownloadNotModified(guid);
+    return;
+  }
+
   std::string mimetype;
   if (!completion_info.response_headers->GetMimeType(&mimetype)) {
     download_manager->OnDownloadFailed(guid);
@@ -101,7 +127,13 @@ void AdBlockSubscriptionDownloadClient::OnDownloadSucceeded(
     return;
   }
 
-  download_manager->OnDownloadSucceeded(guid, completion_info.path);
+  ListValidators validators;
+  validators.etag =
+      completion_info.response_headers->GetNormalizedHeader("ETag");
+  validators.last_modified =
+      completion_info.response_headers->GetNormalizedHeader("Last-Modified");
+  download_manager->OnDownloadSucceeded(guid, completion_info.path,
+                                        validators);
 }
 
 bool AdBlockSubscriptionDownloadClient::CanServiceRemoveDownloadedFile(
@@ -15,6 +15,7 @@
 #include "brave/components/brave_shields/core/common/brave_shield_constants.h"
 #include "build/build_config.h"
 #include "components/download/public/background_service/background_download_service.h"
+#include "net/http/http_request_headers.h"
 #include "net/traffic_annotation/network_traffic_annotation.h"
 
 namespace brave_shields {
@@ -51,6 +52,11 @@ const net::NetworkTrafficAnnotationTag
 
 }  // namespace
 
+ListValidators::ListValidators() = default;
+ListValidators::~ListValidators() = default;
+ListValidators::ListValidators(const ListValidators&) = default;
+ListValidators& ListValidators::operator=(const ListValidators&) = default;
+
 AdBlockSubscriptionDownloadManager::AdBlockSubscriptionDownloadManager(
     download::BackgroundDownloadService* download_service,
     scoped_refptr<base::SequencedTaskRunner> background_task_runner)
@@ -61,8 +67,10 @@ AdBlockSubscriptionDownloadManager::AdBlockSubscriptionDownloadManager(
 AdBlockSubscriptionDownloadManager::~AdBlockSubscriptionDownloadManager() =
     default;
 
-void AdBlockSubscriptionDownloadManager::StartDownload(const GURL& download_url,
-                                                       bool from_ui) {
+void AdBlockSubscriptionDownloadManager::StartDownload(
+    const GURL& download_url,
+    bool from_ui,
+    const ListValidators& validators) {
   download::DownloadParams download_params;
   download_params.client = download::DownloadClient::CUSTOM_LIST_SUBSCRIPTIONS;
   download_params.guid = base::Uuid::GenerateRandomV4().AsLowercaseString();
@@ -73,6 +81,14 @@ void AdBlockSubscriptionDownloadManager::StartDownload(const GURL& download_url,
       kBraveShieldsAdBlockSubscriptionTrafficAnnotation);
   download_params.request_params.url = download_url;
   download_params.request_params.method = "GET";
+  if (validators.etag) {
+    download_params.request_params.request_headers.SetHeader(
+        net::HttpRequestHeaders::kIfNoneMatch, *validators.etag);
+  }
+  if (validators.last_modified) {
+    download_params.request_params.request_headers.SetHeader(
+        net::HttpRequestHeaders::kIfModifiedSince, *validators.last_modified);
+  }
   if (from_ui) {
     // This triggers a high priority download with no network restrictions to
     // provide status feedback as quickly as possible.
@@ -158,9 +174,26 @@ bool EnsureDirExists(const base::FilePath& destination_dir) {
   return base::CreateDirectory(destination_dir);
 }
 
+void AdBlockSubscriptionDownloadManager::OnDownloadNotModified(
+    const std::string& guid) {
+  auto it = pending_download_guids_.find(guid);
+  if (it == pending_download_guids_.end()) {
+    return;
+  }
+  GURL download_url = it->second;
+  pending_download_guids_.erase(guid);
+
+  base::UmaHistogramBoolean(
+      "BraveShields.AdBlockSubscriptionDownloadManager.DownloadSucceeded",
+      true);
+
+  on_download_not_modified_callback_.Run(download_url);
+}
+
 void AdBlockSubscriptionDownloadManager::OnDownloadSucceeded(
     const std::string& guid,
-    base::FilePath downloaded_file) {
+    base::FilePath downloaded_file,
+    const ListValidators& validators) {
   auto it = pending_download_guids_.find(guid);
   if (it == pending_download_guids_.end()) {
     return;
@@ -177,12 +210,13 @@ void AdBlockSubscriptionDownloadManager::OnDownloadSucceeded(
       base::BindOnce(&EnsureDirExists,
                      subscription_path_callback_.Run(download_url)),
       base::BindOnce(&AdBlockSubscriptionDownloadManager::OnDirCreated,
-                     AsWeakPtr(), downloaded_file, download_url));
+                     AsWeakPtr(), downloaded_file, download_url, validators));
 }
 
 void AdBlockSubscriptionDownloadManager::OnDirCreated(
     base::FilePath downloaded_file,
     const GURL& download_url,
+    const ListValidators& validators,
     bool created) {
   if (!created) {
     on_download_failed_callback_.Run(download_url);
@@ -196,11 +230,12 @@ void AdBlockSubscriptionDownloadManager::OnDirCreated(
       FROM_HERE,
       base::BindOnce(&base::ReplaceFile, downloaded_file, list_path, nullptr),
       base::BindOnce(&AdBlockSubscriptionDownloadManager::ReplaceFileCallback,
-                     AsWeakPtr(), download_url));
+                     AsWeakPtr(), download_url, validators));
 }
 
 void AdBlockSubscriptionDownloadManager::ReplaceFileCallback(
     const GURL& download_url,
+    const ListValidators& validators,
     bool success) {
   if (!success) {
     on_download_failed_callback_.Run(download_url);
@@ -208,7 +243,7 @@ void AdBlockSubscriptionDownloadManager::ReplaceFileCallback(
   }
 
   // this should send the data to subscription manager
-  on_download_succeeded_callback_.Run(download_url);
+  on_download_succeeded_callback_.Run(download_url, validators);
 }
 
 }  // namespace brave_shields
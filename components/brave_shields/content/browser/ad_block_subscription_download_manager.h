@@ -8,6 +8,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <utility>
@@ -30,6 +31,19 @@ class AdBlockSubscriptionServiceManager;
 
 class AdBlockSubscriptionDownloadClient;
 
+// HTTP cache validators of the last successfully downloaded copy of a list.
+// They are sent back with the next refresh so that servers can answer with
+// `304 Not Modified` instead of the full list.
+struct ListValidators {
+  ListValidators();
+  ~ListValidators();
+  ListValidators(const ListValidators&);
+  ListValidators& operator=(const ListValidators&);
+
+  std::optional<std::string> etag;
+  std::optional<std::string> last_modified;
+};
+
 // Manages the downloads of filter lists for custom subscriptions.
 class AdBlockSubscriptionDownloadManager final : public KeyedService {
  public:
@@ -46,8 +60,11 @@ class AdBlockSubscriptionDownloadManager final : public KeyedService {
       const AdBlockSubscriptionDownloadManager&) = delete;
 
   // Starts a download for |download_url|. Will schedule a higher priority
-  // download if |from_ui| is true.
-  void StartDownload(const GURL& download_url, bool from_ui);
+  // download if |from_ui| is true. |validators| turn the request into a
+  // conditional one.
+  void StartDownload(const GURL& download_url,
+                     bool from_ui,
+                     const ListValidators& validators);
 
   // Cancels all pending downloads.
   void CancelAllPendingDownloads();
@@ -62,11 +79,17 @@ class AdBlockSubscriptionDownloadManager final : public KeyedService {
   }
 
   void set_on_download_succeeded_callback(
-      base::RepeatingCallback<void(const GURL&)>
+      base::RepeatingCallback<void(const GURL&, const ListValidators&)>
           on_download_succeeded_callback) {
     on_download_succeeded_callback_ = on_download_succeeded_callback;
   }
 
+  void set_on_download_not_modified_callback(
+      base::RepeatingCallback<void(const GURL&)>
+          on_download_not_modified_callback) {
+    on_download_not_modified_callback_ = on_download_not_modified_callback;
+  }
+
   void set_on_download_failed_callback(
       base::RepeatingCallback<void(const GURL&)> on_download_failed_callback) {
     on_download_failed_callback_ = on_download_failed_callback;
@@ -104,18 +127,26 @@ class AdBlockSubscriptionDownloadManager final : public KeyedService {
 
   // Invoked when the download as specified by |downloaded_guid| succeeded.
   void OnDownloadSucceeded(const std::string& downloaded_guid,
-                           base::FilePath downloaded_file);
+                           base::FilePath downloaded_file,
+                           const ListValidators& validators);
+
+  // Invoked when the server reported that the list as specified by
+  // |download_guid| did not change since the last download.
+  void OnDownloadNotModified(const std::string& download_guid);
 
   // Invoked when the download as specified by |failed_download_guid| failed.
   void OnDownloadFailed(const std::string& failed_download_guid);
 
   void OnDirCreated(base::FilePath downloaded_file,
                     const GURL& download_url,
+                    const ListValidators& validators,
                     bool created);
 
   // Invoked after ReplaceFile to report the status of moving the temporary
   // download file to its destination path.
-  void ReplaceFileCallback(const GURL& download_url, bool success);
+  void ReplaceFileCallback(const GURL& download_url,
+                           const ListValidators& validators,
+                           bool success);
 
   // GUIDs that are still pending download, mapped to the corresponding URLs of
   // their subscription services.
@@ -142,7 +173,9 @@ class AdBlockSubscriptionDownloadManager final : public KeyedService {
 
   base::RepeatingCallback<base::FilePath(const GURL&)>
       subscription_path_callback_;
-  base::RepeatingCallback<void(const GURL&)> on_download_succeeded_callback_;
+  base::RepeatingCallback<void(const GURL&, const ListValidators&)>
+      on_download_succeeded_callback_;
+  base::RepeatingCallback<void(const GURL&)> on_download_not_modified_callback_;
   base::RepeatingCallback<void(const GURL&)> on_download_failed_callback_;
 
   base::WeakPtrFactory<AdBlockSubscriptionDownloadManager> weak_ptr_factory_{
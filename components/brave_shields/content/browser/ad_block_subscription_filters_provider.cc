@@ -8,13 +8,17 @@
 #include <string>
 #include <utility>
 
+#include "base/files/file_util.h"
 #include "base/logging.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/task/single_thread_task_runner.h"
 #include "base/task/thread_pool.h"
 #include "brave/components/brave_shields/core/browser/ad_block_filters_provider.h"
 #include "brave/components/brave_shields/core/browser/adblock/rs/src/lib.rs.h"
 #include "components/prefs/pref_service.h"
+#include "crypto/sha2.h"
 
 namespace brave_shields {
 
@@ -37,6 +41,14 @@ void AddDATBufferToFilterSet(
   }
 }
 
+std::string HashListFile(const base::FilePath& list_file) {
+  std::string contents;
+  // A missing or unreadable list hashes like an empty one, matching what
+  // LoadFilterSet would hand to the engine.
+  base::ReadFileToString(list_file, &contents);
+  return base::HexEncode(crypto::SHA256HashString(contents));
+}
+
 }  // namespace
 
 AdBlockSubscriptionFiltersProvider::AdBlockSubscriptionFiltersProvider(
@@ -92,7 +104,33 @@ void AdBlockSubscriptionFiltersProvider::OnDATFileDataReady(
 }
 
 void AdBlockSubscriptionFiltersProvider::OnListAvailable() {
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&HashListFile, list_file_),
+      base::BindOnce(&AdBlockSubscriptionFiltersProvider::OnListHashed,
+                     weak_factory_.GetWeakPtr()));
+}
+
+void AdBlockSubscriptionFiltersProvider::OnListHashed(std::string list_hash) {
+  if (list_hash_ == list_hash) {
+    // Most periodic refreshes return an identical list, which would otherwise
+    // recompile the whole additional engine for nothing.
+    return;
+  }
+  list_hash_ = std::move(list_hash);
   NotifyObservers(engine_is_default_);
 }
 
+std::string AdBlockSubscriptionFiltersProvider::GetCacheKey() {
+  if (!list_hash_) {
+    return std::string();
+  }
+  return base::StrCat({"subscription:", list_file_.AsUTF8Unsafe(), ":",
+                       *list_hash_});
+}
+
+bool AdBlockSubscriptionFiltersProvider::IsInitialized() const {
+  return list_hash_.has_value();
+}
+
 }  // namespace brave_shields
@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_CONTENT_BROWSER_AD_BLOCK_SUBSCRIPTION_FILTERS_PROVIDER_H_
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_CONTENT_BROWSER_AD_BLOCK_SUBSCRIPTION_FILTERS_PROVIDER_H_
 
+#include <optional>
 #include <string>
 
 #include "base/functional/callback.h"
@@ -45,9 +46,17 @@ class AdBlockSubscriptionFiltersProvider : public AdBlockFiltersProvider {
       base::OnceCallback<void(
           base::OnceCallback<void(rust::Box<adblock::FilterSet>*)>)>) override;
 
+  // Called whenever a new copy of the list was downloaded. Observers are only
+  // notified when the list contents differ from the ones previously seen.
   void OnListAvailable();
 
+  // AdBlockFiltersProvider:
+  std::string GetCacheKey() override;
+  bool IsInitialized() const override;
+
  private:
+  void OnListHashed(std::string list_hash);
+
   void OnDATFileDataReady(
       base::OnceCallback<
           void(base::OnceCallback<void(rust::Box<adblock::FilterSet>*)>)> cb,
@@ -58,6 +67,9 @@ class AdBlockSubscriptionFiltersProvider : public AdBlockFiltersProvider {
 
  private:
   base::FilePath list_file_;
+  // Hex encoded SHA-256 of the list file, unset until the first hash after
+  // construction completes.
+  std::optional<std::string> list_hash_;
 
   base::RepeatingCallback<void(const adblock::FilterListMetadata&)>
       on_metadata_retrieved_;
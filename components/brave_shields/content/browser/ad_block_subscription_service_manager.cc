@@ -18,6 +18,7 @@
 #include "base/functional/bind.h"
 #include "base/json/json_value_converter.h"
 #include "base/json/values_util.h"
+#include "base/rand_util.h"
 #include "base/task/thread_pool.h"
 #include "base/time/time.h"
 #include "base/values.h"
@@ -42,6 +43,9 @@ namespace {
 constexpr uint16_t kSubscriptionMaxExpiresHours = 14 * 24;
 constexpr base::TimeDelta kListRetryInterval = base::Hours(1);
 constexpr base::TimeDelta kListCheckInitialDelay = base::Minutes(1);
+// Upper bound on how long the lists refreshed by one update check are held
+// back waiting for the remaining downloads of that check.
+constexpr base::TimeDelta kListRefreshWindow = base::Minutes(10);
 
 bool SkipGURLField(std::string_view value, GURL* field) {
   return true;
@@ -124,6 +128,11 @@ void SubscriptionInfo::RegisterJSONConverter(
       "title", &SubscriptionInfo::title, &ParseOptionalStringField);
   converter->RegisterCustomValueField<uint16_t>(
       "expires", &SubscriptionInfo::expires, &ParseExpiresWithFallback);
+  converter->RegisterCustomValueField<std::optional<std::string>>(
+      "etag", &SubscriptionInfo::etag, &ParseOptionalStringField);
+  converter->RegisterCustomValueField<std::optional<std::string>>(
+      "last_modified", &SubscriptionInfo::last_modified,
+      &ParseOptionalStringField);
 }
 
 AdBlockSubscriptionServiceManager::AdBlockSubscriptionServiceManager(
@@ -206,24 +215,65 @@ void AdBlockSubscriptionServiceManager::OnUpdateTimer(
       if (info.enabled &&
           ((info.last_update_attempt != info.last_successful_update_attempt) ||
            (until_next_refresh <= base::TimeDelta()))) {
-        StartDownload(sub_url, false);
+        if (StartDownload(sub_url, false)) {
+          pending_refreshes_.insert(sub_url);
+        }
       }
     }
   }
 
+  if (!pending_refreshes_.empty() && !refresh_window_timer_.IsRunning()) {
+    refresh_window_timer_.Start(
+        FROM_HERE, kListRefreshWindow,
+        base::BindOnce(&AdBlockSubscriptionServiceManager::FlushRefreshedLists,
+                       base::Unretained(this)));
+  }
+
   std::move(on_finished).Run();
 }
 
-void AdBlockSubscriptionServiceManager::StartDownload(const GURL& sub_url,
+bool AdBlockSubscriptionServiceManager::StartDownload(const GURL& sub_url,
                                                       bool from_ui) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  // A manual refresh should be applied as soon as it completes rather than
+  // wait for the rest of a pending refresh window.
+  if (from_ui && pending_refreshes_.contains(sub_url)) {
+    OnScheduledRefreshFinished(sub_url);
+  }
+
   // The download manager is tied to the lifetime of the profile, but
   // the AdBlockSubscriptionServiceManager lives as long as the browser process
-  if (download_manager_) {
-    bool download_service_available =
-        download_manager_->IsAvailableForDownloads();
-    if (download_service_available) {
-      download_manager_->StartDownload(sub_url, from_ui);
+  if (!download_manager_ || !download_manager_->IsAvailableForDownloads()) {
+    return false;
+  }
+
+  ListValidators validators;
+  if (std::optional<SubscriptionInfo> info = GetInfo(sub_url)) {
+    validators.etag = info->etag;
+    validators.last_modified = info->last_modified;
+  }
+  download_manager_->StartDownload(sub_url, from_ui, validators);
+  return true;
+}
+
+void AdBlockSubscriptionServiceManager::OnScheduledRefreshFinished(
+    const GURL& sub_url) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (pending_refreshes_.erase(sub_url) && pending_refreshes_.empty()) {
+    FlushRefreshedLists();
+  }
+}
+
+void AdBlockSubscriptionServiceManager::FlushRefreshedLists() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  refresh_window_timer_.Stop();
+  pending_refreshes_.clear();
+
+  for (const GURL& sub_url : std::exchange(refreshed_lists_, {})) {
+    auto* subscription_filters_provider =
+        base::FindPtrOrNull(subscription_filters_providers_, sub_url);
+    if (subscription_filters_provider) {
+      subscription_filters_provider->OnListAvailable();
     }
   }
 }
@@ -251,6 +301,9 @@ void AdBlockSubscriptionServiceManager::CreateSubscription(
           base::BindRepeating(
               &AdBlockSubscriptionServiceManager::OnListMetadata,
               weak_ptr_factory_.GetWeakPtr(), sub_url));
+  // Hash the (not yet downloaded) list so that the provider reports itself as
+  // initialized even if the first download fails.
+  subscription_filters_provider->OnListAvailable();
   subscription_filters_providers_.insert(
       std::make_pair(sub_url, std::move(subscription_filters_provider)));
 
@@ -338,6 +391,10 @@ void AdBlockSubscriptionServiceManager::OnGetDownloadManager(
   download_manager_->set_on_download_succeeded_callback(base::BindRepeating(
       &AdBlockSubscriptionServiceManager::OnSubscriptionDownloaded,
       base::Unretained(this)));
+  download_manager_->set_on_download_not_modified_callback(
+      base::BindRepeating(
+          &AdBlockSubscriptionServiceManager::OnSubscriptionNotModified,
+          base::Unretained(this)));
   download_manager_->set_on_download_failed_callback(base::BindRepeating(
       &AdBlockSubscriptionServiceManager::OnSubscriptionDownloadFailure,
       base::Unretained(this)));
@@ -345,8 +402,11 @@ void AdBlockSubscriptionServiceManager::OnGetDownloadManager(
   download_manager_->CancelAllPendingDownloads();
   LoadSubscriptionServices();
 
+  // Jitter the first check so that the refresh does not always coincide with
+  // the rest of the startup work.
   subscription_update_timer_->Schedule(
-      kListCheckInitialDelay, kListRetryInterval,
+      kListCheckInitialDelay + base::RandTimeDeltaUpTo(kListCheckInitialDelay),
+      kListRetryInterval,
       base::BindRepeating(&AdBlockSubscriptionServiceManager::OnUpdateTimer,
                           weak_ptr_factory_.GetWeakPtr()),
       base::DoNothing());
@@ -477,6 +537,12 @@ void AdBlockSubscriptionServiceManager::UpdateSubscriptionPrefs(
       subscription_dict.Set("title", *info.title);
     }
     subscription_dict.Set("expires", info.expires);
+    if (info.etag) {
+      subscription_dict.Set("etag", *info.etag);
+    }
+    if (info.last_modified) {
+      subscription_dict.Set("last_modified", *info.last_modified);
+    }
     subscriptions.Set(sub_url.spec(), std::move(subscription_dict));
 
     // TODO(bridiver) - change to pref registrar
@@ -503,30 +569,60 @@ void AdBlockSubscriptionServiceManager::ClearSubscriptionPrefs(
 }
 
 void AdBlockSubscriptionServiceManager::OnSubscriptionDownloaded(
-    const GURL& sub_url) {
+    const GURL& sub_url,
+    const ListValidators& validators) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
   std::optional<SubscriptionInfo> info = GetInfo(sub_url);
 
   if (!info) {
+    OnScheduledRefreshFinished(sub_url);
     return;
   }
 
   info->last_update_attempt = base::Time::Now();
   info->last_successful_update_attempt = info->last_update_attempt;
+  info->etag = validators.etag;
+  info->last_modified = validators.last_modified;
   UpdateSubscriptionPrefs(sub_url, *info);
 
-  auto* subscription_filters_provider =
-      base::FindPtrOrNull(subscription_filters_providers_, sub_url);
-  if (subscription_filters_provider) {
-    subscription_filters_provider->OnListAvailable();
+  if (pending_refreshes_.contains(sub_url)) {
+    refreshed_lists_.insert(sub_url);
+    OnScheduledRefreshFinished(sub_url);
+  } else {
+    auto* subscription_filters_provider =
+        base::FindPtrOrNull(subscription_filters_providers_, sub_url);
+    if (subscription_filters_provider) {
+      subscription_filters_provider->OnListAvailable();
+    }
   }
 
   NotifyObserversOfServiceEvent();
 }
 
+void AdBlockSubscriptionServiceManager::OnSubscriptionNotModified(
+    const GURL& sub_url) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  OnScheduledRefreshFinished(sub_url);
+
+  std::optional<SubscriptionInfo> info = GetInfo(sub_url);
+
+  if (!info) {
+    return;
+  }
+
+  // The cached list is still current, so there is nothing to reload.
+  info->last_update_attempt = base::Time::Now();
+  info->last_successful_update_attempt = info->last_update_attempt;
+  UpdateSubscriptionPrefs(sub_url, *info);
+
+  NotifyObserversOfServiceEvent();
+}
+
 void AdBlockSubscriptionServiceManager::OnSubscriptionDownloadFailure(
     const GURL& sub_url) {
+  OnScheduledRefreshFinished(sub_url);
+
   std::optional<SubscriptionInfo> info = GetInfo(sub_url);
 
   if (!info) {
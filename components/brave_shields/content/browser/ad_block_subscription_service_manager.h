@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -18,6 +19,7 @@
 #include "base/observer_list.h"
 #include "base/sequence_checker.h"
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "base/values.h"
 #include "brave/components/brave_shields/content/browser/ad_block_subscription_download_manager.h"
 #include "brave/components/brave_shields/core/browser/ad_block_filters_provider_manager.h"
@@ -69,6 +71,11 @@ struct SubscriptionInfo {
   std::optional<std::string> title;
   uint16_t expires = kSubscriptionDefaultExpiresHours;
 
+  // HTTP validators of the last downloaded copy of the list, used to make the
+  // next refresh a conditional request.
+  std::optional<std::string> etag;
+  std::optional<std::string> last_modified;
+
   static void RegisterJSONConverter(
       base::JSONValueConverter<SubscriptionInfo>*);
 };
@@ -107,7 +114,9 @@ class AdBlockSubscriptionServiceManager {
   }
 
   void OnSubscriptionDownloadFailure(const GURL& sub_url);
-  void OnSubscriptionDownloaded(const GURL& sub_url);
+  void OnSubscriptionDownloaded(const GURL& sub_url,
+                                const ListValidators& validators);
+  void OnSubscriptionNotModified(const GURL& sub_url);
 
   void AddObserver(AdBlockSubscriptionServiceManagerObserver* observer);
   void RemoveObserver(AdBlockSubscriptionServiceManagerObserver* observer);
@@ -121,7 +130,16 @@ class AdBlockSubscriptionServiceManager {
   void OnUpdateTimer(
       component_updater::TimerUpdateScheduler::OnFinishedCallback on_finished);
 
-  void StartDownload(const GURL& sub_url, bool from_ui);
+  // Returns false if the download could not be handed to the download
+  // manager.
+  bool StartDownload(const GURL& sub_url, bool from_ui);
+
+  // Scheduled refreshes are collected into a refresh window, and the lists
+  // that changed are only handed to their filters providers once every
+  // download of the window has finished (or the window timed out), so that
+  // the engine is rebuilt once per window rather than once per list.
+  void OnScheduledRefreshFinished(const GURL& sub_url);
+  void FlushRefreshedLists();
 
   bool initialized_;
   void LoadSubscriptionServices();
@@ -154,6 +172,13 @@ class AdBlockSubscriptionServiceManager {
   std::unique_ptr<component_updater::TimerUpdateScheduler>
       subscription_update_timer_ GUARDED_BY_CONTEXT(sequence_checker_);
 
+  // Subscriptions of the current refresh window whose download is still in
+  // flight, and the ones that were downloaded but not reloaded yet.
+  std::set<GURL> pending_refreshes_ GUARDED_BY_CONTEXT(sequence_checker_);
+  std::set<GURL> refreshed_lists_ GUARDED_BY_CONTEXT(sequence_checker_);
+  base::OneShotTimer refresh_window_timer_
+      GUARDED_BY_CONTEXT(sequence_checker_);
+
   raw_ptr<AdBlockListP3A> list_p3a_;
 
   base::ObserverList<AdBlockSubscriptionServiceManagerObserver> observers_
@@ -10,10 +10,12 @@
 #include <utility>
 
 #include "base/check.h"
+#include "base/containers/lru_cache.h"
 #include "base/feature_list.h"
 #include "base/functional/bind.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/notreached.h"
+#include "base/supports_user_data.h"
 #include "base/task/single_thread_task_runner.h"
 #include "brave/components/brave_shields/content/browser/ad_block_service.h"
 #include "brave/components/brave_shields/content/browser/brave_shields_util.h"
@@ -95,6 +97,42 @@ ShouldBlockDomainOnTaskRunner(brave_shields::AdBlockService* ad_block_service,
   return block_result;
 }
 
+// Main frame URLs that the domain block check allowed, per profile. An entry
+// only applies while the adblock engines are at the generation it was
+// computed with, so filter list and tag changes are picked up right away.
+class AllowedDomainBlockNavigations : public base::SupportsUserData::Data {
+ public:
+  static AllowedDomainBlockNavigations& GetForContext(
+      content::BrowserContext* context) {
+    auto* self = static_cast<AllowedDomainBlockNavigations*>(
+        context->GetUserData(kUserDataKey));
+    if (!self) {
+      auto data = std::make_unique<AllowedDomainBlockNavigations>();
+      self = data.get();
+      context->SetUserData(kUserDataKey, std::move(data));
+    }
+    return *self;
+  }
+
+  bool IsAllowed(const GURL& url, bool aggressive_mode, uint64_t generation) {
+    auto it = allowed_.Get({url, aggressive_mode});
+    return it != allowed_.end() && it->second == generation;
+  }
+
+  void RecordAllowed(const GURL& url,
+                     bool aggressive_mode,
+                     uint64_t generation) {
+    allowed_.Put({url, aggressive_mode}, generation);
+  }
+
+ private:
+  static constexpr char kUserDataKey[] = "AllowedDomainBlockNavigations";
+  static constexpr size_t kMaxEntries = 128;
+
+  // Maps (url, aggressive mode) to the engine generation it was allowed at.
+  base::LRUCache<std::pair<GURL, bool>, uint64_t> allowed_{kMaxEntries};
+};
+
 }  // namespace
 
 namespace brave_shields {
@@ -176,6 +214,20 @@ DomainBlockNavigationThrottle::WillStartRequest() {
       brave_shields::GetCosmeticFilteringControlType(
           content_settings_, request_url) == brave_shields::ControlType::BLOCK;
 
+  // The URL was allowed before and the engines have not changed since, so
+  // there is no need to ask the ad block service again.
+  const uint64_t engine_generation = ad_block_service_->GetEngineGeneration();
+  if (base::FeatureList::IsEnabled(
+          brave_shields::features::kBraveDomainBlockDecisionCache) &&
+      AllowedDomainBlockNavigations::GetForContext(
+          web_contents->GetBrowserContext())
+          .IsAllowed(request_url, aggressive_mode, engine_generation)) {
+    UMA_HISTOGRAM_BOOLEAN("Brave.DomainBlock.Deferred", false);
+    tab_storage->DropBlockedDomain1PESLifetime();
+    return content::NavigationThrottle::PROCEED;
+  }
+  UMA_HISTOGRAM_BOOLEAN("Brave.DomainBlock.Deferred", true);
+
   // Otherwise, call the ad block service on a task runner to determine whether
   // this domain should be blocked.
   ad_block_service_->GetTaskRunner()->PostTaskAndReplyWithResult(
@@ -183,7 +235,8 @@ DomainBlockNavigationThrottle::WillStartRequest() {
       base::BindOnce(&ShouldBlockDomainOnTaskRunner, ad_block_service_,
                      request_url, aggressive_mode),
       base::BindOnce(&DomainBlockNavigationThrottle::OnShouldBlockDomain,
-                     weak_ptr_factory_.GetWeakPtr(), domain_blocking_type));
+                     weak_ptr_factory_.GetWeakPtr(), domain_blocking_type,
+                     request_url, aggressive_mode, engine_generation));
 
   // Since the call to the ad block service is asynchronous, we defer the final
   // decision of whether to allow or block this navigation. The callback from
@@ -210,6 +263,9 @@ DomainBlockNavigationThrottle::WillProcessResponse() {
 
 void DomainBlockNavigationThrottle::OnShouldBlockDomain(
     DomainBlockingType domain_blocking_type,
+    const GURL& request_url,
+    bool aggressive_mode,
+    uint64_t engine_generation,
     const BlockResult& block_result) {
   const bool should_block = block_result.should_block;
   const GURL new_url(block_result.new_url);
@@ -220,6 +276,12 @@ void DomainBlockNavigationThrottle::OnShouldBlockDomain(
   }
 
   if (!should_block && !new_url.is_valid()) {
+    if (base::FeatureList::IsEnabled(
+            brave_shields::features::kBraveDomainBlockDecisionCache)) {
+      AllowedDomainBlockNavigations::GetForContext(
+          navigation_handle()->GetWebContents()->GetBrowserContext())
+          .RecordAllowed(request_url, aggressive_mode, engine_generation);
+    }
     DomainBlockTabStorage* tab_storage = DomainBlockTabStorage::FromWebContents(
         navigation_handle()->GetWebContents());
     if (tab_storage) {
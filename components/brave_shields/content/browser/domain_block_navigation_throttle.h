@@ -6,6 +6,8 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_CONTENT_BROWSER_DOMAIN_BLOCK_NAVIGATION_THROTTLE_H_
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_CONTENT_BROWSER_DOMAIN_BLOCK_NAVIGATION_THROTTLE_H_
 
+#include <stdint.h>
+
 #include <string>
 
 #include "base/memory/raw_ptr.h"
@@ -59,6 +61,9 @@ class DomainBlockNavigationThrottle : public content::NavigationThrottle {
 
  private:
   void OnShouldBlockDomain(DomainBlockingType domain_blocking_type,
+                           const GURL& request_url,
+                           bool aggressive_mode,
+                           uint64_t engine_generation,
                            const BlockResult& should_block_domain);
   void ShowInterstitial();
   void Enable1PESAndResume();
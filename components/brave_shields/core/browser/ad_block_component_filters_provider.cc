@@ -12,6 +12,8 @@
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
 #include "base/rand_util.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/task/thread_pool.h"
 #include "base/trace_event/trace_event.h"
 #include "brave/components/brave_shields/core/browser/ad_block_component_installer.h"
@@ -81,6 +83,15 @@ std::string AdBlockComponentFiltersProvider::GetNameForDebugging() {
   return "AdBlockComponentFiltersProvider";
 }
 
+std::string AdBlockComponentFiltersProvider::GetCacheKey() {
+  if (component_path_.empty()) {
+    return std::string();
+  }
+  // The installed component path includes its version.
+  return base::StrCat({component_id_, ":", component_path_.AsUTF8Unsafe(), ":",
+                       base::NumberToString(permission_mask_)});
+}
+
 AdBlockComponentFiltersProvider::AdBlockComponentFiltersProvider(
     component_updater::ComponentUpdateService* cus,
     AdBlockFiltersProviderManager* manager,
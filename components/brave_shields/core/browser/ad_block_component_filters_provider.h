@@ -69,6 +69,7 @@ class AdBlockComponentFiltersProvider : public AdBlockFiltersProvider {
   void UnregisterComponent();
 
   std::string GetNameForDebugging() override;
+  std::string GetCacheKey() override;
 
   bool IsInitialized() const override;
 
@@ -86,7 +86,7 @@ AdBlockComponentServiceManager::AdBlockComponentServiceManager(
       filters_provider_manager_(filters_provider_manager),
       list_p3a_(list_p3a) {
   catalog_provider_->LoadFilterListCatalog(
-      base::BindOnce(&AdBlockComponentServiceManager::OnFilterListCatalogLoaded,
+      base::BindOnce(&AdBlockComponentServiceManager::OnFilterListCatalogParsed,
                      weak_factory_.GetWeakPtr()));
   catalog_provider_->AddObserver(this);
 
@@ -411,9 +411,14 @@ base::Value::List AdBlockComponentServiceManager::GetRegionalLists() {
 }
 
 void AdBlockComponentServiceManager::OnFilterListCatalogLoaded(
-    const std::string& catalog_json) {
+    const std::vector<FilterListCatalogEntry>& catalog) {
+  OnFilterListCatalogParsed(catalog);
+}
+
+void AdBlockComponentServiceManager::OnFilterListCatalogParsed(
+    std::vector<FilterListCatalogEntry> catalog) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  SetFilterListCatalog(FilterListCatalogFromJSON(catalog_json));
+  SetFilterListCatalog(std::move(catalog));
 
   update_check_timer_.Start(
       FROM_HERE,
@@ -66,10 +66,12 @@ class AdBlockComponentServiceManager
   void UpdateFilterLists(base::OnceCallback<void(bool)> callback);
 
   // AdBlockFilterListCatalogProvider::Observer
-  void OnFilterListCatalogLoaded(const std::string& catalog_json) override;
+  void OnFilterListCatalogLoaded(
+      const std::vector<FilterListCatalogEntry>& catalog) override;
 
  private:
   friend class ::AdBlockServiceTest;
+  void OnFilterListCatalogParsed(std::vector<FilterListCatalogEntry> catalog);
   void OnAdBlockOnlyModePrefChanged();
 
   void StartRegionalServices();
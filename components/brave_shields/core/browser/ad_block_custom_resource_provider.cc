@@ -14,6 +14,7 @@
 #include "base/check_is_test.h"
 #include "base/feature_list.h"
 #include "base/json/json_writer.h"
+#include "base/memory/ref_counted_memory.h"
 #include "base/strings/strcat.h"
 #include "base/strings/string_util.h"
 #include "base/task/sequenced_task_runner.h"
@@ -203,18 +204,18 @@ void AdBlockCustomResourceProvider::RemoveObserver(
 }
 
 void AdBlockCustomResourceProvider::LoadResources(
-    base::OnceCallback<void(const std::string& resources_json)> on_load) {
+    base::OnceCallback<void(AdBlockResources resources)> on_load) {
   default_resource_provider_->LoadResources(
       base::BindOnce(&AdBlockCustomResourceProvider::OnDefaultResourcesLoaded,
                      weak_ptr_factory_.GetWeakPtr(), std::move(on_load)));
 }
 
 void AdBlockCustomResourceProvider::OnResourcesLoaded(
-    const std::string& resources_json) {
+    AdBlockResources resources) {
   OnDefaultResourcesLoaded(
       base::BindOnce(&AdBlockCustomResourceProvider::NotifyResourcesLoaded,
                      weak_ptr_factory_.GetWeakPtr()),
-      resources_json);
+      std::move(resources));
 }
 
 void AdBlockCustomResourceProvider::AddResourceInternal(
@@ -286,28 +287,30 @@ void AdBlockCustomResourceProvider::SaveResources(base::Value resources) {
 }
 
 void AdBlockCustomResourceProvider::OnDefaultResourcesLoaded(
-    base::OnceCallback<void(const std::string& resources_json)> on_load,
-    const std::string& resources_json) {
+    base::OnceCallback<void(AdBlockResources resources)> on_load,
+    AdBlockResources resources) {
   GetCustomResources(base::BindOnce(
       &AdBlockCustomResourceProvider::OnCustomResourcesLoaded,
-      weak_ptr_factory_.GetWeakPtr(), std::move(on_load), resources_json));
+      weak_ptr_factory_.GetWeakPtr(), std::move(on_load),
+      std::move(resources)));
 }
 
 void AdBlockCustomResourceProvider::OnCustomResourcesLoaded(
-    base::OnceCallback<void(const std::string& resources_json)> on_load,
-    const std::string& default_resources_json,
+    base::OnceCallback<void(AdBlockResources resources)> on_load,
+    AdBlockResources default_resources,
     base::Value custom_resources) {
   CHECK(custom_resources.is_list());
 
   if (custom_resources.GetList().empty()) {
-    std::move(on_load).Run(default_resources_json);
+    std::move(on_load).Run(std::move(default_resources));
   } else {
     auto custom_resources_json = base::WriteJson(custom_resources);
     if (!custom_resources_json) {
-      std::move(on_load).Run(default_resources_json);
+      std::move(on_load).Run(std::move(default_resources));
     } else {
-      std::move(on_load).Run(
-          MergeResources(default_resources_json, *custom_resources_json));
+      std::move(on_load).Run(base::MakeRefCounted<base::RefCountedString>(
+          MergeResources(default_resources->as_string(),
+                         *custom_resources_json)));
     }
   }
 }
@@ -7,6 +7,7 @@
 
 #include "base/files/scoped_temp_dir.h"
 #include "base/json/json_reader.h"
+#include "base/memory/ref_counted_memory.h"
 #include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
 #include "base/test/test_future.h"
@@ -35,17 +36,20 @@ class TestResourceProvider : public AdBlockResourceProvider {
   TestResourceProvider() = default;
   ~TestResourceProvider() override = default;
 
-  void LoadResources(base::OnceCallback<void(const std::string& resources_json)>
-                         on_load) override {
-    std::move(on_load).Run(resources_json_);
+  void LoadResources(
+      base::OnceCallback<void(AdBlockResources resources)> on_load) override {
+    std::move(on_load).Run(resources_);
   }
 
   void SetResources(const std::string& resources_json) {
-    resources_json_ = resources_json;
+    resources_ = base::MakeRefCounted<base::RefCountedString>(resources_json);
   }
 
+  const AdBlockResources& resources() const { return resources_; }
+
  private:
-  std::string resources_json_;
+  AdBlockResources resources_ =
+      base::MakeRefCounted<base::RefCountedString>(std::string());
 };
 
 }  // namespace
@@ -111,13 +115,18 @@ class AdBlockCustomResourceProviderTest : public ::testing::Test {
     return result.Take();
   }
 
-  base::Value LoadResources() {
-    base::test::TestFuture<const std::string&> result;
+  AdBlockResources LoadRawResources() {
+    base::test::TestFuture<AdBlockResources> result;
     custom_resource_provider()->LoadResources(result.GetCallback());
-    if (result.Get().empty()) {
+    return result.Take();
+  }
+
+  base::Value LoadResources() {
+    AdBlockResources resources = LoadRawResources();
+    if (resources->as_string().empty()) {
       return base::Value(base::ListValue());
     }
-    return *base::JSONReader::Read(result.Take(),
+    return *base::JSONReader::Read(resources->as_string(),
                                    base::JSON_PARSE_CHROMIUM_EXTENSIONS);
   }
 
@@ -289,4 +298,18 @@ TEST_F(AdBlockCustomResourceProviderTest, LoadResource) {
             LoadResources());
 }
 
+TEST_F(AdBlockCustomResourceProviderTest, DefaultResourcesAreShared) {
+  default_resource_provider()->SetResources(
+      base::ListValue()
+          .Append(CreateResource("default-1.js", "default-1"))
+          .DebugString());
+
+  // Without custom resources the default resources are passed through as is.
+  EXPECT_EQ(default_resource_provider()->resources(), LoadRawResources());
+
+  prefs()->SetBoolean(prefs::kAdBlockDeveloperMode, true);
+  AddResource(CreateResource("user-1.js", "user-1"));
+  EXPECT_NE(default_resource_provider()->resources(), LoadRawResources());
+}
+
 }  // namespace brave_shields
@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "base/files/file_path.h"
+#include "base/memory/ref_counted_memory.h"
 #include "base/task/thread_pool.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
 #include "brave/components/brave_shields/core/browser/ad_block_component_installer.h"
@@ -17,6 +18,11 @@ namespace {
 
 constexpr char kAdBlockResourcesFilename[] = "resources.json";
 
+brave_shields::AdBlockResources ReadResources(const base::FilePath& path) {
+  return base::MakeRefCounted<base::RefCountedString>(
+      brave_component_updater::GetDATFileAsString(path));
+}
+
 }  // namespace
 
 namespace brave_shields {
@@ -58,27 +64,37 @@ void AdBlockDefaultResourceProvider::OnComponentReady(
   // Load the resources (as a string)
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::GetDATFileAsString,
-                     resources_path),
+      base::BindOnce(&ReadResources, resources_path),
       base::BindOnce(&AdBlockDefaultResourceProvider::NotifyResourcesLoaded,
                      weak_factory_.GetWeakPtr()));
 }
 
 void AdBlockDefaultResourceProvider::LoadResources(
-    base::OnceCallback<void(const std::string& resources_json)> cb) {
+    base::OnceCallback<void(AdBlockResources resources)> cb) {
   base::FilePath resources_path = GetResourcesPath();
   if (resources_path.empty()) {
     // If the path is not ready yet, run the callback with empty resources to
     // avoid blocking filter data loads.
-    std::move(cb).Run("[]");
+    std::move(cb).Run(base::MakeRefCounted<base::RefCountedString>("[]"));
     return;
   }
 
+  pending_load_callbacks_.push_back(std::move(cb));
+  if (pending_load_callbacks_.size() > 1) {
+    return;
+  }
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::GetDATFileAsString,
-                     resources_path),
-      std::move(cb));
+      base::BindOnce(&ReadResources, resources_path),
+      base::BindOnce(&AdBlockDefaultResourceProvider::OnResourcesRead,
+                     weak_factory_.GetWeakPtr()));
+}
+
+void AdBlockDefaultResourceProvider::OnResourcesRead(
+    AdBlockResources resources) {
+  for (auto& cb : std::exchange(pending_load_callbacks_, {})) {
+    std::move(cb).Run(resources);
+  }
 }
 
 }  // namespace brave_shields
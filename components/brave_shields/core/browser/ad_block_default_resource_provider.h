@@ -7,8 +7,10 @@
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_CORE_BROWSER_AD_BLOCK_DEFAULT_RESOURCE_PROVIDER_H_
 
 #include <string>
+#include <vector>
 
 #include "base/functional/callback.h"
+#include "base/memory/weak_ptr.h"
 #include "brave/components/brave_shields/core/browser/ad_block_resource_provider.h"
 
 namespace component_updater {
@@ -37,14 +39,19 @@ class AdBlockDefaultResourceProvider : public AdBlockResourceProvider {
   base::FilePath GetResourcesPath();
 
   void LoadResources(
-      base::OnceCallback<void(const std::string& resources_json)>) override;
+      base::OnceCallback<void(AdBlockResources resources)>) override;
 
  private:
   friend class ::AdBlockServiceTest;
 
   void OnComponentReady(const base::FilePath&);
+  void OnResourcesRead(AdBlockResources resources);
 
   base::FilePath component_path_;
+  // Loads requested while the resources file is being read, e.g. by the
+  // default and additional engines at startup, share the same read and copy.
+  std::vector<base::OnceCallback<void(AdBlockResources)>>
+      pending_load_callbacks_;
 
   base::WeakPtrFactory<AdBlockDefaultResourceProvider> weak_factory_{this};
 };
@@ -7,6 +7,7 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/files/file_path.h"
 #include "base/task/thread_pool.h"
@@ -17,6 +18,16 @@ constexpr char kListCatalogFile[] = "list_catalog.json";
 
 namespace brave_shields {
 
+namespace {
+
+std::vector<FilterListCatalogEntry> ReadFilterListCatalog(
+    const base::FilePath& catalog_path) {
+  return FilterListCatalogFromJSON(
+      brave_component_updater::GetDATFileAsString(catalog_path));
+}
+
+}  // namespace
+
 AdBlockFilterListCatalogProvider::AdBlockFilterListCatalogProvider(
     component_updater::ComponentUpdateService* cus) {
   TRACE_EVENT("brave.adblock", "RegisterAdBlockFilterListCatalogComponent",
@@ -43,13 +54,13 @@ void AdBlockFilterListCatalogProvider::RemoveObserver(
 }
 
 void AdBlockFilterListCatalogProvider::OnFilterListCatalogLoaded(
-    const std::string& catalog_json) {
+    std::vector<FilterListCatalogEntry> catalog) {
   TRACE_EVENT("brave.adblock",
               "AdBlockFilterListCatalogProvider::OnFilterListCatalogLoaded",
-              perfetto::TerminatingFlow::FromPointer(this), "catalog_json_size",
-              catalog_json.size());
+              perfetto::TerminatingFlow::FromPointer(this), "catalog_size",
+              catalog.size());
   for (auto& observer : observers_) {
-    observer.OnFilterListCatalogLoaded(catalog_json);
+    observer.OnFilterListCatalogLoaded(catalog);
   }
 }
 
@@ -63,7 +74,7 @@ void AdBlockFilterListCatalogProvider::OnComponentReady(
   // Load the filter list catalog (as a string)
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::GetDATFileAsString,
+      base::BindOnce(&ReadFilterListCatalog,
                      component_path_.AppendASCII(kListCatalogFile)),
       base::BindOnce(
           &AdBlockFilterListCatalogProvider::OnFilterListCatalogLoaded,
@@ -71,7 +82,7 @@ void AdBlockFilterListCatalogProvider::OnComponentReady(
 }
 
 void AdBlockFilterListCatalogProvider::LoadFilterListCatalog(
-    base::OnceCallback<void(const std::string& catalog_json)> cb) {
+    base::OnceCallback<void(std::vector<FilterListCatalogEntry> catalog)> cb) {
   if (component_path_.empty()) {
     // If the path is not ready yet, don't run the callback. An update should be
     // pushed soon.
@@ -80,7 +91,7 @@ void AdBlockFilterListCatalogProvider::LoadFilterListCatalog(
 
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::GetDATFileAsString,
+      base::BindOnce(&ReadFilterListCatalog,
                      component_path_.AppendASCII(kListCatalogFile)),
       std::move(cb));
 }
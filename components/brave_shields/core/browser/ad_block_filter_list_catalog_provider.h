@@ -7,11 +7,13 @@
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_CORE_BROWSER_AD_BLOCK_FILTER_LIST_CATALOG_PROVIDER_H_
 
 #include <string>
+#include <vector>
 
 #include "base/functional/callback.h"
 #include "base/observer_list.h"
 #include "base/observer_list_types.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
+#include "brave/components/brave_shields/core/browser/filter_list_catalog_entry.h"
 
 namespace component_updater {
 class ComponentUpdateService;
@@ -27,7 +29,8 @@ class AdBlockFilterListCatalogProvider {
  public:
   class Observer : public base::CheckedObserver {
    public:
-    virtual void OnFilterListCatalogLoaded(const std::string& catalog_json) = 0;
+    virtual void OnFilterListCatalogLoaded(
+        const std::vector<FilterListCatalogEntry>& catalog) = 0;
   };
 
   explicit AdBlockFilterListCatalogProvider(
@@ -38,14 +41,15 @@ class AdBlockFilterListCatalogProvider {
   AdBlockFilterListCatalogProvider& operator=(
       const AdBlockFilterListCatalogProvider&) = delete;
 
+  // The catalog JSON is read and parsed on a background sequence.
   void LoadFilterListCatalog(
-      base::OnceCallback<void(const std::string& catalog_json)>);
+      base::OnceCallback<void(std::vector<FilterListCatalogEntry> catalog)>);
 
   void AddObserver(Observer* observer);
   void RemoveObserver(Observer* observer);
 
  private:
-  void OnFilterListCatalogLoaded(const std::string& catalog_json);
+  void OnFilterListCatalogLoaded(std::vector<FilterListCatalogEntry> catalog);
   void OnComponentReady(const base::FilePath&);
 
   base::FilePath component_path_;
@@ -54,6 +54,10 @@ void AdBlockFiltersProvider::NotifyObservers(bool is_for_default_engine) {
   }
 }
 
+std::string AdBlockFiltersProvider::GetCacheKey() {
+  return std::string();
+}
+
 bool AdBlockFiltersProvider::IsInitialized() const {
   return true;
 }
@@ -51,6 +51,11 @@ class AdBlockFiltersProvider {
 
   virtual std::string GetNameForDebugging() = 0;
 
+  // Returns a string that changes whenever the filters loaded by
+  // `LoadFilterSet` change, or an empty string if that can't be determined
+  // without loading them. Used to validate serialized engine caches.
+  virtual std::string GetCacheKey();
+
   // Intended to be overridden if the provider implementation is not immediately
   // ready at creation time.
   virtual bool IsInitialized() const;
@@ -5,20 +5,59 @@
 
 #include "brave/components/brave_shields/core/browser/ad_block_filters_provider_manager.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/barrier_callback.h"
 #include "base/check.h"
 #include "base/location.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/notreached.h"
 #include "base/rand_util.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_util.h"
 #include "base/task/sequenced_task_runner.h"
+#include "base/time/time.h"
 #include "base/trace_event/trace_event.h"
 
 namespace brave_shields {
 
+namespace {
+
+using FilterSetCallback =
+    base::OnceCallback<void(rust::Box<adblock::FilterSet>*)>;
+
+// Parses a single provider's rules into the combined filter set, recording
+// how long that provider contributed to the engine rebuild.
+void RunTimedFilterSetCallback(const std::string& provider_name,
+                               FilterSetCallback cb,
+                               rust::Box<adblock::FilterSet>* filter_set) {
+  const base::TimeTicks start = base::TimeTicks::Now();
+  std::move(cb).Run(filter_set);
+  base::UmaHistogramTimes(
+      base::StrCat({"Brave.Adblock.FilterSetParse.", provider_name}),
+      base::TimeTicks::Now() - start);
+}
+
+// Records how long a provider took to load its rules and wraps the resulting
+// callback so that its share of the parse is measured as well.
+void CollectTimedFilterSetCallback(
+    const std::string& provider_name,
+    base::TimeTicks load_start,
+    base::RepeatingCallback<void(FilterSetCallback)> collect,
+    FilterSetCallback cb) {
+  base::UmaHistogramTimes(
+      base::StrCat({"Brave.Adblock.FilterSetLoad.", provider_name}),
+      base::TimeTicks::Now() - load_start);
+  collect.Run(
+      base::BindOnce(&RunTimedFilterSetCallback, provider_name, std::move(cb)));
+}
+
+}  // namespace
+
 AdBlockFiltersProviderManager::AdBlockFiltersProviderManager() = default;
 
 AdBlockFiltersProviderManager::~AdBlockFiltersProviderManager() = default;
@@ -49,6 +88,29 @@ std::string AdBlockFiltersProviderManager::GetNameForDebugging() {
   return "AdBlockFiltersProviderManager";
 }
 
+std::string AdBlockFiltersProviderManager::GetCacheKeyForEngine(
+    bool is_for_default_engine) {
+  auto& filters_providers = is_for_default_engine
+                                ? default_engine_filters_providers_
+                                : additional_engine_filters_providers_;
+  std::vector<std::string> keys;
+  keys.reserve(filters_providers.size());
+  for (auto* const provider : filters_providers) {
+    if (!provider->IsInitialized()) {
+      return std::string();
+    }
+    std::string key = provider->GetCacheKey();
+    if (key.empty()) {
+      return std::string();
+    }
+    keys.push_back(std::move(key));
+  }
+  // Providers are stored by pointer, so sort to get a stable key across
+  // sessions.
+  std::ranges::sort(keys);
+  return base::JoinString(keys, "\n");
+}
+
 void AdBlockFiltersProviderManager::OnChanged(bool is_for_default_engine) {
   auto& filters_providers = is_for_default_engine
                                 ? default_engine_filters_providers_
@@ -88,8 +150,11 @@ void AdBlockFiltersProviderManager::LoadFilterSetForEngine(
   for (auto* const provider : filters_providers) {
     task_tracker_.PostTask(
         base::SequencedTaskRunner::GetCurrentDefault().get(), FROM_HERE,
-        base::BindOnce(&AdBlockFiltersProvider::LoadFilterSet,
-                       provider->AsWeakPtr(), collect_and_merge));
+        base::BindOnce(
+            &AdBlockFiltersProvider::LoadFilterSet, provider->AsWeakPtr(),
+            base::BindOnce(&CollectTimedFilterSetCallback,
+                           provider->GetNameForDebugging(),
+                           base::TimeTicks::Now(), collect_and_merge)));
   }
 }
 
@@ -57,6 +57,10 @@ class AdBlockFiltersProviderManager : public AdBlockFiltersProvider,
 
   std::string GetNameForDebugging() override;
 
+  // Combines the cache keys of every provider for the given engine. Returns an
+  // empty string if any of them can't provide one.
+  std::string GetCacheKeyForEngine(bool is_for_default_engine);
+
  private:
   void FinishCombinating(
       base::OnceCallback<
@@ -9,6 +9,8 @@
 #include <string>
 
 #include "base/functional/callback.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/memory/scoped_refptr.h"
 #include "base/observer_list.h"
 #include "base/observer_list_types.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
@@ -17,13 +19,17 @@ using brave_component_updater::DATFileDataBuffer;
 
 namespace brave_shields {
 
+// Scriptlet and redirect resources, as JSON. Several MB large, so a single
+// immutable copy is shared by every observer and engine that uses it.
+using AdBlockResources = scoped_refptr<base::RefCountedString>;
+
 // Interface for any source that can load resource replacements into an adblock
 // engine.
 class AdBlockResourceProvider {
  public:
   class Observer : public base::CheckedObserver {
    public:
-    virtual void OnResourcesLoaded(const std::string& resources_json) = 0;
+    virtual void OnResourcesLoaded(AdBlockResources resources) = 0;
   };
 
   AdBlockResourceProvider();
@@ -33,10 +39,10 @@ class AdBlockResourceProvider {
   void RemoveObserver(Observer* observer);
 
   virtual void LoadResources(
-      base::OnceCallback<void(const std::string& resources_json)>) = 0;
+      base::OnceCallback<void(AdBlockResources resources)>) = 0;
 
  protected:
-  void NotifyResourcesLoaded(const std::string& resources_json);
+  void NotifyResourcesLoaded(AdBlockResources resources);
 
  private:
   base::ObserverList<Observer> observers_;
@@ -5,6 +5,8 @@
 
 #include "brave/components/brave_shields/core/browser/brave_shields_settings_service.h"
 
+#include <array>
+
 #include "brave/components/brave_shields/core/browser/brave_shields_p3a.h"
 #include "brave/components/brave_shields/core/browser/brave_shields_utils.h"
 #include "brave/components/brave_shields/core/common/brave_shield_utils.h"
@@ -18,16 +20,66 @@
 
 namespace brave_shields {
 
+namespace {
+
+constexpr size_t kMaxCachedOrigins = 64;
+
+// Content settings the cached getters depend on.
+constexpr auto kCachedContentSettingsTypes = std::to_array({
+    ContentSettingsType::BRAVE_SHIELDS,
+    ContentSettingsType::BRAVE_ADS,
+    CosmeticFilteringSetting::kContentSettingsType,
+    ContentSettingsType::BRAVE_FINGERPRINTING_V2,
+    AutoShredSetting::kContentSettingsType,
+});
+
+}  // namespace
+
 BraveShieldsSettingsService::BraveShieldsSettingsService(
     HostContentSettingsMap& host_content_settings_map,
     PrefService* local_state,
     PrefService* profile_prefs)
     : host_content_settings_map_(host_content_settings_map),
       local_state_(local_state),
-      profile_prefs_(profile_prefs) {}
+      profile_prefs_(profile_prefs),
+      settings_cache_(kMaxCachedOrigins) {
+  content_settings_observation_.Observe(&*host_content_settings_map_);
+}
 
 BraveShieldsSettingsService::~BraveShieldsSettingsService() = default;
 
+void BraveShieldsSettingsService::Shutdown() {
+  content_settings_observation_.Reset();
+  settings_cache_.Clear();
+}
+
+void BraveShieldsSettingsService::OnContentSettingChanged(
+    const ContentSettingsPattern& primary_pattern,
+    const ContentSettingsPattern& secondary_pattern,
+    ContentSettingsTypeSet content_type_set) {
+  // Changes are rare compared to lookups, so drop everything instead of
+  // working out which origins the patterns match.
+  for (const auto type : kCachedContentSettingsTypes) {
+    if (content_type_set.Contains(type)) {
+      settings_cache_.Clear();
+      return;
+    }
+  }
+}
+
+BraveShieldsSettingsService::CachedSettings*
+BraveShieldsSettingsService::GetCachedSettings(const GURL& url) {
+  url::Origin origin = url::Origin::Create(url);
+  if (origin.opaque()) {
+    return nullptr;
+  }
+  auto it = settings_cache_.Get(origin);
+  if (it == settings_cache_.end()) {
+    it = settings_cache_.Put(std::move(origin), CachedSettings());
+  }
+  return &it->second;
+}
+
 void BraveShieldsSettingsService::SetBraveShieldsEnabled(bool is_enabled,
                                                          const GURL& url) {
   brave_shields::SetBraveShieldsEnabled(&*host_content_settings_map_,
@@ -35,8 +87,16 @@ void BraveShieldsSettingsService::SetBraveShieldsEnabled(bool is_enabled,
 }
 
 bool BraveShieldsSettingsService::GetBraveShieldsEnabled(const GURL& url) {
-  return brave_shields::GetBraveShieldsEnabled(&*host_content_settings_map_,
-                                               url);
+  CachedSettings* cached = GetCachedSettings(url);
+  if (cached && cached->shields_enabled) {
+    return *cached->shields_enabled;
+  }
+  const bool enabled =
+      brave_shields::GetBraveShieldsEnabled(&*host_content_settings_map_, url);
+  if (cached) {
+    cached->shields_enabled = enabled;
+  }
+  return enabled;
 }
 
 void BraveShieldsSettingsService::SetDefaultAdBlockMode(
@@ -77,6 +137,19 @@ void BraveShieldsSettingsService::SetAdBlockMode(mojom::AdBlockMode mode,
 
 mojom::AdBlockMode BraveShieldsSettingsService::GetAdBlockMode(
     const GURL& url) {
+  CachedSettings* cached = GetCachedSettings(url);
+  if (cached && cached->ad_block_mode) {
+    return *cached->ad_block_mode;
+  }
+  const mojom::AdBlockMode mode = ComputeAdBlockMode(url);
+  if (cached) {
+    cached->ad_block_mode = mode;
+  }
+  return mode;
+}
+
+mojom::AdBlockMode BraveShieldsSettingsService::ComputeAdBlockMode(
+    const GURL& url) {
   ControlType control_type_ad =
       brave_shields::GetAdControlType(&*host_content_settings_map_, url);
 
@@ -130,6 +203,19 @@ void BraveShieldsSettingsService::SetFingerprintMode(
 
 mojom::FingerprintMode BraveShieldsSettingsService::GetFingerprintMode(
     const GURL& url) {
+  CachedSettings* cached = GetCachedSettings(url);
+  if (cached && cached->fingerprint_mode) {
+    return *cached->fingerprint_mode;
+  }
+  const mojom::FingerprintMode mode = ComputeFingerprintMode(url);
+  if (cached) {
+    cached->fingerprint_mode = mode;
+  }
+  return mode;
+}
+
+mojom::FingerprintMode BraveShieldsSettingsService::ComputeFingerprintMode(
+    const GURL& url) {
   ControlType control_type = brave_shields::GetFingerprintingControlType(
       &*host_content_settings_map_, url);
 
@@ -226,9 +312,17 @@ void BraveShieldsSettingsService::SetAutoShredMode(mojom::AutoShredMode mode,
 
 mojom::AutoShredMode BraveShieldsSettingsService::GetAutoShredMode(
     const GURL& url) {
-  return AutoShredSetting::FromValue(
+  CachedSettings* cached = GetCachedSettings(url);
+  if (cached && cached->auto_shred_mode) {
+    return *cached->auto_shred_mode;
+  }
+  const mojom::AutoShredMode mode = AutoShredSetting::FromValue(
       host_content_settings_map_->GetWebsiteSetting(
           url, GURL(), AutoShredSetting::kContentSettingsType));
+  if (cached) {
+    cached->auto_shred_mode = mode;
+  }
+  return mode;
 }
 
 bool BraveShieldsSettingsService::IsJsBlockingEnforced(const GURL& url) {
@@ -6,20 +6,27 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_CORE_BROWSER_BRAVE_SHIELDS_SETTINGS_SERVICE_H_
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_CORE_BROWSER_BRAVE_SHIELDS_SETTINGS_SERVICE_H_
 
+#include <optional>
+
+#include "base/containers/lru_cache.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/raw_ref.h"
+#include "base/scoped_observation.h"
 #include "brave/components/brave_shields/core/common/brave_shields_panel.mojom.h"
 #include "brave/components/brave_shields/core/common/shields_settings.mojom.h"
+#include "components/content_settings/core/browser/content_settings_observer.h"
 #include "components/content_settings/core/browser/cookie_settings.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
 #include "components/keyed_service/core/keyed_service.h"
+#include "url/origin.h"
 
 class GURL;
-class HostContentSettingsMap;
 class PrefService;
 
 namespace brave_shields {
 
-class BraveShieldsSettingsService : public KeyedService {
+class BraveShieldsSettingsService : public KeyedService,
+                                    public content_settings::Observer {
  public:
   explicit BraveShieldsSettingsService(
       HostContentSettingsMap& host_content_settings_map,
@@ -27,6 +34,9 @@ class BraveShieldsSettingsService : public KeyedService {
       PrefService* profile_state = nullptr);
   ~BraveShieldsSettingsService() override;
 
+  // KeyedService:
+  void Shutdown() override;
+
   void SetBraveShieldsEnabled(bool enable, const GURL& url);
   bool GetBraveShieldsEnabled(const GURL& url);
 
@@ -64,10 +74,37 @@ class BraveShieldsSettingsService : public KeyedService {
       const GURL& url);
 
  private:
+  // Shields settings of one origin, each filled in the first time it is
+  // queried. Resolving them goes through content settings pattern matching,
+  // which is expensive for settings like fingerprinting that scan every rule.
+  struct CachedSettings {
+    std::optional<bool> shields_enabled;
+    std::optional<mojom::AdBlockMode> ad_block_mode;
+    std::optional<mojom::FingerprintMode> fingerprint_mode;
+    std::optional<mojom::AutoShredMode> auto_shred_mode;
+  };
+
+  // content_settings::Observer:
+  void OnContentSettingChanged(
+      const ContentSettingsPattern& primary_pattern,
+      const ContentSettingsPattern& secondary_pattern,
+      ContentSettingsTypeSet content_type_set) override;
+
+  mojom::AdBlockMode ComputeAdBlockMode(const GURL& url);
+  mojom::FingerprintMode ComputeFingerprintMode(const GURL& url);
+
+  // Returns the cache entry for the origin of `url`, or nullptr if `url` has
+  // an opaque origin and can't be cached.
+  CachedSettings* GetCachedSettings(const GURL& url);
+
   const raw_ref<HostContentSettingsMap>
       host_content_settings_map_;       // NOT OWNED
   raw_ptr<PrefService> local_state_;    // NOT OWNED
   raw_ptr<PrefService> profile_prefs_;  // NOT OWNED
+
+  base::LRUCache<url::Origin, CachedSettings> settings_cache_;
+  base::ScopedObservation<HostContentSettingsMap, content_settings::Observer>
+      content_settings_observation_{this};
 };
 
 }  // namespace brave_shields
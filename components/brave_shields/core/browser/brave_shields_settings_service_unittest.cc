@@ -39,7 +39,10 @@ class BraveShieldsSettingsServiceTest : public testing::Test {
             *GetHostContentSettingsMap(), GetLocalState(), &profile_prefs_);
   }
 
-  void TearDown() override { host_content_settings_map_->ShutdownOnUIThread(); }
+  void TearDown() override {
+    brave_shields_settings_->Shutdown();
+    host_content_settings_map_->ShutdownOnUIThread();
+  }
 
   TestingPrefServiceSimple* GetLocalState() { return &local_state_; }
   HostContentSettingsMap* GetHostContentSettingsMap() {
@@ -126,6 +129,33 @@ TEST_F(BraveShieldsSettingsServiceTest, AdBlockMode) {
       AdBlockMode::STANDARD);
 }
 
+TEST_F(BraveShieldsSettingsServiceTest, CachedSettingsFollowContentSettings) {
+  EXPECT_TRUE(brave_shields_settings()->GetBraveShieldsEnabled(kTestUrl));
+  EXPECT_EQ(brave_shields_settings()->GetAdBlockMode(kTestUrl),
+            AdBlockMode::STANDARD);
+  EXPECT_EQ(brave_shields_settings()->GetFingerprintMode(kTestUrl),
+            FingerprintMode::STANDARD_MODE);
+
+  // Changes made without going through the service are picked up as well.
+  brave_shields::SetBraveShieldsEnabled(GetHostContentSettingsMap(), false,
+                                        kTestUrl, GetLocalState());
+  brave_shields::SetAdControlType(GetHostContentSettingsMap(),
+                                  brave_shields::ControlType::ALLOW, kTestUrl,
+                                  GetLocalState());
+  brave_shields::SetFingerprintingControlType(
+      GetHostContentSettingsMap(), brave_shields::ControlType::ALLOW, kTestUrl,
+      GetLocalState());
+  EXPECT_FALSE(brave_shields_settings()->GetBraveShieldsEnabled(kTestUrl));
+  EXPECT_EQ(brave_shields_settings()->GetAdBlockMode(kTestUrl),
+            AdBlockMode::ALLOW);
+  EXPECT_EQ(brave_shields_settings()->GetFingerprintMode(kTestUrl),
+            FingerprintMode::ALLOW_MODE);
+
+  // Other origins are unaffected.
+  EXPECT_TRUE(brave_shields_settings()->GetBraveShieldsEnabled(
+      GURL("https://example.com")));
+}
+
 TEST_F(BraveShieldsSettingsServiceTest, DefaultAdBlockMode) {
   // explicitly set so we can verify this is unchanged by updating default
   brave_shields_settings()->SetAdBlockMode(AdBlockMode::STANDARD, kTestUrl);
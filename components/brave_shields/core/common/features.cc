@@ -17,11 +17,21 @@ BASE_FEATURE(kAdBlockDefaultResourceUpdateInterval,
 // or not they appear in a filter list.
 BASE_FEATURE(kBraveAdblockDefault1pBlocking,
              base::FEATURE_DISABLED_BY_DEFAULT);
+// When enabled, subresource requests that are queued together on the UI thread
+// are matched against the adblock engines in a single task on the adblock task
+// runner, instead of posting one task per request.
+BASE_FEATURE(kBraveAdblockBatchedRequestMatching,
+             base::FEATURE_DISABLED_BY_DEFAULT);
 // When enabled, Brave will issue DNS queries for requests that the adblock
 // engine has not blocked, then check them again with the original hostname
 // substituted for any canonical name found.
 BASE_FEATURE(kBraveAdblockCnameUncloaking,
              base::FEATURE_ENABLED_BY_DEFAULT);
+// When enabled, network requests are matched against the adblock engines on
+// the thread pool rather than on the adblock engines' own sequence, so that
+// several requests can be checked at the same time.
+BASE_FEATURE(kBraveAdblockConcurrentMatching,
+             base::FEATURE_DISABLED_BY_DEFAULT);
 // When enabled, Brave will apply HTML element collapsing to all images and
 // iframes that initiate a blocked network request.
 BASE_FEATURE(kBraveAdblockCollapseBlockedElements,
@@ -32,6 +42,10 @@ BASE_FEATURE(kBraveAdblockCookieListDefault,
              base::FEATURE_ENABLED_BY_DEFAULT);
 BASE_FEATURE(kBraveAdblockCosmeticFiltering,
              base::FEATURE_ENABLED_BY_DEFAULT);
+// When enabled, results of cosmetic filtering queries are cached per engine
+// until the engine, its resources or its tags change.
+BASE_FEATURE(kBraveAdblockCosmeticResultCache,
+             base::FEATURE_ENABLED_BY_DEFAULT);
 // Brave will apply cosmetic filters with procedural operators like
 // `:has-text(...)` and `:upward(...)`.
 BASE_FEATURE(kBraveAdblockProceduralFiltering,
@@ -40,8 +54,18 @@ BASE_FEATURE(kBraveAdblockScriptletDebugLogs,
              base::FEATURE_DISABLED_BY_DEFAULT);
 BASE_FEATURE(kBraveAdblockCspRules,
              base::FEATURE_ENABLED_BY_DEFAULT);
+// When enabled, engines remember CSP queries that matched no `$csp` rule, so
+// that repeated document loads skip the round trip to the matching task
+// runner.
+BASE_FEATURE(kBraveAdblockCspQueryCache,
+             base::FEATURE_DISABLED_BY_DEFAULT);
 BASE_FEATURE(kBraveAdblockShowHiddenComponents,
              base::FEATURE_DISABLED_BY_DEFAULT);
+// When enabled, element picker rules are applied to cosmetic filtering results
+// as soon as they are added, instead of after the additional filters engine
+// has been rebuilt with them.
+BASE_FEATURE(kBraveAdblockUserCosmeticFilterOverlay,
+             base::FEATURE_DISABLED_BY_DEFAULT);
 // When enabled, Brave will enable "Fanboy's Mobile Notifications List" by
 // default unless overridden by a locally set preference.
 BASE_FEATURE(kBraveAdblockMobileNotificationsListDefault,
@@ -58,6 +82,11 @@ BASE_FEATURE(kBraveAdblockExperimentalListDefault,
 // ||ads.example.com^
 BASE_FEATURE(kBraveDomainBlock,
              base::FEATURE_ENABLED_BY_DEFAULT);
+// When enabled, main frame URLs that the domain block check allowed are
+// remembered per profile until the adblock engines change, so repeated
+// navigations to them are not deferred.
+BASE_FEATURE(kBraveDomainBlockDecisionCache,
+             base::FEATURE_DISABLED_BY_DEFAULT);
 // When enabled, Brave will attempt to enable 1PES mode in a standard blocking
 // mode when a user visists a domain that is present in currently active adblock
 // filters. 1PES will be enabled only if neither cookies nor localStorage data
@@ -156,6 +185,11 @@ constexpr base::FeatureParam<std::string>
     kCosmeticFilteringFetchNewClassIdRulesThrottlingMs{
         &kCosmeticFilteringJsPerformance, "fetch_throttling_ms", "100"};
 
+// When enabled, compiled adblock engines are serialized to disk and reloaded
+// on the next startup if the filter lists they were built from are unchanged.
+BASE_FEATURE(kAdblockEngineCache,
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
 BASE_FEATURE(kAdblockOverrideRegexDiscardPolicy,
              base::FEATURE_DISABLED_BY_DEFAULT);
 
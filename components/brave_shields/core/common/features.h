@@ -16,19 +16,29 @@
 namespace brave_shields {
 namespace features {
 BASE_DECLARE_FEATURE(kAdBlockDefaultResourceUpdateInterval);
+BASE_DECLARE_FEATURE(kBraveAdblockBatchedRequestMatching);
 BASE_DECLARE_FEATURE(kBraveAdblockCnameUncloaking);
+BASE_DECLARE_FEATURE(kBraveAdblockConcurrentMatching);
 BASE_DECLARE_FEATURE(kBraveAdblockCollapseBlockedElements);
 BASE_DECLARE_FEATURE(kBraveAdblockCookieListDefault);
 BASE_DECLARE_FEATURE(kBraveAdblockCosmeticFiltering);
+BASE_DECLARE_FEATURE(kBraveAdblockCosmeticResultCache);
+// The number of entries kept in each of the cosmetic result caches of an
+// engine.
+inline constexpr base::FeatureParam<int> kBraveAdblockCosmeticResultCacheSize{
+    &kBraveAdblockCosmeticResultCache, "cache_size", 64};
 BASE_DECLARE_FEATURE(kBraveAdblockProceduralFiltering);
 BASE_DECLARE_FEATURE(kBraveAdblockCspRules);
+BASE_DECLARE_FEATURE(kBraveAdblockCspQueryCache);
 BASE_DECLARE_FEATURE(kBraveAdblockDefault1pBlocking);
 BASE_DECLARE_FEATURE(kBraveAdblockMobileNotificationsListDefault);
 BASE_DECLARE_FEATURE(kBraveAdblockExperimentalListDefault);
 BASE_DECLARE_FEATURE(kBraveAdblockScriptletDebugLogs);
 BASE_DECLARE_FEATURE(kBraveAdblockShowHiddenComponents);
+BASE_DECLARE_FEATURE(kBraveAdblockUserCosmeticFilterOverlay);
 BASE_DECLARE_FEATURE(kBraveDarkModeBlock);
 BASE_DECLARE_FEATURE(kBraveDomainBlock);
+BASE_DECLARE_FEATURE(kBraveDomainBlockDecisionCache);
 BASE_DECLARE_FEATURE(kBraveDomainBlock1PES);
 BASE_DECLARE_FEATURE(kBraveExtensionNetworkBlocking);
 BASE_DECLARE_FEATURE(kBraveFarbling);
@@ -54,6 +64,7 @@ extern const base::FeatureParam<std::string>
     kCosmeticFilteringswitchToSelectorsPollingThreshold;
 extern const base::FeatureParam<std::string>
     kCosmeticFilteringFetchNewClassIdRulesThrottlingMs;
+BASE_DECLARE_FEATURE(kAdblockEngineCache);
 BASE_DECLARE_FEATURE(kAdblockOverrideRegexDiscardPolicy);
 extern const base::FeatureParam<int>
     kAdblockOverrideRegexDiscardPolicyCleanupIntervalSec;
@@ -10,6 +10,7 @@
 #include "base/check.h"
 #include "base/check_op.h"
 #include "base/logging.h"
+#include "base/trace_event/trace_event.h"
 #include "brave/third_party/bip39wally-core-native/include/wally_bip39.h"
 #include "brave/vendor/bat-native-tweetnacl/tweetnacl.h"
 #include "crypto/random.h"
@@ -131,6 +132,7 @@ bool Decrypt(const std::vector<uint8_t>& ciphertext,
 }
 
 std::string PassphraseFromBytes32(const std::vector<uint8_t>& bytes) {
+  TRACE_EVENT0("brave", "BraveSyncCrypto_PassphraseFromBytes32");
   DCHECK_EQ(bytes.size(), (size_t)DEFAULT_SEED_SIZE);
   char* words = nullptr;
   std::string passphrase;
@@ -145,6 +147,7 @@ std::string PassphraseFromBytes32(const std::vector<uint8_t>& bytes) {
 
 bool PassphraseToBytes32(const std::string& passphrase,
                          std::vector<uint8_t>* bytes) {
+  TRACE_EVENT0("brave", "BraveSyncCrypto_PassphraseToBytes32");
   DCHECK(bytes);
   size_t written;
   bytes->resize(DEFAULT_SEED_SIZE);
@@ -12,5 +12,7 @@ namespace brave_sync::features {
 BASE_FEATURE(kBraveSync, base::FEATURE_ENABLED_BY_DEFAULT);
 BASE_FEATURE(kBraveSyncDefaultPasswords,
              base::FEATURE_ENABLED_BY_DEFAULT);
+BASE_FEATURE(kBraveSyncThrottleDeviceInfoNotifications,
+             base::FEATURE_DISABLED_BY_DEFAULT);
 
 }  // namespace brave_sync::features
@@ -14,6 +14,9 @@ namespace features {
 BASE_DECLARE_FEATURE(kBraveSync);
 BASE_DECLARE_FEATURE(kBraveSyncDefaultPasswords);
 
+// Coalesces device info change notifications sent to the iOS UI.
+BASE_DECLARE_FEATURE(kBraveSyncThrottleDeviceInfoNotifications);
+
 }  // namespace features
 }  // namespace brave_sync
 
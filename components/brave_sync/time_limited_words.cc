@@ -7,18 +7,23 @@
 
 #include <cmath>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/check.h"
 #include "base/check_op.h"
 #include "base/compiler_specific.h"
 #include "base/containers/span.h"
+#include "base/functional/bind.h"
+#include "base/functional/callback.h"
 #include "base/logging.h"
 #include "base/notreached.h"
 #include "base/strings/strcat.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
+#include "base/task/thread_pool.h"
 #include "base/time/time.h"
+#include "base/trace_event/trace_event.h"
 #include "base/types/expected.h"
 #include "brave/components/brave_sync/crypto/crypto.h"
 #include "brave/third_party/bip39wally-core-native/include/wally_bip39.h"
@@ -44,9 +49,6 @@ std::vector<std::string> SplitWords(const std::string& words_string) {
 using base::Time;
 using base::TimeDelta;
 
-Time TimeLimitedWords::words_v1_sunset_day_;
-Time TimeLimitedWords::words_v2_epoch_;
-
 std::string TimeLimitedWords::GetWordByIndex(size_t index) {
   DCHECK_EQ(BIP39_WORDLIST_LEN, 2048);
   index = index % BIP39_WORDLIST_LEN;
@@ -77,27 +79,29 @@ int TimeLimitedWords::GetIndexByWord(const std::string& word) {
   return idx - 1;
 }
 
+// Function-local statics so that parsing is safe to run on any sequence.
 Time TimeLimitedWords::GetWordsV1SunsetDay() {
-  if (words_v1_sunset_day_.is_null()) {
-    bool convert_result =
-        Time::FromUTCString(kWordsv1SunsetDate, &words_v1_sunset_day_);
-    CHECK(convert_result);
-  }
+  static const Time words_v1_sunset_day = [] {
+    Time result;
+    CHECK(Time::FromUTCString(kWordsv1SunsetDate, &result));
+    return result;
+  }();
 
-  CHECK(!words_v1_sunset_day_.is_null());
+  CHECK(!words_v1_sunset_day.is_null());
 
-  return words_v1_sunset_day_;
+  return words_v1_sunset_day;
 }
 
 Time TimeLimitedWords::GetWordsV2Epoch() {
-  if (words_v2_epoch_.is_null()) {
-    bool convert_result = Time::FromUTCString(kWordsv2Epoch, &words_v2_epoch_);
-    CHECK(convert_result);
-  }
+  static const Time words_v2_epoch = [] {
+    Time result;
+    CHECK(Time::FromUTCString(kWordsv2Epoch, &result));
+    return result;
+  }();
 
-  CHECK(!words_v2_epoch_.is_null());
+  CHECK(!words_v2_epoch.is_null());
 
-  return words_v2_epoch_;
+  return words_v2_epoch;
 }
 
 int TimeLimitedWords::GetRoundedDaysDiff(const Time& time1, const Time& time2) {
@@ -142,6 +146,7 @@ TimeLimitedWords::GenerateForDate(const std::string& pure_words,
 base::expected<std::string, TimeLimitedWords::ValidationStatus>
 TimeLimitedWords::ParseImpl(const std::string& time_limited_words,
                             WrongDateBehaviour wrong_date_behaviour) {
+  TRACE_EVENT0("brave", "TimeLimitedWords_Parse");
   using ValidationStatus = TimeLimitedWords::ValidationStatus;
 
   static constexpr size_t kPureWordsCount = 24u;
@@ -200,6 +205,15 @@ TimeLimitedWords::Parse(const std::string& time_limited_words) {
   return ParseImpl(time_limited_words, WrongDateBehaviour::kDontAllow);
 }
 
+// static
+void TimeLimitedWords::ParseAsync(const std::string& time_limited_words,
+                                  ParseCallback callback) {
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_BLOCKING},
+      base::BindOnce(&TimeLimitedWords::Parse, time_limited_words),
+      std::move(callback));
+}
+
 base::expected<std::string, TimeLimitedWords::ValidationStatus>
 TimeLimitedWords::ParseIgnoreDate(const std::string& time_limited_words) {
   return ParseImpl(time_limited_words, WrongDateBehaviour::kIgnore);
@@ -9,6 +9,7 @@
 #include <map>
 #include <string>
 
+#include "base/functional/callback_forward.h"
 #include "base/gtest_prod_util.h"
 #include "base/time/time.h"
 #include "base/types/expected.h"
@@ -43,6 +44,13 @@ class TimeLimitedWords {
   static base::expected<std::string, ValidationStatus> Parse(
       const std::string& time_limited_words);
 
+  using ParseCallback = base::OnceCallback<void(
+      base::expected<std::string, ValidationStatus>)>;
+  // The same as |Parse| but the BIP39 validation runs on the thread pool and
+  // the result is replied to the calling sequence.
+  static void ParseAsync(const std::string& time_limited_words,
+                         ParseCallback callback);
+
   // The same as |Parse| but never give |kExpired| and |kValidForTooLong|
   // statuses
   static base::expected<std::string, ValidationStatus> ParseIgnoreDate(
@@ -81,9 +89,6 @@ class TimeLimitedWords {
 
   static std::string GetWordByIndex(size_t index);
   static int GetIndexByWord(const std::string& word);
-
-  static base::Time words_v1_sunset_day_;
-  static base::Time words_v2_epoch_;
 };
 
 }  // namespace brave_sync
@@ -9,6 +9,8 @@
 #include <utility>
 
 #include "base/strings/strcat.h"
+#include "base/test/task_environment.h"
+#include "base/test/test_future.h"
 #include "base/time/time_override.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -234,6 +236,34 @@ TEST(TimeLimitedWordsTest, ParseIgnoreDate) {
   }
 }
 
+TEST(TimeLimitedWordsTest, ParseAsync) {
+  using ValidationStatus = TimeLimitedWords::ValidationStatus;
+  base::test::TaskEnvironment task_environment;
+
+  {
+    auto time_limited_words = TimeLimitedWords::GenerateForNow(kValidSyncCode);
+    ASSERT_TRUE(time_limited_words.has_value());
+
+    base::test::TestFuture<base::expected<std::string, ValidationStatus>>
+        future;
+    TimeLimitedWords::ParseAsync(time_limited_words.value(),
+                                 future.GetCallback());
+    const auto& pure_words_with_status = future.Get();
+    ASSERT_TRUE(pure_words_with_status.has_value());
+    EXPECT_EQ(pure_words_with_status.value(), kValidSyncCode);
+  }
+
+  {
+    base::test::TestFuture<base::expected<std::string, ValidationStatus>>
+        future;
+    TimeLimitedWords::ParseAsync("abandon ability", future.GetCallback());
+    const auto& pure_words_with_status = future.Get();
+    ASSERT_FALSE(pure_words_with_status.has_value());
+    EXPECT_EQ(pure_words_with_status.error(),
+              ValidationStatus::kWrongWordsNumber);
+  }
+}
+
 TEST(TimeLimitedWordsTest, GetNotAfter) {
   const base::Time anchorDayForWordsV2 =
       TimeLimitedWords::GetWordsV2Epoch() + base::Days(20);
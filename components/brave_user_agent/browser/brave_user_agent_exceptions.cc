@@ -6,17 +6,15 @@
 #include "brave/components/brave_user_agent/browser/brave_user_agent_exceptions.h"
 
 #include <memory>
-#include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
-#include "base/containers/contains.h"
 #include "base/feature_list.h"
 #include "base/files/file_path.h"
-#include "base/strings/string_split.h"
 #include "base/task/thread_pool.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
+#include "brave/components/brave_component_updater/browser/host_set.h"
 #include "brave/components/brave_user_agent/browser/brave_user_agent_component_installer.h"
 #include "brave/components/brave_user_agent/common/features.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
@@ -25,6 +23,17 @@ constexpr char kBraveUserAgentExceptionsFile[] = "brave-checks.txt";
 
 namespace brave_user_agent {
 
+using brave_component_updater::HostSet;
+
+namespace {
+
+HostSet ReadExceptedDomains(const base::FilePath& file_path) {
+  return HostSet::FromLines(
+      brave_component_updater::GetDATFileAsString(file_path));
+}
+
+}  // namespace
+
 // static
 BraveUserAgentExceptions* BraveUserAgentExceptions::GetInstance() {
   // Check if feature flag is enabled.
@@ -37,21 +46,16 @@ BraveUserAgentExceptions* BraveUserAgentExceptions::GetInstance() {
 
 BraveUserAgentExceptions::BraveUserAgentExceptions() = default;
 
-BraveUserAgentExceptions::~BraveUserAgentExceptions() {
-  excepted_domains_.clear();
-}
+BraveUserAgentExceptions::~BraveUserAgentExceptions() = default;
 
 void BraveUserAgentExceptions::OnExceptedDomainsLoaded(
-    const std::string& contents) {
-  if (contents.empty()) {
+    HostSet excepted_domains) {
+  if (excepted_domains.empty()) {
     // We don't have the file yet.
     return;
   }
-  std::vector<std::string> lines = base::SplitString(
-      contents, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
-  excepted_domains_.insert(lines.begin(), lines.end());
+  excepted_domains_ = std::move(excepted_domains);
   is_ready_ = true;
-  return;
 }
 
 void BraveUserAgentExceptions::OnComponentReady(const base::FilePath& path) {
@@ -59,9 +63,8 @@ void BraveUserAgentExceptions::OnComponentReady(const base::FilePath& path) {
 
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(
-          &brave_component_updater::GetDATFileAsString,
-          component_path_.AppendASCII(kBraveUserAgentExceptionsFile)),
+      base::BindOnce(&ReadExceptedDomains, component_path_.AppendASCII(
+                                               kBraveUserAgentExceptionsFile)),
       base::BindOnce(&BraveUserAgentExceptions::OnExceptedDomainsLoaded,
                      weak_factory_.GetWeakPtr()));
 }
@@ -77,12 +80,14 @@ bool BraveUserAgentExceptions::CanShowBrave(const GURL& url) {
       url, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
 
   // Show Brave only if the domain is not on the exceptions list.
-  return !base::Contains(excepted_domains_, domain);
+  return !excepted_domains_.Contains(domain);
 }
 
 void BraveUserAgentExceptions::AddToExceptedDomainsForTesting(
     std::string_view domain) {
-  excepted_domains_.insert(std::string(domain));
+  std::vector<std::string> domains = excepted_domains_.GetHostsForTesting();
+  domains.emplace_back(domain);
+  excepted_domains_ = HostSet(std::move(domains));
 }
 
 }  // namespace brave_user_agent
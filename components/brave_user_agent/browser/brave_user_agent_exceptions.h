@@ -6,7 +6,6 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_USER_AGENT_BROWSER_BRAVE_USER_AGENT_EXCEPTIONS_H_
 #define BRAVE_COMPONENTS_BRAVE_USER_AGENT_BROWSER_BRAVE_USER_AGENT_EXCEPTIONS_H_
 
-#include <set>
 #include <string>
 #include <string_view>
 
@@ -14,6 +13,7 @@
 #include "base/gtest_prod_util.h"
 #include "base/memory/singleton.h"
 #include "base/memory/weak_ptr.h"
+#include "brave/components/brave_component_updater/browser/host_set.h"
 #include "url/gurl.h"
 
 namespace component_updater {
@@ -38,10 +38,11 @@ class BraveUserAgentExceptions {
   FRIEND_TEST_ALL_PREFIXES(BraveUserAgentExceptionsUnitTest,
                            TestCanShowBraveDomainsLoaded);
   BraveUserAgentExceptions();
-  void OnExceptedDomainsLoaded(const std::string& contents);
+  void OnExceptedDomainsLoaded(
+      brave_component_updater::HostSet excepted_domains);
 
   base::FilePath component_path_;
-  std::set<std::string> excepted_domains_;
+  brave_component_updater::HostSet excepted_domains_;
   bool is_ready_ = false;
   raw_ptr<component_updater::ComponentUpdateService> component_update_service_;
   base::WeakPtrFactory<BraveUserAgentExceptions> weak_factory_{this};
@@ -8,19 +8,35 @@
 #include <vector>
 
 #include "base/check_is_test.h"
+#include "base/feature_list.h"
 #include "base/functional/bind.h"
 #include "base/json/json_reader.h"
+#include "base/json/values_util.h"
 #include "base/logging.h"
+#include "base/metrics/histogram_functions.h"
+#include "base/time/time.h"
 #include "brave/components/brave_vpn/browser/api/brave_vpn_api_helper.h"
 #include "brave/components/brave_vpn/browser/api/brave_vpn_api_request.h"
 #include "brave/components/brave_vpn/browser/connection/brave_vpn_connection_manager.h"
 #include "brave/components/brave_vpn/common/brave_vpn_data_types.h"
+#include "brave/components/brave_vpn/common/features.h"
 #include "brave/components/brave_vpn/common/pref_names.h"
 #include "components/prefs/pref_service.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 
 namespace brave_vpn {
 
+namespace {
+
+// Hostname load and capacity change often, so only reuse a list briefly.
+constexpr base::TimeDelta kHostnamesCacheTTL = base::Minutes(30);
+
+constexpr char kHostnamesCacheRegionKey[] = "region";
+constexpr char kHostnamesCacheHostnamesKey[] = "hostnames";
+constexpr char kHostnamesCacheFetchedDateKey[] = "fetched_date";
+
+}  // namespace
+
 ConnectionAPIImpl::ConnectionAPIImpl(
     BraveVPNConnectionManager* manager,
     scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory)
@@ -97,6 +113,11 @@ BraveVpnAPIRequest* ConnectionAPIImpl::GetAPIRequest() {
 void ConnectionAPIImpl::FetchHostnamesForRegion(const std::string& name) {
   // Hostname will be replaced with latest one.
   hostname_.reset();
+  hostnames_timer_.emplace();
+
+  if (LoadCachedHostnames(name)) {
+    return;
+  }
 
   if (!GetAPIRequest()) {
     CHECK_IS_TEST();
@@ -125,6 +146,7 @@ void ConnectionAPIImpl::OnFetchHostnames(const std::string& region,
   std::optional<base::Value::List> value = base::JSONReader::ReadList(
       hostnames, base::JSON_PARSE_CHROMIUM_EXTENSIONS);
   if (value) {
+    CacheHostnames(region, *value);
     ParseAndCacheHostnames(region, *value);
     return;
   }
@@ -157,6 +179,12 @@ void ConnectionAPIImpl::ParseAndCacheHostnames(
           << hostname_->display_name << ", " << hostname_->is_offline << ", "
           << hostname_->capacity_score;
 
+  if (hostnames_timer_) {
+    base::UmaHistogramMediumTimes(kConnectHostnamesTimeHistogramName,
+                                  hostnames_timer_->Elapsed());
+    hostnames_timer_.reset();
+  }
+
   if (!GetAPIRequest()) {
     CHECK_IS_TEST();
     return;
@@ -173,6 +201,43 @@ void ConnectionAPIImpl::ResetHostname() {
   hostname_.reset();
 }
 
+bool ConnectionAPIImpl::LoadCachedHostnames(const std::string& region) {
+  if (!base::FeatureList::IsEnabled(features::kBraveVPNHostnamesCache)) {
+    return false;
+  }
+  const auto& cache =
+      manager_->local_prefs()->GetDict(prefs::kBraveVPNHostnamesCache);
+  const std::string* cached_region = cache.FindString(kHostnamesCacheRegionKey);
+  const base::Value::List* hostnames =
+      cache.FindList(kHostnamesCacheHostnamesKey);
+  const auto fetched_date =
+      base::ValueToTime(cache.Find(kHostnamesCacheFetchedDateKey));
+  if (!cached_region || *cached_region != region || !hostnames ||
+      !fetched_date || base::Time::Now() - *fetched_date > kHostnamesCacheTTL ||
+      base::Time::Now() < *fetched_date) {
+    return false;
+  }
+  VLOG(2) << __func__ << " : use cached hostnames for " << region;
+  ParseAndCacheHostnames(region, *hostnames);
+  return true;
+}
+
+void ConnectionAPIImpl::CacheHostnames(
+    const std::string& region,
+    const base::Value::List& hostnames_value) {
+  if (!base::FeatureList::IsEnabled(features::kBraveVPNHostnamesCache)) {
+    return;
+  }
+  // Only the last region is kept, which is the one reconnects use.
+  manager_->local_prefs()->SetDict(
+      prefs::kBraveVPNHostnamesCache,
+      base::Value::Dict()
+          .Set(kHostnamesCacheRegionKey, region)
+          .Set(kHostnamesCacheHostnamesKey, hostnames_value.Clone())
+          .Set(kHostnamesCacheFetchedDateKey,
+               base::TimeToValue(base::Time::Now())));
+}
+
 bool ConnectionAPIImpl::SmartRoutingEnabled() const {
   if (hostname_ && hostname_->smart_routing_enabled) {
     bool smart_routing_user_supported = manager_->local_prefs()->GetBoolean(
@@ -197,6 +262,29 @@ void ConnectionAPIImpl::UpdateAndNotifyConnectionStateChange(
     return;
   }
 
+  switch (state) {
+    case mojom::ConnectionState::CONNECTING:
+      connect_timer_.emplace();
+      break;
+    case mojom::ConnectionState::CONNECTED:
+      if (connect_timer_) {
+        base::UmaHistogramMediumTimes(kConnectTotalTimeHistogramName,
+                                      connect_timer_->Elapsed());
+      }
+      connect_timer_.reset();
+      hostnames_timer_.reset();
+      break;
+    case mojom::ConnectionState::CONNECT_FAILED:
+      // The cached hostnames may be the reason of the failure, so fetch
+      // them again on the next attempt.
+      manager_->local_prefs()->ClearPref(prefs::kBraveVPNHostnamesCache);
+      [[fallthrough]];
+    default:
+      connect_timer_.reset();
+      hostnames_timer_.reset();
+      break;
+  }
+
   connection_state_ = state;
   manager_->NotifyConnectionStateChanged(connection_state_);
 }
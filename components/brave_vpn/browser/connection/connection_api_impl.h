@@ -7,11 +7,13 @@
 #define BRAVE_COMPONENTS_BRAVE_VPN_BROWSER_CONNECTION_CONNECTION_API_IMPL_H_
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "base/gtest_prod_util.h"
 #include "base/memory/raw_ref.h"
 #include "base/memory/scoped_refptr.h"
+#include "base/timer/elapsed_timer.h"
 #include "base/values.h"
 #include "brave/components/brave_vpn/common/mojom/brave_vpn.mojom.h"
 #include "net/base/network_change_notifier.h"
@@ -26,6 +28,11 @@ class BraveVPNConnectionManager;
 class BraveVpnAPIRequest;
 struct Hostname;
 
+inline constexpr char kConnectHostnamesTimeHistogramName[] =
+    "Brave.VPN.ConnectTime.Hostnames";
+inline constexpr char kConnectTotalTimeHistogramName[] =
+    "Brave.VPN.ConnectTime.Total";
+
 class ConnectionAPIImpl
     : public net::NetworkChangeNotifier::NetworkChangeObserver {
  public:
@@ -75,6 +82,10 @@ class ConnectionAPIImpl
   void ParseAndCacheHostnames(const std::string& region,
                               const base::Value::List& hostnames_value);
   void ResetHostname();
+  // Returns false when there is no fresh cached hostnames list for |region|.
+  bool LoadCachedHostnames(const std::string& region);
+  void CacheHostnames(const std::string& region,
+                      const base::Value::List& hostnames_value);
 
   const raw_ref<BraveVPNConnectionManager> manager_;  // owner
 
@@ -83,6 +94,8 @@ class ConnectionAPIImpl
   friend class BraveVPNServiceTest;
   FRIEND_TEST_ALL_PREFIXES(SystemVPNConnectionAPIUnitTest, NeedsConnectTest);
   FRIEND_TEST_ALL_PREFIXES(SystemVPNConnectionAPIUnitTest, HostnamesTest);
+  FRIEND_TEST_ALL_PREFIXES(SystemVPNConnectionAPIUnitTest,
+                           CachedHostnamesTest);
   FRIEND_TEST_ALL_PREFIXES(SystemVPNConnectionAPIUnitTest, ConnectionInfoTest);
   FRIEND_TEST_ALL_PREFIXES(SystemVPNConnectionAPIUnitTest,
                            CancelConnectingTest);
@@ -101,6 +114,9 @@ class ConnectionAPIImpl
 
   std::unique_ptr<Hostname> hostname_;
   std::string last_connection_error_;
+  // Set while connecting to record the connect time breakdown.
+  std::optional<base::ElapsedTimer> connect_timer_;
+  std::optional<base::ElapsedTimer> hostnames_timer_;
 
   // Only not null when there is active network request.
   // When network request is done, we reset this so we can know
@@ -9,6 +9,7 @@
 
 #include "base/memory/scoped_refptr.h"
 #include "base/run_loop.h"
+#include "base/test/scoped_feature_list.h"
 #include "brave/components/brave_vpn/browser/brave_vpn_service_helper.h"
 #include "brave/components/brave_vpn/browser/connection/brave_vpn_connection_manager.h"
 #include "brave/components/brave_vpn/browser/connection/brave_vpn_region_data_helper.h"
@@ -16,6 +17,7 @@
 #include "brave/components/brave_vpn/browser/connection/ikev2/connection_api_impl_sim.h"
 #include "brave/components/brave_vpn/common/brave_vpn_data_types.h"
 #include "brave/components/brave_vpn/common/brave_vpn_utils.h"
+#include "brave/components/brave_vpn/common/features.h"
 #include "brave/components/brave_vpn/common/mojom/brave_vpn.mojom.h"
 #include "brave/components/brave_vpn/common/pref_names.h"
 #include "components/sync_preferences/testing_pref_service_syncable.h"
@@ -558,6 +560,31 @@ TEST_F(SystemVPNConnectionAPIUnitTest, HostnamesTest) {
   EXPECT_FALSE(test_api->hostname_);
 }
 
+TEST_F(SystemVPNConnectionAPIUnitTest, CachedHostnamesTest) {
+  base::test::ScopedFeatureList feature_list(
+      features::kBraveVPNHostnamesCache);
+  auto* test_api = GetConnectionAPI();
+  test_api->OnFetchHostnames("eu-be", kHostNamesTestData, true);
+  EXPECT_EQ("host-2.brave.com", test_api->hostname_->hostname);
+
+  // Fetched list is reused for the same region only.
+  test_api->hostname_.reset();
+  EXPECT_TRUE(test_api->LoadCachedHostnames("eu-be"));
+  EXPECT_EQ("host-2.brave.com", test_api->hostname_->hostname);
+  EXPECT_FALSE(test_api->LoadCachedHostnames("eu-nl"));
+
+  // Outdated list is not used.
+  task_environment_.FastForwardBy(base::Minutes(31));
+  EXPECT_FALSE(test_api->LoadCachedHostnames("eu-be"));
+
+  // Cached list is dropped when connect failed.
+  test_api->OnFetchHostnames("eu-be", kHostNamesTestData, true);
+  test_api->connection_state_ = mojom::ConnectionState::CONNECTING;
+  test_api->UpdateAndNotifyConnectionStateChange(
+      mojom::ConnectionState::CONNECT_FAILED);
+  EXPECT_FALSE(test_api->LoadCachedHostnames("eu-be"));
+}
+
 TEST_F(SystemVPNConnectionAPIUnitTest, ConnectionInfoTest) {
   auto* test_api = GetConnectionAPI();
 
@@ -37,6 +37,7 @@ void RegisterVPNLocalStatePrefs(PrefRegistrySimple* registry) {
   registry->RegisterIntegerPref(prefs::kBraveVPNRegionListVersion, 1);
   registry->RegisterTimePref(prefs::kBraveVPNRegionListFetchedDate, {});
   registry->RegisterStringPref(prefs::kBraveVPNDeviceRegion, "");
+  registry->RegisterDictionaryPref(prefs::kBraveVPNHostnamesCache);
   registry->RegisterStringPref(prefs::kBraveVPNSelectedRegion, "");
   registry->RegisterStringPref(prefs::kBraveVPNSelectedRegionV2, "");
 #endif
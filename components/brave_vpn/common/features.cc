@@ -23,6 +23,8 @@ BASE_FEATURE(kBraveVPN,
 BASE_FEATURE(kBraveVPNLinkSubscriptionAndroidUI,
              base::FEATURE_ENABLED_BY_DEFAULT);
 
+BASE_FEATURE(kBraveVPNHostnamesCache, base::FEATURE_DISABLED_BY_DEFAULT);
+
 #if BUILDFLAG(IS_WIN)
 BASE_FEATURE(kBraveVPNDnsProtection,
              base::FEATURE_ENABLED_BY_DEFAULT);
@@ -14,6 +14,9 @@ namespace features {
 
 BASE_DECLARE_FEATURE(kBraveVPN);
 BASE_DECLARE_FEATURE(kBraveVPNLinkSubscriptionAndroidUI);
+// Reuses the last fetched hostnames list of a region for a short while so
+// reconnecting doesn't wait on a hostnames round trip.
+BASE_DECLARE_FEATURE(kBraveVPNHostnamesCache);
 #if BUILDFLAG(IS_WIN)
 BASE_DECLARE_FEATURE(kBraveVPNDnsProtection);
 BASE_DECLARE_FEATURE(kBraveVPNUseWireguardService);
@@ -23,6 +23,9 @@ inline constexpr char kBraveVPNRegionListFetchedDate[] =
     "brave.brave_vpn.region_list_fetched_date";
 inline constexpr char kBraveVPNDeviceRegion[] =
     "brave.brave_vpn.device_region_name";
+// Last fetched hostnames list with its region and fetched date.
+inline constexpr char kBraveVPNHostnamesCache[] =
+    "brave.brave_vpn.hostnames_cache";
 
 // For backward-compatibility, v1's selected region name is preserved.
 // If user runs older brave with migrated profile, it could make crash as
@@ -5,8 +5,12 @@
 
 #include "brave/components/brave_wallet/browser/account_discovery_manager.h"
 
+#include <algorithm>
+#include <utility>
+
 #include "base/check.h"
 #include "base/check_is_test.h"
+#include "base/containers/map_util.h"
 #include "base/functional/bind.h"
 #include "base/notreached.h"
 #include "base/strings/strcat.h"
@@ -45,7 +49,8 @@ AccountDiscoveryManager::DiscoveryContext::DiscoveryContext(
       keyring_id(keyring_id),
       chain_id(chain_id),
       discovery_account_index(discovery_account_index),
-      attempts_left(attempts_left) {}
+      attempts_left(attempts_left),
+      next_probe_index(discovery_account_index) {}
 
 AccountDiscoveryManager::DiscoveryContext::~DiscoveryContext() = default;
 
@@ -103,98 +108,144 @@ AccountDiscoveryManager::GetDerivedAccountsCount() {
 
 void AccountDiscoveryManager::AddDiscoveryAccount(
     std::unique_ptr<DiscoveryContext> context) {
-  if (context->attempts_left <= 0) {
-    return;
-  }
-
-  auto addr = keyring_service_->GetDiscoveryAddress(
-      context->keyring_id, context->discovery_account_index);
-  if (!addr) {
-    return;
-  }
+  auto keyring_id = context->keyring_id;
+  auto& inserted = contexts_[keyring_id] = std::move(context);
+  ProbeAccounts(*inserted);
+}
 
-  auto chain_id = context->chain_id;
-  auto coin_type = context->coin_type;
-  if (context->coin_type == mojom::CoinType::ETH) {
-    json_rpc_service_->GetEthTransactionCount(
-        chain_id, addr.value(),
-        base::BindOnce(&AccountDiscoveryManager::OnEthGetTransactionCount,
-                       weak_ptr_factory_.GetWeakPtr(), std::move(context)));
-  } else if (context->coin_type == mojom::CoinType::SOL) {
-    // We use balance for Solana account discovery since practically
-    // getSignaturesForAddress method sometimes does not work properly when
-    // node loses bigtable connection.
-    json_rpc_service_->GetSolanaBalance(
-        addr.value(), chain_id,
-        base::BindOnce(&AccountDiscoveryManager::OnResolveSolanaAccountBalance,
-                       weak_ptr_factory_.GetWeakPtr(), std::move(context)));
-  } else if (context->coin_type == mojom::CoinType::FIL) {
-    // We use balance for Filecoin account discovery since proper method is
-    // limited https://github.com/filecoin-project/lotus/issues/9728
-    json_rpc_service_->GetBalance(
-        addr.value(), coin_type, chain_id,
-        base::BindOnce(&AccountDiscoveryManager::OnResolveAccountBalance,
-                       weak_ptr_factory_.GetWeakPtr(), std::move(context)));
+void AccountDiscoveryManager::ProbeAccounts(DiscoveryContext& context) {
+  // Only addresses which would be probed one by one too are probed ahead, so
+  // no more than `attempts_left` past the last processed result.
+  const size_t window_end =
+      context.discovery_account_index +
+      std::min<size_t>(std::max(context.attempts_left, 0),
+                       kMaxAccountDiscoveryProbesInFlight);
+  while (!context.stopped &&
+         context.probes_in_flight < kMaxAccountDiscoveryProbesInFlight &&
+         context.next_probe_index < window_end) {
+    auto addr = keyring_service_->GetDiscoveryAddress(
+        context.keyring_id, context.next_probe_index);
+    if (!addr) {
+      context.stopped = true;
+      return;
+    }
 
-  } else {
-    NOTREACHED() << context->coin_type;
+    const auto keyring_id = context.keyring_id;
+    const auto account_index = context.next_probe_index++;
+    context.probes_in_flight++;
+    if (context.coin_type == mojom::CoinType::ETH) {
+      json_rpc_service_->GetEthTransactionCount(
+          context.chain_id, addr.value(),
+          base::BindOnce(&AccountDiscoveryManager::OnEthGetTransactionCount,
+                         weak_ptr_factory_.GetWeakPtr(), keyring_id,
+                         account_index));
+    } else if (context.coin_type == mojom::CoinType::SOL) {
+      // We use balance for Solana account discovery since practically
+      // getSignaturesForAddress method sometimes does not work properly when
+      // node loses bigtable connection.
+      json_rpc_service_->GetSolanaBalance(
+          addr.value(), context.chain_id,
+          base::BindOnce(
+              &AccountDiscoveryManager::OnResolveSolanaAccountBalance,
+              weak_ptr_factory_.GetWeakPtr(), keyring_id, account_index));
+    } else if (context.coin_type == mojom::CoinType::FIL) {
+      // We use balance for Filecoin account discovery since proper method is
+      // limited https://github.com/filecoin-project/lotus/issues/9728
+      json_rpc_service_->GetBalance(
+          addr.value(), context.coin_type, context.chain_id,
+          base::BindOnce(&AccountDiscoveryManager::OnResolveAccountBalance,
+                         weak_ptr_factory_.GetWeakPtr(), keyring_id,
+                         account_index));
+    } else {
+      NOTREACHED() << context.coin_type;
+    }
   }
 }
 
 void AccountDiscoveryManager::OnResolveAccountBalance(
-    std::unique_ptr<DiscoveryContext> context,
+    mojom::KeyringId keyring_id,
+    size_t account_index,
     const std::string& value,
     mojom::ProviderError error,
     const std::string& error_message) {
   if (error != mojom::ProviderError::kSuccess) {
+    ProcessDiscoveryResult(keyring_id, account_index, std::nullopt);
     return;
   }
-  ProcessDiscoveryResult(std::move(context), value != "0");
+  ProcessDiscoveryResult(keyring_id, account_index, value != "0");
 }
 
 void AccountDiscoveryManager::OnResolveSolanaAccountBalance(
-    std::unique_ptr<DiscoveryContext> context,
+    mojom::KeyringId keyring_id,
+    size_t account_index,
     uint64_t value,
     mojom::SolanaProviderError error,
     const std::string& error_message) {
   if (error != mojom::SolanaProviderError::kSuccess) {
+    ProcessDiscoveryResult(keyring_id, account_index, std::nullopt);
     return;
   }
-  ProcessDiscoveryResult(std::move(context), value > 0);
+  ProcessDiscoveryResult(keyring_id, account_index, value > 0);
 }
 
 void AccountDiscoveryManager::OnEthGetTransactionCount(
-    std::unique_ptr<DiscoveryContext> context,
+    mojom::KeyringId keyring_id,
+    size_t account_index,
     uint256_t result,
     mojom::ProviderError error,
     const std::string& error_message) {
   if (error != mojom::ProviderError::kSuccess) {
+    ProcessDiscoveryResult(keyring_id, account_index, std::nullopt);
     return;
   }
-  ProcessDiscoveryResult(std::move(context), result > 0);
+  ProcessDiscoveryResult(keyring_id, account_index, result > 0);
 }
 
 void AccountDiscoveryManager::ProcessDiscoveryResult(
-    std::unique_ptr<DiscoveryContext> context,
-    bool result) {
-  if (result) {
-    auto derived_count = GetDerivedAccountsCount();
-
-    auto last_account_index = derived_count[context->keyring_id];
-    if (context->discovery_account_index + 1 > last_account_index) {
-      keyring_service_->AddAccountsWithDefaultName(
-          context->coin_type, context->keyring_id,
-          context->discovery_account_index - last_account_index + 1);
+    mojom::KeyringId keyring_id,
+    size_t account_index,
+    std::optional<bool> result) {
+  auto* context = base::FindPtrOrNull(contexts_, keyring_id);
+  CHECK(context);
+  CHECK_GT(context->probes_in_flight, 0u);
+  context->probes_in_flight--;
+  if (context->stopped) {
+    return;
+  }
+  if (!result) {
+    // Stop on the first error, results of accounts probed ahead are dropped.
+    context->stopped = true;
+    return;
+  }
+
+  context->ready_results[account_index] = *result;
+  while (!context->stopped) {
+    auto ready_result =
+        context->ready_results.extract(context->discovery_account_index);
+    if (ready_result.empty()) {
+      break;
     }
 
+    if (ready_result.mapped()) {
+      auto derived_count = GetDerivedAccountsCount();
+
+      auto last_account_index = derived_count[context->keyring_id];
+      if (context->discovery_account_index + 1 > last_account_index) {
+        keyring_service_->AddAccountsWithDefaultName(
+            context->coin_type, context->keyring_id,
+            context->discovery_account_index - last_account_index + 1);
+      }
+      context->attempts_left = kDiscoveryAttempts;
+    } else {
+      context->attempts_left--;
+    }
     context->discovery_account_index++;
-    context->attempts_left = kDiscoveryAttempts;
-    AddDiscoveryAccount(std::move(context));
-  } else {
-    context->discovery_account_index++;
-    context->attempts_left--;
-    AddDiscoveryAccount(std::move(context));
+    if (context->attempts_left <= 0) {
+      context->stopped = true;
+    }
   }
+
+  ProbeAccounts(*context);
 }
 
 void AccountDiscoveryManager::DiscoverBitcoinAccount(
@@ -8,6 +8,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -21,10 +22,15 @@ class BitcoinWalletService;
 class KeyringService;
 struct DiscoveredBitcoinAccount;
 
+// Up to this number of addresses of a keyring are probed at the same time.
+inline constexpr size_t kMaxAccountDiscoveryProbesInFlight = 4;
+
 // Start account discovery process. Consecutively look for accounts with at
 // least one transaction. Add such ones and all missing previous ones(so no
 // gaps). Stop discovering when there are 20 consecutive accounts with no
 // transactions.
+// Keyrings are discovered concurrently. Within a keyring the next addresses
+// of the gap window are probed ahead while results are processed in order.
 class AccountDiscoveryManager {
  public:
   AccountDiscoveryManager(JsonRpcService& rpc_service,
@@ -45,23 +51,34 @@ class AccountDiscoveryManager {
     mojom::CoinType coin_type;
     mojom::KeyringId keyring_id;
     std::string chain_id;
+    // Index of the next account which result is to be processed.
     size_t discovery_account_index;
     int attempts_left;
+    // Index of the next account to be probed.
+    size_t next_probe_index;
+    size_t probes_in_flight = 0;
+    // Results which arrived before the ones of preceding accounts.
+    std::map<size_t, bool> ready_results;
+    bool stopped = false;
   };
 
   std::map<mojom::KeyringId, uint32_t> GetDerivedAccountsCount();
 
   void AddDiscoveryAccount(std::unique_ptr<DiscoveryContext> context);
+  void ProbeAccounts(DiscoveryContext& context);
 
-  void OnEthGetTransactionCount(std::unique_ptr<DiscoveryContext> context,
+  void OnEthGetTransactionCount(mojom::KeyringId keyring_id,
+                                size_t account_index,
                                 uint256_t result,
                                 mojom::ProviderError error,
                                 const std::string& error_message);
-  void OnResolveAccountBalance(std::unique_ptr<DiscoveryContext> context,
+  void OnResolveAccountBalance(mojom::KeyringId keyring_id,
+                               size_t account_index,
                                const std::string& value,
                                mojom::ProviderError error,
                                const std::string& error_message);
-  void OnResolveSolanaAccountBalance(std::unique_ptr<DiscoveryContext> context,
+  void OnResolveSolanaAccountBalance(mojom::KeyringId keyring_id,
+                                     size_t account_index,
                                      uint64_t value,
                                      mojom::SolanaProviderError error,
                                      const std::string& error_message);
@@ -72,12 +89,15 @@ class AccountDiscoveryManager {
       uint32_t account_index,
       base::expected<DiscoveredBitcoinAccount, std::string> discovered_account);
 
-  void ProcessDiscoveryResult(std::unique_ptr<DiscoveryContext> context,
-                              bool result);
+  // `result` is std::nullopt if the account could not be probed.
+  void ProcessDiscoveryResult(mojom::KeyringId keyring_id,
+                              size_t account_index,
+                              std::optional<bool> result);
 
   raw_ref<brave_wallet::JsonRpcService> json_rpc_service_;
   raw_ref<brave_wallet::KeyringService> keyring_service_;
   raw_ptr<brave_wallet::BitcoinWalletService> bitcoin_wallet_service_;
+  std::map<mojom::KeyringId, std::unique_ptr<DiscoveryContext>> contexts_;
 
   base::WeakPtrFactory<AccountDiscoveryManager> weak_ptr_factory_{this};
 };
@@ -5,7 +5,6 @@
 
 #include "brave/components/brave_wallet/browser/account_resolver_delegate_impl.h"
 
-#include "base/check.h"
 #include "base/strings/string_util.h"
 
 namespace brave_wallet {
@@ -17,16 +16,14 @@ AccountResolverDelegateImpl::AccountResolverDelegateImpl(
 mojom::AccountIdPtr AccountResolverDelegateImpl::ResolveAccountId(
     const std::string* from_account_id,
     const std::string* from_address) {
-  const auto& accounts = keyring_service_->GetAllAccountInfos();
   if (from_account_id) {
-    for (auto& account : accounts) {
-      DCHECK(!account->account_id->unique_key.empty());
-      if (account->account_id->unique_key == *from_account_id) {
-        return account->account_id->Clone();
-      }
-    }
-  } else if (from_address && !from_address->empty()) {
-    for (auto& account : accounts) {
+    auto* account =
+        keyring_service_->FindAccountInfoByUniqueKey(*from_account_id);
+    return account ? account->account_id->Clone() : nullptr;
+  }
+
+  if (from_address && !from_address->empty()) {
+    for (auto& account : keyring_service_->GetAllAccountInfos()) {
       if (base::EqualsCaseInsensitiveASCII(account->address, *from_address)) {
         return account->account_id->Clone();
       }
@@ -38,24 +35,16 @@ mojom::AccountIdPtr AccountResolverDelegateImpl::ResolveAccountId(
 
 bool AccountResolverDelegateImpl::ValidateAccountId(
     const mojom::AccountIdPtr& account_id) {
-  const auto& accounts = keyring_service_->GetAllAccountInfos();
-  for (auto& account : accounts) {
-    if (account->account_id == account_id) {
-      return true;
-    }
-  }
-  return false;
+  return keyring_service_->FindAccountInfo(account_id);
 }
 
 std::optional<std::string> AccountResolverDelegateImpl::ResolveAddress(
     const mojom::AccountIdPtr& account_id) {
-  const auto& accounts = keyring_service_->GetAllAccountInfos();
-  for (auto& account : accounts) {
-    if (account->account_id == account_id) {
-      return account->address;
-    }
+  auto* account = keyring_service_->FindAccountInfo(account_id);
+  if (!account) {
+    return std::nullopt;
   }
-  return std::nullopt;
+  return account->address;
 }
 
 }  // namespace brave_wallet
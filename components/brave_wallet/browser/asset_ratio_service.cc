@@ -8,12 +8,15 @@
 #include <algorithm>
 #include <memory>
 #include <optional>
+#include <string_view>
+#include <tuple>
 #include <utility>
 
 #include "base/base64.h"
 #include "base/containers/fixed_flat_map.h"
 #include "base/containers/flat_map.h"
 #include "base/environment.h"
+#include "base/feature_list.h"
 #include "base/json/json_writer.h"
 #include "base/no_destructor.h"
 #include "base/strings/string_number_conversions.h"
@@ -26,8 +29,10 @@
 #include "brave/components/brave_wallet/browser/json_rpc_requests_helper.h"
 #include "brave/components/brave_wallet/browser/json_rpc_response_parser.h"
 #include "brave/components/brave_wallet/common/eth_address.h"
+#include "brave/components/brave_wallet/common/features.h"
 #include "brave/components/constants/brave_services_key.h"
 #include "net/base/load_flags.h"
+#include "mojo/public/cpp/bindings/clone_traits.h"
 #include "net/base/url_util.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 #include "services/network/public/cpp/simple_url_loader.h"
@@ -156,8 +161,36 @@ std::vector<mojom::AssetPricePtr> DummyPrices(
   return test_result;
 }
 
+std::tuple<mojom::CoinType, std::string, std::string, std::string>
+MakePriceKey(mojom::CoinType coin,
+             std::string_view chain_id,
+             std::string_view address,
+             std::string_view vs_currency) {
+  // EVM token addresses are case-insensitive hex, other chains' are not.
+  return {coin, base::ToLowerASCII(chain_id),
+          coin == mojom::CoinType::ETH ? base::ToLowerASCII(address)
+                                       : std::string(address),
+          base::ToUpperASCII(vs_currency)};
+}
+
 }  // namespace
 
+AssetRatioService::PendingPriceCall::PendingPriceCall(
+    std::vector<PriceKey> keys,
+    GetPriceCallback callback)
+    : keys(std::move(keys)), callback(std::move(callback)) {}
+AssetRatioService::PendingPriceCall::PendingPriceCall(PendingPriceCall&&) =
+    default;
+AssetRatioService::PendingPriceCall&
+AssetRatioService::PendingPriceCall::operator=(PendingPriceCall&&) = default;
+AssetRatioService::PendingPriceCall::~PendingPriceCall() = default;
+
+AssetRatioService::PriceBatch::PriceBatch() = default;
+AssetRatioService::PriceBatch::PriceBatch(PriceBatch&&) = default;
+AssetRatioService::PriceBatch& AssetRatioService::PriceBatch::operator=(
+    PriceBatch&&) = default;
+AssetRatioService::PriceBatch::~PriceBatch() = default;
+
 // TODO(https://github.com/brave/brave-browser/issues/48713): This is a case of
 // `-Wexit-time-destructors` violation and `[[clang::no_destroy]]` has been
 // added in the meantime to fix the build error. Remove this attribute and
@@ -345,6 +378,11 @@ void AssetRatioService::GetPrice(
     return;
   }
 
+  if (base::FeatureList::IsEnabled(features::kBraveWalletPriceCacheFeature)) {
+    GetPriceWithCache(std::move(requests), vs_currency, std::move(callback));
+    return;
+  }
+
   std::string json_payload = CreatePricingRequestPayload(requests);
 
   GURL url = GetPriceURL(vs_currency);
@@ -362,6 +400,108 @@ void AssetRatioService::GetPrice(
       std::move(conversion_callback));
 }
 
+void AssetRatioService::GetPriceWithCache(
+    std::vector<mojom::AssetPriceRequestPtr> requests,
+    const std::string& vs_currency,
+    GetPriceCallback callback) {
+  const base::TimeTicks now = base::TimeTicks::Now();
+  const base::TimeDelta ttl =
+      base::Seconds(features::kPriceCacheTtlSeconds.Get());
+
+  std::vector<PriceKey> keys;
+  std::vector<std::pair<PriceKey, mojom::AssetPriceRequestPtr>> missing;
+  for (auto& request : requests) {
+    PriceKey key =
+        MakePriceKey(request->coin, request->chain_id,
+                     request->address.value_or(std::string()), vs_currency);
+    auto it = price_cache_.find(key);
+    if (it == price_cache_.end() || now - it->second.fetched_at >= ttl) {
+      missing.emplace_back(key, std::move(request));
+    }
+    keys.push_back(std::move(key));
+  }
+
+  if (missing.empty()) {
+    std::move(callback).Run(true, GetCachedPrices(keys));
+    return;
+  }
+
+  // Callers usually ask for overlapping assets at about the same time, so
+  // their requests are merged into one per vs currency.
+  PriceBatch& batch = pending_price_batches_[base::ToUpperASCII(vs_currency)];
+  for (auto& [key, request] : missing) {
+    batch.requests.try_emplace(std::move(key), std::move(request));
+  }
+  batch.calls.emplace_back(std::move(keys), std::move(callback));
+
+  if (!price_batch_timer_.IsRunning()) {
+    price_batch_timer_.Start(
+        FROM_HERE, base::Milliseconds(features::kPriceBatchingWindowMs.Get()),
+        this, &AssetRatioService::SendPriceBatches);
+  }
+}
+
+void AssetRatioService::SendPriceBatches() {
+  auto batches = std::move(pending_price_batches_);
+  pending_price_batches_.clear();
+
+  for (auto& [vs_currency, batch] : batches) {
+    std::vector<mojom::AssetPriceRequestPtr> requests;
+    requests.reserve(batch.requests.size());
+    for (auto& [key, request] : batch.requests) {
+      requests.push_back(std::move(request));
+    }
+
+    auto internal_callback = base::BindOnce(
+        &AssetRatioService::OnGetBatchedPrices, weak_ptr_factory_.GetWeakPtr(),
+        vs_currency, std::move(batch.calls));
+    api_request_helper_->Request(
+        "POST", GetPriceURL(vs_currency), CreatePricingRequestPayload(requests),
+        "application/json", std::move(internal_callback),
+        MakeBraveServicesKeyHeaders(),
+        {.auto_retry_on_network_change = true, .enable_cache = true},
+        base::BindOnce(&ConvertAllNumbersToString, ""));
+  }
+}
+
+void AssetRatioService::OnGetBatchedPrices(
+    const std::string& vs_currency,
+    std::vector<PendingPriceCall> calls,
+    APIRequestResult api_request_result) {
+  if (!api_request_result.Is2XXResponseCode()) {
+    for (auto& call : calls) {
+      std::move(call.callback).Run(false, {});
+    }
+    return;
+  }
+
+  // Entries are overwritten when refreshed rather than evicted, as the set of
+  // keys is bounded by the assets the wallet displays.
+  const base::TimeTicks now = base::TimeTicks::Now();
+  for (auto& price : ParseAssetPrices(api_request_result.value_body())) {
+    PriceKey key = MakePriceKey(price->coin, price->chain_id, price->address,
+                                vs_currency);
+    price_cache_.insert_or_assign(std::move(key),
+                                  CachedPrice{std::move(price), now});
+  }
+
+  for (auto& call : calls) {
+    std::move(call.callback).Run(true, GetCachedPrices(call.keys));
+  }
+}
+
+std::vector<mojom::AssetPricePtr> AssetRatioService::GetCachedPrices(
+    const std::vector<PriceKey>& keys) const {
+  std::vector<mojom::AssetPricePtr> prices;
+  for (const auto& key : keys) {
+    auto it = price_cache_.find(key);
+    if (it != price_cache_.end()) {
+      prices.push_back(it->second.price.Clone());
+    }
+  }
+  return prices;
+}
+
 void AssetRatioService::GetStripeBuyURL(
     GetBuyUrlV1Callback callback,
     const std::string& address,
@@ -436,6 +576,34 @@ void AssetRatioService::GetPriceHistory(const std::string& asset,
   std::string asset_lower = base::ToLowerASCII(asset);
   std::string vs_asset_lower = base::ToLowerASCII(vs_asset);
 
+  if (base::FeatureList::IsEnabled(features::kBraveWalletPriceCacheFeature)) {
+    PriceHistoryKey key{asset_lower, vs_asset_lower, timeframe};
+    auto it = price_history_cache_.find(key);
+    if (it != price_history_cache_.end() &&
+        base::TimeTicks::Now() - it->second.fetched_at <
+            base::Minutes(features::kPriceHistoryCacheTtlMinutes.Get())) {
+      std::move(callback).Run(true, mojo::Clone(it->second.values));
+      return;
+    }
+
+    // Only the first caller for a key sends a request, later ones wait for
+    // its result.
+    auto& callbacks = pending_price_history_calls_[key];
+    callbacks.push_back(std::move(callback));
+    if (callbacks.size() > 1) {
+      return;
+    }
+
+    api_request_helper_->Request(
+        "GET", GetPriceHistoryURL(asset_lower, vs_asset_lower, timeframe), "",
+        "",
+        base::BindOnce(&AssetRatioService::OnGetPriceHistoryWithCache,
+                       weak_ptr_factory_.GetWeakPtr(), std::move(key)),
+        MakeBraveServicesKeyHeaders(),
+        {.auto_retry_on_network_change = true, .enable_cache = true});
+    return;
+  }
+
   auto internal_callback =
       base::BindOnce(&AssetRatioService::OnGetPriceHistory,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
@@ -461,6 +629,28 @@ void AssetRatioService::OnGetPriceHistory(GetPriceHistoryCallback callback,
   std::move(callback).Run(true, std::move(values));
 }
 
+void AssetRatioService::OnGetPriceHistoryWithCache(
+    const PriceHistoryKey& key,
+    APIRequestResult api_request_result) {
+  auto it = pending_price_history_calls_.find(key);
+  CHECK(it != pending_price_history_calls_.end());
+  std::vector<GetPriceHistoryCallback> callbacks = std::move(it->second);
+  pending_price_history_calls_.erase(it);
+
+  std::vector<mojom::AssetTimePricePtr> values;
+  const bool success =
+      api_request_result.Is2XXResponseCode() &&
+      ParseAssetPriceHistory(api_request_result.value_body(), &values);
+  if (success) {
+    price_history_cache_.insert_or_assign(
+        key, CachedPriceHistory{mojo::Clone(values), base::TimeTicks::Now()});
+  }
+
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(success, mojo::Clone(values));
+  }
+}
+
 // static
 GURL AssetRatioService::GetCoinMarketsURL(const std::string& vs_asset,
                                           const uint8_t limit) {
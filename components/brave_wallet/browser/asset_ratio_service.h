@@ -8,11 +8,15 @@
 
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/functional/callback.h"
 #include "base/gtest_prod_util.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "components/keyed_service/core/keyed_service.h"
@@ -104,11 +108,64 @@ class AssetRatioService : public KeyedService, public mojom::AssetRatioService {
   void OnGetCoinMarkets(GetCoinMarketsCallback callback,
                         APIRequestResult api_request_result);
 
+  // Price cache, used when features::kBraveWalletPriceCacheFeature is
+  // enabled. Prices are keyed by coin, chain id, token address and vs
+  // currency.
+  using PriceKey =
+      std::tuple<mojom::CoinType, std::string, std::string, std::string>;
+  struct CachedPrice {
+    mojom::AssetPricePtr price;
+    base::TimeTicks fetched_at;
+  };
+  struct PendingPriceCall {
+    PendingPriceCall(std::vector<PriceKey> keys, GetPriceCallback callback);
+    PendingPriceCall(PendingPriceCall&&);
+    PendingPriceCall& operator=(PendingPriceCall&&);
+    ~PendingPriceCall();
+
+    std::vector<PriceKey> keys;
+    GetPriceCallback callback;
+  };
+  // GetPrice calls for one vs currency waiting for the batching window.
+  struct PriceBatch {
+    PriceBatch();
+    PriceBatch(PriceBatch&&);
+    PriceBatch& operator=(PriceBatch&&);
+    ~PriceBatch();
+
+    base::flat_map<PriceKey, mojom::AssetPriceRequestPtr> requests;
+    std::vector<PendingPriceCall> calls;
+  };
+  void GetPriceWithCache(std::vector<mojom::AssetPriceRequestPtr> requests,
+                         const std::string& vs_currency,
+                         GetPriceCallback callback);
+  void SendPriceBatches();
+  void OnGetBatchedPrices(const std::string& vs_currency,
+                          std::vector<PendingPriceCall> calls,
+                          APIRequestResult api_request_result);
+  std::vector<mojom::AssetPricePtr> GetCachedPrices(
+      const std::vector<PriceKey>& keys) const;
+
+  using PriceHistoryKey =
+      std::tuple<std::string, std::string, mojom::AssetPriceTimeframe>;
+  struct CachedPriceHistory {
+    std::vector<mojom::AssetTimePricePtr> values;
+    base::TimeTicks fetched_at;
+  };
+  void OnGetPriceHistoryWithCache(const PriceHistoryKey& key,
+                                  APIRequestResult api_request_result);
+
   mojo::ReceiverSet<mojom::AssetRatioService> receivers_;
 
   static GURL base_url_for_test_;
   bool dummy_prices_for_testing_ = false;
   std::unique_ptr<api_request_helper::APIRequestHelper> api_request_helper_;
+  base::flat_map<PriceKey, CachedPrice> price_cache_;
+  base::flat_map<std::string, PriceBatch> pending_price_batches_;
+  base::OneShotTimer price_batch_timer_;
+  base::flat_map<PriceHistoryKey, CachedPriceHistory> price_history_cache_;
+  base::flat_map<PriceHistoryKey, std::vector<GetPriceHistoryCallback>>
+      pending_price_history_calls_;
   base::WeakPtrFactory<AssetRatioService> weak_ptr_factory_;
 };
 
@@ -7,12 +7,17 @@
 
 #include <memory>
 #include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
+#include "base/strings/string_util.h"
 #include "base/test/bind.h"
+#include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+#include "brave/components/brave_wallet/common/features.h"
 #include "services/data_decoder/public/cpp/test_support/in_process_data_decoder.h"
 #include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
 #include "services/network/test/test_url_loader_factory.h"
@@ -102,11 +107,14 @@ class AssetRatioServiceUnitTest : public testing::Test {
   void SetInterceptor(const std::string& content) {
     url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
         [&, content](const network::ResourceRequest& request) {
+          requests_sent_++;
           url_loader_factory_.ClearResponses();
           url_loader_factory_.AddResponse(request.url.spec(), content);
         }));
   }
 
+  size_t requests_sent() const { return requests_sent_; }
+
   void SetErrorInterceptor(const std::string& content) {
     url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
         [&, content](const network::ResourceRequest& request) {
@@ -159,9 +167,11 @@ class AssetRatioServiceUnitTest : public testing::Test {
 
  protected:
   std::unique_ptr<AssetRatioService> asset_ratio_service_;
-  base::test::TaskEnvironment task_environment_;
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
 
  private:
+  size_t requests_sent_ = 0;
   network::TestURLLoaderFactory url_loader_factory_;
   scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
   data_decoder::test::InProcessDataDecoder in_process_data_decoder_;
@@ -271,6 +281,74 @@ TEST_F(AssetRatioServiceUnitTest, GetPrice) {
   EXPECT_TRUE(callback_run);
 }
 
+TEST_F(AssetRatioServiceUnitTest, GetPriceCached) {
+  base::test::ScopedFeatureList feature_list(
+      features::kBraveWalletPriceCacheFeature);
+  SetInterceptor(R"([
+    {"coin": "ETH", "chain_id": "0x1",
+     "address": "0x0D8775F648430679A709E98d2b0Cb6250d2887EF",
+     "price": "0.55393", "vs_currency": "USD", "cache_status": "HIT",
+     "source": "coingecko"},
+    {"coin": "SOL", "chain_id": "0x65",
+     "address": "EPjFWdd5AufqSSqeM2qN1xzybapC8G4wEGGkZwyTDt1v",
+     "price": "0.998", "vs_currency": "USD", "cache_status": "MISS",
+     "source": "jupiter"},
+    {"coin": "BTC", "chain_id": "bitcoin_mainnet", "price": "102000",
+     "vs_currency": "USD", "cache_status": "MISS", "source": "coingecko"}
+  ])");
+
+  auto get_price = [&](std::vector<mojom::AssetPriceRequestPtr> requests,
+                       std::vector<std::string>* prices) {
+    asset_ratio_service_->GetPrice(
+        std::move(requests), "usd",
+        base::BindLambdaForTesting(
+            [prices](bool success, std::vector<mojom::AssetPricePtr> values) {
+              EXPECT_TRUE(success);
+              for (const auto& value : values) {
+                prices->push_back(value->price);
+              }
+            }));
+  };
+
+  // Concurrent calls are merged into a single request.
+  std::vector<std::string> all_prices;
+  std::vector<std::string> btc_prices;
+  get_price(CreatePriceRequests(), &all_prices);
+  auto requests = CreatePriceRequests();
+  requests.erase(requests.begin(), requests.begin() + 2);
+  get_price(std::move(requests), &btc_prices);
+  EXPECT_EQ(0u, requests_sent());
+  task_environment_.FastForwardBy(
+      base::Milliseconds(features::kPriceBatchingWindowMs.Get()));
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(1u, requests_sent());
+  EXPECT_EQ(all_prices,
+            std::vector<std::string>({"0.55393", "0.998", "102000"}));
+  EXPECT_EQ(btc_prices, std::vector<std::string>({"102000"}));
+
+  // Cached prices are returned right away, EVM addresses in any case.
+  std::vector<std::string> eth_prices;
+  requests = CreatePriceRequests();
+  requests.resize(1);
+  requests[0]->address = base::ToLowerASCII(*requests[0]->address);
+  get_price(std::move(requests), &eth_prices);
+  EXPECT_EQ(eth_prices, std::vector<std::string>({"0.55393"}));
+  EXPECT_EQ(1u, requests_sent());
+
+  // Expired prices are fetched again.
+  task_environment_.FastForwardBy(
+      base::Seconds(features::kPriceCacheTtlSeconds.Get()));
+  eth_prices.clear();
+  requests = CreatePriceRequests();
+  requests.resize(1);
+  get_price(std::move(requests), &eth_prices);
+  task_environment_.FastForwardBy(
+      base::Milliseconds(features::kPriceBatchingWindowMs.Get()));
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(2u, requests_sent());
+  EXPECT_EQ(eth_prices, std::vector<std::string>({"0.55393"}));
+}
+
 TEST_F(AssetRatioServiceUnitTest, GetPriceError) {
   std::string error = "error";
   SetErrorInterceptor(error);
@@ -332,6 +410,56 @@ TEST_F(AssetRatioServiceUnitTest, GetPriceHistory) {
   EXPECT_TRUE(callback_run);
 }
 
+TEST_F(AssetRatioServiceUnitTest, GetPriceHistoryCached) {
+  base::test::ScopedFeatureList feature_list(
+      features::kBraveWalletPriceCacheFeature);
+  SetInterceptor(R"({
+      "payload": {
+        "prices":[[1622733088498,0.8201346624954003]],
+        "market_caps":[[1622733088498,1223507820.383275]],
+        "total_volumes":[[1622733088498,163426828.00299588]]
+      }
+    })");
+
+  size_t callbacks_run = 0;
+  auto get_price_history = [&](mojom::AssetPriceTimeframe timeframe) {
+    asset_ratio_service_->GetPriceHistory(
+        "BAT", "usd", timeframe,
+        base::BindLambdaForTesting(
+            [&](bool success, std::vector<mojom::AssetTimePricePtr> values) {
+              EXPECT_TRUE(success);
+              ASSERT_EQ(1u, values.size());
+              EXPECT_EQ("0.8201346624954003", values[0]->price);
+              callbacks_run++;
+            }));
+  };
+
+  // Concurrent calls for the same asset and timeframe share a request.
+  get_price_history(mojom::AssetPriceTimeframe::OneDay);
+  get_price_history(mojom::AssetPriceTimeframe::OneDay);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(1u, requests_sent());
+  EXPECT_EQ(2u, callbacks_run);
+
+  // Later calls are answered from the cache.
+  get_price_history(mojom::AssetPriceTimeframe::OneDay);
+  EXPECT_EQ(3u, callbacks_run);
+  EXPECT_EQ(1u, requests_sent());
+
+  // Other timeframes are cached separately.
+  get_price_history(mojom::AssetPriceTimeframe::OneWeek);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(2u, requests_sent());
+  EXPECT_EQ(4u, callbacks_run);
+
+  task_environment_.FastForwardBy(
+      base::Minutes(features::kPriceHistoryCacheTtlMinutes.Get()));
+  get_price_history(mojom::AssetPriceTimeframe::OneDay);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(3u, requests_sent());
+  EXPECT_EQ(5u, callbacks_run);
+}
+
 TEST_F(AssetRatioServiceUnitTest, GetPriceHistoryError) {
   std::string error = "error";
   SetErrorInterceptor(error);
@@ -5,6 +5,8 @@
 
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_base_keyring.h"
 
+#include <utility>
+
 #include "base/check.h"
 #include "brave/components/brave_wallet/common/common_utils.h"
 
@@ -17,6 +19,24 @@ BitcoinBaseKeyring::BitcoinBaseKeyring(mojom::KeyringId keyring_id)
 
 BitcoinBaseKeyring::~BitcoinBaseKeyring() = default;
 
+std::vector<mojom::BitcoinAddressPtr> BitcoinBaseKeyring::GetAddresses(
+    uint32_t account,
+    uint32_t change,
+    uint32_t start_index,
+    uint32_t count) {
+  std::vector<mojom::BitcoinAddressPtr> addresses;
+  addresses.reserve(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    auto address =
+        GetAddress(account, mojom::BitcoinKeyId(change, start_index + i));
+    if (!address) {
+      return {};
+    }
+    addresses.push_back(std::move(address));
+  }
+  return addresses;
+}
+
 bool BitcoinBaseKeyring::IsTestnet() const {
   return IsBitcoinTestnetKeyring(keyring_id_);
 }
@@ -22,6 +22,14 @@ class BitcoinBaseKeyring {
       uint32_t account,
       const mojom::BitcoinKeyId& key_id) = 0;
 
+  // Addresses `start_index` to `start_index + count - 1` of the `change`
+  // chain of `account`. Empty if any of them can't be derived.
+  virtual std::vector<mojom::BitcoinAddressPtr> GetAddresses(
+      uint32_t account,
+      uint32_t change,
+      uint32_t start_index,
+      uint32_t count);
+
   virtual std::optional<std::vector<uint8_t>> GetPubkey(
       uint32_t account,
       const mojom::BitcoinKeyId& key_id) = 0;
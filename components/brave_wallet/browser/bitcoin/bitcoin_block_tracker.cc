@@ -5,7 +5,6 @@
 
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_block_tracker.h"
 
-#include <memory>
 #include <optional>
 #include <utility>
 
@@ -22,12 +21,7 @@ BitcoinBlockTracker::~BitcoinBlockTracker() = default;
 
 void BitcoinBlockTracker::Start(const std::string& chain_id,
                                 base::TimeDelta interval) {
-  auto& timer = timers_[chain_id];
-  if (!timer) {
-    timer = std::make_unique<base::RepeatingTimer>();
-  }
-
-  timer->Start(FROM_HERE, interval,
+  StartPolling(chain_id, interval,
                base::BindRepeating(&BitcoinBlockTracker::GetBlockHeight,
                                    weak_ptr_factory_.GetWeakPtr(), chain_id));
 }
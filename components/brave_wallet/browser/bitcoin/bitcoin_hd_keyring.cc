@@ -5,12 +5,13 @@
 
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_hd_keyring.h"
 
-#include <array>
 #include <memory>
 #include <optional>
+#include <tuple>
 #include <utility>
 
 #include "base/check.h"
+#include "base/containers/map_util.h"
 #include "base/containers/span.h"
 #include "brave/components/brave_wallet/browser/internal/hd_key_common.h"
 #include "brave/components/brave_wallet/common/bitcoin_utils.h"
@@ -20,6 +21,9 @@ namespace brave_wallet {
 
 namespace {
 
+// Enough for the gap limit windows of a few accounts.
+constexpr size_t kMaxCachedAddresses = 1000;
+
 std::unique_ptr<HDKey> ConstructAccountsRootKey(base::span<const uint8_t> seed,
                                                 bool testnet) {
   auto result = HDKey::GenerateFromSeed(seed);
@@ -50,14 +54,22 @@ BitcoinHDKeyring::BitcoinHDKeyring(base::span<const uint8_t> seed,
 mojom::BitcoinAddressPtr BitcoinHDKeyring::GetAddress(
     uint32_t account,
     const mojom::BitcoinKeyId& key_id) {
+  const auto cache_key = std::tuple(account, key_id.change, key_id.index);
+  if (auto* address = base::FindOrNull(addresses_, cache_key)) {
+    return mojom::BitcoinAddress::New(*address, key_id.Clone());
+  }
+
   auto hd_key = DeriveKey(account, key_id);
   if (!hd_key) {
     return nullptr;
   }
 
-  return mojom::BitcoinAddress::New(
-      PubkeyToSegwitAddress(hd_key->GetPublicKeyBytes(), IsTestnet()),
-      key_id.Clone());
+  if (addresses_.size() >= kMaxCachedAddresses) {
+    addresses_.clear();
+  }
+  auto& address = addresses_[cache_key] =
+      PubkeyToSegwitAddress(hd_key->GetPublicKeyBytes(), IsTestnet());
+  return mojom::BitcoinAddress::New(address, key_id.Clone());
 }
 
 std::optional<std::vector<uint8_t>> BitcoinHDKeyring::GetPubkey(
@@ -96,20 +108,17 @@ std::unique_ptr<HDKey> BitcoinHDKeyring::DeriveAccount(uint32_t index) const {
 std::unique_ptr<HDKey> BitcoinHDKeyring::DeriveKey(
     uint32_t account,
     const mojom::BitcoinKeyId& key_id) {
-  // TODO(apaymyshev): keep local cache of keys: key_id->key
-  auto account_key = DeriveAccount(account);
-  if (!account_key) {
-    return nullptr;
-  }
-
   // TODO(apaymyshev): think if |key_id.change| should be a boolean.
   DCHECK(key_id.change == 0 || key_id.change == 1);
 
+  auto* chain_key = GetChainKey(account, key_id.change);
+  if (!chain_key) {
+    return nullptr;
+  }
+
   // Mainnet - m/84'/0'/{account}'/{key_id.change}/{key_id.index}
   // Testnet - m/84'/1'/{account}'/{key_id.change}/{key_id.index}
-  return account_key->DeriveChildFromPath(
-      std::array{DerivationIndex::Normal(key_id.change),
-                 DerivationIndex::Normal(key_id.index)});
+  return chain_key->DeriveChild(DerivationIndex::Normal(key_id.index));
 }
 
 }  // namespace brave_wallet
@@ -6,9 +6,11 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BITCOIN_BITCOIN_HD_KEYRING_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BITCOIN_BITCOIN_HD_KEYRING_H_
 
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "base/containers/span.h"
@@ -42,6 +44,10 @@ class BitcoinHDKeyring : public BitcoinBaseKeyring, public Secp256k1HDKeyring {
   std::unique_ptr<HDKey> DeriveAccount(uint32_t index) const override;
   std::unique_ptr<HDKey> DeriveKey(uint32_t account,
                                    const mojom::BitcoinKeyId& key_id);
+
+  // Derived addresses keyed by (account, change, index). Wallet sync asks for
+  // the same addresses over and over, so those are not derived every time.
+  std::map<std::tuple<uint32_t, uint32_t, uint32_t>, std::string> addresses_;
 };
 
 }  // namespace brave_wallet
@@ -81,6 +81,28 @@ TEST(BitcoinHDKeyringUnitTest, GetAddress) {
             "tb1qkvjfredfz59jwvqru7a2spvugqd7dlx6e4aqvm");
 }
 
+TEST(BitcoinHDKeyringUnitTest, GetAddresses) {
+  BitcoinHDKeyring keyring(*MnemonicToSeed(kMnemonicAbandonAbandon),
+                           kBitcoin84);
+
+  auto addresses = keyring.GetAddresses(1, 0, 0, 2);
+  ASSERT_EQ(addresses.size(), 2u);
+  EXPECT_EQ(addresses[0]->address_string,
+            "bc1qku0qh0mc00y8tk0n65x2tqw4trlspak0fnjmfz");
+  EXPECT_EQ(*addresses[0]->key_id, BitcoinKeyId(0, 0));
+  EXPECT_EQ(addresses[1]->address_string,
+            "bc1qx0tpa0ctsy5v8xewdkpf69hhtz5cw0rf5uvyj6");
+  EXPECT_EQ(*addresses[1]->key_id, BitcoinKeyId(0, 1));
+
+  // Cached addresses are the same as derived ones.
+  for (uint32_t i = 0; i < 2; ++i) {
+    EXPECT_EQ(keyring.GetAddress(1, BitcoinKeyId(0, i)), addresses[i]);
+  }
+  EXPECT_EQ(keyring.GetAddresses(1, 1, 0, 1)[0]->address_string,
+            "bc1qt0x83f5vmnapgl2gjj9r3d67rcghvjaqrvgpck");
+  EXPECT_TRUE(keyring.GetAddresses(1, 0, 0, 0).empty());
+}
+
 TEST(BitcoinHDKeyringUnitTest, GetPubkey) {
   BitcoinHDKeyring keyring(*MnemonicToSeed(kMnemonicAbandonAbandon),
                            kBitcoin84);
@@ -6,7 +6,9 @@
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_knapsack_solver.h"
 
 #include <algorithm>
+#include <functional>
 #include <utility>
+#include <vector>
 
 #include "base/check.h"
 #include "base/check_op.h"
@@ -23,6 +25,10 @@ namespace {
 
 constexpr int kKnapsackSolverIterations = 1000;
 
+// Limits the time spent on Branch and Bound search for wallets with a lot of
+// inputs.
+constexpr int kBranchAndBoundMaxTries = 100000;
+
 }  // namespace
 
 KnapsackSolver::KnapsackSolver(
@@ -133,6 +139,98 @@ void KnapsackSolver::SolveForTransaction(
   }
 }
 
+std::optional<BitcoinTransaction> KnapsackSolver::SolveBranchAndBound(
+    const BitcoinTransaction& transaction,
+    uint64_t cost_of_change) {
+  DCHECK(!transaction.ChangeOutput());
+
+  // Value of a group after paying for its inputs. Groups which are not worth
+  // spending are skipped.
+  struct Candidate {
+    size_t group_index = 0;
+    uint64_t effective_value = 0;
+  };
+  std::vector<Candidate> candidates;
+  for (size_t i = 0; i < input_groups_.size(); ++i) {
+    uint32_t inputs_vbytes = 0;
+    for (const auto& input : input_groups_[i].inputs()) {
+      inputs_vbytes += BitcoinSerializer::CalcInputVBytesInTransaction(input);
+    }
+    uint64_t inputs_fee = ApplyFeeRate(fee_rate_, inputs_vbytes);
+    if (input_groups_[i].total_amount() > inputs_fee) {
+      candidates.push_back({i, input_groups_[i].total_amount() - inputs_fee});
+    }
+  }
+  std::ranges::sort(candidates, std::greater<>(), &Candidate::effective_value);
+
+  // remaining_values[i] is the sum of effective values from `i` to the end.
+  std::vector<uint64_t> remaining_values(candidates.size() + 1, 0);
+  for (size_t i = candidates.size(); i > 0; --i) {
+    remaining_values[i - 1] =
+        remaining_values[i] + candidates[i - 1].effective_value;
+  }
+
+  const uint64_t target =
+      transaction.TotalOutputsAmount() +
+      ApplyFeeRate(fee_rate_,
+                   BitcoinSerializer::CalcTransactionVBytes(transaction, true));
+
+  std::optional<BitcoinTransaction> best_transaction;
+  std::vector<size_t> selected;
+  uint64_t selected_value = 0;
+  size_t index = 0;
+  for (int tries = 0; tries < kBranchAndBoundMaxTries; ++tries) {
+    bool backtrack = false;
+    if (selected_value + remaining_values[index] < target ||
+        selected_value > target + cost_of_change) {
+      backtrack = true;
+    } else if (selected_value >= target) {
+      // Effective values are estimates, so the exact fee is checked on the
+      // resulting transaction.
+      BitcoinTransaction next_transaction = transaction;
+      for (auto selected_index : selected) {
+        next_transaction.AddInputs(
+            input_groups_[candidates[selected_index].group_index].inputs());
+      }
+      uint64_t min_fee = ApplyFeeRate(
+          fee_rate_,
+          BitcoinSerializer::CalcTransactionVBytes(next_transaction, true));
+      if (next_transaction.AmountsAreValid(min_fee) &&
+          (!best_transaction || next_transaction.EffectiveFeeAmount() <
+                                    best_transaction->EffectiveFeeAmount())) {
+        best_transaction = std::move(next_transaction);
+        if (best_transaction->EffectiveFeeAmount() == min_fee) {
+          break;
+        }
+      }
+      backtrack = true;
+    }
+
+    if (!backtrack) {
+      selected_value += candidates[index].effective_value;
+      selected.push_back(index++);
+      continue;
+    }
+
+    if (selected.empty()) {
+      break;
+    }
+    // Omit the last selected candidate and the following ones of the same
+    // value as those lead to the same sums.
+    size_t omitted = selected.back();
+    selected.pop_back();
+    selected_value -= candidates[omitted].effective_value;
+    index = omitted + 1;
+    while (index < candidates.size() &&
+           candidates[index].effective_value ==
+               candidates[omitted].effective_value) {
+      ++index;
+    }
+  }
+
+  return best_transaction;
+}
+
 base::expected<BitcoinTransaction, std::string> KnapsackSolver::Solve() {
   DCHECK_EQ(base_transaction_.inputs().size(), 0u);
   DCHECK(base_transaction_.TargetOutput());
@@ -155,7 +253,15 @@ base::expected<BitcoinTransaction, std::string> KnapsackSolver::Solve() {
   // still less than the cost of having a change output.
   auto no_change_transaction = base_transaction_;
   no_change_transaction.ClearChangeOutput();
-  SolveForTransaction(no_change_transaction, solutions);
+  if (auto transaction = SolveBranchAndBound(
+          no_change_transaction,
+          GetCostOfChangeOutput(*base_transaction_.ChangeOutput(), fee_rate_,
+                                longterm_fee_rate_))) {
+    solutions.emplace(transaction->EffectiveFeeAmount(),
+                      std::move(*transaction));
+  } else {
+    SolveForTransaction(no_change_transaction, solutions);
+  }
 
   if (solutions.empty()) {
     return base::unexpected(
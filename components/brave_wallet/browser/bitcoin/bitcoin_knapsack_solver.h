@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BITCOIN_BITCOIN_KNAPSACK_SOLVER_H_
 
 #include <map>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -21,7 +22,10 @@ namespace brave_wallet {
 // https://github.com/bitcoin/bitcoin/blob/v25.1/src/wallet/coinselection.cpp#L255
 // Tries to find the best set of inputs(minimal fee) for a transaction.
 // Does two runs of search: with and without change output. See
-// `SolveForTransaction` for details.
+// `SolveForTransaction` for details. A changeless transaction is first
+// searched with Branch and Bound as in
+// https://github.com/bitcoin/bitcoin/blob/v25.1/src/wallet/coinselection.cpp#L68
+// and the randomized search without change is skipped if one is found.
 class KnapsackSolver {
  public:
   KnapsackSolver(
@@ -47,6 +51,12 @@ class KnapsackSolver {
   void SolveForTransaction(
       const BitcoinTransaction& transaction,
       std::multimap<uint64_t, BitcoinTransaction>& solutions);
+
+  // Depth-first search for a set of input groups which covers outputs and fee
+  // of `transaction` with a surplus less than `cost_of_change`.
+  std::optional<BitcoinTransaction> SolveBranchAndBound(
+      const BitcoinTransaction& transaction,
+      uint64_t cost_of_change);
 };
 
 }  // namespace brave_wallet
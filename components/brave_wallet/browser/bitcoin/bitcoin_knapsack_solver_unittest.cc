@@ -6,6 +6,7 @@
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_knapsack_solver.h"
 
 #include <utility>
+#include <vector>
 
 #include "base/containers/span.h"
 #include "base/rand_util.h"
@@ -277,6 +278,33 @@ TEST_F(BitcoinKnapsackSolverUnitTest, GroupIsSpentAsAWhole) {
                    MakeMockTxInput(300000, 1), MakeMockTxInput(400000, 1)}));
 }
 
+TEST_F(BitcoinKnapsackSolverUnitTest, BranchAndBoundFindsChangelessMatch) {
+  auto base_tx = MakeMockTransaction(send_amount());
+
+  // Fee for typical 2 inputs -> 1 output transaction.
+  uint32_t min_fee = ApplyFeeRate(fee_rate(), std::ceil(177.0));
+
+  // Only two of the inputs cover the amount and fee exactly, any other set
+  // either creates change or overpays.
+  std::vector<BitcoinTransaction::TxInputGroup> input_groups;
+  for (uint64_t amount : std::vector<uint64_t>{
+           6000, 7000, send_amount() + min_fee - 3000, 3000, 9000}) {
+    input_groups.emplace_back();
+    input_groups.back().AddInput(MakeMockTxInput(amount, 0));
+  }
+  KnapsackSolver solver(base_tx, fee_rate(), longterm_fee_rate(), input_groups);
+  auto tx = solver.Solve();
+  ASSERT_TRUE(tx.has_value());
+
+  EXPECT_EQ(tx->EffectiveFeeAmount(), min_fee);
+  EXPECT_EQ(tx->TotalOutputsAmount(), send_amount());
+  EXPECT_FALSE(tx->ChangeOutput());
+  EXPECT_THAT(tx.value().inputs(),
+              UnorderedElementsAreArray(
+                  {MakeMockTxInput(send_amount() + min_fee - 3000, 0),
+                   MakeMockTxInput(3000, 0)}));
+}
+
 TEST_F(BitcoinKnapsackSolverUnitTest, RandomTest) {
   std::vector<BitcoinTransaction::TxInputGroup> input_groups;
 
@@ -98,6 +98,9 @@ class BitcoinTestRpcServer {
   std::map<std::string, bitcoin_rpc::AddressStats>& address_stats_map() {
     return address_stats_map_;
   }
+  std::map<std::string, bitcoin_rpc::UnspentOutputs>& utxos_map() {
+    return utxos_map_;
+  }
 
   const std::string& captured_raw_tx() { return captured_raw_tx_; }
 
@@ -15,11 +15,13 @@
 
 #include "base/check.h"
 #include "base/check_op.h"
+#include "base/containers/map_util.h"
 #include "base/functional/bind.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/notreached.h"
 #include "base/rand_util.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
 #include "base/types/expected.h"
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_fetch_raw_transactions_task.h"
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_knapsack_solver.h"
@@ -210,9 +212,15 @@ class GetUtxosTask {
   void ScheduleWorkOnTask();
   void WorkOnTask();
   void MaybeSendRequests();
+  void OnGetAddressStats(
+      mojom::BitcoinAddressPtr address,
+      base::expected<bitcoin_rpc::AddressStats, std::string> stats);
   void OnGetUtxoList(
       mojom::BitcoinAddressPtr address,
+      std::string stats_fingerprint,
       base::expected<bitcoin_rpc::UnspentOutputs, std::string> utxos);
+  void OnAddressDone(const mojom::BitcoinAddressPtr& address,
+                     bitcoin_rpc::UnspentOutputs utxos);
 
   const raw_ref<BitcoinWalletService> bitcoin_wallet_service_;  // Owns `this`.
   std::string chain_id_;
@@ -262,23 +270,69 @@ void GetUtxosTask::MaybeSendRequests() {
   // increase privacy a bit.
   base::RandomShuffle(addresses_.begin(), addresses_.end());
 
+  // Address stats are much smaller than utxo lists of heavily used addresses,
+  // so those are fetched first and utxo lists are only requested for
+  // addresses with new activity.
   for (const auto& address_info : addresses_) {
-    bitcoin_wallet_service_->bitcoin_rpc().GetUtxoList(
+    bitcoin_wallet_service_->bitcoin_rpc().GetAddressStats(
         chain_id_, address_info->address_string,
-        base::BindOnce(&GetUtxosTask::OnGetUtxoList,
+        base::BindOnce(&GetUtxosTask::OnGetAddressStats,
                        weak_ptr_factory_.GetWeakPtr(), address_info->Clone()));
   }
 }
 
+void GetUtxosTask::OnGetAddressStats(
+    mojom::BitcoinAddressPtr address,
+    base::expected<bitcoin_rpc::AddressStats, std::string> stats) {
+  if (!stats.has_value()) {
+    error_ = stats.error();
+    return WorkOnTask();
+  }
+
+  const auto& chain = stats->chain_stats;
+  const auto& mempool = stats->mempool_stats;
+  if (chain.tx_count == "0" && mempool.tx_count == "0") {
+    return OnAddressDone(address, {});
+  }
+
+  auto stats_fingerprint = base::JoinString(
+      {chain.tx_count, chain.funded_txo_sum, chain.spent_txo_sum,
+       mempool.tx_count, mempool.funded_txo_sum, mempool.spent_txo_sum},
+      "/");
+  if (auto* cached = base::FindOrNull(
+          bitcoin_wallet_service_->utxo_cache_,
+          std::pair(chain_id_, address->address_string))) {
+    if (cached->stats_fingerprint == stats_fingerprint) {
+      return OnAddressDone(address, cached->utxos);
+    }
+  }
+
+  bitcoin_wallet_service_->bitcoin_rpc().GetUtxoList(
+      chain_id_, address->address_string,
+      base::BindOnce(&GetUtxosTask::OnGetUtxoList,
+                     weak_ptr_factory_.GetWeakPtr(), address.Clone(),
+                     std::move(stats_fingerprint)));
+}
+
 void GetUtxosTask::OnGetUtxoList(
     mojom::BitcoinAddressPtr address,
+    std::string stats_fingerprint,
     base::expected<bitcoin_rpc::UnspentOutputs, std::string> utxos) {
   if (!utxos.has_value()) {
     error_ = utxos.error();
     return WorkOnTask();
   }
 
-  utxos_[address->address_string] = std::move(utxos.value());
+  bitcoin_wallet_service_->utxo_cache_.insert_or_assign(
+      std::pair(chain_id_, address->address_string),
+      BitcoinWalletService::CachedUtxos{std::move(stats_fingerprint),
+                                        utxos.value()});
+  OnAddressDone(address, std::move(utxos.value()));
+}
+
+void GetUtxosTask::OnAddressDone(const mojom::BitcoinAddressPtr& address,
+                                 bitcoin_rpc::UnspentOutputs utxos) {
+  utxos_[address->address_string] = std::move(utxos);
 
   CHECK(std::erase(addresses_, address));
   if (addresses_.empty()) {
@@ -754,6 +808,7 @@ void BitcoinWalletService::Bind(
 
 void BitcoinWalletService::Reset() {
   weak_ptr_factory_.InvalidateWeakPtrs();
+  utxo_cache_.clear();
 }
 
 void BitcoinWalletService::GetBalance(mojom::AccountIdPtr account_id,
@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/memory/raw_ref.h"
@@ -130,6 +131,14 @@ class BitcoinWalletService : public mojom::BitcoinWalletService,
   using TaskContainer = absl::flat_hash_set<std::unique_ptr<T>>;
 
   friend CreateTransactionTask;
+  friend GetUtxosTask;
+
+  // Unspent outputs of an address along with a fingerprint of the address
+  // stats they were fetched for.
+  struct CachedUtxos {
+    std::string stats_fingerprint;
+    bitcoin_rpc::UnspentOutputs utxos;
+  };
 
   void OnRunDiscoveryDone(
       mojom::AccountIdPtr account_id,
@@ -202,6 +211,9 @@ class BitcoinWalletService : public mojom::BitcoinWalletService,
       discover_extended_key_account_tasks_;
   TaskContainer<FetchRawTransactionsTask> fetch_raw_transactions_tasks_;
 
+  // (chain_id, address) -> unspent outputs
+  std::map<std::pair<std::string, std::string>, CachedUtxos> utxo_cache_;
+
   mojo::ReceiverSet<mojom::BitcoinWalletService> receivers_;
   bitcoin_rpc::BitcoinRpc bitcoin_rpc_;
   bool arrange_transactions_for_testing_ = false;
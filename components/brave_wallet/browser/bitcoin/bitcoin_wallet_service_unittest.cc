@@ -331,6 +331,43 @@ TEST_F(BitcoinWalletServiceUnitTest, GetUtxos) {
   testing::Mock::VerifyAndClearExpectations(&callback);
 }
 
+TEST_F(BitcoinWalletServiceUnitTest, GetUtxos_RefetchesOnAddressActivity) {
+  SetupBtcAccount(5, 5);
+
+  using GetUtxosResult =
+      base::expected<BitcoinWalletService::UtxoMap, std::string>;
+  base::MockCallback<BitcoinWalletService::GetUtxosCallback> callback;
+  const auto& address_0 = bitcoin_test_rpc_server_->Address0()->address_string;
+
+  auto get_utxos_0 = [&] {
+    std::optional<bitcoin_rpc::UnspentOutputs> result;
+    EXPECT_CALL(callback, Run(Truly([&](const GetUtxosResult& arg) {
+                  EXPECT_TRUE(arg.has_value());
+                  result = arg.value().at(address_0);
+                  return true;
+                })));
+    bitcoin_wallet_service_->GetUtxos(account_id(), callback.Get());
+    task_environment_.RunUntilIdle();
+    testing::Mock::VerifyAndClearExpectations(&callback);
+    return result.value();
+  };
+
+  auto utxos = get_utxos_0();
+  ASSERT_EQ(utxos.size(), 1u);
+  EXPECT_EQ(utxos[0].txid, kMockBtcTxid1);
+
+  // Address stats did not change, so the cached utxo list is used.
+  auto& server_utxos = bitcoin_test_rpc_server_->utxos_map()[address_0];
+  server_utxos.push_back(server_utxos[0]);
+  server_utxos.back().vout = "2";
+  EXPECT_EQ(get_utxos_0(), utxos);
+
+  // New mempool transaction for the address.
+  bitcoin_test_rpc_server_->address_stats_map()[address_0]
+      .mempool_stats.tx_count = "2";
+  EXPECT_EQ(get_utxos_0(), server_utxos);
+}
+
 TEST_F(BitcoinWalletServiceUnitTest, CreateTransaction_UpdatesChangeAddress) {
   SetupBtcAccount(5, 5);
 
@@ -5,32 +5,92 @@
 
 #include "brave/components/brave_wallet/browser/block_tracker.h"
 
+#include <utility>
+#include <vector>
+
 #include "base/containers/map_util.h"
-#include "brave/components/brave_wallet/browser/json_rpc_service.h"
+#include "base/functional/bind.h"
+#include "base/location.h"
 
 namespace brave_wallet {
 
+BlockTracker::PollGroup::PollGroup() = default;
+
+BlockTracker::PollGroup::~PollGroup() = default;
+
 BlockTracker::BlockTracker() = default;
 
 BlockTracker::~BlockTracker() = default;
 
+void BlockTracker::StartPolling(const std::string& chain_id,
+                                base::TimeDelta interval,
+                                base::RepeatingClosure poll) {
+  if (auto* current_interval = base::FindOrNull(chain_intervals_, chain_id);
+      current_interval && *current_interval != interval) {
+    Stop(chain_id);
+  }
+  chain_intervals_[chain_id] = interval;
+
+  auto& group = poll_groups_[interval];
+  if (!group) {
+    group = std::make_unique<PollGroup>();
+  }
+  group->polls.insert_or_assign(chain_id, std::move(poll));
+
+  // A chain joining a running group is polled on the group's next tick.
+  // Otherwise (re)starting a chain keeps the usual timer semantics, the first
+  // poll happens one interval from now.
+  if (group->polls.size() > 1 && group->timer.IsRunning()) {
+    return;
+  }
+  // Unretained is safe because the timer is owned by `this`.
+  group->timer.Start(FROM_HERE, interval,
+                     base::BindRepeating(&BlockTracker::OnPollGroupTimer,
+                                         base::Unretained(this), interval));
+}
+
+void BlockTracker::OnPollGroupTimer(base::TimeDelta interval) {
+  auto* group = base::FindPtrOrNull(poll_groups_, interval);
+  if (!group) {
+    return;
+  }
+  // Polls may stop chains synchronously, so callbacks are copied first.
+  std::vector<base::RepeatingClosure> polls;
+  for (const auto& [chain_id, poll] : group->polls) {
+    polls.push_back(poll);
+  }
+  for (const auto& poll : polls) {
+    poll.Run();
+  }
+}
+
 void BlockTracker::Stop(const std::string& chain_id) {
-  auto timer = timers_.find(chain_id);
-  if (timer != timers_.end()) {
-    timers_.erase(timer);
+  auto interval = chain_intervals_.extract(chain_id);
+  if (interval.empty()) {
+    return;
+  }
+  auto group = poll_groups_.find(interval.mapped());
+  if (group == poll_groups_.end()) {
+    return;
+  }
+  group->second->polls.erase(chain_id);
+  if (group->second->polls.empty()) {
+    poll_groups_.erase(group);
   }
 }
 
 void BlockTracker::Stop() {
-  timers_.clear();
+  chain_intervals_.clear();
+  poll_groups_.clear();
 }
 
 bool BlockTracker::IsRunning(const std::string& chain_id) const {
-  auto* timer = base::FindPtrOrNull(timers_, chain_id);
-  if (!timer) {
+  auto* interval = base::FindOrNull(chain_intervals_, chain_id);
+  if (!interval) {
     return false;
   }
-  return timer->IsRunning();
+  auto* group = base::FindPtrOrNull(poll_groups_, *interval);
+  return group && group->timer.IsRunning();
 }
 
 }  // namespace brave_wallet
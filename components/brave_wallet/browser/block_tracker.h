@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 
+#include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
 #include "base/time/time.h"
 #include "base/timer/timer.h"
@@ -27,8 +28,29 @@ class BlockTracker {
   bool IsRunning(const std::string& chain_id) const;
 
  protected:
-  // <chain_id, timer>
-  std::map<std::string, std::unique_ptr<base::RepeatingTimer>> timers_;
+  // Runs `poll` every `interval` for `chain_id` until it is stopped. Chains
+  // polled with the same interval share a single timer so their requests go
+  // out together instead of waking up at unrelated times.
+  void StartPolling(const std::string& chain_id,
+                    base::TimeDelta interval,
+                    base::RepeatingClosure poll);
+
+ private:
+  struct PollGroup {
+    PollGroup();
+    ~PollGroup();
+
+    base::RepeatingTimer timer;
+    // <chain_id, poll callback>
+    std::map<std::string, base::RepeatingClosure> polls;
+  };
+
+  void OnPollGroupTimer(base::TimeDelta interval);
+
+  // <interval, group of chains polled with it>
+  std::map<base::TimeDelta, std::unique_ptr<PollGroup>> poll_groups_;
+  // <chain_id, interval>
+  std::map<std::string, base::TimeDelta> chain_intervals_;
 };
 
 }  // namespace brave_wallet
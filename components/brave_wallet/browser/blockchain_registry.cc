@@ -263,12 +263,30 @@ void BlockchainRegistry::UpdateCoingeckoIdsMap(
 
 void BlockchainRegistry::UpdateTokenList(TokenListMap token_list_map) {
   token_list_map_ = std::move(token_list_map);
+  token_address_index_.clear();
+  for (const auto& [key, tokens] : token_list_map_) {
+    IndexTokenList(key);
+  }
 }
 
 void BlockchainRegistry::UpdateTokenList(
     const std::string& key,
     std::vector<mojom::BlockchainTokenPtr> list) {
   token_list_map_[key] = std::move(list);
+  IndexTokenList(key);
+}
+
+void BlockchainRegistry::IndexTokenList(const std::string& key) {
+  const auto& tokens = token_list_map_[key];
+  std::vector<std::pair<std::string, size_t>> index;
+  index.reserve(tokens.size());
+  for (size_t i = 0; i < tokens.size(); ++i) {
+    index.emplace_back(tokens[i]->contract_address, i);
+  }
+  // The first token is kept when an address is listed more than once, the
+  // same one a linear search would find.
+  token_address_index_[key] =
+      base::flat_map<std::string, size_t>(std::move(index));
 }
 
 void BlockchainRegistry::UpdateChainList(ChainList chains) {
@@ -312,16 +330,14 @@ mojom::BlockchainTokenPtr BlockchainRegistry::GetTokenByAddress(
     mojom::CoinType coin,
     const std::string& address) {
   const auto key = GetTokenListKey(coin, chain_id);
-  if (!token_list_map_.contains(key)) {
+  const auto* tokens = base::FindOrNull(token_list_map_, key);
+  const auto* index = base::FindOrNull(token_address_index_, key);
+  if (!tokens || !index) {
     return nullptr;
   }
 
-  const auto& tokens = token_list_map_[key];
-  auto token_it = std::ranges::find_if(
-      tokens, [&](const mojom::BlockchainTokenPtr& current_token) {
-        return current_token->contract_address == address;
-      });
-  return token_it == tokens.end() ? nullptr : token_it->Clone();
+  const auto* token_index = base::FindOrNull(*index, address);
+  return token_index ? (*tokens)[*token_index].Clone() : nullptr;
 }
 
 void BlockchainRegistry::GetTokenBySymbol(const std::string& chain_id,
@@ -547,6 +563,7 @@ bool BlockchainRegistry::IsEmptyForTesting() {
 void BlockchainRegistry::ResetForTesting() {
   coingecko_ids_map_.clear();
   token_list_map_.clear();
+  token_address_index_.clear();
   dapp_lists_.clear();
   on_ramp_token_lists_.clear();
   off_ramp_token_lists_.clear();
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/functional/bind.h"
 #include "base/sequence_checker.h"
 #include "base/task/thread_pool.h"
@@ -104,9 +105,15 @@ class BlockchainRegistry : public mojom::BlockchainRegistry {
   std::vector<brave_wallet::mojom::BlockchainTokenPtr> GetBuyTokens(
       const std::vector<mojom::OnRampProvider>& providers,
       const std::string& chain_id);
+  void IndexTokenList(const std::string& key);
 
   CoingeckoIdsMap coingecko_ids_map_;
   TokenListMap token_list_map_;
+  // <token list key, <contract address, index in the token list>>. Lists hold
+  // thousands of tokens and are looked up by address on every balance and
+  // transaction update, so lookups must not scan the whole list.
+  base::flat_map<std::string, base::flat_map<std::string, size_t>>
+      token_address_index_;
   ChainList chain_list_;
   DappListMap dapp_lists_;
   OnRampTokensListMap on_ramp_token_lists_;
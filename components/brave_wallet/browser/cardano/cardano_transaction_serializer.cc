@@ -12,6 +12,7 @@
 #include <utility>
 
 #include "base/check.h"
+#include "base/check_op.h"
 #include "base/numerics/checked_math.h"
 #include "base/numerics/safe_conversions.h"
 #include "brave/components/brave_wallet/browser/cardano/cardano_transaction.h"
@@ -37,6 +38,35 @@ int64_t AmountToInt64ForCbor(uint64_t amount) {
   return base::checked_cast<int64_t>(amount);
 }
 
+// Size of the CBOR head (initial byte plus argument) for an unsigned integer
+// or a length.
+// https://www.rfc-editor.org/rfc/rfc8949.html#section-3
+size_t CborHeadSize(uint64_t value) {
+  if (value < 24) {
+    return 1;
+  }
+  if (value <= std::numeric_limits<uint8_t>::max()) {
+    return 2;
+  }
+  if (value <= std::numeric_limits<uint16_t>::max()) {
+    return 3;
+  }
+  if (value <= std::numeric_limits<uint32_t>::max()) {
+    return 5;
+  }
+  return 9;
+}
+
+size_t CborByteStringSize(size_t length) {
+  return CborHeadSize(length) + length;
+}
+
+// Size of a serialized [pubkey, signature] verification key witness.
+size_t CborVkWitnessSize() {
+  return CborHeadSize(2) + CborByteStringSize(kEd25519PublicKeySize) +
+         CborByteStringSize(kCardanoWitnessSize - kEd25519PublicKeySize);
+}
+
 }  // namespace
 
 CardanoTransactionSerializer::CardanoTransactionSerializer() = default;
@@ -63,13 +93,7 @@ cbor::Value::ArrayValue CardanoTransactionSerializer::SerializeOutput(
   cbor::Value::ArrayValue output_value;
   output_value.emplace_back(output.address.ToCborBytes());
 
-  bool serialize_as_max_value =
-      (output.type == CardanoTransaction::TxOutputType::kTarget &&
-       options_.max_value_for_target_output) ||
-      (output.type == CardanoTransaction::TxOutputType::kChange &&
-       options_.max_value_for_change_output);
-
-  if (serialize_as_max_value) {
+  if (SerializeAsMaxValue(output)) {
     output_value.emplace_back(std::numeric_limits<int64_t>::max());
   } else {
     output_value.emplace_back(AmountToInt64ForCbor(output.amount));
@@ -140,6 +164,65 @@ cbor::Value CardanoTransactionSerializer::SerializeWitnessSet(
   return cbor::Value(witness_map);
 }
 
+bool CardanoTransactionSerializer::SerializeAsMaxValue(
+    const CardanoTransaction::TxOutput& output) const {
+  return (output.type == CardanoTransaction::TxOutputType::kTarget &&
+          options_.max_value_for_target_output) ||
+         (output.type == CardanoTransaction::TxOutputType::kChange &&
+          options_.max_value_for_change_output);
+}
+
+size_t CardanoTransactionSerializer::CalcInputsSize(
+    const CardanoTransaction& tx) const {
+  size_t size = CborHeadSize(tx.inputs().size());
+  for (const auto& input : tx.inputs()) {
+    size += CborHeadSize(2) +
+            CborByteStringSize(input.utxo_outpoint.txid.size()) +
+            CborHeadSize(input.utxo_outpoint.index);
+  }
+  return size;
+}
+
+size_t CardanoTransactionSerializer::CalcOutputSize(
+    const CardanoTransaction::TxOutput& output) const {
+  const uint64_t amount = SerializeAsMaxValue(output)
+                              ? std::numeric_limits<int64_t>::max()
+                              : AmountToInt64ForCbor(output.amount);
+  return CborHeadSize(2) +
+         CborByteStringSize(output.address.GetCborBytesSize()) +
+         CborHeadSize(amount);
+}
+
+size_t CardanoTransactionSerializer::CalcOutputsSize(
+    const CardanoTransaction& tx) const {
+  size_t size = CborHeadSize(tx.outputs().size());
+  for (const auto& output : tx.outputs()) {
+    size += CalcOutputSize(output);
+  }
+  return size;
+}
+
+size_t CardanoTransactionSerializer::CalcTxBodySize(
+    const CardanoTransaction& tx) const {
+  const uint64_t fee = options_.max_value_for_fee
+                           ? std::numeric_limits<int64_t>::max()
+                           : AmountToInt64ForCbor(tx.EffectiveFeeAmount());
+  // Map of 4 entries keyed 0 to 3, each key taking a single byte.
+  return CborHeadSize(4) + 4 * CborHeadSize(0) + CalcInputsSize(tx) +
+         CalcOutputsSize(tx) + CborHeadSize(fee) +
+         CborHeadSize(tx.invalid_after());
+}
+
+size_t CardanoTransactionSerializer::CalcWitnessSetSize(
+    const CardanoTransaction& tx) const {
+  const size_t witness_count = options_.use_dummy_witness_set
+                                   ? tx.inputs().size()
+                                   : tx.witnesses().size();
+  // Map with a single entry, keyed 0, holding the vk witness array.
+  return CborHeadSize(1) + CborHeadSize(0) + CborHeadSize(witness_count) +
+         witness_count * CborVkWitnessSize();
+}
+
 std::vector<uint8_t> CardanoTransactionSerializer::SerializeTransaction(
     const CardanoTransaction& tx) {
   // https://github.com/input-output-hk/cardano-js-sdk/blob/5bc90ee9f24d89db6ea4191d705e7383d52fef6a/packages/core/src/Serialization/Transaction.ts#L59-L84
@@ -154,12 +237,17 @@ std::vector<uint8_t> CardanoTransactionSerializer::SerializeTransaction(
   std::optional<std::vector<uint8_t>> cbor_bytes =
       cbor::Writer::Write(cbor::Value(std::move(transaction_array)));
   CHECK(cbor_bytes);
+  DCHECK_EQ(cbor_bytes->size(), CalcTransactionSize(tx));
   return *cbor_bytes;
 }
 
 uint32_t CardanoTransactionSerializer::CalcTransactionSize(
     const CardanoTransaction& tx) {
-  return SerializeTransaction(tx).size();
+  // Array of body, witness set, valid flag and auxiliary data, where the
+  // last two are single byte simple values.
+  size_t size =
+      CborHeadSize(4) + CalcTxBodySize(tx) + CalcWitnessSetSize(tx) + 1 + 1;
+  return base::checked_cast<uint32_t>(size);
 }
 
 std::array<uint8_t, kCardanoTxHashSize> CardanoTransactionSerializer::GetTxHash(
@@ -182,14 +270,13 @@ uint64_t CardanoTransactionSerializer::CalcMinTransactionFee(
 std::optional<uint64_t> CardanoTransactionSerializer::CalcRequiredCoin(
     const CardanoTransaction::TxOutput& output,
     const cardano_rpc::EpochParameters& epoch_parameters) {
-  auto cbor_bytes = cbor::Writer::Write(
-      cbor::Value(CardanoTransactionSerializer().SerializeOutput(output)));
-  CHECK(cbor_bytes);
+  const size_t output_size =
+      CardanoTransactionSerializer().CalcOutputSize(output);
 
   uint64_t required_coin = 0;
   if (!base::CheckMul<uint64_t>(
            epoch_parameters.coins_per_utxo_size,
-           base::CheckAdd<uint64_t>(cbor_bytes->size(),
+           base::CheckAdd<uint64_t>(output_size,
                                     kMinAdaUtxoConstantOverhead))
            .AssignIfValid(&required_coin)) {
     return std::nullopt;
@@ -37,7 +37,8 @@ class CardanoTransactionSerializer {
   // Serializes a Cardano transaction into a byte vector (CBOR format).
   std::vector<uint8_t> SerializeTransaction(const CardanoTransaction& tx);
 
-  // Calculates the size (in bytes) of the serialized transaction.
+  // Calculates the size (in bytes) of the serialized transaction. The size is
+  // computed from the CBOR encoding rules without serializing anything.
   uint32_t CalcTransactionSize(const CardanoTransaction& tx);
 
   // Computes the transaction hash (Blake2b-256 hash of the serialized
@@ -69,6 +70,15 @@ class CardanoTransactionSerializer {
   cbor::Value SerializeTxBody(const CardanoTransaction& tx);
   cbor::Value SerializeWitnessSet(const CardanoTransaction& tx);
 
+  bool SerializeAsMaxValue(const CardanoTransaction::TxOutput& output) const;
+
+  // Serialized sizes matching the Serialize* methods above.
+  size_t CalcInputsSize(const CardanoTransaction& tx) const;
+  size_t CalcOutputSize(const CardanoTransaction::TxOutput& output) const;
+  size_t CalcOutputsSize(const CardanoTransaction& tx) const;
+  size_t CalcTxBodySize(const CardanoTransaction& tx) const;
+  size_t CalcWitnessSetSize(const CardanoTransaction& tx) const;
+
   std::optional<uint64_t> CalcRequiredCoin(
       const CardanoTransaction::TxOutput& output,
       const cardano_rpc::EpochParameters& epoch_parameters);
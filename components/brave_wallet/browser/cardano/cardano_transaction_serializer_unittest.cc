@@ -213,6 +213,26 @@ TEST(CardanoTransactionSerializerTest, CalcTransactionSize) {
       155u);
 }
 
+TEST(CardanoTransactionSerializerTest, CalcTransactionSizeMatchesSerialized) {
+  auto tx = GetReferenceTransaction();
+  CardanoTransaction::TxInput input;
+  input.utxo_outpoint.index = 70000;
+  input.utxo_value = 5000000000;
+  tx.AddInput(std::move(input));
+
+  for (bool max_value : {false, true}) {
+    for (bool dummy_witness_set : {false, true}) {
+      CardanoTransactionSerializer serializer(
+          {.max_value_for_target_output = max_value,
+           .max_value_for_change_output = max_value,
+           .max_value_for_fee = max_value,
+           .use_dummy_witness_set = dummy_witness_set});
+      EXPECT_EQ(serializer.CalcTransactionSize(tx),
+                serializer.SerializeTransaction(tx).size());
+    }
+  }
+}
+
 TEST(CardanoTransactionSerializerTest, GetTxHash) {
   EXPECT_EQ(base::HexEncodeLower(CardanoTransactionSerializer().GetTxHash(
                 GetReferenceTransaction())),
@@ -108,13 +108,10 @@ std::optional<DecoderResult<M>> GetUintFromData(ByteView input) {
     return std::nullopt;
   }
 
-  uint256_t value;
-  // TODO(apaymyshev): we don't need string in this bytes->string->bytes
-  // conversion here.
-  if (!HexValueToUint256(
-          base::StrCat({"0x", base::HexEncodeLower(input.first(kWordSize))}),
-          &value)) {
-    return std::nullopt;
+  // Words are big endian.
+  uint256_t value = 0;
+  for (uint8_t byte : input.first(kWordSize)) {
+    value = (value << 8) | byte;
   }
 
   // To prevent runtime errors, we make sure the value is within safe
@@ -161,7 +158,7 @@ std::optional<DecoderResult<base::Value>> GetBoolFromData(ByteView input) {
   return std::nullopt;
 }
 
-// GetBytesHexFromData extracts a bytes value from the calldata segment using
+// GetBytesFromData extracts a bytes value from the calldata segment using
 // head-tail encoding mechanism. bytes are packed in chunks of 32 bytes, with
 // the first 32 bytes encoding the length, followed by the actual content.
 //
@@ -169,8 +166,8 @@ std::optional<DecoderResult<base::Value>> GetBoolFromData(ByteView input) {
 // If the Type::m property is set, it indicates a fixed-size bytes<M> type,
 // where 0 < M <= 32, otherwise it indicates a dynamic bytes type.
 //
-// The result is serialized as a hex string prefixed by "0x".
-std::optional<DecoderResult<base::Value>> GetBytesHexFromData(
+// The result is a view into the calldata.
+std::optional<DecoderResult<ByteView>> GetBytesFromData(
     const eth_abi::Type& type,
     ByteView input) {
   size_t size = type.m.value_or(0);
@@ -201,10 +198,24 @@ std::optional<DecoderResult<base::Value>> GetBytesHexFromData(
   }
 
   size_t parts_size = parts_count * kWordSize;
+  return DecoderResult<ByteView>(remaining.first(size),
+                                 GetSubByteView(remaining, parts_size),
+                                 consumed + parts_size);
+}
+
+// GetBytesHexFromData serializes the result of GetBytesFromData as a hex
+// string prefixed by "0x".
+std::optional<DecoderResult<base::Value>> GetBytesHexFromData(
+    const eth_abi::Type& type,
+    ByteView input) {
+  auto result = GetBytesFromData(type, input);
+  if (!result) {
+    return std::nullopt;
+  }
+
   return DecoderResult<base::Value>(
-      base::Value(
-          base::StrCat({"0x", base::HexEncodeLower(remaining.first(size))})),
-      GetSubByteView(remaining, parts_size), consumed + parts_size);
+      base::Value(base::StrCat({"0x", base::HexEncodeLower(result->result)})),
+      result->remaining, result->consumed);
 }
 
 // GetStringFromData extracts a string value from the calldata segment using
@@ -212,23 +223,14 @@ std::optional<DecoderResult<base::Value>> GetBytesHexFromData(
 // with the first 32 bytes encoding the length, followed by the actual content.
 std::optional<DecoderResult<base::Value>> GetStringFromData(ByteView input) {
   // Extract the string value from the calldata as dynamic bytes
-  auto bytes_result = GetBytesHexFromData(eth_abi::Bytes(), input);
+  auto bytes_result = GetBytesFromData(eth_abi::Bytes(), input);
   if (!bytes_result) {
     return std::nullopt;
   }
 
-  auto& bytes_value = bytes_result->result;
-  if (!bytes_value.is_string()) {
-    return std::nullopt;
-  }
-
-  std::string result;
-  if (base::HexStringToString(bytes_value.GetString().substr(2), &result)) {
-    return DecoderResult<base::Value>(
-        base::Value(result), bytes_result->remaining, bytes_result->consumed);
-  }
-
-  return std::nullopt;
+  return DecoderResult<base::Value>(
+      base::Value(std::string(base::as_string_view(bytes_result->result))),
+      bytes_result->remaining, bytes_result->consumed);
 }
 
 // Forward declarations for recursive functions.
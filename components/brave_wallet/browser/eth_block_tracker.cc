@@ -5,7 +5,6 @@
 
 #include "brave/components/brave_wallet/browser/eth_block_tracker.h"
 
-#include <memory>
 #include <utility>
 
 #include "base/containers/map_util.h"
@@ -22,12 +21,7 @@ EthBlockTracker::~EthBlockTracker() = default;
 
 void EthBlockTracker::Start(const std::string& chain_id,
                             base::TimeDelta interval) {
-  auto& timer = timers_[chain_id];
-  if (!timer) {
-    timer = std::make_unique<base::RepeatingTimer>();
-  }
-
-  timer->Start(FROM_HERE, interval,
+  StartPolling(chain_id, interval,
                base::BindRepeating(&EthBlockTracker::GetBlockNumber,
                                    weak_factory_.GetWeakPtr(), chain_id));
 }
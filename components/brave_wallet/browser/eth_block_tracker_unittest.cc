@@ -113,6 +113,34 @@ TEST_F(EthBlockTrackerUnitTest, Timer) {
   EXPECT_FALSE(request_sent);
 }
 
+TEST_F(EthBlockTrackerUnitTest, SharesTimerAcrossChains) {
+  EthBlockTracker tracker(json_rpc_service_.get());
+  size_t requests_count = 0;
+  url_loader_factory_.SetInterceptor(
+      base::BindLambdaForTesting([&](const network::ResourceRequest& request) {
+        requests_count++;
+        url_loader_factory_.ClearResponses();
+        url_loader_factory_.AddResponse(request.url.spec(),
+                                        GetResponseString());
+      }));
+
+  tracker.Start(mojom::kMainnetChainId, base::Seconds(5));
+  task_environment_.FastForwardBy(base::Seconds(3));
+  // Joins the running timer, so both chains are polled together.
+  tracker.Start(mojom::kSepoliaChainId, base::Seconds(5));
+  task_environment_.FastForwardBy(base::Seconds(2));
+  EXPECT_EQ(requests_count, 2u);
+  task_environment_.FastForwardBy(base::Seconds(5));
+  EXPECT_EQ(requests_count, 4u);
+
+  // Stopping one chain keeps polling the other one.
+  tracker.Stop(mojom::kMainnetChainId);
+  EXPECT_FALSE(tracker.IsRunning(mojom::kMainnetChainId));
+  EXPECT_TRUE(tracker.IsRunning(mojom::kSepoliaChainId));
+  task_environment_.FastForwardBy(base::Seconds(5));
+  EXPECT_EQ(requests_count, 5u);
+}
+
 TEST_F(EthBlockTrackerUnitTest, GetBlockNumber) {
   EthBlockTracker tracker(json_rpc_service_.get());
   url_loader_factory_.SetInterceptor(
@@ -5,14 +5,55 @@
 
 #include "brave/components/brave_wallet/browser/eth_logs_tracker.h"
 
+#include <algorithm>
+#include <optional>
+#include <set>
 #include <string>
 #include <utility>
 
 #include "base/check.h"
+#include "base/containers/map_util.h"
+#include "base/json/json_writer.h"
 #include "base/logging.h"
+#include "base/strings/string_util.h"
 
 namespace brave_wallet {
 
+namespace {
+
+// Lowercase contract addresses the filter is restricted to, or nullopt if it
+// matches logs of any contract.
+std::optional<std::set<std::string>> GetFilterAddresses(
+    const base::Value::Dict& filter) {
+  const auto* address = filter.Find("address");
+  if (!address) {
+    return std::nullopt;
+  }
+  std::set<std::string> addresses;
+  if (address->is_string()) {
+    addresses.insert(base::ToLowerASCII(address->GetString()));
+  } else if (address->is_list()) {
+    for (const auto& item : address->GetList()) {
+      if (!item.is_string()) {
+        return std::nullopt;
+      }
+      addresses.insert(base::ToLowerASCII(item.GetString()));
+    }
+  } else {
+    return std::nullopt;
+  }
+  return addresses;
+}
+
+// Subscriptions sharing all filter fields but the contract addresses.
+struct LogsRequest {
+  base::Value::Dict filter;
+  std::vector<std::string> subscriptions;
+  std::optional<std::set<std::string>> addresses;
+};
+
+}  // namespace
+
 EthLogsTracker::EthLogsTracker(JsonRpcService* json_rpc_service)
     : json_rpc_service_(json_rpc_service) {
   DCHECK(json_rpc_service_);
@@ -22,6 +63,10 @@ EthLogsTracker::~EthLogsTracker() = default;
 
 void EthLogsTracker::Start(const std::string& chain_id,
                            base::TimeDelta interval) {
+  if (chain_id != chain_id_) {
+    chain_id_ = chain_id;
+    delivered_blocks_.clear();
+  }
   timer_.Start(FROM_HERE, interval,
                base::BindRepeating(&EthLogsTracker::GetLogs,
                                    weak_factory_.GetWeakPtr(), chain_id));
@@ -43,6 +88,7 @@ void EthLogsTracker::AddSubscriber(const std::string& subscription_id,
 
 void EthLogsTracker::RemoveSubscriber(const std::string& subscription_id) {
   eth_logs_subscription_info_.erase(subscription_id);
+  delivered_blocks_.erase(subscription_id);
 }
 
 void EthLogsTracker::AddObserver(EthLogsTracker::Observer* observer) {
@@ -54,25 +100,98 @@ void EthLogsTracker::RemoveObserver(EthLogsTracker::Observer* observer) {
 }
 
 void EthLogsTracker::GetLogs(const std::string& chain_id) {
-  for (auto const& esi : std::as_const(eth_logs_subscription_info_)) {
+  // Subscriptions which only differ by contract addresses are merged into a
+  // single eth_getLogs call, logs are routed back by address on response.
+  std::map<std::string, LogsRequest> requests;
+  for (const auto& [subscription, filter] : eth_logs_subscription_info_) {
+    auto addresses = GetFilterAddresses(filter);
+    base::Value::Dict key_filter = filter.Clone();
+    key_filter.Remove("address");
+    std::string key;
+    base::JSONWriter::Write(key_filter, &key);
+
+    auto& request = requests[key];
+    if (request.subscriptions.empty()) {
+      request.filter = filter.Clone();
+      request.addresses = std::move(addresses);
+    } else if (request.addresses && addresses) {
+      request.addresses->insert(addresses->begin(), addresses->end());
+    } else {
+      request.addresses = std::nullopt;
+    }
+    request.subscriptions.push_back(subscription);
+  }
+
+  for (auto& [key, request] : requests) {
+    const bool merged = request.subscriptions.size() > 1;
+    if (merged) {
+      request.filter.Remove("address");
+      if (request.addresses) {
+        base::Value::List addresses;
+        for (const auto& address : *request.addresses) {
+          addresses.Append(address);
+        }
+        request.filter.Set("address", std::move(addresses));
+      }
+    }
     json_rpc_service_->EthGetLogs(
-        chain_id, esi.second.Clone(),
+        chain_id, std::move(request.filter),
         base::BindOnce(&EthLogsTracker::OnGetLogs, weak_factory_.GetWeakPtr(),
-                       esi.first));
+                       std::move(request.subscriptions), merged));
   }
 }
 
-void EthLogsTracker::OnGetLogs(const std::string& subscription,
-                               [[maybe_unused]] const std::vector<Log>& logs,
+void EthLogsTracker::OnGetLogs(const std::vector<std::string>& subscriptions,
+                               bool merged,
+                               const std::vector<Log>& logs,
                                base::Value rawlogs,
                                mojom::ProviderError error,
                                const std::string& error_message) {
-  if (error == mojom::ProviderError::kSuccess && rawlogs.is_dict()) {
+  const base::Value::List* results =
+      rawlogs.is_dict() ? rawlogs.GetDict().FindList("result") : nullptr;
+  if (error != mojom::ProviderError::kSuccess || !results ||
+      results->size() != logs.size()) {
+    LOG(ERROR) << "OnGetLogs failed";
+    return;
+  }
+
+  // Every subscription gets the response with only its own logs.
+  base::Value::Dict response = rawlogs.GetDict().Clone();
+  response.Remove("result");
+
+  for (const auto& subscription : subscriptions) {
+    const auto* filter =
+        base::FindOrNull(eth_logs_subscription_info_, subscription);
+    if (!filter) {
+      continue;
+    }
+    const auto addresses = merged ? GetFilterAddresses(*filter) : std::nullopt;
+    auto* delivered_block = base::FindOrNull(delivered_blocks_, subscription);
+    uint256_t max_block = delivered_block ? *delivered_block : 0;
+
+    base::Value::List subscription_results;
+    for (size_t i = 0; i < logs.size(); ++i) {
+      const auto& log = logs[i];
+      if (addresses && !addresses->contains(base::ToLowerASCII(log.address))) {
+        continue;
+      }
+      if (delivered_block && log.block_number <= *delivered_block &&
+          !log.removed) {
+        continue;
+      }
+      max_block = std::max(max_block, log.block_number);
+      subscription_results.Append((*results)[i].Clone());
+    }
+    if (subscription_results.empty()) {
+      continue;
+    }
+    delivered_blocks_[subscription] = max_block;
+
+    base::Value subscription_logs(
+        response.Clone().Set("result", std::move(subscription_results)));
     for (auto& observer : observers_) {
-      observer.OnLogsReceived(subscription, rawlogs.Clone());
+      observer.OnLogsReceived(subscription, subscription_logs.Clone());
     }
-  } else {
-    LOG(ERROR) << "OnGetLogs failed";
   }
 }
 
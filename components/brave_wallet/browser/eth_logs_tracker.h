@@ -53,7 +53,8 @@ class EthLogsTracker {
 
  private:
   void GetLogs(const std::string& chain_id);
-  void OnGetLogs(const std::string& subscription,
+  void OnGetLogs(const std::vector<std::string>& subscriptions,
+                 bool merged,
                  const std::vector<Log>& logs,
                  base::Value rawlogs,
                  mojom::ProviderError error,
@@ -61,8 +62,13 @@ class EthLogsTracker {
 
   base::RepeatingTimer timer_;
   raw_ptr<JsonRpcService> json_rpc_service_ = nullptr;
+  std::string chain_id_;
 
   std::map<std::string, base::Value::Dict> eth_logs_subscription_info_;
+  // <subscription_id, highest block number of the logs already delivered>.
+  // Polls keep returning the logs of the latest block until a new one is
+  // mined, those are only delivered once.
+  std::map<std::string, uint256_t> delivered_blocks_;
 
   base::ObserverList<Observer> observers_;
 
@@ -7,8 +7,10 @@
 
 #include <algorithm>
 #include <utility>
+#include <vector>
 
 #include "base/check.h"
+#include "base/containers/flat_set.h"
 #include "base/functional/bind.h"
 #include "brave/components/brave_wallet/browser/eth_tx_meta.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
@@ -48,14 +50,22 @@ uint256_t EthNonceTracker::GetHighestLocallyConfirmed(
 uint256_t EthNonceTracker::GetHighestContinuousFrom(
     const std::vector<std::unique_ptr<TxMeta>>& metas,
     uint256_t start) {
-  uint256_t highest = start;
+  // Pending transactions are not stored in nonce order, so collect the
+  // nonces first; otherwise a gap-free run submitted out of order would be
+  // cut short and an in-use nonce handed out again.
+  std::vector<uint256_t> nonces;
+  nonces.reserve(metas.size());
   for (auto& meta : metas) {
     auto* eth_meta = static_cast<EthTxMeta*>(meta.get());
     DCHECK(
         eth_meta->tx()->nonce());  // Not supposed to happen for a submitted tx.
-    if (eth_meta->tx()->nonce().value() == highest) {
-      highest++;
-    }
+    nonces.push_back(eth_meta->tx()->nonce().value());
+  }
+  const base::flat_set<uint256_t> pending_nonces(std::move(nonces));
+
+  uint256_t highest = start;
+  while (pending_nonces.contains(highest)) {
+    highest++;
   }
   return highest;
 }
@@ -169,6 +169,17 @@ TEST_F(EthNonceTrackerUnitTest, GetNonce) {
 
   GetNextNonce(&nonce_tracker, mojom::kLocalhostChainId, eth_acc, true, 5);
 
+  // tx count: 2, confirmed: [2, 3], pending: [4, 4, 6, 5], sign: [5]
+  meta.set_status(mojom::TransactionStatus::Submitted);
+  meta.tx()->set_nonce(uint256_t(6));
+  meta.set_id(TxMeta::GenerateMetaID());
+  ASSERT_TRUE(tx_state_manager.AddOrUpdateTx(meta));
+  meta.tx()->set_nonce(uint256_t(5));
+  meta.set_id(TxMeta::GenerateMetaID());
+  ASSERT_TRUE(tx_state_manager.AddOrUpdateTx(meta));
+
+  GetNextNonce(&nonce_tracker, mojom::kLocalhostChainId, eth_acc, true, 7);
+
   // tx count: 2, confirmed: null, pending: null (mainnet)
   GetNextNonce(&nonce_tracker, mojom::kMainnetChainId, eth_acc, true, 2);
 }
@@ -7,9 +7,12 @@
 
 #include <memory>
 #include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "base/check.h"
+#include "base/containers/flat_map.h"
 #include "base/containers/map_util.h"
 #include "brave/components/brave_wallet/browser/eth_nonce_tracker.h"
 #include "brave/components/brave_wallet/browser/eth_tx_meta.h"
@@ -40,12 +43,27 @@ bool EthPendingTxTracker::UpdatePendingTransactions(
       pending_transactions.end(),
       std::make_move_iterator(signed_transactions.begin()),
       std::make_move_iterator(signed_transactions.end()));
+  // Confirmed transactions are loaded once per chain rather than once per
+  // pending transaction.
+  base::flat_map<std::string, std::vector<std::unique_ptr<TxMeta>>>
+      confirmed_transactions;
   for (const auto& pending_transaction : pending_transactions) {
-    if (IsNonceTaken(static_cast<const EthTxMeta&>(*pending_transaction))) {
+    const auto& pending_chain_id = pending_transaction->chain_id();
+    auto confirmed_it = confirmed_transactions.find(pending_chain_id);
+    if (confirmed_it == confirmed_transactions.end()) {
+      confirmed_it =
+          confirmed_transactions
+              .emplace(pending_chain_id,
+                       tx_state_manager_->GetTransactionsByStatus(
+                           pending_chain_id,
+                           mojom::TransactionStatus::Confirmed, std::nullopt))
+              .first;
+    }
+    if (IsNonceTaken(static_cast<const EthTxMeta&>(*pending_transaction),
+                     confirmed_it->second)) {
       DropTransaction(pending_transaction.get());
       continue;
     }
-    const auto& pending_chain_id = pending_transaction->chain_id();
     pending_chain_ids->emplace(pending_chain_id);
     std::string id = pending_transaction->id();
     json_rpc_service_->GetTransactionReceipt(
@@ -59,6 +77,7 @@ bool EthPendingTxTracker::UpdatePendingTransactions(
 
 void EthPendingTxTracker::Reset() {
   network_nonce_map_.clear();
+  pending_network_nonce_queries_.clear();
   dropped_blocks_counter_.clear();
 }
 
@@ -89,6 +108,7 @@ void EthPendingTxTracker::OnGetNetworkNonce(const std::string& chain_id,
                                             uint256_t result,
                                             mojom::ProviderError error,
                                             const std::string& error_message) {
+  pending_network_nonce_queries_.erase({address, chain_id});
   if (error != mojom::ProviderError::kSuccess) {
     return;
   }
@@ -102,8 +122,15 @@ void EthPendingTxTracker::OnSendRawTransaction(
     const std::string& error_message) {}
 
 bool EthPendingTxTracker::IsNonceTaken(const EthTxMeta& meta) {
-  auto confirmed_transactions = tx_state_manager_->GetTransactionsByStatus(
-      meta.chain_id(), mojom::TransactionStatus::Confirmed, std::nullopt);
+  return IsNonceTaken(
+      meta, tx_state_manager_->GetTransactionsByStatus(
+                meta.chain_id(), mojom::TransactionStatus::Confirmed,
+                std::nullopt));
+}
+
+bool EthPendingTxTracker::IsNonceTaken(
+    const EthTxMeta& meta,
+    const std::vector<std::unique_ptr<TxMeta>>& confirmed_transactions) {
   for (const auto& confirmed_transaction : confirmed_transactions) {
     auto* eth_confirmed_transaction =
         static_cast<EthTxMeta*>(confirmed_transaction.get());
@@ -122,10 +149,12 @@ bool EthPendingTxTracker::ShouldTxDropped(const EthTxMeta& meta) {
       base::FindOrNull(network_nonce_map_, address);
   if (!network_nonce_map_per_chain_id ||
       !network_nonce_map_per_chain_id->contains(chain_id)) {
-    json_rpc_service_->GetEthTransactionCount(
-        chain_id, address,
-        base::BindOnce(&EthPendingTxTracker::OnGetNetworkNonce,
-                       weak_factory_.GetWeakPtr(), chain_id, address));
+    if (pending_network_nonce_queries_.emplace(address, chain_id).second) {
+      json_rpc_service_->GetEthTransactionCount(
+          chain_id, address,
+          base::BindOnce(&EthPendingTxTracker::OnGetNetworkNonce,
+                         weak_factory_.GetWeakPtr(), chain_id, address));
+    }
   } else {
     uint256_t network_nonce = network_nonce_map_[address][chain_id];
     network_nonce_map_per_chain_id->erase(chain_id);
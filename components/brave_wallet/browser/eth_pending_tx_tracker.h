@@ -7,9 +7,12 @@
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_ETH_PENDING_TX_TRACKER_H_
 
 #include <map>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/gtest_prod_util.h"
@@ -57,6 +60,9 @@ class EthPendingTxTracker {
                             const std::string& error_message);
 
   bool IsNonceTaken(const EthTxMeta&);
+  bool IsNonceTaken(
+      const EthTxMeta&,
+      const std::vector<std::unique_ptr<TxMeta>>& confirmed_transactions);
   bool ShouldTxDropped(const EthTxMeta&);
 
   void DropTransaction(TxMeta*);
@@ -64,6 +70,9 @@ class EthPendingTxTracker {
   // (address, (chain_id, nonce))
   base::flat_map<std::string, std::map<std::string, uint256_t>>
       network_nonce_map_;
+  // (address, chain_id) of network nonce queries in flight, so that pending
+  // transactions from the same sender share one query.
+  std::set<std::pair<std::string, std::string>> pending_network_nonce_queries_;
   // (txHash, count)
   base::flat_map<std::string, uint8_t> dropped_blocks_counter_;
 
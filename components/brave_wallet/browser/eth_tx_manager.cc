@@ -13,6 +13,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/barrier_callback.h"
 #include "base/check.h"
 #include "base/functional/bind.h"
 #include "base/strings/string_number_conversions.h"
@@ -206,21 +207,11 @@ void EthTxManager::AddUnapprovedTransaction(
   // as required by geth. This is typically the case with ETHSend.
   const std::string data = tx_data->data.empty() ? "" : ToHex(tx_data->data);
 
-  if (!tx_ptr->gas_price()) {
-    json_rpc_service_->GetGasPrice(
-        chain_id,
-        base::BindOnce(&EthTxManager::OnGetGasPrice, weak_factory_.GetWeakPtr(),
-                       chain_id, from.Clone(), origin, tx_data->to,
-                       tx_data->value, data, gas_limit, std::move(tx_ptr),
-                       std::move(callback), tx_data->sign_only));
-  } else if (!tx_ptr->gas_limit()) {
-    json_rpc_service_->GetEstimateGas(
-        chain_id, from->address, tx_data->to, "" /* gas */, "" /* gas_price */,
-        tx_data->value, data,
-        base::BindOnce(&EthTxManager::ContinueAddUnapprovedTransaction,
-                       weak_factory_.GetWeakPtr(), chain_id, from.Clone(),
-                       origin, std::move(tx_ptr), std::move(callback),
-                       tx_data->sign_only));
+  if (!tx_ptr->gas_price() || !tx_ptr->gas_limit()) {
+    RequestGasFieldsForUnapprovedTransaction(
+        chain_id, from, origin, tx_data->to, tx_data->value, data,
+        tx_ptr->gas_limit() ? gas_limit : "", !tx_ptr->gas_price(),
+        std::move(tx_ptr), std::move(callback), tx_data->sign_only);
   } else {
     ContinueAddUnapprovedTransaction(
         chain_id, from, origin, std::move(tx_ptr), std::move(callback),
@@ -228,42 +219,134 @@ void EthTxManager::AddUnapprovedTransaction(
   }
 }
 
-void EthTxManager::OnGetGasPrice(const std::string& chain_id,
-                                 const mojom::AccountIdPtr& from,
-                                 const url::Origin& origin,
-                                 const std::string& to,
-                                 const std::string& value,
-                                 const std::string& data,
-                                 const std::string& gas_limit,
-                                 std::unique_ptr<EthTransaction> tx,
-                                 AddUnapprovedTransactionCallback callback,
-                                 bool sign_only,
-                                 const std::string& result,
-                                 mojom::ProviderError error,
-                                 const std::string& error_message) {
-  uint256_t gas_price;
-  if (error != mojom::ProviderError::kSuccess ||
-      !HexValueToUint256(result, &gas_price)) {
-    std::move(callback).Run(
-        false, "",
-        l10n_util::GetStringUTF8(
-            IDS_WALLET_ETH_SEND_TRANSACTION_GET_GAS_PRICE_FAILED));
-    return;
+struct EthTxManager::GasFieldResponse {
+  enum class Type { kGasPrice, kGasEstimation1559, kGasLimit };
+
+  Type type;
+  // Gas price or gas limit as a hex string.
+  std::string result;
+  mojom::GasEstimation1559Ptr gas_estimation;
+  mojom::ProviderError error = mojom::ProviderError::kSuccess;
+};
+
+void EthTxManager::RequestGasFieldsForUnapprovedTransaction(
+    const std::string& chain_id,
+    const mojom::AccountIdPtr& from,
+    const url::Origin& origin,
+    const std::string& to,
+    const std::string& value,
+    const std::string& data,
+    const std::string& gas_limit,
+    bool request_gas_fees,
+    std::unique_ptr<EthTransaction> tx,
+    AddUnapprovedTransactionCallback callback,
+    bool sign_only) {
+  const bool request_gas_limit = gas_limit.empty();
+  DCHECK(request_gas_fees || request_gas_limit);
+  const bool is_eip1559 = tx->type() == EthTransactionType::kEip1559;
+
+  // eth_estimateGas is called without a gas price, so it does not have to
+  // wait for the fees.
+  auto barrier_callback = base::BarrierCallback<GasFieldResponse>(
+      (request_gas_fees ? 1 : 0) + (request_gas_limit ? 1 : 0),
+      base::BindOnce(&EthTxManager::OnGetGasFieldsForUnapprovedTransaction,
+                     weak_factory_.GetWeakPtr(), chain_id, from.Clone(),
+                     origin, gas_limit, std::move(tx), std::move(callback),
+                     sign_only));
+
+  if (request_gas_fees && is_eip1559) {
+    GetGasEstimation1559(
+        chain_id,
+        base::BindOnce(
+            [](base::OnceCallback<void(GasFieldResponse)> callback,
+               mojom::GasEstimation1559Ptr gas_estimation) {
+              std::move(callback).Run(GasFieldResponse{
+                  GasFieldResponse::Type::kGasEstimation1559, "",
+                  std::move(gas_estimation)});
+            },
+            barrier_callback));
+  } else if (request_gas_fees) {
+    json_rpc_service_->GetGasPrice(
+        chain_id,
+        base::BindOnce(
+            [](base::OnceCallback<void(GasFieldResponse)> callback,
+               const std::string& result, mojom::ProviderError error,
+               const std::string& error_message) {
+              std::move(callback).Run(GasFieldResponse{
+                  GasFieldResponse::Type::kGasPrice, result, nullptr, error});
+            },
+            barrier_callback));
   }
-  tx->set_gas_price(gas_price);
 
-  if (!tx->gas_limit()) {
+  if (request_gas_limit) {
     json_rpc_service_->GetEstimateGas(
         chain_id, from->address, to, "" /* gas */, "" /* gas_price */, value,
         data,
-        base::BindOnce(&EthTxManager::ContinueAddUnapprovedTransaction,
-                       weak_factory_.GetWeakPtr(), chain_id, from.Clone(),
-                       origin, std::move(tx), std::move(callback), sign_only));
-  } else {
-    ContinueAddUnapprovedTransaction(chain_id, from, origin, std::move(tx),
-                                     std::move(callback), sign_only, gas_limit,
-                                     mojom::ProviderError::kSuccess, "");
+        base::BindOnce(
+            [](base::OnceCallback<void(GasFieldResponse)> callback,
+               const std::string& result, mojom::ProviderError error,
+               const std::string& error_message) {
+              std::move(callback).Run(GasFieldResponse{
+                  GasFieldResponse::Type::kGasLimit, result, nullptr, error});
+            },
+            barrier_callback));
+  }
+}
+
+void EthTxManager::OnGetGasFieldsForUnapprovedTransaction(
+    const std::string& chain_id,
+    const mojom::AccountIdPtr& from,
+    const url::Origin& origin,
+    const std::string& gas_limit,
+    std::unique_ptr<EthTransaction> tx,
+    AddUnapprovedTransactionCallback callback,
+    bool sign_only,
+    std::vector<GasFieldResponse> responses) {
+  std::string gas_limit_result = gas_limit;
+  mojom::ProviderError gas_limit_error = mojom::ProviderError::kSuccess;
+  for (auto& response : responses) {
+    switch (response.type) {
+      case GasFieldResponse::Type::kGasPrice: {
+        uint256_t gas_price;
+        if (response.error != mojom::ProviderError::kSuccess ||
+            !HexValueToUint256(response.result, &gas_price)) {
+          std::move(callback).Run(
+              false, "",
+              l10n_util::GetStringUTF8(
+                  IDS_WALLET_ETH_SEND_TRANSACTION_GET_GAS_PRICE_FAILED));
+          return;
+        }
+        tx->set_gas_price(gas_price);
+        break;
+      }
+      case GasFieldResponse::Type::kGasEstimation1559: {
+        auto estimation =
+            Eip1559Transaction::GasEstimation::FromMojomGasEstimation1559(
+                std::move(response.gas_estimation));
+        if (!estimation) {
+          std::move(callback).Run(
+              false, "",
+              l10n_util::GetStringUTF8(
+                  IDS_WALLET_ETH_SEND_TRANSACTION_GET_GAS_FEES_FAILED));
+          return;
+        }
+        auto* tx1559 = static_cast<Eip1559Transaction*>(tx.get());
+        tx1559->set_gas_estimation(estimation.value());
+        tx1559->set_max_fee_per_gas(estimation->avg_max_fee_per_gas);
+        tx1559->set_max_priority_fee_per_gas(
+            estimation->avg_max_priority_fee_per_gas);
+        break;
+      }
+      case GasFieldResponse::Type::kGasLimit:
+        gas_limit_result = std::move(response.result);
+        gas_limit_error = response.error;
+        break;
+    }
   }
+
+  ContinueAddUnapprovedTransaction(chain_id, from, origin, std::move(tx),
+                                   std::move(callback), sign_only,
+                                   gas_limit_result, gas_limit_error, "");
 }
 
 void EthTxManager::ContinueAddUnapprovedTransaction(
@@ -345,22 +428,13 @@ void EthTxManager::AddUnapproved1559Transaction(
       tx_data->base_data->data.empty() ? "" : ToHex(tx_data->base_data->data);
   bool sign_only = tx_data->base_data->sign_only;
 
-  if (!tx_ptr->max_priority_fee_per_gas() || !tx_ptr->max_fee_per_gas()) {
-    GetGasEstimation1559(
-        chain_id,
-        base::BindOnce(&EthTxManager::OnGetGasOracleForUnapprovedTransaction,
-                       weak_factory_.GetWeakPtr(), chain_id, from.Clone(),
-                       origin, tx_data->base_data->to,
-                       tx_data->base_data->value, data, gas_limit,
-                       std::move(tx_ptr), std::move(callback), sign_only));
-  } else if (gas_limit.empty()) {
-    json_rpc_service_->GetEstimateGas(
-        chain_id, from->address, tx_data->base_data->to, "" /* gas */,
-        "" /* gas_price */, tx_data->base_data->value, data,
-        base::BindOnce(&EthTxManager::ContinueAddUnapprovedTransaction,
-                       weak_factory_.GetWeakPtr(), chain_id, from.Clone(),
-                       origin, std::move(tx_ptr), std::move(callback),
-                       sign_only));
+  const bool request_gas_fees =
+      !tx_ptr->max_priority_fee_per_gas() || !tx_ptr->max_fee_per_gas();
+  if (request_gas_fees || gas_limit.empty()) {
+    RequestGasFieldsForUnapprovedTransaction(
+        chain_id, from, origin, tx_data->base_data->to,
+        tx_data->base_data->value, data, gas_limit, request_gas_fees,
+        std::move(tx_ptr), std::move(callback), sign_only);
   } else {
     ContinueAddUnapprovedTransaction(chain_id, from, origin, std::move(tx_ptr),
                                      std::move(callback), sign_only, gas_limit,
@@ -368,46 +442,6 @@ void EthTxManager::AddUnapproved1559Transaction(
   }
 }
 
-void EthTxManager::OnGetGasOracleForUnapprovedTransaction(
-    const std::string& chain_id,
-    const mojom::AccountIdPtr& from,
-    const url::Origin& origin,
-    const std::string& to,
-    const std::string& value,
-    const std::string& data,
-    const std::string& gas_limit,
-    std::unique_ptr<Eip1559Transaction> tx,
-    AddUnapprovedTransactionCallback callback,
-    bool sign_only,
-    mojom::GasEstimation1559Ptr gas_estimation) {
-  auto estimation =
-      Eip1559Transaction::GasEstimation::FromMojomGasEstimation1559(
-          std::move(gas_estimation));
-  if (!estimation) {
-    std::move(callback).Run(
-        false, "",
-        l10n_util::GetStringUTF8(
-            IDS_WALLET_ETH_SEND_TRANSACTION_GET_GAS_FEES_FAILED));
-    return;
-  }
-  tx->set_gas_estimation(estimation.value());
-  tx->set_max_fee_per_gas(estimation->avg_max_fee_per_gas);
-  tx->set_max_priority_fee_per_gas(estimation->avg_max_priority_fee_per_gas);
-
-  if (gas_limit.empty()) {
-    json_rpc_service_->GetEstimateGas(
-        chain_id, from->address, to, "" /* gas */, "" /* gas_price */, value,
-        data,
-        base::BindOnce(&EthTxManager::ContinueAddUnapprovedTransaction,
-                       weak_factory_.GetWeakPtr(), chain_id, from.Clone(),
-                       origin, std::move(tx), std::move(callback), sign_only));
-  } else {
-    ContinueAddUnapprovedTransaction(chain_id, from, origin, std::move(tx),
-                                     std::move(callback), sign_only, gas_limit,
-                                     mojom::ProviderError::kSuccess, "");
-  }
-}
-
 void EthTxManager::GetNonceForHardwareTransaction(
     const std::string& tx_meta_id,
     GetNonceForHardwareTransactionCallback callback) {
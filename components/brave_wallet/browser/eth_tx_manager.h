@@ -197,19 +197,33 @@ class EthTxManager : public TxManager, public EthBlockTracker::Observer {
                             const std::string& tx_hash,
                             mojom::ProviderError error,
                             const std::string& error_message);
-  void OnGetGasPrice(const std::string& chain_id,
-                     const mojom::AccountIdPtr& from,
-                     const url::Origin& origin,
-                     const std::string& to,
-                     const std::string& value,
-                     const std::string& data,
-                     const std::string& gas_limit,
-                     std::unique_ptr<EthTransaction> tx,
-                     AddUnapprovedTransactionCallback callback,
-                     bool sign_only,
-                     const std::string& result,
-                     mojom::ProviderError error,
-                     const std::string& error_message);
+  // Result of one of the RPC calls which fill in the gas fields of a new
+  // transaction.
+  struct GasFieldResponse;
+  // Requests the gas fees if `request_gas_fees` is set and the gas limit if
+  // `gas_limit` is empty, all at once. `tx` is added as an unapproved
+  // transaction when every response arrived.
+  void RequestGasFieldsForUnapprovedTransaction(
+      const std::string& chain_id,
+      const mojom::AccountIdPtr& from,
+      const url::Origin& origin,
+      const std::string& to,
+      const std::string& value,
+      const std::string& data,
+      const std::string& gas_limit,
+      bool request_gas_fees,
+      std::unique_ptr<EthTransaction> tx,
+      AddUnapprovedTransactionCallback callback,
+      bool sign_only);
+  void OnGetGasFieldsForUnapprovedTransaction(
+      const std::string& chain_id,
+      const mojom::AccountIdPtr& from,
+      const url::Origin& origin,
+      const std::string& gas_limit,
+      std::unique_ptr<EthTransaction> tx,
+      AddUnapprovedTransactionCallback callback,
+      bool sign_only,
+      std::vector<GasFieldResponse> responses);
   void ContinueAddUnapprovedTransaction(
       const std::string& chain_id,
       const mojom::AccountIdPtr& from,
@@ -229,18 +243,6 @@ class EthTxManager : public TxManager, public EthBlockTracker::Observer {
       const std::vector<std::vector<std::string>>& reward,
       mojom::ProviderError error,
       const std::string& error_message);
-  void OnGetGasOracleForUnapprovedTransaction(
-      const std::string& chain_id,
-      const mojom::AccountIdPtr& from,
-      const url::Origin& origin,
-      const std::string& to,
-      const std::string& value,
-      const std::string& data,
-      const std::string& gas_limit,
-      std::unique_ptr<Eip1559Transaction> tx,
-      AddUnapprovedTransactionCallback callback,
-      bool sign_only,
-      mojom::GasEstimation1559Ptr gas_estimation);
   void UpdatePendingTransactions(
       const std::optional<std::string>& chain_id) override;
 
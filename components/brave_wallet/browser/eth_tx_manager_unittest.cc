@@ -50,6 +50,7 @@
 #include "services/network/public/cpp/resource_request.h"
 #include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
 #include "services/network/test/test_url_loader_factory.h"
+#include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "ui/base/l10n/l10n_util.h"
 #include "url/origin.h"
@@ -781,6 +782,51 @@ TEST_F(EthTxManagerUnitTest,
   EXPECT_TRUE(callback_called);
 }
 
+TEST_F(EthTxManagerUnitTest,
+       AddUnapprovedTransactionRequestsGasPriceAndGasLimitAtOnce) {
+  std::vector<std::string> methods;
+  GURL network_url;
+  url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
+      [&](const network::ResourceRequest& request) {
+        url_loader_factory_.ClearResponses();
+        auto method = request.headers.GetHeader("X-Eth-Method");
+        ASSERT_TRUE(method);
+        methods.push_back(*method);
+        network_url = request.url;
+        // eth_gasPrice is left pending.
+        if (*method == "eth_estimateGas") {
+          url_loader_factory_.AddResponse(
+              request.url.spec(),
+              R"({"jsonrpc":"2.0","id":1,"result":"0x9604"})");
+        }
+      }));
+
+  auto tx_data =
+      mojom::TxData::New("0x06", "" /* gas_price */, "" /* gas_limit */,
+                         "0xbe862ad9abfe6f22bcb087716c7d89a26051f74c",
+                         "0x016345785d8a0000", data_, false, std::nullopt);
+  bool callback_called = false;
+  std::string tx_meta_id;
+  AddUnapprovedTransaction(
+      mojom::kLocalhostChainId, std::move(tx_data), from(),
+      base::BindOnce(&AddUnapprovedTransactionSuccessCallback, &callback_called,
+                     &tx_meta_id));
+  task_environment_.RunUntilIdle();
+  EXPECT_FALSE(callback_called);
+  EXPECT_THAT(methods, testing::UnorderedElementsAre("eth_gasPrice",
+                                                     "eth_estimateGas"));
+
+  url_loader_factory_.AddResponse(
+      network_url.spec(),
+      R"({"jsonrpc":"2.0","id":1,"result":"0x17fcf18321"})");
+  task_environment_.RunUntilIdle();
+  EXPECT_TRUE(callback_called);
+  auto tx_meta = eth_tx_manager()->GetTxForTesting(tx_meta_id);
+  ASSERT_TRUE(tx_meta);
+  EXPECT_EQ(Uint256ValueToHex(tx_meta->tx()->gas_price()), "0x17fcf18321");
+  EXPECT_EQ(Uint256ValueToHex(tx_meta->tx()->gas_limit()), "0x9604");
+}
+
 TEST_F(EthTxManagerUnitTest,
        AddUnapprovedTransactionWithoutGasPriceAndGasLimitForEthSend) {
   auto tx_data = mojom::TxData::New(
@@ -2430,11 +2476,11 @@ TEST_F(EthTxManagerUnitTest, Reset) {
   // db should be empty
   base::RunLoop run_loop;
   static_cast<TxStorageDelegateImpl*>(tx_service_->GetDelegateForTesting())
-      ->store_->Get("transactions", base::BindLambdaForTesting(
-                                        [&](std::optional<base::Value> value) {
-                                          EXPECT_FALSE(value);
-                                          run_loop.Quit();
-                                        }));
+      ->ReadTxsFromStore(base::BindLambdaForTesting(
+          [&](std::optional<base::Value::Dict> txs, bool is_single_key_format) {
+            EXPECT_FALSE(txs);
+            run_loop.Quit();
+          }));
   run_loop.Run();
 }
 
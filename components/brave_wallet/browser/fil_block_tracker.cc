@@ -5,7 +5,6 @@
 
 #include "brave/components/brave_wallet/browser/fil_block_tracker.h"
 
-#include <memory>
 #include <utility>
 
 #include "base/containers/contains.h"
@@ -22,14 +21,10 @@ FilBlockTracker::~FilBlockTracker() = default;
 
 void FilBlockTracker::Start(const std::string& chain_id,
                             base::TimeDelta interval) {
-  if (!base::Contains(timers_, chain_id)) {
-    timers_[chain_id] = std::make_unique<base::RepeatingTimer>();
-  }
-  timers_[chain_id]->Start(
-      FROM_HERE, interval,
-      base::BindRepeating(&FilBlockTracker::GetFilBlockHeight,
-                          weak_ptr_factory_.GetWeakPtr(), chain_id,
-                          base::NullCallback()));
+  StartPolling(chain_id, interval,
+               base::BindRepeating(&FilBlockTracker::GetFilBlockHeight,
+                                   weak_ptr_factory_.GetWeakPtr(), chain_id,
+                                   base::NullCallback()));
 }
 
 void FilBlockTracker::GetFilBlockHeight(const std::string& chain_id,
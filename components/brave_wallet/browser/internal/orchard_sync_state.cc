@@ -152,45 +152,55 @@ OrchardSyncState::ApplyScanResults(
     const mojom::AccountIdPtr& account_id,
     OrchardBlockScanner::Result block_scanner_results) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  std::vector<OrchardBlockScanner::Result> results;
+  results.push_back(std::move(block_scanner_results));
+  return ApplyScanResultsBatch(account_id, std::move(results));
+}
+
+base::expected<OrchardStorage::Result, OrchardStorage::Error>
+OrchardSyncState::ApplyScanResultsBatch(
+    const mojom::AccountIdPtr& account_id,
+    std::vector<OrchardBlockScanner::Result> block_scanner_results) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   auto existing_notes = storage_.GetSpendableNotes(account_id);
   RETURN_IF_ERROR(existing_notes);
 
-  std::vector<OrchardNote> notes_to_add =
-      block_scanner_results.discovered_notes;
-  base::Extend(existing_notes.value(), notes_to_add);
-
-  std::vector<OrchardNoteSpend> nf_to_add;
-
-  for (const auto& nf : block_scanner_results.found_spends) {
-    if (std::ranges::find_if(existing_notes.value(), [&nf](const auto& v) {
-          return v.nullifier == nf.nullifier;
-        }) != existing_notes.value().end()) {
-      nf_to_add.push_back(nf);
-    }
-  }
-
   {
     auto tx = storage_.Transactionally();
     if (!tx.has_value()) {
       return base::unexpected(tx.error());
     }
 
-    if (!GetOrCreateShardTree(account_id)
-             .ApplyScanResults(
-                 std::move(block_scanner_results.scanned_blocks))) {
-      return base::unexpected(
-          OrchardStorage::Error{OrchardStorage::ErrorCode::kInternalError,
-                                "Failed to insert commitments"});
-    }
-
-    auto update_notes_result =
-        storage_.UpdateNotes(account_id, notes_to_add, std::move(nf_to_add),
-                             block_scanner_results.latest_scanned_block_id,
-                             block_scanner_results.latest_scanned_block_hash);
-
-    if (!update_notes_result.has_value() ||
-        update_notes_result.value() != OrchardStorage::Result::kSuccess) {
-      return update_notes_result;
+    for (auto& result : block_scanner_results) {
+      // Notes discovered by earlier results may be spent by later ones.
+      std::vector<OrchardNote> notes_to_add = result.discovered_notes;
+      base::Extend(existing_notes.value(), notes_to_add);
+
+      std::vector<OrchardNoteSpend> nf_to_add;
+
+      for (const auto& nf : result.found_spends) {
+        if (std::ranges::find_if(existing_notes.value(), [&nf](const auto& v) {
+              return v.nullifier == nf.nullifier;
+            }) != existing_notes.value().end()) {
+          nf_to_add.push_back(nf);
+        }
+      }
+
+      if (!GetOrCreateShardTree(account_id)
+               .ApplyScanResults(std::move(result.scanned_blocks))) {
+        return base::unexpected(
+            OrchardStorage::Error{OrchardStorage::ErrorCode::kInternalError,
+                                  "Failed to insert commitments"});
+      }
+
+      auto update_notes_result = storage_.UpdateNotes(
+          account_id, notes_to_add, std::move(nf_to_add),
+          result.latest_scanned_block_id, result.latest_scanned_block_hash);
+
+      if (!update_notes_result.has_value() ||
+          update_notes_result.value() != OrchardStorage::Result::kSuccess) {
+        return update_notes_result;
+      }
     }
 
     return tx->Commit();
@@ -66,6 +66,13 @@ class OrchardSyncState {
                    // wraps rust object.
                    OrchardBlockScanner::Result block_scanner_results);
 
+  // Applies the results of consecutive scan ranges, in order, in a single
+  // transaction. Either all of them are persisted or none is.
+  base::expected<OrchardStorage::Result, OrchardStorage::Error>
+  ApplyScanResultsBatch(
+      const mojom::AccountIdPtr& account_id,
+      std::vector<OrchardBlockScanner::Result> block_scanner_results);
+
   base::expected<std::optional<uint32_t>, OrchardStorage::Error>
   GetLatestShardIndex(const mojom::AccountIdPtr& account_id);
 
@@ -12,6 +12,7 @@
 #include "brave/components/brave_wallet/browser/internal/orchard_storage/orchard_shard_tree_types.h"
 #include "brave/components/brave_wallet/browser/internal/orchard_test_utils.h"
 #include "brave/components/brave_wallet/browser/zcash/rust/orchard_testing_shard_tree.h"
+#include "brave/components/brave_wallet/browser/zcash/zcash_test_utils.h"
 #include "brave/components/brave_wallet/common/common_utils.h"
 #include "brave/components/brave_wallet/common/zcash_utils.h"
 #include "testing/gmock/include/gmock/gmock.h"
@@ -293,6 +294,60 @@ TEST_F(OrchardSyncStateTest, MaxCheckpoint) {
   EXPECT_EQ(3u, storage().MaxCheckpointId(account_id()).value().value());
 }
 
+TEST_F(OrchardSyncStateTest, ApplyScanResultsBatch) {
+  std::vector<OrchardBlockScanner::Result> results;
+  {
+    std::vector<OrchardCommitment> commitments;
+    for (int i = 0; i < 5; i++) {
+      commitments.push_back(
+          CreateCommitment(CreateMockCommitmentValue(i, kDefaultCommitmentSeed),
+                           false, std::nullopt));
+    }
+    commitments.push_back(CreateCommitment(
+        CreateMockCommitmentValue(5, kDefaultCommitmentSeed), false, 1u));
+    auto result = CreateResultForTesting(OrchardTreeState(),
+                                         std::move(commitments), 1, "1");
+    result.discovered_notes.push_back(
+        GenerateMockOrchardNote(account_id(), 1, 1));
+    result.discovered_notes.push_back(
+        GenerateMockOrchardNote(account_id(), 1, 2));
+    results.push_back(std::move(result));
+  }
+
+  {
+    std::vector<OrchardCommitment> commitments;
+    for (int i = 6; i < 10; i++) {
+      commitments.push_back(
+          CreateCommitment(CreateMockCommitmentValue(i, kDefaultCommitmentSeed),
+                           false, std::nullopt));
+    }
+    commitments.push_back(CreateCommitment(
+        CreateMockCommitmentValue(10, kDefaultCommitmentSeed), false, 2u));
+    OrchardTreeState tree_state;
+    tree_state.block_height = 1;
+    tree_state.tree_size = 6;
+    auto result = CreateResultForTesting(std::move(tree_state),
+                                         std::move(commitments), 2, "2");
+    // Spends a note discovered by the previous result of the same batch.
+    result.found_spends.push_back(GenerateMockNoteSpend(account_id(), 2, 1));
+    results.push_back(std::move(result));
+  }
+
+  EXPECT_EQ(OrchardStorage::Result::kSuccess,
+            sync_state()
+                ->ApplyScanResultsBatch(account_id(), std::move(results))
+                .value());
+
+  EXPECT_EQ(2u, storage().CheckpointCount(account_id()).value());
+  EXPECT_EQ(1u, storage().MinCheckpointId(account_id()).value().value());
+  EXPECT_EQ(2u, storage().MaxCheckpointId(account_id()).value().value());
+
+  auto notes = storage().GetSpendableNotes(account_id());
+  ASSERT_TRUE(notes.has_value());
+  ASSERT_EQ(1u, notes->size());
+  EXPECT_EQ(GenerateMockOrchardNote(account_id(), 1, 2), notes.value()[0]);
+}
+
 TEST_F(OrchardSyncStateTest, GetSpendableNotes_NoRegisteredAccount) {
   OrchardAddrRawPart internal_addr;
   internal_addr.fill(3);
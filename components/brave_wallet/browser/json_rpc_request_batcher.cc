@@ -0,0 +1,266 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/json_rpc_request_batcher.h"
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+
+#include "base/check.h"
+#include "base/containers/map_util.h"
+#include "base/functional/bind.h"
+#include "base/json/json_reader.h"
+#include "base/location.h"
+#include "base/task/sequenced_task_runner.h"
+#include "brave/components/brave_wallet/browser/json_rpc_requests_helper.h"
+#include "brave/components/brave_wallet/common/features.h"
+#include "net/base/net_errors.h"
+#include "net/http/http_status_code.h"
+
+namespace brave_wallet {
+
+namespace {
+
+constexpr char kJsonContentType[] = "application/json";
+
+// Whether a failed batch response means that the endpoint does not accept
+// batches at all, rather than a transient failure.
+bool IsBatchRejected(const api_request_helper::APIRequestResult& result) {
+  if (result.error_code() != net::OK || !result.IsResponseCodeValid()) {
+    return false;
+  }
+  if (result.Is2XXResponseCode()) {
+    // Answered with something that is not an array of responses.
+    return true;
+  }
+  return result.response_code() != net::HTTP_TOO_MANY_REQUESTS &&
+         result.response_code() < net::HTTP_INTERNAL_SERVER_ERROR;
+}
+
+}  // namespace
+
+JsonRpcRequestBatcher::JsonRpcRequestBatcher(
+    APIRequestHelper* api_request_helper)
+    : api_request_helper_(api_request_helper),
+      batching_enabled_(base::FeatureList::IsEnabled(
+          features::kBraveWalletJsonRpcBatchingFeature)),
+      batching_window_(
+          base::Milliseconds(features::kJsonRpcBatchingWindowMs.Get())),
+      max_batch_size_(std::max(features::kJsonRpcMaxBatchSize.Get(), 1)) {
+  CHECK(api_request_helper_);
+  if (base::FeatureList::IsEnabled(
+          features::kBraveWalletJsonRpcResponseCacheFeature)) {
+    response_cache_ = std::make_unique<JsonRpcResponseCache>();
+  }
+}
+
+JsonRpcRequestBatcher::~JsonRpcRequestBatcher() = default;
+
+void JsonRpcRequestBatcher::Request(const std::string& json_payload,
+                                    bool auto_retry_on_network_change,
+                                    const GURL& network_url,
+                                    APIRequestHelper::ResultCallback callback,
+                                    bool bypass_response_cache) {
+  const std::string& endpoint = network_url.spec();
+  auto& stats = endpoint_stats_[endpoint];
+  stats.requests_count++;
+
+  if (response_cache_ && !bypass_response_cache &&
+      JsonRpcResponseCache::IsCacheable(json_payload)) {
+    if (auto cached_result = response_cache_->Get(endpoint, json_payload)) {
+      stats.cache_hits_count++;
+      base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+          FROM_HERE,
+          base::BindOnce(std::move(callback), std::move(*cached_result)));
+      return;
+    }
+  }
+
+  RequestKey key{endpoint, json_payload, auto_retry_on_network_change};
+  if (auto* callbacks = base::FindOrNull(in_flight_requests_, key)) {
+    stats.deduplicated_count++;
+    callbacks->push_back(std::move(callback));
+    return;
+  }
+  in_flight_requests_[key].push_back(std::move(callback));
+
+  // Requests which must not be retried are not mixed with the ones which
+  // may be, so they are always sent individually.
+  if (!batching_enabled_ || !auto_retry_on_network_change ||
+      batch_unsupported_endpoints_.contains(endpoint)) {
+    SendRequest(key);
+    return;
+  }
+
+  auto& batch = pending_batches_[endpoint];
+  batch.push_back(std::move(key));
+  if (batch.size() >= max_batch_size_) {
+    FlushBatch(endpoint);
+  } else if (batch.size() == 1) {
+    base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
+        FROM_HERE,
+        base::BindOnce(&JsonRpcRequestBatcher::FlushBatch,
+                       weak_ptr_factory_.GetWeakPtr(), endpoint),
+        batching_window_);
+  }
+}
+
+const JsonRpcRequestBatcher::EndpointStats*
+JsonRpcRequestBatcher::GetEndpointStats(const GURL& network_url) const {
+  return base::FindOrNull(endpoint_stats_, network_url.spec());
+}
+
+void JsonRpcRequestBatcher::FlushBatch(const std::string& endpoint) {
+  auto node = pending_batches_.extract(endpoint);
+  if (node.empty()) {
+    return;
+  }
+
+  // Ids of the batched requests are replaced by their index in the batch so
+  // responses can be matched even if the original ids collide.
+  std::vector<RequestKey> keys;
+  base::Value::List batch;
+  for (auto& key : node.mapped()) {
+    auto request = base::JSONReader::ReadDict(std::get<1>(key));
+    if (!request) {
+      SendRequest(key);
+      continue;
+    }
+    request->Set("id", static_cast<int>(batch.size()));
+    batch.Append(std::move(*request));
+    keys.push_back(std::move(key));
+  }
+
+  if (keys.size() <= 1) {
+    for (const auto& key : keys) {
+      SendRequest(key);
+    }
+    return;
+  }
+
+  auto& stats = endpoint_stats_[endpoint];
+  stats.http_requests_count++;
+  stats.batches_count++;
+  stats.batched_requests_count += keys.size();
+  stats.max_batch_size = std::max(stats.max_batch_size, keys.size());
+
+  const std::string payload = GetJSON(batch);
+  const GURL network_url(endpoint);
+  api_request_helper_->Request(
+      "POST", network_url, payload, kJsonContentType,
+      base::BindOnce(&JsonRpcRequestBatcher::OnBatchComplete,
+                     weak_ptr_factory_.GetWeakPtr(), endpoint, std::move(keys),
+                     base::TimeTicks::Now()),
+      MakeCommonJsonRpcHeaders(payload, network_url),
+      {.auto_retry_on_network_change = true});
+}
+
+void JsonRpcRequestBatcher::SendRequest(const RequestKey& key) {
+  const auto& [endpoint, payload, auto_retry_on_network_change] = key;
+  endpoint_stats_[endpoint].http_requests_count++;
+
+  const GURL network_url(endpoint);
+  api_request_helper_->Request(
+      "POST", network_url, payload, kJsonContentType,
+      base::BindOnce(&JsonRpcRequestBatcher::OnRequestComplete,
+                     weak_ptr_factory_.GetWeakPtr(), key,
+                     base::TimeTicks::Now()),
+      MakeCommonJsonRpcHeaders(payload, network_url),
+      {.auto_retry_on_network_change = auto_retry_on_network_change});
+}
+
+void JsonRpcRequestBatcher::OnRequestComplete(
+    const RequestKey& key,
+    base::TimeTicks start_time,
+    APIRequestResult api_request_result) {
+  RecordLatency(std::get<0>(key), base::TimeTicks::Now() - start_time);
+  CompleteRequest(key, std::move(api_request_result));
+}
+
+void JsonRpcRequestBatcher::OnBatchComplete(
+    const std::string& endpoint,
+    std::vector<RequestKey> keys,
+    base::TimeTicks start_time,
+    APIRequestResult api_request_result) {
+  RecordLatency(endpoint, base::TimeTicks::Now() - start_time);
+
+  if (!api_request_result.Is2XXResponseCode() ||
+      !api_request_result.value_body().is_list()) {
+    if (IsBatchRejected(api_request_result)) {
+      batch_unsupported_endpoints_.insert(endpoint);
+    }
+    for (const auto& key : keys) {
+      SendRequest(key);
+    }
+    return;
+  }
+
+  const int response_code = api_request_result.response_code();
+  const int error_code = api_request_result.error_code();
+  const GURL final_url = api_request_result.final_url();
+  const auto headers = api_request_result.headers();
+
+  std::map<int, base::Value::Dict> responses;
+  for (auto& item : std::move(api_request_result).TakeBody().TakeList()) {
+    if (!item.is_dict()) {
+      continue;
+    }
+    if (auto id = item.GetDict().FindInt("id")) {
+      responses[*id] = std::move(item).TakeDict();
+    }
+  }
+
+  auto weak_this = weak_ptr_factory_.GetWeakPtr();
+  for (size_t i = 0; i < keys.size() && weak_this; i++) {
+    auto response = responses.extract(static_cast<int>(i));
+    if (response.empty()) {
+      // Nodes may drop some entries of a batch, those are retried alone.
+      SendRequest(keys[i]);
+      continue;
+    }
+
+    auto request = base::JSONReader::ReadDict(std::get<1>(keys[i]));
+    if (auto* id = request ? request->Find("id") : nullptr) {
+      response.mapped().Set("id", id->Clone());
+    } else {
+      response.mapped().Remove("id");
+    }
+    CompleteRequest(keys[i],
+                    APIRequestResult(response_code,
+                                     base::Value(std::move(response.mapped())),
+                                     headers, error_code, final_url));
+  }
+}
+
+void JsonRpcRequestBatcher::CompleteRequest(
+    const RequestKey& key,
+    APIRequestResult api_request_result) {
+  auto node = in_flight_requests_.extract(key);
+  if (node.empty()) {
+    return;
+  }
+
+  if (response_cache_) {
+    response_cache_->OnResponse(std::get<0>(key), std::get<1>(key),
+                                api_request_result);
+  }
+
+  // Callbacks may destroy `this`, so only locals are used from here.
+  auto callbacks = std::move(node.mapped());
+  for (size_t i = 0; i + 1 < callbacks.size(); i++) {
+    std::move(callbacks[i]).Run(CloneAPIRequestResult(api_request_result));
+  }
+  std::move(callbacks.back()).Run(std::move(api_request_result));
+}
+
+void JsonRpcRequestBatcher::RecordLatency(const std::string& endpoint,
+                                          base::TimeDelta latency) {
+  auto& stats = endpoint_stats_[endpoint];
+  stats.total_latency += latency;
+  stats.max_latency = std::max(stats.max_latency, latency);
+}
+
+}  // namespace brave_wallet
@@ -0,0 +1,108 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_JSON_RPC_REQUEST_BATCHER_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_JSON_RPC_REQUEST_BATCHER_H_
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "brave/components/api_request_helper/api_request_helper.h"
+#include "brave/components/brave_wallet/browser/json_rpc_response_cache.h"
+#include "url/gurl.h"
+
+namespace brave_wallet {
+
+// Sends JSON-RPC requests on behalf of JsonRpcService.
+// Identical requests (same endpoint and payload) which are in flight at the
+// same time share a single network request.
+// When kBraveWalletJsonRpcBatchingFeature is enabled, requests to the same
+// endpoint issued within a short window are sent as one JSON-RPC 2.0 batch.
+// Endpoints which reject batches are remembered and served with individual
+// requests afterwards.
+// When kBraveWalletJsonRpcResponseCacheFeature is enabled, responses to
+// idempotent queries are also served from a JsonRpcResponseCache.
+class JsonRpcRequestBatcher {
+ public:
+  using APIRequestHelper = api_request_helper::APIRequestHelper;
+  using APIRequestResult = api_request_helper::APIRequestResult;
+
+  struct EndpointStats {
+    // Requests passed to the batcher.
+    size_t requests_count = 0;
+    // Requests served by a request which was already in flight.
+    size_t deduplicated_count = 0;
+    // Requests served by the response cache.
+    size_t cache_hits_count = 0;
+    // HTTP requests sent, batches included.
+    size_t http_requests_count = 0;
+    size_t batches_count = 0;
+    size_t batched_requests_count = 0;
+    size_t max_batch_size = 0;
+    base::TimeDelta total_latency;
+    base::TimeDelta max_latency;
+  };
+
+  explicit JsonRpcRequestBatcher(APIRequestHelper* api_request_helper);
+  JsonRpcRequestBatcher(const JsonRpcRequestBatcher&) = delete;
+  JsonRpcRequestBatcher& operator=(const JsonRpcRequestBatcher&) = delete;
+  ~JsonRpcRequestBatcher();
+
+  void Request(const std::string& json_payload,
+               bool auto_retry_on_network_change,
+               const GURL& network_url,
+               APIRequestHelper::ResultCallback callback,
+               bool bypass_response_cache = false);
+
+  // Returns nullptr if nothing was requested from `network_url` yet.
+  const EndpointStats* GetEndpointStats(const GURL& network_url) const;
+
+  // Returns nullptr if the response cache is disabled.
+  const JsonRpcResponseCache* response_cache() const {
+    return response_cache_.get();
+  }
+
+ private:
+  // Endpoint spec, payload, auto retry on network change.
+  using RequestKey = std::tuple<std::string, std::string, bool>;
+
+  void FlushBatch(const std::string& endpoint);
+  void SendRequest(const RequestKey& key);
+  void OnRequestComplete(const RequestKey& key,
+                         base::TimeTicks start_time,
+                         APIRequestResult api_request_result);
+  void OnBatchComplete(const std::string& endpoint,
+                       std::vector<RequestKey> keys,
+                       base::TimeTicks start_time,
+                       APIRequestResult api_request_result);
+  void CompleteRequest(const RequestKey& key,
+                       APIRequestResult api_request_result);
+  void RecordLatency(const std::string& endpoint, base::TimeDelta latency);
+
+  raw_ptr<APIRequestHelper> api_request_helper_;
+  const bool batching_enabled_;
+  const base::TimeDelta batching_window_;
+  const size_t max_batch_size_;
+
+  std::map<RequestKey, std::vector<APIRequestHelper::ResultCallback>>
+      in_flight_requests_;
+  std::map<std::string, std::vector<RequestKey>> pending_batches_;
+  std::set<std::string> batch_unsupported_endpoints_;
+  std::map<std::string, EndpointStats> endpoint_stats_;
+  std::unique_ptr<JsonRpcResponseCache> response_cache_;
+
+  base::WeakPtrFactory<JsonRpcRequestBatcher> weak_ptr_factory_{this};
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_JSON_RPC_REQUEST_BATCHER_H_
@@ -0,0 +1,227 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/json_rpc_request_batcher.h"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "base/barrier_closure.h"
+#include "base/json/json_reader.h"
+#include "base/run_loop.h"
+#include "base/test/bind.h"
+#include "base/test/scoped_feature_list.h"
+#include "base/test/task_environment.h"
+#include "brave/components/brave_wallet/browser/json_rpc_requests_helper.h"
+#include "brave/components/brave_wallet/common/features.h"
+#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
+#include "services/data_decoder/public/cpp/test_support/in_process_data_decoder.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_wallet {
+
+namespace {
+
+constexpr char kNetworkUrl[] = "https://rpc.example.com/";
+
+// Answers a single request with its method name as result.
+base::Value::Dict MakeResponse(const base::Value::Dict& request) {
+  base::Value::Dict response;
+  response.Set("jsonrpc", "2.0");
+  if (const auto* id = request.Find("id")) {
+    response.Set("id", id->Clone());
+  }
+  response.Set("result", *request.FindString("method"));
+  return response;
+}
+
+}  // namespace
+
+class JsonRpcRequestBatcherUnitTest : public testing::Test {
+ public:
+  JsonRpcRequestBatcherUnitTest()
+      : shared_url_loader_factory_(
+            base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+                &url_loader_factory_)),
+        api_request_helper_(TRAFFIC_ANNOTATION_FOR_TESTS,
+                            shared_url_loader_factory_) {}
+  ~JsonRpcRequestBatcherUnitTest() override = default;
+
+ protected:
+  void SetUp() override {
+    url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
+        [&](const network::ResourceRequest& request) {
+          std::string_view body(request.request_body->elements()
+                                    ->at(0)
+                                    .As<network::DataElementBytes>()
+                                    .AsStringPiece());
+          request_bodies_.emplace_back(body);
+          url_loader_factory_.ClearResponses();
+          url_loader_factory_.AddResponse(request.url.spec(),
+                                          RespondTo(body));
+        }));
+  }
+
+  void CreateBatcher() {
+    batcher_ = std::make_unique<JsonRpcRequestBatcher>(&api_request_helper_);
+  }
+
+  std::string RespondTo(std::string_view body) {
+    auto value = base::JSONReader::Read(body);
+    if (value && value->is_list()) {
+      if (batch_response_) {
+        return *batch_response_;
+      }
+      // Answers in reverse order to check responses are matched by id.
+      base::Value::List responses;
+      for (const auto& request : value->GetList()) {
+        responses.Insert(responses.begin(),
+                         base::Value(MakeResponse(request.GetDict())));
+      }
+      return GetJSON(responses);
+    }
+    return GetJSON(MakeResponse(value->GetDict()));
+  }
+
+  // Issues all `payloads` at once and returns the results in the same order.
+  std::vector<std::string> RequestAll(
+      const std::vector<std::string>& payloads) {
+    std::vector<std::string> results(payloads.size());
+    base::RunLoop run_loop;
+    auto barrier =
+        base::BarrierClosure(payloads.size(), run_loop.QuitClosure());
+    for (size_t i = 0; i < payloads.size(); i++) {
+      batcher_->Request(
+          payloads[i], true, GURL(kNetworkUrl),
+          base::BindLambdaForTesting(
+              [&, i](api_request_helper::APIRequestResult result) {
+                EXPECT_EQ(*result.value_body().GetDict().FindInt("id"), 1);
+                results[i] = *result.value_body().GetDict().FindString(
+                    "result");
+                barrier.Run();
+              }));
+    }
+    run_loop.Run();
+    return results;
+  }
+
+  const JsonRpcRequestBatcher::EndpointStats& stats() {
+    return *batcher_->GetEndpointStats(GURL(kNetworkUrl));
+  }
+
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+  network::TestURLLoaderFactory url_loader_factory_;
+  scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
+  data_decoder::test::InProcessDataDecoder in_process_data_decoder_;
+  api_request_helper::APIRequestHelper api_request_helper_;
+  std::unique_ptr<JsonRpcRequestBatcher> batcher_;
+  std::vector<std::string> request_bodies_;
+  std::optional<std::string> batch_response_;
+};
+
+TEST_F(JsonRpcRequestBatcherUnitTest, DeduplicatesInFlightRequests) {
+  CreateBatcher();
+  const std::string block_number = GetJsonRpcString("eth_blockNumber");
+  const std::string gas_price = GetJsonRpcString("eth_gasPrice");
+
+  EXPECT_EQ(RequestAll({block_number, gas_price, block_number}),
+            (std::vector<std::string>{"eth_blockNumber", "eth_gasPrice",
+                                      "eth_blockNumber"}));
+  EXPECT_EQ(request_bodies_.size(), 2u);
+  EXPECT_EQ(stats().requests_count, 3u);
+  EXPECT_EQ(stats().deduplicated_count, 1u);
+  EXPECT_EQ(stats().http_requests_count, 2u);
+  EXPECT_EQ(stats().batches_count, 0u);
+
+  // Completed requests are not reused.
+  EXPECT_EQ(RequestAll({block_number}),
+            std::vector<std::string>{"eth_blockNumber"});
+  EXPECT_EQ(request_bodies_.size(), 3u);
+}
+
+TEST_F(JsonRpcRequestBatcherUnitTest, BatchesRequests) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeatureWithParameters(
+      features::kBraveWalletJsonRpcBatchingFeature, {{"max_batch_size", "2"}});
+  CreateBatcher();
+
+  EXPECT_EQ(RequestAll({GetJsonRpcString("eth_blockNumber"),
+                        GetJsonRpcString("eth_gasPrice"),
+                        GetJsonRpcString("eth_chainId")}),
+            (std::vector<std::string>{"eth_blockNumber", "eth_gasPrice",
+                                      "eth_chainId"}));
+
+  // The first two requests fill a batch, the last one is flushed alone once
+  // the window is over.
+  ASSERT_EQ(request_bodies_.size(), 2u);
+  EXPECT_EQ(base::JSONReader::Read(request_bodies_[0])->GetList().size(), 2u);
+  EXPECT_TRUE(base::JSONReader::Read(request_bodies_[1])->is_dict());
+  EXPECT_EQ(stats().batches_count, 1u);
+  EXPECT_EQ(stats().batched_requests_count, 2u);
+  EXPECT_EQ(stats().max_batch_size, 2u);
+  EXPECT_EQ(stats().http_requests_count, 2u);
+}
+
+TEST_F(JsonRpcRequestBatcherUnitTest, FallsBackWhenBatchRejected) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeature(
+      features::kBraveWalletJsonRpcBatchingFeature);
+  CreateBatcher();
+  batch_response_ =
+      R"({"jsonrpc":"2.0","id":null,"error":{"code":-32600,)"
+      R"("message":"Batch requests are not supported"}})";
+
+  const std::vector<std::string> payloads = {
+      GetJsonRpcString("eth_blockNumber"), GetJsonRpcString("eth_gasPrice")};
+  const std::vector<std::string> expected = {"eth_blockNumber",
+                                             "eth_gasPrice"};
+  EXPECT_EQ(RequestAll(payloads), expected);
+  // One rejected batch followed by individual requests.
+  EXPECT_EQ(request_bodies_.size(), 3u);
+  EXPECT_EQ(stats().batches_count, 1u);
+
+  // Batches are not sent to that endpoint anymore.
+  EXPECT_EQ(RequestAll(payloads), expected);
+  EXPECT_EQ(request_bodies_.size(), 5u);
+  EXPECT_EQ(stats().batches_count, 1u);
+}
+
+TEST_F(JsonRpcRequestBatcherUnitTest, ServesCachedResponses) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeature(
+      features::kBraveWalletJsonRpcResponseCacheFeature);
+  CreateBatcher();
+  const std::string gas_price = GetJsonRpcString("eth_gasPrice");
+  const std::string nonce =
+      GetJsonRpcString("eth_getTransactionCount", "0x1", "latest");
+
+  EXPECT_EQ(RequestAll({gas_price, nonce}),
+            (std::vector<std::string>{"eth_gasPrice",
+                                      "eth_getTransactionCount"}));
+  EXPECT_EQ(RequestAll({gas_price, nonce}),
+            (std::vector<std::string>{"eth_gasPrice",
+                                      "eth_getTransactionCount"}));
+  // Only the nonce is requested again.
+  EXPECT_EQ(request_bodies_.size(), 3u);
+  EXPECT_EQ(stats().cache_hits_count, 1u);
+
+  base::RunLoop run_loop;
+  batcher_->Request(gas_price, true, GURL(kNetworkUrl),
+                    base::BindLambdaForTesting(
+                        [&](api_request_helper::APIRequestResult result) {
+                          run_loop.Quit();
+                        }),
+                    /*bypass_response_cache=*/true);
+  run_loop.Run();
+  EXPECT_EQ(request_bodies_.size(), 4u);
+  EXPECT_EQ(stats().cache_hits_count, 1u);
+}
+
+}  // namespace brave_wallet
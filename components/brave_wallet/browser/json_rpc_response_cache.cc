@@ -0,0 +1,191 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/json_rpc_response_cache.h"
+
+#include <string_view>
+#include <utility>
+
+#include "base/containers/fixed_flat_set.h"
+#include "base/containers/map_util.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+#include "base/strings/string_util.h"
+#include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
+
+namespace brave_wallet {
+
+namespace {
+
+// Keeps the cache bounded when a lot of distinct queries are issued, e.g.
+// balances of many tokens.
+constexpr size_t kMaxEntriesPerEndpoint = 512;
+
+constexpr auto kCacheableMethods = base::MakeFixedFlatSet<std::string_view>({
+    "eth_blockNumber",
+    "eth_call",
+    "eth_chainId",
+    "eth_feeHistory",
+    "eth_gasPrice",
+    "eth_getBalance",
+    "eth_getBlockByNumber",
+    "eth_getCode",
+    "eth_maxPriorityFeePerGas",
+    "Filecoin.ChainHead",
+    "Filecoin.WalletBalance",
+    "getBalance",
+    "getBlockHeight",
+    "getMinimumBalanceForRentExemption",
+    "getTokenAccountBalance",
+    "getTokenAccountsByOwner",
+});
+
+// Methods which return the current head of the chain.
+constexpr auto kChainHeadMethods = base::MakeFixedFlatSet<std::string_view>({
+    "eth_blockNumber",
+    "Filecoin.ChainHead",
+    "getBlockHeight",
+});
+
+// Methods which change the state of the chain.
+constexpr auto kSendTransactionMethods =
+    base::MakeFixedFlatSet<std::string_view>({
+        "eth_sendRawTransaction",
+        "Filecoin.MpoolPush",
+        "sendTransaction",
+    });
+
+std::optional<std::string> GetMethod(const std::string& json_payload) {
+  auto request = base::JSONReader::ReadDict(json_payload);
+  if (!request) {
+    return std::nullopt;
+  }
+  const auto* method = request->FindString("method");
+  if (!method) {
+    return std::nullopt;
+  }
+  return *method;
+}
+
+// Block trackers of EVM and Filecoin networks poll much less often than the
+// Solana one, so a fraction of their interval is used for those.
+base::TimeDelta GetTimeToLive(std::string_view method) {
+  if (base::StartsWith(method, "eth_") ||
+      base::StartsWith(method, "Filecoin.")) {
+    return base::Seconds(kBlockTrackerDefaultTimeInSeconds) / 4;
+  }
+  return base::Seconds(kSolanaBlockTrackerTimeInSeconds);
+}
+
+bool IsSuccessfulResponse(
+    const api_request_helper::APIRequestResult& api_request_result) {
+  if (!api_request_result.Is2XXResponseCode() ||
+      !api_request_result.value_body().is_dict()) {
+    return false;
+  }
+  const auto& response = api_request_result.value_body().GetDict();
+  return !response.contains("error") && response.contains("result");
+}
+
+}  // namespace
+
+api_request_helper::APIRequestResult CloneAPIRequestResult(
+    const api_request_helper::APIRequestResult& result) {
+  return api_request_helper::APIRequestResult(
+      result.response_code(), result.value_body().Clone(), result.headers(),
+      result.error_code(), result.final_url());
+}
+
+JsonRpcResponseCache::JsonRpcResponseCache() = default;
+JsonRpcResponseCache::~JsonRpcResponseCache() = default;
+
+// static
+bool JsonRpcResponseCache::IsCacheable(const std::string& json_payload) {
+  auto method = GetMethod(json_payload);
+  if (!method || !kCacheableMethods.contains(*method)) {
+    return false;
+  }
+  // Pending state changes with every transaction in the mempool.
+  return json_payload.find("\"pending\"") == std::string::npos;
+}
+
+std::optional<JsonRpcResponseCache::APIRequestResult> JsonRpcResponseCache::Get(
+    const std::string& endpoint,
+    const std::string& json_payload) {
+  auto* endpoint_entries = base::FindOrNull(entries_, endpoint);
+  auto* entry = endpoint_entries
+                    ? base::FindOrNull(*endpoint_entries, json_payload)
+                    : nullptr;
+  if (!entry || entry->expiration_time <= base::TimeTicks::Now()) {
+    stats_.misses++;
+    return std::nullopt;
+  }
+  stats_.hits++;
+  return CloneAPIRequestResult(entry->result);
+}
+
+void JsonRpcResponseCache::OnResponse(
+    const std::string& endpoint,
+    const std::string& json_payload,
+    const APIRequestResult& api_request_result) {
+  auto method = GetMethod(json_payload);
+  if (!method) {
+    return;
+  }
+
+  if (kSendTransactionMethods.contains(*method)) {
+    Invalidate(endpoint);
+    return;
+  }
+
+  if (!IsSuccessfulResponse(api_request_result)) {
+    return;
+  }
+
+  if (kChainHeadMethods.contains(*method)) {
+    std::string block;
+    base::JSONWriter::Write(
+        *api_request_result.value_body().GetDict().Find("result"), &block);
+    auto& latest_block = latest_blocks_[endpoint];
+    if (!latest_block.empty() && latest_block != block) {
+      Invalidate(endpoint);
+    }
+    latest_block = std::move(block);
+  }
+
+  if (!IsCacheable(json_payload)) {
+    return;
+  }
+
+  auto& endpoint_entries = entries_[endpoint];
+  const auto now = base::TimeTicks::Now();
+  if (endpoint_entries.size() >= kMaxEntriesPerEndpoint) {
+    std::erase_if(endpoint_entries, [now](const auto& item) {
+      return item.second.expiration_time <= now;
+    });
+    if (endpoint_entries.size() >= kMaxEntriesPerEndpoint) {
+      endpoint_entries.erase(endpoint_entries.begin());
+    }
+  }
+  endpoint_entries.insert_or_assign(
+      json_payload, Entry{CloneAPIRequestResult(api_request_result),
+                          now + GetTimeToLive(*method)});
+}
+
+void JsonRpcResponseCache::Invalidate(const std::string& endpoint) {
+  if (entries_.erase(endpoint)) {
+    stats_.invalidations++;
+  }
+}
+
+size_t JsonRpcResponseCache::size() const {
+  size_t size = 0;
+  for (const auto& [endpoint, endpoint_entries] : entries_) {
+    size += endpoint_entries.size();
+  }
+  return size;
+}
+
+}  // namespace brave_wallet
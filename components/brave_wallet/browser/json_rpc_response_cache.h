@@ -0,0 +1,73 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_JSON_RPC_RESPONSE_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_JSON_RPC_RESPONSE_CACHE_H_
+
+#include <map>
+#include <optional>
+#include <string>
+
+#include "base/time/time.h"
+#include "brave/components/api_request_helper/api_request_helper.h"
+
+namespace brave_wallet {
+
+api_request_helper::APIRequestResult CloneAPIRequestResult(
+    const api_request_helper::APIRequestResult& result);
+
+// Short-lived cache of successful responses to idempotent JSON-RPC queries,
+// keyed by network endpoint and request payload.
+// Entries live for a fraction of the block time of the chain. All entries of
+// an endpoint are dropped as soon as a new block is observed in a response
+// of that endpoint, or a transaction is sent through it.
+class JsonRpcResponseCache {
+ public:
+  using APIRequestResult = api_request_helper::APIRequestResult;
+
+  struct Stats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t invalidations = 0;
+  };
+
+  JsonRpcResponseCache();
+  JsonRpcResponseCache(const JsonRpcResponseCache&) = delete;
+  JsonRpcResponseCache& operator=(const JsonRpcResponseCache&) = delete;
+  ~JsonRpcResponseCache();
+
+  // Whether responses to `json_payload` may be served from the cache.
+  static bool IsCacheable(const std::string& json_payload);
+
+  std::optional<APIRequestResult> Get(const std::string& endpoint,
+                                      const std::string& json_payload);
+
+  // Stores the response if it's cacheable and updates the state of
+  // `endpoint` from it.
+  void OnResponse(const std::string& endpoint,
+                  const std::string& json_payload,
+                  const APIRequestResult& api_request_result);
+
+  void Invalidate(const std::string& endpoint);
+
+  size_t size() const;
+  const Stats& stats() const { return stats_; }
+
+ private:
+  struct Entry {
+    APIRequestResult result;
+    base::TimeTicks expiration_time;
+  };
+  using EndpointEntries = std::map<std::string, Entry>;
+
+  std::map<std::string, EndpointEntries> entries_;
+  // Serialized result of the latest chain head query per endpoint.
+  std::map<std::string, std::string> latest_blocks_;
+  Stats stats_;
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_JSON_RPC_RESPONSE_CACHE_H_
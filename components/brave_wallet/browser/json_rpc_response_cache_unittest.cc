@@ -0,0 +1,128 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/json_rpc_response_cache.h"
+
+#include <string>
+
+#include "base/test/task_environment.h"
+#include "base/test/values_test_util.h"
+#include "brave/components/brave_wallet/browser/json_rpc_requests_helper.h"
+#include "net/base/net_errors.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_wallet {
+
+namespace {
+
+constexpr char kEndpoint[] = "https://rpc.example.com/";
+constexpr char kOtherEndpoint[] = "https://other.example.com/";
+
+api_request_helper::APIRequestResult MakeResult(const std::string& result) {
+  return api_request_helper::APIRequestResult(
+      200,
+      base::test::ParseJson(R"({"jsonrpc":"2.0","id":1,"result":")" + result +
+                            R"("})"),
+      {}, net::OK, GURL(kEndpoint));
+}
+
+}  // namespace
+
+class JsonRpcResponseCacheUnitTest : public testing::Test {
+ protected:
+  std::string GetCachedResult(const std::string& endpoint,
+                              const std::string& payload) {
+    auto result = cache_.Get(endpoint, payload);
+    if (!result) {
+      return "";
+    }
+    return *result->value_body().GetDict().FindString("result");
+  }
+
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+  JsonRpcResponseCache cache_;
+};
+
+TEST_F(JsonRpcResponseCacheUnitTest, IsCacheable) {
+  EXPECT_TRUE(JsonRpcResponseCache::IsCacheable(
+      GetJsonRpcString("eth_getBalance", "0x1", "latest")));
+  EXPECT_TRUE(
+      JsonRpcResponseCache::IsCacheable(GetJsonRpcString("getBlockHeight")));
+  EXPECT_FALSE(JsonRpcResponseCache::IsCacheable(
+      GetJsonRpcString("eth_getBalance", "0x1", "pending")));
+  EXPECT_FALSE(JsonRpcResponseCache::IsCacheable(
+      GetJsonRpcString("eth_getTransactionCount", "0x1", "latest")));
+  EXPECT_FALSE(JsonRpcResponseCache::IsCacheable(
+      GetJsonRpcString("eth_sendRawTransaction", "0x1")));
+  EXPECT_FALSE(JsonRpcResponseCache::IsCacheable("not json"));
+}
+
+TEST_F(JsonRpcResponseCacheUnitTest, ExpiresEntries) {
+  const auto payload = GetJsonRpcString("eth_getBalance", "0x1", "latest");
+  EXPECT_EQ(GetCachedResult(kEndpoint, payload), "");
+
+  cache_.OnResponse(kEndpoint, payload, MakeResult("0x10"));
+  EXPECT_EQ(GetCachedResult(kEndpoint, payload), "0x10");
+  EXPECT_EQ(GetCachedResult(kOtherEndpoint, payload), "");
+  EXPECT_EQ(cache_.stats().hits, 1u);
+  EXPECT_EQ(cache_.stats().misses, 2u);
+
+  task_environment_.FastForwardBy(base::Seconds(10));
+  EXPECT_EQ(GetCachedResult(kEndpoint, payload), "");
+}
+
+TEST_F(JsonRpcResponseCacheUnitTest, SkipsErrorsAndNonCacheableMethods) {
+  const auto nonce =
+      GetJsonRpcString("eth_getTransactionCount", "0x1", "latest");
+  cache_.OnResponse(kEndpoint, nonce, MakeResult("0x1"));
+  EXPECT_EQ(cache_.size(), 0u);
+
+  const auto balance = GetJsonRpcString("eth_getBalance", "0x1", "latest");
+  cache_.OnResponse(
+      kEndpoint, balance,
+      api_request_helper::APIRequestResult(
+          200,
+          base::test::ParseJson(
+              R"({"jsonrpc":"2.0","id":1,"error":{"code":-32000}})"),
+          {}, net::OK, GURL(kEndpoint)));
+  cache_.OnResponse(kEndpoint, balance,
+                    api_request_helper::APIRequestResult(
+                        500, {}, {}, net::OK, GURL(kEndpoint)));
+  EXPECT_EQ(cache_.size(), 0u);
+}
+
+TEST_F(JsonRpcResponseCacheUnitTest, InvalidatesOnNewBlock) {
+  const auto block_number = GetJsonRpcString("eth_blockNumber");
+  const auto balance = GetJsonRpcString("eth_getBalance", "0x1", "latest");
+
+  cache_.OnResponse(kEndpoint, block_number, MakeResult("0x1"));
+  cache_.OnResponse(kEndpoint, balance, MakeResult("0x10"));
+  cache_.OnResponse(kOtherEndpoint, balance, MakeResult("0x20"));
+
+  // Same block, nothing changes.
+  cache_.OnResponse(kEndpoint, block_number, MakeResult("0x1"));
+  EXPECT_EQ(GetCachedResult(kEndpoint, balance), "0x10");
+
+  cache_.OnResponse(kEndpoint, block_number, MakeResult("0x2"));
+  EXPECT_EQ(GetCachedResult(kEndpoint, balance), "");
+  EXPECT_EQ(GetCachedResult(kEndpoint, block_number), "0x2");
+  EXPECT_EQ(GetCachedResult(kOtherEndpoint, balance), "0x20");
+  EXPECT_EQ(cache_.stats().invalidations, 1u);
+}
+
+TEST_F(JsonRpcResponseCacheUnitTest, InvalidatesOnSendTransaction) {
+  const auto balance = GetJsonRpcString("eth_getBalance", "0x1", "latest");
+  cache_.OnResponse(kEndpoint, balance, MakeResult("0x10"));
+  EXPECT_EQ(cache_.size(), 1u);
+
+  cache_.OnResponse(kEndpoint,
+                    GetJsonRpcString("eth_sendRawTransaction", "0x1"),
+                    MakeResult("0xabc"));
+  EXPECT_EQ(cache_.size(), 0u);
+  EXPECT_EQ(GetCachedResult(kEndpoint, balance), "");
+}
+
+}  // namespace brave_wallet
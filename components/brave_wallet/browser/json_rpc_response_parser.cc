@@ -118,13 +118,15 @@ std::optional<std::string> ConvertMultiUint64ToString(
     return std::nullopt;
   }
 
-  std::string converted_json(json);
+  // Responses can be several megabytes, so convert from |json| directly rather
+  // than copying it up front.
+  std::optional<std::string> converted_json;
   for (const auto& path : paths) {
-    auto result = ConvertUint64ToString(path, converted_json);
-    if (!result) {
+    converted_json =
+        ConvertUint64ToString(path, converted_json ? *converted_json : json);
+    if (!converted_json) {
       return std::nullopt;
     }
-    converted_json = std::move(*result);
   }
 
   return converted_json;
@@ -139,14 +141,15 @@ std::optional<std::string> ConvertMultiUint64InObjectArrayToString(
     return std::nullopt;
   }
 
-  std::string converted_json(json);
+  std::optional<std::string> converted_json;
   for (const auto& key : keys) {
     if (key.empty()) {
       return std::nullopt;
     }
     converted_json = json::convert_uint64_in_object_array_to_string(
-        path_to_list, path_to_object, key, converted_json);
-    if (converted_json.empty()) {
+        path_to_list, path_to_object, key,
+        converted_json ? *converted_json : json);
+    if (converted_json->empty()) {
       return std::nullopt;
     }
   }
@@ -10,12 +10,16 @@
 #include <utility>
 #include <vector>
 
+#include "base/json/json_reader.h"
+#include "base/strings/strcat.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/test/values_test_util.h"
+#include "base/timer/elapsed_timer.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/browser/json_rpc_responses.h"
 #include "components/grit/brave_components_strings.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
 #include "ui/base/l10n/l10n_util.h"
 
 using base::test::ParseJson;
@@ -590,4 +594,46 @@ TEST(JsonRpcResponseParserUnitTest, ConvertAllNumbersToString) {
   }
 }
 
+// Times the big-integer pre-pass and the parse for a Solana
+// getProgramAccounts-like response of a few megabytes.
+TEST(JsonRpcResponseParserUnitTest, ConvertLargeProgramAccountsPerf) {
+  constexpr int kAccounts = 5000;
+  const std::string data(400, 'A');
+  std::string json = R"({"jsonrpc":"2.0","id":1,"result":[)";
+  for (int i = 0; i < kAccounts; ++i) {
+    base::StrAppend(
+        &json,
+        {i ? "," : "", R"({"account":{"data":[")", data,
+         R"(","base64"],"executable":false,"lamports":18446744073709551615,)",
+         R"("owner":"TokenkegQfeZyiNwAJbNbGKPFXCWuBvf9Ss623VQ5DA",)",
+         R"("rentEpoch":18446744073709551615,"space":165},)",
+         R"("pubkey":"pubkey)", base::NumberToString(i), R"("})"});
+  }
+  json += "]}";
+
+  base::ElapsedTimer convert_timer;
+  std::optional<std::string> converted =
+      ConvertMultiUint64InObjectArrayToString(
+          "/result", "/account", {"lamports", "rentEpoch"}, json);
+  const base::TimeDelta convert_time = convert_timer.Elapsed();
+  ASSERT_TRUE(converted);
+
+  base::ElapsedTimer parse_timer;
+  std::optional<base::Value> value =
+      base::JSONReader::Read(*converted, base::JSON_PARSE_RFC);
+  const base::TimeDelta parse_time = parse_timer.Elapsed();
+  ASSERT_TRUE(value);
+  ASSERT_EQ(static_cast<size_t>(kAccounts),
+            value->GetDict().FindList("result")->size());
+
+  perf_test::PerfResultReporter reporter("JsonRpcResponseParser",
+                                         "ProgramAccounts");
+  reporter.RegisterImportantMetric(".size", "KB");
+  reporter.RegisterImportantMetric(".convert", "ms");
+  reporter.RegisterImportantMetric(".parse", "ms");
+  reporter.AddResult(".size", json.size() / 1024.0);
+  reporter.AddResult(".convert", convert_time.InMillisecondsF());
+  reporter.AddResult(".parse", parse_time.InMillisecondsF());
+}
+
 }  // namespace brave_wallet
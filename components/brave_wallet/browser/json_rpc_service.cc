@@ -20,9 +20,12 @@
 #include "base/containers/fixed_flat_map.h"
 #include "base/containers/flat_set.h"
 #include "base/containers/map_util.h"
+#include "base/feature_list.h"
 #include "base/functional/bind.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/no_destructor.h"
 #include "base/notreached.h"
+#include "base/strings/strcat.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
@@ -36,6 +39,7 @@
 #include "brave/components/brave_wallet/browser/eth_response_parser.h"
 #include "brave/components/brave_wallet/browser/fil_requests.h"
 #include "brave/components/brave_wallet/browser/fil_response_parser.h"
+#include "brave/components/brave_wallet/browser/json_rpc_request_batcher.h"
 #include "brave/components/brave_wallet/browser/json_rpc_requests_helper.h"
 #include "brave/components/brave_wallet/browser/json_rpc_response_parser.h"
 #include "brave/components/brave_wallet/browser/network_manager.h"
@@ -53,6 +57,7 @@
 #include "brave/components/brave_wallet/common/eth_abi_utils.h"
 #include "brave/components/brave_wallet/common/eth_address.h"
 #include "brave/components/brave_wallet/common/eth_request_helper.h"
+#include "brave/components/brave_wallet/common/features.h"
 #include "brave/components/brave_wallet/common/hash_utils.h"
 #include "brave/components/brave_wallet/common/hex_utils.h"
 #include "brave/components/decentralized_dns/core/constants.h"
@@ -128,6 +133,23 @@ using brave_wallet::mojom::ResolveMethod;
 using decentralized_dns::EnsOffchainResolveMethod;
 using decentralized_dns::ResolveMethodTypes;
 
+constexpr size_t kMaxCachedDnsResolutions = 100;
+
+// Reports how long a multichain Unstoppable Domains DNS resolution took.
+void RecordUnstoppableDomainsResolveDnsTime(
+    base::TimeTicks start_time,
+    JsonRpcService::UnstoppableDomainsResolveDnsCallback callback,
+    const std::optional<GURL>& url,
+    mojom::ProviderError error,
+    const std::string& error_message) {
+  base::UmaHistogramMediumTimes("Brave.Wallet.UnstoppableDomainsResolveDnsTime",
+                                base::TimeTicks::Now() - start_time);
+  std::move(callback).Run(url, error, error_message);
+}
+constexpr char kEnsCacheKeyPrefix[] = "ens:";
+constexpr char kSnsCacheKeyPrefix[] = "sns:";
+constexpr char kUnstoppableDomainsCacheKeyPrefix[] = "ud:";
+
 // The domain name should be a-z | A-Z | 0-9 and hyphen(-).
 // The domain name should not start or end with hyphen (-).
 // The domain name can be a subdomain.
@@ -361,10 +383,19 @@ JsonRpcService::JsonRpcService(
 
   api_request_helper_ens_offchain_ = std::make_unique<APIRequestHelper>(
       GetENSOffchainNetworkTrafficAnnotationTag(), url_loader_factory);
+  request_batcher_ =
+      std::make_unique<JsonRpcRequestBatcher>(api_request_helper_.get());
 
   nft_metadata_fetcher_ =
       std::make_unique<NftMetadataFetcher>(url_loader_factory, this, prefs_);
   simple_hash_client_ = std::make_unique<SimpleHashClient>(url_loader_factory);
+
+  if (base::FeatureList::IsEnabled(
+          features::kBraveWalletDecentralizedDnsCacheFeature)) {
+    dns_resolution_cache_.emplace(kMaxCachedDnsResolutions);
+    dns_resolution_cache_ttl_ =
+        base::Minutes(features::kDecentralizedDnsCacheTtlMinutes.Get());
+  }
 }
 
 void JsonRpcService::SetAPIRequestHelperForTesting(
@@ -373,6 +404,8 @@ void JsonRpcService::SetAPIRequestHelperForTesting(
       GetNetworkTrafficAnnotationTag(), url_loader_factory);
   api_request_helper_ens_offchain_ = std::make_unique<APIRequestHelper>(
       GetENSOffchainNetworkTrafficAnnotationTag(), url_loader_factory);
+  request_batcher_ =
+      std::make_unique<JsonRpcRequestBatcher>(api_request_helper_.get());
 }
 
 JsonRpcService::~JsonRpcService() = default;
@@ -398,13 +431,23 @@ void JsonRpcService::RequestInternal(
     const GURL& network_url,
     RequestIntermediateCallback callback,
     APIRequestHelper::ResponseConversionCallback conversion_callback =
-        base::NullCallback()) {
+        base::NullCallback(),
+    bool bypass_response_cache = false) {
   if (!network_url.is_valid()) {
     std::move(callback).Run(
         APIRequestResult(400, {}, {}, net::ERR_UNEXPECTED, GURL()));
     return;
   }
 
+  // Responses which need a conversion are not shared, so only the remaining
+  // ones go through the batcher.
+  if (!conversion_callback) {
+    request_batcher_->Request(json_payload, auto_retry_on_network_change,
+                              network_url, std::move(callback),
+                              bypass_response_cache);
+    return;
+  }
+
   api_request_helper_->Request(
       "POST", network_url, json_payload, "application/json",
       std::move(callback), MakeCommonJsonRpcHeaders(json_payload, network_url),
@@ -421,7 +464,10 @@ void JsonRpcService::Request(
                   true, GetNetworkURL(chain_id, mojom::CoinType::ETH),
                   base::BindOnce(&JsonRpcService::OnRequestResult,
                                  weak_ptr_factory_.GetWeakPtr(),
-                                 std::move(callback), std::move(request.id)));
+                                 std::move(callback), std::move(request.id)),
+                  base::NullCallback(),
+                  // Dapps may poll for fresh state on their own.
+                  /*bypass_response_cache=*/true);
 }
 
 void JsonRpcService::OnRequestResult(
@@ -1463,6 +1509,18 @@ void JsonRpcService::OnGetERC20TokenBalances(
 
 void JsonRpcService::EnsGetContentHash(const std::string& domain,
                                        EnsGetContentHashCallback callback) {
+  if (dns_resolution_cache_) {
+    const std::string key = base::StrCat({kEnsCacheKeyPrefix, domain});
+    if (const auto* cached = GetCachedDnsResolution(key)) {
+      std::move(callback).Run(cached->content_hash, false,
+                              mojom::ProviderError::kSuccess, "");
+      return;
+    }
+    callback = base::BindOnce(&JsonRpcService::OnEnsGetContentHashForCache,
+                              weak_ptr_factory_.GetWeakPtr(), key,
+                              std::move(callback));
+  }
+
   if (ens_get_content_hash_tasks_.ContainsTaskForDomain(domain)) {
     ens_get_content_hash_tasks_.AddCallbackForDomain(domain,
                                                      std::move(callback));
@@ -1667,6 +1725,18 @@ void JsonRpcService::SnsResolveHost(const std::string& domain,
     return;
   }
 
+  if (dns_resolution_cache_) {
+    const std::string key = base::StrCat({kSnsCacheKeyPrefix, domain});
+    if (const auto* cached = GetCachedDnsResolution(key)) {
+      std::move(callback).Run(cached->url, mojom::SolanaProviderError::kSuccess,
+                              "");
+      return;
+    }
+    callback = base::BindOnce(&JsonRpcService::OnSnsResolveHostForCache,
+                              weak_ptr_factory_.GetWeakPtr(), key,
+                              std::move(callback));
+  }
+
   if (sns_resolve_host_tasks_.ContainsTaskForDomain(domain)) {
     sns_resolve_host_tasks_.AddCallbackForDomain(domain, std::move(callback));
     return;
@@ -1752,6 +1822,18 @@ void JsonRpcService::OnEnsGetContentHashTaskDone(
 void JsonRpcService::UnstoppableDomainsResolveDns(
     const std::string& domain,
     UnstoppableDomainsResolveDnsCallback callback) {
+  if (dns_resolution_cache_) {
+    const std::string key =
+        base::StrCat({kUnstoppableDomainsCacheKeyPrefix, domain});
+    if (const auto* cached = GetCachedDnsResolution(key)) {
+      std::move(callback).Run(cached->url, mojom::ProviderError::kSuccess, "");
+      return;
+    }
+    callback = base::BindOnce(
+        &JsonRpcService::OnUnstoppableDomainsResolveDnsForCache,
+        weak_ptr_factory_.GetWeakPtr(), key, std::move(callback));
+  }
+
   if (ud_resolve_dns_calls_.HasCall(domain)) {
     ud_resolve_dns_calls_.AddCallback(domain, std::move(callback));
     return;
@@ -1772,7 +1854,9 @@ void JsonRpcService::UnstoppableDomainsResolveDns(
     return;
   }
 
-  ud_resolve_dns_calls_.AddCallback(domain, std::move(callback));
+  ud_resolve_dns_calls_.AddCallback(
+      domain, base::BindOnce(&RecordUnstoppableDomainsResolveDnsTime,
+                             base::TimeTicks::Now(), std::move(callback)));
   for (const auto [chain_id, address] :
        kUnstoppableDomainsProxyReaderContractAddresses) {
     auto internal_callback = base::BindOnce(
@@ -1816,6 +1900,74 @@ void JsonRpcService::OnUnstoppableDomainsResolveDns(
   ud_resolve_dns_calls_.SetResult(domain, chain_id, std::move(resolved_url));
 }
 
+const JsonRpcService::CachedDnsResolution*
+JsonRpcService::GetCachedDnsResolution(const std::string& key) {
+  auto it = dns_resolution_cache_->Get(key);
+  const bool hit = it != dns_resolution_cache_->end() &&
+                   it->second.expiration_time > base::TimeTicks::Now();
+  base::UmaHistogramBoolean("Brave.Wallet.DecentralizedDnsCacheHit", hit);
+  if (it == dns_resolution_cache_->end()) {
+    return nullptr;
+  }
+  if (!hit) {
+    // Expired, so that content hash or URL record changes are picked up.
+    dns_resolution_cache_->Erase(it);
+    return nullptr;
+  }
+  return &it->second;
+}
+
+void JsonRpcService::CacheDnsResolution(const std::string& key,
+                                        std::vector<uint8_t> content_hash,
+                                        GURL url) {
+  dns_resolution_cache_->Put(
+      key, {.content_hash = std::move(content_hash),
+            .url = std::move(url),
+            .expiration_time =
+                base::TimeTicks::Now() + dns_resolution_cache_ttl_});
+}
+
+void JsonRpcService::OnEnsGetContentHashForCache(
+    const std::string& key,
+    EnsGetContentHashCallback callback,
+    const std::vector<uint8_t>& content_hash,
+    bool require_offchain_consent,
+    mojom::ProviderError error,
+    const std::string& error_message) {
+  // Results that still need the user's offchain consent are not final.
+  if (error == mojom::ProviderError::kSuccess && !require_offchain_consent &&
+      !content_hash.empty()) {
+    CacheDnsResolution(key, content_hash, GURL());
+  }
+  std::move(callback).Run(content_hash, require_offchain_consent, error,
+                          error_message);
+}
+
+void JsonRpcService::OnSnsResolveHostForCache(
+    const std::string& key,
+    SnsResolveHostCallback callback,
+    const std::optional<GURL>& url,
+    mojom::SolanaProviderError error,
+    const std::string& error_message) {
+  if (error == mojom::SolanaProviderError::kSuccess && url &&
+      url->is_valid()) {
+    CacheDnsResolution(key, {}, *url);
+  }
+  std::move(callback).Run(url, error, error_message);
+}
+
+void JsonRpcService::OnUnstoppableDomainsResolveDnsForCache(
+    const std::string& key,
+    UnstoppableDomainsResolveDnsCallback callback,
+    const std::optional<GURL>& url,
+    mojom::ProviderError error,
+    const std::string& error_message) {
+  if (error == mojom::ProviderError::kSuccess && url && url->is_valid()) {
+    CacheDnsResolution(key, {}, *url);
+  }
+  std::move(callback).Run(url, error, error_message);
+}
+
 void JsonRpcService::UnstoppableDomainsGetWalletAddr(
     const std::string& domain,
     mojom::BlockchainTokenPtr token,
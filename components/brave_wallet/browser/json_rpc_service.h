@@ -13,11 +13,13 @@
 #include <vector>
 
 #include "base/containers/flat_map.h"
+#include "base/containers/lru_cache.h"
 #include "base/containers/span.h"
 #include "base/functional/callback.h"
 #include "base/gtest_prod_util.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_wallet/browser/ens_resolver_task.h"
 #include "brave/components/brave_wallet/browser/simple_hash_client.h"
@@ -44,6 +46,7 @@ class PrefService;
 namespace brave_wallet {
 
 class EnsResolverTask;
+class JsonRpcRequestBatcher;
 class NftMetadataFetcher;
 class NetworkManager;
 struct PendingAddChainRequest;
@@ -640,6 +643,35 @@ class JsonRpcService : public mojom::JsonRpcService {
   void OnUnstoppableDomainsResolveDns(const std::string& domain,
                                       const std::string& chain_id,
                                       APIRequestResult api_request_result);
+
+  // A successful decentralized DNS resolution. Only one of `content_hash`
+  // (ENS) or `url` (SNS, Unstoppable Domains) is set.
+  struct CachedDnsResolution {
+    std::vector<uint8_t> content_hash;
+    GURL url;
+    base::TimeTicks expiration_time;
+  };
+  const CachedDnsResolution* GetCachedDnsResolution(const std::string& key);
+  void CacheDnsResolution(const std::string& key,
+                          std::vector<uint8_t> content_hash,
+                          GURL url);
+  void OnEnsGetContentHashForCache(const std::string& key,
+                                   EnsGetContentHashCallback callback,
+                                   const std::vector<uint8_t>& content_hash,
+                                   bool require_offchain_consent,
+                                   mojom::ProviderError error,
+                                   const std::string& error_message);
+  void OnSnsResolveHostForCache(const std::string& key,
+                                SnsResolveHostCallback callback,
+                                const std::optional<GURL>& url,
+                                mojom::SolanaProviderError error,
+                                const std::string& error_message);
+  void OnUnstoppableDomainsResolveDnsForCache(
+      const std::string& key,
+      UnstoppableDomainsResolveDnsCallback callback,
+      const std::optional<GURL>& url,
+      mojom::ProviderError error,
+      const std::string& error_message);
   void OnUnstoppableDomainsGetWalletAddr(
       const unstoppable_domains::WalletAddressKey& key,
       const std::string& chain_id,
@@ -683,7 +715,8 @@ class JsonRpcService : public mojom::JsonRpcService {
       bool auto_retry_on_network_change,
       const GURL& network_url,
       RequestIntermediateCallback callback,
-      APIRequestHelper::ResponseConversionCallback conversion_callback);
+      APIRequestHelper::ResponseConversionCallback conversion_callback,
+      bool bypass_response_cache);
   void OnEthChainIdValidatedForOrigin(const std::string& chain_id,
                                       const GURL& rpc_url,
                                       APIRequestResult api_request_result);
@@ -814,6 +847,7 @@ class JsonRpcService : public mojom::JsonRpcService {
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   std::unique_ptr<APIRequestHelper> api_request_helper_;
   std::unique_ptr<APIRequestHelper> api_request_helper_ens_offchain_;
+  std::unique_ptr<JsonRpcRequestBatcher> request_batcher_;
   base::flat_map<std::string, PendingAddChainRequest>
       add_chain_pending_requests_;
   base::flat_map<std::string, PendingSwitchChainRequest>
@@ -834,6 +868,12 @@ class JsonRpcService : public mojom::JsonRpcService {
   SnsResolverTaskContainer<SnsGetSolAddrCallback> sns_get_sol_addr_tasks_;
   SnsResolverTaskContainer<SnsResolveHostCallback> sns_resolve_host_tasks_;
 
+  // Only set when kBraveWalletDecentralizedDnsCacheFeature is enabled.
+  // <resolver, domain>, resolution
+  std::optional<base::LRUCache<std::string, CachedDnsResolution>>
+      dns_resolution_cache_;
+  base::TimeDelta dns_resolution_cache_ttl_;
+
   bool skip_eth_chain_id_validation_for_testing_ = false;
   std::optional<std::string> gas_price_for_testing_;
 
@@ -30,6 +30,7 @@
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/test/bind.h"
+#include "base/test/metrics/histogram_tester.h"
 #include "base/test/mock_callback.h"
 #include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
@@ -3753,6 +3754,43 @@ TEST_F(UnstoppableDomainsUnitTest, ResolveDns_ManyCalls) {
   testing::Mock::VerifyAndClearExpectations(&callback3);
 }
 
+class UnstoppableDomainsDnsCacheUnitTest : public UnstoppableDomainsUnitTest {
+ public:
+  UnstoppableDomainsDnsCacheUnitTest() {
+    feature_list_.InitAndEnableFeature(
+        features::kBraveWalletDecentralizedDnsCacheFeature);
+  }
+
+ private:
+  base::test::ScopedFeatureList feature_list_;
+};
+
+TEST_F(UnstoppableDomainsDnsCacheUnitTest, ResolveDns_ServedFromCache) {
+  base::HistogramTester histogram_tester;
+  eth_mainnet_getmany_call_handler_->AddItem(
+      "brave.crypto", unstoppable_domains::kRecordKeys[5], "https://brave.com");
+
+  base::MockCallback<ResolveDnsCallback> callback;
+  EXPECT_CALL(callback, Run(std::optional<GURL>("https://brave.com"),
+                            mojom::ProviderError::kSuccess, ""));
+  json_rpc_service_->UnstoppableDomainsResolveDns("brave.crypto",
+                                                  callback.Get());
+  WaitAndVerify(&callback);
+  EXPECT_EQ(1, eth_mainnet_getmany_call_handler_->calls_number());
+  histogram_tester.ExpectUniqueSample("Brave.Wallet.DecentralizedDnsCacheHit",
+                                      false, 1);
+
+  // The second resolution does not hit the network.
+  EXPECT_CALL(callback, Run(std::optional<GURL>("https://brave.com"),
+                            mojom::ProviderError::kSuccess, ""));
+  json_rpc_service_->UnstoppableDomainsResolveDns("brave.crypto",
+                                                  callback.Get());
+  WaitAndVerify(&callback);
+  EXPECT_EQ(1, eth_mainnet_getmany_call_handler_->calls_number());
+  histogram_tester.ExpectBucketCount("Brave.Wallet.DecentralizedDnsCacheHit",
+                                     true, 1);
+}
+
 TEST_F(JsonRpcServiceUnitTest, GetBaseFeePerGas) {
   bool callback_called = false;
   GURL expected_network =
@@ -17,6 +17,7 @@
 #include "base/check_is_test.h"
 #include "base/check_op.h"
 #include "base/command_line.h"
+#include "base/containers/contains.h"
 #include "base/containers/span.h"
 #include "base/functional/callback_helpers.h"
 #include "base/json/json_reader.h"
@@ -27,6 +28,7 @@
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/thread_pool.h"
 #include "base/value_iterators.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/browser/bip39.h"
@@ -1044,6 +1046,37 @@ std::optional<KeyringSeed> MakeSeedFromMnemonic(
   return result;
 }
 
+// Everything CreateWalletWithSecrets needs that is expensive to compute: the
+// keyring seeds (PBKDF2 over the mnemonic) and the password encryptor (PBKDF2
+// over the password).
+struct WalletSecrets {
+  WalletSecrets() = default;
+  WalletSecrets(WalletSecrets&&) = default;
+  WalletSecrets& operator=(WalletSecrets&&) = default;
+  ~WalletSecrets() = default;
+
+  std::optional<KeyringSeed> keyring_seed;
+  std::array<uint8_t, kEncryptorSaltSize> salt = {};
+  std::unique_ptr<PasswordEncryptor> encryptor;
+};
+
+// Safe to run on any sequence.
+WalletSecrets DeriveWalletSecrets(
+    const std::string& mnemonic,
+    const std::string& password,
+    bool is_legacy_eth_seed_format,
+    std::array<uint8_t, kEncryptorSaltSize> salt) {
+  WalletSecrets secrets;
+  secrets.keyring_seed =
+      MakeSeedFromMnemonic(mnemonic, is_legacy_eth_seed_format);
+  if (!secrets.keyring_seed) {
+    return secrets;
+  }
+  secrets.salt = salt;
+  secrets.encryptor = PasswordEncryptor::CreateEncryptor(password, salt);
+  return secrets;
+}
+
 KeyringService::KeyringService(JsonRpcService* json_rpc_service,
                                PrefService* profile_prefs,
                                PrefService* local_state)
@@ -1125,17 +1158,26 @@ bool KeyringService::CreateWalletInternal(const std::string& mnemonic,
   if (encryptor_) {
     return false;
   }
-  auto keyring_seed = MakeSeedFromMnemonic(mnemonic, is_legacy_eth_seed_format);
-  if (!keyring_seed) {
+  auto secrets = DeriveWalletSecrets(mnemonic, password,
+                                     is_legacy_eth_seed_format,
+                                     CreateSaltArray());
+  if (!secrets.keyring_seed || !secrets.encryptor) {
     return false;
   }
 
-  auto salt = CreateSaltArray();
-  auto encryptor = PasswordEncryptor::CreateEncryptor(password, salt);
-  if (!encryptor) {
-    return false;
-  }
-  encryptor_ = std::move(encryptor);
+  CreateWalletWithSecrets(mnemonic, is_legacy_eth_seed_format, from_restore,
+                          std::move(secrets));
+  return true;
+}
+
+void KeyringService::CreateWalletWithSecrets(const std::string& mnemonic,
+                                             bool is_legacy_eth_seed_format,
+                                             bool from_restore,
+                                             WalletSecrets secrets) {
+  CHECK(!encryptor_);
+  CHECK(secrets.keyring_seed);
+  CHECK(secrets.encryptor);
+  encryptor_ = std::move(secrets.encryptor);
 
   profile_prefs_->SetBoolean(kBraveWalletKeyringEncryptionKeysMigrated, true);
   profile_prefs_->SetBoolean(kBraveWalletLegacyEthSeedFormat,
@@ -1145,9 +1187,9 @@ bool KeyringService::CreateWalletInternal(const std::string& mnemonic,
       encryptor_->EncryptToDict(base::as_byte_span(mnemonic),
                                 CreateNonceArray()));
   profile_prefs_->SetString(kBraveWalletEncryptorSalt,
-                            base::Base64Encode(salt));
+                            base::Base64Encode(secrets.salt));
 
-  CreateKeyrings(*keyring_seed);
+  CreateKeyrings(*secrets.keyring_seed);
   CreateDefaultAccounts();
 
   for (const auto& observer : observers_) {
@@ -1160,8 +1202,6 @@ bool KeyringService::CreateWalletInternal(const std::string& mnemonic,
 
   ResetAutoLockTimer();
   UpdateLastUnlockPref(local_state_);
-
-  return true;
 }
 
 bool KeyringService::IsKeyringEnabled(mojom::KeyringId keyring_id) const {
@@ -1492,13 +1532,46 @@ void KeyringService::RestoreWallet(const std::string& mnemonic,
                                    const std::string& password,
                                    bool is_legacy_eth_seed_format,
                                    RestoreWalletCallback callback) {
-  bool is_valid_mnemonic =
-      RestoreWalletSync(mnemonic, password, is_legacy_eth_seed_format);
-  if (!is_valid_mnemonic) {
+  MaybeRunPasswordMigrations(profile_prefs_, password);
+
+  if (CanResumeWallet(mnemonic, password, is_legacy_eth_seed_format)) {
+    Unlock(password, base::DoNothing());
+    OnWalletRestored(std::move(callback));
+    return;
+  }
+
+  Reset(false);
+
+  // Deriving the seeds and the encryptor runs several thousand PBKDF2
+  // iterations, so keep it off the calling sequence.
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::TaskPriority::USER_BLOCKING,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(&DeriveWalletSecrets, mnemonic, password,
+                     is_legacy_eth_seed_format, CreateSaltArray()),
+      base::BindOnce(&KeyringService::OnRestoreWalletSecretsDerived,
+                     weak_ptr_factory_.GetWeakPtr(), mnemonic,
+                     is_legacy_eth_seed_format, std::move(callback)));
+}
+
+void KeyringService::OnRestoreWalletSecretsDerived(
+    const std::string& mnemonic,
+    bool is_legacy_eth_seed_format,
+    RestoreWalletCallback callback,
+    WalletSecrets secrets) {
+  // A wallet may have been created while the secrets were being derived.
+  if (encryptor_ || !secrets.keyring_seed || !secrets.encryptor) {
     std::move(callback).Run(false);
     return;
   }
 
+  CreateWalletWithSecrets(mnemonic, is_legacy_eth_seed_format,
+                          /*from_restore=*/true, std::move(secrets));
+  OnWalletRestored(std::move(callback));
+}
+
+void KeyringService::OnWalletRestored(RestoreWalletCallback callback) {
   // Only register the component if restore is successful.
   WalletDataFilesInstaller::GetInstance()
       .MaybeRegisterWalletDataFilesComponentOnDemand(base::BindOnce(
@@ -2449,17 +2522,13 @@ void KeyringService::SetSelectedAccount(mojom::AccountIdPtr account_id,
 }
 
 bool KeyringService::SetSelectedAccountSync(mojom::AccountIdPtr account_id) {
-  std::vector<mojom::AccountInfoPtr> infos =
-      GetAccountInfosForKeyring(account_id->keyring_id);
-
-  for (const mojom::AccountInfoPtr& info : infos) {
-    if (info->account_id == account_id) {
-      SetSelectedAccountInternal(*info);
-      return true;
-    }
+  auto* info = FindAccountInfo(account_id);
+  if (!info) {
+    return false;
   }
 
-  return false;
+  SetSelectedAccountInternal(*info);
+  return true;
 }
 
 void KeyringService::SetAccountName(mojom::AccountIdPtr account_id,
@@ -2663,7 +2732,17 @@ void KeyringService::ValidatePassword(const std::string& password,
                                       ValidatePasswordCallback callback) {
   MaybeRunPasswordMigrations(profile_prefs_, password);
 
-  std::move(callback).Run(ValidatePasswordInternal(password));
+  PasswordEncryptor::CreateEncryptorAsync(
+      password, GetSaltFromPrefs(profile_prefs_),
+      base::BindOnce(&KeyringService::OnValidatePasswordEncryptor,
+                     weak_ptr_factory_.GetWeakPtr(), std::move(callback)));
+}
+
+void KeyringService::OnValidatePasswordEncryptor(
+    ValidatePasswordCallback callback,
+    std::unique_ptr<PasswordEncryptor> encryptor) {
+  std::move(callback).Run(
+      encryptor && DecryptWalletMnemonicFromPrefs(profile_prefs_, *encryptor));
 }
 
 void KeyringService::GetChecksumEthAddress(
@@ -3122,24 +3201,20 @@ KeyringService::GetBitcoinAddresses(const mojom::AccountIdPtr& account_id) {
     return std::nullopt;
   }
 
-  std::vector<mojom::BitcoinAddressPtr> addresses;
-  for (auto i = 0u;
-       i <= bitcoin_account_info->next_receive_address->key_id->index; ++i) {
-    addresses.emplace_back(bitcoin_keyring->GetAddress(
-        account_id->account_index,
-        mojom::BitcoinKeyId(kBitcoinReceiveIndex, i)));
-    if (!addresses.back()) {
-      return std::nullopt;
-    }
+  auto addresses = bitcoin_keyring->GetAddresses(
+      account_id->account_index, kBitcoinReceiveIndex, 0,
+      bitcoin_account_info->next_receive_address->key_id->index + 1);
+  if (addresses.empty()) {
+    return std::nullopt;
   }
-  for (auto i = 0u;
-       i <= bitcoin_account_info->next_change_address->key_id->index; ++i) {
-    addresses.emplace_back(bitcoin_keyring->GetAddress(
-        account_id->account_index,
-        mojom::BitcoinKeyId(kBitcoinChangeIndex, i)));
-    if (!addresses.back()) {
-      return std::nullopt;
-    }
+  auto change_addresses = bitcoin_keyring->GetAddresses(
+      account_id->account_index, kBitcoinChangeIndex, 0,
+      bitcoin_account_info->next_change_address->key_id->index + 1);
+  if (change_addresses.empty()) {
+    return std::nullopt;
+  }
+  for (auto& address : change_addresses) {
+    addresses.push_back(std::move(address));
   }
 
   return addresses;
@@ -3291,6 +3366,7 @@ std::optional<std::vector<uint8_t>> KeyringService::SignMessageByZCashKeyring(
 
 void KeyringService::ResetAllAccountInfosCache() {
   account_info_cache_.reset();
+  account_info_index_.clear();
 }
 
 const std::vector<mojom::AccountInfoPtr>& KeyringService::GetAllAccountInfos() {
@@ -3302,36 +3378,56 @@ const std::vector<mojom::AccountInfoPtr>& KeyringService::GetAllAccountInfos() {
         account_info_cache_->push_back(std::move(account_info));
       }
     }
+
+    std::vector<std::pair<std::string, size_t>> index;
+    index.reserve(account_info_cache_->size());
+    for (size_t i = 0; i < account_info_cache_->size(); ++i) {
+      index.emplace_back((*account_info_cache_)[i]->account_id->unique_key, i);
+    }
+    account_info_index_ =
+        base::flat_map<std::string, size_t>(std::move(index));
   }
   return *account_info_cache_;
 }
 
-mojom::AccountInfoPtr KeyringService::FindAccount(
-    const mojom::AccountIdPtr& account_id) {
+const mojom::AccountInfo* KeyringService::FindAccountInfoByUniqueKey(
+    const std::string& unique_key) {
   const auto& accounts = GetAllAccountInfos();
-  for (auto& account : accounts) {
-    if (account->account_id == account_id) {
-      return account.Clone();
-    }
+  auto it = account_info_index_.find(unique_key);
+  if (it == account_info_index_.end()) {
+    return nullptr;
   }
-  return nullptr;
+  return accounts[it->second].get();
+}
+
+const mojom::AccountInfo* KeyringService::FindAccountInfo(
+    const mojom::AccountIdPtr& account_id) {
+  if (!account_id) {
+    return nullptr;
+  }
+  auto* account = FindAccountInfoByUniqueKey(account_id->unique_key);
+  if (!account || account->account_id != account_id) {
+    return nullptr;
+  }
+  return account;
+}
+
+mojom::AccountInfoPtr KeyringService::FindAccount(
+    const mojom::AccountIdPtr& account_id) {
+  auto* account = FindAccountInfo(account_id);
+  return account ? account->Clone() : nullptr;
 }
 
 mojom::AccountInfoPtr KeyringService::GetSelectedWalletAccount() {
   const auto& account_infos = GetAllAccountInfos();
-  auto unique_key =
-      profile_prefs_->GetString(kBraveWalletSelectedWalletAccount);
-
-  mojom::AccountInfoPtr first_account;
-  for (auto& account_info : account_infos) {
-    if (account_info->account_id->unique_key == unique_key) {
-      return account_info->Clone();
-    }
-    if (!first_account) {
-      first_account = account_info->Clone();
-    }
+  if (auto* account = FindAccountInfoByUniqueKey(
+          profile_prefs_->GetString(kBraveWalletSelectedWalletAccount))) {
+    return account->Clone();
+  }
+  if (account_infos.empty()) {
+    return nullptr;
   }
-  return first_account;
+  return account_infos.front()->Clone();
 }
 
 mojom::AccountInfoPtr KeyringService::GetSelectedEthereumDappAccount() {
@@ -3366,14 +3462,10 @@ mojom::AccountInfoPtr KeyringService::GetSelectedDappAccount(
       NOTREACHED();
   }
 
-  auto unique_key = GetSelectedDappAccountFromPrefs(profile_prefs_, coin);
-
-  for (auto keyring_id : keyring_ids) {
-    for (auto& account_info : GetAccountInfosForKeyring(keyring_id)) {
-      if (account_info->account_id->unique_key == unique_key) {
-        return account_info->Clone();
-      }
-    }
+  auto* account = FindAccountInfoByUniqueKey(
+      GetSelectedDappAccountFromPrefs(profile_prefs_, coin));
+  if (account && base::Contains(keyring_ids, account->account_id->keyring_id)) {
+    return account->Clone();
   }
 
   return {};
@@ -12,8 +12,10 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/gtest_prod_util.h"
 #include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
 #include "base/types/expected.h"
 #include "brave/components/brave_wallet/browser/cardano/cardano_hd_keyring.h"
 #include "brave/components/brave_wallet/browser/polkadot/polkadot_utils.h"
@@ -54,6 +56,7 @@ class SolanaKeyring;
 class SolanaProviderImplUnitTest;
 class ZCashKeyring;
 struct KeyringSeed;
+struct WalletSecrets;
 
 // Allows tests to set a custom nonce generation callback. Caller is expected to
 // keep the callback alive.
@@ -287,6 +290,12 @@ class KeyringService : public mojom::KeyringService {
   GetPolkadotPubKey(const mojom::AccountIdPtr& account_id);
 
   const std::vector<mojom::AccountInfoPtr>& GetAllAccountInfos();
+  // Looks up an account in the in-memory account cache. The returned pointer
+  // is invalidated by any account change.
+  const mojom::AccountInfo* FindAccountInfo(
+      const mojom::AccountIdPtr& account_id);
+  const mojom::AccountInfo* FindAccountInfoByUniqueKey(
+      const std::string& unique_key);
   mojom::AccountInfoPtr FindAccount(const mojom::AccountIdPtr& account_id);
   mojom::AccountInfoPtr GetSelectedWalletAccount();
   mojom::AccountInfoPtr GetSelectedEthereumDappAccount();
@@ -391,6 +400,15 @@ class KeyringService : public mojom::KeyringService {
                             const std::string& password,
                             bool is_legacy_eth_seed_format,
                             bool from_restore);
+  void CreateWalletWithSecrets(const std::string& mnemonic,
+                               bool is_legacy_eth_seed_format,
+                               bool from_restore,
+                               WalletSecrets secrets);
+  void OnRestoreWalletSecretsDerived(const std::string& mnemonic,
+                                     bool is_legacy_eth_seed_format,
+                                     RestoreWalletCallback callback,
+                                     WalletSecrets secrets);
+  void OnWalletRestored(RestoreWalletCallback callback);
   void CreateKeyringInternal(mojom::KeyringId keyring_id,
                              const KeyringSeed& keyring_seed);
   bool IsKeyringEnabled(mojom::KeyringId keyring_id) const;
@@ -420,12 +438,17 @@ class KeyringService : public mojom::KeyringService {
                            mojom::KeyringId keyring_id);
 
   bool ValidatePasswordInternal(const std::string& password);
+  void OnValidatePasswordEncryptor(
+      ValidatePasswordCallback callback,
+      std::unique_ptr<PasswordEncryptor> encryptor);
   std::optional<std::string> GetWalletMnemonicInternal(
       const std::string& password);
   bool CreateEncryptorAndValidatePasswordInternal(const std::string& password);
   void MaybeUnlockWithCommandLine();
 
   std::unique_ptr<std::vector<mojom::AccountInfoPtr>> account_info_cache_;
+  // Index into `account_info_cache_` by account unique key.
+  base::flat_map<std::string, size_t> account_info_index_;
   std::unique_ptr<base::OneShotTimer> auto_lock_timer_;
   std::unique_ptr<PrefChangeRegistrar> pref_change_registrar_;
 
@@ -464,6 +487,8 @@ class KeyringService : public mojom::KeyringService {
   mojo::RemoteSet<mojom::KeyringServiceObserver> observers_;
   mojo::ReceiverSet<mojom::KeyringService> receivers_;
 
+  base::WeakPtrFactory<KeyringService> weak_ptr_factory_{this};
+
   KeyringService(const KeyringService&) = delete;
   KeyringService& operator=(const KeyringService&) = delete;
 };
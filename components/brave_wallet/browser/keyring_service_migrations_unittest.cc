@@ -455,6 +455,8 @@ class KeyringServiceMigrationsUnitTest : public testing::Test {
     return mnemonic;
   }
 
+  void RunUntilIdle() { task_environment_.RunUntilIdle(); }
+
  private:
   uint8_t next_nonce_ = 1;
   uint8_t next_salt_ = 1;
@@ -582,6 +584,7 @@ TEST_F(KeyringServiceMigrationsLegacyIterationsUnitTest,
   base::MockCallback<KeyringService::UnlockCallback> callback;
   EXPECT_CALL(callback, Run(true));
   service.ValidatePassword(kPassword, callback.Get());
+  RunUntilIdle();
   testing::Mock::VerifyAndClearExpectations(&callback);
 
   ValidatePrefs();
@@ -603,6 +606,7 @@ TEST_F(KeyringServiceMigrationsLegacyIterationsUnitTest,
   base::MockCallback<KeyringService::UnlockCallback> callback;
   EXPECT_CALL(callback, Run(false));
   service.ValidatePassword("wrong password", callback.Get());
+  RunUntilIdle();
   EXPECT_TRUE(service.IsLockedSync());
   testing::Mock::VerifyAndClearExpectations(&callback);
 
@@ -610,6 +614,7 @@ TEST_F(KeyringServiceMigrationsLegacyIterationsUnitTest,
 
   EXPECT_CALL(callback, Run(true));
   service.ValidatePassword(kPassword, callback.Get());
+  RunUntilIdle();
   testing::Mock::VerifyAndClearExpectations(&callback);
 
   ValidatePrefs();
@@ -628,8 +633,7 @@ TEST_F(KeyringServiceMigrationsLegacyIterationsUnitTest,
 
   KeyringService service(nullptr, GetPrefs(), GetLocalState());
 
-  service.RestoreWallet(kMnemonicDivideCruise, kPassword, false,
-                        base::DoNothing());
+  service.RestoreWalletSync(kMnemonicDivideCruise, kPassword, false);
 
   ValidatePrefs();
   ValidateAccounts(service);
@@ -643,8 +647,7 @@ TEST_F(KeyringServiceMigrationsLegacyIterationsUnitTest,
 
   KeyringService service(nullptr, GetPrefs(), GetLocalState());
 
-  service.RestoreWallet(kMnemonicDivideCruise, new_password, false,
-                        base::DoNothing());
+  service.RestoreWalletSync(kMnemonicDivideCruise, new_password, false);
 
   EXPECT_EQ(GetWalletMnemonic(new_password, &service), kMnemonicDivideCruise);
   // Just two default accounts.
@@ -771,6 +774,7 @@ TEST_F(KeyringServiceMigrationsLegacyMnemonicFormatUnitTest,
   base::MockCallback<KeyringService::UnlockCallback> callback;
   EXPECT_CALL(callback, Run(true));
   service.ValidatePassword(kPassword, callback.Get());
+  RunUntilIdle();
   testing::Mock::VerifyAndClearExpectations(&callback);
 
   ValidatePrefs();
@@ -792,6 +796,7 @@ TEST_F(KeyringServiceMigrationsLegacyMnemonicFormatUnitTest,
   base::MockCallback<KeyringService::UnlockCallback> callback;
   EXPECT_CALL(callback, Run(false));
   service.ValidatePassword("wrong password", callback.Get());
+  RunUntilIdle();
   EXPECT_TRUE(service.IsLockedSync());
   testing::Mock::VerifyAndClearExpectations(&callback);
 
@@ -799,6 +804,7 @@ TEST_F(KeyringServiceMigrationsLegacyMnemonicFormatUnitTest,
 
   EXPECT_CALL(callback, Run(true));
   service.ValidatePassword(kPassword, callback.Get());
+  RunUntilIdle();
   testing::Mock::VerifyAndClearExpectations(&callback);
 
   ValidatePrefs();
@@ -817,8 +823,7 @@ TEST_F(KeyringServiceMigrationsLegacyMnemonicFormatUnitTest,
 
   KeyringService service(nullptr, GetPrefs(), GetLocalState());
 
-  service.RestoreWallet(kMnemonicDivideCruise, kPassword, false,
-                        base::DoNothing());
+  service.RestoreWalletSync(kMnemonicDivideCruise, kPassword, false);
 
   ValidatePrefs();
   ValidateAccounts(service);
@@ -832,8 +837,7 @@ TEST_F(KeyringServiceMigrationsLegacyMnemonicFormatUnitTest,
 
   KeyringService service(nullptr, GetPrefs(), GetLocalState());
 
-  service.RestoreWallet(kMnemonicDivideCruise, new_password, false,
-                        base::DoNothing());
+  service.RestoreWalletSync(kMnemonicDivideCruise, new_password, false);
 
   EXPECT_EQ(GetWalletMnemonic(new_password, &service), kMnemonicDivideCruise);
   // Just two default accounts.
@@ -25,6 +25,7 @@
 #include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
 #include "base/test/values_test_util.h"
+#include "brave/components/brave_wallet/browser/account_discovery_manager.h"
 #include "brave/components/brave_wallet/browser/bip39.h"
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_hd_keyring.h"
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_test_utils.h"
@@ -1972,6 +1973,64 @@ TEST_F(KeyringServiceUnitTest, SelectAddedFilecoinAccount) {
   ASSERT_EQ(service.GetSelectedWalletAccount(), last_fil);
 }
 
+TEST_F(KeyringServiceUnitTest, RestoreWalletDerivesSecretsAsync) {
+  KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+
+  auto restore = [&](const std::string& mnemonic) {
+    std::optional<bool> result;
+    base::RunLoop run_loop;
+    service.RestoreWallet(mnemonic, "brave", false,
+                          base::BindLambdaForTesting([&](bool success) {
+                            result = success;
+                            run_loop.Quit();
+                          }));
+    // Seeds are derived on a worker, so nothing is created yet.
+    EXPECT_FALSE(result);
+    EXPECT_FALSE(service.IsWalletCreatedSync());
+    run_loop.Run();
+    return *result;
+  };
+
+  EXPECT_FALSE(restore("not a valid mnemonic"));
+  EXPECT_FALSE(service.IsWalletCreatedSync());
+
+  EXPECT_TRUE(restore(kMnemonicDivideCruise));
+  EXPECT_TRUE(service.IsWalletCreatedSync());
+  EXPECT_FALSE(service.IsLockedSync());
+  EXPECT_EQ(service.GetAllAccountInfos()[0]->address,
+            "0xf81229FE54D8a20fBc1e1e2a3451D1c7489437Db");
+}
+
+TEST_F(KeyringServiceUnitTest, AccountInfoCacheTracksChanges) {
+  KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
+  ASSERT_TRUE(CreateWallet(&service, "brave"));
+
+  auto imported = ImportEthereumAccount(
+      &service, "Imported",
+      "d118a12a1e3b595d7d9e5599370df4ddc58d246a3ae4a795597e50eb6a32afb5");
+  ASSERT_TRUE(imported);
+  const auto* cached = service.FindAccountInfo(imported->account_id);
+  ASSERT_TRUE(cached);
+  EXPECT_EQ(cached->name, "Imported");
+  EXPECT_EQ(service.FindAccountInfoByUniqueKey(
+                imported->account_id->unique_key),
+            cached);
+
+  EXPECT_TRUE(SetAccountName(&service, imported->account_id.Clone(),
+                             "Renamed"));
+  EXPECT_EQ(service.FindAccount(imported->account_id)->name, "Renamed");
+
+  EXPECT_TRUE(SetSelectedAccount(&service, imported->account_id));
+  EXPECT_EQ(service.GetSelectedWalletAccount()->account_id->unique_key,
+            imported->account_id->unique_key);
+
+  EXPECT_TRUE(RemoveAccount(&service, imported->account_id, kPasswordBrave));
+  EXPECT_FALSE(service.FindAccountInfo(imported->account_id));
+  EXPECT_FALSE(service.FindAccount(imported->account_id));
+  EXPECT_EQ(service.GetSelectedWalletAccount(),
+            service.GetAllAccountInfos().front());
+}
+
 TEST_F(KeyringServiceUnitTest, SelectImportedFilecoinAccount) {
   KeyringService service(json_rpc_service(), GetPrefs(), GetLocalState());
   ASSERT_TRUE(CreateWallet(&service, "brave"));
@@ -3472,8 +3531,14 @@ TEST_F(KeyringServiceAccountDiscoveryUnitTest, StopsOnError) {
     EXPECT_EQ(account_infos[i]->address, saved_addresses()[i]);
     EXPECT_EQ(account_infos[i]->name, "Account " + base::NumberToString(i + 1));
   }
-  // Stopped after 8th attempt.
-  EXPECT_THAT(requested_addresses, ElementsAreArray(&saved_addresses()[1], 8));
+  // Stopped after 8th attempt. Addresses which follow it may have been probed
+  // ahead already.
+  EXPECT_GE(requested_addresses.size(), 8u);
+  EXPECT_LT(requested_addresses.size(),
+            8u + kMaxAccountDiscoveryProbesInFlight);
+  EXPECT_THAT(requested_addresses,
+              ElementsAreArray(&saved_addresses()[1],
+                               requested_addresses.size()));
 }
 
 TEST_F(KeyringServiceAccountDiscoveryUnitTest, ManuallyAddAccount) {
@@ -10,14 +10,19 @@
 #include <vector>
 
 #include "base/base64.h"
+#include "base/check_op.h"
 #include "base/containers/span.h"
 #include "base/containers/span_reader.h"
 #include "base/json/json_writer.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/browser/eth_response_parser.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 #include "brave/components/brave_wallet/browser/network_manager.h"
 #include "brave/components/brave_wallet/browser/solana_keyring.h"
+#include "brave/components/brave_wallet/common/features.h"
 #include "brave/components/ipfs/ipfs_utils.h"
 #include "build/build_config.h"
 #include "components/grit/brave_components_strings.h"
@@ -26,6 +31,18 @@
 
 namespace {
 
+constexpr size_t kMaxCachedNftMetadata = 1000;
+constexpr size_t kMaxConcurrentMetadataRequests = 6;
+
+std::string GetMetadataCacheKey(brave_wallet::mojom::CoinType coin,
+                                const std::string& chain_id,
+                                const std::string& contract_address,
+                                const std::string& token_id) {
+  return base::StrCat({base::NumberToString(static_cast<int>(coin)), "/",
+                       base::ToLowerASCII(chain_id), "/", contract_address,
+                       "/", token_id});
+}
+
 net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
   return net::DefineNetworkTrafficAnnotation("nft_metadata_fetcher", R"(
       semantics {
@@ -61,7 +78,14 @@ NftMetadataFetcher::NftMetadataFetcher(
                                                url_loader_factory)),
       json_rpc_service_(json_rpc_service),
       prefs_(prefs),
-      weak_ptr_factory_(this) {}
+      weak_ptr_factory_(this) {
+  if (base::FeatureList::IsEnabled(
+          features::kBraveWalletNftMetadataCacheFeature)) {
+    metadata_cache_.emplace(kMaxCachedNftMetadata);
+    metadata_cache_ttl_ =
+        base::Minutes(features::kNftMetadataCacheTtlMinutes.Get());
+  }
+}
 
 NftMetadataFetcher::~NftMetadataFetcher() = default;
 
@@ -87,6 +111,21 @@ void NftMetadataFetcher::GetEthTokenMetadata(
     return;
   }
 
+  if (metadata_cache_) {
+    // EVM addresses are not case sensitive.
+    const auto key =
+        GetMetadataCacheKey(mojom::CoinType::ETH, chain_id,
+                            base::ToLowerASCII(contract_address), token_id);
+    if (const auto* cached = GetCachedMetadata(key)) {
+      std::move(callback).Run(cached->token_url, cached->metadata,
+                              mojom::ProviderError::kSuccess, "");
+      return;
+    }
+    callback = base::BindOnce(&NftMetadataFetcher::OnGetEthTokenMetadata,
+                              weak_ptr_factory_.GetWeakPtr(), key,
+                              std::move(callback));
+  }
+
   auto internal_callback =
       base::BindOnce(&NftMetadataFetcher::OnGetSupportsInterface,
                      weak_ptr_factory_.GetWeakPtr(), contract_address,
@@ -186,14 +225,44 @@ void NftMetadataFetcher::FetchMetadata(
     return;
   }
 
+  StartOrQueueMetadataRequest(url, std::move(callback));
+}
+
+void NftMetadataFetcher::StartOrQueueMetadataRequest(
+    const GURL& url,
+    GetTokenMetadataIntermediateCallback callback) {
+  if (active_metadata_requests_ >= kMaxConcurrentMetadataRequests) {
+    queued_metadata_requests_.emplace_back(url, std::move(callback));
+    return;
+  }
+  StartMetadataRequest(url, std::move(callback));
+}
+
+void NftMetadataFetcher::StartMetadataRequest(
+    const GURL& url,
+    GetTokenMetadataIntermediateCallback callback) {
+  active_metadata_requests_++;
   auto internal_callback =
-      base::BindOnce(&NftMetadataFetcher::OnGetTokenMetadataPayload,
+      base::BindOnce(&NftMetadataFetcher::OnMetadataRequestComplete,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
   api_request_helper_->Request(
       "GET", url, "", "", std::move(internal_callback), {},
       {.auto_retry_on_network_change = true, .enable_cache = true});
 }
 
+void NftMetadataFetcher::OnMetadataRequestComplete(
+    GetTokenMetadataIntermediateCallback callback,
+    APIRequestResult api_request_result) {
+  DCHECK_GT(active_metadata_requests_, 0u);
+  active_metadata_requests_--;
+  if (!queued_metadata_requests_.empty()) {
+    auto [url, queued_callback] = std::move(queued_metadata_requests_.front());
+    queued_metadata_requests_.pop_front();
+    StartMetadataRequest(url, std::move(queued_callback));
+  }
+  OnGetTokenMetadataPayload(std::move(callback), std::move(api_request_result));
+}
+
 void NftMetadataFetcher::OnSanitizeTokenMetadata(
     GetTokenMetadataIntermediateCallback callback,
     api_request_helper::ValueOrError result) {
@@ -251,6 +320,19 @@ void NftMetadataFetcher::GetSolTokenMetadata(
     const std::string& chain_id,
     const std::string& token_mint_address,
     GetSolTokenMetadataCallback callback) {
+  if (metadata_cache_) {
+    const auto key = GetMetadataCacheKey(mojom::CoinType::SOL, chain_id,
+                                         token_mint_address, "");
+    if (const auto* cached = GetCachedMetadata(key)) {
+      std::move(callback).Run(cached->token_url, cached->metadata,
+                              mojom::SolanaProviderError::kSuccess, "");
+      return;
+    }
+    callback = base::BindOnce(&NftMetadataFetcher::OnGetSolTokenMetadata,
+                              weak_ptr_factory_.GetWeakPtr(), key,
+                              std::move(callback));
+  }
+
   // Derive metadata PDA for the NFT accounts
   std::optional<std::string> associated_metadata_account =
       SolanaKeyring::GetAssociatedMetadataAccount(token_mint_address);
@@ -314,6 +396,53 @@ void NftMetadataFetcher::CompleteGetSolTokenMetadata(
   std::move(callback).Run(uri.spec(), response, mojo_err, error_message);
 }
 
+const NftMetadataFetcher::CachedMetadata*
+NftMetadataFetcher::GetCachedMetadata(const std::string& key) {
+  auto it = metadata_cache_->Get(key);
+  if (it == metadata_cache_->end()) {
+    return nullptr;
+  }
+  if (it->second.expiration_time <= base::TimeTicks::Now()) {
+    metadata_cache_->Erase(it);
+    return nullptr;
+  }
+  return &it->second;
+}
+
+void NftMetadataFetcher::OnGetEthTokenMetadata(
+    const std::string& key,
+    GetEthTokenMetadataCallback callback,
+    const std::string& token_url,
+    const std::string& result,
+    mojom::ProviderError error,
+    const std::string& error_message) {
+  if (error == mojom::ProviderError::kSuccess) {
+    CacheMetadata(key, token_url, result);
+  }
+  std::move(callback).Run(token_url, result, error, error_message);
+}
+
+void NftMetadataFetcher::OnGetSolTokenMetadata(
+    const std::string& key,
+    GetSolTokenMetadataCallback callback,
+    const std::string& token_url,
+    const std::string& result,
+    mojom::SolanaProviderError error,
+    const std::string& error_message) {
+  if (error == mojom::SolanaProviderError::kSuccess) {
+    CacheMetadata(key, token_url, result);
+  }
+  std::move(callback).Run(token_url, result, error, error_message);
+}
+
+void NftMetadataFetcher::CacheMetadata(const std::string& key,
+                                       const std::string& token_url,
+                                       const std::string& metadata) {
+  metadata_cache_->Put(
+      key, CachedMetadata{token_url, metadata,
+                          base::TimeTicks::Now() + metadata_cache_ttl_});
+}
+
 // static
 // Expects a the bytes of a Borsh encoded Metadata struct (see
 // https://docs.rs/crate/spl-token-metadata/0.0.1/source/src/state.rs#93-104
@@ -9,11 +9,15 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 
+#include "base/containers/circular_deque.h"
+#include "base/containers/lru_cache.h"
 #include "base/containers/span.h"
 #include "base/gtest_prod_util.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 
@@ -61,6 +65,37 @@ class NftMetadataFetcher {
   void FetchMetadata(GURL url, GetTokenMetadataIntermediateCallback callback);
 
  private:
+  struct CachedMetadata {
+    std::string token_url;
+    std::string metadata;
+    base::TimeTicks expiration_time;
+  };
+
+  const CachedMetadata* GetCachedMetadata(const std::string& key);
+  void OnGetEthTokenMetadata(const std::string& key,
+                             GetEthTokenMetadataCallback callback,
+                             const std::string& token_url,
+                             const std::string& result,
+                             mojom::ProviderError error,
+                             const std::string& error_message);
+  void OnGetSolTokenMetadata(const std::string& key,
+                             GetSolTokenMetadataCallback callback,
+                             const std::string& token_url,
+                             const std::string& result,
+                             mojom::SolanaProviderError error,
+                             const std::string& error_message);
+  void CacheMetadata(const std::string& key,
+                     const std::string& token_url,
+                     const std::string& metadata);
+
+  void StartOrQueueMetadataRequest(
+      const GURL& url,
+      GetTokenMetadataIntermediateCallback callback);
+  void StartMetadataRequest(const GURL& url,
+                            GetTokenMetadataIntermediateCallback callback);
+  void OnMetadataRequestComplete(GetTokenMetadataIntermediateCallback callback,
+                                 APIRequestResult api_request_result);
+
   void OnGetSupportsInterface(const std::string& contract_address,
                               const std::string& interface_id,
                               const std::string& token_id,
@@ -104,6 +139,18 @@ class NftMetadataFetcher {
   std::unique_ptr<APIRequestHelper> api_request_helper_;
   raw_ptr<JsonRpcService> json_rpc_service_ = nullptr;
   raw_ptr<PrefService> prefs_ = nullptr;
+
+  // Only set when kBraveWalletNftMetadataCacheFeature is enabled.
+  // <coin, chain id, contract, token id>, metadata
+  std::optional<base::LRUCache<std::string, CachedMetadata>> metadata_cache_;
+  base::TimeDelta metadata_cache_ttl_;
+
+  // Metadata is mostly served by IPFS gateways and NFT hosts which throttle
+  // clients, so only a few requests are in flight and the rest wait here.
+  base::circular_deque<std::pair<GURL, GetTokenMetadataIntermediateCallback>>
+      queued_metadata_requests_;
+  size_t active_metadata_requests_ = 0;
+
   base::WeakPtrFactory<NftMetadataFetcher> weak_ptr_factory_;
 };
 
@@ -12,6 +12,7 @@
 #include "base/base64.h"
 #include "base/containers/span.h"
 #include "base/test/bind.h"
+#include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
 #include "base/test/values_test_util.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
@@ -19,6 +20,7 @@
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 #include "brave/components/brave_wallet/browser/network_manager.h"
+#include "brave/components/brave_wallet/common/features.h"
 #include "brave/components/brave_wallet/common/hash_utils.h"
 #include "components/sync_preferences/testing_pref_service_syncable.h"
 #include "services/data_decoder/public/cpp/test_support/in_process_data_decoder.h"
@@ -279,7 +281,8 @@ class NftMetadataFetcherUnitTest : public testing::Test {
   }
 
  protected:
-  base::test::TaskEnvironment task_environment_;
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
   sync_preferences::TestingPrefServiceSyncable prefs_;
   network::TestURLLoaderFactory url_loader_factory_;
   data_decoder::test::InProcessDataDecoder in_process_data_decoder_;
@@ -624,6 +627,48 @@ TEST_F(NftMetadataFetcherUnitTest, GetEthTokenMetadata) {
                           mojom::kMainnetChainId, kERC1155MetadataInterfaceId,
                           https_metadata_response,
                           mojom::ProviderError::kSuccess, "");
+
+  // With the metadata cache enabled, fetched metadata is served again without
+  // any request until it expires. Failures are not cached.
+  base::test::ScopedFeatureList feature_list(
+      features::kBraveWalletNftMetadataCacheFeature);
+  nft_metadata_fetcher_ = std::make_unique<NftMetadataFetcher>(
+      shared_url_loader_factory_, json_rpc_service_.get(), GetPrefs());
+  SetTokenMetadataInterceptor(
+      kERC721MetadataInterfaceId, mojom::kMainnetChainId,
+      interface_supported_response, https_token_uri_response,
+      https_metadata_response, net::HTTP_OK, net::HTTP_OK,
+      net::HTTP_REQUEST_TIMEOUT);
+  TestGetEthTokenMetadata("0x59468516a8259058bad1ca5f8f4bff190d30e066", "0x719",
+                          mojom::kMainnetChainId, kERC721MetadataInterfaceId,
+                          "", mojom::ProviderError::kInternalError,
+                          l10n_util::GetStringUTF8(IDS_WALLET_INTERNAL_ERROR));
+  SetTokenMetadataInterceptor(
+      kERC721MetadataInterfaceId, mojom::kMainnetChainId,
+      interface_supported_response, https_token_uri_response,
+      https_metadata_response);
+  TestGetEthTokenMetadata("0x59468516a8259058bad1ca5f8f4bff190d30e066", "0x719",
+                          mojom::kMainnetChainId, kERC721MetadataInterfaceId,
+                          https_metadata_response,
+                          mojom::ProviderError::kSuccess, "");
+
+  url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
+      [&](const network::ResourceRequest& request) { ADD_FAILURE(); }));
+  TestGetEthTokenMetadata("0x59468516A8259058BAD1CA5F8F4BFF190D30E066", "0x719",
+                          mojom::kMainnetChainId, kERC721MetadataInterfaceId,
+                          https_metadata_response,
+                          mojom::ProviderError::kSuccess, "");
+
+  task_environment_.FastForwardBy(
+      base::Minutes(features::kNftMetadataCacheTtlMinutes.Get()));
+  SetTokenMetadataInterceptor(
+      kERC721MetadataInterfaceId, mojom::kMainnetChainId,
+      interface_supported_response, https_token_uri_response,
+      ipfs_metadata_response);
+  TestGetEthTokenMetadata("0x59468516a8259058bad1ca5f8f4bff190d30e066", "0x719",
+                          mojom::kMainnetChainId, kERC721MetadataInterfaceId,
+                          ipfs_metadata_response,
+                          mojom::ProviderError::kSuccess, "");
 }
 
 TEST_F(NftMetadataFetcherUnitTest, GetSolTokenMetadata) {
@@ -12,6 +12,9 @@
 #include "base/base64.h"
 #include "base/check.h"
 #include "base/containers/span.h"
+#include "base/functional/bind.h"
+#include "base/location.h"
+#include "base/task/thread_pool.h"
 #include "crypto/aead.h"
 #include "crypto/kdf.h"
 
@@ -19,6 +22,12 @@ namespace brave_wallet {
 namespace {
 constexpr char kCiphertextKey[] = "ciphertext";
 constexpr char kNonceKey[] = "nonce";
+
+std::unique_ptr<PasswordEncryptor> CreateEncryptorWithSalt(
+    const std::string& password,
+    const std::vector<uint8_t>& salt) {
+  return PasswordEncryptor::CreateEncryptor(password, salt);
+}
 }  // namespace
 
 PasswordEncryptor::PasswordEncryptor(PassKey, base::span<uint8_t> key)
@@ -41,6 +50,18 @@ std::unique_ptr<PasswordEncryptor> PasswordEncryptor::CreateEncryptor(
                                                              kPbkdf2Iterations);
 }
 
+// static
+void PasswordEncryptor::CreateEncryptorAsync(const std::string& password,
+                                             std::vector<uint8_t> salt,
+                                             CreateEncryptorCallback callback) {
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::TaskPriority::USER_BLOCKING,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(&CreateEncryptorWithSalt, password, std::move(salt)),
+      std::move(callback));
+}
+
 // static
 std::unique_ptr<PasswordEncryptor>
 PasswordEncryptor::DeriveKeyFromPasswordUsingPbkdf2(
@@ -29,6 +29,8 @@ inline constexpr int kPbkdf2KeySize = 32;
 class PasswordEncryptor {
  public:
   using PassKey = base::PassKey<PasswordEncryptor>;
+  using CreateEncryptorCallback =
+      base::OnceCallback<void(std::unique_ptr<PasswordEncryptor>)>;
 
   PasswordEncryptor(PassKey, base::span<uint8_t> key);
   ~PasswordEncryptor();
@@ -39,6 +41,12 @@ class PasswordEncryptor {
       const std::string& password,
       base::span<const uint8_t> salt);
 
+  // Same as CreateEncryptor, but the key is derived on a background thread so
+  // the PBKDF2 iterations don't block the calling sequence.
+  static void CreateEncryptorAsync(const std::string& password,
+                                   std::vector<uint8_t> salt,
+                                   CreateEncryptorCallback callback);
+
   static std::unique_ptr<PasswordEncryptor> DeriveKeyFromPasswordUsingPbkdf2(
       const std::string& password,
       base::span<const uint8_t> salt,
@@ -10,6 +10,8 @@
 #include "base/base64.h"
 #include "base/containers/span.h"
 #include "base/strings/string_view_util.h"
+#include "base/test/task_environment.h"
+#include "base/test/test_future.h"
 #include "base/test/values_test_util.h"
 #include "crypto/aead.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -63,6 +65,32 @@ TEST(PasswordEncryptorUnitTest, EncryptAndDecrypt) {
   EXPECT_FALSE(encryptor4->Decrypt(ciphertext, nonce));
 }
 
+TEST(PasswordEncryptorUnitTest, CreateEncryptorAsync) {
+  base::test::TaskEnvironment task_environment;
+  const std::vector<uint8_t> salt(kEncryptorSaltSize, 0x01);
+  const std::vector<uint8_t> nonce(kEncryptorNonceSize, 0xAB);
+
+  base::test::TestFuture<std::unique_ptr<PasswordEncryptor>> future;
+  PasswordEncryptor::CreateEncryptorAsync("password", salt,
+                                          future.GetCallback());
+  auto encryptor = future.Take();
+  ASSERT_TRUE(encryptor);
+
+  // Same key as the one derived synchronously.
+  auto ciphertext =
+      encryptor->Encrypt(base::byte_span_from_cstring("bravo"), nonce);
+  auto decrypted = PasswordEncryptor::CreateEncryptor("password", salt)
+                       ->Decrypt(ciphertext, nonce);
+  ASSERT_TRUE(decrypted);
+  EXPECT_EQ("bravo", base::as_string_view(base::span(*decrypted)));
+
+  // Invalid inputs are rejected the same way.
+  base::test::TestFuture<std::unique_ptr<PasswordEncryptor>> empty_future;
+  PasswordEncryptor::CreateEncryptorAsync("", salt,
+                                          empty_future.GetCallback());
+  EXPECT_FALSE(empty_future.Take());
+}
+
 TEST(PasswordEncryptorUnitTest, EncryptToDictAndDecryptFromDict) {
   std::unique_ptr<PasswordEncryptor> encryptor =
       PasswordEncryptor::DeriveKeyFromPasswordUsingPbkdf2(
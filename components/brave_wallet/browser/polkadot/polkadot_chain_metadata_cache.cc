@@ -0,0 +1,130 @@
+/* Copyright (c) 2025 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/polkadot/polkadot_chain_metadata_cache.h"
+
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
+
+namespace brave_wallet {
+
+PolkadotChainMetadataCache::Entry::Entry(
+    PolkadotRuntimeVersion runtime_version,
+    PolkadotChainMetadata chain_metadata)
+    : runtime_version(runtime_version),
+      chain_metadata(std::move(chain_metadata)) {}
+
+PolkadotChainMetadataCache::Entry::Entry(Entry&&) = default;
+
+PolkadotChainMetadataCache::Entry& PolkadotChainMetadataCache::Entry::operator=(
+    Entry&&) = default;
+
+PolkadotChainMetadataCache::Entry::~Entry() = default;
+
+PolkadotChainMetadataCache::PolkadotChainMetadataCache(
+    PolkadotSubstrateRpc& polkadot_substrate_rpc)
+    : polkadot_substrate_rpc_(polkadot_substrate_rpc) {}
+
+PolkadotChainMetadataCache::~PolkadotChainMetadataCache() = default;
+
+void PolkadotChainMetadataCache::GetChainMetadata(
+    std::string_view chain_id,
+    GetChainMetadataCallback callback) {
+  auto it = genesis_hashes_.find(chain_id);
+  if (it != genesis_hashes_.end()) {
+    return GetRuntimeVersion(std::string(chain_id), it->second,
+                             std::move(callback));
+  }
+
+  polkadot_substrate_rpc_->GetBlockHash(
+      chain_id, 0u,
+      base::BindOnce(&PolkadotChainMetadataCache::OnGetGenesisHash,
+                     weak_ptr_factory_.GetWeakPtr(), std::string(chain_id),
+                     std::move(callback)));
+}
+
+void PolkadotChainMetadataCache::Reset() {
+  weak_ptr_factory_.InvalidateWeakPtrs();
+  genesis_hashes_.clear();
+  entries_.clear();
+}
+
+void PolkadotChainMetadataCache::OnGetGenesisHash(
+    std::string chain_id,
+    GetChainMetadataCallback callback,
+    std::optional<GenesisHash> genesis_hash,
+    std::optional<std::string> error) {
+  if (!genesis_hash) {
+    return std::move(callback).Run(
+        nullptr, std::nullopt, error.value_or(WalletInternalErrorMessage()));
+  }
+
+  genesis_hashes_.insert_or_assign(chain_id, *genesis_hash);
+  GetRuntimeVersion(std::move(chain_id), *genesis_hash, std::move(callback));
+}
+
+void PolkadotChainMetadataCache::GetRuntimeVersion(
+    std::string chain_id,
+    GenesisHash genesis_hash,
+    GetChainMetadataCallback callback) {
+  polkadot_substrate_rpc_->GetRuntimeVersion(
+      chain_id,
+      base::BindOnce(&PolkadotChainMetadataCache::OnGetRuntimeVersion,
+                     weak_ptr_factory_.GetWeakPtr(), chain_id, genesis_hash,
+                     std::move(callback)));
+}
+
+void PolkadotChainMetadataCache::OnGetRuntimeVersion(
+    std::string chain_id,
+    GenesisHash genesis_hash,
+    GetChainMetadataCallback callback,
+    std::optional<PolkadotRuntimeVersion> version,
+    std::optional<std::string> error) {
+  if (!version) {
+    return std::move(callback).Run(
+        nullptr, std::nullopt, error.value_or(WalletInternalErrorMessage()));
+  }
+
+  auto it = entries_.find(genesis_hash);
+  if (it != entries_.end() &&
+      it->second.runtime_version.spec_version == version->spec_version) {
+    // The transaction version is part of the signing payload, keep it current.
+    it->second.runtime_version = *version;
+    return std::move(callback).Run(&it->second.chain_metadata, *version,
+                                   std::nullopt);
+  }
+
+  polkadot_substrate_rpc_->GetChainName(
+      chain_id,
+      base::BindOnce(&PolkadotChainMetadataCache::OnGetChainName,
+                     weak_ptr_factory_.GetWeakPtr(), genesis_hash, *version,
+                     std::move(callback)));
+}
+
+void PolkadotChainMetadataCache::OnGetChainName(
+    GenesisHash genesis_hash,
+    PolkadotRuntimeVersion version,
+    GetChainMetadataCallback callback,
+    const std::optional<std::string>& chain_name,
+    const std::optional<std::string>& error) {
+  if (!chain_name) {
+    return std::move(callback).Run(
+        nullptr, std::nullopt, error.value_or(WalletInternalErrorMessage()));
+  }
+
+  auto chain_metadata = PolkadotChainMetadata::FromChainName(*chain_name);
+  if (!chain_metadata) {
+    return std::move(callback).Run(nullptr, std::nullopt,
+                                   WalletInternalErrorMessage());
+  }
+
+  auto [it, inserted] = entries_.insert_or_assign(
+      genesis_hash, Entry(version, std::move(*chain_metadata)));
+  std::move(callback).Run(&it->second.chain_metadata, version, std::nullopt);
+}
+
+}  // namespace brave_wallet
@@ -0,0 +1,95 @@
+/* Copyright (c) 2025 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_POLKADOT_POLKADOT_CHAIN_METADATA_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_POLKADOT_POLKADOT_CHAIN_METADATA_CACHE_H_
+
+#include <array>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "base/containers/flat_map.h"
+#include "base/functional/callback.h"
+#include "base/memory/raw_ref.h"
+#include "base/memory/weak_ptr.h"
+#include "brave/components/brave_wallet/browser/polkadot/polkadot_extrinsic.h"
+#include "brave/components/brave_wallet/browser/polkadot/polkadot_substrate_rpc.h"
+#include "brave/components/brave_wallet/browser/polkadot/polkadot_utils.h"
+
+namespace brave_wallet {
+
+// Keeps the chain metadata used for extrinsic construction, along with the
+// runtime version it was obtained for, keyed by the chain's genesis hash.
+//
+// The genesis hash of a network never changes so it is only queried once per
+// chain id. The runtime version is checked on every lookup and the metadata is
+// only rebuilt when the spec version differs from the cached one, i.e. after a
+// runtime upgrade: pallet and call indices are only allowed to move then.
+class PolkadotChainMetadataCache {
+ public:
+  // The metadata pointer is owned by the cache and is only guaranteed to be
+  // valid for the duration of the callback. On failure it is null and the
+  // error string is set.
+  using GetChainMetadataCallback =
+      base::OnceCallback<void(const PolkadotChainMetadata*,
+                              std::optional<PolkadotRuntimeVersion>,
+                              std::optional<std::string>)>;
+
+  explicit PolkadotChainMetadataCache(
+      PolkadotSubstrateRpc& polkadot_substrate_rpc);
+  ~PolkadotChainMetadataCache();
+
+  PolkadotChainMetadataCache(const PolkadotChainMetadataCache&) = delete;
+  PolkadotChainMetadataCache& operator=(const PolkadotChainMetadataCache&) =
+      delete;
+
+  void GetChainMetadata(std::string_view chain_id,
+                        GetChainMetadataCallback callback);
+
+  // Drops all cached entries and cancels in-flight lookups.
+  void Reset();
+
+ private:
+  using GenesisHash = std::array<uint8_t, kPolkadotBlockHashSize>;
+
+  struct Entry {
+    Entry(PolkadotRuntimeVersion runtime_version,
+          PolkadotChainMetadata chain_metadata);
+    Entry(Entry&&);
+    Entry& operator=(Entry&&);
+    ~Entry();
+
+    PolkadotRuntimeVersion runtime_version;
+    PolkadotChainMetadata chain_metadata;
+  };
+
+  void OnGetGenesisHash(std::string chain_id,
+                        GetChainMetadataCallback callback,
+                        std::optional<GenesisHash> genesis_hash,
+                        std::optional<std::string> error);
+  void GetRuntimeVersion(std::string chain_id,
+                         GenesisHash genesis_hash,
+                         GetChainMetadataCallback callback);
+  void OnGetRuntimeVersion(std::string chain_id,
+                           GenesisHash genesis_hash,
+                           GetChainMetadataCallback callback,
+                           std::optional<PolkadotRuntimeVersion> version,
+                           std::optional<std::string> error);
+  void OnGetChainName(GenesisHash genesis_hash,
+                      PolkadotRuntimeVersion version,
+                      GetChainMetadataCallback callback,
+                      const std::optional<std::string>& chain_name,
+                      const std::optional<std::string>& error);
+
+  const raw_ref<PolkadotSubstrateRpc> polkadot_substrate_rpc_;
+  base::flat_map<std::string, GenesisHash> genesis_hashes_;
+  base::flat_map<GenesisHash, Entry> entries_;
+  base::WeakPtrFactory<PolkadotChainMetadataCache> weak_ptr_factory_{this};
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_POLKADOT_POLKADOT_CHAIN_METADATA_CACHE_H_
@@ -0,0 +1,170 @@
+/* Copyright (c) 2025 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/polkadot/polkadot_chain_metadata_cache.h"
+
+#include <map>
+
+#include "base/strings/strcat.h"
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
+#include "base/test/test_future.h"
+#include "base/test/values_test_util.h"
+#include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
+#include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
+#include "brave/components/brave_wallet/browser/network_manager.h"
+#include "components/sync_preferences/testing_pref_service_syncable.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_wallet {
+
+namespace {
+
+// Westend's genesis hash.
+constexpr char kGenesisHashResponse[] = R"(
+  {
+    "jsonrpc": "2.0",
+    "id": 1,
+    "result": "0xe143f23803ac50e8f6f8e62695d1ce9e4e1d68aa36c1cd2cfd15340213f3423e"
+  })";
+
+std::string MakeRuntimeVersionResponse(std::string_view spec_version) {
+  return base::StrCat({R"({ "jsonrpc": "2.0", "id": 1, "result": {
+    "specVersion": )",
+                       spec_version, R"(, "transactionVersion": 27 } })"});
+}
+
+std::string MakeChainNameResponse(std::string_view chain_name) {
+  return base::StrCat(
+      {R"({ "jsonrpc": "2.0", "id": 1, "result": ")", chain_name, R"(" })"});
+}
+
+}  // namespace
+
+class PolkadotChainMetadataCacheUnitTest : public testing::Test {
+ public:
+  PolkadotChainMetadataCacheUnitTest()
+      : task_environment_(base::test::TaskEnvironment::TimeSource::MOCK_TIME),
+        shared_url_loader_factory_(
+            base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+                &url_loader_factory_)) {}
+
+  ~PolkadotChainMetadataCacheUnitTest() override = default;
+
+  void SetUp() override {
+    RegisterProfilePrefs(prefs_.registry());
+    RegisterLocalStatePrefs(local_state_.registry());
+
+    network_manager_ = std::make_unique<NetworkManager>(&prefs_);
+    polkadot_substrate_rpc_ = std::make_unique<PolkadotSubstrateRpc>(
+        *network_manager_, shared_url_loader_factory_);
+    chain_metadata_cache_ = std::make_unique<PolkadotChainMetadataCache>(
+        *polkadot_substrate_rpc_);
+
+    // Every RPC goes to the same endpoint, so answer based on the method.
+    url_loader_factory_.SetInterceptor(
+        base::BindLambdaForTesting([&](const network::ResourceRequest& req) {
+          const auto& element = req.request_body->elements()->at(0);
+          auto body = base::test::ParseJsonDict(
+              element.As<network::DataElementBytes>().AsStringPiece());
+          const std::string* method = body.FindString("method");
+          ASSERT_TRUE(method);
+          ++rpc_calls_[*method];
+          url_loader_factory_.ClearResponses();
+          url_loader_factory_.AddResponse(req.url.spec(), responses_[*method]);
+        }));
+  }
+
+  const PolkadotChainMetadata* GetChainMetadata(
+      std::optional<std::string>* error = nullptr) {
+    base::test::TestFuture<const PolkadotChainMetadata*,
+                           std::optional<PolkadotRuntimeVersion>,
+                           std::optional<std::string>>
+        future;
+    chain_metadata_cache_->GetChainMetadata(mojom::kPolkadotTestnet,
+                                            future.GetCallback());
+    if (error) {
+      *error = future.Get<2>();
+    }
+    return future.Get<0>();
+  }
+
+ protected:
+  base::test::TaskEnvironment task_environment_;
+  sync_preferences::TestingPrefServiceSyncable prefs_;
+  sync_preferences::TestingPrefServiceSyncable local_state_;
+
+  network::TestURLLoaderFactory url_loader_factory_;
+  std::unique_ptr<NetworkManager> network_manager_;
+  std::unique_ptr<PolkadotSubstrateRpc> polkadot_substrate_rpc_;
+  std::unique_ptr<PolkadotChainMetadataCache> chain_metadata_cache_;
+  scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
+
+  std::map<std::string, std::string> responses_;
+  std::map<std::string, int> rpc_calls_;
+};
+
+TEST_F(PolkadotChainMetadataCacheUnitTest, RefreshesOnlyOnSpecVersionChange) {
+  responses_["chain_getBlockHash"] = kGenesisHashResponse;
+  responses_["state_getRuntimeVersion"] = MakeRuntimeVersionResponse("1019002");
+  responses_["system_chain"] = MakeChainNameResponse("Westend");
+
+  const auto* metadata = GetChainMetadata();
+  ASSERT_TRUE(metadata);
+  EXPECT_EQ(rpc_calls_["chain_getBlockHash"], 1);
+  EXPECT_EQ(rpc_calls_["state_getRuntimeVersion"], 1);
+  EXPECT_EQ(rpc_calls_["system_chain"], 1);
+
+  // Same runtime: the genesis hash and the metadata are reused.
+  EXPECT_EQ(GetChainMetadata(), metadata);
+  EXPECT_EQ(rpc_calls_["chain_getBlockHash"], 1);
+  EXPECT_EQ(rpc_calls_["state_getRuntimeVersion"], 2);
+  EXPECT_EQ(rpc_calls_["system_chain"], 1);
+
+  // Runtime upgrade: the metadata is rebuilt.
+  responses_["state_getRuntimeVersion"] = MakeRuntimeVersionResponse("1019003");
+  EXPECT_TRUE(GetChainMetadata());
+  EXPECT_EQ(rpc_calls_["chain_getBlockHash"], 1);
+  EXPECT_EQ(rpc_calls_["state_getRuntimeVersion"], 3);
+  EXPECT_EQ(rpc_calls_["system_chain"], 2);
+
+  // Reset drops everything.
+  chain_metadata_cache_->Reset();
+  EXPECT_TRUE(GetChainMetadata());
+  EXPECT_EQ(rpc_calls_["chain_getBlockHash"], 2);
+  EXPECT_EQ(rpc_calls_["state_getRuntimeVersion"], 4);
+  EXPECT_EQ(rpc_calls_["system_chain"], 3);
+}
+
+TEST_F(PolkadotChainMetadataCacheUnitTest, Errors) {
+  std::optional<std::string> error;
+
+  // Unknown chain.
+  responses_["chain_getBlockHash"] = kGenesisHashResponse;
+  responses_["state_getRuntimeVersion"] = MakeRuntimeVersionResponse("1019002");
+  responses_["system_chain"] = MakeChainNameResponse("Unknown");
+  EXPECT_FALSE(GetChainMetadata(&error));
+  EXPECT_EQ(error, WalletInternalErrorMessage());
+
+  // Nothing was cached, a later lookup builds the metadata again.
+  responses_["system_chain"] = MakeChainNameResponse("Westend");
+  EXPECT_TRUE(GetChainMetadata(&error));
+  EXPECT_EQ(error, std::nullopt);
+  EXPECT_EQ(rpc_calls_["system_chain"], 2);
+
+  // Runtime version RPC failure.
+  responses_["state_getRuntimeVersion"] = R"(
+    {
+      "jsonrpc": "2.0",
+      "id": 1,
+      "error": { "code": -32601, "message": "Method not found" }
+    })";
+  EXPECT_FALSE(GetChainMetadata(&error));
+  EXPECT_EQ(error, "Method not found");
+}
+
+}  // namespace brave_wallet
@@ -23,6 +23,8 @@ bool IsBoxNonNull(const rust::Box<CxxPolkadotChainMetadata>& chain_metadata) {
 }  // namespace
 
 PolkadotChainMetadata::PolkadotChainMetadata(PolkadotChainMetadata&&) = default;
+PolkadotChainMetadata& PolkadotChainMetadata::operator=(
+    PolkadotChainMetadata&&) = default;
 
 PolkadotChainMetadata::~PolkadotChainMetadata() = default;
 
@@ -37,6 +37,7 @@ class PolkadotChainMetadata {
  public:
   PolkadotChainMetadata() = delete;
   PolkadotChainMetadata(PolkadotChainMetadata&&);
+  PolkadotChainMetadata& operator=(PolkadotChainMetadata&&);
   ~PolkadotChainMetadata();
 
   // Fallibly retrieve the metadata associated with the provided chain spec.
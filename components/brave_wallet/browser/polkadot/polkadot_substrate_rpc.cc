@@ -480,6 +480,49 @@ void PolkadotSubstrateRpc::OnGetBlockHash(GetBlockHashCallback callback,
   return std::move(callback).Run(block_hash, std::nullopt);
 }
 
+void PolkadotSubstrateRpc::GetRuntimeVersion(
+    std::string_view chain_id,
+    GetRuntimeVersionCallback callback) {
+  auto url = GetNetworkURL(chain_id);
+
+  auto payload = base::WriteJson(
+      MakeRpcRequestJson("state_getRuntimeVersion", base::ListValue()));
+  CHECK(payload);
+
+  api_request_helper_.Request(
+      net::HttpRequestHeaders::kPostMethod, url, *payload, "application/json",
+      base::BindOnce(&PolkadotSubstrateRpc::OnGetRuntimeVersion,
+                     weak_ptr_factory_.GetWeakPtr(), std::move(callback)));
+}
+
+void PolkadotSubstrateRpc::OnGetRuntimeVersion(
+    GetRuntimeVersionCallback callback,
+    APIRequestResult api_result) {
+  auto res =
+      HandleRpcCall<polkadot_substrate_rpc_responses::PolkadotRuntimeVersion>(
+          api_result);
+
+  if (!res.has_value()) {
+    return std::move(callback).Run(std::nullopt, res.error());
+  }
+
+  if (!res->result) {
+    // We received { "result": null } from the RPC, not an error.
+    return std::move(callback).Run(std::nullopt, std::nullopt);
+  }
+
+  if (res->result->spec_version < 0 || res->result->transaction_version < 0) {
+    return std::move(callback).Run(std::nullopt, WalletParsingErrorMessage());
+  }
+
+  PolkadotRuntimeVersion version;
+  version.spec_version = static_cast<uint32_t>(res->result->spec_version);
+  version.transaction_version =
+      static_cast<uint32_t>(res->result->transaction_version);
+
+  return std::move(callback).Run(version, std::nullopt);
+}
+
 GURL PolkadotSubstrateRpc::GetNetworkURL(std::string_view chain_id) {
   return network_manager_->GetNetworkURL(chain_id, mojom::CoinType::DOT);
 }
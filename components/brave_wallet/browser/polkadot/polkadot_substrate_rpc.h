@@ -21,6 +21,11 @@ struct PolkadotBlockHeader {
   uint32_t block_number = 0;
 };
 
+struct PolkadotRuntimeVersion {
+  uint32_t spec_version = 0;
+  uint32_t transaction_version = 0;
+};
+
 // The main driver for the Polkadot-based RPC calls against the relay chain and
 // the Substrate-based parachains.
 class PolkadotSubstrateRpc {
@@ -50,6 +55,10 @@ class PolkadotSubstrateRpc {
       std::optional<std::array<uint8_t, kPolkadotBlockHashSize>>,
       std::optional<std::string>)>;
 
+  using GetRuntimeVersionCallback =
+      base::OnceCallback<void(std::optional<PolkadotRuntimeVersion>,
+                              std::optional<std::string>)>;
+
   // Get the name of the chain pointed to by the current network configuration.
   // "Westend" or "Paseo" for the testnets, "Polkadot" for the mainnet.
   void GetChainName(std::string_view chain_id, GetChainNameCallback callback);
@@ -99,6 +108,14 @@ class PolkadotSubstrateRpc {
                     std::optional<uint32_t> block_number,
                     GetBlockHashCallback callback);
 
+  // Get the version of the runtime currently running on the chain. The spec
+  // version changes on every runtime upgrade and is used to decide when cached
+  // chain metadata has to be refreshed. Both the spec version and the
+  // transaction version are part of the signing payload:
+  // https://spec.polkadot.network/id-extrinsics#defn-extrinsic-signature
+  void GetRuntimeVersion(std::string_view chain_id,
+                         GetRuntimeVersionCallback callback);
+
  private:
   using APIRequestResult = api_request_helper::APIRequestResult;
 
@@ -112,6 +129,8 @@ class PolkadotSubstrateRpc {
   void OnGetFinalizedHead(GetFinalizedHeadCallback, APIRequestResult res);
   void OnGetBlockHeader(GetBlockHeaderCallback callback, APIRequestResult res);
   void OnGetBlockHash(GetBlockHashCallback callback, APIRequestResult res);
+  void OnGetRuntimeVersion(GetRuntimeVersionCallback callback,
+                           APIRequestResult res);
 
   const raw_ref<NetworkManager> network_manager_;
   api_request_helper::APIRequestHelper api_request_helper_;
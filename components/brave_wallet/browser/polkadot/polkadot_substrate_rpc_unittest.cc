@@ -1328,4 +1328,118 @@ TEST_F(PolkadotSubstrateRpcUnitTest, GetBlockHash) {
   }
 }
 
+TEST_F(PolkadotSubstrateRpcUnitTest, GetRuntimeVersion) {
+  url_loader_factory_.ClearResponses();
+
+  const auto* chain_id = mojom::kPolkadotTestnet;
+  std::string testnet_url =
+      network_manager_
+          ->GetKnownChain(mojom::kPolkadotTestnet, mojom::CoinType::DOT)
+          ->rpc_endpoints.front()
+          .spec();
+
+  base::test::TestFuture<std::optional<PolkadotRuntimeVersion>,
+                         std::optional<std::string>>
+      future;
+
+  {
+    // Successful RPC call.
+
+    polkadot_substrate_rpc_->GetRuntimeVersion(chain_id, future.GetCallback());
+
+    auto* reqs = url_loader_factory_.pending_requests();
+    EXPECT_TRUE(reqs);
+    EXPECT_EQ(reqs->size(), 1u);
+
+    auto const& req = reqs->at(0);
+    EXPECT_TRUE(req.request.request_body->elements());
+    auto const& element = req.request.request_body->elements()->at(0);
+
+    std::string expected_body = R"(
+      {
+        "id": 1,
+        "jsonrpc": "2.0",
+        "method": "state_getRuntimeVersion",
+        "params": []
+      })";
+
+    EXPECT_EQ(base::test::ParseJsonDict(
+                  element.As<network::DataElementBytes>().AsStringPiece()),
+              base::test::ParseJsonDict(expected_body));
+
+    url_loader_factory_.AddResponse(testnet_url, R"(
+      {
+        "jsonrpc": "2.0",
+        "id": 1,
+        "result": {
+          "specName": "westend",
+          "implName": "parity-westend",
+          "authoringVersion": 2,
+          "specVersion": 1019002,
+          "implVersion": 0,
+          "apis": [],
+          "transactionVersion": 27,
+          "stateVersion": 1
+        }
+      })");
+
+    auto [version, error] = future.Take();
+
+    EXPECT_EQ(error, std::nullopt);
+    ASSERT_TRUE(version);
+    EXPECT_EQ(version->spec_version, 1019002u);
+    EXPECT_EQ(version->transaction_version, 27u);
+  }
+
+  {
+    // RPC nodes return null.
+
+    url_loader_factory_.AddResponse(testnet_url, R"(
+      { "jsonrpc": "2.0", "id": 1, "result": null })");
+
+    polkadot_substrate_rpc_->GetRuntimeVersion(chain_id, future.GetCallback());
+
+    auto [version, error] = future.Take();
+
+    EXPECT_EQ(error, std::nullopt);
+    EXPECT_EQ(version, std::nullopt);
+  }
+
+  {
+    // RPC nodes return a negative version.
+
+    url_loader_factory_.AddResponse(testnet_url, R"(
+      {
+        "jsonrpc": "2.0",
+        "id": 1,
+        "result": { "specVersion": -1, "transactionVersion": 27 }
+      })");
+
+    polkadot_substrate_rpc_->GetRuntimeVersion(chain_id, future.GetCallback());
+
+    auto [version, error] = future.Take();
+
+    EXPECT_EQ(error, WalletParsingErrorMessage());
+    EXPECT_EQ(version, std::nullopt);
+  }
+
+  {
+    // RPC nodes return an error.
+
+    url_loader_factory_.AddResponse(testnet_url, R"(
+      {
+        "jsonrpc": "2.0",
+        "id": 1,
+        "error": { "code": -32601, "message": "Method not found" }
+      })");
+
+    polkadot_substrate_rpc_->GetRuntimeVersion(chain_id, future.GetCallback());
+
+    auto [version, error] = future.Take();
+
+    EXPECT_EQ(error, "Method not found");
+    EXPECT_EQ(version, std::nullopt);
+  }
+}
+
 }  // namespace brave_wallet
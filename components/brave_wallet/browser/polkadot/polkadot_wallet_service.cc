@@ -30,6 +30,7 @@ void PolkadotWalletService::Bind(
 
 void PolkadotWalletService::Reset() {
   weak_ptr_factory_.InvalidateWeakPtrs();
+  chain_metadata_cache_.Reset();
 }
 
 void PolkadotWalletService::GetNetworkName(mojom::AccountIdPtr account_id,
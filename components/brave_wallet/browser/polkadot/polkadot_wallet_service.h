@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_POLKADOT_POLKADOT_WALLET_SERVICE_H_
 
 #include "brave/components/brave_wallet/browser/keyring_service_observer_base.h"
+#include "brave/components/brave_wallet/browser/polkadot/polkadot_chain_metadata_cache.h"
 #include "brave/components/brave_wallet/browser/polkadot/polkadot_substrate_rpc.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "mojo/public/cpp/bindings/receiver_set.h"
@@ -43,11 +44,18 @@ class PolkadotWalletService : public mojom::PolkadotWalletService,
                          const std::string& chain_id,
                          GetAccountBalanceCallback callback) override;
 
+  // Metadata used to build extrinsics, kept across transactions and only
+  // refreshed after a runtime upgrade.
+  PolkadotChainMetadataCache& chain_metadata_cache() {
+    return chain_metadata_cache_;
+  }
+
  private:
   const raw_ref<KeyringService> keyring_service_;
   mojo::ReceiverSet<mojom::PolkadotWalletService> receivers_;
 
   PolkadotSubstrateRpc polkadot_substrate_rpc_;
+  PolkadotChainMetadataCache chain_metadata_cache_{polkadot_substrate_rpc_};
   mojo::Receiver<brave_wallet::mojom::KeyringServiceObserver>
       keyring_service_observer_receiver_{this};
   base::WeakPtrFactory<PolkadotWalletService> weak_ptr_factory_{this};
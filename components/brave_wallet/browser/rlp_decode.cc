@@ -5,27 +5,33 @@
 
 #include "brave/components/brave_wallet/browser/rlp_decode.h"
 
+#include <optional>
 #include <utility>
 
+#include "base/containers/span.h"
+#include "base/containers/span_reader.h"
+
 namespace {
 
-// Decodes an integer
-bool RLPToInteger(const std::string& s, size_t* val) {
-  size_t length = s.length();
-  if (length == 0) {
+// A single RLP item: either a byte string or the encoded items of a list.
+// `payload` points into the decoded input, nothing is copied until a leaf is
+// turned into a base::Value.
+struct RLPItem {
+  bool is_list = false;
+  base::span<const uint8_t> payload;
+};
+
+// Decodes a big endian integer
+bool RLPToInteger(base::span<const uint8_t> s, size_t* val) {
+  if (s.empty()) {
     return false;
   }
 
-  if (length == 1) {
-    *val = static_cast<size_t>(static_cast<uint8_t>(s[0]));
-    return true;
-  }
-
-  size_t v2;
-  if (length <= 1 || !RLPToInteger(s.substr(0, length - 1), &v2)) {
-    return false;
+  size_t v = 0;
+  for (uint8_t byte : s) {
+    v = v * 256 + byte;
   }
-  *val = static_cast<size_t>(static_cast<uint8_t>(s[length - 1]) + v2 * 256);
+  *val = v;
   return true;
 }
 
@@ -34,135 +40,92 @@ bool IsWithinBounds(size_t offset, size_t data_len, size_t length) {
   return offset <= length && data_len <= length && offset + data_len <= length;
 }
 
-// Decodes an offset, length, and value
-bool RLPDecodeLength(const std::string& s,
-                     size_t* offset,
-                     size_t* data_len,
-                     base::Value* value) {
-  size_t length = s.length();
+// Reads the prefix of the first item of `reader` and advances past the whole
+// item.
+std::optional<RLPItem> RLPReadItem(base::SpanReader<const uint8_t>& reader) {
+  const base::span<const uint8_t> s = reader.remaining_span();
+  const size_t length = s.size();
   if (length == 0) {
-    return false;
-  }
-  uint8_t prefix = static_cast<uint8_t>(s[0]);
-  if (prefix <= 0x7f) {
-    *offset = 0;
-    *data_len = 1;
-    std::string str = {s[0]};
-    *value = base::Value(str);
-    return true;
+    return std::nullopt;
   }
 
-  if (prefix <= 0xb7 && length > prefix - 0x80) {
-    size_t strLen = prefix - 0x80;
-    *offset = 1;
-    *data_len = strLen;
-    if (!IsWithinBounds(*offset, *data_len, length)) {
-      return false;
-    }
+  const uint8_t prefix = s[0];
+  bool is_list = false;
+  size_t offset = 0;
+  size_t data_len = 0;
+  if (prefix <= 0x7f) {
+    offset = 0;
+    data_len = 1;
+  } else if (prefix <= 0xb7) {
+    offset = 1;
+    data_len = prefix - 0x80;
     // If a string length is 1 it should have been handled by the single byte
     // clause above.
-    if (*data_len == 1) {
-      return false;
+    if (data_len == 1) {
+      return std::nullopt;
     }
-    std::string str = s.substr(*offset, *data_len);
-    *value = base::Value(str);
-    return true;
-  }
-
-  size_t i;
-  if (1 + prefix - 0xb7 <= length &&
-      RLPToInteger(s.substr(1, prefix - 0xb7), &i)) {
-    if (prefix <= 0xbf && length > prefix - 0xb7 &&
-        length > prefix - 0xb7 + i) {
-      size_t strLen = i;
-      *offset = 1 + prefix - 0xb7;
-      *data_len = strLen;
-      if (!IsWithinBounds(*offset, *data_len, length)) {
-        return false;
-      }
-      // If a list contains 0-55 bytes, it should have been handled above by
-      // the RLP encoding spec.  So this input should never happen, even though
-      // it could in theory decode properly.
-      if (*data_len <= 55) {
-        return false;
-      }
-
-      std::string str = s.substr(*offset, *data_len);
-      *value = base::Value(str);
-      return true;
+  } else if (prefix <= 0xbf) {
+    const size_t len_length = prefix - 0xb7;
+    offset = 1 + len_length;
+    // If a string contains 0-55 bytes, it should have been handled above by
+    // the RLP encoding spec.  So this input should never happen, even though
+    // it could in theory decode properly.
+    if (offset > length || !RLPToInteger(s.subspan(1, len_length), &data_len) ||
+        data_len <= 55) {
+      return std::nullopt;
     }
-  }
-
-  if (prefix <= 0xf7 && length > prefix - 0xc0) {
-    *offset = 1;
-    *data_len = prefix - 0xc0;
-    *value = base::Value(base::Value::Type::LIST);
-    return true;
-  }
-
-  // The data is a list if the range of the first byte is [0xf8, 0xff], and the
-  // total payload of the list whose length is equal to the first byte minus
-  // 0xf7 follows the first byte, and the concatenation of the RLP encodings
-  // of all items of the list follows the total payload of the list;
-  size_t list_data_len;
-  size_t list_len_length = prefix - 0xf7;
-  if (prefix <= 0xff && length >= 1 + prefix - 0xf7 &&
-      RLPToInteger(s.substr(1, list_len_length), &list_data_len)) {
-    // Skip past the prefix and the list len length
-    *offset = 1 + list_len_length;
-    *data_len = list_data_len;
+  } else if (prefix <= 0xf7) {
+    is_list = true;
+    offset = 1;
+    data_len = prefix - 0xc0;
+  } else {
+    // The data is a list if the range of the first byte is [0xf8, 0xff], and
+    // the total payload of the list whose length is equal to the first byte
+    // minus 0xf7 follows the first byte, and the concatenation of the RLP
+    // encodings of all items of the list follows the total payload of the
+    // list;
+    is_list = true;
+    const size_t len_length = prefix - 0xf7;
+    offset = 1 + len_length;
     // If a list contains 0-55 elements, it should have been handled above by
     // the RLP encoding spec.  So this input should never happen, even though
     // it could in theory decode properly.
-    if (*data_len <= 55 || !IsWithinBounds(*offset, *data_len, length)) {
-      return false;
+    if (offset > length || !RLPToInteger(s.subspan(1, len_length), &data_len) ||
+        data_len <= 55) {
+      return std::nullopt;
     }
-    *value = base::Value(base::Value::Type::LIST);
-    return true;
   }
 
-  return false;
+  if (!IsWithinBounds(offset, data_len, length)) {
+    return std::nullopt;
+  }
+  return RLPItem{is_list, reader.Read(offset + data_len)->subspan(offset)};
 }
 
-// Decodes a string and gives the result, an offset, and a data_len
-bool RLPDecodeInternal(const std::string& s,
-                       base::Value* output,
-                       size_t* offset,
-                       size_t* data_len) {
-  size_t length = s.length();
-  if (!RLPDecodeLength(s, offset, data_len, output)) {
+// Decodes the first item of `reader` and gives the result as a base::Value.
+// Nested lists are walked in place.
+bool RLPDecodeInternal(base::SpanReader<const uint8_t>& reader,
+                       base::Value* output) {
+  auto item = RLPReadItem(reader);
+  if (!item) {
     return false;
   }
 
-  if (output->is_string()) {
-    if (!IsWithinBounds(*offset, *data_len, length)) {
-      return false;
-    }
-    std::string str = s.substr(*offset, *data_len);
-    *output = base::Value(str);
-  } else if (output->is_list()) {
-    base::Value::List list;
-    if (!IsWithinBounds(*offset, *data_len, length)) {
+  if (!item->is_list) {
+    *output = base::Value(std::string(base::as_string_view(item->payload)));
+    return true;
+  }
+
+  base::Value::List list;
+  base::SpanReader<const uint8_t> list_reader(item->payload);
+  while (list_reader.remaining() > 0) {
+    base::Value v;
+    if (!RLPDecodeInternal(list_reader, &v)) {
       return false;
     }
-    std::string sub = s.substr(*offset, *data_len);
-    while (sub.length() > 0) {
-      base::Value v;
-      size_t offset2, data_len2;
-      if (!RLPDecodeInternal(sub, &v, &offset2, &data_len2)) {
-        return false;
-      }
-      list.Append(std::move(v));
-      *offset += data_len2 + offset2;
-      *data_len -= data_len2 + offset2;
-      if (!IsWithinBounds(*offset, *data_len, length)) {
-        return false;
-      }
-      sub = s.substr(*offset, *data_len);
-    }
-    *output = base::Value(std::move(list));
+    list.Append(std::move(v));
   }
-
+  *output = base::Value(std::move(list));
   return true;
 }
 
@@ -170,17 +133,20 @@ bool RLPDecodeInternal(const std::string& s,
 
 namespace brave_wallet {
 
-bool RLPDecode(const std::string& s, base::Value* output) {
+bool RLPDecode(base::span<const uint8_t> input, base::Value* output) {
   if (!output) {
     return false;
   }
-  size_t offset;
-  size_t data_len;
-  bool result = RLPDecodeInternal(s, output, &offset, &data_len);
+  base::SpanReader<const uint8_t> reader(input);
+  bool result = RLPDecodeInternal(reader, output);
   if (!result) {
     *output = base::Value();
   }
   return result;
 }
 
+bool RLPDecode(const std::string& s, base::Value* output) {
+  return RLPDecode(base::as_byte_span(s), output);
+}
+
 }  // namespace brave_wallet
@@ -6,8 +6,10 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_RLP_DECODE_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_RLP_DECODE_H_
 
+#include <cstdint>
 #include <string>
 
+#include "base/containers/span.h"
 #include "base/values.h"
 
 namespace brave_wallet {
@@ -16,6 +18,10 @@ namespace brave_wallet {
 // Input string should be a hex string but without the 0x prefix
 bool RLPDecode(const std::string& s, base::Value* output);
 
+// Same as above for raw bytes. The input is walked in place, only byte strings
+// are copied into the output.
+bool RLPDecode(base::span<const uint8_t> input, base::Value* output);
+
 }  // namespace brave_wallet
 
 #endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_RLP_DECODE_H_
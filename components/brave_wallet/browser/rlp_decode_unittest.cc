@@ -4,6 +4,7 @@
  * You can obtain one at https://mozilla.org/MPL/2.0/. */
 
 #include <string>
+#include <vector>
 
 #include "base/strings/string_number_conversions.h"
 #include "brave/components/brave_wallet/browser/rlp_decode.h"
@@ -272,6 +273,23 @@ TEST(RLPDecodeTest, ComplexStructure) {
             RLPTestValueToString(val));
 }
 
+TEST(RLPDecodeTest, Bytes) {
+  std::vector<uint8_t> bytes;
+  ASSERT_TRUE(base::HexStringToBytes(
+      "e383636174ca85707570707983636f7785686f727365c1c083706967c18085736865"
+      "6570",
+      &bytes));
+  base::Value val;
+  ASSERT_TRUE(RLPDecode(bytes, &val));
+  ASSERT_EQ("['cat', ['puppy', 'cow'], 'horse', [[]], 'pig', [''], 'sheep']",
+            RLPTestValueToString(val));
+
+  // Truncated nested list.
+  bytes.pop_back();
+  ASSERT_FALSE(RLPDecode(bytes, &val));
+  ASSERT_TRUE(val.is_none());
+}
+
 TEST(RLPDecodeTest, InvalidInputInt32Overflow) {
   base::Value val;
   ASSERT_FALSE(RLPDecode(FromHex("0xbf0f000000000000021111"), &val));
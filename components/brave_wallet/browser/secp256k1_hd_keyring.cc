@@ -54,9 +54,28 @@ bool Secp256k1HDKeyring::RemoveHDAccount(uint32_t index) {
     return false;
   }
   accounts_.pop_back();
+  std::erase_if(chain_keys_, [index](const auto& item) {
+    return item.first.first == index;
+  });
   return true;
 }
 
+HDKey* Secp256k1HDKeyring::GetChainKey(uint32_t account, uint32_t change) {
+  const auto cache_key = std::pair(account, change);
+  if (auto* chain_key = base::FindPtrOrNull(chain_keys_, cache_key)) {
+    return chain_key;
+  }
+  auto account_key = DeriveAccount(account);
+  if (!account_key) {
+    return nullptr;
+  }
+  auto chain_key = account_key->DeriveChild(DerivationIndex::Normal(change));
+  if (!chain_key) {
+    return nullptr;
+  }
+  return (chain_keys_[cache_key] = std::move(chain_key)).get();
+}
+
 std::optional<std::string> Secp256k1HDKeyring::ImportAccount(
     base::span<const uint8_t> private_key) {
   auto private_key_fixed_size =
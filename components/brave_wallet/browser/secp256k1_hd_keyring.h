@@ -6,8 +6,10 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_SECP256K1_HD_KEYRING_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_SECP256K1_HD_KEYRING_H_
 
+#include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/containers/flat_map.h"
@@ -42,6 +44,11 @@ class Secp256k1HDKeyring {
 
   HDKey* GetHDKeyFromAddress(const std::string& address);
 
+  // Returns the key of the external(0) or internal(1) chain of an account.
+  // Derivation of the hardened account key is the expensive part of getting
+  // an address, so chain keys are derived once and kept.
+  HDKey* GetChainKey(uint32_t account, uint32_t change);
+
   std::unique_ptr<HDKey> accounts_root_;
   std::vector<std::unique_ptr<HDKey>> accounts_;
 
@@ -49,6 +56,9 @@ class Secp256k1HDKeyring {
   // not HD keys.
   // (address, key)
   base::flat_map<std::string, std::unique_ptr<HDKey>> imported_accounts_;
+
+  // (account, change) -> chain key
+  std::map<std::pair<uint32_t, uint32_t>, std::unique_ptr<HDKey>> chain_keys_;
 };
 
 }  // namespace brave_wallet
@@ -5,7 +5,6 @@
 
 #include "brave/components/brave_wallet/browser/solana_block_tracker.h"
 
-#include <memory>
 #include <utility>
 
 #include "base/containers/contains.h"
@@ -31,14 +30,10 @@ SolanaBlockTracker::~SolanaBlockTracker() = default;
 
 void SolanaBlockTracker::Start(const std::string& chain_id,
                                base::TimeDelta interval) {
-  if (!base::Contains(timers_, chain_id)) {
-    timers_[chain_id] = std::make_unique<base::RepeatingTimer>();
-  }
-  timers_[chain_id]->Start(
-      FROM_HERE, interval,
-      base::BindRepeating(&SolanaBlockTracker::GetLatestBlockhash,
-                          weak_ptr_factory_.GetWeakPtr(), chain_id,
-                          base::NullCallback(), false));
+  StartPolling(chain_id, interval,
+               base::BindRepeating(&SolanaBlockTracker::GetLatestBlockhash,
+                                   weak_ptr_factory_.GetWeakPtr(), chain_id,
+                                   base::NullCallback(), false));
 }
 
 void SolanaBlockTracker::GetLatestBlockhash(const std::string& chain_id,
@@ -11,6 +11,7 @@
 #include <utility>
 
 #include "base/check.h"
+#include "base/containers/span.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/browser/solana_compiled_instruction.h"
@@ -252,6 +253,38 @@ std::optional<std::vector<uint8_t>> SolanaMessage::Serialize(
     return std::nullopt;
   }
 
+  std::vector<uint8_t> recent_blockhash_bytes(kSolanaHashSize);
+  if (!Base58Decode(recent_blockhash_, &recent_blockhash_bytes,
+                    recent_blockhash_bytes.size())) {
+    return std::nullopt;
+  }
+
+  // Account ordering and instruction compilation do not depend on the
+  // blockhash, which is refreshed more often than the rest of the message.
+  if (!compiled_message_) {
+    compiled_message_ = Compile();
+    if (!compiled_message_) {
+      return std::nullopt;
+    }
+  }
+
+  if (signers) {
+    signers->clear();
+    for (size_t i = 0; i < static_account_keys_.size() &&
+                       i < message_header_.num_required_signatures;
+         ++i) {
+      signers->emplace_back(static_account_keys_[i].ToBase58());
+    }
+  }
+
+  std::vector<uint8_t> message_bytes = compiled_message_->bytes;
+  base::span(message_bytes)
+      .subspan(compiled_message_->recent_blockhash_offset, kSolanaHashSize)
+      .copy_from(recent_blockhash_bytes);
+  return message_bytes;
+}
+
+std::optional<SolanaMessage::CompiledMessage> SolanaMessage::Compile() const {
   // Calculate read and write indexes size.
   uint16_t num_of_write_indexes = 0;
   uint16_t num_of_read_indexes = 0;
@@ -272,12 +305,9 @@ std::optional<std::vector<uint8_t>> SolanaMessage::Serialize(
     return std::nullopt;
   }
 
-  if (signers) {
-    signers->clear();
-  }
-
   // Version prefix.
-  std::vector<uint8_t> message_bytes;
+  CompiledMessage compiled_message;
+  std::vector<uint8_t>& message_bytes = compiled_message.bytes;
   if (!MaybeAddVersionPrefix(version_, &message_bytes)) {
     return std::nullopt;
   }
@@ -289,24 +319,14 @@ std::optional<std::vector<uint8_t>> SolanaMessage::Serialize(
 
   // Compact array of account addresses.
   CompactU16Encode(static_account_keys_.size(), &message_bytes);
-  for (size_t i = 0; i < static_account_keys_.size(); ++i) {
-    message_bytes.insert(message_bytes.end(),
-                         static_account_keys_[i].bytes().begin(),
-                         static_account_keys_[i].bytes().end());
-
-    if (signers && i < message_header_.num_required_signatures) {
-      signers->emplace_back(static_account_keys_[i].ToBase58());
-    }
+  for (const auto& account_key : static_account_keys_) {
+    message_bytes.insert(message_bytes.end(), account_key.bytes().begin(),
+                         account_key.bytes().end());
   }
 
-  // Recent blockhash.
-  std::vector<uint8_t> recent_blockhash_bytes(kSolanaHashSize);
-  if (!Base58Decode(recent_blockhash_, &recent_blockhash_bytes,
-                    recent_blockhash_bytes.size())) {
-    return std::nullopt;
-  }
-  message_bytes.insert(message_bytes.end(), recent_blockhash_bytes.begin(),
-                       recent_blockhash_bytes.end());
+  // Recent blockhash, filled in by Serialize.
+  compiled_message.recent_blockhash_offset = message_bytes.size();
+  message_bytes.resize(message_bytes.size() + kSolanaHashSize);
 
   // Compact array of instructions.
   CompactU16Encode(instructions_.size(), &message_bytes);
@@ -328,7 +348,7 @@ std::optional<std::vector<uint8_t>> SolanaMessage::Serialize(
     }
   }
 
-  return message_bytes;
+  return compiled_message;
 }
 
 std::optional<std::vector<std::string>>
@@ -751,6 +771,7 @@ bool SolanaMessage::AddPriorityFee(uint32_t compute_units,
         instructions_.begin(),
         {modify_compute_units_instruction, add_priority_fee_instruction});
   }
+  compiled_message_.reset();
 
   uint16_t num_required_signatures = 0;
   uint16_t num_readonly_signed_accounts = 0;
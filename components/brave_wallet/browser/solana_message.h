@@ -77,6 +77,7 @@ class SolanaMessage {
   void SetInstructionsForTesting(
       const std::vector<SolanaInstruction>& instructions) {
     instructions_ = instructions;
+    compiled_message_.reset();
   }
   const std::vector<SolanaInstruction>& instructions() const {
     return instructions_;
@@ -117,10 +118,18 @@ class SolanaMessage {
       uint16_t& num_readonly_signed_accounts,
       uint16_t& num_readonly_unsigned_accounts);
 
+  // Serialized message with a zeroed recent blockhash.
+  struct CompiledMessage {
+    std::vector<uint8_t> bytes;
+    size_t recent_blockhash_offset = 0;
+  };
+
   // Returns true if transaction contains a set compute price or set compute
   // unit price instruction.
   bool UsesPriorityFee() const;
 
+  std::optional<CompiledMessage> Compile() const;
+
   mojom::SolanaMessageVersion version_;
   std::string recent_blockhash_;
   uint64_t last_valid_block_height_ = 0;
@@ -141,6 +150,10 @@ class SolanaMessage {
   std::vector<SolanaInstruction> instructions_;
   std::vector<SolanaMessageAddressTableLookup>
       address_table_lookups_;  // Empty for legacy transactions.
+
+  // Cached by Serialize and reset whenever the instructions change. The
+  // recent blockhash is patched in on each call so it is not part of it.
+  mutable std::optional<CompiledMessage> compiled_message_;
 };
 
 }  // namespace brave_wallet
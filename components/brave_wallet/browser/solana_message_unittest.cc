@@ -146,6 +146,47 @@ TEST(SolanaMessageUnitTest, SerializeDeserialize) {
   EXPECT_FALSE(message_without_blockhash->Serialize(nullptr));
 }
 
+TEST(SolanaMessageUnitTest, SerializeAfterChanges) {
+  std::vector<SolanaMessage> messages;
+  messages.push_back(GetTestLegacyMessage());
+  messages.push_back(GetTestV0Message());
+  for (auto& message : messages) {
+    SCOPED_TRACE(message.version());
+    auto original_bytes = message.Serialize(nullptr);
+    ASSERT_TRUE(original_bytes);
+
+    // Only the recent blockhash changes.
+    message.set_recent_blockhash(kFromAccount);
+    std::vector<std::string> signers;
+    auto message_bytes = message.Serialize(&signers);
+    ASSERT_TRUE(message_bytes);
+    EXPECT_EQ(signers, std::vector<std::string>({kFromAccount}));
+    ASSERT_EQ(message_bytes->size(), original_bytes->size());
+    size_t num_changed_bytes = 0;
+    for (size_t i = 0; i < message_bytes->size(); ++i) {
+      num_changed_bytes += (*message_bytes)[i] != (*original_bytes)[i];
+    }
+    EXPECT_EQ(num_changed_bytes, kSolanaHashSize);
+    auto deserialized_message = SolanaMessage::Deserialize(*message_bytes);
+    ASSERT_TRUE(deserialized_message);
+    EXPECT_EQ(deserialized_message->recent_blockhash(), kFromAccount);
+
+    message.set_recent_blockhash("invalid");
+    EXPECT_FALSE(message.Serialize(nullptr));
+    message.set_recent_blockhash(kRecentBlockhash);
+    EXPECT_EQ(message.Serialize(nullptr), original_bytes);
+  }
+
+  // New instructions are serialized.
+  auto& legacy_message = messages[0];
+  ASSERT_TRUE(legacy_message.AddPriorityFee(300, 1000));
+  auto message_bytes = legacy_message.Serialize(nullptr);
+  ASSERT_TRUE(message_bytes);
+  auto deserialized_message = SolanaMessage::Deserialize(*message_bytes);
+  ASSERT_TRUE(deserialized_message);
+  EXPECT_EQ(deserialized_message->instructions().size(), 3u);
+}
+
 TEST(SolanaMessageUnitTest, GetSignerAccountsFromSerializedMessageLegacy) {
   SolanaInstruction ins(
       mojom::kSolanaSystemProgramId,
@@ -8,7 +8,11 @@
 #include <limits>
 #include <optional>
 #include <utility>
+#include <vector>
 
+#include "base/feature_list.h"
+#include "base/metrics/histogram_functions.h"
+#include "base/notreached.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/to_string.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
@@ -18,6 +22,7 @@
 #include "brave/components/brave_wallet/browser/swap_response_parser.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/buildflags/buildflags.h"
+#include "brave/components/brave_wallet/common/features.h"
 #include "brave/components/brave_wallet/common/hex_utils.h"
 #include "brave/components/constants/brave_services_key.h"
 #include "net/base/load_flags.h"
@@ -309,10 +314,17 @@ void SwapService::IsSwapSupported(const std::string& chain_id,
 // based on the following priority:
 //   P1. LiFi, Jupiter
 //   P2. 0x, Squid
+SwapService::QuoteResult::QuoteResult() = default;
+SwapService::QuoteResult::QuoteResult(QuoteResult&&) = default;
+SwapService::QuoteResult& SwapService::QuoteResult::operator=(QuoteResult&&) =
+    default;
+SwapService::QuoteResult::~QuoteResult() = default;
+
+SwapService::QuoteFanOut::QuoteFanOut() = default;
+SwapService::QuoteFanOut::~QuoteFanOut() = default;
+
 void SwapService::GetQuote(mojom::SwapQuoteParamsPtr params,
                            GetQuoteCallback callback) {
-  auto conversion_callback = base::BindOnce(&ConvertAllNumbersToString, "");
-
   auto has_zero_ex_support = params->from_chain_id == params->to_chain_id &&
                              IsNetworkSupportedByZeroEx(params->from_chain_id);
   auto has_jupiter_support = params->from_chain_id == params->to_chain_id &&
@@ -324,98 +336,237 @@ void SwapService::GetQuote(mojom::SwapQuoteParamsPtr params,
   auto has_squid_support = IsNetworkSupportedBySquid(params->from_chain_id) &&
                            IsNetworkSupportedBySquid(params->to_chain_id);
 
-  // If the provider is set to Auto, Solana swaps are served via Jupiter.
-  if ((params->provider == mojom::SwapProvider::kJupiter ||
-       params->provider == mojom::SwapProvider::kAuto) &&
-      has_jupiter_support) {
-    auto swap_fee = GetZeroSwapFee();
-    auto fee_param = swap_fee->fee_param;
-
-    auto internal_callback = base::BindOnce(
-        &SwapService::OnGetJupiterQuote, weak_ptr_factory_.GetWeakPtr(),
-        std::move(swap_fee), std::move(callback));
-
-    api_request_helper_.Request(net::HttpRequestHeaders::kGetMethod,
-                                GetJupiterQuoteURL(*params, fee_param), "", "",
-                                std::move(internal_callback), GetHeaders(), {},
-                                std::move(conversion_callback));
+  // Providers able to serve the swap, in the order kAuto prefers them.
+  std::vector<mojom::SwapProvider> providers;
+  if (has_jupiter_support) {
+    providers.push_back(mojom::SwapProvider::kJupiter);
+  }
+  if (has_lifi_support) {
+    providers.push_back(mojom::SwapProvider::kLiFi);
+  }
+  if (has_zero_ex_support) {
+    providers.push_back(mojom::SwapProvider::kZeroEx);
+  }
+  if (has_squid_support) {
+    providers.push_back(mojom::SwapProvider::kSquid);
+  }
 
+  if (params->provider == mojom::SwapProvider::kAuto && providers.size() > 1 &&
+      base::FeatureList::IsEnabled(
+          features::kBraveWalletSwapQuoteFanOutFeature)) {
+    GetQuoteFromAllProviders(std::move(params), std::move(providers),
+                             std::move(callback));
     return;
   }
 
-  // EVM swaps are served via LiFi if the provider is set to kLiFi or kAuto.
-  if ((params->provider == mojom::SwapProvider::kLiFi ||
-       params->provider == mojom::SwapProvider::kAuto) &&
-      has_lifi_support) {
-    auto swap_fee = GetZeroSwapFee();
-    auto fee_param = swap_fee->fee_param;
-
-    auto encoded_params = lifi::EncodeQuoteParams(std::move(params), fee_param);
-    if (!encoded_params) {
-      std::move(callback).Run(
-          nullptr, nullptr, nullptr,
-          l10n_util::GetStringUTF8(IDS_WALLET_INTERNAL_ERROR));
+  // If the provider is set to Auto, the first supported provider is used.
+  for (auto provider : providers) {
+    if (params->provider == provider ||
+        params->provider == mojom::SwapProvider::kAuto) {
+      RequestQuote(provider, std::move(params), std::move(callback));
       return;
     }
+  }
 
-    auto internal_callback = base::BindOnce(
-        &SwapService::OnGetLiFiQuote, weak_ptr_factory_.GetWeakPtr(),
-        std::move(swap_fee), std::move(callback));
+  std::move(callback).Run(
+      nullptr, nullptr, nullptr,
+      l10n_util::GetStringUTF8(IDS_BRAVE_WALLET_UNSUPPORTED_NETWORK));
+}
 
-    api_request_helper_.Request(
-        net::HttpRequestHeaders::kPostMethod, GetLiFiQuoteURL(),
-        *encoded_params, "application/json", std::move(internal_callback),
-        GetHeaders(), {}, std::move(conversion_callback));
+std::optional<api_request_helper::APIRequestHelper::Ticket>
+SwapService::RequestQuote(mojom::SwapProvider provider,
+                          mojom::SwapQuoteParamsPtr params,
+                          GetQuoteCallback callback) {
+  auto conversion_callback = base::BindOnce(&ConvertAllNumbersToString, "");
+  auto swap_fee = GetZeroSwapFee();
+  auto fee_param = swap_fee->fee_param;
+
+  switch (provider) {
+    case mojom::SwapProvider::kJupiter: {
+      auto internal_callback = base::BindOnce(
+          &SwapService::OnGetJupiterQuote, weak_ptr_factory_.GetWeakPtr(),
+          std::move(swap_fee), std::move(callback));
+
+      return api_request_helper_.Request(
+          net::HttpRequestHeaders::kGetMethod,
+          GetJupiterQuoteURL(*params, fee_param), "", "",
+          std::move(internal_callback), GetHeaders(), {},
+          std::move(conversion_callback));
+    }
+    case mojom::SwapProvider::kLiFi: {
+      auto encoded_params =
+          lifi::EncodeQuoteParams(std::move(params), fee_param);
+      if (!encoded_params) {
+        std::move(callback).Run(
+            nullptr, nullptr, nullptr,
+            l10n_util::GetStringUTF8(IDS_WALLET_INTERNAL_ERROR));
+        return std::nullopt;
+      }
+
+      auto internal_callback = base::BindOnce(
+          &SwapService::OnGetLiFiQuote, weak_ptr_factory_.GetWeakPtr(),
+          std::move(swap_fee), std::move(callback));
+
+      return api_request_helper_.Request(
+          net::HttpRequestHeaders::kPostMethod, GetLiFiQuoteURL(),
+          *encoded_params, "application/json", std::move(internal_callback),
+          GetHeaders(), {}, std::move(conversion_callback));
+    }
+    case mojom::SwapProvider::kZeroEx: {
+      auto internal_callback = base::BindOnce(
+          &SwapService::OnGetZeroExQuote, weak_ptr_factory_.GetWeakPtr(),
+          params->from_chain_id, std::move(swap_fee), std::move(callback));
+
+      return api_request_helper_.Request(
+          net::HttpRequestHeaders::kGetMethod,
+          GetZeroExQuoteURL(*params, fee_param), "", "",
+          std::move(internal_callback), GetHeadersForZeroEx(), {},
+          std::move(conversion_callback));
+    }
+    case mojom::SwapProvider::kSquid: {
+      auto encoded_params = squid::EncodeQuoteParams(std::move(params));
+      if (!encoded_params) {
+        std::move(callback).Run(
+            nullptr, nullptr, nullptr,
+            l10n_util::GetStringUTF8(IDS_WALLET_INTERNAL_ERROR));
+        return std::nullopt;
+      }
+
+      auto internal_callback = base::BindOnce(
+          &SwapService::OnGetSquidQuote, weak_ptr_factory_.GetWeakPtr(),
+          std::move(swap_fee), std::move(callback));
+
+      return api_request_helper_.Request(
+          net::HttpRequestHeaders::kPostMethod, GetSquidURL(), *encoded_params,
+          "application/json", std::move(internal_callback), GetHeaders(), {},
+          std::move(conversion_callback));
+    }
+    case mojom::SwapProvider::kAuto:
+      break;
+  }
+
+  NOTREACHED();
+}
+
+void SwapService::GetQuoteFromAllProviders(
+    mojom::SwapQuoteParamsPtr params,
+    std::vector<mojom::SwapProvider> providers,
+    GetQuoteCallback callback) {
+  const uint32_t id = next_quote_fan_out_id_++;
+  auto& fan_out = quote_fan_outs_[id];
+  fan_out = std::make_unique<QuoteFanOut>();
+  fan_out->callback = std::move(callback);
+  fan_out->start_time = base::TimeTicks::Now();
+  fan_out->results.resize(providers.size());
+  fan_out->tickets.resize(providers.size());
+
+  for (size_t i = 0; i < providers.size(); ++i) {
+    auto ticket = RequestQuote(
+        providers[i], params.Clone(),
+        base::BindOnce(&SwapService::OnFanOutQuote,
+                       weak_ptr_factory_.GetWeakPtr(), id, i));
+    // A request that failed to encode has already reported its result.
+    if (!fan_out->results[i]) {
+      fan_out->tickets[i] = std::move(ticket);
+    }
+  }
+
+  fan_out->deadline_timer.Start(
+      FROM_HERE,
+      base::Milliseconds(features::kSwapQuoteFanOutDeadlineMs.Get()),
+      base::BindOnce(&SwapService::OnFanOutDeadline,
+                     weak_ptr_factory_.GetWeakPtr(), id));
+  fan_out->requests_sent = true;
+  MaybeFinishFanOut(id);
+}
+
+void SwapService::OnFanOutQuote(uint32_t id,
+                                size_t index,
+                                mojom::SwapQuoteUnionPtr quote,
+                                mojom::SwapFeesPtr fees,
+                                mojom::SwapErrorUnionPtr error,
+                                const std::string& error_string) {
+  auto it = quote_fan_outs_.find(id);
+  if (it == quote_fan_outs_.end()) {
     return;
   }
+  QuoteFanOut& fan_out = *it->second;
+  fan_out.tickets[index].reset();
 
-  // EVM swaps are served via 0x only if the provider is set to kZeroEx.
-  if ((params->provider == mojom::SwapProvider::kZeroEx ||
-       params->provider == mojom::SwapProvider::kAuto) &&
-      has_zero_ex_support) {
-    auto swap_fee = GetZeroSwapFee();
-    auto fee_param = swap_fee->fee_param;
+  if (quote && !fan_out.first_quote_recorded) {
+    fan_out.first_quote_recorded = true;
+    base::UmaHistogramMediumTimes(
+        "Brave.Wallet.Swap.QuoteTimeToFirstResult",
+        base::TimeTicks::Now() - fan_out.start_time);
+  }
 
-    auto internal_callback = base::BindOnce(
-        &SwapService::OnGetZeroExQuote, weak_ptr_factory_.GetWeakPtr(),
-        params->from_chain_id, std::move(swap_fee), std::move(callback));
+  QuoteResult& result = fan_out.results[index].emplace();
+  result.quote = std::move(quote);
+  result.fees = std::move(fees);
+  result.error = std::move(error);
+  result.error_string = error_string;
+  MaybeFinishFanOut(id);
+}
 
-    api_request_helper_.Request(net::HttpRequestHeaders::kGetMethod,
-                                GetZeroExQuoteURL(*params, fee_param), "", "",
-                                std::move(internal_callback),
-                                GetHeadersForZeroEx(), {},
-                                std::move(conversion_callback));
+void SwapService::OnFanOutDeadline(uint32_t id) {
+  auto it = quote_fan_outs_.find(id);
+  if (it == quote_fan_outs_.end()) {
+    return;
+  }
+  it->second->deadline_passed = true;
+  MaybeFinishFanOut(id);
+}
 
+void SwapService::MaybeFinishFanOut(uint32_t id) {
+  auto it = quote_fan_outs_.find(id);
+  CHECK(it != quote_fan_outs_.end());
+  QuoteFanOut& fan_out = *it->second;
+  if (!fan_out.requests_sent) {
     return;
   }
 
-  if ((params->provider == mojom::SwapProvider::kSquid ||
-       params->provider == mojom::SwapProvider::kAuto) &&
-      has_squid_support) {
-    auto encoded_params = squid::EncodeQuoteParams(std::move(params));
-    if (!encoded_params) {
-      std::move(callback).Run(
-          nullptr, nullptr, nullptr,
-          l10n_util::GetStringUTF8(IDS_WALLET_INTERNAL_ERROR));
-      return;
+  // The quote of the most preferred provider wins. Before the deadline a
+  // pending provider could still beat the quotes received so far, so it is
+  // waited for. After the deadline pending providers are given up on once
+  // any quote is available.
+  std::optional<size_t> winner;
+  std::optional<size_t> first_error;
+  bool pending = false;
+  for (size_t i = 0; i < fan_out.results.size(); ++i) {
+    const auto& result = fan_out.results[i];
+    if (!result) {
+      if (!fan_out.deadline_passed) {
+        return;
+      }
+      pending = true;
+      continue;
     }
+    if (result->quote) {
+      winner = i;
+      break;
+    }
+    if (!first_error) {
+      first_error = i;
+    }
+  }
 
-    auto swap_fee = GetZeroSwapFee();
-
-    auto internal_callback = base::BindOnce(
-        &SwapService::OnGetSquidQuote, weak_ptr_factory_.GetWeakPtr(),
-        std::move(swap_fee), std::move(callback));
-
-    api_request_helper_.Request(
-        net::HttpRequestHeaders::kPostMethod, GetSquidURL(), *encoded_params,
-        "application/json", std::move(internal_callback), GetHeaders(), {},
-        std::move(conversion_callback));
+  if (!winner && pending) {
     return;
   }
 
-  std::move(callback).Run(
-      nullptr, nullptr, nullptr,
-      l10n_util::GetStringUTF8(IDS_BRAVE_WALLET_UNSUPPORTED_NETWORK));
+  auto fan_out_ptr = std::move(it->second);
+  quote_fan_outs_.erase(it);
+  for (auto& ticket : fan_out_ptr->tickets) {
+    if (ticket) {
+      api_request_helper_.Cancel(*ticket);
+    }
+  }
+
+  CHECK(winner || first_error);
+  QuoteResult& result = *fan_out_ptr->results[winner ? *winner : *first_error];
+  std::move(fan_out_ptr->callback)
+      .Run(std::move(result.quote), std::move(result.fees),
+           std::move(result.error), result.error_string);
 }
 
 void SwapService::OnGetZeroExQuote(const std::string& chain_id,
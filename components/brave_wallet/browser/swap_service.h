@@ -6,9 +6,15 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_SWAP_SERVICE_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_SWAP_SERVICE_H_
 
+#include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "components/keyed_service/core/keyed_service.h"
@@ -63,6 +69,54 @@ class SwapService : public KeyedService, public mojom::SwapService {
   static GURL GetSquidURL();
 
  private:
+  struct QuoteResult {
+    QuoteResult();
+    QuoteResult(QuoteResult&&);
+    QuoteResult& operator=(QuoteResult&&);
+    ~QuoteResult();
+
+    mojom::SwapQuoteUnionPtr quote;
+    mojom::SwapFeesPtr fees;
+    mojom::SwapErrorUnionPtr error;
+    std::string error_string;
+  };
+
+  // A kAuto GetQuote call sent to every eligible provider at once, used when
+  // features::kBraveWalletSwapQuoteFanOutFeature is enabled.
+  struct QuoteFanOut {
+    QuoteFanOut();
+    ~QuoteFanOut();
+
+    GetQuoteCallback callback;
+    base::TimeTicks start_time;
+    // Indexed like the providers, in the order kAuto prefers them.
+    std::vector<std::optional<QuoteResult>> results;
+    std::vector<std::optional<api_request_helper::APIRequestHelper::Ticket>>
+        tickets;
+    base::OneShotTimer deadline_timer;
+    bool requests_sent = false;
+    bool deadline_passed = false;
+    bool first_quote_recorded = false;
+  };
+
+  // Sends the quote request to a single provider. Returns the ticket of the
+  // request, or nullopt if the callback was already run with an error.
+  std::optional<api_request_helper::APIRequestHelper::Ticket> RequestQuote(
+      mojom::SwapProvider provider,
+      mojom::SwapQuoteParamsPtr params,
+      GetQuoteCallback callback);
+  void GetQuoteFromAllProviders(mojom::SwapQuoteParamsPtr params,
+                                std::vector<mojom::SwapProvider> providers,
+                                GetQuoteCallback callback);
+  void OnFanOutQuote(uint32_t id,
+                     size_t index,
+                     mojom::SwapQuoteUnionPtr quote,
+                     mojom::SwapFeesPtr fees,
+                     mojom::SwapErrorUnionPtr error,
+                     const std::string& error_string);
+  void OnFanOutDeadline(uint32_t id);
+  void MaybeFinishFanOut(uint32_t id);
+
   void OnGetZeroExQuote(const std::string& chain_id,
                         mojom::SwapFeesPtr swap_fee,
                         GetQuoteCallback callback,
@@ -91,6 +145,9 @@ class SwapService : public KeyedService, public mojom::SwapService {
 
   mojo::ReceiverSet<mojom::SwapService> receivers_;
 
+  base::flat_map<uint32_t, std::unique_ptr<QuoteFanOut>> quote_fan_outs_;
+  uint32_t next_quote_fan_out_id_ = 0;
+
   base::WeakPtrFactory<SwapService> weak_ptr_factory_{this};
 };
 
@@ -12,7 +12,9 @@
 
 #include "base/memory/scoped_refptr.h"
 #include "base/test/bind.h"
+#include "base/test/metrics/histogram_tester.h"
 #include "base/test/mock_callback.h"
+#include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
 #include "base/test/values_test_util.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
@@ -21,6 +23,7 @@
 #include "brave/components/brave_wallet/common/brave_wallet.mojom-shared.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/common_utils.h"
+#include "brave/components/brave_wallet/common/features.h"
 #include "brave/components/brave_wallet/common/test_utils.h"
 #include "components/grit/brave_components_strings.h"
 #include "components/sync_preferences/testing_pref_service_syncable.h"
@@ -386,6 +389,74 @@ mojom::SquidQuotePtr GetCannedSquidQuote() {
   return quote;
 }
 
+constexpr char kZeroExQuoteResponse[] = R"(
+    {
+      "blockNumber": "20114676",
+      "buyAmount": "100032748",
+      "buyToken": "0xdac17f958d2ee523a2206206994597c13d831ec7",
+      "fees": {
+        "integratorFee": null,
+        "zeroExFee": {
+          "amount": "0",
+          "token": "0xdeadbeef",
+          "type": "volume"
+        },
+        "gasFee": null
+      },
+      "gas": "288095",
+      "gasPrice": "7062490000",
+      "issues": {
+        "allowance": {
+          "actual": "0",
+          "spender": "0x0000000000001ff3684f28c67538d4d072c22734"
+        },
+        "balance": {
+          "token": "0xa0b86991c6218b36c1d19d4a2e9eb0ce3606eb48",
+          "actual": "0",
+          "expected": "100000000"
+        },
+        "simulationIncomplete": false,
+        "invalidSourcesPassed": []
+      },
+      "liquidityAvailable": true,
+      "minBuyAmount": "99032421",
+      "route": {
+        "fills": [
+          {
+            "from": "0xa0b86991c6218b36c1d19d4a2e9eb0ce3606eb48",
+            "to": "0xdac17f958d2ee523a2206206994597c13d831ec7",
+            "source": "SolidlyV3",
+            "proportionBps": "10000"
+          }
+        ],
+        "tokens": [
+          {
+            "address": "0xa0b86991c6218b36c1d19d4a2e9eb0ce3606eb48",
+            "symbol": "USDC"
+          },
+          {
+            "address": "0xdac17f958d2ee523a2206206994597c13d831ec7",
+            "symbol": "USDT"
+          }
+        ]
+      },
+      "sellAmount": "100000000",
+      "sellToken": "0xa0b86991c6218b36c1d19d4a2e9eb0ce3606eb48",
+      "tokenMetadata": {
+        "buyToken": {
+          "buyTaxBps": "0",
+          "sellTaxBps": "0"
+        },
+        "sellToken": {
+          "buyTaxBps": "0",
+          "sellTaxBps": "0"
+        }
+      },
+      "totalNetworkFee": "2034668056550000",
+      "zid": "0x111111111111111111111111"
+    }
+  )";
+
 }  // namespace
 
 class SwapServiceUnitTest : public testing::Test {
@@ -421,6 +492,10 @@ class SwapServiceUnitTest : public testing::Test {
         }));
   }
 
+  network::TestURLLoaderFactory& url_loader_factory() {
+    return url_loader_factory_;
+  }
+
   void IsSwapSupported(const std::string& chain_id, bool expected_response) {
     base::MockCallback<mojom::SwapService::IsSwapSupportedCallback> callback;
     EXPECT_CALL(callback, Run(IsTruthy(expected_response)));
@@ -478,7 +553,8 @@ class SwapServiceUnitTest : public testing::Test {
  protected:
   sync_preferences::TestingPrefServiceSyncable prefs_;
   std::unique_ptr<SwapService> swap_service_;
-  base::test::TaskEnvironment task_environment_;
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
 
  private:
   network::TestURLLoaderFactory url_loader_factory_;
@@ -488,73 +564,7 @@ class SwapServiceUnitTest : public testing::Test {
 
 TEST_F(SwapServiceUnitTest, GetZeroExQuote) {
   // Case 1: non-null zeroExFee
-  SetInterceptor(R"(
-    {
-      "blockNumber": "20114676",
-      "buyAmount": "100032748",
-      "buyToken": "0xdac17f958d2ee523a2206206994597c13d831ec7",
-      "fees": {
-        "integratorFee": null,
-        "zeroExFee": {
-          "amount": "0",
-          "token": "0xdeadbeef",
-          "type": "volume"
-        },
-        "gasFee": null
-      },
-      "gas": "288095",
-      "gasPrice": "7062490000",
-      "issues": {
-        "allowance": {
-          "actual": "0",
-          "spender": "0x0000000000001ff3684f28c67538d4d072c22734"
-        },
-        "balance": {
-          "token": "0xa0b86991c6218b36c1d19d4a2e9eb0ce3606eb48",
-          "actual": "0",
-          "expected": "100000000"
-        },
-        "simulationIncomplete": false,
-        "invalidSourcesPassed": []
-      },
-      "liquidityAvailable": true,
-      "minBuyAmount": "99032421",
-      "route": {
-        "fills": [
-          {
-            "from": "0xa0b86991c6218b36c1d19d4a2e9eb0ce3606eb48",
-            "to": "0xdac17f958d2ee523a2206206994597c13d831ec7",
-            "source": "SolidlyV3",
-            "proportionBps": "10000"
-          }
-        ],
-        "tokens": [
-          {
-            "address": "0xa0b86991c6218b36c1d19d4a2e9eb0ce3606eb48",
-            "symbol": "USDC"
-          },
-          {
-            "address": "0xdac17f958d2ee523a2206206994597c13d831ec7",
-            "symbol": "USDT"
-          }
-        ]
-      },
-      "sellAmount": "100000000",
-      "sellToken": "0xa0b86991c6218b36c1d19d4a2e9eb0ce3606eb48",
-      "tokenMetadata": {
-        "buyToken": {
-          "buyTaxBps": "0",
-          "sellTaxBps": "0"
-        },
-        "sellToken": {
-          "buyTaxBps": "0",
-          "sellTaxBps": "0"
-        }
-      },
-      "totalNetworkFee": "2034668056550000",
-      "zid": "0x111111111111111111111111"
-    }
-  )");
+  SetInterceptor(kZeroExQuoteResponse);
 
   auto expected_zero_ex_quote = mojom::ZeroExQuote::New();
   expected_zero_ex_quote->buy_amount = "100032748";
@@ -691,6 +701,70 @@ TEST_F(SwapServiceUnitTest, GetZeroExQuote) {
   testing::Mock::VerifyAndClearExpectations(&callback);
 }
 
+TEST_F(SwapServiceUnitTest, GetQuoteFanOut) {
+  base::test::ScopedFeatureList feature_list(
+      features::kBraveWalletSwapQuoteFanOutFeature);
+  base::HistogramTester histogram_tester;
+  bool lifi_responds = true;
+  url_loader_factory().SetInterceptor(base::BindLambdaForTesting(
+      [&](const network::ResourceRequest& request) {
+        url_loader_factory().ClearResponses();
+        if (request.url == SwapService::GetLiFiQuoteURL()) {
+          if (lifi_responds) {
+            url_loader_factory().AddResponse(request.url.spec(), "{}",
+                                             net::HTTP_INTERNAL_SERVER_ERROR);
+          }
+        } else if (request.url == SwapService::GetSquidURL()) {
+          url_loader_factory().AddResponse(request.url.spec(), "{}",
+                                           net::HTTP_INTERNAL_SERVER_ERROR);
+        } else {
+          url_loader_factory().AddResponse(request.url.spec(),
+                                           kZeroExQuoteResponse);
+        }
+      }));
+
+  // LiFi is preferred for kAuto, but 0x answers when LiFi fails.
+  base::MockCallback<mojom::SwapService::GetQuoteCallback> callback;
+  EXPECT_CALL(callback,
+              Run(testing::Truly([](const mojom::SwapQuoteUnionPtr& quote) {
+                    return quote && quote->is_zero_ex_quote();
+                  }),
+                  IsTruthy(true), EqualsMojo(mojom::SwapErrorUnionPtr()), ""));
+  swap_service_->GetQuote(
+      GetCannedSwapQuoteParams(
+          mojom::CoinType::ETH, mojom::kPolygonMainnetChainId, "DAI",
+          mojom::CoinType::ETH, mojom::kPolygonMainnetChainId, "ETH",
+          mojom::SwapProvider::kAuto),
+      callback.Get());
+  task_environment_.RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(&callback);
+
+  // A provider that doesn't answer is given up on after the deadline.
+  lifi_responds = false;
+  EXPECT_CALL(callback, Run(testing::_, testing::_, testing::_, testing::_))
+      .Times(0);
+  swap_service_->GetQuote(
+      GetCannedSwapQuoteParams(
+          mojom::CoinType::ETH, mojom::kPolygonMainnetChainId, "DAI",
+          mojom::CoinType::ETH, mojom::kPolygonMainnetChainId, "ETH",
+          mojom::SwapProvider::kAuto),
+      callback.Get());
+  task_environment_.RunUntilIdle();
+  testing::Mock::VerifyAndClearExpectations(&callback);
+
+  EXPECT_CALL(callback,
+              Run(testing::Truly([](const mojom::SwapQuoteUnionPtr& quote) {
+                    return quote && quote->is_zero_ex_quote();
+                  }),
+                  IsTruthy(true), EqualsMojo(mojom::SwapErrorUnionPtr()), ""));
+  task_environment_.FastForwardBy(
+      base::Milliseconds(features::kSwapQuoteFanOutDeadlineMs.Get()));
+  testing::Mock::VerifyAndClearExpectations(&callback);
+
+  histogram_tester.ExpectTotalCount("Brave.Wallet.Swap.QuoteTimeToFirstResult",
+                                    2);
+}
+
 TEST_F(SwapServiceUnitTest, GetZeroExQuoteError) {
   // Case 1: validation error
   std::string error = R"(
@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_wallet/browser/tx_state_manager.h"
 
+#include <algorithm>
 #include <optional>
 #include <utility>
 
@@ -139,11 +140,18 @@ bool TxStateManager::AddOrUpdateTx(const TxMeta& meta) {
     return false;
   }
   bool is_add = false;
+  const bool tx_index_in_sync =
+      tx_index_version_ == delegate_->GetTxsVersion();
   {
     ScopedTxsUpdate update(*delegate_);
     is_add = update->Find(meta.id()) == nullptr;
     update->Set(meta.id(), meta.ToValue());
   }
+  if (tx_index_in_sync) {
+    RemoveFromTxIndex(meta.id());
+    AddToTxIndex(meta.id(), *delegate_->GetTxs().Find(meta.id()));
+    tx_index_version_ = delegate_->GetTxsVersion();
+  }
   if (!is_add) {
     for (auto& observer : observers_) {
       observer.OnTransactionStatusChanged(meta.ToTransactionInfo());
@@ -179,10 +187,16 @@ bool TxStateManager::DeleteTx(const std::string& meta_id) {
   if (!delegate_->IsInitialized()) {
     return false;
   }
+  const bool tx_index_in_sync =
+      tx_index_version_ == delegate_->GetTxsVersion();
   {
     ScopedTxsUpdate update(*delegate_);
     update->Remove(meta_id);
   }
+  if (tx_index_in_sync) {
+    RemoveFromTxIndex(meta_id);
+    tx_index_version_ = delegate_->GetTxsVersion();
+  }
   return true;
 }
 
@@ -205,8 +219,24 @@ std::vector<std::unique_ptr<TxMeta>> TxStateManager::GetTransactionsByStatus(
   }
   const auto& txs = delegate_->GetTxs();
 
-  for (const auto it : txs) {
-    auto* meta_dict = it.second.GetIfDict();
+  EnsureTxIndex();
+  std::vector<const std::string*> meta_ids;
+  for (const auto& [key, ids] : tx_ids_by_chain_and_status_) {
+    if ((chain_id && key.first != *chain_id) ||
+        (status && key.second != *status)) {
+      continue;
+    }
+    for (const auto& id : ids) {
+      meta_ids.push_back(&id);
+    }
+  }
+  // Same order as in storage.
+  std::ranges::sort(meta_ids, [](const auto* a, const auto* b) {
+    return *a < *b;
+  });
+
+  for (const auto* meta_id : meta_ids) {
+    auto* meta_dict = txs.FindDict(*meta_id);
     if (!meta_dict) {
       continue;
     }
@@ -266,6 +296,51 @@ void TxStateManager::RetireTxByStatus(const std::string& chain_id,
   }
 }
 
+void TxStateManager::EnsureTxIndex() {
+  if (tx_index_version_ == delegate_->GetTxsVersion()) {
+    return;
+  }
+
+  tx_ids_by_chain_and_status_.clear();
+  tx_index_keys_.clear();
+  for (const auto [meta_id, value] : delegate_->GetTxs()) {
+    AddToTxIndex(meta_id, value);
+  }
+  tx_index_version_ = delegate_->GetTxsVersion();
+}
+
+void TxStateManager::AddToTxIndex(const std::string& meta_id,
+                                  const base::Value& value) {
+  const auto* meta_dict = value.GetIfDict();
+  if (!meta_dict) {
+    return;
+  }
+  const auto coin = meta_dict->FindInt("coin");
+  const auto* chain_id = meta_dict->FindString("chain_id");
+  const auto status = meta_dict->FindInt("status");
+  if (!coin || *coin != static_cast<int>(GetCoinType()) || !chain_id ||
+      !status) {
+    return;
+  }
+
+  TxIndexKey key(*chain_id, static_cast<mojom::TransactionStatus>(*status));
+  tx_ids_by_chain_and_status_[key].insert(meta_id);
+  tx_index_keys_.insert_or_assign(meta_id, std::move(key));
+}
+
+void TxStateManager::RemoveFromTxIndex(const std::string& meta_id) {
+  auto node = tx_index_keys_.extract(meta_id);
+  if (node.empty()) {
+    return;
+  }
+  auto it = tx_ids_by_chain_and_status_.find(node.mapped());
+  CHECK(it != tx_ids_by_chain_and_status_.end());
+  it->second.erase(meta_id);
+  if (it->second.empty()) {
+    tx_ids_by_chain_and_status_.erase(it);
+  }
+}
+
 void TxStateManager::AddObserver(TxStateManager::Observer* observer) {
   observers_.AddObserver(observer);
 }
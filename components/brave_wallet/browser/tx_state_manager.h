@@ -6,9 +6,12 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_STATE_MANAGER_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_STATE_MANAGER_H_
 
+#include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/gtest_prod_util.h"
@@ -75,6 +78,11 @@ class TxStateManager {
                         mojom::TransactionStatus status,
                         size_t max_num);
 
+  // Rebuilds the index if txs were changed by something else than `this`.
+  void EnsureTxIndex();
+  void AddToTxIndex(const std::string& meta_id, const base::Value& value);
+  void RemoveFromTxIndex(const std::string& meta_id);
+
   virtual mojom::CoinType GetCoinType() const = 0;
 
   // Each derived class should implement its own ValueToTxMeta to create a
@@ -83,6 +91,14 @@ class TxStateManager {
   virtual std::unique_ptr<TxMeta> ValueToTxMeta(
       const base::Value::Dict& value) = 0;
 
+  // Index of txs of this coin type by chain and status, so queries only
+  // deserialize matching txs.
+  using TxIndexKey = std::pair<std::string, mojom::TransactionStatus>;
+  std::map<TxIndexKey, std::set<std::string>> tx_ids_by_chain_and_status_;
+  // meta id -> key in `tx_ids_by_chain_and_status_`
+  std::map<std::string, TxIndexKey> tx_index_keys_;
+  std::optional<uint64_t> tx_index_version_;
+
   bool no_retire_for_testing_ = false;
   const raw_ref<TxStorageDelegate> delegate_;
   const raw_ref<AccountResolverDelegate> account_resolver_delegate_;
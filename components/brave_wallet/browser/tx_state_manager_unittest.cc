@@ -23,6 +23,7 @@
 #include "brave/components/brave_wallet/browser/eth_tx_meta.h"
 #include "brave/components/brave_wallet/browser/eth_tx_state_manager.h"
 #include "brave/components/brave_wallet/browser/pref_names.h"
+#include "brave/components/brave_wallet/browser/scoped_txs_update.h"
 #include "brave/components/brave_wallet/browser/test_utils.h"
 #include "brave/components/brave_wallet/browser/tx_storage_delegate_impl.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
@@ -92,10 +93,11 @@ class TxStateManagerUnitTest : public testing::Test {
   std::optional<base::Value> GetTxs() {
     base::RunLoop run_loop;
     std::optional<base::Value> value_out;
-    delegate_->store_->Get(
-        "transactions",
-        base::BindLambdaForTesting([&](std::optional<base::Value> value) {
-          value_out = std::move(value);
+    delegate_->ReadTxsFromStore(base::BindLambdaForTesting(
+        [&](std::optional<base::Value::Dict> txs, bool is_single_key_format) {
+          if (txs) {
+            value_out = base::Value(std::move(*txs));
+          }
           run_loop.Quit();
         }));
     run_loop.Run();
@@ -423,6 +425,33 @@ TEST_F(TxStateManagerUnitTest, GetTransactionsByStatus) {
       1u);
 }
 
+TEST_F(TxStateManagerUnitTest, TxIndexFollowsStorageChanges) {
+  auto count = [&](mojom::TransactionStatus status) {
+    return tx_state_manager_
+        ->GetTransactionsByStatus(mojom::kMainnetChainId, status, std::nullopt)
+        .size();
+  };
+
+  EthTxMeta meta(eth_account_id_, std::make_unique<EthTransaction>());
+  meta.set_id("001");
+  meta.set_chain_id(mojom::kMainnetChainId);
+  meta.set_status(mojom::TransactionStatus::Submitted);
+  ASSERT_TRUE(tx_state_manager_->AddOrUpdateTx(meta));
+  EXPECT_EQ(count(mojom::TransactionStatus::Submitted), 1u);
+
+  meta.set_status(mojom::TransactionStatus::Confirmed);
+  ASSERT_TRUE(tx_state_manager_->AddOrUpdateTx(meta));
+  EXPECT_EQ(count(mojom::TransactionStatus::Submitted), 0u);
+  EXPECT_EQ(count(mojom::TransactionStatus::Confirmed), 1u);
+
+  // Changes done directly to storage are picked up as well.
+  {
+    ScopedTxsUpdate update(*delegate_);
+    update->Remove("001");
+  }
+  EXPECT_EQ(count(mojom::TransactionStatus::Confirmed), 0u);
+}
+
 TEST_F(TxStateManagerUnitTest, RetireOldTxMeta) {
 // Disable some logic unnecessary for DB init for this test. Otherwise this
 // causes timeouts on ASAN builds.
@@ -19,6 +19,9 @@ class TxStorageDelegate {
   virtual const base::Value::Dict& GetTxs() const = 0;
   virtual base::Value::Dict& GetTxs() = 0;
   virtual void ScheduleWrite() = 0;
+  // Changes every time txs are updated, loaded or cleared. Lets users keep
+  // derived data in sync with txs.
+  virtual uint64_t GetTxsVersion() const = 0;
 
   class Observer : public base::CheckedObserver {
    public:
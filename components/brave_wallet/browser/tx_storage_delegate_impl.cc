@@ -5,12 +5,17 @@
 
 #include "brave/components/brave_wallet/browser/tx_storage_delegate_impl.h"
 
+#include <algorithm>
 #include <optional>
 #include <utility>
+#include <vector>
 
+#include "base/barrier_callback.h"
 #include "base/check.h"
 #include "base/files/file_path.h"
 #include "base/functional/bind.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/browser/pref_names.h"
 #include "brave/components/brave_wallet/common/brave_wallet_constants.h"
@@ -29,8 +34,12 @@ namespace {
 constexpr char kValueStoreDatabaseUMAClientName[] = "BraveWallet";
 constexpr base::FilePath::CharType kWalletStorageName[] =
     FILE_PATH_LITERAL("Brave Wallet Storage");
-// key used in transaction storage
+// DEPRECATED 10/2026. Key of all transactions before they were sharded by
+// coin and chain. For migration only.
 constexpr char kStorageTransactionsKey[] = "transactions";
+// List of keys of transaction shards.
+constexpr char kStorageTransactionShardKeysKey[] = "transactions_shards";
+constexpr char kStorageTransactionsShardKeyPrefix[] = "transactions.";
 
 }  // namespace
 
@@ -58,6 +67,10 @@ base::Value::Dict& TxStorageDelegateImpl::GetTxs() {
   return txs_;
 }
 
+uint64_t TxStorageDelegateImpl::GetTxsVersion() const {
+  return txs_version_;
+}
+
 std::unique_ptr<value_store::ValueStoreFrontend>
 TxStorageDelegateImpl::MakeValueStoreFrontend(
     scoped_refptr<value_store::ValueStoreFactory> store_factory,
@@ -68,40 +81,158 @@ TxStorageDelegateImpl::MakeValueStoreFrontend(
       value_store::GetValueStoreTaskRunner());
 }
 
+// static
+std::string TxStorageDelegateImpl::GetShardKey(const base::Value& tx) {
+  const auto* tx_dict = tx.GetIfDict();
+  const auto coin = tx_dict ? tx_dict->FindInt("coin") : std::nullopt;
+  const auto* chain_id = tx_dict ? tx_dict->FindString("chain_id") : nullptr;
+  if (!coin || !chain_id) {
+    return base::StrCat({kStorageTransactionsShardKeyPrefix, "other"});
+  }
+  return base::StrCat({kStorageTransactionsShardKeyPrefix,
+                       base::NumberToString(*coin), ".", *chain_id});
+}
+
 void TxStorageDelegateImpl::Initialize() {
-  store_->Get(kStorageTransactionsKey,
-              base::BindOnce(&TxStorageDelegateImpl::OnTxsInitialRead,
-                             weak_factory_.GetWeakPtr()));
+  ReadTxsFromStore(base::BindOnce(&TxStorageDelegateImpl::OnTxsInitialRead,
+                                  weak_factory_.GetWeakPtr()));
+}
+
+void TxStorageDelegateImpl::ReadTxsFromStore(ReadTxsCallback callback) {
+  store_->Get(kStorageTransactionShardKeysKey,
+              base::BindOnce(&TxStorageDelegateImpl::OnShardKeysRead,
+                             weak_factory_.GetWeakPtr(), std::move(callback)));
+}
+
+void TxStorageDelegateImpl::OnShardKeysRead(
+    ReadTxsCallback callback,
+    std::optional<base::Value> shard_keys) {
+  if (!shard_keys || !shard_keys->is_list()) {
+    store_->Get(
+        kStorageTransactionsKey,
+        base::BindOnce(&TxStorageDelegateImpl::OnSingleKeyRead,
+                       weak_factory_.GetWeakPtr(), std::move(callback)));
+    return;
+  }
+
+  const auto& shard_keys_list = shard_keys->GetList();
+  auto barrier_callback = base::BarrierCallback<std::optional<base::Value>>(
+      shard_keys_list.size(),
+      base::BindOnce(&TxStorageDelegateImpl::OnShardsRead,
+                     weak_factory_.GetWeakPtr(), std::move(callback)));
+  for (const auto& shard_key : shard_keys_list) {
+    if (!shard_key.is_string()) {
+      barrier_callback.Run(std::nullopt);
+      continue;
+    }
+    store_->Get(shard_key.GetString(), barrier_callback);
+  }
+}
+
+void TxStorageDelegateImpl::OnSingleKeyRead(ReadTxsCallback callback,
+                                            std::optional<base::Value> txs) {
+  if (!txs || !txs->is_dict()) {
+    std::move(callback).Run(std::nullopt, false);
+    return;
+  }
+  std::move(callback).Run(std::move(*txs).TakeDict(), true);
 }
 
-void TxStorageDelegateImpl::OnTxsInitialRead(std::optional<base::Value> txs) {
+void TxStorageDelegateImpl::OnShardsRead(
+    ReadTxsCallback callback,
+    std::vector<std::optional<base::Value>> shards) {
+  base::Value::Dict txs;
+  for (auto& shard : shards) {
+    if (shard && shard->is_dict()) {
+      txs.Merge(std::move(*shard).TakeDict());
+    }
+  }
+  std::move(callback).Run(std::move(txs), false);
+}
+
+void TxStorageDelegateImpl::OnTxsInitialRead(
+    std::optional<base::Value::Dict> txs,
+    bool is_single_key_format) {
   if (txs) {
-    txs_ = std::move(txs->GetDict());
+    txs_ = std::move(*txs);
+  }
+  txs_version_++;
+  if (!is_single_key_format) {
+    for (const auto [id, tx] : txs_) {
+      written_shards_[GetShardKey(tx)].Set(id, tx.Clone());
+    }
   }
   initialized_ = true;
-  RunDBMigrations();
+  RunDBMigrations(is_single_key_format);
   for (auto& observer : observers_) {
     observer.OnStorageInitialized();
   }
 }
 
-void TxStorageDelegateImpl::RunDBMigrations() {
-  bool schedule_write = false;
-
-  // Placeholder for future DB migrations.
-
-  if (schedule_write) {
+void TxStorageDelegateImpl::RunDBMigrations(bool is_single_key_format) {
+  // Move transactions stored under one key to shards. The old key is removed
+  // once shards are written.
+  if (is_single_key_format && !disable_writes_for_testing_) {
     ScheduleWrite();
+    store_->Remove(kStorageTransactionsKey);
   }
 }
 
 void TxStorageDelegateImpl::ScheduleWrite() {
+  txs_version_++;
   if (disable_writes_for_testing_) {
     return;
   }
 
   DCHECK(initialized_) << "storage is not initialized yet";
-  store_->Set(kStorageTransactionsKey, base::Value(txs_.Clone()));
+
+  std::map<std::string, std::vector<std::pair<const std::string*,
+                                              const base::Value*>>>
+      shards;
+  for (const auto [id, tx] : txs_) {
+    shards[GetShardKey(tx)].emplace_back(&id, &tx);
+  }
+
+  const bool shard_keys_changed = !std::ranges::equal(
+      shards, written_shards_,
+      [](const auto& a, const auto& b) { return a.first == b.first; });
+
+  for (const auto& [shard_key, shard_txs] : shards) {
+    auto& written_shard = written_shards_[shard_key];
+    const bool changed =
+        shard_txs.size() != written_shard.size() ||
+        std::ranges::any_of(shard_txs, [&written_shard](const auto& item) {
+          const auto* written_tx = written_shard.Find(*item.first);
+          return !written_tx || *written_tx != *item.second;
+        });
+    if (!changed) {
+      continue;
+    }
+
+    written_shard.clear();
+    for (const auto& [id, tx] : shard_txs) {
+      written_shard.Set(*id, tx->Clone());
+    }
+    store_->Set(shard_key, base::Value(written_shard.Clone()));
+  }
+
+  for (auto it = written_shards_.begin(); it != written_shards_.end();) {
+    if (shards.contains(it->first)) {
+      ++it;
+      continue;
+    }
+    store_->Remove(it->first);
+    it = written_shards_.erase(it);
+  }
+
+  if (shard_keys_changed) {
+    base::Value::List shard_keys;
+    for (const auto& [shard_key, shard] : written_shards_) {
+      shard_keys.Append(shard_key);
+    }
+    store_->Set(kStorageTransactionShardKeysKey,
+                base::Value(std::move(shard_keys)));
+  }
 }
 
 void TxStorageDelegateImpl::DisableWritesForTesting(bool disable) {
@@ -110,6 +241,12 @@ void TxStorageDelegateImpl::DisableWritesForTesting(bool disable) {
 
 void TxStorageDelegateImpl::Clear() {
   txs_.clear();
+  txs_version_++;
+  for (const auto& [shard_key, shard] : written_shards_) {
+    store_->Remove(shard_key);
+  }
+  written_shards_.clear();
+  store_->Remove(kStorageTransactionShardKeysKey);
   store_->Remove(kStorageTransactionsKey);
 }
 
@@ -6,9 +6,13 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_STORAGE_DELEGATE_IMPL_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_STORAGE_DELEGATE_IMPL_H_
 
+#include <map>
 #include <memory>
 #include <optional>
+#include <string>
+#include <vector>
 
+#include "base/functional/callback.h"
 #include "base/gtest_prod_util.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
@@ -39,6 +43,7 @@ class TxStorageDelegateImpl final : public TxStorageDelegate {
   const base::Value::Dict& GetTxs() const override;
   base::Value::Dict& GetTxs() override;
   void ScheduleWrite() override;
+  uint64_t GetTxsVersion() const override;
   void DisableWritesForTesting(bool disable);
 
   // Only owner ex.TxService can clear data.
@@ -53,6 +58,9 @@ class TxStorageDelegateImpl final : public TxStorageDelegate {
   FRIEND_TEST_ALL_PREFIXES(TxStorageDelegateImplUnitTest, ReadWriteAndClear);
   FRIEND_TEST_ALL_PREFIXES(TxStorageDelegateImplUnitTest,
                            BraveWalletTransactionsDBFormatMigrated);
+  FRIEND_TEST_ALL_PREFIXES(TxStorageDelegateImplUnitTest, WritesChangedShards);
+  FRIEND_TEST_ALL_PREFIXES(TxStorageDelegateImplUnitTest,
+                           MigratesFromSingleKey);
   FRIEND_TEST_ALL_PREFIXES(EthTxManagerUnitTest, Reset);
 
   static std::unique_ptr<value_store::ValueStoreFrontend>
@@ -60,10 +68,25 @@ class TxStorageDelegateImpl final : public TxStorageDelegate {
       scoped_refptr<value_store::ValueStoreFactory> store_factory,
       scoped_refptr<base::SequencedTaskRunner> ui_task_runner);
 
+  // Transactions are stored in one value store key per coin and chain, so an
+  // update of a transaction only rewrites transactions of its chain.
+  static std::string GetShardKey(const base::Value& tx);
+
   // Read all txs from db
   void Initialize();
-  void OnTxsInitialRead(std::optional<base::Value> txs);
-  void RunDBMigrations();
+  using ReadTxsCallback =
+      base::OnceCallback<void(std::optional<base::Value::Dict> txs,
+                              bool is_single_key_format)>;
+  void ReadTxsFromStore(ReadTxsCallback callback);
+  void OnShardKeysRead(ReadTxsCallback callback,
+                       std::optional<base::Value> shard_keys);
+  void OnSingleKeyRead(ReadTxsCallback callback,
+                       std::optional<base::Value> txs);
+  void OnShardsRead(ReadTxsCallback callback,
+                    std::vector<std::optional<base::Value>> shards);
+  void OnTxsInitialRead(std::optional<base::Value::Dict> txs,
+                        bool is_single_key_format);
+  void RunDBMigrations(bool is_single_key_format);
 
   base::ObserverList<TxStorageDelegate::Observer> observers_;
 
@@ -73,6 +96,10 @@ class TxStorageDelegateImpl final : public TxStorageDelegate {
   // write to it when changed. We only hold 500 confirmed and 500 rejected
   // txs, once the limit is reached we will retire oldest entries.
   base::Value::Dict txs_;
+  uint64_t txs_version_ = 0;
+  // Last written content of each shard, used to skip writes of shards which
+  // did not change.
+  std::map<std::string, base::Value::Dict> written_shards_;
 
   bool disable_writes_for_testing_ = false;
 
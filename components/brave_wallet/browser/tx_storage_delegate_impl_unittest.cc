@@ -6,6 +6,7 @@
 #include "brave/components/brave_wallet/browser/tx_storage_delegate_impl.h"
 
 #include <optional>
+#include <string>
 #include <utility>
 
 #include "base/files/scoped_temp_dir.h"
@@ -37,12 +38,12 @@ class TxStorageDelegateImplUnitTest : public testing::Test {
     factory_ = GetTestValueStoreFactory(temp_dir_);
   }
 
-  std::optional<base::Value> GetTxsFromDB(TxStorageDelegateImpl* delegate) {
+  std::optional<base::Value> GetValueFromDB(TxStorageDelegateImpl* delegate,
+                                            const std::string& key) {
     base::RunLoop run_loop;
     std::optional<base::Value> value_out;
     delegate->store_->Get(
-        "transactions",
-        base::BindLambdaForTesting([&](std::optional<base::Value> value) {
+        key, base::BindLambdaForTesting([&](std::optional<base::Value> value) {
           value_out = std::move(value);
           run_loop.Quit();
         }));
@@ -50,6 +51,21 @@ class TxStorageDelegateImplUnitTest : public testing::Test {
     return value_out;
   }
 
+  std::optional<base::Value> GetTxsFromDB(TxStorageDelegateImpl* delegate) {
+    base::RunLoop run_loop;
+    std::optional<base::Value> value_out;
+    delegate->ReadTxsFromStore(base::BindLambdaForTesting(
+        [&](std::optional<base::Value::Dict> txs, bool is_single_key_format) {
+          EXPECT_FALSE(is_single_key_format);
+          if (txs) {
+            value_out = base::Value(std::move(*txs));
+          }
+          run_loop.Quit();
+        }));
+    run_loop.Run();
+    return value_out;
+  }
+
   base::test::TaskEnvironment task_environment_;
   sync_preferences::TestingPrefServiceSyncable prefs_;
   base::ScopedTempDir temp_dir_;
@@ -87,4 +103,55 @@ TEST_F(TxStorageDelegateImplUnitTest, ReadWriteAndClear) {
   EXPECT_FALSE(GetTxsFromDB(delegate.get()));
 }
 
+TEST_F(TxStorageDelegateImplUnitTest, WritesChangedShards) {
+  auto delegate = GetTxStorageDelegateForTest(&prefs_, factory_);
+  auto eth_tx = ParseJsonDict(R"({"coin": 60, "chain_id": "0x1"})");
+  auto sol_tx = ParseJsonDict(R"({"coin": 501, "chain_id": "0x65"})");
+  delegate->GetTxs().Set("eth", eth_tx.Clone());
+  delegate->GetTxs().Set("sol", sol_tx.Clone());
+  delegate->ScheduleWrite();
+
+  EXPECT_EQ(GetValueFromDB(delegate.get(), "transactions_shards"),
+            ParseJson(R"(["transactions.501.0x65", "transactions.60.0x1"])"));
+  EXPECT_EQ(GetValueFromDB(delegate.get(), "transactions.60.0x1"),
+            base::Value(base::Value::Dict().Set("eth", eth_tx.Clone())));
+
+  // Only the shard of the updated transaction is written.
+  delegate->store_->Remove("transactions.501.0x65");
+  delegate->GetTxs().Set("eth", eth_tx.Clone().Set("tx_hash", "0x1"));
+  delegate->ScheduleWrite();
+  EXPECT_EQ(*GetValueFromDB(delegate.get(), "transactions.60.0x1")
+                 ->GetDict()
+                 .FindStringByDottedPath("eth.tx_hash"),
+            "0x1");
+  EXPECT_FALSE(GetValueFromDB(delegate.get(), "transactions.501.0x65"));
+
+  // Shards without transactions are removed.
+  delegate->GetTxs().Remove("eth");
+  delegate->ScheduleWrite();
+  EXPECT_FALSE(GetValueFromDB(delegate.get(), "transactions.60.0x1"));
+  EXPECT_EQ(GetValueFromDB(delegate.get(), "transactions_shards"),
+            ParseJson(R"(["transactions.501.0x65"])"));
+}
+
+TEST_F(TxStorageDelegateImplUnitTest, MigratesFromSingleKey) {
+  auto delegate = GetTxStorageDelegateForTest(&prefs_, factory_);
+  auto txs = ParseJsonDict(R"({
+    "eth": {"coin": 60, "chain_id": "0x1"},
+    "fil": {"coin": 461, "chain_id": "f"}
+  })");
+  delegate->store_->Set("transactions", base::Value(txs.Clone()));
+
+  delegate->initialized_ = false;
+  delegate->txs_.clear();
+  delegate->Initialize();
+  WaitForTxStorageDelegateInitialized(delegate.get());
+  EXPECT_EQ(delegate->GetTxs(), txs);
+
+  EXPECT_FALSE(GetValueFromDB(delegate.get(), "transactions"));
+  EXPECT_EQ(GetTxsFromDB(delegate.get()), base::Value(txs.Clone()));
+  EXPECT_EQ(GetValueFromDB(delegate.get(), "transactions.461.f"),
+            ParseJson(R"({"fil": {"coin": 461, "chain_id": "f"}})"));
+}
+
 }  // namespace brave_wallet
@@ -11,6 +11,8 @@
 
 #include "base/check.h"
 #include "base/containers/map_util.h"
+#include "base/feature_list.h"
+#include "brave/components/brave_wallet/common/features.h"
 #include "url/gurl.h"
 
 namespace brave_wallet::unstoppable_domains {
@@ -51,32 +53,35 @@ void MultichainCall<ResultType>::AddCallback(CallbackType cb) {
 template <class ResultType>
 typename MultichainCall<ResultType>::Response*
 MultichainCall<ResultType>::GetEffectiveResponse() {
-  auto* polygon_result =
-      base::FindOrNull(responses_, mojom::kPolygonMainnetChainId);
-  if (!polygon_result) {
-    return nullptr;
+  // Chains in the order their results are preferred.
+  static constexpr const char* kChainsByPriority[] = {
+      mojom::kPolygonMainnetChainId, mojom::kBaseMainnetChainId,
+      mojom::kMainnetChainId};
+
+  // Lower priority chains can't change the outcome once a higher priority
+  // chain has a result or an error, so in speculative mode there is no need to
+  // wait for them.
+  if (!base::FeatureList::IsEnabled(
+          features::kBraveWalletUnstoppableDomainsSpeculativeFeature)) {
+    for (const char* chain_id : kChainsByPriority) {
+      if (!responses_.contains(chain_id)) {
+        return nullptr;
+      }
+    }
   }
 
-  auto* base_result = base::FindOrNull(responses_, mojom::kBaseMainnetChainId);
-  if (!base_result) {
-    return nullptr;
+  Response* response = nullptr;
+  for (const char* chain_id : kChainsByPriority) {
+    response = base::FindOrNull(responses_, chain_id);
+    if (!response) {
+      return nullptr;
+    }
+    if (response->result || response->error) {
+      return response;
+    }
   }
 
-  auto* eth_mainnet_result =
-      base::FindOrNull(responses_, mojom::kMainnetChainId);
-  if (!eth_mainnet_result) {
-    return nullptr;
-  }
-
-  if (polygon_result->result || polygon_result->error) {
-    return polygon_result;
-  }
-
-  if (base_result->result || base_result->error) {
-    return base_result;
-  }
-
-  return eth_mainnet_result;
+  return response;
 }
 
 template <class ResultType>
@@ -7,8 +7,10 @@
 
 #include "base/run_loop.h"
 #include "base/test/mock_callback.h"
+#include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+#include "brave/components/brave_wallet/common/features.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 using testing::_;
@@ -165,4 +167,30 @@ TEST_F(MultichainCallsUnitTest, NoResult) {
   base::RunLoop().RunUntilIdle();
 }
 
+TEST_F(MultichainCallsUnitTest, Speculative) {
+  base::test::ScopedFeatureList feature_list(
+      features::kBraveWalletUnstoppableDomainsSpeculativeFeature);
+
+  // A polygon result wins without waiting for the other chains.
+  base::MockCallback<CallbackType> cb1;
+  EXPECT_CALL(cb1, Run("polygon", mojom::ProviderError::kSuccess, ""));
+  chain_calls().AddCallback(domain(), cb1.Get());
+  chain_calls().SetResult(domain(), mojom::kPolygonMainnetChainId, "polygon");
+  EXPECT_FALSE(chain_calls().HasCall(domain()));
+  testing::Mock::VerifyAndClearExpectations(&cb1);
+
+  // A mainnet result has to wait for the higher priority chains.
+  base::MockCallback<CallbackType> cb2;
+  EXPECT_CALL(cb2, Run(_, _, _)).Times(0);
+  chain_calls().AddCallback(domain(), cb2.Get());
+  chain_calls().SetResult(domain(), mojom::kMainnetChainId, "mainnet");
+  chain_calls().SetNoResult(domain(), mojom::kPolygonMainnetChainId);
+  EXPECT_TRUE(chain_calls().HasCall(domain()));
+  testing::Mock::VerifyAndClearExpectations(&cb2);
+
+  EXPECT_CALL(cb2, Run("mainnet", mojom::ProviderError::kSuccess, ""));
+  chain_calls().SetNoResult(domain(), mojom::kBaseMainnetChainId);
+  EXPECT_FALSE(chain_calls().HasCall(domain()));
+}
+
 }  // namespace brave_wallet::unstoppable_domains
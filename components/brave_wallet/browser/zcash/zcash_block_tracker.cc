@@ -5,7 +5,6 @@
 
 #include "brave/components/brave_wallet/browser/zcash/zcash_block_tracker.h"
 
-#include <memory>
 #include <optional>
 #include <utility>
 
@@ -22,14 +21,9 @@ ZCashBlockTracker::~ZCashBlockTracker() = default;
 
 void ZCashBlockTracker::Start(const std::string& chain_id,
                               base::TimeDelta interval) {
-  if (!base::Contains(timers_, chain_id)) {
-    timers_[chain_id] = std::make_unique<base::RepeatingTimer>();
-  }
-
-  timers_[chain_id]->Start(
-      FROM_HERE, interval,
-      base::BindRepeating(&ZCashBlockTracker::GetBlockHeight,
-                          weak_ptr_factory_.GetWeakPtr(), chain_id));
+  StartPolling(chain_id, interval,
+               base::BindRepeating(&ZCashBlockTracker::GetBlockHeight,
+                                   weak_ptr_factory_.GetWeakPtr(), chain_id));
 }
 
 void ZCashBlockTracker::GetBlockHeight(const std::string& chain_id) {
@@ -14,13 +14,29 @@
 #include "base/check_op.h"
 #include "base/containers/extend.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/time/time.h"
 #include "brave/components/brave_wallet/browser/zcash/zcash_wallet_service.h"
 
 namespace brave_wallet {
 
 namespace {
 constexpr uint32_t kBlockDownloadBatchSize = 10u;
+// Chunks requested at the same time, so that round trips to the server
+// overlap.
+constexpr size_t kMaxBlockDownloadsInFlight = 4u;
+
+// Approximate size of the block, dominated by its Orchard actions.
+size_t GetCompactBlockSize(const zcash::mojom::CompactBlockPtr& block) {
+  size_t size = block->hash.size();
+  for (const auto& tx : block->vtx) {
+    for (const auto& action : tx->orchard_actions) {
+      size += action->nullifier.size() + action->cmx.size() +
+              action->ephemeral_key.size() + action->ciphertext.size();
+    }
+  }
+  return size;
 }
+}  // namespace
 
 bool ZCashBlocksBatchScanTask::ScanRange::operator==(
     const ScanRange& other) const = default;
@@ -36,6 +52,7 @@ ZCashBlocksBatchScanTask::ZCashBlocksBatchScanTask(
       callback_(std::move(callback)) {
   CHECK_GT(scan_range_.from, kNu5BlockUpdate);
   frontier_block_height_ = scan_range_.from - 1;
+  next_download_index_ = scan_range_.from;
 }
 
 ZCashBlocksBatchScanTask::~ZCashBlocksBatchScanTask() = default;
@@ -60,33 +77,37 @@ void ZCashBlocksBatchScanTask::ScheduleWorkOnTask() {
 }
 
 void ZCashBlocksBatchScanTask::WorkOnTask() {
+  // Downloads which were in flight may still complete after an error.
+  if (finished_ || scan_in_progress_) {
+    return;
+  }
+
   if (error_) {
     FinishWithResult(base::unexpected(*error_));
     return;
   }
 
-  if (!frontier_tree_state_) {
-    GetFrontierTreeState();
+  if (scan_result_) {
+    FinishWithResult(base::ok());
     return;
   }
 
-  if (!frontier_block_) {
+  // The frontier and the blocks don't depend on each other, so they are
+  // requested at once rather than costing a round trip each.
+  if (!frontier_requested_) {
+    frontier_requested_ = true;
+    GetFrontierTreeState();
     GetFrontierBlock();
-    return;
   }
 
-  if (!scan_result_ && (!downloaded_blocks_ ||
-                        downloaded_blocks_->size() != scan_range_.count)) {
+  if (!AllBlocksDownloaded()) {
     DownloadBlocks();
     return;
   }
 
-  if (!scan_result_) {
+  if (frontier_tree_state_ && frontier_block_) {
     ScanBlocks();
-    return;
   }
-
-  FinishWithResult(base::ok());
 }
 
 void ZCashBlocksBatchScanTask::GetFrontierTreeState() {
@@ -133,26 +154,40 @@ void ZCashBlocksBatchScanTask::OnGetFrontierBlock(
   ScheduleWorkOnTask();
 }
 
+bool ZCashBlocksBatchScanTask::AllBlocksDownloaded() const {
+  return downloaded_blocks_ && downloaded_blocks_->size() == scan_range_.count;
+}
+
 void ZCashBlocksBatchScanTask::DownloadBlocks() {
-  uint32_t downloaded_blocks_count =
-      downloaded_blocks_ ? downloaded_blocks_->size() : 0;
-  uint32_t remaining_blocks = scan_range_.count - downloaded_blocks_count;
-  uint32_t expected_size = std::min(kBlockDownloadBatchSize, remaining_blocks);
-  uint32_t start_index = scan_range_.from + downloaded_blocks_count;
-  uint32_t end_index = start_index + expected_size - 1;
+  if (download_start_time_.is_null()) {
+    download_start_time_ = base::TimeTicks::Now();
+  }
 
-  context_->zcash_rpc->GetCompactBlocks(
-      context_->chain_id, start_index, end_index,
-      base::BindOnce(&ZCashBlocksBatchScanTask::OnBlocksDownloaded,
-                     weak_ptr_factory_.GetWeakPtr(), expected_size));
+  const uint32_t end = scan_range_.from + scan_range_.count;
+  while (downloads_in_flight_ < kMaxBlockDownloadsInFlight &&
+         next_download_index_ < end) {
+    uint32_t start_index = next_download_index_;
+    uint32_t expected_size =
+        std::min(kBlockDownloadBatchSize, end - start_index);
+    uint32_t end_index = start_index + expected_size - 1;
+    next_download_index_ += expected_size;
+    downloads_in_flight_++;
+
+    context_->zcash_rpc->GetCompactBlocks(
+        context_->chain_id, start_index, end_index,
+        base::BindOnce(&ZCashBlocksBatchScanTask::OnBlocksDownloaded,
+                       weak_ptr_factory_.GetWeakPtr(), start_index,
+                       expected_size));
+  }
 }
 
 void ZCashBlocksBatchScanTask::OnBlocksDownloaded(
+    uint32_t start_index,
     size_t expected_size,
     base::expected<std::vector<zcash::mojom::CompactBlockPtr>, std::string>
         result) {
-  CHECK(frontier_block_);
-  CHECK(frontier_tree_state_);
+  DCHECK_GT(downloads_in_flight_, 0u);
+  downloads_in_flight_--;
   if (!result.has_value()) {
     error_ = ZCashShieldSyncService::Error{
         ZCashShieldSyncService::ErrorCode::kFailedToDownloadBlocks,
@@ -169,10 +204,27 @@ void ZCashBlocksBatchScanTask::OnBlocksDownloaded(
     return;
   }
 
+  for (const auto& block : result.value()) {
+    downloaded_bytes_ += GetCompactBlockSize(block);
+  }
+  pending_chunks_.emplace(start_index, std::move(result.value()));
+
   if (!downloaded_blocks_) {
     downloaded_blocks_ = std::vector<zcash::mojom::CompactBlockPtr>();
   }
-  base::Extend(downloaded_blocks_.value(), std::move(result.value()));
+  // Chunks may arrive in any order, but blocks are scanned in order.
+  auto it = pending_chunks_.begin();
+  while (it != pending_chunks_.end() &&
+         it->first == scan_range_.from + downloaded_blocks_->size()) {
+    base::Extend(downloaded_blocks_.value(), std::move(it->second));
+    it = pending_chunks_.erase(it);
+  }
+
+  if (AllBlocksDownloaded()) {
+    throughput_.downloaded_blocks = scan_range_.count;
+    throughput_.downloaded_bytes = downloaded_bytes_;
+    throughput_.download_time = base::TimeTicks::Now() - download_start_time_;
+  }
   ScheduleWorkOnTask();
 }
 
@@ -217,6 +269,8 @@ void ZCashBlocksBatchScanTask::ScanBlocks() {
   }
 
   latest_scanned_block_ = downloaded_blocks_->back().Clone();
+  scan_in_progress_ = true;
+  scan_start_time_ = base::TimeTicks::Now();
 
   scanner_->ScanBlocks(
       std::move(tree_state), std::move(downloaded_blocks_.value()),
@@ -227,6 +281,7 @@ void ZCashBlocksBatchScanTask::ScanBlocks() {
 void ZCashBlocksBatchScanTask::OnBlocksScanned(
     base::expected<OrchardBlockScanner::Result, OrchardBlockScanner::ErrorCode>
         result) {
+  scan_in_progress_ = false;
   if (!result.has_value()) {
     error_ = ZCashShieldSyncService::Error{
         ZCashShieldSyncService::ErrorCode::kScannerError,
@@ -235,10 +290,16 @@ void ZCashBlocksBatchScanTask::OnBlocksScanned(
     return;
   }
 
+  throughput_.scanned_blocks = scan_range_.count;
+  throughput_.scan_time = base::TimeTicks::Now() - scan_start_time_;
   scan_result_ = std::move(result.value());
   ScheduleWorkOnTask();
 }
 
+size_t ZCashBlocksBatchScanTask::pending_blocks_bytes() const {
+  return scan_result_ ? 0u : downloaded_bytes_;
+}
+
 OrchardBlockScanner::Result ZCashBlocksBatchScanTask::TakeResult() {
   CHECK(scan_result_.has_value());
   return std::move(scan_result_.value());
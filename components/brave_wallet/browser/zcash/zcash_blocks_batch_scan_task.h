@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_ZCASH_ZCASH_BLOCKS_BATCH_SCAN_TASK_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_ZCASH_ZCASH_BLOCKS_BATCH_SCAN_TASK_H_
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -15,6 +16,8 @@
 namespace brave_wallet {
 
 // Downloads and decodes provided range of blocks as a single batch.
+// The frontier and the blocks are downloaded together, the blocks in chunks a
+// few at a time, and are then scanned at once.
 // Result can be taken after by using TakeResult method.
 class ZCashBlocksBatchScanTask {
  public:
@@ -41,6 +44,14 @@ class ZCashBlocksBatchScanTask {
 
   bool finished() { return finished_; }
 
+  // Approximate size of the downloaded compact blocks which are held until
+  // they have been scanned.
+  size_t pending_blocks_bytes() const;
+
+  const ZCashShieldSyncService::SyncThroughput& throughput() const {
+    return throughput_;
+  }
+
   OrchardBlockScanner::Result TakeResult();
 
  private:
@@ -55,8 +66,10 @@ class ZCashBlocksBatchScanTask {
       base::expected<std::vector<zcash::mojom::CompactBlockPtr>, std::string>
           result);
 
+  bool AllBlocksDownloaded() const;
   void DownloadBlocks();
   void OnBlocksDownloaded(
+      uint32_t start_index,
       size_t expected_size,
       base::expected<std::vector<zcash::mojom::CompactBlockPtr>, std::string>
           result);
@@ -78,6 +91,18 @@ class ZCashBlocksBatchScanTask {
   std::optional<zcash::mojom::TreeStatePtr> frontier_tree_state_;
   std::optional<zcash::mojom::CompactBlockPtr> frontier_block_;
   std::optional<std::vector<zcash::mojom::CompactBlockPtr>> downloaded_blocks_;
+  // Downloaded chunks which wait for an earlier chunk, keyed by start index.
+  std::map<uint32_t, std::vector<zcash::mojom::CompactBlockPtr>>
+      pending_chunks_;
+  // Start index of the next chunk to request.
+  uint32_t next_download_index_ = 0;
+  size_t downloads_in_flight_ = 0;
+  size_t downloaded_bytes_ = 0;
+  base::TimeTicks download_start_time_;
+  base::TimeTicks scan_start_time_;
+  ZCashShieldSyncService::SyncThroughput throughput_;
+  bool frontier_requested_ = false;
+  bool scan_in_progress_ = false;
   std::optional<OrchardBlockScanner::Result> scan_result_;
   std::optional<zcash::mojom::CompactBlockPtr> latest_scanned_block_;
 
@@ -455,3 +455,98 @@ TEST_F(ZCashBlocksBatchScanTest, DecodingError) {
 }
 
 }  // namespace brave_wallet
+
+TEST_F(ZCashBlocksBatchScanTest, DownloadsChunksConcurrently) {
+  std::vector<std::pair<uint32_t, ZCashRpc::GetCompactBlocksCallback>>
+      pending_downloads;
+  ON_CALL(zcash_rpc(), GetCompactBlocks(_, _, _, _))
+      .WillByDefault([&](const std::string& chain_id, uint32_t from,
+                         uint32_t to,
+                         ZCashRpc::GetCompactBlocksCallback callback) {
+        if (from == to) {
+          // Frontier block
+          std::vector<zcash::mojom::CompactBlockPtr> blocks;
+          blocks.push_back(zcash::mojom::CompactBlock::New(
+              0u, from, std::vector<uint8_t>({0xbb, 0xaa}),
+              std::vector<uint8_t>(), 0u, std::vector<uint8_t>(),
+              std::vector<zcash::mojom::CompactTxPtr>(),
+              zcash::mojom::ChainMetadata::New()));
+          std::move(callback).Run(std::move(blocks));
+          return;
+        }
+        EXPECT_EQ(to - from + 1, 10u);
+        pending_downloads.emplace_back(from, std::move(callback));
+      });
+
+  auto reply = [&](size_t index) {
+    auto [from, download_callback] = std::move(pending_downloads[index]);
+    pending_downloads.erase(pending_downloads.begin() + index);
+    std::vector<zcash::mojom::CompactBlockPtr> blocks;
+    for (uint32_t i = from; i < from + 10; i++) {
+      blocks.push_back(zcash::mojom::CompactBlock::New(
+          0u, i, std::vector<uint8_t>({0xbb, 0xaa}), std::vector<uint8_t>(),
+          0u, std::vector<uint8_t>(), std::vector<zcash::mojom::CompactTxPtr>(),
+          zcash::mojom::ChainMetadata::New()));
+    }
+    std::move(download_callback).Run(std::move(blocks));
+    task_environment().RunUntilIdle();
+  };
+
+  std::vector<uint32_t> decoded_blocks;
+  auto block_scanner =
+      std::make_unique<MockOrchardBlockScannerProxy>(base::BindRepeating(
+          [](std::vector<uint32_t>* decoded_blocks, OrchardTreeState tree_state,
+             std::vector<zcash::mojom::CompactBlockPtr> blocks,
+             base::OnceCallback<void(
+                 base::expected<OrchardBlockScanner::Result,
+                                OrchardBlockScanner::ErrorCode>)> callback) {
+            OrchardBlockScanner::Result result = CreateResultForTesting(
+                std::move(tree_state), std::vector<OrchardCommitment>(),
+                blocks.back()->height, ToHex(blocks.back()->hash));
+            for (const auto& block : blocks) {
+              decoded_blocks->push_back(block->height);
+            }
+            std::move(callback).Run(std::move(result));
+          },
+          &decoded_blocks));
+
+  ZCashActionContext context = CreateContext();
+  base::MockCallback<ZCashBlocksBatchScanTask::ZCashBlocksBatchScanTaskCallback>
+      callback;
+  auto task = ZCashBlocksBatchScanTask(
+      context, *block_scanner, {kNu5BlockUpdate + 1, 50}, callback.Get());
+  task.Start();
+  task_environment().RunUntilIdle();
+
+  // A bounded number of chunks is requested at once.
+  ASSERT_EQ(pending_downloads.size(), 4u);
+  EXPECT_EQ(pending_downloads[0].first, kNu5BlockUpdate + 1);
+  EXPECT_EQ(pending_downloads[3].first, kNu5BlockUpdate + 31);
+
+  // Replying to a later chunk first requests the next one, but nothing is
+  // scanned until all chunks are downloaded.
+  reply(1);
+  ASSERT_EQ(pending_downloads.size(), 4u);
+  EXPECT_EQ(pending_downloads[3].first, kNu5BlockUpdate + 41);
+  EXPECT_EQ(task.pending_blocks_bytes(), 20u);
+
+  EXPECT_CALL(callback, Run(testing::_))
+      .WillOnce(
+          [&](base::expected<void, ZCashShieldSyncService::Error> result) {
+            EXPECT_TRUE(result.has_value());
+          });
+  while (!pending_downloads.empty()) {
+    reply(pending_downloads.size() - 1);
+  }
+
+  // Blocks are scanned in order.
+  ASSERT_EQ(decoded_blocks.size(), 50u);
+  for (uint32_t i = 0; i < 50; i++) {
+    EXPECT_EQ(decoded_blocks[i], kNu5BlockUpdate + 1 + i);
+  }
+  EXPECT_TRUE(task.finished());
+  EXPECT_EQ(task.pending_blocks_bytes(), 0u);
+  EXPECT_EQ(task.throughput().downloaded_blocks, 50u);
+  EXPECT_EQ(task.throughput().downloaded_bytes, 100u);
+  EXPECT_EQ(task.throughput().scanned_blocks, 50u);
+}
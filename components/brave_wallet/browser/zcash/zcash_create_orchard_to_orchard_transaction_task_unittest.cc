@@ -88,8 +88,8 @@ class ZCashCreateOrchardToOrchardTransactionTaskTest : public testing::Test {
     keyring_service_ =
         std::make_unique<KeyringService>(nullptr, &prefs_, &local_state_);
     keyring_service_->Reset();
-    keyring_service_->RestoreWallet(kMnemonicGalleryEqual, kTestWalletPassword,
-                                    false, base::DoNothing());
+    keyring_service_->RestoreWalletSync(kMnemonicGalleryEqual,
+                                        kTestWalletPassword, false);
 
     zcash_wallet_service_ = std::make_unique<ZCashWalletService>(
         db_path, *keyring_service_,
@@ -106,8 +106,8 @@ class ZCashCreateOrchardToTransparentTransactionTaskTest
     keyring_service_ =
         std::make_unique<KeyringService>(nullptr, &prefs_, &local_state_);
     keyring_service_->Reset();
-    keyring_service_->RestoreWallet(kMnemonicGalleryEqual, kTestWalletPassword,
-                                    false, base::DoNothing());
+    keyring_service_->RestoreWalletSync(kMnemonicGalleryEqual,
+                                        kTestWalletPassword, false);
 
     zcash_rpc_ = std::make_unique<MockZCashRPC>();
 
@@ -79,8 +79,8 @@ class ZCashCreateTransparentTransactionTaskTest : public testing::Test {
     keyring_service_ =
         std::make_unique<KeyringService>(nullptr, &prefs_, &local_state_);
     keyring_service_->Reset();
-    keyring_service_->RestoreWallet(kMnemonicGalleryEqual, kTestWalletPassword,
-                                    false, base::DoNothing());
+    keyring_service_->RestoreWalletSync(kMnemonicGalleryEqual,
+                                        kTestWalletPassword, false);
 
     zcash_wallet_service_ = std::make_unique<MockZCashWalletService>(
         db_path, *keyring_service_,
@@ -25,8 +25,15 @@ GRrpcMessageStreamHandler::~GRrpcMessageStreamHandler() = default;
 
 void GRrpcMessageStreamHandler::OnDataReceived(std::string_view string_piece,
                                                base::OnceClosure resume) {
-  data_.append(string_piece);
-  std::string_view data_view(data_);
+  // Messages are framed straight out of the network buffer unless part of one
+  // is still pending from an earlier chunk, so only an incomplete trailing
+  // message is ever copied.
+  const bool buffered = !data_.empty();
+  if (buffered) {
+    data_.append(string_piece);
+  }
+  std::string_view data_view =
+      buffered ? std::string_view(data_) : string_piece;
 
   bool should_resume = false;
   while (!should_resume) {
@@ -58,7 +65,11 @@ void GRrpcMessageStreamHandler::OnDataReceived(std::string_view string_piece,
       should_resume = true;
     }
   }
-  data_ = std::string(data_view);
+  if (buffered) {
+    data_.erase(0, data_.size() - data_view.size());
+  } else {
+    data_.assign(data_view);
+  }
   std::move(resume).Run();
 }
 
@@ -111,6 +111,29 @@ TEST(ZCashGrpcUtilsTest, TestTxStreamHandler) {
     EXPECT_EQ(4u, handler.messages().size());
     EXPECT_TRUE(resume_called.value());
   }
+
+  // A complete message followed by the start of the next one
+  {
+    std::optional<bool> resume_called;
+    auto resume_closure =
+        base::BindLambdaForTesting([&]() { resume_called = true; });
+    handler.OnDataReceived(bundled_message.substr(0, message.size() + 3),
+                           std::move(resume_closure));
+    EXPECT_EQ(5u, handler.messages().size());
+    EXPECT_TRUE(resume_called.value());
+  }
+
+  // The rest of the buffered message
+  {
+    std::optional<bool> resume_called;
+    auto resume_closure =
+        base::BindLambdaForTesting([&]() { resume_called = true; });
+    handler.OnDataReceived(bundled_message.substr(message.size() + 3),
+                           std::move(resume_closure));
+    EXPECT_EQ(6u, handler.messages().size());
+    EXPECT_EQ(GetPrefixedProtobuf("message2"), handler.messages().back());
+    EXPECT_TRUE(resume_called.value());
+  }
 }
 
 }  // namespace brave_wallet
@@ -5,7 +5,6 @@
 
 #include "brave/components/brave_wallet/browser/zcash/zcash_keyring.h"
 
-#include <array>
 #include <memory>
 #include <optional>
 
@@ -216,18 +215,16 @@ std::unique_ptr<HDKey> ZCashKeyring::DeriveAccount(uint32_t index) const {
 
 std::unique_ptr<HDKey> ZCashKeyring::DeriveKey(
     const mojom::ZCashKeyId& key_id) {
-  auto account_key = DeriveAccount(key_id.account);
-  if (!account_key) {
+  DCHECK(key_id.change == 0 || key_id.change == 1);
+
+  auto* chain_key = GetChainKey(key_id.account, key_id.change);
+  if (!chain_key) {
     return nullptr;
   }
 
-  DCHECK(key_id.change == 0 || key_id.change == 1);
-
   // Mainnet - m/44'/133'/{address.account}'/{address.change}/{address.index}
   // Testnet - m/44'/1'/{address.account}'/{address.change}/{address.index}
-  return account_key->DeriveChildFromPath(
-      std::array{DerivationIndex::Normal(key_id.change),
-                 DerivationIndex::Normal(key_id.index)});
+  return chain_key->DeriveChild(DerivationIndex::Normal(key_id.index));
 }
 
 std::optional<std::vector<uint8_t>> ZCashKeyring::SignMessage(
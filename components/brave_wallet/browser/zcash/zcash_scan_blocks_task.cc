@@ -7,8 +7,11 @@
 
 #include <algorithm>
 #include <utility>
+#include <vector>
 
 #include "base/check.h"
+#include "base/numerics/safe_conversions.h"
+#include "base/system/sys_info.h"
 #include "brave/components/brave_wallet/browser/zcash/zcash_wallet_service.h"
 
 namespace brave_wallet {
@@ -16,6 +19,13 @@ namespace brave_wallet {
 namespace {
 constexpr uint32_t kBatchSize = 1024u;
 constexpr uint32_t kMaxPendingResultsToInserts = 10u;
+
+// Each batch is trial-decrypted in its own thread pool task.
+uint32_t GetDefaultMaxTasksInProgress() {
+  return std::clamp(
+      base::checked_cast<uint32_t>(base::SysInfo::NumberOfProcessors()),
+      kZCashMaxTasksInProgress, kZCashMaxTasksInProgressLimit);
+}
 }  // namespace
 
 ZCashScanBlocksTask::ZCashScanBlocksTask(
@@ -26,7 +36,8 @@ ZCashScanBlocksTask::ZCashScanBlocksTask(
     : context_(context),
       scanner_(scanner),
       observer_(std::move(observer)),
-      to_(to) {}
+      to_(to),
+      max_tasks_in_progress_(GetDefaultMaxTasksInProgress()) {}
 
 ZCashScanBlocksTask::~ZCashScanBlocksTask() = default;
 
@@ -81,6 +92,7 @@ void ZCashScanBlocksTask::NotifyObserver() {
   scan_ranges_result.ready_ranges = initial_ranges_count_.value() -
                                     pending_scan_ranges_->size() -
                                     scan_tasks_in_progress_.size();
+  scan_ranges_result.throughput = throughput_;
   observer_.Run(std::move(scan_ranges_result));
 }
 
@@ -162,15 +174,27 @@ size_t ZCashScanBlocksTask::ReadyScanTasks() {
                                [](auto& task) { return task.finished(); });
 }
 
+size_t ZCashScanBlocksTask::PendingBlocksBytes() {
+  size_t bytes = 0;
+  for (const auto& task : scan_tasks_in_progress_) {
+    bytes += task.pending_blocks_bytes();
+  }
+  return bytes;
+}
+
 void ZCashScanBlocksTask::MaybeScanRanges() {
   CHECK(pending_scan_ranges_);
   auto ready_scan_tasks = ReadyScanTasks();
   auto total_scan_tasks = scan_tasks_in_progress_.size();
   auto in_progress_scan_tasks = total_scan_tasks - ready_scan_tasks;
 
+  // A new batch is always allowed when none is in progress, so that a batch
+  // of large blocks can't stall the sync.
   while (!pending_scan_ranges_->empty() &&
          in_progress_scan_tasks < max_tasks_in_progress_ &&
-         ready_scan_tasks < kMaxPendingResultsToInserts) {
+         ready_scan_tasks < kMaxPendingResultsToInserts &&
+         (in_progress_scan_tasks == 0 ||
+          PendingBlocksBytes() < max_pending_blocks_bytes_)) {
     auto scan_range = pending_scan_ranges_->front();
     pending_scan_ranges_->pop_front();
     auto& task = scan_tasks_in_progress_.emplace_back(
@@ -193,25 +217,31 @@ void ZCashScanBlocksTask::OnScanningRangeComplete(
 void ZCashScanBlocksTask::MaybeInsertResult() {
   if (scan_tasks_in_progress_.size() != 0 && !inserting_in_progress_) {
     // Since insertion is done sequentally we need to wait until the first scan
-    // range in the order is ready.
-    auto& front_task = scan_tasks_in_progress_.front();
-    if (!front_task.finished()) {
+    // range in the order is ready. All ready ranges which follow it are
+    // inserted together to reduce the number of database commits.
+    std::vector<OrchardBlockScanner::Result> results;
+    for (auto& task : scan_tasks_in_progress_) {
+      if (!task.finished() || results.size() >= max_results_per_insert_) {
+        break;
+      }
+      results.push_back(task.TakeResult());
+    }
+    if (results.empty()) {
       return;
     }
     inserting_in_progress_ = true;
-    context_->sync_state->AsyncCall(&OrchardSyncState::ApplyScanResults)
-        .WithArgs(context_->account_id.Clone(), front_task.TakeResult())
+    size_t results_count = results.size();
+    context_->sync_state->AsyncCall(&OrchardSyncState::ApplyScanResultsBatch)
+        .WithArgs(context_->account_id.Clone(), std::move(results))
         .Then(base::BindOnce(&ZCashScanBlocksTask::OnResultInserted,
-                             weak_ptr_factory_.GetWeakPtr(),
-                             front_task.scan_range()));
+                             weak_ptr_factory_.GetWeakPtr(), results_count));
   }
 }
 
 void ZCashScanBlocksTask::OnResultInserted(
-    ScanRange scan_range,
+    size_t results_count,
     base::expected<OrchardStorage::Result, OrchardStorage::Error> result) {
   inserting_in_progress_ = false;
-  scan_tasks_in_progress_.pop_front();
   if (!result.has_value()) {
     error_ = ZCashShieldSyncService::Error{
         ZCashShieldSyncService::ErrorCode::kFailedToUpdateDatabase,
@@ -220,7 +250,12 @@ void ZCashScanBlocksTask::OnResultInserted(
     return;
   }
 
-  NotifyObserver();
+  CHECK_LE(results_count, scan_tasks_in_progress_.size());
+  for (size_t i = 0; i < results_count; i++) {
+    throughput_ += scan_tasks_in_progress_.front().throughput();
+    scan_tasks_in_progress_.pop_front();
+    NotifyObserver();
+  }
   ScheduleWorkOnTask();
 }
 
@@ -16,12 +16,22 @@
 
 namespace brave_wallet {
 
+// Bounds of the number of batches scanned in parallel, which scales with the
+// available cores.
 inline constexpr uint32_t kZCashMaxTasksInProgress = 4u;
+inline constexpr uint32_t kZCashMaxTasksInProgressLimit = 16u;
+// No more batches are started while the downloaded blocks which wait to be
+// scanned exceed this size.
+inline constexpr size_t kZCashMaxPendingBlocksBytes = 64u * 1024u * 1024u;
+// Up to this number of consecutive ready batches are applied to the
+// OrchardSyncState within a single database transaction.
+inline constexpr size_t kZCashMaxResultsPerInsert = 4u;
 
 // ZCashScanBlocksTask scans blocks from the last scanned block to the provided
 // right border. Splits this range to subranges and uses a bunch of smaller
 // tasks to process.
-// Posts a number of ZCashBlocksBatchScanTask to work in parallel.
+// Posts a number of ZCashBlocksBatchScanTask to work in parallel, so that
+// blocks of later batches are downloaded while earlier ones are scanned.
 // After a ZCashBlocksBatchScanTask is ready applies the result to the
 // OrchardSyncState.
 class ZCashScanBlocksTask {
@@ -45,6 +55,14 @@ class ZCashScanBlocksTask {
     max_tasks_in_progress_ = tasks;
   }
 
+  void set_max_pending_blocks_bytes(size_t bytes) {
+    max_pending_blocks_bytes_ = bytes;
+  }
+
+  void set_max_results_per_insert(size_t results) {
+    max_results_per_insert_ = results;
+  }
+
  private:
   void ScheduleWorkOnTask();
   void WorkOnTask();
@@ -66,12 +84,13 @@ class ZCashScanBlocksTask {
 
   void MaybeInsertResult();
   void OnResultInserted(
-      ScanRange scan_range,
+      size_t results_count,
       base::expected<OrchardStorage::Result, OrchardStorage::Error> result);
 
   void NotifyObserver();
 
   size_t ReadyScanTasks();
+  size_t PendingBlocksBytes();
 
   raw_ref<ZCashActionContext> context_;
   raw_ref<ZCashShieldSyncService::OrchardBlockScannerProxy> scanner_;
@@ -84,7 +103,9 @@ class ZCashScanBlocksTask {
 
   bool started_ = false;
   bool finished_ = false;
-  uint32_t max_tasks_in_progress_ = kZCashMaxTasksInProgress;
+  uint32_t max_tasks_in_progress_;
+  size_t max_pending_blocks_bytes_ = kZCashMaxPendingBlocksBytes;
+  size_t max_results_per_insert_ = kZCashMaxResultsPerInsert;
 
   std::optional<ZCashShieldSyncService::Error> error_;
   std::optional<OrchardStorage::AccountMeta> account_meta_;
@@ -94,6 +115,7 @@ class ZCashScanBlocksTask {
 
   std::deque<ZCashBlocksBatchScanTask> scan_tasks_in_progress_;
   bool inserting_in_progress_ = false;
+  ZCashShieldSyncService::SyncThroughput throughput_;
 
   base::WeakPtrFactory<ZCashScanBlocksTask> weak_ptr_factory_{this};
 };
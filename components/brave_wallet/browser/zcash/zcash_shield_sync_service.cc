@@ -27,11 +27,25 @@ int GetCode(ZCashShieldSyncService::ErrorCode error) {
 
 }  // namespace
 
+ZCashShieldSyncService::SyncThroughput&
+ZCashShieldSyncService::SyncThroughput::operator+=(
+    const SyncThroughput& other) {
+  downloaded_blocks += other.downloaded_blocks;
+  downloaded_bytes += other.downloaded_bytes;
+  download_time += other.download_time;
+  scanned_blocks += other.scanned_blocks;
+  scan_time += other.scan_time;
+  return *this;
+}
+
 ZCashShieldSyncService::OrchardBlockScannerProxy::OrchardBlockScannerProxy(
     OrchardFullViewKey full_view_key)
     : full_view_key_(full_view_key) {
+  // Not sequenced, so batches are decrypted in parallel. Best effort tasks
+  // share a small pool of background workers, which would cap the scan at a
+  // couple of cores.
   task_runner_ = base::ThreadPool::CreateTaskRunner(
-      {base::MayBlock(), base::TaskPriority::BEST_EFFORT});
+      {base::MayBlock(), base::TaskPriority::USER_VISIBLE});
 }
 
 ZCashShieldSyncService::OrchardBlockScannerProxy::~OrchardBlockScannerProxy() =
@@ -299,6 +313,8 @@ void ZCashShieldSyncService::OnGetSpendableNotes(
   if (observer_) {
     observer_->OnSyncStatusUpdate(context_.account_id,
                                   current_sync_status_.Clone());
+    observer_->OnSyncThroughputUpdate(context_.account_id,
+                                      scan_range_result.throughput);
   }
 
   ScheduleWorkOnTask();
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "base/gtest_prod_util.h"
+#include "base/time/time.h"
 #include "base/types/expected.h"
 #include "brave/components/brave_wallet/browser/internal/orchard_block_scanner.h"
 #include "brave/components/brave_wallet/browser/internal/orchard_sync_state.h"
@@ -49,11 +50,25 @@ class ZCashShieldSyncService {
     std::string message;
   };
 
+  // Per-stage counters of block scanning. Times are summed over the batches
+  // which are processed in parallel.
+  struct SyncThroughput {
+    uint32_t downloaded_blocks = 0;
+    uint64_t downloaded_bytes = 0;
+    base::TimeDelta download_time;
+    uint32_t scanned_blocks = 0;
+    base::TimeDelta scan_time;
+
+    SyncThroughput& operator+=(const SyncThroughput& other);
+  };
+
   struct ScanRangeResult {
     uint32_t start_block = 0;
     uint32_t end_block = 0;
     size_t total_ranges = 0;
     size_t ready_ranges = 0;
+    // Accumulated over the ranges which are ready.
+    SyncThroughput throughput;
 
     bool IsFinished() { return total_ranges == ready_ranges; }
   };
@@ -68,6 +83,8 @@ class ZCashShieldSyncService {
     virtual void OnSyncStatusUpdate(
         const mojom::AccountIdPtr& account_id,
         const mojom::ZCashShieldSyncStatusPtr& status) = 0;
+    virtual void OnSyncThroughputUpdate(const mojom::AccountIdPtr& account_id,
+                                        const SyncThroughput& throughput) = 0;
   };
 
   class OrchardBlockScannerProxy {
@@ -90,6 +90,10 @@ class MockZCashShieldSyncServiceObserver
     statuses_.push_back(status.Clone());
   }
 
+  MOCK_METHOD2(
+      OnSyncThroughputUpdate,
+      void(const mojom::AccountIdPtr& account_id,
+           const ZCashShieldSyncService::SyncThroughput& throughput));
   MOCK_METHOD1(OnSyncStop, void(const mojom::AccountIdPtr& account_id));
   MOCK_METHOD2(OnSyncError,
                void(const mojom::AccountIdPtr& account_id,
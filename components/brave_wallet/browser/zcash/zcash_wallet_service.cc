@@ -13,6 +13,7 @@
 #include "base/check.h"
 #include "base/check_is_test.h"
 #include "base/containers/span.h"
+#include "base/logging.h"
 #include "base/task/thread_pool.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/browser/zcash/zcash_create_transparent_transaction_task.h"
@@ -892,6 +893,24 @@ void ZCashWalletService::OnSyncStatusUpdate(
   }
 }
 
+void ZCashWalletService::OnSyncThroughputUpdate(
+    const mojom::AccountIdPtr& account_id,
+    const ZCashShieldSyncService::SyncThroughput& throughput) {
+  auto blocks_per_second = [](uint32_t blocks, base::TimeDelta time) {
+    return time.is_positive() ? blocks / time.InSecondsF() : 0.0;
+  };
+  DVLOG(1) << "ZCash sync throughput for " << account_id->unique_key
+           << ": downloaded " << throughput.downloaded_blocks << " blocks ("
+           << throughput.downloaded_bytes << " bytes) at "
+           << blocks_per_second(throughput.downloaded_blocks,
+                                throughput.download_time)
+           << " blocks/s, scanned " << throughput.scanned_blocks
+           << " blocks at "
+           << blocks_per_second(throughput.scanned_blocks,
+                                throughput.scan_time)
+           << " blocks/s";
+}
+
 void ZCashWalletService::OnResetSyncState(
     ResetSyncStateCallback callback,
     base::expected<OrchardStorage::Result, OrchardStorage::Error> result) {
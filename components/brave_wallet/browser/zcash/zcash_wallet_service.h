@@ -316,6 +316,9 @@ class ZCashWalletService : public mojom::ZCashWalletService,
   void OnSyncStatusUpdate(
       const mojom::AccountIdPtr& account_id,
       const mojom::ZCashShieldSyncStatusPtr& status) override;
+  void OnSyncThroughputUpdate(
+      const mojom::AccountIdPtr& account_id,
+      const ZCashShieldSyncService::SyncThroughput& throughput) override;
 
   void OnResetSyncState(
       ResetSyncStateCallback callback,
@@ -383,8 +383,8 @@ TEST_F(ZCashWalletServiceUnitTest, GetBalanceWithShielded) {
       features::kBraveWalletZCashFeature,
       {{"zcash_shielded_transactions_enabled", "true"}});
   keyring_service()->Reset();
-  keyring_service()->RestoreWallet(kMnemonicDivideCruise, kTestWalletPassword,
-                                   false, base::DoNothing());
+  keyring_service()->RestoreWalletSync(kMnemonicDivideCruise,
+                                       kTestWalletPassword, false);
 
   auto account =
       GetAccountUtils().EnsureAccount(mojom::KeyringId::kZCashMainnet, 1);
@@ -487,8 +487,8 @@ TEST_F(ZCashWalletServiceUnitTest, GetBalanceWithShielded_FeatureDisabled) {
       features::kBraveWalletZCashFeature,
       {{"zcash_shielded_transactions_enabled", "false"}});
   keyring_service()->Reset();
-  keyring_service()->RestoreWallet(kMnemonicDivideCruise, kTestWalletPassword,
-                                   false, base::DoNothing());
+  keyring_service()->RestoreWalletSync(kMnemonicDivideCruise,
+                                       kTestWalletPassword, false);
   auto account =
       GetAccountUtils().EnsureAccount(mojom::KeyringId::kZCashMainnet, 1);
   keyring_service()->UpdateNextUnusedAddressForZCashAccount(account->account_id,
@@ -1359,8 +1359,8 @@ TEST_F(ZCashWalletServiceUnitTest, AutoSync) {
       {{"zcash_shielded_transactions_enabled", "true"}});
 
   keyring_service()->Reset();
-  keyring_service()->RestoreWallet(kGateJuniorMnemonic, kTestWalletPassword,
-                                   false, base::DoNothing());
+  keyring_service()->RestoreWalletSync(kGateJuniorMnemonic, kTestWalletPassword,
+                                       false);
   auto account_1 =
       GetAccountUtils().EnsureAccount(mojom::KeyringId::kZCashMainnet, 0);
   auto account_id_1 = account_1->account_id.Clone();
@@ -1415,8 +1415,8 @@ TEST_F(ZCashWalletServiceUnitTest, ZCashAccountInfo) {
       {{"zcash_shielded_transactions_enabled", "true"}});
 
   keyring_service()->Reset();
-  keyring_service()->RestoreWallet(kGateJuniorMnemonic, kTestWalletPassword,
-                                   false, base::DoNothing());
+  keyring_service()->RestoreWalletSync(kGateJuniorMnemonic, kTestWalletPassword,
+                                       false);
   auto account_1 =
       GetAccountUtils().EnsureAccount(mojom::KeyringId::kZCashMainnet, 0);
   auto account_id_1 = account_1->account_id.Clone();
@@ -1555,8 +1555,8 @@ TEST_F(ZCashWalletServiceUnitTest, MakeAccountShielded) {
       {{"zcash_shielded_transactions_enabled", "true"}});
 
   keyring_service()->Reset();
-  keyring_service()->RestoreWallet(kGateJuniorMnemonic, kTestWalletPassword,
-                                   false, base::DoNothing());
+  keyring_service()->RestoreWalletSync(kGateJuniorMnemonic, kTestWalletPassword,
+                                       false);
   auto account_1 =
       GetAccountUtils().EnsureAccount(mojom::KeyringId::kZCashMainnet, 0);
   auto account_2 =
@@ -1640,8 +1640,8 @@ TEST_F(ZCashWalletServiceUnitTest, ShieldFunds_FailsOnNetworkError) {
       {{"zcash_shielded_transactions_enabled", "true"}});
 
   keyring_service()->Reset();
-  keyring_service()->RestoreWallet(kGateJuniorMnemonic, kTestWalletPassword,
-                                   false, base::DoNothing());
+  keyring_service()->RestoreWalletSync(kGateJuniorMnemonic, kTestWalletPassword,
+                                       false);
   OrchardBundleManager::OverrideRandomSeedForTesting(70972);
   auto account =
       GetAccountUtils().EnsureAccount(mojom::KeyringId::kZCashMainnet, 0);
@@ -1719,8 +1719,8 @@ TEST_F(ZCashWalletServiceUnitTest, MAYBE_ShieldFunds) {
       {{"zcash_shielded_transactions_enabled", "true"}});
 
   keyring_service()->Reset();
-  keyring_service()->RestoreWallet(kGateJuniorMnemonic, kTestWalletPassword,
-                                   false, base::DoNothing());
+  keyring_service()->RestoreWalletSync(kGateJuniorMnemonic, kTestWalletPassword,
+                                       false);
   OrchardBundleManager::OverrideRandomSeedForTesting(10987);
   auto account =
       GetAccountUtils().EnsureAccount(mojom::KeyringId::kZCashMainnet, 1);
@@ -2131,8 +2131,8 @@ TEST_F(ZCashWalletServiceUnitTest, MAYBE_ShieldAllFunds) {
       {{"zcash_shielded_transactions_enabled", "true"}});
 
   keyring_service()->Reset();
-  keyring_service()->RestoreWallet(kGateJuniorMnemonic, kTestWalletPassword,
-                                   false, base::DoNothing());
+  keyring_service()->RestoreWalletSync(kGateJuniorMnemonic, kTestWalletPassword,
+                                       false);
   OrchardBundleManager::OverrideRandomSeedForTesting(70972);
   auto account =
       GetAccountUtils().EnsureAccount(mojom::KeyringId::kZCashMainnet, 0);
@@ -2659,8 +2659,8 @@ TEST_F(ZCashWalletServiceUnitTest, MAYBE_SendShieldedFunds) {
   OverrideSyncStateForTesting(std::move(overrided_sync_state));
 
   keyring_service()->Reset();
-  keyring_service()->RestoreWallet(kMnemonicGalleryEqual, kTestWalletPassword,
-                                   false, base::DoNothing());
+  keyring_service()->RestoreWalletSync(kMnemonicGalleryEqual,
+                                       kTestWalletPassword, false);
   OrchardBundleManager::OverrideRandomSeedForTesting(985321);
   auto account =
       GetAccountUtils().EnsureAccount(mojom::KeyringId::kZCashMainnet, 6);
@@ -3037,8 +3037,8 @@ TEST_F(ZCashWalletServiceUnitTest, ShieldSync) {
       {{"zcash_shielded_transactions_enabled", "true"}});
 
   keyring_service()->Reset();
-  keyring_service()->RestoreWallet(kGateJuniorMnemonic, kTestWalletPassword,
-                                   false, base::DoNothing());
+  keyring_service()->RestoreWalletSync(kGateJuniorMnemonic, kTestWalletPassword,
+                                       false);
   GetAccountUtils().EnsureAccount(mojom::KeyringId::kZCashMainnet, 0);
 
   keyring_service()->SetZCashAccountBirthday(
@@ -38,6 +38,8 @@ class CardanoAddress {
   bool IsTestnet() const;
 
   std::vector<uint8_t> ToCborBytes() const;
+  // Length of ToCborBytes() without copying the bytes.
+  size_t GetCborBytesSize() const { return bytes_.size(); }
 
   static std::optional<CardanoAddress> FromCborBytes(
       base::span<const uint8_t> bytes);
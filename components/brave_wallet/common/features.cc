@@ -63,4 +63,48 @@ BASE_FEATURE(kBraveWalletAnkrBalancesFeature,
 BASE_FEATURE(kBraveWalletTransactionSimulationsFeature,
              "BraveWalletTransactionSimulations",
              base::FEATURE_DISABLED_BY_DEFAULT);
+
+BASE_FEATURE(kBraveWalletJsonRpcBatchingFeature,
+             "BraveWalletJsonRpcBatching",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+const base::FeatureParam<int> kJsonRpcBatchingWindowMs{
+    &kBraveWalletJsonRpcBatchingFeature, "batching_window_ms", 10};
+const base::FeatureParam<int> kJsonRpcMaxBatchSize{
+    &kBraveWalletJsonRpcBatchingFeature, "max_batch_size", 20};
+
+BASE_FEATURE(kBraveWalletJsonRpcResponseCacheFeature,
+             "BraveWalletJsonRpcResponseCache",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
+BASE_FEATURE(kBraveWalletNftMetadataCacheFeature,
+             "BraveWalletNftMetadataCache",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+const base::FeatureParam<int> kNftMetadataCacheTtlMinutes{
+    &kBraveWalletNftMetadataCacheFeature, "ttl_minutes", 60};
+
+BASE_FEATURE(kBraveWalletDecentralizedDnsCacheFeature,
+             "BraveWalletDecentralizedDnsCache",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+const base::FeatureParam<int> kDecentralizedDnsCacheTtlMinutes{
+    &kBraveWalletDecentralizedDnsCacheFeature, "ttl_minutes", 5};
+
+BASE_FEATURE(kBraveWalletUnstoppableDomainsSpeculativeFeature,
+             "BraveWalletUnstoppableDomainsSpeculative",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
+BASE_FEATURE(kBraveWalletSwapQuoteFanOutFeature,
+             "BraveWalletSwapQuoteFanOut",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+const base::FeatureParam<int> kSwapQuoteFanOutDeadlineMs{
+    &kBraveWalletSwapQuoteFanOutFeature, "deadline_ms", 1500};
+
+BASE_FEATURE(kBraveWalletPriceCacheFeature,
+             "BraveWalletPriceCache",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+const base::FeatureParam<int> kPriceCacheTtlSeconds{
+    &kBraveWalletPriceCacheFeature, "ttl_seconds", 60};
+const base::FeatureParam<int> kPriceHistoryCacheTtlMinutes{
+    &kBraveWalletPriceCacheFeature, "history_ttl_minutes", 5};
+const base::FeatureParam<int> kPriceBatchingWindowMs{
+    &kBraveWalletPriceCacheFeature, "batching_window_ms", 50};
 }  // namespace brave_wallet::features
@@ -34,6 +34,36 @@ extern const base::FeatureParam<bool> kCardanoDAppSupport;
 BASE_DECLARE_FEATURE(kBraveWalletAnkrBalancesFeature);
 BASE_DECLARE_FEATURE(kBraveWalletTransactionSimulationsFeature);
 
+// Coalesces JSON-RPC requests to the same endpoint into batches.
+BASE_DECLARE_FEATURE(kBraveWalletJsonRpcBatchingFeature);
+extern const base::FeatureParam<int> kJsonRpcBatchingWindowMs;
+extern const base::FeatureParam<int> kJsonRpcMaxBatchSize;
+// Serves idempotent JSON-RPC queries from a short-lived response cache.
+BASE_DECLARE_FEATURE(kBraveWalletJsonRpcResponseCacheFeature);
+// Keeps fetched NFT metadata in memory so collections render again without
+// refetching every token.
+BASE_DECLARE_FEATURE(kBraveWalletNftMetadataCacheFeature);
+extern const base::FeatureParam<int> kNftMetadataCacheTtlMinutes;
+// Keeps successful ENS, SNS and Unstoppable Domains host resolutions in memory
+// so that revisits to the same name skip the RPC resolution chain.
+BASE_DECLARE_FEATURE(kBraveWalletDecentralizedDnsCacheFeature);
+extern const base::FeatureParam<int> kDecentralizedDnsCacheTtlMinutes;
+// Resolves Unstoppable Domains multichain calls as soon as the highest
+// priority chain that can still answer has answered, instead of waiting for
+// every chain.
+BASE_DECLARE_FEATURE(kBraveWalletUnstoppableDomainsSpeculativeFeature);
+// Asks every eligible swap provider for a quote at once when the provider is
+// kAuto, and answers with the most preferred provider's quote available by the
+// deadline.
+BASE_DECLARE_FEATURE(kBraveWalletSwapQuoteFanOutFeature);
+extern const base::FeatureParam<int> kSwapQuoteFanOutDeadlineMs;
+// Shares asset prices and price history between AssetRatioService callers for
+// a short time, and merges concurrent price requests into a single one.
+BASE_DECLARE_FEATURE(kBraveWalletPriceCacheFeature);
+extern const base::FeatureParam<int> kPriceCacheTtlSeconds;
+extern const base::FeatureParam<int> kPriceHistoryCacheTtlMinutes;
+extern const base::FeatureParam<int> kPriceBatchingWindowMs;
+
 }  // namespace brave_wallet::features
 
 #endif  // BRAVE_COMPONENTS_BRAVE_WALLET_COMMON_FEATURES_H_
@@ -6,12 +6,17 @@
 #include "brave/components/cosmetic_filters/renderer/cosmetic_filters_js_handler.h"
 
 #include <optional>
+#include <set>
+#include <string>
 #include <utility>
 
 #include "base/check.h"
 #include "base/containers/fixed_flat_set.h"
+#include "base/containers/lru_cache.h"
 #include "base/feature_list.h"
 #include "base/functional/bind.h"
+#include "base/hash/hash.h"
+#include "base/json/json_reader.h"
 #include "base/json/json_writer.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/no_destructor.h"
@@ -31,11 +36,13 @@
 #include "third_party/blink/public/platform/browser_interface_broker_proxy.h"
 #include "third_party/blink/public/platform/scheduler/web_agent_group_scheduler.h"
 #include "third_party/blink/public/platform/web_content_settings_client.h"
+#include "third_party/blink/public/platform/web_string.h"
 #include "third_party/blink/public/web/web_css_origin.h"
 #include "third_party/blink/public/web/web_document.h"
 #include "third_party/blink/public/web/web_local_frame.h"
 #include "third_party/blink/public/web/web_script_source.h"
 #include "ui/base/resource/resource_bundle.h"
+#include "url/origin.h"
 #include "v8/include/v8-primitive.h"
 #include "v8/include/v8.h"
 
@@ -171,6 +178,86 @@ int MakeUniquePerfId() {
 
 constexpr const char TRACE_CATEGORY[] = "brave.adblock";
 
+// Upper bound on the class/id tokens remembered per page for deduplication.
+// Tokens past the limit are still forwarded, just not remembered.
+constexpr size_t kMaxSentClassIdTokens = 10000;
+
+// Drops the tokens of `tokens` that were already sent for the current page and
+// remembers the remaining ones in `sent_tokens`. Returns how many tokens were
+// dropped.
+size_t RemoveSentTokens(base::Value::List& tokens,
+                        std::set<std::string>& sent_tokens) {
+  return tokens.EraseIf([&](const base::Value& token) {
+    if (!token.is_string() || sent_tokens.contains(token.GetString())) {
+      return true;
+    }
+    if (sent_tokens.size() < kMaxSentClassIdTokens) {
+      sent_tokens.insert(token.GetString());
+    }
+    return false;
+  });
+}
+
+// Appends a rule hiding every selector in `selectors` to `stylesheet`.
+void AppendHideRules(const base::Value::List& selectors,
+                     std::string& stylesheet) {
+  for (const auto& selector : selectors) {
+    if (selector.is_string()) {
+      stylesheet += selector.GetString() + "{display:none !important}";
+    }
+  }
+}
+
+// Folds the selectors of `selectors` into `fingerprint`.
+uint64_t FingerprintSelectors(const base::Value::List& selectors,
+                              uint64_t fingerprint) {
+  fingerprint = base::HashInts(fingerprint, selectors.size());
+  for (const auto& selector : selectors) {
+    if (selector.is_string()) {
+      const std::string& text = selector.GetString();
+      fingerprint =
+          base::HashInts(fingerprint, base::FastHash(base::as_byte_span(text)));
+    }
+  }
+  return fingerprint;
+}
+
+// The initial hide stylesheet built for a frame origin. Frames of the same
+// origin usually get identical selector lists, so the stylesheet, which can
+// be several hundred KB, is built and converted once per renderer and then
+// handed to every such frame by reference.
+struct CachedHideStylesheet {
+  uint64_t fingerprint;
+  blink::WebString stylesheet;
+};
+
+constexpr size_t kHideStylesheetCacheSize = 8;
+
+base::LRUCache<url::Origin, CachedHideStylesheet>& GetHideStylesheetCache() {
+  static base::NoDestructor<base::LRUCache<url::Origin, CachedHideStylesheet>>
+      cache(kHideStylesheetCacheSize);
+  return *cache;
+}
+
+// The scriptlet script built for a host. Every frame of a site gets the same
+// injected script, so it is serialized once per renderer and then executed
+// from the same string, which also lets V8 reuse the compiled script from its
+// in-isolate compilation cache instead of parsing it again for every frame.
+// `fingerprint` covers the injected script and the init flags, so an engine
+// update that changes the scriptlets produces a new entry.
+struct CachedScriptletScript {
+  uint64_t fingerprint;
+  blink::WebString script;
+};
+
+constexpr size_t kScriptletScriptCacheSize = 8;
+
+base::LRUCache<std::string, CachedScriptletScript>& GetScriptletScriptCache() {
+  static base::NoDestructor<base::LRUCache<std::string, CachedScriptletScript>>
+      cache(kScriptletScriptCacheSize);
+  return *cache;
+}
+
 // Gets content settings for a given frame's security origin, accounting for
 // intermediaries like `about:blank`.
 blink::WebContentSettingsClient* GetWebContentSettingsClient(
@@ -225,6 +312,8 @@ namespace cosmetic_filters {
 // brave://tracing & brave://histograms.
 class CosmeticFilterPerfTracker {
  public:
+  ~CosmeticFilterPerfTracker() { ReportPageStats(); }
+
   int OnHandleMutationsBegin() {
     const auto event_id = MakeUniquePerfId();
     TRACE_EVENT_NESTABLE_ASYNC_BEGIN0(
@@ -252,6 +341,59 @@ class CosmeticFilterPerfTracker {
         TRACE_CATEGORY, "QuerySelectors",
         TRACE_ID_WITH_SCOPE("QuerySelectors", event_id));
   }
+
+  void OnHiddenClassIdSelectorsRequested() { ++selector_requests_; }
+
+  // Called for every batch of class/id tokens flushed by the content script,
+  // before tokens already sent for the page are dropped.
+  void OnClassIdTokensFlushed(size_t tokens, size_t duplicate_tokens) {
+    ++class_id_flushes_;
+    class_id_tokens_ += tokens;
+    duplicate_class_id_tokens_ += duplicate_tokens;
+  }
+
+  void OnHiddenClassIdSelectorsResponse(bool has_selectors) {
+    if (!has_selectors) {
+      ++empty_selector_responses_;
+    }
+  }
+
+  // Records how many class/id selector IPCs the current page sent, and how
+  // many of them turned out to match nothing, then starts over for the next
+  // page.
+  void ReportPageStats() {
+    if (class_id_flushes_ > 0) {
+      UMA_HISTOGRAM_COUNTS_10000("Brave.CosmeticFilters.ClassIdFlushesPerPage",
+                                 class_id_flushes_);
+    }
+    if (class_id_tokens_ > 0) {
+      UMA_HISTOGRAM_PERCENTAGE(
+          "Brave.CosmeticFilters.DuplicateClassIdTokens",
+          duplicate_class_id_tokens_ * 100 / class_id_tokens_);
+    }
+    class_id_flushes_ = 0;
+    class_id_tokens_ = 0;
+    duplicate_class_id_tokens_ = 0;
+
+    if (selector_requests_ == 0) {
+      return;
+    }
+    UMA_HISTOGRAM_COUNTS_10000(
+        "Brave.CosmeticFilters.HiddenClassIdSelectorsRequestsPerPage",
+        selector_requests_);
+    UMA_HISTOGRAM_PERCENTAGE(
+        "Brave.CosmeticFilters.HiddenClassIdSelectorsEmptyResponses",
+        empty_selector_responses_ * 100 / selector_requests_);
+    selector_requests_ = 0;
+    empty_selector_responses_ = 0;
+  }
+
+ private:
+  int selector_requests_ = 0;
+  int empty_selector_responses_ = 0;
+  int class_id_flushes_ = 0;
+  size_t class_id_tokens_ = 0;
+  size_t duplicate_class_id_tokens_ = 0;
 };
 
 CosmeticFiltersJSHandler::CosmeticFiltersJSHandler(
@@ -281,8 +423,47 @@ void CosmeticFiltersJSHandler::HiddenClassIdSelectors(
   if (!EnsureConnected())
     return;
 
+  std::optional<base::Value::Dict> input_dict = base::JSONReader::ReadDict(
+      input, base::JSON_PARSE_CHROMIUM_EXTENSIONS |
+                 base::JSON_REPLACE_INVALID_CHARACTERS);
+  if (!input_dict) {
+    return;
+  }
+
+  // The content script reports every class and id it sees in mutated nodes,
+  // so long-lived pages keep sending tokens that were already matched. Their
+  // selectors have been applied by then, so only new tokens are forwarded.
+  size_t tokens = 0;
+  size_t duplicate_tokens = 0;
+  bool has_new_tokens = false;
+  for (auto [key, sent_tokens] :
+       {std::make_pair("classes", &sent_classes_),
+        std::make_pair("ids", &sent_ids_)}) {
+    base::Value::List* list = input_dict->FindList(key);
+    if (!list) {
+      continue;
+    }
+    tokens += list->size();
+    duplicate_tokens += RemoveSentTokens(*list, *sent_tokens);
+    has_new_tokens |= !list->empty();
+  }
+  if (perf_tracker_) {
+    perf_tracker_->OnClassIdTokensFlushed(tokens, duplicate_tokens);
+  }
+  if (!has_new_tokens) {
+    return;
+  }
+
+  std::string new_tokens_input;
+  if (!base::JSONWriter::Write(*input_dict, &new_tokens_input)) {
+    return;
+  }
+
+  if (perf_tracker_) {
+    perf_tracker_->OnHiddenClassIdSelectorsRequested();
+  }
   cosmetic_filters_resources_->HiddenClassIdSelectors(
-      input, exceptions_,
+      new_tokens_input, exceptions_,
       base::BindOnce(&CosmeticFiltersJSHandler::OnHiddenClassIdSelectors,
                      base::Unretained(this)));
 }
@@ -470,13 +651,16 @@ void CosmeticFiltersJSHandler::AddJavaScriptObjectToFrame(
 // `WebDocument::RemoveInsertedStyleSheet` works, but using a single stylesheet
 // per rule has a significant performance impact and should be avoided.
 void CosmeticFiltersJSHandler::InjectStylesheet(const std::string& stylesheet) {
+  InjectWebStylesheet(blink::WebString::FromUTF8(stylesheet));
+}
+
+void CosmeticFiltersJSHandler::InjectWebStylesheet(
+    const blink::WebString& stylesheet) {
   blink::WebLocalFrame* web_frame = render_frame_->GetWebFrame();
 
   blink::WebStyleSheetKey* style_sheet_key = nullptr;
-  blink::WebString stylesheet_webstring =
-      blink::WebString::FromUTF8(stylesheet);
-  web_frame->GetDocument().InsertStyleSheet(
-      stylesheet_webstring, style_sheet_key, blink::WebCssOrigin::kUser);
+  web_frame->GetDocument().InsertStyleSheet(stylesheet, style_sheet_key,
+                                            blink::WebCssOrigin::kUser);
 }
 
 void CosmeticFiltersJSHandler::CreateWorkerObject(
@@ -610,6 +794,11 @@ bool CosmeticFiltersJSHandler::ProcessURL(
     const GURL& url,
     std::optional<base::OnceClosure> callback) {
   resources_dict_ = std::nullopt;
+  if (perf_tracker_) {
+    perf_tracker_->ReportPageStats();
+  }
+  sent_classes_.clear();
+  sent_ids_.clear();
   url_ = url;
   enabled_1st_party_cf_ = false;
 
@@ -685,24 +874,38 @@ void CosmeticFiltersJSHandler::ApplyRules(bool de_amp_enabled) {
   SCOPED_UMA_HISTOGRAM_TIMER_MICROS("Brave.CosmeticFilters.ApplyRules");
   TRACE_EVENT1("brave.adblock", "ApplyRules", "url", url_.spec());
 
-  std::string scriptlet_script;
-  base::Value* injected_script = resources_dict_->Find("injected_script");
-
-  if (injected_script &&
-      base::JSONWriter::Write(*injected_script, &scriptlet_script)) {
+  const std::string* injected_script =
+      resources_dict_->FindString("injected_script");
+  if (injected_script) {
     const bool scriptlet_debug_enabled = base::FeatureList::IsEnabled(
         brave_shields::features::kBraveAdblockScriptletDebugLogs);
-
-    scriptlet_script =
-        absl::StrFormat(kScriptletInitScript,
-                        scriptlet_debug_enabled ? "[[\"canDebug\", true]]" : "",
-                        de_amp_enabled ? "true" : "false", scriptlet_script);
-  }
-  if (!scriptlet_script.empty()) {
-    web_frame->ExecuteScriptInIsolatedWorld(
-        isolated_world_id_,
-        blink::WebScriptSource(blink::WebString::FromUTF8(scriptlet_script)),
-        blink::BackForwardCacheAware::kAllow);
+    const uint64_t fingerprint = base::HashInts(
+        base::FastHash(base::as_byte_span(*injected_script)),
+        (scriptlet_debug_enabled ? 1 : 0) | (de_amp_enabled ? 2 : 0));
+
+    auto& script_cache = GetScriptletScriptCache();
+    auto cached = script_cache.Get(url_.host());
+    blink::WebString web_script;
+    if (cached != script_cache.end() &&
+        cached->second.fingerprint == fingerprint) {
+      web_script = cached->second.script;
+    } else {
+      std::string quoted_script;
+      if (base::JSONWriter::Write(base::Value(*injected_script),
+                                  &quoted_script)) {
+        web_script = blink::WebString::FromUTF8(absl::StrFormat(
+            kScriptletInitScript,
+            scriptlet_debug_enabled ? "[[\"canDebug\", true]]" : "",
+            de_amp_enabled ? "true" : "false", quoted_script));
+        script_cache.Put(url_.host(),
+                         {.fingerprint = fingerprint, .script = web_script});
+      }
+    }
+    if (!web_script.IsEmpty()) {
+      web_frame->ExecuteScriptInIsolatedWorld(
+          isolated_world_id_, blink::WebScriptSource(web_script),
+          blink::BackForwardCacheAware::kAllow);
+    }
   }
 
   // Working on css rules
@@ -773,18 +976,15 @@ void CosmeticFiltersJSHandler::CSSRulesRoutine(
           ? nullptr
           : resources_dict.FindList("hide_selectors");
 
-  std::string stylesheet = "";
+  // treat `hide_selectors` the same as `force_hide_selectors` if aggressive
+  // mode is enabled.
+  const base::Value::List* styled_hide_selectors_list =
+      enabled_1st_party_cf_ ? hide_selectors_list : nullptr;
+  const auto* force_hide_selectors_list =
+      resources_dict.FindList("force_hide_selectors");
 
   if (hide_selectors_list && !hide_selectors_list->empty()) {
-    // treat `hide_selectors` the same as `force_hide_selectors` if aggressive
-    // mode is enabled.
-    if (enabled_1st_party_cf_) {
-      for (auto& selector : *hide_selectors_list) {
-        if (selector.is_string()) {
-          stylesheet += selector.GetString() + "{display:none !important}";
-        }
-      }
-    } else {
+    if (!enabled_1st_party_cf_) {
       std::string json_selectors;
       base::JSONWriter::Write(*hide_selectors_list, &json_selectors);
       if (json_selectors.empty()) {
@@ -801,18 +1001,41 @@ void CosmeticFiltersJSHandler::CSSRulesRoutine(
     }
   }
 
-  const auto* force_hide_selectors_list =
-      resources_dict.FindList("force_hide_selectors");
+  uint64_t fingerprint = 0;
+  if (styled_hide_selectors_list) {
+    fingerprint =
+        FingerprintSelectors(*styled_hide_selectors_list, fingerprint);
+  }
   if (force_hide_selectors_list) {
-    for (auto& selector : *force_hide_selectors_list) {
-      if (selector.is_string()) {
-        stylesheet += selector.GetString() + "{display:none !important}";
-      }
+    fingerprint = FingerprintSelectors(*force_hide_selectors_list, fingerprint);
+  }
+
+  // Opaque origins never match another frame, so they are not cached.
+  auto& stylesheet_cache = GetHideStylesheetCache();
+  const url::Origin origin = url::Origin::Create(url_);
+  auto cached =
+      origin.opaque() ? stylesheet_cache.end() : stylesheet_cache.Get(origin);
+  blink::WebString web_stylesheet;
+  if (cached != stylesheet_cache.end() &&
+      cached->second.fingerprint == fingerprint) {
+    web_stylesheet = cached->second.stylesheet;
+  } else {
+    std::string stylesheet;
+    if (styled_hide_selectors_list) {
+      AppendHideRules(*styled_hide_selectors_list, stylesheet);
+    }
+    if (force_hide_selectors_list) {
+      AppendHideRules(*force_hide_selectors_list, stylesheet);
+    }
+    web_stylesheet = blink::WebString::FromUTF8(stylesheet);
+    if (!origin.opaque()) {
+      stylesheet_cache.Put(origin, {.fingerprint = fingerprint,
+                                    .stylesheet = web_stylesheet});
     }
   }
 
-  if (!stylesheet.empty()) {
-    InjectStylesheet(stylesheet);
+  if (!web_stylesheet.IsEmpty()) {
+    InjectWebStylesheet(web_stylesheet);
   }
 
   if (!enabled_1st_party_cf_)
@@ -821,6 +1044,13 @@ void CosmeticFiltersJSHandler::CSSRulesRoutine(
 
 void CosmeticFiltersJSHandler::OnHiddenClassIdSelectors(
     base::Value::Dict result) {
+  if (perf_tracker_) {
+    const auto* hide = result.FindList("hide_selectors");
+    const auto* force_hide = result.FindList("force_hide_selectors");
+    perf_tracker_->OnHiddenClassIdSelectorsResponse(
+        (hide && !hide->empty()) || (force_hide && !force_hide->empty()));
+  }
+
   if (generichide_) {
     return;
   }
@@ -838,12 +1068,8 @@ void CosmeticFiltersJSHandler::OnHiddenClassIdSelectors(
       result.FindList("force_hide_selectors");
 
   if (force_hide_selectors && force_hide_selectors->size() != 0) {
-    std::string stylesheet = "";
-    for (auto& selector : *force_hide_selectors) {
-      if (selector.is_string()) {
-        stylesheet += selector.GetString() + "{display:none !important}";
-      }
-    }
+    std::string stylesheet;
+    AppendHideRules(*force_hide_selectors, stylesheet);
     InjectStylesheet(stylesheet);
   }
 
@@ -853,12 +1079,8 @@ void CosmeticFiltersJSHandler::OnHiddenClassIdSelectors(
     return;
 
   if (enabled_1st_party_cf_) {
-    std::string stylesheet = "";
-    for (auto& selector : *hide_selectors) {
-      if (selector.is_string()) {
-        stylesheet += selector.GetString() + "{display:none !important}";
-      }
-    }
+    std::string stylesheet;
+    AppendHideRules(*hide_selectors, stylesheet);
     InjectStylesheet(stylesheet);
   } else {
     blink::WebLocalFrame* web_frame = render_frame_->GetWebFrame();
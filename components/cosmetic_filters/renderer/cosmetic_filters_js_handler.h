@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -23,6 +24,10 @@
 #include "url/gurl.h"
 #include "v8/include/v8-promise.h"
 
+namespace blink {
+class WebString;
+}  // namespace blink
+
 namespace cosmetic_filters {
 
 // CosmeticFiltersJSHandler class is responsible for JS execution inside a
@@ -100,6 +105,7 @@ class CosmeticFiltersJSHandler : public mojom::CosmeticFiltersAgent {
   void OnEventEnd(const std::string& event_name, int);
 
   void InjectStylesheet(const std::string& stylesheet);
+  void InjectWebStylesheet(const blink::WebString& stylesheet);
 
   bool generichide_ = false;
 
@@ -113,6 +119,10 @@ class CosmeticFiltersJSHandler : public mojom::CosmeticFiltersAgent {
   int32_t isolated_world_id_;
   bool enabled_1st_party_cf_;
   std::vector<std::string> exceptions_;
+  // Classes and ids already sent to `HiddenClassIdSelectors` for the current
+  // page.
+  std::set<std::string> sent_classes_;
+  std::set<std::string> sent_ids_;
   GURL url_;
   std::optional<base::Value::Dict> resources_dict_;
   std::unique_ptr<content::V8ValueConverter> v8_value_converter_;
@@ -5,6 +5,7 @@
 
 #include "brave/components/de_amp/browser/de_amp_body_handler.h"
 
+#include <algorithm>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -74,6 +75,16 @@ bool FindUrlInNavigationChain(const GURL& url, const base::Value::List& chain) {
   return false;
 }
 
+// The canonical link must be in the document head, so there is no point in
+// looking for it once the head has been closed.
+bool HasHeadEnded(std::string_view body) {
+  static constexpr std::string_view kHeadEndTag = "</head";
+  return std::search(body.begin(), body.end(), kHeadEndTag.begin(),
+                     kHeadEndTag.end(), [](char body_char, char tag_char) {
+                       return base::ToLowerASCII(body_char) == tag_char;
+                     }) != body.end();
+}
+
 std::string AddUrlToNavigationChain(const GURL& url, base::Value::List chain) {
   chain.Append(url.spec());
   return base::WriteJson(chain).value_or(std::string());
@@ -151,12 +162,29 @@ DeAmpBodyHandler::Action DeAmpBodyHandler::OnBodyUpdated(
       // Amp found, checking for canonical url.
       state_ = State::kFindForCanonicalUrl;
       [[fallthrough]];
-    case State::kFindForCanonicalUrl:
-      if (MaybeRedirectToCanonicalLink(body)) {
+    case State::kFindForCanonicalUrl: {
+      // Only scan the part of the body which may contain a link tag that has
+      // not been looked at yet, instead of the whole accumulated body.
+      const std::string_view analyzed =
+          std::string_view(body).substr(0, kMaxBytesToCheck);
+      const std::string_view pending =
+          analyzed.substr(std::min(canonical_search_start_, analyzed.size()));
+      if (MaybeRedirectToCanonicalLink(pending)) {
         // Only abort if we know we're successfully going to the canonical URL.
         return DeAmpBodyHandler::Action::kCancel;
       }
+      if (HasHeadEnded(pending)) {
+        return DeAmpBodyHandler::Action::kComplete;
+      }
+      // A tag may be cut off at the end of the received data, so resume from
+      // the last tag opening on the next update.
+      const size_t last_tag = analyzed.rfind('<');
+      if (last_tag != std::string_view::npos &&
+          last_tag > canonical_search_start_) {
+        canonical_search_start_ = last_tag;
+      }
       break;
+    }
   }
 
   return (is_complete || (bytes_analyzed_ >= kMaxBytesToCheck))
@@ -177,9 +205,8 @@ void DeAmpBodyHandler::DeAmpBodyHandler::Transform(
 void DeAmpBodyHandler::UpdateResponseHead(
     network::mojom::URLResponseHead* response_head) {}
 
-bool DeAmpBodyHandler::MaybeRedirectToCanonicalLink(const std::string& body) {
-  const auto canonical_link =
-      FindCanonicalAmpUrl(std::string_view(body).substr(0, kMaxBytesToCheck));
+bool DeAmpBodyHandler::MaybeRedirectToCanonicalLink(std::string_view body) {
+  const auto canonical_link = FindCanonicalAmpUrl(body);
   if (!canonical_link.has_value()) {
     VLOG(2) << __func__ << canonical_link.error();
     return false;
@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 
 #include "base/values.h"
 #include "brave/components/body_sniffer/body_sniffer_url_loader.h"
@@ -44,7 +45,7 @@ class DeAmpBodyHandler : public body_sniffer::BodyHandler {
  private:
   DeAmpBodyHandler(const network::ResourceRequest& request,
                    const content::WebContents::Getter& wc_getter);
-  bool MaybeRedirectToCanonicalLink(const std::string& body);
+  bool MaybeRedirectToCanonicalLink(std::string_view body);
   bool OpenCanonicalURL(const GURL& new_url);
 
   network::ResourceRequest request_;
@@ -53,6 +54,9 @@ class DeAmpBodyHandler : public body_sniffer::BodyHandler {
 
   base::Value::List navigation_chain_;
   size_t bytes_analyzed_ = 0;
+  // Offset into the body at which the next search for the canonical link
+  // starts. Everything before it has already been scanned.
+  size_t canonical_search_start_ = 0;
 
   enum class State {
     kCheckForAmp,
@@ -281,6 +281,20 @@ IN_PROC_BROWSER_TEST_F(DeAmpBrowserTest, CanonicalLinkOutsideChunkOutsideMax) {
   NavigateToURLAndWaitForRedirects(kTestAmpPage, kTestAmpPage);
 }
 
+IN_PROC_BROWSER_TEST_F(DeAmpBrowserTest, CanonicalLinkAfterHeadIgnored) {
+  TogglePref(true);
+  // The canonical link is only looked up within <head>.
+  const std::string amp_body = absl::StrFormat(
+      "<html amp><head></head><body>%s</body></html>",
+      absl::StrFormat(kTestAmpCanonicalLink, Location(kTestCanonicalPage)));
+
+  SetRequestHandler(kTestCanonicalPage, Canonical());
+  SetRequestHandler(kTestAmpPage, amp_body);
+  StartServer();
+
+  NavigateToURLAndWaitForRedirects(kTestAmpPage, kTestAmpPage);
+}
+
 IN_PROC_BROWSER_TEST_F(DeAmpBrowserTest, AmpPagesPointingAtEachOther) {
   TogglePref(true);
 
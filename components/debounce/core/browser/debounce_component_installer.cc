@@ -51,6 +51,7 @@ void DebounceComponentInstaller::OnDATFileDataReady(
   host_cache_.clear();
   rules_ = std::move(parsed_rules.value().first);
   host_cache_ = parsed_rules.value().second;
+  rule_index_ = DebounceRuleIndex(rules_);
   for (Observer& observer : observers_) {
     observer.OnRulesReady(this);
   }
@@ -19,6 +19,7 @@
 #include "base/values.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_observer.h"
 #include "brave/components/debounce/core/browser/debounce_rule.h"
+#include "brave/components/debounce/core/browser/debounce_rule_index.h"
 #include "brave/components/debounce/core/browser/debounce_service.h"
 
 namespace debounce {
@@ -44,6 +45,8 @@ class DebounceComponentInstaller
     return rules_;
   }
   const base::flat_set<std::string>& host_cache() const { return host_cache_; }
+  // Index over `rules()`, rebuilt whenever the rules are reloaded.
+  const DebounceRuleIndex& rule_index() const { return rule_index_; }
 
   // implementation of brave_component_updater::LocalDataFilesObserver
   void OnComponentReady(const std::string& component_id,
@@ -71,6 +74,7 @@ class DebounceComponentInstaller
   base::ObserverList<Observer> observers_;
   std::vector<std::unique_ptr<DebounceRule>> rules_;
   base::flat_set<std::string> host_cache_;
+  DebounceRuleIndex rule_index_;
   base::FilePath resource_dir_;
 
   base::WeakPtrFactory<DebounceComponentInstaller> weak_factory_{this};
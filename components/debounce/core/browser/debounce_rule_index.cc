@@ -0,0 +1,74 @@
+// Copyright (c) 2026 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "brave/components/debounce/core/browser/debounce_rule_index.h"
+
+#include <iterator>
+#include <map>
+#include <utility>
+
+#include "base/containers/flat_set.h"
+#include "brave/components/debounce/core/browser/debounce_rule.h"
+#include "extensions/common/url_pattern.h"
+
+namespace debounce {
+
+DebounceRuleIndex::DebounceRuleIndex() = default;
+
+DebounceRuleIndex::DebounceRuleIndex(
+    const std::vector<std::unique_ptr<DebounceRule>>& rules) {
+  // First collect the eTLD+1s each rule targets, so that rules matching any
+  // host can be added to every entry while keeping the configuration order.
+  std::vector<base::flat_set<std::string>> etlds_per_rule(rules.size());
+  std::vector<bool> matches_any_host(rules.size(), false);
+  std::map<std::string, std::vector<raw_ptr<const DebounceRule>>> index;
+  for (size_t i = 0; i < rules.size(); ++i) {
+    for (const URLPattern& pattern : rules[i]->include_pattern_set()) {
+      if (pattern.host().empty()) {
+        matches_any_host[i] = true;
+        continue;
+      }
+      std::string etldp1 = DebounceRule::GetETLDForDebounce(pattern.host());
+      if (!etldp1.empty()) {
+        index.try_emplace(etldp1);
+        etlds_per_rule[i].insert(std::move(etldp1));
+      }
+    }
+  }
+
+  for (size_t i = 0; i < rules.size(); ++i) {
+    if (matches_any_host[i]) {
+      for (auto& [etldp1, candidates] : index) {
+        candidates.push_back(rules[i].get());
+      }
+      continue;
+    }
+    for (const std::string& etldp1 : etlds_per_rule[i]) {
+      index[etldp1].push_back(rules[i].get());
+    }
+  }
+
+  rules_by_etld_ = base::flat_map<std::string,
+                                  std::vector<raw_ptr<const DebounceRule>>>(
+      std::make_move_iterator(index.begin()),
+      std::make_move_iterator(index.end()));
+}
+
+DebounceRuleIndex::DebounceRuleIndex(DebounceRuleIndex&&) = default;
+
+DebounceRuleIndex& DebounceRuleIndex::operator=(DebounceRuleIndex&&) = default;
+
+DebounceRuleIndex::~DebounceRuleIndex() = default;
+
+base::span<const raw_ptr<const DebounceRule>>
+DebounceRuleIndex::GetCandidateRules(std::string_view etldp1) const {
+  auto it = rules_by_etld_.find(etldp1);
+  if (it == rules_by_etld_.end()) {
+    return {};
+  }
+  return it->second;
+}
+
+}  // namespace debounce
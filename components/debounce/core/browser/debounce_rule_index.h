@@ -0,0 +1,55 @@
+// Copyright (c) 2026 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#ifndef BRAVE_COMPONENTS_DEBOUNCE_CORE_BROWSER_DEBOUNCE_RULE_INDEX_H_
+#define BRAVE_COMPONENTS_DEBOUNCE_CORE_BROWSER_DEBOUNCE_RULE_INDEX_H_
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/containers/span.h"
+#include "base/memory/raw_ptr.h"
+
+namespace debounce {
+
+class DebounceRule;
+
+// Groups debounce rules by the eTLD+1s of their include patterns, so that a
+// navigation only evaluates the rules that could possibly apply to it instead
+// of the whole rule list.
+//
+// Rules with an include pattern that matches any host are candidates for every
+// indexed eTLD+1. The index does not own the rules; it must be rebuilt whenever
+// the rules it was built from are replaced.
+class DebounceRuleIndex {
+ public:
+  DebounceRuleIndex();
+  explicit DebounceRuleIndex(
+      const std::vector<std::unique_ptr<DebounceRule>>& rules);
+  DebounceRuleIndex(const DebounceRuleIndex&) = delete;
+  DebounceRuleIndex& operator=(const DebounceRuleIndex&) = delete;
+  DebounceRuleIndex(DebounceRuleIndex&&);
+  DebounceRuleIndex& operator=(DebounceRuleIndex&&);
+  ~DebounceRuleIndex();
+
+  // Returns the rules that may apply to URLs whose eTLD+1 (as computed by
+  // `DebounceRule::GetETLDForDebounce`) is `etldp1`, in the order they appear
+  // in the configuration. Empty if no rule targets `etldp1`.
+  base::span<const raw_ptr<const DebounceRule>> GetCandidateRules(
+      std::string_view etldp1) const;
+
+  bool empty() const { return rules_by_etld_.empty(); }
+
+ private:
+  base::flat_map<std::string, std::vector<raw_ptr<const DebounceRule>>>
+      rules_by_etld_;
+};
+
+}  // namespace debounce
+
+#endif  // BRAVE_COMPONENTS_DEBOUNCE_CORE_BROWSER_DEBOUNCE_RULE_INDEX_H_
@@ -0,0 +1,155 @@
+// Copyright (c) 2026 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// You can obtain one at https://mozilla.org/MPL/2.0/.
+
+#include "brave/components/debounce/core/browser/debounce_rule_index.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "base/check.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
+#include "base/timer/elapsed_timer.h"
+#include "brave/components/debounce/core/browser/debounce_rule.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "url/gurl.h"
+
+namespace debounce {
+
+namespace {
+
+std::vector<std::unique_ptr<DebounceRule>> ParseRulesOrDie(
+    std::string_view json) {
+  auto parsed = DebounceRule::ParseRules(json);
+  CHECK(parsed.has_value()) << parsed.error();
+  return std::move(parsed.value().first);
+}
+
+// Returns a configuration of `count` redirect rules, one per synthetic site.
+std::string MakeSyntheticRules(int count) {
+  std::vector<std::string> rules;
+  rules.reserve(count);
+  for (int i = 0; i < count; ++i) {
+    rules.push_back(base::StrCat(
+        {R"({"include": ["*://*.site)", base::NumberToString(i),
+         R"(.com/*"], "exclude": [], "action": "redirect", "param": "url"})"}));
+  }
+  return base::StrCat({"[", base::JoinString(rules, ","), "]"});
+}
+
+}  // namespace
+
+TEST(DebounceRuleIndexTest, GroupsRulesByETLD) {
+  const auto rules = ParseRulesOrDie(R"([
+    {"include": ["*://a.com/*"], "exclude": [], "action": "redirect",
+     "param": "url"},
+    {"include": ["*://b.com/*"], "exclude": [], "action": "redirect",
+     "param": "url"},
+    {"include": ["*://*.a.com/*", "*://c.org/*"], "exclude": [],
+     "action": "redirect", "param": "u"}
+  ])");
+  ASSERT_EQ(rules.size(), 3u);
+  const DebounceRuleIndex index(rules);
+
+  const auto a_rules = index.GetCandidateRules("a.com");
+  ASSERT_EQ(a_rules.size(), 2u);
+  EXPECT_EQ(a_rules[0], rules[0].get());
+  EXPECT_EQ(a_rules[1], rules[2].get());
+
+  const auto b_rules = index.GetCandidateRules("b.com");
+  ASSERT_EQ(b_rules.size(), 1u);
+  EXPECT_EQ(b_rules[0], rules[1].get());
+
+  const auto c_rules = index.GetCandidateRules("c.org");
+  ASSERT_EQ(c_rules.size(), 1u);
+  EXPECT_EQ(c_rules[0], rules[2].get());
+
+  EXPECT_TRUE(index.GetCandidateRules("d.net").empty());
+  EXPECT_TRUE(index.GetCandidateRules("").empty());
+}
+
+TEST(DebounceRuleIndexTest, AnyHostRulesKeepConfigurationOrder) {
+  const auto rules = ParseRulesOrDie(R"([
+    {"include": ["*://*/*"], "exclude": [], "action": "redirect",
+     "param": "url"},
+    {"include": ["*://a.com/*"], "exclude": [], "action": "redirect",
+     "param": "url"}
+  ])");
+  ASSERT_EQ(rules.size(), 2u);
+  const DebounceRuleIndex index(rules);
+
+  const auto a_rules = index.GetCandidateRules("a.com");
+  ASSERT_EQ(a_rules.size(), 2u);
+  EXPECT_EQ(a_rules[0], rules[0].get());
+  EXPECT_EQ(a_rules[1], rules[1].get());
+
+  // Only eTLD+1s targeted by some rule are indexed, as with the host cache.
+  EXPECT_TRUE(index.GetCandidateRules("b.com").empty());
+}
+
+TEST(DebounceRuleIndexTest, IndexedLookupThroughput) {
+  constexpr int kRuleCount = 10000;
+  constexpr int kLookups = 1000;
+  const auto rules = ParseRulesOrDie(MakeSyntheticRules(kRuleCount));
+  ASSERT_EQ(rules.size(), static_cast<size_t>(kRuleCount));
+
+  base::ElapsedTimer build_timer;
+  const DebounceRuleIndex index(rules);
+  const base::TimeDelta build_time = build_timer.Elapsed();
+
+  std::vector<GURL> urls;
+  urls.reserve(kLookups);
+  for (int i = 0; i < kLookups; ++i) {
+    urls.emplace_back(base::StrCat(
+        {"https://www.site", base::NumberToString(i * (kRuleCount / kLookups)),
+         ".com/?url=https%3A%2F%2Fbrave.com%2F"}));
+  }
+
+  base::ElapsedTimer linear_timer;
+  int linear_matches = 0;
+  for (const GURL& url : urls) {
+    GURL final_url;
+    for (const auto& rule : rules) {
+      if (rule->Apply(url, &final_url, nullptr) && final_url != url) {
+        ++linear_matches;
+        break;
+      }
+    }
+  }
+  const base::TimeDelta linear_time = linear_timer.Elapsed();
+
+  base::ElapsedTimer indexed_timer;
+  int indexed_matches = 0;
+  for (const GURL& url : urls) {
+    GURL final_url;
+    for (const DebounceRule* rule : index.GetCandidateRules(
+             DebounceRule::GetETLDForDebounce(url.host()))) {
+      if (rule->Apply(url, &final_url, nullptr) && final_url != url) {
+        ++indexed_matches;
+        break;
+      }
+    }
+  }
+  const base::TimeDelta indexed_time = indexed_timer.Elapsed();
+
+  EXPECT_EQ(linear_matches, kLookups);
+  EXPECT_EQ(indexed_matches, kLookups);
+
+  perf_test::PerfResultReporter reporter("DebounceRuleIndex", "10k_rules");
+  reporter.RegisterImportantMetric(".build", "ms");
+  reporter.RegisterImportantMetric(".linear_per_lookup", "us");
+  reporter.RegisterImportantMetric(".indexed_per_lookup", "us");
+  reporter.AddResult(".build", build_time.InMillisecondsF());
+  reporter.AddResult(".linear_per_lookup",
+                     linear_time.InMicrosecondsF() / kLookups);
+  reporter.AddResult(".indexed_per_lookup",
+                     indexed_time.InMicrosecondsF() / kLookups);
+}
+
+}  // namespace debounce
@@ -5,12 +5,8 @@
 
 #include "brave/components/debounce/core/browser/debounce_service.h"
 
-#include <memory>
 #include <string>
-#include <vector>
 
-#include "base/containers/contains.h"
-#include "base/containers/flat_set.h"
 #include "brave/components/debounce/core/browser/debounce_component_installer.h"
 #include "brave/components/debounce/core/common/pref_names.h"
 #include "components/prefs/pref_registry_simple.h"
@@ -28,20 +24,11 @@ DebounceService::~DebounceService() = default;
 
 bool DebounceService::Debounce(const GURL& original_url,
                                GURL* final_url) const {
-  // Check host cache to see if this URL needs to have any debounce rules
-  // applied.
-  const base::flat_set<std::string>& host_cache =
-      component_installer_->host_cache();
+  // Only the rules indexed under this URL's eTLD+1 can apply to it.
   const std::string etldp1 =
       DebounceRule::GetETLDForDebounce(original_url.host());
-  if (!base::Contains(host_cache, etldp1)) {
-    return false;
-  }
-
-  const std::vector<std::unique_ptr<DebounceRule>>& rules =
-      component_installer_->rules();
-
-  for (const std::unique_ptr<DebounceRule>& rule : rules) {
+  for (const DebounceRule* rule :
+       component_installer_->rule_index().GetCandidateRules(etldp1)) {
     if (rule->Apply(original_url, final_url, prefs_)) {
       if (original_url != *final_url) {
         return true;
@@ -5,6 +5,7 @@
 
 #include "brave/components/ephemeral_storage/ephemeral_storage_service.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -33,6 +34,11 @@ namespace ephemeral_storage {
 
 namespace {
 
+// Areas expiring within this window of the one that triggered the timer are
+// cleaned up in the same batch. Closing a tab usually destroys many TLD
+// lifetimes at once, so their deadlines are close together.
+constexpr base::TimeDelta kCleanupBatchWindow = base::Seconds(1);
+
 GURL GetFirstPartyStorageURL(const std::string& ephemeral_domain) {
   return GURL(base::StrCat({url::kHttpsScheme, "://", ephemeral_domain}));
 }
@@ -230,19 +236,20 @@ void EphemeralStorageService::TLDEphemeralLifetimeDestroyed(
       FirstPartyStorageAreaNotInUse(ephemeral_domain, storage_partition_config,
                                     shields_disabled_on_one_of_hosts);
 
+  const PendingCleanup cleanup{
+      .cleanup_tld_ephemeral_area = cleanup_tld_ephemeral_area,
+      .cleanup_first_party_storage_area = cleanup_first_party_storage_area};
   if (base::FeatureList::IsEnabled(
           net::features::kBraveEphemeralStorageKeepAlive)) {
-    auto cleanup_timer = std::make_unique<base::OneShotTimer>();
-    cleanup_timer->Start(
-        FROM_HERE, tld_ephemeral_area_keep_alive_,
-        base::BindOnce(&EphemeralStorageService::CleanupTLDEphemeralAreaByTimer,
-                       weak_ptr_factory_.GetWeakPtr(), key,
-                       cleanup_tld_ephemeral_area,
-                       cleanup_first_party_storage_area));
-    tld_ephemeral_areas_to_cleanup_.emplace(key, std::move(cleanup_timer));
+    auto [it, inserted] =
+        tld_ephemeral_areas_to_cleanup_.try_emplace(key, cleanup);
+    if (inserted) {
+      it->second.deadline =
+          base::TimeTicks::Now() + tld_ephemeral_area_keep_alive_;
+      ScheduleTLDEphemeralAreasCleanup();
+    }
   } else {
-    CleanupTLDEphemeralArea(key, cleanup_tld_ephemeral_area,
-                            cleanup_first_party_storage_area);
+    CleanupTLDEphemeralAreas({{key, cleanup}});
   }
 }
 
@@ -319,43 +326,87 @@ bool EphemeralStorageService::FirstPartyStorageAreaNotInUse(
   return true;
 }
 
-void EphemeralStorageService::CleanupTLDEphemeralAreaByTimer(
-    const TLDEphemeralAreaKey& key,
-    bool cleanup_tld_ephemeral_area,
-    bool cleanup_first_party_storage_area) {
-  DVLOG(1) << __func__ << " " << key.first << " " << key.second;
-  tld_ephemeral_areas_to_cleanup_.erase(key);
-  CleanupTLDEphemeralArea(key, cleanup_tld_ephemeral_area,
-                          cleanup_first_party_storage_area);
+void EphemeralStorageService::ScheduleTLDEphemeralAreasCleanup() {
+  if (tld_ephemeral_areas_to_cleanup_.empty()) {
+    tld_ephemeral_areas_cleanup_timer_.Stop();
+    return;
+  }
+  base::TimeTicks earliest_deadline = base::TimeTicks::Max();
+  for (const auto& [key, cleanup] : tld_ephemeral_areas_to_cleanup_) {
+    earliest_deadline = std::min(earliest_deadline, cleanup.deadline);
+  }
+  if (tld_ephemeral_areas_cleanup_timer_.IsRunning() &&
+      tld_ephemeral_areas_cleanup_timer_.desired_run_time() <=
+          earliest_deadline) {
+    return;
+  }
+  tld_ephemeral_areas_cleanup_timer_.Start(
+      FROM_HERE, earliest_deadline - base::TimeTicks::Now(),
+      base::BindOnce(&EphemeralStorageService::CleanupTLDEphemeralAreasByTimer,
+                     weak_ptr_factory_.GetWeakPtr()));
+}
+
+void EphemeralStorageService::CleanupTLDEphemeralAreasByTimer() {
+  CleanupExpiredTLDEphemeralAreas(base::TimeTicks::Now() + kCleanupBatchWindow);
 }
 
-void EphemeralStorageService::CleanupTLDEphemeralArea(
-    const TLDEphemeralAreaKey& key,
-    bool cleanup_tld_ephemeral_area,
-    bool cleanup_first_party_storage_area) {
-  DVLOG(1) << __func__ << " " << key.first << " " << key.second;
-  if (cleanup_tld_ephemeral_area) {
-    delegate_->CleanupTLDEphemeralArea(key);
+void EphemeralStorageService::CleanupExpiredTLDEphemeralAreas(
+    base::TimeTicks cutoff) {
+  std::vector<std::pair<TLDEphemeralAreaKey, PendingCleanup>> expired;
+  for (auto it = tld_ephemeral_areas_to_cleanup_.begin();
+       it != tld_ephemeral_areas_to_cleanup_.end();) {
+    if (it->second.deadline <= cutoff) {
+      expired.emplace_back(it->first, it->second);
+      it = tld_ephemeral_areas_to_cleanup_.erase(it);
+    } else {
+      ++it;
+    }
   }
-  fpes_tokens_.erase(key.first);
-  if (cleanup_first_party_storage_area) {
-    CleanupFirstPartyStorageArea(key);
+  DVLOG(1) << __func__ << " " << expired.size();
+  ScheduleTLDEphemeralAreasCleanup();
+  if (!expired.empty()) {
+    CleanupTLDEphemeralAreas(expired);
   }
-  for (auto& observer : observer_list_) {
-    observer.OnCleanupTLDEphemeralArea(key);
+}
+
+void EphemeralStorageService::CleanupTLDEphemeralAreas(
+    const std::vector<std::pair<TLDEphemeralAreaKey, PendingCleanup>>&
+        areas) {
+  std::vector<TLDEphemeralAreaKey> tld_ephemeral_areas;
+  std::vector<TLDEphemeralAreaKey> first_party_storage_areas;
+  for (const auto& [key, cleanup] : areas) {
+    DVLOG(1) << __func__ << " " << key.first << " " << key.second;
+    if (cleanup.cleanup_tld_ephemeral_area) {
+      tld_ephemeral_areas.push_back(key);
+    }
+    if (cleanup.cleanup_first_party_storage_area) {
+      first_party_storage_areas.push_back(key);
+    }
+    fpes_tokens_.erase(key.first);
+  }
+  if (!tld_ephemeral_areas.empty()) {
+    delegate_->CleanupTLDEphemeralAreas(tld_ephemeral_areas);
+  }
+  if (!first_party_storage_areas.empty()) {
+    CleanupFirstPartyStorageAreas(first_party_storage_areas);
+  }
+  for (const auto& [key, cleanup] : areas) {
+    for (auto& observer : observer_list_) {
+      observer.OnCleanupTLDEphemeralArea(key);
+    }
   }
 }
 
-void EphemeralStorageService::CleanupFirstPartyStorageArea(
-    const TLDEphemeralAreaKey& key) {
-  DVLOG(1) << __func__ << " " << key.first << " " << key.second;
-  delegate_->CleanupFirstPartyStorageArea(key);
+void EphemeralStorageService::CleanupFirstPartyStorageAreas(
+    const std::vector<TLDEphemeralAreaKey>& keys) {
+  delegate_->CleanupFirstPartyStorageAreas(keys);
   if (!context_->IsOffTheRecord()) {
-    const base::Value value_to_cleanup = GetFirstPartyStorageValueToCleanup(
-        GetFirstPartyStorageURL(key.first), key.second);
     ScopedListPrefUpdate pref_update(prefs_,
                                      kFirstPartyStorageOriginsToCleanup);
-    pref_update->EraseValue(value_to_cleanup);
+    for (const auto& key : keys) {
+      pref_update->EraseValue(GetFirstPartyStorageValueToCleanup(
+          GetFirstPartyStorageURL(key.first), key.second));
+    }
   }
 }
 
@@ -377,42 +428,45 @@ void EphemeralStorageService::ScheduleFirstPartyStorageAreasCleanupOnStartup() {
 
 void EphemeralStorageService::CleanupFirstPartyStorageAreasOnStartup() {
   DCHECK(!context_->IsOffTheRecord());
-  ScopedListPrefUpdate pref_update(prefs_, kFirstPartyStorageOriginsToCleanup);
-  for (const auto& url_to_cleanup :
-       first_party_storage_areas_to_cleanup_on_startup_) {
-    const auto url_and_storage_partition_config =
-        GetFirstPartyStorageURLAndStoragePartitionConfig(url_to_cleanup,
-                                                         context_);
-    pref_update->EraseValue(url_to_cleanup);
-    if (!url_and_storage_partition_config) {
-      continue;
-    }
-    const auto& [url, storage_partition_config] =
-        *url_and_storage_partition_config;
-    if (!url.is_valid()) {
-      continue;
+  std::vector<TLDEphemeralAreaKey> keys;
+  {
+    ScopedListPrefUpdate pref_update(prefs_,
+                                     kFirstPartyStorageOriginsToCleanup);
+    for (const auto& url_to_cleanup :
+         first_party_storage_areas_to_cleanup_on_startup_) {
+      const auto url_and_storage_partition_config =
+          GetFirstPartyStorageURLAndStoragePartitionConfig(url_to_cleanup,
+                                                           context_);
+      pref_update->EraseValue(url_to_cleanup);
+      if (!url_and_storage_partition_config) {
+        continue;
+      }
+      const auto& [url, storage_partition_config] =
+          *url_and_storage_partition_config;
+      if (!url.is_valid()) {
+        continue;
+      }
+      keys.emplace_back(std::string(url.host()), storage_partition_config);
     }
-    delegate_->CleanupFirstPartyStorageArea(
-        {std::string(url.host()), storage_partition_config});
   }
   first_party_storage_areas_to_cleanup_on_startup_.clear();
+  if (!keys.empty()) {
+    delegate_->CleanupFirstPartyStorageAreas(keys);
+  }
 }
 
 size_t EphemeralStorageService::FireCleanupTimersForTesting() {
-  std::vector<base::OneShotTimer*> timers;
-  for (const auto& areas_to_cleanup : tld_ephemeral_areas_to_cleanup_) {
-    timers.push_back(areas_to_cleanup.second.get());
-  }
-  for (auto* timer : timers) {
-    timer->FireNow();
-  }
+  const size_t tld_ephemeral_areas_to_cleanup_count =
+      tld_ephemeral_areas_to_cleanup_.size();
+  CleanupExpiredTLDEphemeralAreas(base::TimeTicks::Max());
   const size_t first_party_storage_areas_to_cleanup_count =
       first_party_storage_areas_to_cleanup_on_startup_.size();
   if (first_party_storage_areas_startup_cleanup_timer_.IsRunning()) {
     first_party_storage_areas_startup_cleanup_timer_.FireNow();
   }
   DCHECK(first_party_storage_areas_to_cleanup_on_startup_.empty());
-  return timers.size() + first_party_storage_areas_to_cleanup_count;
+  return tld_ephemeral_areas_to_cleanup_count +
+         first_party_storage_areas_to_cleanup_count;
 }
 
 }  // namespace ephemeral_storage
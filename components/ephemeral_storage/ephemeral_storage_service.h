@@ -10,6 +10,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
@@ -100,12 +101,21 @@ class EphemeralStorageService : public KeyedService {
                              bool can_enable_1pes);
   bool IsDefaultCookieSetting(const GURL& url) const;
 
-  void CleanupTLDEphemeralAreaByTimer(const TLDEphemeralAreaKey& key,
-                                      bool cleanup_tld_ephemeral_area,
-                                      bool cleanup_first_party_storage_area);
-  void CleanupTLDEphemeralArea(const TLDEphemeralAreaKey& key,
-                               bool cleanup_tld_ephemeral_area,
-                               bool cleanup_first_party_storage_area);
+  // A TLD ephemeral area waiting for its keepalive to expire.
+  struct PendingCleanup {
+    base::TimeTicks deadline;
+    bool cleanup_tld_ephemeral_area = false;
+    bool cleanup_first_party_storage_area = false;
+  };
+
+  // Cleans up every pending area whose deadline is before `cutoff` in one
+  // batch and reschedules the timer for the rest.
+  void CleanupExpiredTLDEphemeralAreas(base::TimeTicks cutoff);
+  void ScheduleTLDEphemeralAreasCleanup();
+  void CleanupTLDEphemeralAreasByTimer();
+  void CleanupTLDEphemeralAreas(
+      const std::vector<std::pair<TLDEphemeralAreaKey, PendingCleanup>>&
+          areas);
 
   // If a website was closed, but not yet cleaned-up because of storage lifetime
   // keepalive, we store the origin into a pref to perform a cleanup on browser
@@ -113,7 +123,8 @@ class EphemeralStorageService : public KeyedService {
   // is asynchronous and cannot block the browser shutdown.
   void ScheduleFirstPartyStorageAreasCleanupOnStartup();
   void CleanupFirstPartyStorageAreasOnStartup();
-  void CleanupFirstPartyStorageArea(const TLDEphemeralAreaKey& key);
+  void CleanupFirstPartyStorageAreas(
+      const std::vector<TLDEphemeralAreaKey>& keys);
 
   size_t FireCleanupTimersForTesting();
 
@@ -128,8 +139,9 @@ class EphemeralStorageService : public KeyedService {
 
   base::TimeDelta tld_ephemeral_area_keep_alive_;
   base::TimeDelta first_party_storage_startup_cleanup_delay_;
-  std::map<TLDEphemeralAreaKey, std::unique_ptr<base::OneShotTimer>>
-      tld_ephemeral_areas_to_cleanup_;
+  std::map<TLDEphemeralAreaKey, PendingCleanup> tld_ephemeral_areas_to_cleanup_;
+  // Single timer for all pending areas, set to the earliest deadline.
+  base::OneShotTimer tld_ephemeral_areas_cleanup_timer_;
   // Contains First Party Ephemeral Storage tokens to partition storage.
   base::flat_map<std::string, base::UnguessableToken> fpes_tokens_;
   base::Value::List first_party_storage_areas_to_cleanup_on_startup_;
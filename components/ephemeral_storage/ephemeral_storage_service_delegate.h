@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_EPHEMERAL_STORAGE_EPHEMERAL_STORAGE_SERVICE_DELEGATE_H_
 #define BRAVE_COMPONENTS_EPHEMERAL_STORAGE_EPHEMERAL_STORAGE_SERVICE_DELEGATE_H_
 
+#include "base/containers/span.h"
 #include "base/functional/callback.h"
 #include "brave/components/ephemeral_storage/ephemeral_storage_types.h"
 
@@ -20,6 +21,20 @@ class EphemeralStorageServiceDelegate {
   virtual void CleanupTLDEphemeralArea(const TLDEphemeralAreaKey& key) = 0;
   // Cleanups non-ephemeral first party storage areas (cache, dom storage).
   virtual void CleanupFirstPartyStorageArea(const TLDEphemeralAreaKey& key) = 0;
+  // Batched versions of the above, used when several areas expire together.
+  // Implementations may merge the work into fewer storage removal passes.
+  virtual void CleanupTLDEphemeralAreas(
+      base::span<const TLDEphemeralAreaKey> keys) {
+    for (const auto& key : keys) {
+      CleanupTLDEphemeralArea(key);
+    }
+  }
+  virtual void CleanupFirstPartyStorageAreas(
+      base::span<const TLDEphemeralAreaKey> keys) {
+    for (const auto& key : keys) {
+      CleanupFirstPartyStorageArea(key);
+    }
+  }
   // Registers a callback to be called when the first window is opened.
   virtual void RegisterFirstWindowOpenedCallback(
       base::OnceClosure callback) = 0;
@@ -8,6 +8,8 @@
 #include <utility>
 
 #include "base/check.h"
+#include "base/check_op.h"
+#include "base/metrics/histogram_functions.h"
 #include "components/services/storage/public/mojom/local_storage_control.mojom.h"
 #include "content/public/browser/storage_partition.h"
 #include "mojo/public/cpp/bindings/pending_remote.h"
@@ -31,19 +33,14 @@ UrlStorageChecker::UrlStorageChecker(
 UrlStorageChecker::~UrlStorageChecker() = default;
 
 void UrlStorageChecker::StartCheck() {
+  DCHECK_EQ(pending_checks_, 0);
+  start_time_ = base::TimeTicks::Now();
+  pending_checks_ = 2;
+
   storage_partition_->GetCookieManagerForBrowserProcess()->GetCookieList(
       url_, net::CookieOptions::MakeAllInclusive(),
       net::CookiePartitionKeyCollection::ContainsAll(),
       base::BindOnce(&UrlStorageChecker::OnGetCookieList, this));
-}
-
-void UrlStorageChecker::OnGetCookieList(
-    const std::vector<net::CookieWithAccessResult>& included_cookies,
-    const std::vector<net::CookieWithAccessResult>& excluded_cookies) {
-  if (!included_cookies.empty()) {
-    std::move(callback_).Run(false);
-    return;
-  }
 
   storage_partition_->GetLocalStorageControl()->BindStorageArea(
       blink::StorageKey::CreateFirstParty(url::Origin::Create(url_)),
@@ -52,14 +49,34 @@ void UrlStorageChecker::OnGetCookieList(
       {}, base::BindOnce(&UrlStorageChecker::OnGetLocalStorageData, this));
 }
 
+void UrlStorageChecker::OnGetCookieList(
+    const std::vector<net::CookieWithAccessResult>& included_cookies,
+    const std::vector<net::CookieWithAccessResult>& excluded_cookies) {
+  base::UmaHistogramTimes("Brave.EphemeralStorage.UrlStorageCheck.Cookies",
+                          base::TimeTicks::Now() - start_time_);
+  OnCheckComplete(!included_cookies.empty());
+}
+
 void UrlStorageChecker::OnGetLocalStorageData(
     std::vector<blink::mojom::KeyValuePtr> local_storage_data) {
-  if (!local_storage_data.empty()) {
-    std::move(callback_).Run(false);
+  base::UmaHistogramTimes(
+      "Brave.EphemeralStorage.UrlStorageCheck.LocalStorage",
+      base::TimeTicks::Now() - start_time_);
+  OnCheckComplete(!local_storage_data.empty());
+}
+
+void UrlStorageChecker::OnCheckComplete(bool has_data) {
+  DCHECK_GT(pending_checks_, 0);
+  --pending_checks_;
+  // The first check that finds data decides the result; later replies are
+  // ignored.
+  if (!callback_ || (!has_data && pending_checks_ > 0)) {
     return;
   }
-
-  std::move(callback_).Run(true);
+  base::UmaHistogramTimes("Brave.EphemeralStorage.UrlStorageCheck.Total",
+                          base::TimeTicks::Now() - start_time_);
+  local_storage_area_.reset();
+  std::move(callback_).Run(!has_data);
 }
 
 }  // namespace ephemeral_storage
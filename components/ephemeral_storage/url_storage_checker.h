@@ -11,6 +11,7 @@
 #include "base/functional/callback.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/scoped_refptr.h"
+#include "base/time/time.h"
 #include "mojo/public/cpp/bindings/remote.h"
 #include "net/cookies/canonical_cookie.h"
 #include "third_party/blink/public/mojom/dom_storage/storage_area.mojom.h"
@@ -22,7 +23,9 @@ class StoragePartition;
 
 namespace ephemeral_storage {
 
-// Performs cookies and localStorage data existence check for a URL.
+// Performs cookies and localStorage data existence check for a URL. The
+// checks run concurrently, and the callback runs as soon as one of them finds
+// data.
 class UrlStorageChecker : public base::RefCounted<UrlStorageChecker> {
  public:
   using Callback = base::OnceCallback<void(bool is_storage_empty)>;
@@ -44,9 +47,13 @@ class UrlStorageChecker : public base::RefCounted<UrlStorageChecker> {
   void OnGetLocalStorageData(
       std::vector<blink::mojom::KeyValuePtr> local_storage_data);
 
+  void OnCheckComplete(bool has_data);
+
   const raw_ref<content::StoragePartition> storage_partition_;
   GURL url_;
   Callback callback_;
+  int pending_checks_ = 0;
+  base::TimeTicks start_time_;
 
   mojo::Remote<blink::mojom::StorageArea> local_storage_area_;
 };
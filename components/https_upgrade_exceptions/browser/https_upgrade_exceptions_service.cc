@@ -6,16 +6,14 @@
 #include "brave/components/https_upgrade_exceptions/browser/https_upgrade_exceptions_service.h"
 
 #include <memory>
-#include <set>
 #include <string>
 #include <utility>
-#include <vector>
 
 #include "base/feature_list.h"
 #include "base/files/file_path.h"
-#include "base/strings/string_split.h"
 #include "base/task/thread_pool.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
+#include "brave/components/brave_component_updater/browser/host_set.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_observer.h"
 #include "net/base/features.h"
 #include "url/gurl.h"
@@ -25,9 +23,19 @@
 
 namespace https_upgrade_exceptions {
 
+using brave_component_updater::HostSet;
 using brave_component_updater::LocalDataFilesObserver;
 using brave_component_updater::LocalDataFilesService;
 
+namespace {
+
+HostSet ReadHTTPSUpgradeExceptions(const base::FilePath& txt_file_path) {
+  return HostSet::FromLines(
+      brave_component_updater::GetDATFileAsString(txt_file_path));
+}
+
+}  // namespace
+
 HttpsUpgradeExceptionsService::HttpsUpgradeExceptionsService(
     LocalDataFilesService* local_data_files_service)
     : LocalDataFilesObserver(local_data_files_service) {}
@@ -39,25 +47,20 @@ void HttpsUpgradeExceptionsService::LoadHTTPSUpgradeExceptions(
           .AppendASCII(HTTPS_UPGRADE_EXCEPTIONS_TXT_FILE);
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::GetDATFileAsString,
-                     txt_file_path),
-      base::BindOnce(&HttpsUpgradeExceptionsService::OnDATFileDataReady,
-                     weak_factory_.GetWeakPtr()));
+      base::BindOnce(&ReadHTTPSUpgradeExceptions, txt_file_path),
+      base::BindOnce(
+          &HttpsUpgradeExceptionsService::OnHTTPSUpgradeExceptionsLoaded,
+          weak_factory_.GetWeakPtr()));
 }
 
-void HttpsUpgradeExceptionsService::OnDATFileDataReady(
-    const std::string& contents) {
-  if (contents.empty()) {
+void HttpsUpgradeExceptionsService::OnHTTPSUpgradeExceptionsLoaded(
+    HostSet exceptional_domains) {
+  if (exceptional_domains.empty()) {
     // We don't have the file yet.
     return;
   }
-  std::vector<std::string> lines = base::SplitString(
-      contents, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
-  for (auto&& line : lines) {
-    exceptional_domains_.insert(std::move(line));
-  }
+  exceptional_domains_ = std::move(exceptional_domains);
   is_ready_ = true;
-  return;
 }
 
 bool HttpsUpgradeExceptionsService::CanUpgradeToHTTPS(const GURL& url) {
@@ -75,7 +78,7 @@ bool HttpsUpgradeExceptionsService::CanUpgradeToHTTPS(const GURL& url) {
     return false;
   }
   // Allow upgrade only if the domain is not on the exceptions list.
-  return !exceptional_domains_.contains(url.host());
+  return !exceptional_domains_.Contains(url.host());
 }
 
 // implementation of LocalDataFilesObserver
@@ -86,9 +89,7 @@ void HttpsUpgradeExceptionsService::OnComponentReady(
   LoadHTTPSUpgradeExceptions(install_dir);
 }
 
-HttpsUpgradeExceptionsService::~HttpsUpgradeExceptionsService() {
-  exceptional_domains_.clear();
-}
+HttpsUpgradeExceptionsService::~HttpsUpgradeExceptionsService() = default;
 
 std::unique_ptr<HttpsUpgradeExceptionsService>
 HttpsUpgradeExceptionsServiceFactory(
@@ -7,10 +7,11 @@
 #define BRAVE_COMPONENTS_HTTPS_UPGRADE_EXCEPTIONS_BROWSER_HTTPS_UPGRADE_EXCEPTIONS_SERVICE_H_
 
 #include <memory>
-#include <set>
 #include <string>
 
 #include "base/files/file_path.h"
+#include "base/memory/weak_ptr.h"
+#include "brave/components/brave_component_updater/browser/host_set.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_observer.h"
 #include "brave/components/brave_component_updater/browser/local_data_files_service.h"
 #include "url/gurl.h"
@@ -31,11 +32,13 @@ class HttpsUpgradeExceptionsService
   bool CanUpgradeToHTTPS(const GURL& url);
   ~HttpsUpgradeExceptionsService() override;
   void SetIsReadyForTesting() { is_ready_ = true; }
-  void OnDATFileDataReady(const std::string& contents);
 
  private:
   void LoadHTTPSUpgradeExceptions(const base::FilePath& install_dir);
-  std::set<std::string, std::less<>> exceptional_domains_;
+  void OnHTTPSUpgradeExceptionsLoaded(
+      brave_component_updater::HostSet exceptional_domains);
+
+  brave_component_updater::HostSet exceptional_domains_;
   bool is_ready_ = false;
   base::WeakPtrFactory<HttpsUpgradeExceptionsService> weak_factory_{this};
 };
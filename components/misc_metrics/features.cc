@@ -0,0 +1,15 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/misc_metrics/features.h"
+
+#include "base/feature_list.h"
+
+namespace misc_metrics::features {
+
+BASE_FEATURE(kDomainsLoadedSketch, base::FEATURE_DISABLED_BY_DEFAULT);
+BASE_FEATURE(kUsageDrivenUptimeSampling, base::FEATURE_DISABLED_BY_DEFAULT);
+
+}  // namespace misc_metrics::features
@@ -0,0 +1,24 @@
+/* Copyright (c) 2026 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_MISC_METRICS_FEATURES_H_
+#define BRAVE_COMPONENTS_MISC_METRICS_FEATURES_H_
+
+#include "base/feature_list.h"
+
+namespace misc_metrics::features {
+
+// Derives the domains loaded metric from a per-day sketch of distinct
+// eTLD+1s kept in local state, instead of querying history.
+BASE_DECLARE_FEATURE(kDomainsLoadedSketch);
+
+// Samples browser uptime only while the browser is in use, flushing the
+// session delta when usage ends, instead of polling the usage clock every
+// minute while idle.
+BASE_DECLARE_FEATURE(kUsageDrivenUptimeSampling);
+
+}  // namespace misc_metrics::features
+
+#endif  // BRAVE_COMPONENTS_MISC_METRICS_FEATURES_H_
@@ -5,15 +5,26 @@
 
 #include "brave/components/misc_metrics/page_metrics.h"
 
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <string>
 #include <utility>
+#include <vector>
 
+#include "base/base64.h"
 #include "base/check.h"
+#include "base/feature_list.h"
 #include "base/functional/bind.h"
+#include "base/hash/hash.h"
+#include "base/json/values_util.h"
 #include "base/logging.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/time/time.h"
+#include "base/values.h"
 #include "brave/components/brave_rewards/core/pref_names.h"
 #include "brave/components/brave_shields/core/browser/brave_shields_utils.h"
+#include "brave/components/misc_metrics/features.h"
 #include "brave/components/misc_metrics/pref_names.h"
 #include "brave/components/p3a_utils/bucket.h"
 #include "brave/components/time_period_storage/weekly_storage.h"
@@ -24,7 +35,10 @@
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
 #include "components/security_interstitials/core/https_only_mode_metrics.h"
+#include "components/prefs/scoped_user_pref_update.h"
 #include "components/security_interstitials/core/metrics_helper.h"
+#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
+#include "url/gurl.h"
 
 namespace misc_metrics {
 
@@ -50,6 +64,49 @@ constexpr char kInterstitialDecisionHistogramName[] =
 
 constexpr size_t kMinDenominatorForFailedHTTPReport = 100;
 
+// HyperLogLog sketch parameters for the domains loaded metric. 2^8 one-byte
+// registers give a ~6.5% standard error, which is well within the
+// precision of kDomainsLoadedBuckets.
+constexpr int kDomainsSketchPrecision = 8;
+constexpr size_t kDomainsSketchRegisterCount = 1u << kDomainsSketchPrecision;
+constexpr int kDomainsSketchDays = 7;
+
+constexpr char kDomainsSketchDayKey[] = "day";
+constexpr char kDomainsSketchRegistersKey[] = "registers";
+
+std::vector<uint8_t> DecodeSketchRegisters(const base::Value::Dict& entry) {
+  std::vector<uint8_t> registers;
+  const std::string* encoded = entry.FindString(kDomainsSketchRegistersKey);
+  if (!encoded) {
+    return registers;
+  }
+  auto decoded = base::Base64Decode(*encoded);
+  if (decoded && decoded->size() == kDomainsSketchRegisterCount) {
+    registers = std::move(*decoded);
+  }
+  return registers;
+}
+
+// Standard HyperLogLog estimate with linear counting for small
+// cardinalities, which covers most of the reported range.
+double EstimateSketchCardinality(const std::vector<uint8_t>& registers) {
+  constexpr double kRegisterCount = kDomainsSketchRegisterCount;
+  double sum = 0;
+  size_t zero_registers = 0;
+  for (uint8_t value : registers) {
+    sum += std::ldexp(1.0, -value);
+    if (value == 0) {
+      zero_registers++;
+    }
+  }
+  const double alpha = 0.7213 / (1 + 1.079 / kRegisterCount);
+  double estimate = alpha * kRegisterCount * kRegisterCount / sum;
+  if (estimate <= 2.5 * kRegisterCount && zero_registers > 0) {
+    estimate = kRegisterCount * std::log(kRegisterCount / zero_registers);
+  }
+  return estimate;
+}
+
 }  // namespace
 
 using HttpsEvent = security_interstitials::https_only_mode::Event;
@@ -145,12 +202,13 @@ void PageMetrics::OnInterstitialDecisionEvent(
 void PageMetrics::RegisterPrefs(PrefRegistrySimple* registry) {
   registry->RegisterListPref(kMiscMetricsPagesLoadedCount);
   registry->RegisterListPref(kMiscMetricsPagesReloadedCount);
+  registry->RegisterListPref(kMiscMetricsDomainsLoadedSketch);
   registry->RegisterListPref(kMiscMetricsInterstitialAllowDecisionCount);
   registry->RegisterListPref(kMiscMetricsFailedHTTPSUpgradeCount);
   registry->RegisterTimePref(kMiscMetricsFailedHTTPSUpgradeMetricAddedTime, {});
 }
 
-void PageMetrics::IncrementPagesLoadedCount(bool is_reload) {
+void PageMetrics::IncrementPagesLoadedCount(const GURL& url, bool is_reload) {
   VLOG(2) << "PageMetricsService: increment page load count, is_reload "
           << is_reload;
   InitStorage();
@@ -165,7 +223,89 @@ void PageMetrics::IncrementPagesLoadedCount(bool is_reload) {
       ReportFirstPageLoadTime();
     }
     pages_loaded_storage_->AddDelta(1);
+    if (base::FeatureList::IsEnabled(features::kDomainsLoadedSketch)) {
+      RecordDomainLoaded(url);
+    }
+  }
+}
+
+void PageMetrics::RecordDomainLoaded(const GURL& url) {
+  std::string domain = net::registry_controlled_domains::GetDomainAndRegistry(
+      url, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+  if (domain.empty()) {
+    // IP addresses and hosts without a registry count as their own domain.
+    domain = url.host();
+  }
+  if (domain.empty()) {
+    return;
+  }
+
+  base::Time today = base::Time::Now().LocalMidnight();
+  if (domains_sketch_day_ != today) {
+    domains_sketch_day_ = today;
+    domains_sketch_today_.clear();
+    for (const auto& entry :
+         local_state_->GetList(kMiscMetricsDomainsLoadedSketch)) {
+      if (!entry.is_dict()) {
+        continue;
+      }
+      if (base::ValueToTime(entry.GetDict().Find(kDomainsSketchDayKey)) ==
+          today) {
+        domains_sketch_today_ = DecodeSketchRegisters(entry.GetDict());
+        break;
+      }
+    }
+    if (domains_sketch_today_.empty()) {
+      domains_sketch_today_.resize(kDomainsSketchRegisterCount);
+    }
+  }
+
+  uint32_t hash = base::PersistentHash(domain);
+  size_t index = hash >> (32 - kDomainsSketchPrecision);
+  uint32_t remaining = hash << kDomainsSketchPrecision;
+  uint8_t rank = std::min(std::countl_zero(remaining),
+                          32 - kDomainsSketchPrecision) +
+                 1;
+  if (domains_sketch_today_[index] >= rank) {
+    return;
+  }
+  domains_sketch_today_[index] = rank;
+
+  ScopedListPrefUpdate update(local_state_, kMiscMetricsDomainsLoadedSketch);
+  base::Time oldest_day = today - base::Days(kDomainsSketchDays - 1);
+  update->EraseIf([&](const base::Value& entry) {
+    if (!entry.is_dict()) {
+      return true;
+    }
+    auto day = base::ValueToTime(entry.GetDict().Find(kDomainsSketchDayKey));
+    return !day || *day == today || *day < oldest_day;
+  });
+  update->Append(
+      base::Value::Dict()
+          .Set(kDomainsSketchDayKey, base::TimeToValue(today))
+          .Set(kDomainsSketchRegistersKey,
+               base::Base64Encode(domains_sketch_today_)));
+}
+
+int PageMetrics::EstimateWeeklyDomainsLoaded() {
+  std::vector<uint8_t> merged(kDomainsSketchRegisterCount);
+  base::Time oldest_day =
+      base::Time::Now().LocalMidnight() - base::Days(kDomainsSketchDays - 1);
+  for (const auto& entry :
+       local_state_->GetList(kMiscMetricsDomainsLoadedSketch)) {
+    if (!entry.is_dict()) {
+      continue;
+    }
+    auto day = base::ValueToTime(entry.GetDict().Find(kDomainsSketchDayKey));
+    if (!day || *day < oldest_day) {
+      continue;
+    }
+    std::vector<uint8_t> registers = DecodeSketchRegisters(entry.GetDict());
+    for (size_t i = 0; i < registers.size(); i++) {
+      merged[i] = std::max(merged[i], registers[i]);
+    }
   }
+  return static_cast<int>(std::lround(EstimateSketchCardinality(merged)));
 }
 
 void PageMetrics::InitStorage() {
@@ -199,6 +339,15 @@ void PageMetrics::ReportAllMetrics() {
 }
 
 void PageMetrics::ReportDomainsLoaded() {
+  if (base::FeatureList::IsEnabled(features::kDomainsLoadedSketch)) {
+    // Derived from the sketch kept by IncrementPagesLoadedCount, which
+    // avoids a 7-day history scan on every report.
+    int count = EstimateWeeklyDomainsLoaded();
+    p3a_utils::RecordToHistogramBucket(kDomainsLoadedHistogramName,
+                                       kDomainsLoadedBuckets, count);
+    VLOG(2) << "PageMetrics: domains loaded sketch report, count = " << count;
+    return;
+  }
   // Derived from current profile history.
   // Mutiple profiles will result in metric overwrites which is okay.
   history_service_->GetDomainDiversity(
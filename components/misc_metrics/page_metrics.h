@@ -9,17 +9,20 @@
 #include <memory>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "base/functional/callback_forward.h"
 #include "base/metrics/histogram_base.h"
 #include "base/metrics/statistics_recorder.h"
 #include "base/task/cancelable_task_tracker.h"
+#include "base/time/time.h"
 #include "base/timer/timer.h"
 #include "base/timer/wall_clock_timer.h"
 #include "components/browsing_data/core/counters/browsing_data_counter.h"
 #include "components/history/core/browser/history_types.h"
 #include "components/prefs/pref_change_registrar.h"
 
+class GURL;
 class HostContentSettingsMap;
 class PrefRegistrySimple;
 class PrefService;
@@ -74,7 +77,7 @@ class PageMetrics {
 
   static void RegisterPrefs(PrefRegistrySimple* registry);
 
-  void IncrementPagesLoadedCount(bool is_reload);
+  void IncrementPagesLoadedCount(const GURL& url, bool is_reload);
 
   void OnBraveQuery();
 
@@ -89,6 +92,12 @@ class PageMetrics {
 
   void ReportFirstPageLoadTime();
 
+  // Adds the eTLD+1 of |url| to today's distinct domain sketch.
+  void RecordDomainLoaded(const GURL& url);
+  // Returns the estimated number of distinct domains loaded over the
+  // last 7 days, merged from the per-day sketches.
+  int EstimateWeeklyDomainsLoaded();
+
   void OnHttpsNavigationEvent(std::string_view histogram_name,
                               uint64_t name_hash,
                               base::HistogramBase::Sample32 sample);
@@ -108,6 +117,11 @@ class PageMetrics {
   std::unique_ptr<WeeklyStorage> interstitial_allow_decisions_storage_;
   std::unique_ptr<WeeklyStorage> failed_https_upgrades_storage_;
 
+  // In-memory copy of today's sketch registers, so that page loads only
+  // touch prefs when a register actually grows.
+  std::vector<uint8_t> domains_sketch_today_;
+  base::Time domains_sketch_day_;
+
   base::CancelableTaskTracker history_service_task_tracker_;
 
   base::WallClockTimer periodic_report_timer_;
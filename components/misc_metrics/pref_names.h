@@ -19,6 +19,8 @@ inline constexpr char kMiscMetricsPagesLoadedCount[] =
     "brave.core_metrics.pages_loaded";
 inline constexpr char kMiscMetricsPagesReloadedCount[] =
     "brave.core_metrics.pages_reloaded";
+inline constexpr char kMiscMetricsDomainsLoadedSketch[] =
+    "brave.core_metrics.domains_loaded_sketch";
 inline constexpr char kMiscMetricsInterstitialAllowDecisionCount[] =
     "brave.misc_metrics.interstitial_allow_decisions";
 inline constexpr char kMiscMetricsFailedHTTPSUpgradeCount[] =
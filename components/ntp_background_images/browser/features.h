@@ -36,6 +36,18 @@ inline constexpr base::FeatureParam<base::TimeDelta>
                                      "sponsored_images_update_check_after",
                                      base::Minutes(15)};
 
+// The maximum number of sponsored image files kept in memory after they have
+// been read from disk, so that creatives shown on consecutive new tabs are not
+// re-read. Zero disables the cache.
+inline constexpr base::FeatureParam<int> kSponsoredImageCacheSize{
+    &kBraveNTPBrandedWallpaper, "sponsored_image_cache_size", 0};
+
+// If enabled, the background wallpaper for the next new tab is built right
+// after a new tab page view is registered, so the next new tab page does not
+// have to build it while opening.
+inline constexpr base::FeatureParam<bool> kPrepareNextWallpaper{
+    &kBraveNTPBrandedWallpaper, "prepare_next_wallpaper", false};
+
 }  // namespace ntp_background_images::features
 
 #endif  // BRAVE_COMPONENTS_NTP_BACKGROUND_IMAGES_BROWSER_FEATURES_H_
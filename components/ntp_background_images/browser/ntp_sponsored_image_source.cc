@@ -5,12 +5,14 @@
 
 #include "brave/components/ntp_background_images/browser/ntp_sponsored_image_source.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "base/files/file_path.h"
 #include "base/functional/bind.h"
 #include "base/memory/ref_counted_memory.h"
 #include "base/task/thread_pool.h"
+#include "brave/components/ntp_background_images/browser/features.h"
 #include "brave/components/ntp_background_images/browser/ntp_background_images_service.h"
 #include "brave/components/ntp_background_images/browser/ntp_sponsored_images_data.h"
 #include "brave/components/ntp_background_images/browser/ntp_sponsored_source_util.h"
@@ -23,7 +25,8 @@ namespace ntp_background_images {
 
 NTPSponsoredImageSource::NTPSponsoredImageSource(
     NTPBackgroundImagesService* background_images_service)
-    : background_images_service_(background_images_service) {}
+    : background_images_service_(background_images_service),
+      file_cache_(std::max(features::kSponsoredImageCacheSize.Get(), 1)) {}
 
 NTPSponsoredImageSource::~NTPSponsoredImageSource() = default;
 
@@ -74,23 +77,37 @@ bool NTPSponsoredImageSource::AllowCaching() {
 }
 
 void NTPSponsoredImageSource::ReadFileCallback(
+    const base::FilePath& file_path,
     GotDataCallback callback,
     std::optional<std::string> input) {
   if (!input) {
     return std::move(callback).Run(scoped_refptr<base::RefCountedMemory>());
   }
 
-  std::move(callback).Run(
-      new base::RefCountedBytes(base::as_byte_span(*input)));
+  scoped_refptr<base::RefCountedMemory> bytes =
+      base::MakeRefCounted<base::RefCountedBytes>(base::as_byte_span(*input));
+  if (features::kSponsoredImageCacheSize.Get() > 0) {
+    file_cache_.Put(file_path, bytes);
+  }
+
+  std::move(callback).Run(std::move(bytes));
 }
 
 void NTPSponsoredImageSource::AllowAccess(const base::FilePath& file_path,
                                           GotDataCallback callback) {
+  if (features::kSponsoredImageCacheSize.Get() > 0) {
+    const auto iter = file_cache_.Get(file_path);
+    if (iter != file_cache_.end()) {
+      return std::move(callback).Run(iter->second);
+    }
+  }
+
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
       base::BindOnce(&ReadFileToString, file_path),
       base::BindOnce(&NTPSponsoredImageSource::ReadFileCallback,
-                     weak_factory_.GetWeakPtr(), std::move(callback)));
+                     weak_factory_.GetWeakPtr(), file_path,
+                     std::move(callback)));
 }
 
 void NTPSponsoredImageSource::DenyAccess(GotDataCallback callback) {
@@ -9,16 +9,16 @@
 #include <optional>
 #include <string>
 
+#include "base/containers/lru_cache.h"
+#include "base/files/file_path.h"
 #include "base/memory/raw_ptr.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
 #include "content/public/browser/url_data_source.h"
 
 class GURL;
 
-namespace base {
-class FilePath;
-}  // namespace base
-
 namespace ntp_background_images {
 
 class NTPBackgroundImagesService;
@@ -45,7 +45,8 @@ class NTPSponsoredImageSource final : public content::URLDataSource {
   bool AllowCaching() override;
 
  private:
-  void ReadFileCallback(GotDataCallback callback,
+  void ReadFileCallback(const base::FilePath& file_path,
+                        GotDataCallback callback,
                         std::optional<std::string> input);
 
   void AllowAccess(const base::FilePath& file_path, GotDataCallback callback);
@@ -54,6 +55,11 @@ class NTPSponsoredImageSource final : public content::URLDataSource {
   const raw_ptr<NTPBackgroundImagesService>
       background_images_service_;  // Not owned.
 
+  // Recently served files, keyed by their absolute path. Only used if
+  // `features::kSponsoredImageCacheSize` is greater than zero.
+  base::LRUCache<base::FilePath, scoped_refptr<base::RefCountedMemory>>
+      file_cache_;
+
   base::WeakPtrFactory<NTPSponsoredImageSource> weak_factory_{this};
 };
 
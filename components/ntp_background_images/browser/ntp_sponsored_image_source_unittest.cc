@@ -16,6 +16,8 @@
 #include "base/memory/ref_counted_memory.h"
 #include "base/run_loop.h"
 #include "base/strings/string_view_util.h"
+#include "base/test/scoped_feature_list.h"
+#include "brave/components/ntp_background_images/browser/features.h"
 #include "brave/components/ntp_background_images/browser/ntp_background_images_service.h"
 #include "brave/components/ntp_background_images/browser/ntp_background_images_service_waiter.h"
 #include "brave/components/ntp_background_images/browser/ntp_sponsored_source_test_util.h"
@@ -141,4 +143,26 @@ TEST_F(NTPSponsoredImageSourceTest, AllowCaching) {
   EXPECT_FALSE(url_data_source()->AllowCaching());
 }
 
+class NTPSponsoredImageSourceFileCacheTest
+    : public NTPSponsoredImageSourceTest {
+ public:
+  NTPSponsoredImageSourceFileCacheTest() {
+    scoped_feature_list_.InitAndEnableFeatureWithParameters(
+        features::kBraveNTPBrandedWallpaper,
+        {{"sponsored_image_cache_size", "1"}});
+  }
+
+ private:
+  base::test::ScopedFeatureList scoped_feature_list_;
+};
+
+TEST_F(NTPSponsoredImageSourceFileCacheTest, StartDataRequestFromCache) {
+  const GURL url(
+      R"(chrome://branded-wallpaper/aa0b561e-9eed-4aaa-8999-5627bc6b14fd/background.jpg)");
+  const std::string data = StartDataRequest(url);
+  ASSERT_THAT(data, ::testing::Not(::testing::IsEmpty()));
+
+  EXPECT_EQ(data, StartDataRequest(url));
+}
+
 }  // namespace ntp_background_images
@@ -113,18 +113,21 @@ void ViewCounterModel::RegisterPageViewForBackgroundImages() {
   RotateBackgroundWallpaperImageIndex();
 }
 
-void ViewCounterModel::RotateBackgroundWallpaperImageIndex() {
+int ViewCounterModel::GetNextWallpaperImageIndex() const {
   // NTP BI component is not ready.
   if (total_image_count_ == 0) {
-    return;
+    return current_wallpaper_image_index_;
   }
 
   if (!show_wallpaper_) {
-    return;
+    return current_wallpaper_image_index_;
   }
 
-  current_wallpaper_image_index_++;
-  current_wallpaper_image_index_ %= total_image_count_;
+  return (current_wallpaper_image_index_ + 1) % total_image_count_;
+}
+
+void ViewCounterModel::RotateBackgroundWallpaperImageIndex() {
+  current_wallpaper_image_index_ = GetNextWallpaperImageIndex();
 }
 
 void ViewCounterModel::NextBrandedImage() {
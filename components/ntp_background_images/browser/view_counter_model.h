@@ -36,6 +36,9 @@ class ViewCounterModel {
     return current_wallpaper_image_index_;
   }
 
+  // Returns the index `RotateBackgroundWallpaperImageIndex()` would move to.
+  int GetNextWallpaperImageIndex() const;
+
   void set_total_image_count(int count) { total_image_count_ = count; }
 
   void set_show_branded_wallpaper(bool show) { show_branded_wallpaper_ = show; }
@@ -8,6 +8,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/check.h"
@@ -15,12 +16,15 @@
 #include "base/debug/crash_logging.h"
 #include "base/debug/dump_without_crashing.h"
 #include "base/functional/bind.h"
+#include "base/location.h"
 #include "base/logging.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/task/sequenced_task_runner.h"
 #include "brave/components/brave_ads/core/browser/service/ads_service.h"
 #include "brave/components/brave_ads/core/mojom/brave_ads.mojom.h"
 #include "brave/components/brave_rewards/core/pref_names.h"
 #include "brave/components/ntp_background_images/browser/brave_ntp_custom_background_service.h"
+#include "brave/components/ntp_background_images/browser/features.h"
 #include "brave/components/ntp_background_images/browser/ntp_background_images_data.h"
 #include "brave/components/ntp_background_images/browser/ntp_p3a_util.h"
 #include "brave/components/ntp_background_images/browser/ntp_sponsored_images_data.h"
@@ -160,11 +164,22 @@ NTPSponsoredImagesData* ViewCounterService::GetSponsoredImagesData() const {
 std::optional<base::Value::Dict>
 ViewCounterService::GetNextWallpaperForDisplay() {
   model_.RotateBackgroundWallpaperImageIndex();
+
+  std::optional<base::Value::Dict> next_wallpaper =
+      std::exchange(next_wallpaper_, std::nullopt);
+  if (next_wallpaper &&
+      next_wallpaper_image_index_ == model_.current_wallpaper_image_index() &&
+      CanShowBackgroundImages() && !ShouldShowCustomBackgroundImages()) {
+    return next_wallpaper;
+  }
+
   return GetCurrentWallpaper();
 }
 
 std::optional<base::Value::Dict>
 ViewCounterService::GetCurrentWallpaperForDisplay(bool allow_sponsored_image) {
+  SCOPED_UMA_HISTOGRAM_TIMER_MICROS("Brave.NTP.GetWallpaperForDisplayTime");
+
   if (allow_sponsored_image && ShouldShowSponsoredImages()) {
     if (std::optional<base::Value::Dict> dict = GetCurrentBrandedWallpaper()) {
       return dict;
@@ -297,6 +312,7 @@ void ViewCounterService::ParseAndSaveNewTabPageAdsCallback(bool success) {
 
 void ViewCounterService::ResetModel() {
   model_.Reset();
+  next_wallpaper_.reset();
 
   model_.set_show_branded_wallpaper(IsSponsoredImagesWallpaperOptedIn());
   model_.set_show_wallpaper(IsShowBackgroundImageOptedIn());
@@ -344,6 +360,7 @@ void ViewCounterService::RegisterPageView() {
   background_images_service_->MaybeCheckForSponsoredComponentUpdate();
   model_.RegisterPageView();
   MaybePrefetchNewTabPageAd();
+  MaybePrepareNextWallpaper();
 }
 
 bool ViewCounterService::ShouldShowSponsoredImages() const {
@@ -405,6 +422,40 @@ void ViewCounterService::MaybePrefetchNewTabPageAd() {
   ads_service_->PrefetchNewTabPageAd();
 }
 
+void ViewCounterService::MaybePrepareNextWallpaper() {
+  if (!features::kPrepareNextWallpaper.Get()) {
+    return;
+  }
+
+  // Prepare the wallpaper after the current new tab page has been handed its
+  // data, rather than while it is still waiting for it.
+  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+      FROM_HERE, base::BindOnce(&ViewCounterService::PrepareNextWallpaper,
+                                weak_ptr_factory_.GetWeakPtr()));
+}
+
+void ViewCounterService::PrepareNextWallpaper() {
+  next_wallpaper_.reset();
+
+  // Custom backgrounds can change without the model being reset, so they are
+  // always built on demand.
+  if (!CanShowBackgroundImages() || ShouldShowCustomBackgroundImages()) {
+    return;
+  }
+
+  const NTPBackgroundImagesData* const images_data =
+      background_images_service_->GetBackgroundImagesData();
+  if (!images_data) {
+    return;
+  }
+
+  next_wallpaper_image_index_ = model_.GetNextWallpaperImageIndex();
+  base::Value::Dict background =
+      images_data->GetBackgroundAt(next_wallpaper_image_index_);
+  background.Set(kWallpaperRandomKey, true);
+  next_wallpaper_ = std::move(background);
+}
+
 void ViewCounterService::MaybeTriggerNewTabPageAdEvent(
     const std::string& placement_id,
     const std::string& creative_instance_id,
@@ -163,6 +163,11 @@ class ViewCounterService : public KeyedService,
 
   void MaybePrefetchNewTabPageAd();
 
+  // Posts a task to build the background wallpaper the next new tab page will
+  // show, if `features::kPrepareNextWallpaper` is enabled.
+  void MaybePrepareNextWallpaper();
+  void PrepareNextWallpaper();
+
   void MaybeTriggerNewTabPageAdEvent(
       const std::string& placement_id,
       const std::string& creative_instance_id,
@@ -179,6 +184,12 @@ class ViewCounterService : public KeyedService,
   bool is_supported_locale_ = false;
   PrefChangeRegistrar pref_change_registrar_;
   ViewCounterModel model_;
+
+  // Background wallpaper prepared by `PrepareNextWallpaper()` and the model's
+  // wallpaper image index it was built for.
+  std::optional<base::Value::Dict> next_wallpaper_;
+  int next_wallpaper_image_index_ = 0;
+
   base::WallClockTimer p3a_update_timer_;
 
   // Can be null if custom background is not supported.
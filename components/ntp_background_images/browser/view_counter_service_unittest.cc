@@ -13,6 +13,7 @@
 #include "base/files/file_path.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/scoped_refptr.h"
+#include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
 #include "base/test/values_test_util.h"
 #include "brave/components/brave_ads/core/browser/service/ads_service_mock.h"
@@ -581,4 +582,56 @@ TEST_F(ViewCounterServiceTest,
   VerifyDoNotGetNewTabTakeoverWallpaperExpectation();
 }
 
+class ViewCounterServicePrepareNextWallpaperTest
+    : public ViewCounterServiceTest {
+ public:
+  ViewCounterServicePrepareNextWallpaperTest() {
+    scoped_feature_list_.InitAndEnableFeatureWithParameters(
+        features::kBraveNTPBrandedWallpaper,
+        {{"prepare_next_wallpaper", "true"}});
+  }
+
+ private:
+  base::test::ScopedFeatureList scoped_feature_list_;
+};
+
+TEST_F(ViewCounterServicePrepareNextWallpaperTest,
+       GetPreparedNextWallpaperForDisplay) {
+  SetBackgroundImagesVisibility(true);
+  MockBackgroundImagesData();
+  ASSERT_TRUE(view_counter_service_->CanShowBackgroundImages());
+
+  view_counter_service_->RegisterPageView();
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(base::test::ParseJsonDict(R"JSON(
+      {
+        "author": "Brave",
+        "isBackground": true,
+        "link": "https://brave.com/",
+        "random": true,
+        "type": "brave",
+        "wallpaperImagePath": "wallpaper1.jpg",
+        "wallpaperImageUrl": "chrome://background-wallpaper/wallpaper1.jpg"
+      })JSON"),
+            view_counter_service_->GetNextWallpaperForDisplay());
+}
+
+TEST_F(ViewCounterServicePrepareNextWallpaperTest,
+       DoNotGetPreparedNextWallpaperIfOptedOut) {
+  SetBackgroundImagesVisibility(true);
+  MockBackgroundImagesData();
+  ASSERT_TRUE(view_counter_service_->CanShowBackgroundImages());
+
+  view_counter_service_->RegisterPageView();
+  task_environment_.RunUntilIdle();
+
+  SetBackgroundImagesVisibility(false);
+#if BUILDFLAG(IS_ANDROID)
+  EXPECT_TRUE(view_counter_service_->GetNextWallpaperForDisplay());
+#else
+  EXPECT_FALSE(view_counter_service_->GetNextWallpaperForDisplay());
+#endif  // BUILDFLAG(IS_ANDROID)
+}
+
 }  // namespace ntp_background_images
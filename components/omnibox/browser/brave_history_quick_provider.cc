@@ -5,6 +5,8 @@
 
 #include "brave/components/omnibox/browser/brave_history_quick_provider.h"
 
+#include "base/metrics/histogram_functions.h"
+#include "base/timer/elapsed_timer.h"
 #include "brave/components/omnibox/browser/brave_omnibox_prefs.h"
 #include "components/omnibox/browser/actions/omnibox_action.h"
 #include "components/omnibox/browser/autocomplete_provider.h"
@@ -19,5 +21,11 @@ void BraveHistoryQuickProvider::Start(const AutocompleteInput& input,
     matches_.clear();
     return;
   }
+
+  // The in-memory index is queried synchronously, so this is the time the
+  // provider adds to the keystroke.
+  const base::ElapsedTimer timer;
   HistoryQuickProvider::Start(input, minimal_changes);
+  base::UmaHistogramMicrosecondsTimes(
+      "Brave.Omnibox.HistoryQuickProvider.StartTime", timer.Elapsed());
 }
@@ -17,6 +17,7 @@
 #include "base/check.h"
 #include "base/memory/raw_ptr.h"
 #include "base/run_loop.h"
+#include "base/test/metrics/histogram_tester.h"
 #include "base/test/task_environment.h"
 #include "brave/components/omnibox/browser/brave_omnibox_prefs.h"
 #include "components/bookmarks/browser/bookmark_model.h"
@@ -261,18 +262,24 @@ void BraveHistoryQuickProviderTest::SetShouldContain::operator()(
 }
 
 TEST_F(BraveHistoryQuickProviderTest, HasResultsWhenHistoryEnabled) {
+  base::HistogramTester histogram_tester;
   client().GetPrefs()->SetBoolean(omnibox::kHistorySuggestionsEnabled, true);
   std::vector<std::string> expected_urls;
   expected_urls.push_back("http://example.com/");
   // With cursor after "slash", we should retrieve the desired result but it
   // should not be allowed to be the default match.
   RunTest(u"example", false, expected_urls, true, u"example.com", u".com");
+  histogram_tester.ExpectTotalCount(
+      "Brave.Omnibox.HistoryQuickProvider.StartTime", 1);
 }
 
 TEST_F(BraveHistoryQuickProviderTest, HasNoResultsWhenHistoryDisabled) {
+  base::HistogramTester histogram_tester;
   client().GetPrefs()->SetBoolean(omnibox::kHistorySuggestionsEnabled, false);
   std::vector<std::string> expected_urls;
   // With cursor after "slash", we should retrieve the desired result but it
   // should not be allowed to be the default match.
   RunTest(u"example", false, expected_urls, true, u"example.com", u".com");
+  histogram_tester.ExpectTotalCount(
+      "Brave.Omnibox.HistoryQuickProvider.StartTime", 0);
 }
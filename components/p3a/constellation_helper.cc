@@ -15,6 +15,7 @@
 #include "base/logging.h"
 #include "base/rand_util.h"
 #include "base/strings/string_split.h"
+#include "base/task/thread_pool.h"
 #include "brave/components/p3a/features.h"
 #include "brave/components/p3a/metric_log_type.h"
 #include "brave/components/p3a/p3a_config.h"
@@ -128,23 +129,67 @@ bool ConstellationHelper::StartMessagePreparation(std::string histogram_name,
     return true;
   }
 
+  // Hashing the layers to curve points is the costly local part of the
+  // preparation, so it is done off the main sequence.
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::TaskPriority::BEST_EFFORT,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(&ConstellationHelper::PrepareMeasurement,
+                     std::move(layers), epoch),
+      base::BindOnce(&ConstellationHelper::OnMeasurementPrepared,
+                     weak_ptr_factory_.GetWeakPtr(), std::move(histogram_name),
+                     log_type, epoch, is_nebula));
+
+  return true;
+}
+
+ConstellationHelper::PreparedMeasurement::PreparedMeasurement() = default;
+ConstellationHelper::PreparedMeasurement::~PreparedMeasurement() = default;
+
+ConstellationHelper::PreparedMeasurement::PreparedMeasurement(
+    PreparedMeasurement&&) = default;
+ConstellationHelper::PreparedMeasurement&
+ConstellationHelper::PreparedMeasurement::operator=(PreparedMeasurement&&) =
+    default;
+
+// static
+ConstellationHelper::PreparedMeasurement
+ConstellationHelper::PrepareMeasurement(std::vector<std::string> layers,
+                                        uint8_t epoch) {
+  PreparedMeasurement result;
   auto prepare_res = constellation::prepare_measurement(layers, epoch);
   if (!prepare_res.error.empty()) {
-    LOG(ERROR) << "ConstellationHelper: measurement preparation failed: "
-               << prepare_res.error.c_str();
-    return false;
+    result.error = std::string(prepare_res.error);
+    return result;
   }
+  result.randomness_request =
+      constellation::construct_randomness_request(*prepare_res.state);
+  result.randomness_request_state = std::move(prepare_res.state);
+  return result;
+}
 
-  auto req = constellation::construct_randomness_request(*prepare_res.state);
+void ConstellationHelper::OnMeasurementPrepared(
+    std::string histogram_name,
+    MetricLogType log_type,
+    uint8_t epoch,
+    bool is_nebula,
+    PreparedMeasurement prepared_measurement) {
+  if (!prepared_measurement.randomness_request_state) {
+    LOG(ERROR) << "ConstellationHelper: measurement preparation failed: "
+               << prepared_measurement.error;
+    message_callback_.Run(histogram_name, log_type, epoch, false, nullptr);
+    return;
+  }
 
+  auto randomness_request_state =
+      std::move(*prepared_measurement.randomness_request_state);
   rand_points_manager_.SendRandomnessRequest(
-      log_type, epoch, &rand_meta_manager_, req,
+      log_type, epoch, &rand_meta_manager_,
+      prepared_measurement.randomness_request,
       base::BindOnce(&ConstellationHelper::HandleRandomnessData,
-                     base::Unretained(this), histogram_name, log_type,
-                     rnd_server_info->current_epoch, is_nebula,
-                     std::move(prepare_res.state)));
-
-  return true;
+                     base::Unretained(this), histogram_name, log_type, epoch,
+                     is_nebula, std::move(randomness_request_state)));
 }
 
 void ConstellationHelper::HandleRandomnessData(
@@ -7,9 +7,12 @@
 #define BRAVE_COMPONENTS_P3A_CONSTELLATION_HELPER_H_
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "base/functional/callback.h"
+#include "base/memory/weak_ptr.h"
 #include "brave/components/p3a/constellation/rs/cxx/src/lib.rs.h"
 #include "brave/components/p3a/metric_log_type.h"
 #include "brave/components/p3a/star_randomness_meta.h"
@@ -76,6 +79,30 @@ class ConstellationHelper {
                                bool is_nebula);
 
  private:
+  // Local part of the measurement preparation, which runs on the thread pool.
+  struct PreparedMeasurement {
+    PreparedMeasurement();
+    ~PreparedMeasurement();
+
+    PreparedMeasurement(PreparedMeasurement&&);
+    PreparedMeasurement& operator=(PreparedMeasurement&&);
+
+    std::optional<::rust::Box<constellation::RandomnessRequestStateWrapper>>
+        randomness_request_state;
+    rust::Vec<constellation::VecU8> randomness_request;
+    std::string error;
+  };
+
+  static PreparedMeasurement PrepareMeasurement(
+      std::vector<std::string> layers,
+      uint8_t epoch);
+
+  void OnMeasurementPrepared(std::string histogram_name,
+                             MetricLogType log_type,
+                             uint8_t epoch,
+                             bool is_nebula,
+                             PreparedMeasurement prepared_measurement);
+
   void HandleRandomnessData(
       std::string histogram_name,
       MetricLogType log_type,
@@ -101,6 +128,8 @@ class ConstellationHelper {
   ConstellationMessageCallback message_callback_;
 
   ::rust::Box<constellation::PPOPRFPublicKeyWrapper> null_public_key_;
+
+  base::WeakPtrFactory<ConstellationHelper> weak_ptr_factory_{this};
 };
 
 }  // namespace p3a
@@ -17,4 +17,8 @@ bool IsConstellationEnclaveAttestationEnabled() {
       features::kConstellationEnclaveAttestation);
 }
 
+BASE_FEATURE(kCoalesceMetricLogPrefWrites,
+             "BraveP3ACoalesceMetricLogPrefWrites",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+
 }  // namespace p3a::features
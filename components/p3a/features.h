@@ -16,6 +16,10 @@ BASE_DECLARE_FEATURE(kConstellationEnclaveAttestation);
 
 bool IsConstellationEnclaveAttestationEnabled();
 
+// Coalesces metric value pref writes of the log stores, which are persisted
+// after a short delay rather than on every histogram sample.
+BASE_DECLARE_FEATURE(kCoalesceMetricLogPrefWrites);
+
 }  // namespace features
 }  // namespace p3a
 
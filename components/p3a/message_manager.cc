@@ -104,6 +104,11 @@ void MessageManager::Start(
 }
 
 void MessageManager::Stop() {
+  for (MetricLogType log_type : kAllMetricLogTypes) {
+    if (constellation_prep_log_stores_[log_type]) {
+      constellation_prep_log_stores_[log_type]->PersistPendingValues();
+    }
+  }
   uploader_ = nullptr;
   constellation_helper_ = nullptr;
   rotation_scheduler_ = nullptr;
@@ -130,8 +135,9 @@ void MessageManager::UpdateMetricValue(std::string_view histogram_name,
   const auto* metric_config = delegate_->GetMetricConfig(histogram_name);
   if (metric_config && metric_config->record_activation_date && bucket >= 1) {
     // Record activation date for metric, for retention measurement purposes
-    ScopedDictPrefUpdate update(&*local_state_, kActivationDatesDictPref);
-    if (!update->contains(histogram_name)) {
+    if (!local_state_->GetDict(kActivationDatesDictPref)
+             .contains(histogram_name)) {
+      ScopedDictPrefUpdate update(&*local_state_, kActivationDatesDictPref);
       update->Set(histogram_name, base::TimeToValue(base::Time::Now()));
     }
   }
@@ -10,11 +10,13 @@
 #include <vector>
 
 #include "base/check.h"
+#include "base/feature_list.h"
 #include "base/logging.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/notreached.h"
 #include "base/rand_util.h"
 #include "base/strings/string_number_conversions.h"
+#include "brave/components/p3a/features.h"
 #include "brave/components/p3a/metric_log_type.h"
 #include "brave/components/p3a/pref_names.h"
 #include "brave/components/p3a/uploader.h"
@@ -30,6 +32,8 @@ inline constexpr char kLogValueKey[] = "value";
 inline constexpr char kLogSentKey[] = "sent";
 inline constexpr char kLogTimestampKey[] = "timestamp";
 
+constexpr base::TimeDelta kPersistPendingValuesDelay = base::Seconds(5);
+
 void RecordSentAnswersCount(uint64_t answers_count) {
   int answer = 0;
   if (1 <= answers_count && answers_count < 5) {
@@ -96,7 +100,12 @@ const char* MetricLogStore::GetPrefName() const {
 
 void MetricLogStore::UpdateValue(const std::string& histogram_name,
                                  uint64_t value) {
-  LogEntry& entry = log_[histogram_name];
+  auto [it, inserted] = log_.try_emplace(histogram_name);
+  LogEntry& entry = it->second;
+  if (!inserted && entry.value == value) {
+    // Nothing to persist, the stored value is the same.
+    return;
+  }
   entry.value = value;
 
   if (!entry.sent) {
@@ -104,16 +113,48 @@ void MetricLogStore::UpdateValue(const std::string& histogram_name,
     unsent_entries_.insert(histogram_name);
   }
 
-  // Update the persistent value.
+  if (!base::FeatureList::IsEnabled(
+          features::kCoalesceMetricLogPrefWrites)) {
+    PersistValue(histogram_name);
+    return;
+  }
+  pending_values_.insert(histogram_name);
+  if (!persist_timer_.IsRunning()) {
+    persist_timer_.Start(FROM_HERE, kPersistPendingValuesDelay, this,
+                         &MetricLogStore::PersistPendingValues);
+  }
+}
+
+void MetricLogStore::PersistPendingValues() {
+  persist_timer_.Stop();
+  if (pending_values_.empty()) {
+    return;
+  }
+  ScopedDictPrefUpdate update(&*local_state_, GetPrefName());
+  for (const auto& histogram_name : pending_values_) {
+    auto it = log_.find(histogram_name);
+    if (it == log_.end()) {
+      continue;
+    }
+    base::Value::Dict* log_dict = update->EnsureDict(histogram_name);
+    log_dict->Set(kLogValueKey, base::NumberToString(it->second.value));
+    log_dict->Set(kLogSentKey, it->second.sent);
+  }
+  pending_values_.clear();
+}
+
+void MetricLogStore::PersistValue(const std::string& histogram_name) {
+  const LogEntry& entry = log_[histogram_name];
   ScopedDictPrefUpdate update(&*local_state_, GetPrefName());
   base::Value::Dict* log_dict = update->EnsureDict(histogram_name);
-  log_dict->Set(kLogValueKey, base::NumberToString(value));
+  log_dict->Set(kLogValueKey, base::NumberToString(entry.value));
   log_dict->Set(kLogSentKey, entry.sent);
 }
 
 void MetricLogStore::RemoveValueIfExists(const std::string& histogram_name) {
   log_.erase(histogram_name);
   unsent_entries_.erase(histogram_name);
+  pending_values_.erase(histogram_name);
 
   // Update the persistent value.
   ScopedDictPrefUpdate(&*local_state_, GetPrefName())->Remove(histogram_name);
@@ -125,6 +166,8 @@ void MetricLogStore::RemoveValueIfExists(const std::string& histogram_name) {
 }
 
 void MetricLogStore::ResetUploadStamps() {
+  PersistPendingValues();
+
   // Clear log entries flags.
   ScopedDictPrefUpdate update(&*local_state_, GetPrefName());
   for (auto it = log_.begin(); it != log_.end();) {
@@ -14,6 +14,7 @@
 #include "base/containers/flat_set.h"
 #include "base/memory/raw_ref.h"
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "brave/components/p3a/metric_log_type.h"
 #include "components/metrics/log_store.h"
 
@@ -63,6 +64,9 @@ class MetricLogStore : public metrics::LogStore {
   void RemoveValueIfExists(const std::string& histogram_name);
   // Marks all saved values as unsent.
   void ResetUploadStamps();
+  // Writes values updated since the last write to prefs. Only needed if
+  // `features::kCoalesceMetricLogPrefWrites` is enabled.
+  void PersistPendingValues();
 
   // metrics::LogStore:
   bool has_unsent_logs() const override;
@@ -104,6 +108,7 @@ class MetricLogStore : public metrics::LogStore {
   };
 
   const char* GetPrefName() const;
+  void PersistValue(const std::string& histogram_name);
 
   const raw_ref<Delegate> delegate_;
   const raw_ref<PrefService, DanglingUntriaged> local_state_;
@@ -114,6 +119,10 @@ class MetricLogStore : public metrics::LogStore {
   base::flat_map<std::string, LogEntry> log_;
   base::flat_set<std::string> unsent_entries_;
 
+  // Values updated in memory which are not written to prefs yet.
+  base::flat_set<std::string> pending_values_;
+  base::OneShotTimer persist_timer_;
+
   std::string staged_entry_key_;
   std::string staged_log_;
 
@@ -10,8 +10,12 @@
 #include <string_view>
 
 #include "base/strings/string_number_conversions.h"
+#include "base/test/scoped_feature_list.h"
+#include "base/test/task_environment.h"
+#include "brave/components/p3a/features.h"
 #include "brave/components/p3a/metric_log_type.h"
 #include "brave/components/p3a/metric_names.h"
+#include "brave/components/p3a/pref_names.h"
 #include "components/prefs/testing_pref_service.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -117,6 +121,28 @@ TEST_F(P3AMetricLogStoreTest, GetAllLogsAfterTimeReset) {
   ConsumeMessages(15);
 }
 
+TEST_F(P3AMetricLogStoreTest, CoalescesPrefWrites) {
+  base::test::TaskEnvironment task_environment{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+  base::test::ScopedFeatureList scoped_feature_list(
+      features::kCoalesceMetricLogPrefWrites);
+
+  UpdateSomeValues(5);
+  EXPECT_TRUE(local_state.GetDict(kTypicalConstellationPrepPrefName).empty());
+
+  task_environment.FastForwardBy(base::Seconds(5));
+  EXPECT_EQ(local_state.GetDict(kTypicalConstellationPrepPrefName).size(), 5u);
+
+  UpdateSomeValues(10);
+  log_store->ResetUploadStamps();
+  EXPECT_EQ(local_state.GetDict(kTypicalConstellationPrepPrefName).size(),
+            10u);
+
+  SetUpLogStore();
+  log_store->LoadPersistedUnsentLogs();
+  ConsumeMessages(10);
+}
+
 TEST_F(P3AMetricLogStoreTest, ShouldNotLoadUnknownMetric) {
   log_store->UpdateValue(kTestUnknownMetric, 3);
   log_store->UpdateValue(kTestExpressMetric, 4);
@@ -0,0 +1,27 @@
+/* Copyright (c) 2025 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/performance_profile/performance_profile_utils.h"
+
+#include "base/check.h"
+#include "brave/components/performance_profile/pref_names.h"
+#include "components/prefs/pref_registry_simple.h"
+#include "components/prefs/pref_service.h"
+
+namespace performance_profile {
+
+void RegisterLocalStatePrefs(PrefRegistrySimple* registry) {
+  registry->RegisterBooleanPref(kPerformanceProfileEnabled, false);
+}
+
+bool IsPerformanceProfileEnabled(PrefService* local_state) {
+  CHECK(local_state);
+
+  // There is no user-facing setting, only honor the managed value.
+  return local_state->IsManagedPreference(kPerformanceProfileEnabled) &&
+         local_state->GetBoolean(kPerformanceProfileEnabled);
+}
+
+}  // namespace performance_profile
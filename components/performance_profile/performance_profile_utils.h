@@ -0,0 +1,23 @@
+/* Copyright (c) 2025 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_PERFORMANCE_PROFILE_PERFORMANCE_PROFILE_UTILS_H_
+#define BRAVE_COMPONENTS_PERFORMANCE_PROFILE_PERFORMANCE_PROFILE_UTILS_H_
+
+class PrefRegistrySimple;
+class PrefService;
+
+namespace performance_profile {
+
+void RegisterLocalStatePrefs(PrefRegistrySimple* registry);
+
+// Whether an administrator opted this browser into the managed performance
+// profile. Low-overhead modes check this in addition to their own feature, so
+// a single policy turns all of them on across a fleet.
+bool IsPerformanceProfileEnabled(PrefService* local_state);
+
+}  // namespace performance_profile
+
+#endif  // BRAVE_COMPONENTS_PERFORMANCE_PROFILE_PERFORMANCE_PROFILE_UTILS_H_
@@ -0,0 +1,17 @@
+/* Copyright (c) 2025 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_PERFORMANCE_PROFILE_PREF_NAMES_H_
+#define BRAVE_COMPONENTS_PERFORMANCE_PROFILE_PREF_NAMES_H_
+
+namespace performance_profile {
+
+// Local state pref, only set through the BravePerformanceProfileEnabled policy.
+inline constexpr char kPerformanceProfileEnabled[] =
+    "brave.performance_profile.enabled";
+
+}  // namespace performance_profile
+
+#endif  // BRAVE_COMPONENTS_PERFORMANCE_PROFILE_PREF_NAMES_H_
@@ -5,12 +5,14 @@
 
 #include "brave/components/playlist/content/browser/playlist_media_file_download_manager.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "base/check.h"
 #include "base/files/file_path.h"
 #include "base/logging.h"
 #include "base/task/sequenced_task_runner.h"
+#include "brave/components/playlist/core/common/features.h"
 
 namespace playlist {
 
@@ -29,10 +31,8 @@ PlaylistMediaFileDownloadManager::DownloadJob::~DownloadJob() = default;
 PlaylistMediaFileDownloadManager::PlaylistMediaFileDownloadManager(
     content::BrowserContext* context,
     Delegate* delegate)
-    : delegate_(delegate) {
+    : context_(context), delegate_(delegate) {
   DCHECK(delegate_) << "We don't consider where |delegate| is null";
-  media_file_downloader_ =
-      std::make_unique<PlaylistMediaFileDownloader>(this, context);
 }
 
 PlaylistMediaFileDownloadManager::~PlaylistMediaFileDownloadManager() = default;
@@ -44,53 +44,61 @@ void PlaylistMediaFileDownloadManager::DownloadMediaFile(
 
   pending_media_file_creation_jobs_.push(std::move(request));
 
-  // If either media file controller is generating a playlist media file,
-  // delay the next playlist generation. It will be triggered when the current
-  // one is finished.
-  if (!IsCurrentDownloadingInProgress()) {
-    TryStartingDownloadTask();
-  }
+  // If all media file downloaders are busy, delay the next playlist
+  // generation. It will be triggered when one of them is finished.
+  TryStartingDownloadTask();
 }
 
 void PlaylistMediaFileDownloadManager::CancelDownloadRequest(
     const std::string& id) {
   VLOG(2) << __func__ << " " << id;
 
-  // Cancel if currently downloading item is id.
+  // Cancel if the item is being downloaded.
   // Otherwise, PopNextJob() will drop canceled one.
-  if (GetCurrentDownloadingPlaylistItemID() == id) {
-    CancelCurrentDownloadingPlaylistItem();
+  if (current_jobs_.contains(id)) {
+    CancelDownloadingPlaylistItem(id);
     TryStartingDownloadTask();
     return;
   }
 }
 
 void PlaylistMediaFileDownloadManager::CancelAllDownloadRequests() {
-  CancelCurrentDownloadingPlaylistItem();
+  std::vector<std::string> ids;
+  for (const auto& [id, job] : current_jobs_) {
+    ids.push_back(id);
+  }
+  for (const auto& id : ids) {
+    CancelDownloadingPlaylistItem(id);
+  }
   pending_media_file_creation_jobs_ = {};
 }
 
 void PlaylistMediaFileDownloadManager::TryStartingDownloadTask() {
-  if (IsCurrentDownloadingInProgress()) {
-    return;
-  }
+  while (!pending_media_file_creation_jobs_.empty()) {
+    auto* downloader = GetIdleDownloader();
+    if (!downloader) {
+      return;
+    }
 
-  if (pending_media_file_creation_jobs_.empty()) {
-    return;
-  }
+    auto job = PopNextJob();
+    if (!job) {
+      return;
+    }
 
-  current_job_ = PopNextJob();
-  if (!current_job_) {
-    return;
-  }
+    DCHECK(job->item);
+    if (current_jobs_.contains(job->item->id)) {
+      // The item is already being downloaded.
+      continue;
+    }
 
-  DCHECK(current_job_->item);
+    auto item = job->item.Clone();
+    current_jobs_.emplace(item->id, std::move(job));
 
-  if (!pause_download_for_testing_) {
-    VLOG(2) << __func__ << ": " << current_job_->item->name;
-    media_file_downloader_->DownloadMediaFileForPlaylistItem(
-        current_job_->item,
-        delegate_->GetMediaPathForPlaylistItemItem(current_job_->item->id));
+    if (!pause_download_for_testing_) {
+      VLOG(2) << __func__ << ": " << item->name;
+      downloader->DownloadMediaFileForPlaylistItem(
+          item, delegate_->GetMediaPathForPlaylistItemItem(item->id));
+    }
   }
 }
 
@@ -111,28 +119,60 @@ PlaylistMediaFileDownloadManager::PopNextJob() {
   return {};
 }
 
-std::string
-PlaylistMediaFileDownloadManager::GetCurrentDownloadingPlaylistItemID() const {
-  if (IsCurrentDownloadingInProgress()) {
-    return media_file_downloader_->current_item_id();
+PlaylistMediaFileDownloader*
+PlaylistMediaFileDownloadManager::GetIdleDownloader() {
+  const size_t max_downloads = static_cast<size_t>(
+      std::max(features::kPlaylistMaxConcurrentMediaDownloads.Get(), 1));
+  if (current_jobs_.size() >= max_downloads) {
+    return nullptr;
   }
 
-  return {};
-}
+  for (auto& downloader : media_file_downloaders_) {
+    if (!downloader->in_progress()) {
+      return downloader.get();
+    }
+  }
 
-void PlaylistMediaFileDownloadManager::CancelCurrentDownloadingPlaylistItem() {
-  if (current_job_ && current_job_->on_finish_callback) {
-    std::move(current_job_->on_finish_callback)
-        .Run(current_job_->item->Clone(),
-             base::unexpected(DownloadFailureReason::kCanceled));
+  if (media_file_downloaders_.size() >= max_downloads) {
+    return nullptr;
   }
 
-  media_file_downloader_->RequestCancelCurrentPlaylistGeneration();
-  current_job_.reset();
+  return media_file_downloaders_
+      .emplace_back(
+          std::make_unique<PlaylistMediaFileDownloader>(this, context_))
+      .get();
 }
 
-bool PlaylistMediaFileDownloadManager::IsCurrentDownloadingInProgress() const {
-  return media_file_downloader_->in_progress();
+PlaylistMediaFileDownloader*
+PlaylistMediaFileDownloadManager::GetDownloaderForItem(const std::string& id) {
+  for (auto& downloader : media_file_downloaders_) {
+    if (downloader->in_progress() && downloader->current_item_id() == id) {
+      return downloader.get();
+    }
+  }
+  return nullptr;
+}
+
+void PlaylistMediaFileDownloadManager::CancelDownloadingPlaylistItem(
+    const std::string& id) {
+  // Stop the downloader before running the callback, which could queue the
+  // same item again.
+  if (auto* downloader = GetDownloaderForItem(id)) {
+    downloader->RequestCancelCurrentPlaylistGeneration();
+  }
+
+  auto it = current_jobs_.find(id);
+  if (it == current_jobs_.end()) {
+    return;
+  }
+
+  auto job = std::move(it->second);
+  current_jobs_.erase(it);
+  if (job->on_finish_callback) {
+    std::move(job->on_finish_callback)
+        .Run(job->item->Clone(),
+             base::unexpected(DownloadFailureReason::kCanceled));
+  }
 }
 
 void PlaylistMediaFileDownloadManager::OnMediaFileDownloadProgressed(
@@ -140,19 +180,17 @@ void PlaylistMediaFileDownloadManager::OnMediaFileDownloadProgressed(
     int64_t total_bytes,
     int64_t received_bytes,
     int percent_complete,
-    base::TimeDelta time_remaining) {
-  if (!current_job_ || !current_job_->item) {
-    return;
-  }
-
-  if (current_job_->item->id != id) {
+    base::TimeDelta time_remaining,
+    int64_t bytes_per_second) {
+  auto it = current_jobs_.find(id);
+  if (it == current_jobs_.end() || !it->second->item) {
     return;
   }
 
-  if (current_job_->on_progress_callback) {
-    current_job_->on_progress_callback.Run(current_job_->item, total_bytes,
-                                           received_bytes, percent_complete,
-                                           time_remaining);
+  if (it->second->on_progress_callback) {
+    it->second->on_progress_callback.Run(it->second->item, total_bytes,
+                                         received_bytes, percent_complete,
+                                         time_remaining, bytes_per_second);
   }
 }
 
@@ -161,20 +199,18 @@ void PlaylistMediaFileDownloadManager::OnMediaFileReady(
     const std::string& media_file_path,
     int64_t received_bytes) {
   VLOG(2) << __func__ << ": " << id << " is ready.";
-  if (!current_job_ || !current_job_->item) {
+  auto it = current_jobs_.find(id);
+  if (it == current_jobs_.end() || !it->second->item) {
     return;
   }
 
-  if (current_job_->item->id != id) {
-    return;
-  }
-
-  if (current_job_->on_finish_callback) {
-    std::move(current_job_->on_finish_callback)
-        .Run(std::move(current_job_->item),
+  auto job = std::move(it->second);
+  current_jobs_.erase(it);
+  if (job->on_finish_callback) {
+    std::move(job->on_finish_callback)
+        .Run(std::move(job->item),
              DownloadResult(media_file_path, received_bytes));
   }
-  current_job_.reset();
 
   base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
       FROM_HERE,
@@ -185,21 +221,22 @@ void PlaylistMediaFileDownloadManager::OnMediaFileReady(
 void PlaylistMediaFileDownloadManager::OnMediaFileGenerationFailed(
     const std::string& id) {
   VLOG(2) << __func__ << ": " << id;
-  if (!current_job_ || !current_job_->item) {
+  auto it = current_jobs_.find(id);
+  if (it == current_jobs_.end() || !it->second->item) {
     return;
   }
 
-  if (current_job_->item && current_job_->item->id != id) {
-    return;
+  if (auto* downloader = GetDownloaderForItem(id)) {
+    downloader->RequestCancelCurrentPlaylistGeneration();
   }
 
-  if (current_job_->on_finish_callback) {
-    std::move(current_job_->on_finish_callback)
-        .Run(std::move(current_job_->item),
+  auto job = std::move(it->second);
+  current_jobs_.erase(it);
+  if (job->on_finish_callback) {
+    std::move(job->on_finish_callback)
+        .Run(std::move(job->item),
              base::unexpected(DownloadFailureReason::kFailed));
   }
-  current_job_.reset();
-  CancelCurrentDownloadingPlaylistItem();
 
   base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
       FROM_HERE,
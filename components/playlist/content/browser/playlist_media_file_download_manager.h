@@ -8,7 +8,9 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/containers/queue.h"
 #include "base/gtest_prod_util.h"
 #include "base/types/expected.h"
@@ -22,9 +24,9 @@ class BrowserContext;
 namespace playlist {
 
 // Download youtube playlist item's audio/video media files.
-// This handles one request at once. So, it has pending queue.
-// And PlaylistMediaFileDownloader does file download task.
-// TODO(simonhong): Download multiple media files simultaneously.
+// This handles up to kPlaylistMaxConcurrentMediaDownloads requests at once and
+// queues the rest. Each PlaylistMediaFileDownloader does one file download
+// task at a time.
 class PlaylistMediaFileDownloadManager
     : public PlaylistMediaFileDownloader::Delegate {
  public:
@@ -53,7 +55,8 @@ class PlaylistMediaFileDownloadManager
                                  int64_t total_bytes,
                                  int64_t received_bytes,
                                  int percent_complete,
-                                 base::TimeDelta time_remaining)>
+                                 base::TimeDelta time_remaining,
+                                 int64_t bytes_per_second)>
         on_progress_callback;
 
     // If the manage fails to download file, the |media_file_path| will be
@@ -88,7 +91,7 @@ class PlaylistMediaFileDownloadManager
   void CancelDownloadRequest(const std::string& id);
   void CancelAllDownloadRequests();
 
-  bool has_download_requests() const { return !!current_job_; }
+  bool has_download_requests() const { return !current_jobs_.empty(); }
 
  private:
   FRIEND_TEST_ALL_PREFIXES(PlaylistServiceUnitTest, ResetAll);
@@ -98,7 +101,8 @@ class PlaylistMediaFileDownloadManager
                                      int64_t total_bytes,
                                      int64_t received_bytes,
                                      int percent_complete,
-                                     base::TimeDelta time_remaining) override;
+                                     base::TimeDelta time_remaining,
+                                     int64_t bytes_per_second) override;
   void OnMediaFileReady(const std::string& id,
                         const std::string& media_file_path,
                         int64_t received_bytes) override;
@@ -107,16 +111,21 @@ class PlaylistMediaFileDownloadManager
 
   void TryStartingDownloadTask();
   std::unique_ptr<DownloadJob> PopNextJob();
-  std::string GetCurrentDownloadingPlaylistItemID() const;
-  void CancelCurrentDownloadingPlaylistItem();
-  bool IsCurrentDownloadingInProgress() const;
+  // Returns a downloader that is not working on any item, creating one if the
+  // concurrency limit allows it.
+  PlaylistMediaFileDownloader* GetIdleDownloader();
+  PlaylistMediaFileDownloader* GetDownloaderForItem(const std::string& id);
+  void CancelDownloadingPlaylistItem(const std::string& id);
 
+  raw_ptr<content::BrowserContext> context_;
   raw_ptr<Delegate> delegate_;
   base::queue<std::unique_ptr<DownloadJob>> pending_media_file_creation_jobs_;
 
-  std::unique_ptr<DownloadJob> current_job_;
+  // Jobs being downloaded, keyed by playlist item id.
+  base::flat_map<std::string, std::unique_ptr<DownloadJob>> current_jobs_;
 
-  std::unique_ptr<PlaylistMediaFileDownloader> media_file_downloader_;
+  std::vector<std::unique_ptr<PlaylistMediaFileDownloader>>
+      media_file_downloaders_;
 
   bool pause_download_for_testing_ = false;
 
@@ -235,7 +235,7 @@ void PlaylistMediaFileDownloader::OnDownloadUpdated(
     item->TimeRemaining(&time_remaining);
     delegate_->OnMediaFileDownloadProgressed(
         current_item_->id, item->GetTotalBytes(), item->GetReceivedBytes(),
-        item->PercentComplete(), time_remaining);
+        item->PercentComplete(), time_remaining, item->CurrentSpeed());
   }
 
   if (item->IsDone()) {
@@ -54,7 +54,8 @@ class PlaylistMediaFileDownloader
         int64_t total_bytes,
         int64_t received_bytes,
         int percent_complete,
-        base::TimeDelta time_remaining) = 0;
+        base::TimeDelta time_remaining,
+        int64_t bytes_per_second) = 0;
 
     // Called when target media file generation succeed.
     virtual void OnMediaFileReady(const std::string& id,
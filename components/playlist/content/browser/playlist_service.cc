@@ -1155,10 +1155,12 @@ void PlaylistService::OnMediaFileDownloadProgressed(
     int64_t total_bytes,
     int64_t received_bytes,
     int percent_complete,
-    base::TimeDelta time_remaining) {
+    base::TimeDelta time_remaining,
+    int64_t bytes_per_second) {
   DCHECK(item);
   VLOG(2) << __func__ << " " << total_bytes << " " << received_bytes << " "
-          << percent_complete << " " << time_remaining;
+          << percent_complete << " " << time_remaining << " "
+          << bytes_per_second << "B/s";
 
   for (auto& observer : observers_) {
     observer->OnMediaFileDownloadProgressed(
@@ -333,7 +333,8 @@ class PlaylistService : public KeyedService,
                                      int64_t total_bytes,
                                      int64_t received_bytes,
                                      int percent_complete,
-                                     base::TimeDelta remaining_time);
+                                     base::TimeDelta remaining_time,
+                                     int64_t bytes_per_second);
   void OnMediaFileDownloadFinished(
       bool update_media_src_and_retry_on_fail,
       DownloadMediaFileCallback callback,
@@ -14,4 +14,16 @@ BASE_FEATURE(kPlaylist, base::FEATURE_DISABLED_BY_DEFAULT);
 BASE_FEATURE(kPlaylistFakeUA,
              base::FEATURE_DISABLED_BY_DEFAULT);
 
+BASE_FEATURE_PARAM(int,
+                   kPlaylistMaxConcurrentMediaDownloads,
+                   &kPlaylist,
+                   "max_concurrent_media_downloads",
+                   1);
+
+BASE_FEATURE_PARAM(int,
+                   kPlaylistThumbnailMaxDimension,
+                   &kPlaylist,
+                   "thumbnail_max_dimension",
+                   0);
+
 }  // namespace playlist::features
@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_PLAYLIST_CORE_COMMON_FEATURES_H_
 
 #include "base/feature_list.h"
+#include "base/metrics/field_trial_params.h"
 
 namespace playlist::features {
 
@@ -14,6 +15,13 @@ BASE_DECLARE_FEATURE(kPlaylist);
 
 BASE_DECLARE_FEATURE(kPlaylistFakeUA);
 
+// Number of media files that are downloaded at the same time.
+BASE_DECLARE_FEATURE_PARAM(int, kPlaylistMaxConcurrentMediaDownloads);
+
+// Thumbnails larger than this in either dimension are scaled down before
+// being stored. Zero keeps thumbnails at their original size.
+BASE_DECLARE_FEATURE_PARAM(int, kPlaylistThumbnailMaxDimension);
+
 }  // namespace playlist::features
 
 #endif  // BRAVE_COMPONENTS_PLAYLIST_CORE_COMMON_FEATURES_H_
@@ -53,6 +53,9 @@ class PsstRule {
   bool ShouldInsertScript(const GURL& url) const;
 
   // Getters.
+  const extensions::URLPatternSet& include_pattern_set() const {
+    return include_pattern_set_;
+  }
   const std::string& name() const { return name_; }
   const base::FilePath& policy_script_path() const {
     return policy_script_path_;
@@ -5,11 +5,15 @@
 
 #include "brave/components/psst/browser/core/psst_rule_registry_impl.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
+#include "base/containers/flat_set.h"
+#include "base/containers/map_util.h"
 #include "base/feature_list.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
@@ -22,6 +26,7 @@
 #include "brave/components/psst/browser/core/psst_rule.h"
 #include "brave/components/psst/browser/core/rule_data_reader.h"
 #include "brave/components/psst/common/features.h"
+#include "extensions/common/url_pattern.h"
 #include "url/origin.h"
 
 namespace psst {
@@ -53,7 +58,8 @@ PsstRuleRegistryImpl::~PsstRuleRegistryImpl() = default;
 void PsstRuleRegistryImpl::CheckIfMatch(
     const GURL& url,
     base::OnceCallback<void(std::unique_ptr<MatchedRule>)> cb) {
-  for (const PsstRule& rule : rules_) {
+  for (const size_t rule_index : GetCandidateRules(url)) {
+    const PsstRule& rule = rules_[rule_index];
     if (rule.ShouldInsertScript(url)) {
       base::ThreadPool::PostTaskAndReplyWithResult(
           FROM_HERE, {base::MayBlock()},
@@ -84,9 +90,80 @@ void PsstRuleRegistryImpl::OnLoadRules(OnLoadCallback cb,
   auto parsed_rules = PsstRule::ParseRules(contents);
   if (parsed_rules) {
     rules_ = std::move(parsed_rules.value());
+    BuildRuleIndex();
   }
 
   std::move(cb).Run(contents, rules_);
 }
 
+void PsstRuleRegistryImpl::BuildRuleIndex() {
+  std::vector<std::pair<std::string, size_t>> by_host;
+  std::vector<std::pair<std::string, size_t>> by_host_suffix;
+  rules_for_any_host_.clear();
+
+  for (size_t i = 0; i < rules_.size(); ++i) {
+    for (const URLPattern& pattern : rules_[i].include_pattern_set()) {
+      if (pattern.match_all_urls() ||
+          (pattern.match_subdomains() && pattern.host().empty())) {
+        rules_for_any_host_.push_back(i);
+      } else if (pattern.match_subdomains()) {
+        by_host_suffix.emplace_back(pattern.host(), i);
+      } else {
+        by_host.emplace_back(pattern.host(), i);
+      }
+    }
+  }
+
+  // Entries are appended in rule order, so after a stable sort by host each
+  // host's rule indices are still ascending.
+  auto group = [](std::vector<std::pair<std::string, size_t>> entries) {
+    std::ranges::stable_sort(entries, {},
+                             &std::pair<std::string, size_t>::first);
+    std::vector<std::pair<std::string, std::vector<size_t>>> grouped;
+    for (auto& [host, rule_index] : entries) {
+      if (grouped.empty() || grouped.back().first != host) {
+        grouped.emplace_back(std::move(host), std::vector<size_t>());
+      }
+      auto& indices = grouped.back().second;
+      if (indices.empty() || indices.back() != rule_index) {
+        indices.push_back(rule_index);
+      }
+    }
+    return base::flat_map<std::string, std::vector<size_t>>(
+        base::sorted_unique, std::move(grouped));
+  };
+  rules_by_host_ = group(std::move(by_host));
+  rules_by_host_suffix_ = group(std::move(by_host_suffix));
+}
+
+std::vector<size_t> PsstRuleRegistryImpl::GetCandidateRules(
+    const GURL& url) const {
+  base::flat_set<size_t> candidates(rules_for_any_host_);
+  if (!url.has_host()) {
+    return std::move(candidates).extract();
+  }
+
+  std::string_view host = url.host();
+  if (host.ends_with('.')) {
+    host.remove_suffix(1);
+  }
+
+  if (const auto* indices = base::FindOrNull(rules_by_host_, host)) {
+    candidates.insert(indices->begin(), indices->end());
+  }
+  // Walk |host| and each of its parent domains for subdomain patterns.
+  while (!host.empty()) {
+    if (const auto* indices = base::FindOrNull(rules_by_host_suffix_, host)) {
+      candidates.insert(indices->begin(), indices->end());
+    }
+    const size_t dot = host.find('.');
+    if (dot == std::string_view::npos) {
+      break;
+    }
+    host.remove_prefix(dot + 1);
+  }
+
+  return std::move(candidates).extract();
+}
+
 }  // namespace psst
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/functional/callback.h"
 #include "base/functional/callback_forward.h"
 #include "base/memory/weak_ptr.h"
@@ -39,7 +40,20 @@ class PsstRuleRegistryImpl : public PsstRuleRegistry {
 
   void OnLoadRules(OnLoadCallback cb, const std::string& data);
 
+  // Rebuilds the host index below from |rules_|.
+  void BuildRuleIndex();
+  // Returns the indices into |rules_|, in rule order, of the rules whose
+  // include patterns could match |url|. Each candidate still has to be
+  // checked with PsstRule::ShouldInsertScript.
+  std::vector<size_t> GetCandidateRules(const GURL& url) const;
+
   std::vector<PsstRule> rules_;
+  // Rules keyed by the host of their include patterns, split by whether the
+  // pattern also matches subdomains. Rules with a pattern that matches any
+  // host are always candidates.
+  base::flat_map<std::string, std::vector<size_t>> rules_by_host_;
+  base::flat_map<std::string, std::vector<size_t>> rules_by_host_suffix_;
+  std::vector<size_t> rules_for_any_host_;
   base::FilePath component_path_;
   base::WeakPtrFactory<PsstRuleRegistryImpl> weak_factory_{this};
 };
@@ -6,6 +6,9 @@
 #include <cstddef>
 #include <memory>
 #include <optional>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "base/base_paths.h"
 #include "base/files/file_path.h"
@@ -70,6 +73,16 @@ class PsstRuleRegistryUnitTest : public testing::Test {
   }
   PsstRuleRegistryImpl& psst_rule_registry() { return registry_; }
 
+  void SetRules(const std::string& contents) {
+    auto rules = PsstRule::ParseRules(contents);
+    ASSERT_TRUE(rules);
+    registry_.rules_ = std::move(rules.value());
+    registry_.BuildRuleIndex();
+  }
+  std::vector<size_t> GetCandidateRules(const GURL& url) const {
+    return registry_.GetCandidateRules(url);
+  }
+
  private:
   PsstRuleRegistryImpl registry_;
   base::test::TaskEnvironment task_environment_;
@@ -259,4 +272,41 @@ TEST_F(PsstRuleRegistryUnitTest, DoNotMatchRuleIfNotExists) {
                                     mock_callback.Get());
 }
 
+TEST_F(PsstRuleRegistryUnitTest, CandidateRulesByHost) {
+  SetRules(R"([
+    {
+      "name": "exact", "version": 1,
+      "include": ["https://a.test/*"], "exclude": [],
+      "user_script": "user.js", "policy_script": "policy.js"
+    },
+    {
+      "name": "subdomains", "version": 1,
+      "include": ["https://*.b.test/*"], "exclude": [],
+      "user_script": "user.js", "policy_script": "policy.js"
+    },
+    {
+      "name": "both", "version": 1,
+      "include": ["https://a.test/path/*", "https://*.b.test/*"],
+      "exclude": [],
+      "user_script": "user.js", "policy_script": "policy.js"
+    },
+    {
+      "name": "any", "version": 1,
+      "include": ["https://*/*"], "exclude": [],
+      "user_script": "user.js", "policy_script": "policy.js"
+    }
+  ])");
+
+  EXPECT_EQ(GetCandidateRules(GURL("https://a.test/")),
+            (std::vector<size_t>{0, 2, 3}));
+  EXPECT_EQ(GetCandidateRules(GURL("https://sub.a.test/")),
+            (std::vector<size_t>{3}));
+  EXPECT_EQ(GetCandidateRules(GURL("https://b.test/")),
+            (std::vector<size_t>{1, 2, 3}));
+  EXPECT_EQ(GetCandidateRules(GURL("https://x.y.b.test/")),
+            (std::vector<size_t>{1, 2, 3}));
+  EXPECT_EQ(GetCandidateRules(GURL("https://notb.test/")),
+            (std::vector<size_t>{3}));
+}
+
 }  // namespace psst
@@ -5,6 +5,7 @@
 
 #include "brave/components/request_otr/browser/request_otr_rule.h"
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <string_view>
@@ -84,7 +85,7 @@ const std::string RequestOTRRule::GetETLDForRequestOTR(std::string_view host) {
 
 // static
 base::expected<std::pair<std::vector<std::unique_ptr<RequestOTRRule>>,
-                         base::flat_set<std::string>>,
+                         RequestOTRRule::RuleIndex>,
                std::string>
 RequestOTRRule::ParseRules(std::string_view contents) {
   if (contents.empty()) {
@@ -95,10 +96,10 @@ RequestOTRRule::ParseRules(std::string_view contents) {
   if (!root) {
     return base::unexpected("Failed to parse request_otr configuration");
   }
-  std::pair<std::vector<std::unique_ptr<RequestOTRRule>>,
-            base::flat_set<std::string>>
-      result;
-  auto& [rules, hosts] = result;
+  std::vector<std::unique_ptr<RequestOTRRule>> rules;
+  // Collected as (eTLD+1, rule index) pairs in rule order and grouped once
+  // all rules are parsed.
+  std::vector<std::pair<std::string, size_t>> etldp1_entries;
   base::JSONValueConverter<RequestOTRRule> converter;
   for (base::Value& it : *root) {
     std::unique_ptr<RequestOTRRule> rule = std::make_unique<RequestOTRRule>();
@@ -110,13 +111,28 @@ RequestOTRRule::ParseRules(std::string_view contents) {
         std::string etldp1 =
             RequestOTRRule::GetETLDForRequestOTR(pattern.host());
         if (!etldp1.empty()) {
-          hosts.insert(std::move(etldp1));
+          etldp1_entries.emplace_back(std::move(etldp1), rules.size());
         }
       }
     }
     rules.push_back(std::move(rule));
   }
-  return result;
+
+  std::ranges::stable_sort(etldp1_entries, {},
+                           &std::pair<std::string, size_t>::first);
+  std::vector<std::pair<std::string, std::vector<size_t>>> grouped;
+  for (auto& [etldp1, rule_index] : etldp1_entries) {
+    if (grouped.empty() || grouped.back().first != etldp1) {
+      grouped.emplace_back(std::move(etldp1), std::vector<size_t>());
+    }
+    auto& indices = grouped.back().second;
+    if (indices.empty() || indices.back() != rule_index) {
+      indices.push_back(rule_index);
+    }
+  }
+
+  return std::make_pair(std::move(rules),
+                        RuleIndex(base::sorted_unique, std::move(grouped)));
 }
 
 bool RequestOTRRule::ShouldBlock(const GURL& url) const {
@@ -11,7 +11,7 @@
 #include <utility>
 #include <vector>
 
-#include "base/containers/flat_set.h"
+#include "base/containers/flat_map.h"
 #include "base/json/json_value_converter.h"
 #include "base/types/expected.h"
 #include "base/values.h"
@@ -31,9 +31,13 @@ class RequestOTRRule {
   // class.
   static void RegisterJSONConverter(
       base::JSONValueConverter<RequestOTRRule>* converter);
-  static base::expected<std::pair<std::vector<std::unique_ptr<RequestOTRRule>>,
-                                  base::flat_set<std::string>>,
-                        std::string>
+  // Maps the eTLD+1 of each include pattern host to the indices of the rules
+  // that have such a pattern, in rule order.
+  using RuleIndex = base::flat_map<std::string, std::vector<size_t>>;
+
+  static base::expected<
+      std::pair<std::vector<std::unique_ptr<RequestOTRRule>>, RuleIndex>,
+      std::string>
   ParseRules(std::string_view contents);
   static const std::string GetETLDForRequestOTR(std::string_view host);
   static bool GetURLPatternSetFromValue(const base::Value* value,
@@ -7,8 +7,7 @@
 
 #include <utility>
 
-#include "base/containers/contains.h"
-#include "base/containers/flat_set.h"
+#include "base/containers/map_util.h"
 #include "base/logging.h"
 #include "brave/components/request_otr/browser/request_otr_component_installer.h"
 #include "brave/components/request_otr/browser/request_otr_p3a.h"
@@ -40,23 +39,22 @@ void RequestOTRService::OnRulesReady(const std::string& json_content) {
     DVLOG(1) << "Error: no rules parsed. " << parsed_rules.error();
     return;
   }
-  rules_.clear();
-  host_cache_.clear();
   rules_ = std::move(parsed_rules.value().first);
-  host_cache_ = std::move(parsed_rules).value().second;
-  DVLOG(1) << host_cache_.size() << " unique hosts, " << rules_.size()
+  rules_by_etldp1_ = std::move(parsed_rules.value().second);
+  DVLOG(1) << rules_by_etldp1_.size() << " unique hosts, " << rules_.size()
            << " rules parsed from " << kRequestOTRConfigFile;
 }
 
 bool RequestOTRService::ShouldBlock(const GURL& url) const {
-  // Check host cache
   const std::string etldp1 = RequestOTRRule::GetETLDForRequestOTR(url.host());
-  if (!base::Contains(host_cache_, etldp1)) {
+  const std::vector<size_t>* rule_indices =
+      base::FindOrNull(rules_by_etldp1_, etldp1);
+  if (!rule_indices) {
     return false;
   }
 
-  for (const std::unique_ptr<RequestOTRRule>& rule : rules_) {
-    if (rule->ShouldBlock(url)) {
+  for (const size_t rule_index : *rule_indices) {
+    if (rules_[rule_index]->ShouldBlock(url)) {
       return true;
     }
   }
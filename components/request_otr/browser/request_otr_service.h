@@ -10,7 +10,6 @@
 #include <string>
 #include <vector>
 
-#include "base/containers/flat_set.h"
 #include "base/json/json_value_converter.h"
 #include "base/memory/weak_ptr.h"
 #include "base/timer/wall_clock_timer.h"
@@ -51,7 +50,10 @@ class RequestOTRService : public KeyedService,
   void UpdateP3AMetrics();
 
   std::vector<std::unique_ptr<RequestOTRRule>> rules_;
-  base::flat_set<std::string> host_cache_;
+  // Rules by the eTLD+1 of their include patterns. A navigation is only
+  // checked against the rules indexed under its own eTLD+1, and a host with
+  // no entry here is never blocked.
+  RequestOTRRule::RuleIndex rules_by_etldp1_;
 
   raw_ptr<PrefService> profile_prefs_;
   base::WallClockTimer p3a_timer_;
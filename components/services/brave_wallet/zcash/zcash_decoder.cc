@@ -101,20 +101,23 @@ void ZCashDecoder::ParseTreeState(const std::string& data,
 void ZCashDecoder::ParseCompactBlocks(const std::vector<std::string>& data,
                                       ParseCompactBlocksCallback callback) {
   std::vector<zcash::mojom::CompactBlockPtr> parsed_blocks;
+  parsed_blocks.reserve(data.size());
+  // Reused across blocks so parsing can recycle the message's repeated fields.
+  ::zcash::CompactBlock result;
   for (const auto& data_block : data) {
-    ::zcash::CompactBlock result;
     auto serialized_message = ResolveSerializedMessage(data_block);
-    if (!serialized_message ||
-        !result.ParseFromString(serialized_message.value()) ||
-        serialized_message->empty()) {
+    if (!serialized_message || serialized_message->empty() ||
+        !result.ParseFromString(serialized_message.value())) {
       std::move(callback).Run(std::nullopt);
       return;
     }
 
     std::vector<zcash::mojom::CompactTxPtr> transactions;
+    transactions.reserve(result.vtx_size());
     for (int i = 0; i < result.vtx_size(); i++) {
       const auto& vtx = result.vtx(i);
       std::vector<zcash::mojom::CompactOrchardActionPtr> orchard_actions;
+      orchard_actions.reserve(vtx.actions_size());
       for (int j = 0; j < vtx.actions_size(); j++) {
         const auto& action = vtx.actions(j);
         orchard_actions.push_back(zcash::mojom::CompactOrchardAction::New(
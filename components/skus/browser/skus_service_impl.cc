@@ -8,16 +8,43 @@
 #include <memory>
 #include <utility>
 
+#include "base/feature_list.h"
+#include "base/functional/bind.h"
 #include "brave/components/skus/browser/pref_names.h"
 #include "brave/components/skus/browser/rs/cxx/src/lib.rs.h"
 #include "brave/components/skus/browser/skus_context_impl.h"
 #include "brave/components/skus/browser/skus_utils.h"
+#include "brave/components/skus/common/features.h"
 #include "components/prefs/pref_service.h"
 #include "components/prefs/scoped_user_pref_update.h"
+#include "net/cookies/cookie_inclusion_status.h"
+#include "net/cookies/cookie_util.h"
+#include "net/cookies/parsed_cookie.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 
 namespace skus {
 
+namespace {
+
+// Prefetched presentations that expire sooner than this are not handed out,
+// as the consumer would reject them or fail the request using them.
+constexpr base::TimeDelta kPrefetchedPresentationMinLifetime =
+    base::Minutes(1);
+
+}  // namespace
+
+SkusServiceImpl::PrefetchedPresentation::PrefetchedPresentation() = default;
+SkusServiceImpl::PrefetchedPresentation::PrefetchedPresentation(
+    mojom::SkusResultPtr result,
+    base::Time expires_at)
+    : result(std::move(result)), expires_at(expires_at) {}
+SkusServiceImpl::PrefetchedPresentation::PrefetchedPresentation(
+    PrefetchedPresentation&&) = default;
+SkusServiceImpl::PrefetchedPresentation&
+SkusServiceImpl::PrefetchedPresentation::operator=(PrefetchedPresentation&&) =
+    default;
+SkusServiceImpl::PrefetchedPresentation::~PrefetchedPresentation() = default;
+
 SkusServiceImpl::SkusServiceImpl(
     PrefService* prefs,
     scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory)
@@ -33,6 +60,7 @@ void SkusServiceImpl::Shutdown() {
 
   // Disconnect remotes.
   receivers_.ClearWithReason(0, "Shutting down");
+  ClearPrefetchedPresentations();
 
   for (auto it = sdks_.begin(); it != sdks_.end();) {
     // CppSDK must be destroyed on the sdk task runner.
@@ -57,6 +85,7 @@ void SkusServiceImpl::RefreshOrder(
     const std::string& order_id,
     mojom::SkusService::RefreshOrderCallback callback) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  ClearPrefetchedPresentations();
 
   PostTaskWithSDK(
       domain,
@@ -74,6 +103,7 @@ void SkusServiceImpl::FetchOrderCredentials(
     const std::string& order_id,
     mojom::SkusService::FetchOrderCredentialsCallback callback) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  ClearPrefetchedPresentations();
 
   PostTaskWithSDK(
       domain,
@@ -92,6 +122,99 @@ void SkusServiceImpl::PrepareCredentialsPresentation(
     mojom::SkusService::PrepareCredentialsPresentationCallback callback) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
+  if (!base::FeatureList::IsEnabled(features::kSkusPresentationPrefetch)) {
+    PrepareCredentialsPresentationWithSDK(domain, path, std::move(callback));
+    return;
+  }
+
+  auto it = prefetched_presentations_.find(PresentationKey(domain, path));
+  if (it != prefetched_presentations_.end()) {
+    PrefetchedPresentation prefetched = std::move(it->second);
+    prefetched_presentations_.erase(it);
+    if (prefetched.expires_at - base::Time::Now() >=
+        kPrefetchedPresentationMinLifetime) {
+      std::move(callback).Run(std::move(prefetched.result));
+      PrefetchCredentialsPresentation(domain, path);
+      return;
+    }
+  }
+
+  PrepareCredentialsPresentationWithSDK(
+      domain, path,
+      base::BindOnce(&SkusServiceImpl::OnPrepareCredentialsPresentation,
+                     weak_factory_.GetWeakPtr(), domain, path,
+                     std::move(callback)));
+}
+
+void SkusServiceImpl::OnPrepareCredentialsPresentation(
+    const std::string& domain,
+    const std::string& path,
+    mojom::SkusService::PrepareCredentialsPresentationCallback callback,
+    mojom::SkusResultPtr result) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  const bool success = result->code == mojom::SkusResultCode::Ok;
+  std::move(callback).Run(std::move(result));
+  // Only prefetch for domains and paths that have credentials.
+  if (success) {
+    PrefetchCredentialsPresentation(domain, path);
+  }
+}
+
+void SkusServiceImpl::PrefetchCredentialsPresentation(
+    const std::string& domain,
+    const std::string& path) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  PresentationKey key(domain, path);
+  if (prefetched_presentations_.contains(key) ||
+      !pending_presentation_prefetches_.insert(key).second) {
+    return;
+  }
+  PrepareCredentialsPresentationWithSDK(
+      domain, path,
+      base::BindOnce(&SkusServiceImpl::OnCredentialsPresentationPrefetched,
+                     weak_factory_.GetWeakPtr(), std::move(key)));
+}
+
+void SkusServiceImpl::OnCredentialsPresentationPrefetched(
+    const PresentationKey& key,
+    mojom::SkusResultPtr result) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  // Cleared while the prefetch was in flight.
+  if (!pending_presentation_prefetches_.erase(key)) {
+    return;
+  }
+  if (result->code != mojom::SkusResultCode::Ok) {
+    return;
+  }
+
+  // The presentation is returned in cookie format, which carries its expiry.
+  net::CookieInclusionStatus status;
+  net::ParsedCookie cookie(result->message, &status);
+  if (!cookie.IsValid() || !status.IsInclude() || !cookie.Expires() ||
+      cookie.Value().empty()) {
+    return;
+  }
+  const base::Time expires_at =
+      net::cookie_util::ParseCookieExpirationTime(*cookie.Expires());
+  if (expires_at - base::Time::Now() < kPrefetchedPresentationMinLifetime) {
+    return;
+  }
+  prefetched_presentations_.insert_or_assign(
+      key, PrefetchedPresentation(std::move(result), expires_at));
+}
+
+void SkusServiceImpl::ClearPrefetchedPresentations() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  prefetched_presentations_.clear();
+  pending_presentation_prefetches_.clear();
+}
+
+void SkusServiceImpl::PrepareCredentialsPresentationWithSDK(
+    const std::string& domain,
+    const std::string& path,
+    base::OnceCallback<void(mojom::SkusResultPtr)> callback) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
   PostTaskWithSDK(
       domain,
       base::BindOnce(
@@ -127,6 +250,7 @@ void SkusServiceImpl::SubmitReceipt(
     const std::string& receipt,
     skus::mojom::SkusService::SubmitReceiptCallback callback) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  ClearPrefetchedPresentations();
 
   PostTaskWithSDK(
       domain,
@@ -145,6 +269,7 @@ void SkusServiceImpl::CreateOrderFromReceipt(
     const std::string& receipt,
     skus::mojom::SkusService::CreateOrderFromReceiptCallback callback) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  ClearPrefetchedPresentations();
 
   PostTaskWithSDK(
       domain,
@@ -162,6 +287,7 @@ void SkusServiceImpl::PurgeStore(
                               bool success)> done,
     rust::cxxbridge1::Box<skus::StoragePurgeContext> st_ctx) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  ClearPrefetchedPresentations();
   ScopedDictPrefUpdate state(&*prefs_, prefs::kSkusState);
   state->clear();
 
@@ -9,12 +9,16 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
+#include "base/containers/flat_map.h"
+#include "base/containers/flat_set.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
 #include "base/task/single_thread_task_runner.h"
 #include "base/task/thread_pool.h"
 #include "base/threading/sequence_bound.h"
+#include "base/time/time.h"
 #include "brave/components/skus/browser/rs/cxx/src/shim.h"
 #include "brave/components/skus/common/skus_sdk.mojom.h"
 #include "components/keyed_service/core/keyed_service.h"
@@ -122,6 +126,36 @@ class SkusServiceImpl : public KeyedService, public mojom::SkusService {
       rust::cxxbridge1::Box<skus::StorageSetContext> st_ctx);
 
  private:
+  // Domain and path of a credentials presentation.
+  using PresentationKey = std::pair<std::string, std::string>;
+
+  struct PrefetchedPresentation {
+    PrefetchedPresentation();
+    PrefetchedPresentation(mojom::SkusResultPtr result, base::Time expires_at);
+    PrefetchedPresentation(PrefetchedPresentation&&);
+    PrefetchedPresentation& operator=(PrefetchedPresentation&&);
+    ~PrefetchedPresentation();
+
+    mojom::SkusResultPtr result;
+    base::Time expires_at;
+  };
+
+  void PrepareCredentialsPresentationWithSDK(
+      const std::string& domain,
+      const std::string& path,
+      base::OnceCallback<void(mojom::SkusResultPtr)> callback);
+  void OnPrepareCredentialsPresentation(
+      const std::string& domain,
+      const std::string& path,
+      skus::mojom::SkusService::PrepareCredentialsPresentationCallback callback,
+      mojom::SkusResultPtr result);
+  void PrefetchCredentialsPresentation(const std::string& domain,
+                                       const std::string& path);
+  void OnCredentialsPresentationPrefetched(const PresentationKey& key,
+                                           mojom::SkusResultPtr result);
+  // Drops prefetched presentations when the credentials store changes.
+  void ClearPrefetchedPresentations();
+
   void PostTaskWithSDK(const std::string& domain,
                        base::OnceCallback<void(skus::CppSDK* sdk)> cb);
 
@@ -137,6 +171,12 @@ class SkusServiceImpl : public KeyedService, public mojom::SkusService {
   std::unordered_map<std::string, ::rust::Box<skus::CppSDK>> sdks_
       GUARDED_BY_CONTEXT(sequence_checker_);
   mojo::ReceiverSet<mojom::SkusService> receivers_;
+  // Presentations are single use, as preparing one spends a credential, so
+  // each prefetched entry is handed out once and then prefetched again.
+  base::flat_map<PresentationKey, PrefetchedPresentation>
+      prefetched_presentations_ GUARDED_BY_CONTEXT(sequence_checker_);
+  base::flat_set<PresentationKey> pending_presentation_prefetches_
+      GUARDED_BY_CONTEXT(sequence_checker_);
   base::WeakPtrFactory<SkusServiceImpl> weak_factory_{this};
 };
 
@@ -11,5 +11,6 @@
 namespace skus::features {
 
 BASE_FEATURE(kSkusFeature, base::FEATURE_ENABLED_BY_DEFAULT);
+BASE_FEATURE(kSkusPresentationPrefetch, base::FEATURE_DISABLED_BY_DEFAULT);
 
 }  // namespace skus::features
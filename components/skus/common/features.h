@@ -18,6 +18,11 @@ namespace features {
 // implementation which allows for safe credential interception.
 BASE_DECLARE_FEATURE(kSkusFeature);
 
+// If enabled, SkusServiceImpl prepares the next credentials presentation for
+// a domain/path in the background after handing one out, so that the next
+// entitlement check from VPN or Leo doesn't wait on the SDK.
+BASE_DECLARE_FEATURE(kSkusPresentationPrefetch);
+
 }  // namespace features
 }  // namespace skus
 
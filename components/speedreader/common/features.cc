@@ -23,4 +23,12 @@ const base::FeatureParam<bool> kSpeedreaderDebugView{&kSpeedreaderFeature,
 const base::FeatureParam<bool> kSpeedreaderExplicitPref{&kSpeedreaderFeature,
                                                         "explicit_pref", true};
 
+const base::FeatureParam<bool> kSpeedreaderStreamingDistillation{
+    &kSpeedreaderFeature, "streaming_distillation", false};
+
+// Number of distilled documents kept in memory per profile. Zero disables the
+// cache.
+const base::FeatureParam<int> kSpeedreaderDistillationCacheSize{
+    &kSpeedreaderFeature, "distillation_cache_size", 0};
+
 }  // namespace speedreader::features
@@ -15,6 +15,8 @@ extern const base::FeatureParam<int> kSpeedreaderMinOutLengthParam;
 extern const base::FeatureParam<bool> kSpeedreaderTTS;
 extern const base::FeatureParam<bool> kSpeedreaderDebugView;
 extern const base::FeatureParam<bool> kSpeedreaderExplicitPref;
+extern const base::FeatureParam<bool> kSpeedreaderStreamingDistillation;
+extern const base::FeatureParam<int> kSpeedreaderDistillationCacheSize;
 }  // namespace speedreader::features
 
 #endif  // BRAVE_COMPONENTS_SPEEDREADER_COMMON_FEATURES_H_
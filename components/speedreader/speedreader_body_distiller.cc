@@ -16,11 +16,16 @@
 #include "base/files/file_util.h"
 #include "base/functional/bind.h"
 #include "base/memory/weak_ptr.h"
+#include "base/metrics/histogram_functions.h"
+#include "base/strings/strcat.h"
 #include "base/strings/string_util.h"
+#include "base/task/thread_pool.h"
+#include "brave/components/speedreader/common/features.h"
 #include "brave/components/speedreader/speedreader_delegate.h"
 #include "brave/components/speedreader/speedreader_rewriter_service.h"
 #include "brave/components/speedreader/speedreader_service.h"
 #include "brave/components/speedreader/speedreader_util.h"
+#include "crypto/sha2.h"
 #include "services/network/public/mojom/url_response_head.mojom.h"
 
 namespace speedreader {
@@ -46,6 +51,17 @@ void MaybeSaveDistilledDataForDebug(const GURL& url,
 #endif
 }
 
+// The distilled output depends on the document and on the appearance settings
+// passed to the rewriter.
+std::string MakeDistilledPageCacheKey(const GURL& url,
+                                      const std::string& body,
+                                      const SpeedreaderService& service) {
+  return base::StrCat({url.spec(), "|", service.GetThemeName(), "|",
+                       service.GetFontFamilyName(), "|",
+                       service.GetFontSizeName(), "|", service.GetColumnWidth(),
+                       "|", crypto::SHA256HashString(body)});
+}
+
 }  // namespace
 
 SpeedreaderBodyDistiller::SpeedreaderBodyDistiller(
@@ -96,6 +112,7 @@ bool SpeedreaderBodyDistiller::ShouldProcess(
   *defer = true;
 
   response_url_ = response_url;
+  response_started_ = base::TimeTicks::Now();
   return true;
 }
 
@@ -114,6 +131,9 @@ void SpeedreaderBodyDistiller::OnComplete() {
 SpeedreaderBodyDistiller::Action SpeedreaderBodyDistiller::OnBodyUpdated(
     const std::string& body,
     bool is_complete) {
+  if (features::kSpeedreaderStreamingDistillation.Get()) {
+    WriteToStreamingDistiller(body);
+  }
   return is_complete ? SpeedreaderBodyDistiller::Action::kComplete
                      : SpeedreaderBodyDistiller::Action::kContinue;
 }
@@ -129,30 +149,103 @@ void SpeedreaderBodyDistiller::Transform(
     return std::move(on_complete).Run(std::move(body));
   }
 
+  if (features::kSpeedreaderDistillationCacheSize.Get() > 0) {
+    cache_key_ =
+        MakeDistilledPageCacheKey(response_url_, body, *speedreader_service_);
+    auto cached = speedreader_service_->GetCachedDistilledPage(cache_key_);
+    if (cached) {
+      streaming_distiller_.Reset();
+      distillation_result_ = DistillationResult::kSuccess;
+      std::move(on_complete)
+          .Run(rewriter_service_->GetContentStylesheet() + *cached);
+      return;
+    }
+  }
+
+  if (streaming_distiller_) {
+    WriteToStreamingDistiller(body);
+    streaming_distiller_.AsyncCall(&StreamingDistiller::Finish)
+        .Then(base::BindOnce(
+            &SpeedreaderBodyDistiller::OnStreamingDistillationFinished,
+            weak_factory_.GetWeakPtr(), std::move(body),
+            std::move(on_complete)));
+    return;
+  }
+
   speedreader::DistillPage(
       response_url_, std::move(body), speedreader_service_, rewriter_service_,
-      base::BindOnce(
-          [](base::WeakPtr<SpeedreaderBodyDistiller> self, const GURL& url,
-             const std::string& stylesheet,
-             base::OnceCallback<void(std::string)> on_complete,
-             speedreader::DistillationResult result, std::string original_data,
-             std::string transformed) {
-            if (!self) {
-              return;
-            }
-
-            self->distillation_result_ = result;
-
-            if (result == speedreader::DistillationResult::kSuccess) {
-              MaybeSaveDistilledDataForDebug(url, original_data, stylesheet,
-                                             transformed);
-              std::move(on_complete).Run(stylesheet + std::move(transformed));
-            } else {
-              std::move(on_complete).Run(original_data);
-            }
-          },
-          weak_factory_.GetWeakPtr(), response_url_,
-          rewriter_service_->GetContentStylesheet(), std::move(on_complete)));
+      base::BindOnce(&SpeedreaderBodyDistiller::OnDistillationComplete,
+                     weak_factory_.GetWeakPtr(), std::move(on_complete)));
+}
+
+void SpeedreaderBodyDistiller::WriteToStreamingDistiller(
+    const std::string& body) {
+  if (streaming_failed_ || body.size() <= bytes_streamed_) {
+    return;
+  }
+
+  if (!streaming_distiller_) {
+    auto rewriter = rewriter_service_->MakeRewriter(
+        response_url_, speedreader_service_->GetThemeName(),
+        speedreader_service_->GetFontFamilyName(),
+        speedreader_service_->GetFontSizeName(),
+        speedreader_service_->GetColumnWidth());
+    if (!rewriter) {
+      // Fall back to distilling the complete body in Transform().
+      streaming_failed_ = true;
+      return;
+    }
+    streaming_distiller_ = base::SequenceBound<StreamingDistiller>(
+        base::ThreadPool::CreateSequencedTaskRunner(
+            {base::TaskPriority::USER_BLOCKING, base::MayBlock()}),
+        std::move(rewriter));
+  }
+
+  streaming_distiller_.AsyncCall(&StreamingDistiller::Write)
+      .WithArgs(body.substr(bytes_streamed_));
+  bytes_streamed_ = body.size();
+}
+
+void SpeedreaderBodyDistiller::OnStreamingDistillationFinished(
+    std::string body,
+    base::OnceCallback<void(std::string)> on_complete,
+    std::string transformed) {
+  streaming_distiller_.Reset();
+  const DistillationResult result = transformed.empty()
+                                        ? DistillationResult::kFail
+                                        : DistillationResult::kSuccess;
+  OnDistillationComplete(std::move(on_complete), result, std::move(body),
+                         std::move(transformed));
+}
+
+void SpeedreaderBodyDistiller::OnDistillationComplete(
+    base::OnceCallback<void(std::string)> on_complete,
+    DistillationResult result,
+    std::string original_data,
+    std::string transformed) {
+  distillation_result_ = result;
+
+  if (result != DistillationResult::kSuccess) {
+    std::move(on_complete).Run(std::move(original_data));
+    return;
+  }
+
+  // Time from the response start until the distilled document is handed to
+  // the renderer, split by the distillation mode to compare them.
+  base::UmaHistogramMediumTimes(
+      features::kSpeedreaderStreamingDistillation.Get()
+          ? "Brave.Speedreader.TimeToDistilledOutput.Streaming"
+          : "Brave.Speedreader.TimeToDistilledOutput.Buffered",
+      base::TimeTicks::Now() - response_started_);
+
+  if (!cache_key_.empty()) {
+    speedreader_service_->CacheDistilledPage(cache_key_, transformed);
+  }
+
+  const std::string& stylesheet = rewriter_service_->GetContentStylesheet();
+  MaybeSaveDistilledDataForDebug(response_url_, original_data, stylesheet,
+                                 transformed);
+  std::move(on_complete).Run(stylesheet + std::move(transformed));
 }
 
 void SpeedreaderBodyDistiller::UpdateResponseHead(
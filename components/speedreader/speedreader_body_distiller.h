@@ -11,6 +11,8 @@
 
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/threading/sequence_bound.h"
+#include "base/time/time.h"
 #include "brave/components/body_sniffer/body_sniffer_url_loader.h"
 #include "url/gurl.h"
 
@@ -21,6 +23,7 @@ enum class DistillationResult : int;
 class SpeedreaderRewriterService;
 class SpeedreaderService;
 class SpeedreaderDelegate;
+class StreamingDistiller;
 
 class SpeedreaderBodyDistiller : public body_sniffer::BodyHandler {
  public:
@@ -51,7 +54,30 @@ class SpeedreaderBodyDistiller : public body_sniffer::BodyHandler {
       SpeedreaderService* speedreader_service,
       base::WeakPtr<SpeedreaderDelegate> speedreader_delegate);
 
+  // Passes the bytes of |body| that have not been written yet to the
+  // streaming distiller, creating it on first use.
+  void WriteToStreamingDistiller(const std::string& body);
+
+  void OnStreamingDistillationFinished(
+      std::string body,
+      base::OnceCallback<void(std::string)> on_complete,
+      std::string transformed);
+
+  void OnDistillationComplete(base::OnceCallback<void(std::string)> on_complete,
+                              DistillationResult result,
+                              std::string original_data,
+                              std::string transformed);
+
   GURL response_url_;
+  base::TimeTicks response_started_;
+  // Key of the distilled page cache entry for the response, if the cache is
+  // enabled.
+  std::string cache_key_;
+
+  // Only used when streaming distillation is enabled.
+  base::SequenceBound<StreamingDistiller> streaming_distiller_;
+  bool streaming_failed_ = false;
+  size_t bytes_streamed_ = 0;
 
   // Not Owned
   raw_ptr<SpeedreaderRewriterService> rewriter_service_ = nullptr;
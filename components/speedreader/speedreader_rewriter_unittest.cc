@@ -3,6 +3,7 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <algorithm>
 #include <string>
 
 #include "base/dcheck_is_on.h"
@@ -70,6 +71,8 @@ class SpeedreaderRewriterTestBase : public ::testing::Test {
 
   const base::FilePath& test_data_dir() const { return test_data_dir_; }
 
+  SpeedReader& speedreader() { return speedreader_; }
+
   void set_current_process_dir(const base::FilePath& path) {
     current_process_dir_ = path;
   }
@@ -154,6 +157,26 @@ TEST_F(SpeedreaderRewriterThemeTest, SetAll) {
   CheckContent(out, expected_file);
 }
 
+TEST_F(SpeedreaderRewriterThemeTest, ChunkedWrite) {
+  base::ScopedAllowBlockingForTesting allow_blocking;
+
+  // Streaming distillation writes the document as it is downloaded, which
+  // must produce the same output as writing it at once.
+  const std::string input_file = "meta_name_shortest_desc.html";
+  const auto file_content = GetFileContent(input_file);
+
+  auto rewriter = speedreader().MakeRewriter("https://test.com");
+  rewriter->SetMinOutLength(100);
+  constexpr size_t kChunkSize = 64;
+  for (size_t offset = 0; offset < file_content.size(); offset += kChunkSize) {
+    const size_t length = std::min(kChunkSize, file_content.size() - offset);
+    ASSERT_EQ(0, rewriter->Write(file_content.data() + offset, length));
+  }
+  rewriter->End();
+
+  EXPECT_EQ(ProcessPage(input_file), rewriter->GetOutput());
+}
+
 class SpeedreaderRewriterPagesTest
     : public SpeedreaderRewriterTestBase,
       public ::testing::WithParamInterface<const char*> {
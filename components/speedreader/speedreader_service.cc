@@ -5,7 +5,9 @@
 
 #include "brave/components/speedreader/speedreader_service.h"
 
+#include <algorithm>
 #include <string>
+#include <utility>
 
 #include "base/check.h"
 #include "base/command_line.h"
@@ -44,7 +46,9 @@ SpeedreaderService::SpeedreaderService(content::BrowserContext* browser_context,
     : browser_context_(browser_context),
       content_rules_(content_rules),
       prefs_(user_prefs::UserPrefs::Get(browser_context_)),
-      metrics_(local_state, content_rules_, IsAllowedForAllReadableSites()) {
+      metrics_(local_state, content_rules_, IsAllowedForAllReadableSites()),
+      distilled_page_cache_(
+          std::max(features::kSpeedreaderDistillationCacheSize.Get(), 1)) {
   DCHECK(base::FeatureList::IsEnabled(features::kSpeedreaderFeature));
 }
 
@@ -302,6 +306,23 @@ std::string SpeedreaderService::GetFontFamilyName() const {
   }
 }
 
+std::optional<std::string> SpeedreaderService::GetCachedDistilledPage(
+    const std::string& key) {
+  auto it = distilled_page_cache_.Get(key);
+  if (it == distilled_page_cache_.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+void SpeedreaderService::CacheDistilledPage(const std::string& key,
+                                            std::string distilled) {
+  if (features::kSpeedreaderDistillationCacheSize.Get() <= 0) {
+    return;
+  }
+  distilled_page_cache_.Put(key, std::move(distilled));
+}
+
 std::string SpeedreaderService::GetColumnWidth() const {
   switch (GetAppearanceSettings().columnWidth) {
     case ColumnWidth::kNarrow:
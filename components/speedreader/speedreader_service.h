@@ -6,8 +6,10 @@
 #ifndef BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_SERVICE_H_
 #define BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_SERVICE_H_
 
+#include <optional>
 #include <string>
 
+#include "base/containers/lru_cache.h"
 #include "base/memory/raw_ptr.h"
 #include "base/observer_list.h"
 #include "brave/components/speedreader/common/speedreader_toolbar.mojom.h"
@@ -98,6 +100,12 @@ class SpeedreaderService : public KeyedService {
 
   SpeedreaderMetrics& metrics() { return metrics_; }
 
+  // Recently distilled documents, so that going back to or reloading an
+  // unchanged article does not run the distillation again. |key| identifies
+  // the response and the appearance settings it was distilled with.
+  std::optional<std::string> GetCachedDistilledPage(const std::string& key);
+  void CacheDistilledPage(const std::string& key, std::string distilled);
+
   SpeedreaderService(const SpeedreaderService&) = delete;
   SpeedreaderService& operator=(const SpeedreaderService&) = delete;
 
@@ -112,6 +120,7 @@ class SpeedreaderService : public KeyedService {
   raw_ptr<PrefService> prefs_ = nullptr;
   base::ObserverList<Observer> observers_;
   SpeedreaderMetrics metrics_;
+  base::LRUCache<std::string, std::string> distilled_page_cache_;
 };
 
 }  // namespace speedreader
@@ -122,6 +122,33 @@ TEST_F(SpeedreaderServiceTest, OverrideSiteSettingsAllSitesEnabled) {
   }
 }
 
+TEST_F(SpeedreaderServiceTest, DistilledPageCacheDisabledByDefault) {
+  speedreader_service()->CacheDistilledPage("key", "distilled");
+  EXPECT_FALSE(speedreader_service()->GetCachedDistilledPage("key"));
+}
+
+class SpeedreaderDistilledPageCacheTest : public SpeedreaderServiceTest {
+ public:
+  SpeedreaderDistilledPageCacheTest() {
+    feature_list_.InitAndEnableFeatureWithParameters(
+        features::kSpeedreaderFeature, {{"distillation_cache_size", "2"}});
+  }
+
+ private:
+  base::test::ScopedFeatureList feature_list_;
+};
+
+TEST_F(SpeedreaderDistilledPageCacheTest, EvictsLeastRecentlyUsed) {
+  speedreader_service()->CacheDistilledPage("a", "distilled a");
+  speedreader_service()->CacheDistilledPage("b", "distilled b");
+  EXPECT_EQ("distilled a", speedreader_service()->GetCachedDistilledPage("a"));
+
+  speedreader_service()->CacheDistilledPage("c", "distilled c");
+  EXPECT_EQ("distilled a", speedreader_service()->GetCachedDistilledPage("a"));
+  EXPECT_FALSE(speedreader_service()->GetCachedDistilledPage("b"));
+  EXPECT_EQ("distilled c", speedreader_service()->GetCachedDistilledPage("c"));
+}
+
 class SpeedreaderPolicyTest : public testing::Test {
  public:
   SpeedreaderPolicyTest() {
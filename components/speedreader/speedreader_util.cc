@@ -6,6 +6,7 @@
 #include "brave/components/speedreader/speedreader_util.h"
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <variant>
 
@@ -154,6 +155,25 @@ bool Transit(State& state, const State& desired) {
 
 }  // namespace DistillStates
 
+namespace {
+
+// Completes the rewriting and returns the distilled document, or an empty
+// string if the result is unusable.
+std::string EndRewriting(Rewriter& rewriter) {
+  rewriter.End();
+  const std::string& transformed = rewriter.GetOutput();
+
+  // If the distillation failed, the rewriter returns an empty string. Also,
+  // if the output is too small, we assume that the content of the distilled
+  // page does not contain enough text to read.
+  if (transformed.length() < 1024) {
+    return std::string();
+  }
+  return transformed;
+}
+
+}  // namespace
+
 void DistillPage(const GURL& url,
                  std::string body,
                  SpeedreaderService* speedreader_service,
@@ -174,16 +194,12 @@ void DistillPage(const GURL& url,
       return {DistillationResult::kFail, std::move(data), std::string()};
     }
 
-    rewriter->End();
-    const std::string& transformed = rewriter->GetOutput();
-
-    // If the distillation failed, the rewriter returns an empty string. Also,
-    // if the output is too small, we assume that the content of the distilled
-    // page does not contain enough text to read.
-    if (transformed.length() < 1024) {
+    std::string transformed = EndRewriting(*rewriter);
+    if (transformed.empty()) {
       return {DistillationResult::kFail, std::move(data), std::string()};
     }
-    return {DistillationResult::kSuccess, std::move(data), transformed};
+    return {DistillationResult::kSuccess, std::move(data),
+            std::move(transformed)};
   };
 
   auto return_result = [](DistillationResultCallback callback, Result r) {
@@ -207,4 +223,28 @@ void DistillPage(const GURL& url,
       base::BindOnce(return_result, std::move(callback)));
 }
 
+StreamingDistiller::StreamingDistiller(std::unique_ptr<Rewriter> rewriter)
+    : rewriter_(std::move(rewriter)) {
+  DCHECK(rewriter_);
+}
+
+StreamingDistiller::~StreamingDistiller() = default;
+
+void StreamingDistiller::Write(std::string chunk) {
+  if (failed_ || chunk.empty()) {
+    return;
+  }
+  SCOPED_UMA_HISTOGRAM_TIMER("Brave.Speedreader.DistillChunk");
+  // A non-zero return value means an error occurred.
+  failed_ = rewriter_->Write(chunk.c_str(), chunk.length()) != 0;
+}
+
+std::string StreamingDistiller::Finish() {
+  if (failed_) {
+    return std::string();
+  }
+  SCOPED_UMA_HISTOGRAM_TIMER("Brave.Speedreader.Distill");
+  return EndRewriting(*rewriter_);
+}
+
 }  // namespace speedreader
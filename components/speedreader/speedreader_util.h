@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_UTIL_H_
 #define BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_UTIL_H_
 
+#include <memory>
 #include <string>
 #include <variant>
 
@@ -14,6 +15,7 @@
 
 namespace speedreader {
 
+class Rewriter;
 class SpeedreaderService;
 class SpeedreaderRewriterService;
 
@@ -104,6 +106,28 @@ void DistillPage(const GURL& url,
                  SpeedreaderRewriterService* rewriter_service,
                  DistillationResultCallback callback);
 
+// Feeds a document to the rewriter chunk by chunk while it is still being
+// downloaded, so that parsing overlaps with the network. Must be used on a
+// single sequence that allows blocking.
+class StreamingDistiller {
+ public:
+  explicit StreamingDistiller(std::unique_ptr<Rewriter> rewriter);
+  ~StreamingDistiller();
+
+  StreamingDistiller(const StreamingDistiller&) = delete;
+  StreamingDistiller& operator=(const StreamingDistiller&) = delete;
+
+  void Write(std::string chunk);
+
+  // Returns the distilled document, or an empty string if the document could
+  // not be distilled.
+  std::string Finish();
+
+ private:
+  std::unique_ptr<Rewriter> rewriter_;
+  bool failed_ = false;
+};
+
 }  // namespace speedreader
 
 #endif  // BRAVE_COMPONENTS_SPEEDREADER_SPEEDREADER_UTIL_H_
@@ -61,49 +61,58 @@ TimePeriodStorage::TimePeriodStorage(PrefService* prefs,
 TimePeriodStorage::~TimePeriodStorage() = default;
 
 void TimePeriodStorage::AddDelta(uint64_t delta) {
-  FilterToPeriod();
-  daily_values_.front().value += delta;
-  Save();
+  bool changed = FilterToPeriod();
+  if (delta > 0) {
+    daily_values_.front().value += delta;
+    changed = true;
+  }
+  SaveIfChanged(changed);
 }
 
 void TimePeriodStorage::SubDelta(uint64_t delta) {
-  FilterToPeriod();
+  bool changed = FilterToPeriod();
   for (DailyValue& daily_value : daily_values_) {
     if (delta == 0) {
       break;
     }
     uint64_t day_delta = std::min(daily_value.value, delta);
-    daily_value.value -= day_delta;
-    delta -= day_delta;
+    if (day_delta > 0) {
+      daily_value.value -= day_delta;
+      delta -= day_delta;
+      changed = true;
+    }
   }
-  Save();
+  SaveIfChanged(changed);
 }
 
 void TimePeriodStorage::ReplaceTodaysValueIfGreater(uint64_t value) {
-  FilterToPeriod();
+  bool changed = FilterToPeriod();
   DailyValue& today = daily_values_.front();
   if (today.value < value) {
     today.value = value;
+    changed = true;
   }
-  Save();
+  SaveIfChanged(changed);
 }
 
 void TimePeriodStorage::ReplaceIfGreaterForDate(const base::Time& date,
                                                 uint64_t value) {
-  FilterToPeriod();
+  bool changed = FilterToPeriod();
   base::Time date_mn = date.LocalMidnight();
-  std::list<DailyValue>::iterator day_insert_it = std::ranges::find_if(
+  auto day_insert_it = std::ranges::find_if(
       daily_values_,
       [date_mn](const DailyValue& val) { return val.day <= date_mn; });
   if (day_insert_it != daily_values_.end() && day_insert_it->day == date_mn) {
     // update daily value if it exists for date
     if (value > day_insert_it->value) {
       day_insert_it->value = value;
+      changed = true;
     }
   } else {
     daily_values_.insert(day_insert_it, {date_mn, value});
+    changed = true;
   }
-  Save();
+  SaveIfChanged(changed);
 }
 
 uint64_t TimePeriodStorage::GetPeriodSumInTimeRange(
@@ -132,30 +141,21 @@ uint64_t TimePeriodStorage::GetPeriodSum() const {
 uint64_t TimePeriodStorage::GetHighestValueInPeriod() const {
   // We record only value for last N days.
   const base::Time n_days_ago = clock_->Now() - base::Days(period_days_);
-  std::list<DailyValue> in_period_daily_values(daily_values_.size());
-  auto copied_it =
-      std::copy_if(daily_values_.begin(), daily_values_.end(),
-                   in_period_daily_values.begin(),
-                   [n_days_ago](auto i) { return i.day > n_days_ago; });
-  in_period_daily_values.resize(
-      std::distance(in_period_daily_values.begin(), copied_it));
-
-  auto highest_it = std::max_element(in_period_daily_values.begin(),
-                                     in_period_daily_values.end(),
-                                     [](const auto& left, const auto& right) {
-                                       return left.value < right.value;
-                                     });
-  if (highest_it == in_period_daily_values.end()) {
-    return 0;
+  uint64_t highest_value = 0;
+  for (const auto& daily_value : daily_values_) {
+    if (daily_value.day > n_days_ago) {
+      highest_value = std::max(highest_value, daily_value.value);
+    }
   }
-  return highest_it->value;
+  return highest_value;
 }
 
 bool TimePeriodStorage::IsOnePeriodPassed() const {
   return daily_values_.size() == period_days_;
 }
 
-void TimePeriodStorage::FilterToPeriod() {
+bool TimePeriodStorage::FilterToPeriod() {
+  bool days_added = false;
   base::Time now_midnight = clock_->Now().LocalMidnight();
   base::Time last_saved_midnight;
 
@@ -176,6 +176,7 @@ void TimePeriodStorage::FilterToPeriod() {
       day_midnight = now_midnight;
     }
     daily_values_.push_front({day_midnight, 0});
+    days_added = true;
     if (daily_values_.size() > period_days_) {
       daily_values_.pop_back();
     }
@@ -186,6 +187,7 @@ void TimePeriodStorage::FilterToPeriod() {
       break;
     }
   }
+  return days_added;
 }
 
 void TimePeriodStorage::Load() {
@@ -217,13 +219,15 @@ void TimePeriodStorage::Load() {
   }
 }
 
-void TimePeriodStorage::Save() {
+void TimePeriodStorage::SaveIfChanged(bool changed) {
   DCHECK(!daily_values_.empty());
   DCHECK_LE(daily_values_.size(), period_days_);
+  if (!changed) {
+    return;
+  }
 
   base::Value::List list;
-  // TODO(iefremov): Optimize if needed.
-  list.clear();
+  list.reserve(daily_values_.size());
   for (const auto& u : daily_values_) {
     base::Value::Dict value;
     value.Set("day", u.day.InSecondsFSinceUnixEpoch());
@@ -6,9 +6,9 @@
 #ifndef BRAVE_COMPONENTS_TIME_PERIOD_STORAGE_TIME_PERIOD_STORAGE_H_
 #define BRAVE_COMPONENTS_TIME_PERIOD_STORAGE_TIME_PERIOD_STORAGE_H_
 
-#include <list>
 #include <memory>
 
+#include "base/containers/circular_deque.h"
 #include "base/memory/raw_ptr.h"
 #include "base/time/time.h"
 
@@ -63,16 +63,19 @@ class TimePeriodStorage {
     base::Time day;
     uint64_t value = 0ull;
   };
-  void FilterToPeriod();
+  // Returns true if days were added to `daily_values_`.
+  bool FilterToPeriod();
   void Load();
-  void Save();
+  // Only writes the pref if `changed` is true.
+  void SaveIfChanged(bool changed);
 
   const raw_ptr<PrefService> prefs_;
   const char* pref_name_ = nullptr;
   const char* dict_key_ = nullptr;
   size_t period_days_;
 
-  std::list<DailyValue> daily_values_;
+  // Most recent day first, holds at most `period_days_` values.
+  base::circular_deque<DailyValue> daily_values_;
 };
 
 #endif  // BRAVE_COMPONENTS_TIME_PERIOD_STORAGE_TIME_PERIOD_STORAGE_H_
@@ -0,0 +1,18 @@
+/* Copyright (c) 2025 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/tor/features.h"
+
+namespace tor::features {
+
+BASE_FEATURE(kBraveTorPrewarm, base::FEATURE_DISABLED_BY_DEFAULT);
+
+BASE_FEATURE_PARAM(base::TimeDelta,
+                   kBraveTorPrewarmTimeout,
+                   &kBraveTorPrewarm,
+                   "prewarm_timeout",
+                   base::Minutes(5));
+
+}  // namespace tor::features
@@ -0,0 +1,26 @@
+/* Copyright (c) 2025 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_TOR_FEATURES_H_
+#define BRAVE_COMPONENTS_TOR_FEATURES_H_
+
+#include "base/feature_list.h"
+#include "base/metrics/field_trial_params.h"
+#include "base/time/time.h"
+
+namespace tor::features {
+
+// Starts Tor in the background when the user is about to open a Tor window,
+// e.g. when the "New private window with Tor" menu item is highlighted, so
+// that the window can be connected by the time it opens.
+BASE_DECLARE_FEATURE(kBraveTorPrewarm);
+
+// How long a prewarmed Tor process is kept running if no Tor window is
+// opened.
+BASE_DECLARE_FEATURE_PARAM(base::TimeDelta, kBraveTorPrewarmTimeout);
+
+}  // namespace tor::features
+
+#endif  // BRAVE_COMPONENTS_TOR_FEATURES_H_
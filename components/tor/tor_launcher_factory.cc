@@ -12,6 +12,7 @@
 #include "base/functional/bind.h"
 #include "base/functional/callback_helpers.h"
 #include "base/logging.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/no_destructor.h"
 #include "base/task/bind_post_task.h"
 #include "base/task/sequenced_task_runner.h"
@@ -33,6 +34,7 @@ constexpr char kStatusSummary[] = "SUMMARY=";
 constexpr char kCount[] = "COUNT=";
 constexpr char kStatusClientCircuitEstablished[] = "CIRCUIT_ESTABLISHED";
 constexpr char kStatusClientCircuitNotEstablished[] = "CIRCUIT_NOT_ESTABLISHED";
+constexpr char kBootstrapDone[] = "100";
 
 std::string GetMessageParam(const std::string& message,
                             const std::string& key,
@@ -130,6 +132,8 @@ void TorLauncherFactory::LaunchTorInternal() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
   if (tor_launcher_.is_bound()) {
+    launch_requested_ = base::TimeTicks::Now();
+    launched_ = control_ready_ = bootstrapped_ = base::TimeTicks();
     auto config = tor::mojom::TorConfig::New(config_);
     tor_launcher_->Launch(std::move(config),
                           base::BindOnce(&TorLauncherFactory::OnTorLaunched,
@@ -248,8 +252,10 @@ void TorLauncherFactory::OnTorLaunched(bool result, int64_t pid) {
     // We have to wait for circuit established
     is_connected_ = false;
     tor_pid_ = pid;
+    launched_ = base::TimeTicks::Now();
   } else {
     LOG(ERROR) << "Tor Launching Failed(" << pid << ")";
+    launch_requested_ = base::TimeTicks();
     return;
   }
 
@@ -264,6 +270,9 @@ void TorLauncherFactory::OnTorLaunched(bool result, int64_t pid) {
 void TorLauncherFactory::OnTorControlReady() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   VLOG(2) << "TOR CONTROL: Ready!";
+  if (control_ready_.is_null()) {
+    control_ready_ = base::TimeTicks::Now();
+  }
   control_->GetVersion(
       base::BindPostTask(base::SequencedTaskRunner::GetCurrentDefault(),
                          base::BindOnce(&TorLauncherFactory::GotVersion,
@@ -340,6 +349,38 @@ void TorLauncherFactory::GotCircuitEstablished(bool error, bool established) {
   for (auto& observer : observers_) {
     observer.OnTorCircuitEstablished(true);
   }
+  MaybeNotifyStartupCompleted();
+}
+
+void TorLauncherFactory::MaybeNotifyStartupCompleted() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (launch_requested_.is_null() || launched_.is_null() ||
+      control_ready_.is_null()) {
+    return;
+  }
+
+  TorStartupTimings timings;
+  timings.launch = launched_ - launch_requested_;
+  timings.control_ready = control_ready_ - launch_requested_;
+  if (!bootstrapped_.is_null()) {
+    timings.bootstrap = bootstrapped_ - launch_requested_;
+  }
+  timings.first_circuit = base::TimeTicks::Now() - launch_requested_;
+  launch_requested_ = base::TimeTicks();
+
+  base::UmaHistogramMediumTimes("Brave.Tor.Startup.Launch", timings.launch);
+  base::UmaHistogramMediumTimes("Brave.Tor.Startup.ControlReady",
+                                timings.control_ready);
+  if (timings.bootstrap) {
+    base::UmaHistogramMediumTimes("Brave.Tor.Startup.Bootstrap",
+                                  *timings.bootstrap);
+  }
+  base::UmaHistogramMediumTimes("Brave.Tor.Startup.FirstCircuit",
+                                timings.first_circuit);
+
+  for (auto& observer : observers_) {
+    observer.OnTorStartupCompleted(timings);
+  }
 }
 
 void TorLauncherFactory::OnTorControlClosed(bool was_running) {
@@ -420,6 +461,9 @@ void TorLauncherFactory::OnTorEvent(
           GetMessageParam(initial, kStatusClientBootstrapProgress, false);
       const std::string& summary =
           GetMessageParam(initial, kStatusSummary, true);
+      if (percentage == kBootstrapDone && bootstrapped_.is_null()) {
+        bootstrapped_ = base::TimeTicks::Now();
+      }
 
       for (auto& observer : observers_) {
         last_init_message_ = {percentage, summary};
@@ -432,6 +476,7 @@ void TorLauncherFactory::OnTorEvent(
         observer.OnTorCircuitEstablished(true);
       }
       is_connected_ = true;
+      MaybeNotifyStartupCompleted();
     } else if (initial.find(kStatusClientCircuitNotEstablished) !=
                std::string::npos) {
       for (auto& observer : observers_) {
@@ -17,6 +17,7 @@
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
 #include "base/sequence_checker.h"
+#include "base/time/time.h"
 #include "brave/components/services/tor/public/interfaces/tor.mojom.h"
 #include "brave/components/tor/tor_control.h"
 #include "brave/components/tor/tor_utils.h"
@@ -90,6 +91,10 @@ class TorLauncherFactory : public tor::TorControl::Delegate {
   void GotSOCKSListeners(bool error, const std::vector<std::string>& listeners);
   void GotCircuitEstablished(bool error, bool established);
 
+  // Records the startup timings and notifies observers, if a launch is being
+  // timed.
+  void MaybeNotifyStartupCompleted();
+
   void LaunchTorInternal();
   void RelaunchTor();
   void DelayedRelaunchTor();
@@ -122,6 +127,13 @@ class TorLauncherFactory : public tor::TorControl::Delegate {
   };
   std::optional<InitializationMessage> last_init_message_;
 
+  // Startup milestones of the current launch. `launch_requested_` is reset
+  // once the first circuit has been established.
+  base::TimeTicks launch_requested_;
+  base::TimeTicks launched_;
+  base::TimeTicks control_ready_;
+  base::TimeTicks bootstrapped_;
+
   base::WeakPtrFactory<TorLauncherFactory> weak_ptr_factory_{this};
 };
 
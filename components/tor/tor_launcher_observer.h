@@ -6,9 +6,25 @@
 #ifndef BRAVE_COMPONENTS_TOR_TOR_LAUNCHER_OBSERVER_H_
 #define BRAVE_COMPONENTS_TOR_TOR_LAUNCHER_OBSERVER_H_
 
+#include <optional>
 #include <string>
 
 #include "base/observer_list_types.h"
+#include "base/time/time.h"
+
+// Durations of the Tor startup milestones, each measured from the moment the
+// Tor process launch was requested.
+struct TorStartupTimings {
+  // The Tor process was started.
+  base::TimeDelta launch;
+  // The control channel was connected and authenticated.
+  base::TimeDelta control_ready;
+  // Bootstrapping reached 100%. Not set if the progress was not reported
+  // while the control channel was open.
+  std::optional<base::TimeDelta> bootstrap;
+  // The first circuit was established.
+  base::TimeDelta first_circuit;
+};
 
 class TorLauncherObserver : public base::CheckedObserver {
  public:
@@ -24,6 +40,8 @@ class TorLauncherObserver : public base::CheckedObserver {
                                  const std::string& message) {}
   virtual void OnTorControlEvent(const std::string& event) {}
   virtual void OnTorLogUpdated() {}
+  // Called once per launch, when the first circuit is established.
+  virtual void OnTorStartupCompleted(const TorStartupTimings& timings) {}
 };
 
 #endif  // BRAVE_COMPONENTS_TOR_TOR_LAUNCHER_OBSERVER_H_
@@ -409,6 +409,15 @@ void TorProfileServiceImpl::OnTorNewProxyURI(const std::string& uri) {
   proxy_config_service_->UpdateProxyURI(uri);
 }
 
+void TorProfileServiceImpl::OnTorStartupCompleted(
+    const TorStartupTimings& timings) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  VLOG(1) << "Tor startup: launch " << timings.launch << ", control ready "
+          << timings.control_ready << ", bootstrap "
+          << timings.bootstrap.value_or(base::TimeDelta()) << ", first circuit "
+          << timings.first_circuit;
+}
+
 std::unique_ptr<net::ProxyConfigService>
 TorProfileServiceImpl::CreateProxyConfigService() {
   // First tor profile will have empty proxy uri but it will receive update from
@@ -62,6 +62,7 @@ class TorProfileServiceImpl
   // TorLauncherObserver:
   void OnTorControlReady() override;
   void OnTorNewProxyURI(const std::string& uri) override;
+  void OnTorStartupCompleted(const TorStartupTimings& timings) override;
 
  private:
   void LaunchTor();
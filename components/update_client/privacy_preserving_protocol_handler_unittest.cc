@@ -14,4 +14,9 @@ TEST(PrivacyPreservingProtocolSerializer, StripsPrivacySensitiveData) {
       StripsPrivacySensitiveData(PrivacyPreservingProtocolSerializer()));
 }
 
+TEST(PrivacyPreservingProtocolSerializer, KeepsDifferentialUpdateData) {
+  EXPECT_TRUE(
+      KeepsDifferentialUpdateData(PrivacyPreservingProtocolSerializer()));
+}
+
 }  // namespace update_client
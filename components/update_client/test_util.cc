@@ -83,4 +83,29 @@ bool StripsPrivacySensitiveData(const ProtocolSerializer& serializer) {
   return RE2::FullMatch(request_str, regex);
 }
 
+// Differential updates are only offered when the request lists the hashes of
+// the CRXs the client has cached, so those must survive serialization.
+bool KeepsDifferentialUpdateData(const ProtocolSerializer& serializer) {
+  auto pref = std::make_unique<TestingPrefServiceSimple>();
+  RegisterPersistedDataPrefs(pref->registry());
+  auto metadata = CreatePersistedData(
+      base::BindRepeating([](PrefService* pref) { return pref; }, pref.get()),
+      nullptr);
+
+  std::vector<protocol_request::App> apps;
+  apps.push_back(MakeProtocolApp(
+      "id1", base::Version("1.0"), "ap1", "BRND", "ins_id", "lang", -1,
+      "source1", "location1", {}, "c1", "ch1", "cn1", "test", {},
+      /*cached_hashes=*/{"hash1"},
+      MakeProtocolUpdateCheck(false, "", false, false), {},
+      MakeProtocolPing("id1", metadata.get(), {}), {}));
+
+  const auto request = MakeProtocolRequest(
+      false, "{15160585-8ADE-4D3C-839B-1281A6035D1F}", "prod_id", "1.0",
+      "channel", "OS", "cacheable", std::nullopt, {}, {}, std::move(apps));
+
+  return RE2::PartialMatch(serializer.Serialize(request),
+                           R"("cached_hashes":\["hash1"\])");
+}
+
 }  // namespace update_client
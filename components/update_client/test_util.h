@@ -12,6 +12,8 @@ namespace update_client {
 
 bool StripsPrivacySensitiveData(const ProtocolSerializer& serializer);
 
+bool KeepsDifferentialUpdateData(const ProtocolSerializer& serializer);
+
 }  // namespace update_client
 
 #endif  // BRAVE_COMPONENTS_UPDATE_CLIENT_TEST_UTIL_H_
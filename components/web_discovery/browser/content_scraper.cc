@@ -6,8 +6,10 @@
 #include "brave/components/web_discovery/browser/content_scraper.h"
 
 #include <algorithm>
+#include <tuple>
 #include <utility>
 
+#include "base/containers/flat_map.h"
 #include "base/json/json_reader.h"
 #include "base/json/json_writer.h"
 #include "base/strings/string_split.h"
@@ -116,25 +118,14 @@ class ContentScraperImpl : public ContentScraper {
     auto interim_result =
         std::make_unique<PageScrapeResult>(url, url_details->id);
 
-    std::vector<mojom::SelectRequestPtr> select_requests;
-    for (const auto& [selector, group] : url_details->scrape_rule_groups) {
-      auto select_request = mojom::SelectRequest::New();
-      select_request->root_selector = selector;
-      for (const auto& [report_key, rule] : group) {
-        if (rule->rule_type == ScrapeRuleType::kStandard) {
-          ProcessStandardRule(report_key, *rule, selector, url,
-                              interim_result.get());
-          continue;
-        }
-        auto attribute_request = mojom::SelectAttributeRequest::New();
-        attribute_request->sub_selector = rule->sub_selector;
-        attribute_request->attribute = rule->attribute;
-        attribute_request->key = report_key;
+    const auto& compiled_requests = GetCompiledRequests(*url_details);
+    ProcessStandardRules(compiled_requests, url, interim_result.get());
 
-        select_request->attribute_requests.push_back(
-            std::move(attribute_request));
-      }
-      select_requests.push_back(std::move(select_request));
+    std::vector<mojom::SelectRequestPtr> select_requests;
+    select_requests.reserve(compiled_requests.renderer_select_requests.size());
+    for (const auto& select_request :
+         compiled_requests.renderer_select_requests) {
+      select_requests.push_back(select_request.Clone());
     }
 
     document_extractor->QueryElementAttributes(
@@ -157,16 +148,66 @@ class ContentScraperImpl : public ContentScraper {
     }
     auto interim_result = std::move(prev_result);
 
+    const auto& compiled_requests = GetCompiledRequests(*url_details);
+    ProcessStandardRules(compiled_requests, url, interim_result.get());
+
+    sequenced_task_runner_->PostTaskAndReplyWithResult(
+        FROM_HERE,
+        base::BindOnce(&query_element_attributes, std::move(html),
+                       compiled_requests.select_requests),
+        base::BindOnce(&ContentScraperImpl::OnBrowserParsedElementAttributes,
+                       weak_ptr_factory_.GetWeakPtr(), is_strict_scrape,
+                       std::move(interim_result), std::move(callback)));
+  }
+
+  void OnPatternsLoaded() override { compiled_requests_.clear(); }
+
+ private:
+  // Requests derived from the scrape rules of a URL pattern, shared by the
+  // renderer scrape and the double fetch scrape.
+  struct CompiledRequests {
+    CompiledRequests() = default;
+    ~CompiledRequests() = default;
+
+    CompiledRequests(const CompiledRequests&) = delete;
+    CompiledRequests& operator=(const CompiledRequests&) = delete;
+
+    // Report keys, rules and root selectors of the standard rules, which
+    // are not retrieved from the DOM.
+    std::vector<std::tuple<std::string, raw_ptr<const ScrapeRule>,
+                           std::string>>
+        standard_rules;
+    std::vector<mojom::SelectRequestPtr> renderer_select_requests;
     std::vector<SelectRequest> select_requests;
-    for (const auto& [selector, group] : url_details->scrape_rule_groups) {
+  };
+
+  const CompiledRequests& GetCompiledRequests(
+      const PatternsURLDetails& url_details) {
+    auto& compiled_requests = compiled_requests_[&url_details];
+    if (compiled_requests) {
+      return *compiled_requests;
+    }
+
+    compiled_requests = std::make_unique<CompiledRequests>();
+    for (const auto& [selector, group] : url_details.scrape_rule_groups) {
+      auto renderer_select_request = mojom::SelectRequest::New();
+      renderer_select_request->root_selector = selector;
       SelectRequest select_request;
       select_request.root_selector = selector;
       for (const auto& [report_key, rule] : group) {
         if (rule->rule_type == ScrapeRuleType::kStandard) {
-          ProcessStandardRule(report_key, *rule, selector, url,
-                              interim_result.get());
+          compiled_requests->standard_rules.emplace_back(report_key,
+                                                         rule.get(), selector);
           continue;
         }
+        auto renderer_attribute_request =
+            mojom::SelectAttributeRequest::New();
+        renderer_attribute_request->sub_selector = rule->sub_selector;
+        renderer_attribute_request->attribute = rule->attribute;
+        renderer_attribute_request->key = report_key;
+        renderer_select_request->attribute_requests.push_back(
+            std::move(renderer_attribute_request));
+
         SelectAttributeRequest attribute_request{
             .sub_selector = rule->sub_selector.value_or(""),
             .key = report_key,
@@ -175,18 +216,23 @@ class ContentScraperImpl : public ContentScraper {
         select_request.attribute_requests.push_back(
             std::move(attribute_request));
       }
-      select_requests.push_back(std::move(select_request));
+      compiled_requests->renderer_select_requests.push_back(
+          std::move(renderer_select_request));
+      compiled_requests->select_requests.push_back(std::move(select_request));
     }
+    return *compiled_requests;
+  }
 
-    sequenced_task_runner_->PostTaskAndReplyWithResult(
-        FROM_HERE,
-        base::BindOnce(&query_element_attributes, html, select_requests),
-        base::BindOnce(&ContentScraperImpl::OnBrowserParsedElementAttributes,
-                       weak_ptr_factory_.GetWeakPtr(), is_strict_scrape,
-                       std::move(interim_result), std::move(callback)));
+  void ProcessStandardRules(const CompiledRequests& compiled_requests,
+                            const GURL& url,
+                            PageScrapeResult* scrape_result) {
+    for (const auto& [report_key, rule, root_selector] :
+         compiled_requests.standard_rules) {
+      ProcessStandardRule(report_key, *rule, root_selector, url,
+                          scrape_result);
+    }
   }
 
- private:
   void ProcessStandardRule(const std::string& report_key,
                            const ScrapeRule& rule,
                            const std::string& root_selector,
@@ -336,6 +382,11 @@ class ContentScraperImpl : public ContentScraper {
 
   raw_ptr<const ServerConfigLoader> server_config_loader_;
 
+  // Keyed by the URL details of the last loaded patterns. Cleared whenever
+  // new patterns are loaded.
+  base::flat_map<const PatternsURLDetails*, std::unique_ptr<CompiledRequests>>
+      compiled_requests_;
+
   base::WeakPtrFactory<ContentScraperImpl> weak_ptr_factory_{this};
 };
 
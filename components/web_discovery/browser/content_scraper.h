@@ -74,6 +74,8 @@ class ContentScraper {
                                   std::unique_ptr<PageScrapeResult> prev_result,
                                   std::string html,
                                   PageScrapeResultCallback callback) = 0;
+  // Drops the scrape requests derived from the previously loaded patterns.
+  virtual void OnPatternsLoaded() = 0;
 };
 
 }  // namespace web_discovery
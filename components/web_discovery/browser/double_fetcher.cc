@@ -15,6 +15,7 @@
 #include "brave/components/web_discovery/browser/pref_names.h"
 #include "brave/components/web_discovery/browser/request_queue.h"
 #include "brave/components/web_discovery/browser/util.h"
+#include "brave/components/web_discovery/common/features.h"
 #include "components/prefs/pref_service.h"
 #include "net/http/http_status_code.h"
 #include "services/network/public/cpp/header_util.h"
@@ -97,7 +98,8 @@ void DoubleFetcher::OnFetchTimer(const base::Value& request_data) {
 
   GURL url(*url_str);
 
-  if (brave_search::IsBackupResultURLAllowed(url) &&
+  if (features::kShouldRenderDoubleFetchedSearchPages.Get() &&
+      brave_search::IsBackupResultURLAllowed(url) &&
       base::StartsWith(url.path(), kSearchPath)) {
     CHECK(backup_results_service_);
     backup_results_service_->FetchBackupResults(
@@ -12,8 +12,10 @@
 
 #include "base/functional/bind.h"
 #include "base/memory/scoped_refptr.h"
+#include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
 #include "brave/components/web_discovery/browser/web_discovery_service.h"
+#include "brave/components/web_discovery/common/features.h"
 #include "components/prefs/testing_pref_service.h"
 #include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
 #include "services/network/test/test_url_loader_factory.h"
@@ -23,6 +25,7 @@ namespace web_discovery {
 
 namespace {
 constexpr char kTestUrl[] = "https://example.com/test";
+constexpr char kTestSearchUrl[] = "https://www.google.com/search?q=test";
 constexpr char kTestResponseText[] = "<html><body>test</body></html>";
 }  // namespace
 
@@ -192,4 +195,23 @@ TEST_F(WebDiscoveryDoubleFetcherTest, ScheduleNoRetry) {
   EXPECT_TRUE(completed_fetches_.empty());
 }
 
+TEST_F(WebDiscoveryDoubleFetcherTest, FetchSearchPageWithoutRendering) {
+  base::test::ScopedFeatureList scoped_feature_list;
+  scoped_feature_list.InitAndEnableFeatureWithParameters(
+      features::kBraveWebDiscoveryNative,
+      {{"should_render_double_fetched_search_pages", "false"}});
+  url_loader_factory_.AddResponse(kTestSearchUrl, kTestResponseText);
+
+  // No backup results service is provided, so the page must be fetched
+  // without a background WebContents.
+  GURL url(kTestSearchUrl);
+  double_fetcher_->ScheduleDoubleFetch(url, base::Value("foo data"));
+
+  task_environment_.FastForwardBy(base::Seconds(70));
+  ASSERT_EQ(completed_fetches_.size(), 1u);
+  EXPECT_EQ(completed_fetches_[0].url, url);
+  ASSERT_TRUE(completed_fetches_[0].response_body);
+  EXPECT_EQ(*completed_fetches_[0].response_body, kTestResponseText);
+}
+
 }  // namespace web_discovery
@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <array>
+#include <utility>
 
 #include "base/base64.h"
 #include "base/check_op.h"
@@ -15,7 +16,6 @@
 #include "crypto/random.h"
 #include "crypto/sha2.h"
 #include "third_party/boringssl/src/include/openssl/aead.h"
-#include "third_party/boringssl/src/include/openssl/ec.h"
 #include "third_party/boringssl/src/include/openssl/ec_key.h"
 #include "third_party/boringssl/src/include/openssl/ecdh.h"
 #include "third_party/boringssl/src/include/openssl/nid.h"
@@ -47,27 +47,39 @@ AESEncryptResult::AESEncryptResult(const AESEncryptResult&) = default;
 AESEncryptResult& AESEncryptResult::operator=(const AESEncryptResult&) =
     default;
 
-std::optional<AESEncryptResult> DeriveAESKeyAndEncrypt(
-    base::span<uint8_t> server_pub_key,
-    base::span<uint8_t> data) {
-  bssl::UniquePtr<EC_KEY> client_private_key(
-      EC_KEY_new_by_curve_name(NID_X9_62_prime256v1));
-
-  if (!client_private_key) {
-    VLOG(1) << "Failed to init P-256 curve";
-    return std::nullopt;
-  }
-
+// static
+scoped_refptr<ECDHServerPublicKey> ECDHServerPublicKey::Import(
+    base::span<const uint8_t> server_pub_key) {
   bssl::UniquePtr<EC_POINT> server_public_point(EC_POINT_new(EC_group_p256()));
   if (!server_public_point) {
     VLOG(1) << "Failed to init EC public point";
-    return std::nullopt;
+    return nullptr;
   }
 
   if (!EC_POINT_oct2point(EC_group_p256(), server_public_point.get(),
                           server_pub_key.data(), server_pub_key.size(),
                           nullptr)) {
     VLOG(1) << "Failed to load server public key data into EC point";
+    return nullptr;
+  }
+
+  return base::WrapRefCounted(
+      new ECDHServerPublicKey(std::move(server_public_point)));
+}
+
+ECDHServerPublicKey::ECDHServerPublicKey(bssl::UniquePtr<EC_POINT> point)
+    : point_(std::move(point)) {}
+
+ECDHServerPublicKey::~ECDHServerPublicKey() = default;
+
+std::optional<AESEncryptResult> DeriveAESKeyAndEncrypt(
+    const ECDHServerPublicKey& server_pub_key,
+    base::span<uint8_t> data) {
+  bssl::UniquePtr<EC_KEY> client_private_key(
+      EC_KEY_new_by_curve_name(NID_X9_62_prime256v1));
+
+  if (!client_private_key) {
+    VLOG(1) << "Failed to init P-256 curve";
     return std::nullopt;
   }
 
@@ -78,7 +90,7 @@ std::optional<AESEncryptResult> DeriveAESKeyAndEncrypt(
 
   std::array<uint8_t, kKeyMaterialSize> shared_key_material;
   if (!ECDH_compute_key(shared_key_material.data(), shared_key_material.size(),
-                        server_public_point.get(), client_private_key.get(),
+                        server_pub_key.point(), client_private_key.get(),
                         nullptr)) {
     VLOG(1) << "Failed to set derive key via ECDH";
     return std::nullopt;
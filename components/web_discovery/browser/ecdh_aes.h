@@ -11,6 +11,8 @@
 #include <vector>
 
 #include "base/containers/span.h"
+#include "base/memory/ref_counted.h"
+#include "third_party/boringssl/src/include/openssl/ec.h"
 
 namespace web_discovery {
 
@@ -26,8 +28,33 @@ struct AESEncryptResult {
   std::string encoded_public_component_and_iv;
 };
 
+// An imported ECDH server public key, which can be reused for encrypting
+// multiple messages on any sequence.
+class ECDHServerPublicKey
+    : public base::RefCountedThreadSafe<ECDHServerPublicKey> {
+ public:
+  // Returns nullptr if the key is not a valid P-256 point.
+  static scoped_refptr<ECDHServerPublicKey> Import(
+      base::span<const uint8_t> server_pub_key);
+
+  ECDHServerPublicKey(const ECDHServerPublicKey&) = delete;
+  ECDHServerPublicKey& operator=(const ECDHServerPublicKey&) = delete;
+
+  const EC_POINT* point() const { return point_.get(); }
+
+ private:
+  friend class base::RefCountedThreadSafe<ECDHServerPublicKey>;
+
+  explicit ECDHServerPublicKey(bssl::UniquePtr<EC_POINT> point);
+  ~ECDHServerPublicKey();
+
+  bssl::UniquePtr<EC_POINT> point_;
+};
+
+// A fresh client key pair is generated for every message, so that messages
+// cannot be linked by their public component.
 std::optional<AESEncryptResult> DeriveAESKeyAndEncrypt(
-    base::span<uint8_t> server_pub_key,
+    const ECDHServerPublicKey& server_pub_key,
     base::span<uint8_t> data);
 
 }  // namespace web_discovery
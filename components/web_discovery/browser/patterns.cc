@@ -5,6 +5,7 @@
 
 #include "brave/components/web_discovery/browser/patterns.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "base/check.h"
@@ -14,6 +15,7 @@
 #include "base/logging.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/threading/thread_restrictions.h"
+#include "base/timer/elapsed_timer.h"
 #include "third_party/re2/src/re2/re2.h"
 
 namespace web_discovery {
@@ -256,6 +258,27 @@ std::optional<std::vector<PatternsURLDetails>> ParsePatternsURLDetails(
   return result;
 }
 
+std::unique_ptr<re2::RE2::Set> CompileURLRegexSet(
+    const std::vector<PatternsURLDetails>& patterns) {
+  if (patterns.empty()) {
+    return nullptr;
+  }
+  auto set = std::make_unique<re2::RE2::Set>(re2::RE2::DefaultOptions,
+                                             re2::RE2::UNANCHORED);
+  for (const auto& pattern : patterns) {
+    std::string error;
+    if (set->Add(pattern.url_regex->pattern(), &error) < 0) {
+      VLOG(1) << "Failed to add URL pattern to set: " << error;
+      return nullptr;
+    }
+  }
+  if (!set->Compile()) {
+    VLOG(1) << "Failed to compile URL pattern set";
+    return nullptr;
+  }
+  return set;
+}
+
 }  // namespace
 
 ScrapeRule::ScrapeRule() = default;
@@ -276,14 +299,44 @@ PatternsGroup::~PatternsGroup() = default;
 const PatternsURLDetails* PatternsGroup::GetMatchingURLPattern(
     const GURL& url,
     bool is_strict_scrape) const {
+  base::ElapsedTimer timer;
   const auto& patterns = is_strict_scrape ? strict_patterns : normal_patterns;
-  for (const auto& pattern : patterns) {
-    if (re2::RE2::PartialMatch(url.spec(), *pattern.url_regex) &&
-        !pattern.scrape_rule_groups.empty()) {
-      return &pattern;
+  const auto& url_regex_set =
+      is_strict_scrape ? strict_url_regex_set : normal_url_regex_set;
+  const PatternsURLDetails* result = nullptr;
+  if (url_regex_set) {
+    std::vector<int> matches;
+    if (url_regex_set->Match(url.spec(), &matches)) {
+      // The set reports matches in no particular order, while the first
+      // matching pattern in the list takes precedence.
+      std::sort(matches.begin(), matches.end());
+      for (int index : matches) {
+        const auto& pattern = patterns[index];
+        if (!pattern.scrape_rule_groups.empty()) {
+          result = &pattern;
+          break;
+        }
+      }
+    }
+  } else {
+    for (const auto& pattern : patterns) {
+      if (re2::RE2::PartialMatch(url.spec(), *pattern.url_regex) &&
+          !pattern.scrape_rule_groups.empty()) {
+        result = &pattern;
+        break;
+      }
     }
   }
-  return nullptr;
+  VLOG(2) << "Matched URL against " << patterns.size() << " patterns in "
+          << timer.Elapsed().InMicroseconds() << "us";
+  return result;
+}
+
+bool PatternsGroup::CompileURLRegexSets() {
+  normal_url_regex_set = CompileURLRegexSet(normal_patterns);
+  strict_url_regex_set = CompileURLRegexSet(strict_patterns);
+  return (normal_patterns.empty() || normal_url_regex_set) &&
+         (strict_patterns.empty() || strict_url_regex_set);
 }
 
 std::unique_ptr<PatternsGroup> ParsePatterns(std::string_view patterns_json) {
@@ -325,6 +378,9 @@ std::unique_ptr<PatternsGroup> ParsePatterns(std::string_view patterns_json) {
     }
     result->strict_patterns = std::move(*details);
   }
+  if (!result->CompileURLRegexSets()) {
+    VLOG(1) << "Falling back to matching URL patterns one by one";
+  }
   return result;
 }
 
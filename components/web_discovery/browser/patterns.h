@@ -13,12 +13,9 @@
 
 #include "base/containers/flat_map.h"
 #include "base/values.h"
+#include "third_party/re2/src/re2/set.h"
 #include "url/gurl.h"
 
-namespace re2 {
-class RE2;
-}  // namespace re2
-
 namespace web_discovery {
 
 enum class ScrapeRuleType {
@@ -155,6 +152,12 @@ struct PatternsGroup {
   const PatternsURLDetails* GetMatchingURLPattern(const GURL& url,
                                                   bool is_strict_scrape) const;
 
+  // Compiles the URL regexes of both pattern lists into multi-pattern sets,
+  // so that a URL can be matched against all of them in a single scan.
+  // Returns false if the sets could not be compiled, in which case
+  // `GetMatchingURLPattern` falls back to matching each regex in turn.
+  bool CompileURLRegexSets();
+
   // A list of URLs and rules used for scraping pages in the renderer,
   // pre-"double fetch". These rules typically scrape simple attributes which
   // are used to determine whether a page is private (i.e. the search query).
@@ -164,6 +167,11 @@ struct PatternsGroup {
   // search engine result pages, the rules will be used to retrieve the
   // search results and any other relevant details.
   std::vector<PatternsURLDetails> strict_patterns;
+
+  // Multi-pattern sets of the URL regexes in `normal_patterns` and
+  // `strict_patterns`. Indices of the set patterns match the list indices.
+  std::unique_ptr<re2::RE2::Set> normal_url_regex_set;
+  std::unique_ptr<re2::RE2::Set> strict_url_regex_set;
 };
 
 // Returns nullptr if parsing fails.
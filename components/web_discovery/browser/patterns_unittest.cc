@@ -336,6 +336,34 @@ TEST_F(WebDiscoveryPatternsTest, StrictPayloadRules) {
   EXPECT_TRUE(payload_rule->is_join);
 }
 
+TEST_F(WebDiscoveryPatternsTest, GetMatchingURLPattern) {
+  auto parsed_patterns = LoadAndParsePatterns();
+  ASSERT_TRUE(parsed_patterns);
+  EXPECT_TRUE(parsed_patterns->normal_url_regex_set);
+  EXPECT_TRUE(parsed_patterns->strict_url_regex_set);
+
+  auto check_matches = [&] {
+    const auto* normal_pattern = parsed_patterns->GetMatchingURLPattern(
+        GURL("https://search.example2.com/?q=test"), false);
+    ASSERT_TRUE(normal_pattern);
+    EXPECT_EQ(normal_pattern->id, "ex2");
+
+    const auto* strict_pattern = parsed_patterns->GetMatchingURLPattern(
+        GURL("https://example1.com/search?query=test"), true);
+    ASSERT_TRUE(strict_pattern);
+    EXPECT_EQ(strict_pattern->id, "ex1");
+
+    EXPECT_FALSE(parsed_patterns->GetMatchingURLPattern(
+        GURL("https://example3.com/"), false));
+  };
+  check_matches();
+
+  // Matching each regex in turn gives the same results.
+  parsed_patterns->normal_url_regex_set.reset();
+  parsed_patterns->strict_url_regex_set.reset();
+  check_matches();
+}
+
 TEST_F(WebDiscoveryPatternsTest, BadPatterns) {
   ASSERT_FALSE(ParsePatterns("ABC"));
   ASSERT_FALSE(ParsePatterns("{}"));
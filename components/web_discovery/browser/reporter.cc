@@ -105,7 +105,7 @@ base::Value GenerateFinalPayload(const base::Value::Dict& pre_payload) {
 
 std::optional<AESEncryptResult> CompressAndEncrypt(
     std::vector<uint8_t> full_signed_message,
-    std::vector<uint8_t> server_pub_key) {
+    scoped_refptr<ECDHServerPublicKey> server_pub_key) {
   base::AssertLongCPUWorkAllowed();
   uLongf compressed_data_size = compressBound(full_signed_message.size());
   std::vector<uint8_t> compressed_data(compressed_data_size + 2);
@@ -127,7 +127,7 @@ std::optional<AESEncryptResult> CompressAndEncrypt(
   std::ranges::copy(base::U16ToBigEndian(compressed_data_size),
                     compressed_data.data());
   compressed_data[0] |= kCompressedMessageId;
-  return DeriveAESKeyAndEncrypt(server_pub_key, compressed_data);
+  return DeriveAESKeyAndEncrypt(*server_pub_key, compressed_data);
 }
 
 }  // namespace
@@ -138,6 +138,9 @@ Reporter::Reporter(PrefService* profile_prefs,
                    const ServerConfigLoader* server_config_loader)
     : profile_prefs_(profile_prefs),
       shared_url_loader_factory_(shared_url_loader_factory),
+      encrypt_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::TaskPriority::BEST_EFFORT,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})),
       credential_signer_(credential_signer),
       server_config_loader_(server_config_loader),
       request_queue_(profile_prefs,
@@ -207,10 +210,8 @@ void Reporter::OnRequestSigned(std::string final_payload_json,
     request_queue_.NotifyRequestComplete(false);
     return;
   }
-  const auto& server_config = server_config_loader_->GetLastServerConfig();
-  auto pub_key =
-      server_config.pub_keys.find(FormatServerDate(base::Time::Now()));
-  if (pub_key == server_config.pub_keys.end()) {
+  auto server_pub_key = GetServerPublicKey();
+  if (!server_pub_key) {
     VLOG(1) << "No ECDH server public key available";
     request_queue_.NotifyRequestComplete(false);
     return;
@@ -227,14 +228,34 @@ void Reporter::OnRequestSigned(std::string final_payload_json,
     request_queue_.NotifyRequestComplete(true);
     return;
   }
-  base::ThreadPool::PostTaskAndReplyWithResult(
+  encrypt_task_runner_->PostTaskAndReplyWithResult(
       FROM_HERE,
-      base::BindOnce(&CompressAndEncrypt, full_signed_message, pub_key->second),
+      base::BindOnce(&CompressAndEncrypt, std::move(full_signed_message),
+                     std::move(server_pub_key)),
       base::BindOnce(&Reporter::OnRequestCompressedAndEncrypted,
                      weak_ptr_factory_.GetWeakPtr(), count_tag_hash,
                      basename_count));
 }
 
+scoped_refptr<ECDHServerPublicKey> Reporter::GetServerPublicKey() {
+  const auto& server_config = server_config_loader_->GetLastServerConfig();
+  auto date = FormatServerDate(base::Time::Now());
+  auto pub_key = server_config.pub_keys.find(date);
+  if (pub_key == server_config.pub_keys.end()) {
+    return nullptr;
+  }
+  // The key is only imported again once the date or the server config
+  // changes.
+  if (server_pub_key_ && server_pub_key_date_ == date &&
+      server_pub_key_data_ == pub_key->second) {
+    return server_pub_key_;
+  }
+  server_pub_key_ = ECDHServerPublicKey::Import(pub_key->second);
+  server_pub_key_date_ = std::move(date);
+  server_pub_key_data_ = pub_key->second;
+  return server_pub_key_;
+}
+
 void Reporter::OnRequestCompressedAndEncrypted(
     uint32_t count_tag_hash,
     size_t basename_count,
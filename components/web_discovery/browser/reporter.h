@@ -12,6 +12,8 @@
 #include <vector>
 
 #include "base/memory/raw_ptr.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/values.h"
 #include "brave/components/web_discovery/browser/credential_signer.h"
 #include "brave/components/web_discovery/browser/ecdh_aes.h"
@@ -64,12 +66,22 @@ class Reporter {
                          size_t basename_count,
                          scoped_refptr<net::HttpResponseHeaders> headers);
   bool ValidateResponse(scoped_refptr<net::HttpResponseHeaders> headers);
+  // Returns the imported server public key for the current date, or nullptr
+  // if there is none.
+  scoped_refptr<ECDHServerPublicKey> GetServerPublicKey();
 
   GURL submit_url_;
 
   raw_ptr<PrefService> profile_prefs_;
   raw_ptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
 
+  // Compression and encryption of messages run on this sequence.
+  scoped_refptr<base::SequencedTaskRunner> encrypt_task_runner_;
+
+  scoped_refptr<ECDHServerPublicKey> server_pub_key_;
+  std::string server_pub_key_date_;
+  std::vector<uint8_t> server_pub_key_data_;
+
   raw_ptr<CredentialSigner> credential_signer_;
   raw_ptr<const ServerConfigLoader> server_config_loader_;
 
@@ -10,7 +10,8 @@
 #include "base/json/values_util.h"
 #include "base/rand_util.h"
 #include "brave/components/web_discovery/browser/util.h"
-#include "components/prefs/scoped_user_pref_update.h"
+#include "brave/components/web_discovery/common/features.h"
+#include "components/prefs/pref_service.h"
 
 namespace web_discovery {
 
@@ -37,19 +38,25 @@ RequestQueue::RequestQueue(
       min_request_interval_(min_request_interval),
       max_request_interval_(max_request_interval),
       max_retries_(max_retries),
-      start_request_callback_(start_request_callback) {
+      start_request_callback_(start_request_callback),
+      requests_(profile_prefs_->GetList(list_pref_name_.value()).Clone()),
+      commit_delay_(features::kRequestQueueCommitDelay.Get()) {
   StartFetchTimer(false);
 }
 
-RequestQueue::~RequestQueue() = default;
+RequestQueue::~RequestQueue() {
+  if (commit_timer_.IsRunning()) {
+    CommitRequests();
+  }
+}
 
 void RequestQueue::ScheduleRequest(base::Value::Dict request_data) {
   base::Value::Dict fetch_dict;
   fetch_dict.Set(kDataKey, std::move(request_data));
   fetch_dict.Set(kRequestTimeKey, base::TimeToValue(base::Time::Now()));
 
-  ScopedListPrefUpdate update(profile_prefs_, list_pref_name_.value());
-  update->Append(std::move(fetch_dict));
+  requests_.Append(std::move(fetch_dict));
+  OnRequestsChanged();
 
   if (!fetch_timer_.IsRunning()) {
     StartFetchTimer(false);
@@ -59,8 +66,7 @@ void RequestQueue::ScheduleRequest(base::Value::Dict request_data) {
 std::optional<base::Value> RequestQueue::NotifyRequestComplete(bool success) {
   backoff_entry_.InformOfRequest(success);
 
-  ScopedListPrefUpdate update(profile_prefs_, list_pref_name_.value());
-  auto& request_dict = update->front().GetDict();
+  auto& request_dict = requests_.front().GetDict();
 
   std::optional<base::Value> removed_value;
   bool use_backoff_delta = false;
@@ -79,16 +85,17 @@ std::optional<base::Value> RequestQueue::NotifyRequestComplete(bool success) {
   if (should_remove) {
     auto* data = request_dict.Find(kDataKey);
     removed_value = data ? data->Clone() : base::Value();
-    update->erase(update->begin());
+    requests_.erase(requests_.begin());
   }
+  OnRequestsChanged();
 
   StartFetchTimer(use_backoff_delta);
   return removed_value;
 }
 
 void RequestQueue::OnFetchTimer() {
-  ScopedListPrefUpdate update(profile_prefs_, list_pref_name_.value());
-  for (auto it = update->begin(); it != update->end();) {
+  bool requests_changed = false;
+  for (auto it = requests_.begin(); it != requests_.end();) {
     const auto* fetch_dict = it->GetIfDict();
     const auto* request_time_value =
         fetch_dict ? fetch_dict->Find(kRequestTimeKey) : nullptr;
@@ -98,11 +105,17 @@ void RequestQueue::OnFetchTimer() {
     const auto* data = fetch_dict ? fetch_dict->Find(kDataKey) : nullptr;
     if (!request_time ||
         (base::Time::Now() - *request_time) > request_max_age_ || !data) {
-      it = update->erase(it);
+      it = requests_.erase(it);
+      requests_changed = true;
       continue;
     }
-    start_request_callback_.Run(*data);
-    return;
+    break;
+  }
+  if (requests_changed) {
+    OnRequestsChanged();
+  }
+  if (!requests_.empty()) {
+    start_request_callback_.Run(*requests_.front().GetDict().Find(kDataKey));
   }
 }
 
@@ -118,4 +131,21 @@ void RequestQueue::StartFetchTimer(bool use_backoff_delta) {
       base::BindOnce(&RequestQueue::OnFetchTimer, base::Unretained(this)));
 }
 
+void RequestQueue::OnRequestsChanged() {
+  if (commit_delay_.is_zero()) {
+    CommitRequests();
+    return;
+  }
+  if (!commit_timer_.IsRunning()) {
+    commit_timer_.Start(FROM_HERE, commit_delay_,
+                        base::BindOnce(&RequestQueue::CommitRequests,
+                                       base::Unretained(this)));
+  }
+}
+
+void RequestQueue::CommitRequests() {
+  commit_timer_.Stop();
+  profile_prefs_->SetList(list_pref_name_.value(), requests_.Clone());
+}
+
 }  // namespace web_discovery
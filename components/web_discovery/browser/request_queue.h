@@ -23,6 +23,8 @@ namespace web_discovery {
 // an interval range. If request failures exceed the threshold defined in
 // `max_retries`, the request will be dropped from the list. If a persisted
 // request age exceeds `request_max_age`, the request will be dropped.
+// Requests are kept in memory and written to prefs after
+// `features::kRequestQueueCommitDelay`, or when the queue is destroyed.
 class RequestQueue {
  public:
   RequestQueue(
@@ -48,6 +50,8 @@ class RequestQueue {
  private:
   void OnFetchTimer();
   void StartFetchTimer(bool use_backoff_delta);
+  void OnRequestsChanged();
+  void CommitRequests();
 
   raw_ptr<PrefService> profile_prefs_;
   RequestQueuePrefName list_pref_name_;
@@ -60,7 +64,11 @@ class RequestQueue {
   size_t max_retries_;
   base::RepeatingCallback<void(const base::Value&)> start_request_callback_;
 
+  base::Value::List requests_;
+  base::TimeDelta commit_delay_;
+
   base::OneShotTimer fetch_timer_;
+  base::OneShotTimer commit_timer_;
 };
 
 }  // namespace web_discovery
@@ -8,10 +8,12 @@
 #include <memory>
 #include <utility>
 
+#include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
 #include "base/values.h"
 #include "brave/components/web_discovery/browser/pref_names.h"
 #include "brave/components/web_discovery/browser/web_discovery_service.h"
+#include "brave/components/web_discovery/common/features.h"
 #include "components/prefs/testing_pref_service.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -29,6 +31,11 @@ class WebDiscoveryRequestQueueTest : public testing::Test {
 
   void SetUp() override {
     WebDiscoveryService::RegisterProfilePrefs(prefs_.registry());
+    CreateQueue();
+  }
+
+ protected:
+  void CreateQueue() {
     queue_ = std::make_unique<RequestQueue>(
         &prefs_, kScheduledReports,
         /*request_max_age=*/base::Minutes(5),
@@ -39,7 +46,6 @@ class WebDiscoveryRequestQueueTest : public testing::Test {
                             base::Unretained(this)));
   }
 
- protected:
   void OnStartRequest(const base::Value& request) {
     last_request_ = request.Clone();
     requests_made_++;
@@ -153,4 +159,41 @@ TEST_F(WebDiscoveryRequestQueueTest, MultipleRequests) {
   EXPECT_EQ(requests_made_, 0u);
 }
 
+TEST_F(WebDiscoveryRequestQueueTest, DelayedCommit) {
+  base::test::ScopedFeatureList scoped_feature_list;
+  scoped_feature_list.InitAndEnableFeatureWithParameters(
+      features::kBraveWebDiscoveryNative,
+      {{"request_queue_commit_delay", "5m"}});
+  CreateQueue();
+
+  base::Value::Dict request1;
+  request1.Set("test", "value1");
+  queue_->ScheduleRequest(std::move(request1));
+  base::Value::Dict request2;
+  request2.Set("test", "value2");
+  queue_->ScheduleRequest(std::move(request2));
+  EXPECT_TRUE(prefs_.GetList(kScheduledReports.value()).empty());
+
+  task_environment_.FastForwardBy(kWaitInterval);
+  EXPECT_EQ(requests_made_, 1u);
+  queue_->NotifyRequestComplete(true);
+  EXPECT_TRUE(prefs_.GetList(kScheduledReports.value()).empty());
+
+  task_environment_.FastForwardBy(base::Minutes(3));
+  EXPECT_EQ(prefs_.GetList(kScheduledReports.value()).size(), 1u);
+
+  // Pending changes are written when the queue is destroyed, and restored by
+  // the next queue.
+  queue_->ScheduleRequest(base::Value::Dict());
+  queue_.reset();
+  EXPECT_EQ(prefs_.GetList(kScheduledReports.value()).size(), 2u);
+
+  CreateQueue();
+  requests_made_ = 0;
+  task_environment_.FastForwardBy(kWaitInterval);
+  EXPECT_EQ(requests_made_, 1u);
+  ASSERT_TRUE(last_request_.is_dict());
+  EXPECT_EQ(*last_request_.GetDict().FindString("test"), "value2");
+}
+
 }  // namespace web_discovery
@@ -127,6 +127,8 @@ void WebDiscoveryService::OnConfigChange() {
 void WebDiscoveryService::OnPatternsLoaded() {
   if (!content_scraper_) {
     content_scraper_ = ContentScraper::Create(server_config_loader_.get());
+  } else {
+    content_scraper_->OnPatternsLoaded();
   }
   if (!double_fetcher_) {
     double_fetcher_ = std::make_unique<DoubleFetcher>(
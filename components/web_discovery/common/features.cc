@@ -11,5 +11,10 @@ BASE_FEATURE(kBraveWebDiscoveryNative,
              base::FEATURE_DISABLED_BY_DEFAULT);
 const base::FeatureParam<std::string> kPatternsPath{&kBraveWebDiscoveryNative,
                                                     "patterns_path", ""};
+const base::FeatureParam<base::TimeDelta> kRequestQueueCommitDelay{
+    &kBraveWebDiscoveryNative, "request_queue_commit_delay", base::TimeDelta()};
+const base::FeatureParam<bool> kShouldRenderDoubleFetchedSearchPages{
+    &kBraveWebDiscoveryNative, "should_render_double_fetched_search_pages",
+    true};
 
 }  // namespace web_discovery::features
@@ -17,6 +17,14 @@ namespace web_discovery::features {
 // If enabled, the Web Discovery component of the extension should be disabled.
 BASE_DECLARE_FEATURE(kBraveWebDiscoveryNative);
 extern const base::FeatureParam<std::string> kPatternsPath;
+// Delay for writing scheduled double fetches and reports to prefs. Changes
+// made within the delay are coalesced into a single write. Zero writes on
+// every change.
+extern const base::FeatureParam<base::TimeDelta> kRequestQueueCommitDelay;
+// Whether double fetches of search engine result pages are rendered in a
+// background WebContents. If disabled, the static HTML is fetched instead,
+// which avoids spinning up a renderer.
+extern const base::FeatureParam<bool> kShouldRenderDoubleFetchedSearchPages;
 
 }  // namespace web_discovery::features
 
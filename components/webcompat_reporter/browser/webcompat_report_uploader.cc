@@ -9,9 +9,12 @@
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "base/functional/bind.h"
 #include "base/json/json_writer.h"
 #include "base/logging.h"
+#include "base/task/thread_pool.h"
 #include "base/values.h"
 #include "brave/components/brave_stats/browser/brave_stats_updater_util.h"
 #include "brave/components/version_info/version_info.h"
@@ -44,6 +47,38 @@ constexpr char kComponentItemName[] = "name";
 constexpr char kComponentItemId[] = "id";
 constexpr char kComponentItemVersion[] = "version";
 
+// Retries cover transient failures on slow or flaky links, so a multi-MB
+// report is not lost after the user has submitted it.
+constexpr int kMaxUploadRetries = 3;
+
+struct MultipartBody {
+  std::string content_type;
+  std::string data;
+};
+
+// Assembles the multipart body for a report with a screenshot. Runs on a
+// background sequence since the screenshot can be several megabytes.
+MultipartBody BuildMultipartBody(std::string report_details_json,
+                                 std::vector<uint8_t> screenshot_png) {
+  std::string multipart_boundary = net::GenerateMimeMultipartBoundary();
+  MultipartBody body;
+  body.content_type = kMultipartContentTypePrefix + multipart_boundary;
+  body.data.reserve(report_details_json.size() + screenshot_png.size() + 1024);
+
+  net::AddMultipartValueForUpload(kReportDetailsMultipartName,
+                                  report_details_json, multipart_boundary,
+                                  kJsonContentType, &body.data);
+
+  std::string screenshot_png_str(screenshot_png.begin(),
+                                 screenshot_png.end());
+  net::AddMultipartValueForUploadWithFileName(
+      kScreenshotMultipartName, kScreenshotMultipartFilename,
+      screenshot_png_str, multipart_boundary, kPngContentType, &body.data);
+
+  net::AddMultipartFinalDelimiterForUpload(multipart_boundary, &body.data);
+  return body;
+}
+
 std::optional<base::Value> ConvertCompsToValue(
     const std::vector<webcompat_reporter::mojom::ComponentInfoPtr>&
         components) {
@@ -178,27 +213,19 @@ void WebcompatReportUploader::SubmitReport(mojom::ReportInfoPtr report_info) {
   base::JSONWriter::Write(report_details_dict, &report_details_json);
 
   if (report_info->screenshot_png && !report_info->screenshot_png->empty()) {
-    std::string multipart_boundary = net::GenerateMimeMultipartBoundary();
-    std::string content_type = kMultipartContentTypePrefix + multipart_boundary;
-    std::string multipart_data;
-
-    net::AddMultipartValueForUpload(kReportDetailsMultipartName,
-                                    report_details_json, multipart_boundary,
-                                    kJsonContentType, &multipart_data);
-
-    std::string screenshot_png_str;
-    screenshot_png_str = std::string(report_info->screenshot_png->begin(),
-                                     report_info->screenshot_png->end());
-    net::AddMultipartValueForUploadWithFileName(
-        kScreenshotMultipartName, kScreenshotMultipartFilename,
-        screenshot_png_str, multipart_boundary, kPngContentType,
-        &multipart_data);
-
-    net::AddMultipartFinalDelimiterForUpload(multipart_boundary,
-                                             &multipart_data);
-
-    WebcompatReportUploader::CreateAndStartURLLoader(upload_url, content_type,
-                                                     multipart_data);
+    base::ThreadPool::PostTaskAndReplyWithResult(
+        FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+        base::BindOnce(&BuildMultipartBody, std::move(report_details_json),
+                       std::move(report_info->screenshot_png.value())),
+        base::BindOnce(
+            [](base::WeakPtr<WebcompatReportUploader> uploader,
+               const GURL& upload_url, MultipartBody body) {
+              if (uploader) {
+                uploader->CreateAndStartURLLoader(
+                    upload_url, body.content_type, body.data);
+              }
+            },
+            weak_ptr_factory_.GetWeakPtr(), upload_url));
     return;
   }
 
@@ -245,6 +272,9 @@ void WebcompatReportUploader::CreateAndStartURLLoader(
   simple_url_loader_ = network::SimpleURLLoader::Create(
       std::move(resource_request), traffic_annotation);
   simple_url_loader_->AttachStringForUpload(post_data, content_type);
+  simple_url_loader_->SetRetryOptions(
+      kMaxUploadRetries, network::SimpleURLLoader::RETRY_ON_5XX |
+                             network::SimpleURLLoader::RETRY_ON_NETWORK_CHANGE);
   simple_url_loader_->DownloadToStringOfUnboundedSizeUntilCrashAndDie(
       shared_url_loader_factory_.get(),
       base::BindOnce(&WebcompatReportUploader::OnSimpleURLLoaderComplete,
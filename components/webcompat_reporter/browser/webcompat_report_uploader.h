@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
 #include "base/values.h"
 #include "brave/components/webcompat_reporter/common/webcompat_reporter.mojom.h"
@@ -41,6 +42,7 @@ class WebcompatReportUploader {
                                const std::string& post_data);
   void OnSimpleURLLoaderComplete(std::unique_ptr<std::string> response_body);
   SEQUENCE_CHECKER(sequence_checker_);
+  base::WeakPtrFactory<WebcompatReportUploader> weak_ptr_factory_{this};
 };
 
 }  // namespace webcompat_reporter
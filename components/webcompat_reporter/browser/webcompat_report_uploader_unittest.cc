@@ -7,14 +7,18 @@
 
 #include <memory>
 #include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "base/test/bind.h"
 #include "base/test/run_until.h"
 #include "base/test/task_environment.h"
 #include "base/test/values_test_util.h"
 #include "base/values.h"
+#include "base/strings/string_util.h"
 #include "brave/components/brave_stats/browser/brave_stats_updater_util.h"
+#include "net/http/http_request_headers.h"
 #include "services/network/public/cpp/resource_request.h"
 #include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
 #include "services/network/test/test_url_loader_factory.h"
@@ -115,4 +119,27 @@ TEST_F(WebcompatReportUploaderUnitTest, GenerateReport) {
           .Set("webcompatReportErrors", std::move(errors_list)));
 }
 
+TEST_F(WebcompatReportUploaderUnitTest, GenerateReportWithScreenshot) {
+  std::optional<std::string> request_payload;
+  std::optional<std::string> content_type;
+  url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
+      [&](const network::ResourceRequest& request) {
+        request_payload = network::GetUploadData(request);
+        content_type =
+            request.headers.GetHeader(net::HttpRequestHeaders::kContentType);
+      }));
+
+  auto report = webcompat_reporter::mojom::ReportInfo::New();
+  report->screenshot_png = std::vector<uint8_t>{'P', 'N', 'G'};
+  GetWebcompatUploader()->SubmitReport(std::move(report));
+
+  EXPECT_TRUE(
+      base::test::RunUntil([&]() { return request_payload.has_value(); }));
+  ASSERT_TRUE(content_type);
+  EXPECT_TRUE(base::StartsWith(*content_type, "multipart/form-data"));
+  EXPECT_NE(request_payload->find("filename=\"screenshot.png\""),
+            std::string::npos);
+  EXPECT_NE(request_payload->find("PNG"), std::string::npos);
+}
+
 }  // namespace webcompat_reporter
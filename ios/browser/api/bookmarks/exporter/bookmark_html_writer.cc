@@ -104,6 +104,9 @@ constexpr char kFolderChildrenEnd[] = "</DL><p>";
 // Number of characters to indent by.
 const size_t kIndentSize = 4;
 
+// Amount of text buffered before it is written to the file.
+const size_t kWriteBufferSize = 64 * 1024;
+
 // Fetches favicons for list of bookmarks and then starts Writer which outputs
 // bookmarks and favicons to html file.
 class BookmarkFaviconFetcher : public base::SupportsUserData::Data {
@@ -223,6 +226,10 @@ class Writer : public base::RefCountedThreadSafe<Writer> {
 
     Write(kFolderChildrenEnd);
     Write(kNewline);
+    if (!Flush()) {
+      NotifyOnFinish(BookmarksExportObserver::Result::kCouldNotWriteNodes);
+      return;
+    }
     // File close is forced so that unit test could read it.
     file_.reset();
 
@@ -273,13 +280,25 @@ class Writer : public base::RefCountedThreadSafe<Writer> {
   }
 
   // Writes raw text out returning true on success. This does not escape
-  // the text in anyway.
+  // the text in anyway. The text is buffered so that large exports do not
+  // issue a write per attribute.
   bool Write(const std::string& text) {
-    if (!text.length())
+    buffer_.append(text);
+    if (buffer_.size() < kWriteBufferSize) {
+      return true;
+    }
+    return Flush();
+  }
+
+  // Writes out any buffered text, returning true on success.
+  bool Flush() {
+    if (buffer_.empty()) {
       return true;
-    size_t wrote =
-        UNSAFE_TODO(file_->WriteAtCurrentPos(text.c_str(), text.length()));
-    bool result = (wrote == text.length());
+    }
+    size_t wrote = UNSAFE_TODO(
+        file_->WriteAtCurrentPos(buffer_.c_str(), buffer_.length()));
+    bool result = (wrote == buffer_.length());
+    buffer_.clear();
     if (!result) {
       PLOG(ERROR) << "Could not write text to " << path_;
       return false;
@@ -423,6 +442,9 @@ class Writer : public base::RefCountedThreadSafe<Writer> {
   // File we're writing to.
   std::unique_ptr<base::File> file_;
 
+  // Text not yet written to |file_|.
+  std::string buffer_;
+
   // How much we indent when writing a bookmark/folder. This is modified
   // via IncrementIndent and DecrementIndent.
   std::string indent_;
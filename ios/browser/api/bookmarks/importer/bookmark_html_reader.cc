@@ -8,6 +8,9 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <string_view>
+#include <utility>
+
 #include "base/check.h"
 #include "base/files/file_util.h"
 #include "base/functional/callback.h"
@@ -114,7 +117,9 @@ void ImportBookmarksFile(
     favicon_base::FaviconUsageDataList* favicons) {
   std::string content;
   base::ReadFileToString(file_path, &content);
-  std::vector<std::string> lines = base::SplitString(
+  // Split into views of |content| so large files are not held in memory
+  // twice.
+  std::vector<std::string_view> lines = base::SplitStringPiece(
       content, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_ALL);
 
   std::u16string last_folder;
@@ -209,7 +214,7 @@ void ImportBookmarksFile(
         }
         entry.path.assign(path.begin(), path.end());
       }
-      bookmarks->push_back(entry);
+      bookmarks->push_back(std::move(entry));
 
       // Save the favicon. DataURLToFaviconUsage will handle the case where
       // there is no favicon.
@@ -253,12 +258,12 @@ void ImportBookmarksFile(
             entry.in_toolbar = true;
             entry.path.assign(path.begin() + toolbar_folder_index - 1,
                               path.end());
-            bookmarks->push_back(entry);
+            bookmarks->push_back(std::move(entry));
           }
         } else {
           // Add this folder to the list of |bookmarks|.
           entry.path.assign(path.begin(), path.end());
-          bookmarks->push_back(entry);
+          bookmarks->push_back(std::move(entry));
         }
 
         // Parent folder include current one, so it's not empty.
@@ -6,7 +6,9 @@
 #include "brave/ios/browser/api/bookmarks/importer/bookmarks_importer.h"
 
 #include <algorithm>
+#include <map>
 #include <set>
+#include <utility>
 
 #include "base/base_paths.h"
 #include "base/check.h"
@@ -92,32 +94,34 @@ void BookmarksImporter::AddBookmarks(
   const BookmarkNode* bookmark_bar = model->mobile_node();
   bool import_to_top_level = bookmark_bar->children().empty();
 
-  // Reorder bookmarks so that the toolbar entries come first.
-  std::vector<ImportedBookmarkEntry> toolbar_bookmarks;
-  std::vector<ImportedBookmarkEntry> reordered_bookmarks;
-  for (auto it = bookmarks.begin(); it != bookmarks.end(); ++it) {
-    if (it->in_toolbar)
-      toolbar_bookmarks.push_back(*it);
-    else
-      reordered_bookmarks.push_back(*it);
+  // Reorder bookmarks so that the toolbar entries come first. Only pointers
+  // are reordered, so large imports are not copied.
+  std::vector<const ImportedBookmarkEntry*> reordered_bookmarks;
+  reordered_bookmarks.reserve(bookmarks.size());
+  for (const auto& entry : bookmarks) {
+    reordered_bookmarks.push_back(&entry);
   }
-  reordered_bookmarks.insert(reordered_bookmarks.begin(),
-                             toolbar_bookmarks.begin(),
-                             toolbar_bookmarks.end());
+  const auto toolbar_bookmarks_end = std::stable_partition(
+      reordered_bookmarks.begin(), reordered_bookmarks.end(),
+      [](const ImportedBookmarkEntry* entry) { return entry->in_toolbar; });
+  const bool has_toolbar_bookmarks =
+      toolbar_bookmarks_end != reordered_bookmarks.begin();
 
   // If the user currently has no bookmarks in the bookmark bar, make sure that
   // at least some of the imported bookmarks end up there.  Otherwise, we'll end
   // up with just a single folder containing the imported bookmarks, which makes
   // for unnecessary nesting.
-  bool add_all_to_top_level = import_to_top_level && toolbar_bookmarks.empty();
+  bool add_all_to_top_level = import_to_top_level && !has_toolbar_bookmarks;
 
   model->BeginExtensiveChanges();
 
   std::set<const BookmarkNode*> folders_added_to;
+  // Enclosing folders already looked up, keyed by parent and title, so that
+  // folders with many children are not scanned once per imported bookmark.
+  std::map<std::pair<const BookmarkNode*, std::u16string>, const BookmarkNode*>
+      enclosing_folders;
   const BookmarkNode* top_level_folder = NULL;
-  for (std::vector<ImportedBookmarkEntry>::const_iterator bookmark =
-           reordered_bookmarks.begin();
-       bookmark != reordered_bookmarks.end(); ++bookmark) {
+  for (const ImportedBookmarkEntry* bookmark : reordered_bookmarks) {
     // Disregard any bookmarks with invalid urls.
     if (!bookmark->is_folder && !bookmark->url.is_valid())
       continue;
@@ -150,14 +154,20 @@ void BookmarksImporter::AddBookmarks(
         continue;
       }
 
-      const auto it = std::ranges::find_if(
-          parent->children(), [folder_name](const auto& node) {
-            return node->is_folder() && node->GetTitle() == *folder_name;
-          });
-      parent = (it == parent->children().cend())
-                   ? model->AddFolder(parent, parent->children().size(),
-                                      *folder_name)
-                   : it->get();
+      auto [cached, inserted] =
+          enclosing_folders.try_emplace({parent, *folder_name}, nullptr);
+      if (inserted) {
+        const auto it = std::ranges::find_if(
+            parent->children(), [folder_name](const auto& node) {
+              return node->is_folder() && node->GetTitle() == *folder_name;
+            });
+        cached->second =
+            (it == parent->children().cend())
+                ? model->AddFolder(parent, parent->children().size(),
+                                   *folder_name)
+                : it->get();
+      }
+      parent = cached->second;
     }
 
     folders_added_to.insert(parent);
@@ -11,14 +11,17 @@
 
 #include "base/check.h"
 #include "base/check_op.h"
+#include "base/feature_list.h"
 #include "base/functional/bind.h"
 #include "base/json/json_writer.h"
 #include "base/logging.h"
 #include "base/memory/weak_ptr.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/sys_string_conversions.h"
+#include "base/time/time.h"
 #include "brave/components/brave_sync/brave_sync_prefs.h"
 #include "brave/components/brave_sync/crypto/crypto.h"
+#include "brave/components/brave_sync/features.h"
 #include "brave/components/brave_sync/qr_code_data.h"
 #include "brave/components/brave_sync/qr_code_validator.h"
 #include "brave/components/brave_sync/sync_service_impl_helper.h"
@@ -40,6 +43,7 @@
 
 namespace {
 static const size_t SEED_BYTES_COUNT = 32u;
+constexpr base::TimeDelta kDeviceInfoNotificationInterval = base::Seconds(1);
 }  // namespace
 
 BraveSyncDeviceTracker::BraveSyncDeviceTracker(
@@ -55,6 +59,30 @@ BraveSyncDeviceTracker::~BraveSyncDeviceTracker() {
 }
 
 void BraveSyncDeviceTracker::OnDeviceInfoChange() {
+  if (!base::FeatureList::IsEnabled(
+          brave_sync::features::kBraveSyncThrottleDeviceInfoNotifications)) {
+    NotifyDeviceInfoChanged();
+    return;
+  }
+
+  // Each notification makes the UI fetch and serialize the whole device
+  // list, so bursts of changes are delivered as a single trailing one.
+  if (pending_notification_timer_.IsRunning()) {
+    return;
+  }
+  const base::TimeDelta elapsed =
+      base::TimeTicks::Now() - last_notification_time_;
+  if (elapsed >= kDeviceInfoNotificationInterval) {
+    NotifyDeviceInfoChanged();
+    return;
+  }
+  pending_notification_timer_.Start(
+      FROM_HERE, kDeviceInfoNotificationInterval - elapsed, this,
+      &BraveSyncDeviceTracker::NotifyDeviceInfoChanged);
+}
+
+void BraveSyncDeviceTracker::NotifyDeviceInfoChanged() {
+  last_notification_time_ = base::TimeTicks::Now();
   if (on_device_info_changed_callback_) {
     on_device_info_changed_callback_.Run();
   }
@@ -14,6 +14,8 @@
 #include "base/memory/raw_ptr.h"
 #include "base/scoped_multi_source_observation.h"
 #include "base/scoped_observation.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "brave/components/brave_sync/time_limited_words.h"
 #include "components/sync/engine/sync_protocol_error.h"
 #include "components/sync/service/sync_service.h"
@@ -44,9 +46,15 @@ class BraveSyncDeviceTracker : public syncer::DeviceInfoTracker::Observer {
 
  private:
   void OnDeviceInfoChange() override;
+  void NotifyDeviceInfoChanged();
 
   base::RepeatingCallback<void()> on_device_info_changed_callback_;
 
+  // Used to deliver at most one notification per throttle interval when
+  // kBraveSyncThrottleDeviceInfoNotifications is enabled.
+  base::TimeTicks last_notification_time_;
+  base::OneShotTimer pending_notification_timer_;
+
   base::ScopedObservation<syncer::DeviceInfoTracker,
                           syncer::DeviceInfoTracker::Observer>
       device_info_tracker_observer_{this};
@@ -254,6 +254,9 @@ BraveSessionCache::BraveSessionCache(ExecutionContext& context)
                     default_shields_settings_->farbling_token.low() ^
                         storage_key_nonce_hash);
   }
+
+  farbling_seed_ = default_shields_settings_->farbling_token.high() ^
+                   default_shields_settings_->farbling_token.low();
 }
 
 BraveSessionCache& BraveSessionCache::From(ExecutionContext& context) {
@@ -273,10 +276,18 @@ void BraveSessionCache::Init() {
 
 std::optional<blink::BraveAudioFarblingHelper>
 BraveSessionCache::GetAudioFarblingHelper() {
+  if (auto* audio_farbling_helper = GetOrCreateAudioFarblingHelper()) {
+    return *audio_farbling_helper;
+  }
+  return std::nullopt;
+}
+
+blink::BraveAudioFarblingHelper*
+BraveSessionCache::GetOrCreateAudioFarblingHelper() {
   const auto audio_farbling_level =
       GetBraveFarblingLevel(ContentSettingsType::BRAVE_WEBCOMPAT_AUDIO);
   if (audio_farbling_level == BraveFarblingLevel::OFF) {
-    return std::nullopt;
+    return nullptr;
   }
   if (!audio_farbling_helper_) {
     // This call is only expensive the first time; afterwards it returns
@@ -288,12 +299,16 @@ BraveSessionCache::GetAudioFarblingHelper() {
         fudge_factor, seed,
         audio_farbling_level == BraveFarblingLevel::MAXIMUM);
   }
-  return audio_farbling_helper_;
+  return &*audio_farbling_helper_;
 }
 
 void BraveSessionCache::FarbleAudioChannel(base::span<float> dst) {
-  const auto& audio_farbling_helper = GetAudioFarblingHelper();
-  if (audio_farbling_helper) {
+  if (dst.empty()) {
+    return;
+  }
+  // Farble with the cached helper in place rather than through a copy, as
+  // getChannelData() and copyFromChannel() can be called every frame.
+  if (auto* audio_farbling_helper = GetOrCreateAudioFarblingHelper()) {
     audio_farbling_helper->FarbleAudioChannel(dst);
   }
 }
@@ -345,6 +360,15 @@ void BraveSessionCache::PerturbPixelsInternal(base::span<uint8_t> data) {
 blink::String BraveSessionCache::GenerateRandomString(
     std::string_view seed,
     blink::wtf_size_t length) {
+  blink::StringBuilder cache_key_builder;
+  cache_key_builder.Append(blink::String::FromUTF8(seed));
+  cache_key_builder.Append('|');
+  cache_key_builder.AppendNumber(length);
+  const blink::String cache_key = cache_key_builder.ToString();
+  auto cached = random_strings_.find(cache_key);
+  if (cached != random_strings_.end()) {
+    return cached->value;
+  }
   auto key = crypto::hmac::SignSha256(
       default_shields_settings_->farbling_token.AsBytes(),
       base::as_byte_span(seed));
@@ -356,6 +380,7 @@ blink::String BraveSessionCache::GenerateRandomString(
     c = kLettersForRandomStrings.at(v % kLettersForRandomStrings.size());
     v = lfsr_next(v);
   }
+  random_strings_.insert(cache_key, value);
   return value;
 }
 
@@ -375,17 +400,15 @@ int BraveSessionCache::FarbledInteger(FarbleKey key,
                                       int spoof_value,
                                       int min_random_offset,
                                       int max_random_offset) {
-  auto item = farbled_integers_.find(key);
-  if (item == farbled_integers_.end()) {
+  CHECK_LT(key, FarbleKey::kKeyCount);
+  std::optional<int>& offset = farbled_integers_[key];
+  if (!offset) {
     FarblingPRNG prng = MakePseudoRandomGenerator(key);
-    auto added = farbled_integers_.insert(
-        key, base::checked_cast<int>(
-                 prng() % (1 + max_random_offset - min_random_offset) +
-                 min_random_offset));
-
-    return added.stored_value->value + spoof_value;
+    offset = base::checked_cast<int>(
+        prng() % (1 + max_random_offset - min_random_offset) +
+        min_random_offset);
   }
-  return item->value + spoof_value;
+  return *offset + spoof_value;
 }
 
 bool BraveSessionCache::AllowFontFamily(
@@ -419,10 +442,17 @@ bool BraveSessionCache::AllowFontFamily(
 }
 
 FarblingPRNG BraveSessionCache::MakePseudoRandomGenerator(FarbleKey key) {
-  uint64_t seed = default_shields_settings_->farbling_token.high() ^
-                  default_shields_settings_->farbling_token.low() ^
-                  static_cast<uint64_t>(key);
-  return FarblingPRNG(seed);
+  return FarblingPRNG(farbling_seed_ ^ static_cast<uint64_t>(key));
+}
+
+double BraveSessionCache::GetOrComputeFarbledValue(
+    FarbledValueKey key,
+    base::FunctionRef<double()> compute) {
+  std::optional<double>& value = farbled_values_[static_cast<size_t>(key)];
+  if (!value) {
+    value = compute();
+  }
+  return *value;
 }
 
 BraveFarblingLevel BraveSessionCache::GetBraveFarblingLevel(
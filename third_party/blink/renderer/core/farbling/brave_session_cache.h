@@ -6,10 +6,12 @@
 #ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_FARBLING_BRAVE_SESSION_CACHE_H_
 #define BRAVE_THIRD_PARTY_BLINK_RENDERER_CORE_FARBLING_BRAVE_SESSION_CACHE_H_
 
+#include <array>
 #include <optional>
 #include <string>
 
 #include "base/containers/span.h"
+#include "base/functional/function_ref.h"
 #include "brave/third_party/blink/renderer/brave_farbling_constants.h"
 #include "brave/third_party/blink/renderer/platform/brave_audio_farbling_helper.h"
 #include "components/content_settings/core/common/content_settings_types.h"
@@ -43,6 +45,14 @@ enum FarbleKey : uint64_t {
   kKeyCount
 };
 
+// Farbled values that are derived only from the farbling level and the
+// session seed, and are therefore computed once per execution context.
+enum class FarbledValueKey {
+  kHardwareConcurrency,
+  kDeviceMemory,
+  kMaxValue = kDeviceMemory,
+};
+
 typedef absl::randen_engine<uint64_t> FarblingPRNG;
 
 CORE_EXPORT blink::WebContentSettingsClient* GetContentSettingsClientFor(
@@ -94,12 +104,29 @@ class CORE_EXPORT BraveSessionCache final
   bool AllowFontFamily(blink::WebContentSettingsClient* settings,
                        const blink::AtomicString& family_name);
   FarblingPRNG MakePseudoRandomGenerator(FarbleKey key = FarbleKey::kNone);
+  // Returns the value cached for |key|, calling |compute| only the first time.
+  double GetOrComputeFarbledValue(FarbledValueKey key,
+                                  base::FunctionRef<double()> compute);
   std::optional<blink::BraveAudioFarblingHelper> GetAudioFarblingHelper();
 
  private:
   void PerturbPixelsInternal(base::span<uint8_t> data);
-
-  blink::HashMap<FarbleKey, int> farbled_integers_;
+  // Returns the cached audio farbling helper, creating it on first use, or
+  // nullptr if audio farbling is off.
+  blink::BraveAudioFarblingHelper* GetOrCreateAudioFarblingHelper();
+
+  // Random offsets used by FarbledInteger(), computed the first time each key
+  // is requested.
+  std::array<std::optional<int>, FarbleKey::kKeyCount> farbled_integers_;
+  // Values returned by GetOrComputeFarbledValue().
+  std::array<std::optional<double>,
+             static_cast<size_t>(FarbledValueKey::kMaxValue) + 1>
+      farbled_values_;
+  // Strings returned by GenerateRandomString(), keyed by seed and length, so
+  // repeated reads do not recompute the HMAC.
+  blink::HashMap<blink::String, blink::String> random_strings_;
+  // Base seed of MakePseudoRandomGenerator(), derived from the farbling token.
+  uint64_t farbling_seed_ = 0;
   brave_shields::mojom::ShieldsSettingsPtr default_shields_settings_;
   std::optional<blink::BraveAudioFarblingHelper> audio_farbling_helper_;
   blink::HashMap<ContentSettingsType, BraveFarblingLevel> farbling_levels_;